@@ -31,7 +31,12 @@ endif
 LOCAL_MODULE := BRX-PAL
 
 LOCAL_SRC_FILES := \
+	$(LOCAL_PATH)/../source/brx_pal_acceleration_structure_update_manager.cpp \
+	$(LOCAL_PATH)/../source/brx_pal_bindless_descriptor_index_allocator.cpp \
+	$(LOCAL_PATH)/../source/brx_pal_deferred_destruction_queue.cpp \
 	$(LOCAL_PATH)/../source/brx_pal_device.cpp \
+	$(LOCAL_PATH)/../source/brx_pal_object_pool.cpp \
+	$(LOCAL_PATH)/../source/brx_pal_render_graph.cpp \
 	$(LOCAL_PATH)/../source/brx_pal_vk_buffer.cpp \
 	$(LOCAL_PATH)/../source/brx_pal_vk_command_buffer.cpp \
 	$(LOCAL_PATH)/../source/brx_pal_vk_descriptor.cpp \
@@ -39,10 +44,12 @@ LOCAL_SRC_FILES := \
 	$(LOCAL_PATH)/../source/brx_pal_vk_fence.cpp \
 	$(LOCAL_PATH)/../source/brx_pal_vk_frame_buffer.cpp \
 	$(LOCAL_PATH)/../source/brx_pal_vk_image.cpp \
+	$(LOCAL_PATH)/../source/brx_pal_vk_memory_heap.cpp \
 	$(LOCAL_PATH)/../source/brx_pal_vk_pipeline.cpp \
 	$(LOCAL_PATH)/../source/brx_pal_vk_queue.cpp \
 	$(LOCAL_PATH)/../source/brx_pal_vk_render_pass.cpp \
 	$(LOCAL_PATH)/../source/brx_pal_vk_sampler.cpp \
+	$(LOCAL_PATH)/../source/brx_pal_vk_shader_module_cache.cpp \
 	$(LOCAL_PATH)/../source/brx_pal_vk_swap_chain.cpp \
 	$(LOCAL_PATH)/../source/brx_pal_vk_vma.cpp \
 	$(LOCAL_PATH)/../thirdparty/McRT-Malloc/source/mcrt_malloc.cpp 
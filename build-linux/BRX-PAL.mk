@@ -57,7 +57,12 @@ all :  \
 # Link
 $(BIN_DIR)/libBRX-PAL.so: \
 	$(LOCAL_PATH)/libBRX-PAL.map \
+	$(OBJ_DIR)/BRX-PAL-brx_pal_acceleration_structure_update_manager.o \
+	$(OBJ_DIR)/BRX-PAL-brx_pal_bindless_descriptor_index_allocator.o \
+	$(OBJ_DIR)/BRX-PAL-brx_pal_deferred_destruction_queue.o \
 	$(OBJ_DIR)/BRX-PAL-brx_pal_device.o \
+	$(OBJ_DIR)/BRX-PAL-brx_pal_object_pool.o \
+	$(OBJ_DIR)/BRX-PAL-brx_pal_render_graph.o \
 	$(OBJ_DIR)/BRX-PAL-brx_pal_vk_buffer.o \
 	$(OBJ_DIR)/BRX-PAL-brx_pal_vk_command_buffer.o \
 	$(OBJ_DIR)/BRX-PAL-brx_pal_vk_descriptor.o \
@@ -65,17 +70,24 @@ $(BIN_DIR)/libBRX-PAL.so: \
 	$(OBJ_DIR)/BRX-PAL-brx_pal_vk_fence.o \
 	$(OBJ_DIR)/BRX-PAL-brx_pal_vk_frame_buffer.o \
 	$(OBJ_DIR)/BRX-PAL-brx_pal_vk_image.o \
+	$(OBJ_DIR)/BRX-PAL-brx_pal_vk_memory_heap.o \
 	$(OBJ_DIR)/BRX-PAL-brx_pal_vk_pipeline.o \
 	$(OBJ_DIR)/BRX-PAL-brx_pal_vk_queue.o \
 	$(OBJ_DIR)/BRX-PAL-brx_pal_vk_render_pass.o \
 	$(OBJ_DIR)/BRX-PAL-brx_pal_vk_sampler.o \
+	$(OBJ_DIR)/BRX-PAL-brx_pal_vk_shader_module_cache.o \
 	$(OBJ_DIR)/BRX-PAL-brx_pal_vk_swap_chain.o \
 	$(OBJ_DIR)/BRX-PAL-brx_pal_vk_vma.o \
 	$(OBJ_DIR)/BRX-PAL-thirdparty-McRT-Malloc-mcrt_malloc.o
 	$(HIDE) mkdir -p $(BIN_DIR)
 	$(HIDE) $(CC) -shared $(LD_FLAGS) \
 		-Wl,--version-script=$(LOCAL_PATH)/libBRX-PAL.map \
+		$(OBJ_DIR)/BRX-PAL-brx_pal_acceleration_structure_update_manager.o \
+		$(OBJ_DIR)/BRX-PAL-brx_pal_bindless_descriptor_index_allocator.o \
+		$(OBJ_DIR)/BRX-PAL-brx_pal_deferred_destruction_queue.o \
 		$(OBJ_DIR)/BRX-PAL-brx_pal_device.o \
+		$(OBJ_DIR)/BRX-PAL-brx_pal_object_pool.o \
+		$(OBJ_DIR)/BRX-PAL-brx_pal_render_graph.o \
 		$(OBJ_DIR)/BRX-PAL-brx_pal_vk_buffer.o \
 		$(OBJ_DIR)/BRX-PAL-brx_pal_vk_command_buffer.o \
 		$(OBJ_DIR)/BRX-PAL-brx_pal_vk_descriptor.o \
@@ -83,10 +95,12 @@ $(BIN_DIR)/libBRX-PAL.so: \
 		$(OBJ_DIR)/BRX-PAL-brx_pal_vk_fence.o \
 		$(OBJ_DIR)/BRX-PAL-brx_pal_vk_frame_buffer.o \
 		$(OBJ_DIR)/BRX-PAL-brx_pal_vk_image.o \
+		$(OBJ_DIR)/BRX-PAL-brx_pal_vk_memory_heap.o \
 		$(OBJ_DIR)/BRX-PAL-brx_pal_vk_pipeline.o \
 		$(OBJ_DIR)/BRX-PAL-brx_pal_vk_queue.o \
 		$(OBJ_DIR)/BRX-PAL-brx_pal_vk_render_pass.o \
 		$(OBJ_DIR)/BRX-PAL-brx_pal_vk_sampler.o \
+		$(OBJ_DIR)/BRX-PAL-brx_pal_vk_shader_module_cache.o \
 		$(OBJ_DIR)/BRX-PAL-brx_pal_vk_swap_chain.o \
 		$(OBJ_DIR)/BRX-PAL-brx_pal_vk_vma.o \
 		$(OBJ_DIR)/BRX-PAL-thirdparty-McRT-Malloc-mcrt_malloc.o \
@@ -94,10 +108,30 @@ $(BIN_DIR)/libBRX-PAL.so: \
 		-o $(BIN_DIR)/libBRX-PAL.so
 
 # Compile
+$(OBJ_DIR)/BRX-PAL-brx_pal_acceleration_structure_update_manager.o: $(SOURCE_DIR)/brx_pal_acceleration_structure_update_manager.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) $(CC) -c $(C_FLAGS) $(SOURCE_DIR)/brx_pal_acceleration_structure_update_manager.cpp -MD -MF $(OBJ_DIR)/BRX-PAL-brx_pal_acceleration_structure_update_manager.d -o $(OBJ_DIR)/BRX-PAL-brx_pal_acceleration_structure_update_manager.o
+
+$(OBJ_DIR)/BRX-PAL-brx_pal_bindless_descriptor_index_allocator.o: $(SOURCE_DIR)/brx_pal_bindless_descriptor_index_allocator.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) $(CC) -c $(C_FLAGS) $(SOURCE_DIR)/brx_pal_bindless_descriptor_index_allocator.cpp -MD -MF $(OBJ_DIR)/BRX-PAL-brx_pal_bindless_descriptor_index_allocator.d -o $(OBJ_DIR)/BRX-PAL-brx_pal_bindless_descriptor_index_allocator.o
+
+$(OBJ_DIR)/BRX-PAL-brx_pal_deferred_destruction_queue.o: $(SOURCE_DIR)/brx_pal_deferred_destruction_queue.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) $(CC) -c $(C_FLAGS) $(SOURCE_DIR)/brx_pal_deferred_destruction_queue.cpp -MD -MF $(OBJ_DIR)/BRX-PAL-brx_pal_deferred_destruction_queue.d -o $(OBJ_DIR)/BRX-PAL-brx_pal_deferred_destruction_queue.o
+
 $(OBJ_DIR)/BRX-PAL-brx_pal_device.o: $(SOURCE_DIR)/brx_pal_device.cpp
 	$(HIDE) mkdir -p $(OBJ_DIR)
 	$(HIDE) $(CC) -c $(C_FLAGS) $(SOURCE_DIR)/brx_pal_device.cpp -MD -MF $(OBJ_DIR)/BRX-PAL-brx_pal_device.d -o $(OBJ_DIR)/BRX-PAL-brx_pal_device.o
 
+$(OBJ_DIR)/BRX-PAL-brx_pal_object_pool.o: $(SOURCE_DIR)/brx_pal_object_pool.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) $(CC) -c $(C_FLAGS) $(SOURCE_DIR)/brx_pal_object_pool.cpp -MD -MF $(OBJ_DIR)/BRX-PAL-brx_pal_object_pool.d -o $(OBJ_DIR)/BRX-PAL-brx_pal_object_pool.o
+
+$(OBJ_DIR)/BRX-PAL-brx_pal_render_graph.o: $(SOURCE_DIR)/brx_pal_render_graph.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) $(CC) -c $(C_FLAGS) $(SOURCE_DIR)/brx_pal_render_graph.cpp -MD -MF $(OBJ_DIR)/BRX-PAL-brx_pal_render_graph.d -o $(OBJ_DIR)/BRX-PAL-brx_pal_render_graph.o
+
 $(OBJ_DIR)/BRX-PAL-brx_pal_vk_buffer.o: $(SOURCE_DIR)/brx_pal_vk_buffer.cpp
 	$(HIDE) mkdir -p $(OBJ_DIR)
 	$(HIDE) $(CC) -c $(C_FLAGS) $(SOURCE_DIR)/brx_pal_vk_buffer.cpp -MD -MF $(OBJ_DIR)/BRX-PAL-brx_pal_vk_buffer.d -o $(OBJ_DIR)/BRX-PAL-brx_pal_vk_buffer.o
@@ -126,6 +160,10 @@ $(OBJ_DIR)/BRX-PAL-brx_pal_vk_image.o: $(SOURCE_DIR)/brx_pal_vk_image.cpp
 	$(HIDE) mkdir -p $(OBJ_DIR)
 	$(HIDE) $(CC) -c $(C_FLAGS) $(SOURCE_DIR)/brx_pal_vk_image.cpp -MD -MF $(OBJ_DIR)/BRX-PAL-brx_pal_vk_image.d -o $(OBJ_DIR)/BRX-PAL-brx_pal_vk_image.o
 
+$(OBJ_DIR)/BRX-PAL-brx_pal_vk_memory_heap.o: $(SOURCE_DIR)/brx_pal_vk_memory_heap.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) $(CC) -c $(C_FLAGS) $(SOURCE_DIR)/brx_pal_vk_memory_heap.cpp -MD -MF $(OBJ_DIR)/BRX-PAL-brx_pal_vk_memory_heap.d -o $(OBJ_DIR)/BRX-PAL-brx_pal_vk_memory_heap.o
+
 $(OBJ_DIR)/BRX-PAL-brx_pal_vk_pipeline.o: $(SOURCE_DIR)/brx_pal_vk_pipeline.cpp
 	$(HIDE) mkdir -p $(OBJ_DIR)
 	$(HIDE) $(CC) -c $(C_FLAGS) $(SOURCE_DIR)/brx_pal_vk_pipeline.cpp -MD -MF $(OBJ_DIR)/BRX-PAL-brx_pal_vk_pipeline.d -o $(OBJ_DIR)/BRX-PAL-brx_pal_vk_pipeline.o
@@ -142,6 +180,10 @@ $(OBJ_DIR)/BRX-PAL-brx_pal_vk_sampler.o: $(SOURCE_DIR)/brx_pal_vk_sampler.cpp
 	$(HIDE) mkdir -p $(OBJ_DIR)
 	$(HIDE) $(CC) -c $(C_FLAGS) $(SOURCE_DIR)/brx_pal_vk_sampler.cpp -MD -MF $(OBJ_DIR)/BRX-PAL-brx_pal_vk_sampler.d -o $(OBJ_DIR)/BRX-PAL-brx_pal_vk_sampler.o
 
+$(OBJ_DIR)/BRX-PAL-brx_pal_vk_shader_module_cache.o: $(SOURCE_DIR)/brx_pal_vk_shader_module_cache.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) $(CC) -c $(C_FLAGS) $(SOURCE_DIR)/brx_pal_vk_shader_module_cache.cpp -MD -MF $(OBJ_DIR)/BRX-PAL-brx_pal_vk_shader_module_cache.d -o $(OBJ_DIR)/BRX-PAL-brx_pal_vk_shader_module_cache.o
+
 $(OBJ_DIR)/BRX-PAL-brx_pal_vk_swap_chain.o: $(SOURCE_DIR)/brx_pal_vk_swap_chain.cpp
 	$(HIDE) mkdir -p $(OBJ_DIR)
 	$(HIDE) $(CC) -c $(C_FLAGS) $(SOURCE_DIR)/brx_pal_vk_swap_chain.cpp -MD -MF $(OBJ_DIR)/BRX-PAL-brx_pal_vk_swap_chain.d -o $(OBJ_DIR)/BRX-PAL-brx_pal_vk_swap_chain.o
@@ -156,7 +198,12 @@ $(OBJ_DIR)/BRX-PAL-thirdparty-McRT-Malloc-mcrt_malloc.o: $(THIRD_PARTY_DIR)/McRT
 
 
 -include \
+	$(OBJ_DIR)/BRX-PAL-brx_pal_acceleration_structure_update_manager.d \
+	$(OBJ_DIR)/BRX-PAL-brx_pal_bindless_descriptor_index_allocator.d \
+	$(OBJ_DIR)/BRX-PAL-brx_pal_deferred_destruction_queue.d \
 	$(OBJ_DIR)/BRX-PAL-brx_pal_device.d \
+	$(OBJ_DIR)/BRX-PAL-brx_pal_object_pool.d \
+	$(OBJ_DIR)/BRX-PAL-brx_pal_render_graph.d \
 	$(OBJ_DIR)/BRX-PAL-brx_pal_vk_buffer.d \
 	$(OBJ_DIR)/BRX-PAL-brx_pal_vk_command_buffer.d \
 	$(OBJ_DIR)/BRX-PAL-brx_pal_vk_descriptor.d \
@@ -164,17 +211,24 @@ $(OBJ_DIR)/BRX-PAL-thirdparty-McRT-Malloc-mcrt_malloc.o: $(THIRD_PARTY_DIR)/McRT
 	$(OBJ_DIR)/BRX-PAL-brx_pal_vk_fence.d \
 	$(OBJ_DIR)/BRX-PAL-brx_pal_vk_frame_buffer.d \
 	$(OBJ_DIR)/BRX-PAL-brx_pal_vk_image.d \
+	$(OBJ_DIR)/BRX-PAL-brx_pal_vk_memory_heap.d \
 	$(OBJ_DIR)/BRX-PAL-brx_pal_vk_pipeline.d \
 	$(OBJ_DIR)/BRX-PAL-brx_pal_vk_queue.d \
 	$(OBJ_DIR)/BRX-PAL-brx_pal_vk_render_pass.d \
 	$(OBJ_DIR)/BRX-PAL-brx_pal_vk_sampler.d \
+	$(OBJ_DIR)/BRX-PAL-brx_pal_vk_shader_module_cache.d \
 	$(OBJ_DIR)/BRX-PAL-brx_pal_vk_swap_chain.d \
 	$(OBJ_DIR)/BRX-PAL-brx_pal_vk_vma.d \
 	$(OBJ_DIR)/BRX-PAL-thirdparty-McRT-Malloc-mcrt_malloc.d
 
 clean:
 	$(HIDE) rm -f $(BIN_DIR)/libBRX-PAL.so
+	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_acceleration_structure_update_manager.o
+	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_bindless_descriptor_index_allocator.o
+	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_deferred_destruction_queue.o
 	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_device.o
+	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_object_pool.o
+	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_render_graph.o
 	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_vk_buffer.o
 	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_vk_command_buffer.o
 	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_vk_descriptor.o
@@ -182,14 +236,21 @@ clean:
 	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_vk_fence.o
 	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_vk_frame_buffer.o
 	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_vk_image.o
+	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_vk_memory_heap.o
 	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_vk_pipeline.o
 	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_vk_queue.o
 	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_vk_render_pass.o
 	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_vk_sampler.o
+	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_vk_shader_module_cache.o
 	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_vk_swap_chain.o
 	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_vk_vma.o
 	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-thirdparty-McRT-Malloc-mcrt_malloc.o
+	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_acceleration_structure_update_manager.d
+	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_bindless_descriptor_index_allocator.d
+	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_deferred_destruction_queue.d
 	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_device.d
+	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_object_pool.d
+	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_render_graph.d
 	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_vk_buffer.d
 	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_vk_command_buffer.d
 	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_vk_descriptor.d
@@ -197,10 +258,12 @@ clean:
 	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_vk_fence.d
 	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_vk_frame_buffer.d
 	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_vk_image.d
+	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_vk_memory_heap.d
 	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_vk_pipeline.d
 	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_vk_queue.d
 	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_vk_render_pass.d
 	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_vk_sampler.d
+	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_vk_shader_module_cache.d
 	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_vk_swap_chain.d
 	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-brx_pal_vk_vma.d
 	$(HIDE) rm -f $(OBJ_DIR)/BRX-PAL-thirdparty-McRT-Malloc-mcrt_malloc.d
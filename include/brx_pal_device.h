@@ -25,14 +25,25 @@
 class brx_pal_device;
 class brx_pal_graphics_queue;
 class brx_pal_upload_queue;
+class brx_pal_compute_queue;
 class brx_pal_graphics_command_buffer;
 class brx_pal_upload_command_buffer;
+class brx_pal_compute_command_buffer;
 class brx_pal_fence;
 class brx_pal_descriptor_set_layout;
 class brx_pal_pipeline_layout;
 class brx_pal_descriptor_set;
+class brx_pal_descriptor_update_template;
+class brx_pal_bindless_descriptor_index_allocator;
+class brx_pal_render_graph;
+class brx_pal_deferred_destruction_queue;
+class brx_pal_acceleration_structure_update_manager;
+class brx_pal_memory_heap;
 class brx_pal_render_pass;
 class brx_pal_graphics_pipeline;
+class brx_pal_graphics_pipeline_pre_rasterization_shader_library;
+class brx_pal_graphics_pipeline_fragment_shader_library;
+class brx_pal_graphics_pipeline_fragment_output_interface_library;
 class brx_pal_compute_pipeline;
 class brx_pal_frame_buffer;
 class brx_pal_uniform_upload_buffer;
@@ -56,6 +67,8 @@ class brx_pal_intermediate_bottom_level_acceleration_structure;
 class brx_pal_non_compacted_bottom_level_acceleration_structure;
 class brx_pal_compacted_bottom_level_acceleration_structure_size_query_pool;
 class brx_pal_compacted_bottom_level_acceleration_structure;
+class brx_pal_serialized_bottom_level_acceleration_structure_size_query_pool;
+class brx_pal_serialized_bottom_level_acceleration_structure_buffer;
 class brx_pal_top_level_acceleration_structure_instance_upload_buffer;
 class brx_pal_top_level_acceleration_structure;
 
@@ -133,7 +146,11 @@ enum BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT_STORE_OPERATION
 
 enum BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE_FORMAT
 {
-    BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE_FORMAT_R32G32B32_SFLOAT = 1
+    BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE_FORMAT_R32G32B32_SFLOAT = 1,
+    BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE_FORMAT_R32G32_SFLOAT = 2,
+    BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE_FORMAT_R32G32B32A32_SFLOAT = 3,
+    BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE_FORMAT_R16G16B16A16_UINT = 4,
+    BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE_FORMAT_R8G8B8A8_UNORM = 5
 };
 
 enum BRX_PAL_GRAPHICS_PIPELINE_INDEX_TYPE
@@ -177,6 +194,14 @@ enum BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_STORE_OPERATION
     BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_STORE_OPERATION_FLUSH_FOR_SAMPLED_IMAGE = 1
 };
 
+// the same as the heap tiers of D3D12 (the attachment images, the non-attachment images and the buffers can NOT be placed in the same heap)
+enum BRX_PAL_MEMORY_HEAP_TYPE
+{
+    BRX_PAL_MEMORY_HEAP_TYPE_ATTACHMENT_IMAGE = 1,
+    BRX_PAL_MEMORY_HEAP_TYPE_STORAGE_IMAGE = 2,
+    BRX_PAL_MEMORY_HEAP_TYPE_STORAGE_BUFFER = 3
+};
+
 enum BRX_PAL_SAMPLER_FILTER
 {
     BRX_PAL_SAMPLER_FILTER_NEAREST = 1,
@@ -186,16 +211,104 @@ enum BRX_PAL_SAMPLER_FILTER
 enum BRX_PAL_SAMPLER_ADDRESS_MODE
 {
     BRX_PAL_SAMPLER_ADDRESS_MODE_WRAP = 1,
-    BRX_PAL_SAMPLER_ADDRESS_MODE_CLAMP = 2
+    BRX_PAL_SAMPLER_ADDRESS_MODE_CLAMP = 2,
+    BRX_PAL_SAMPLER_ADDRESS_MODE_MIRROR = 3,
+    BRX_PAL_SAMPLER_ADDRESS_MODE_BORDER = 4
+};
+
+enum BRX_PAL_SAMPLER_COMPARE_OPERATION
+{
+    BRX_PAL_SAMPLER_COMPARE_OPERATION_DISABLE = 0,
+    BRX_PAL_SAMPLER_COMPARE_OPERATION_GREATER = 1,
+    BRX_PAL_SAMPLER_COMPARE_OPERATION_GREATER_EQUAL = 2,
+    BRX_PAL_SAMPLER_COMPARE_OPERATION_LESS = 3,
+    BRX_PAL_SAMPLER_COMPARE_OPERATION_LESS_EQUAL = 4
+};
+
+enum BRX_PAL_SAMPLER_BORDER_COLOR
+{
+    BRX_PAL_SAMPLER_BORDER_COLOR_TRANSPARENT_BLACK = 1,
+    BRX_PAL_SAMPLER_BORDER_COLOR_OPAQUE_BLACK = 2,
+    BRX_PAL_SAMPLER_BORDER_COLOR_OPAQUE_WHITE = 3
+};
+
+// the wrapper objects which are frequently created and destroyed are allocated from the object pools
+enum BRX_PAL_OBJECT_POOL_TYPE
+{
+    BRX_PAL_OBJECT_POOL_TYPE_FENCE = 1,
+    BRX_PAL_OBJECT_POOL_TYPE_DESCRIPTOR_SET = 2,
+    BRX_PAL_OBJECT_POOL_TYPE_GRAPHICS_PIPELINE = 3,
+    BRX_PAL_OBJECT_POOL_TYPE_COMPUTE_PIPELINE = 4,
+    BRX_PAL_OBJECT_POOL_TYPE_UNIFORM_UPLOAD_BUFFER = 5,
+    BRX_PAL_OBJECT_POOL_TYPE_STAGING_UPLOAD_BUFFER = 6,
+    BRX_PAL_OBJECT_POOL_TYPE_STORAGE_INTERMEDIATE_BUFFER = 7,
+    BRX_PAL_OBJECT_POOL_TYPE_COLOR_ATTACHMENT_IMAGE = 8,
+    BRX_PAL_OBJECT_POOL_TYPE_DEPTH_STENCIL_ATTACHMENT_IMAGE = 9,
+    BRX_PAL_OBJECT_POOL_TYPE_STORAGE_IMAGE = 10,
+    BRX_PAL_OBJECT_POOL_TYPE_SAMPLED_ASSET_IMAGE = 11
+};
+
+// the same values as both the "VkGeometryInstanceFlagBitsKHR" and the "D3D12_RAYTRACING_INSTANCE_FLAGS"
+enum BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE_FLAG_BITS
+{
+    BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE_FLAG_TRIANGLE_CULL_DISABLE = 0X1,
+    BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE_FLAG_TRIANGLE_FRONT_COUNTERCLOCKWISE = 0X2,
+    BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE_FLAG_FORCE_OPAQUE = 0X4,
+    BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE_FLAG_FORCE_NON_OPAQUE = 0X8
+};
+
+// the same values as the "VkSubgroupFeatureFlagBits"
+enum BRX_PAL_SUBGROUP_OPERATION_FLAG_BITS
+{
+    BRX_PAL_SUBGROUP_OPERATION_FLAG_BASIC = 0X1,
+    BRX_PAL_SUBGROUP_OPERATION_FLAG_VOTE = 0X2,
+    BRX_PAL_SUBGROUP_OPERATION_FLAG_ARITHMETIC = 0X4,
+    BRX_PAL_SUBGROUP_OPERATION_FLAG_BALLOT = 0X8,
+    BRX_PAL_SUBGROUP_OPERATION_FLAG_SHUFFLE = 0X10,
+    BRX_PAL_SUBGROUP_OPERATION_FLAG_SHUFFLE_RELATIVE = 0X20,
+    BRX_PAL_SUBGROUP_OPERATION_FLAG_CLUSTERED = 0X40,
+    BRX_PAL_SUBGROUP_OPERATION_FLAG_QUAD = 0X80
+};
+
+enum BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_ACTION
+{
+    BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_ACTION_NONE = 0,
+    BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_ACTION_UPDATE = 1,
+    BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_ACTION_BUILD = 2
 };
 
 #define BRX_PAL_DESCRIPTOR_SET_LAYOUT_BINDING_DESCRIPTOR_COUNT_UNBOUNDED 0XFFFFFFFFU
 
+#define BRX_PAL_BINDLESS_DESCRIPTOR_INDEX_INVALID 0XFFFFFFFFU
+
+#define BRX_PAL_RENDER_GRAPH_RESOURCE_INVALID 0XFFFFFFFFU
+
+#define BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_ENTRY_INVALID 0XFFFFFFFFU
+
+// the same value as the "VK_LOD_CLAMP_NONE"
+#define BRX_PAL_SAMPLER_LOD_CLAMP_NONE 1000.0F
+
+// the maximum "maxSamplerAnisotropy" of both the Vulkan and the D3D12
+#define BRX_PAL_SAMPLER_MAX_ANISOTROPY 16U
+
+// the minimum "maxPushConstantsSize" guaranteed by the Vulkan
+#define BRX_PAL_MAX_PUSH_CONSTANT_SIZE 128U
+
 struct BRX_PAL_DESCRIPTOR_SET_LAYOUT_BINDING
 {
     uint32_t binding;
     BRX_PAL_DESCRIPTOR_TYPE descriptor_type;
     uint32_t descriptor_count;
+    // NULL if the samplers are written by the "write_descriptor_set", otherwise "descriptor_count" samplers baked into the layout (only for the "BRX_PAL_DESCRIPTOR_TYPE_SAMPLER")
+    brx_pal_sampler const *const *immutable_samplers;
+};
+
+struct BRX_PAL_DESCRIPTOR_UPDATE_TEMPLATE_ENTRY
+{
+    uint32_t dst_binding;
+    BRX_PAL_DESCRIPTOR_TYPE descriptor_type;
+    uint32_t dst_descriptor_start_index;
+    uint32_t descriptor_count;
 };
 
 struct BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT
@@ -203,6 +316,8 @@ struct BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT
     BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT format;
     BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT_LOAD_OPERATION load_operation;
     BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT_STORE_OPERATION store_operation;
+    // NOTE: when the "sample_count" is greater than one, the content of the multisample attachment is always discarded, and the "store_operation" (except "DONT_CARE") is applied to the single sample resolve attachment which is resolved within the render pass
+    uint32_t sample_count;
 };
 
 struct BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT
@@ -210,8 +325,136 @@ struct BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT
     BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT format;
     BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT_LOAD_OPERATION load_operation;
     BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT_STORE_OPERATION store_operation;
+    // NOTE: the multisample depth stencil attachment is NOT resolved, and the "store_operation" should be "DONT_CARE" when the "sample_count" is greater than one
+    uint32_t sample_count;
+};
+
+struct BRX_PAL_RENDERING_COLOR_ATTACHMENT
+{
+    brx_pal_color_attachment_image const *image;
+    // NOTE: NULL if the "image" is single sample, otherwise the "store_operation" (except "DONT_CARE") is applied to the "resolve_image"
+    brx_pal_color_attachment_image const *resolve_image;
+    BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT_LOAD_OPERATION load_operation;
+    BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT_STORE_OPERATION store_operation;
+    float clear_value[4];
+};
+
+struct BRX_PAL_RENDERING_DEPTH_STENCIL_ATTACHMENT
+{
+    brx_pal_depth_stencil_attachment_image const *image;
+    BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT_LOAD_OPERATION load_operation;
+    BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT_STORE_OPERATION store_operation;
+    float depth_clear_value;
+    uint8_t stencil_clear_value;
+};
+
+// NOTE: the store operation is derived by the render graph (the attachment is only flushed when it is read by the subsequent passes)
+struct BRX_PAL_RENDER_GRAPH_COLOR_ATTACHMENT
+{
+    uint32_t resource;
+    BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT_LOAD_OPERATION load_operation;
+    float clear_value[4];
+};
+
+struct BRX_PAL_RENDER_GRAPH_DEPTH_STENCIL_ATTACHMENT
+{
+    uint32_t resource;
+    BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT_LOAD_OPERATION load_operation;
+    float depth_clear_value;
+    uint8_t stencil_clear_value;
+};
+
+// NOTE: the time (in nanoseconds) spent in each phase of the device creation, the "instance" and the "physical device" are the DXGI factory and the DXGI adapter on D3D12
+struct BRX_PAL_DEVICE_CREATION_TIMING
+{
+    uint64_t instance_creation_nanoseconds;
+    uint64_t physical_device_selection_nanoseconds;
+    uint64_t device_creation_nanoseconds;
+    uint64_t memory_allocator_creation_nanoseconds;
+    uint64_t total_nanoseconds;
+};
+
+// NOTE: the subgroup size ("gl_SubgroupSize" or "WaveGetLaneCount") of the compute shader is within ["min_subgroup_size", "max_subgroup_size"], and the "supported_operations" is the combination of the "BRX_PAL_SUBGROUP_OPERATION_FLAG_BITS" available in the compute shader
+// NOTE: all subgroup properties are zero when the subgroup operations are NOT available (e.g. Vulkan 1.0)
+struct BRX_PAL_SUBGROUP_PROPERTIES
+{
+    uint32_t min_subgroup_size;
+    uint32_t max_subgroup_size;
+    uint32_t supported_operations;
+    bool support_subgroup_size_control;
+};
+
+struct BRX_PAL_BINDLESS_DESCRIPTOR_LIMITS
+{
+    uint32_t max_read_only_storage_buffer_descriptor_count;
+    uint32_t max_sampled_image_descriptor_count;
+    uint32_t max_sampler_descriptor_count;
+    uint32_t max_resource_descriptor_count;
+};
+
+struct BRX_PAL_SAMPLER_DESC
+{
+    BRX_PAL_SAMPLER_FILTER filter;
+    BRX_PAL_SAMPLER_ADDRESS_MODE address_mode_u;
+    BRX_PAL_SAMPLER_ADDRESS_MODE address_mode_v;
+    BRX_PAL_SAMPLER_ADDRESS_MODE address_mode_w;
+    // one means the anisotropic filtering is disabled, and only available with the "BRX_PAL_SAMPLER_FILTER_LINEAR"
+    uint32_t max_anisotropy;
+    float mip_lod_bias;
+    float min_lod;
+    float max_lod;
+    BRX_PAL_SAMPLER_COMPARE_OPERATION compare_operation;
+    // only used by the "BRX_PAL_SAMPLER_ADDRESS_MODE_BORDER"
+    BRX_PAL_SAMPLER_BORDER_COLOR border_color;
+};
+
+struct BRX_PAL_SPECIALIZATION_CONSTANT
+{
+    uint32_t constant_id;
+    // the bool is zero or one, and the float is the bit pattern
+    uint32_t value;
+};
+
+struct BRX_PAL_SHADER_STAGE_SPECIALIZATION
+{
+    // NULL means "main"
+    char const *entry_point_name;
+    uint32_t specialization_constant_count;
+    BRX_PAL_SPECIALIZATION_CONSTANT const *specialization_constants;
+};
+
+struct BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE
+{
+    // on D3D12, the semantic of the vertex shader input should be "LOCATION" and the semantic index is the location
+    uint32_t location;
+    uint32_t binding;
+    uint32_t offset;
+    BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE_FORMAT format;
+};
+
+struct BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_POLICY
+{
+    // the acceleration structure should be built after this number of consecutive updates (zero means no limit)
+    uint32_t max_update_count;
+    // the acceleration structure should be built when the surface area of the bounding box has grown by this ratio since the last build (zero means no limit)
+    float max_bounding_box_surface_area_growth;
+    // the builds, which are NOT required, beyond this number within one frame are deferred to the later frames (zero means no limit)
+    uint32_t max_build_count_per_frame;
 };
 
+// the actions chosen by the last "schedule"
+struct BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_STATISTICS
+{
+    uint32_t bottom_level_acceleration_structure_update_count;
+    uint32_t bottom_level_acceleration_structure_build_count;
+    uint32_t top_level_acceleration_structure_update_count;
+    uint32_t top_level_acceleration_structure_build_count;
+    uint32_t deferred_build_count;
+    uint32_t dirty_instance_count;
+};
+
+typedef void (*brx_pal_render_graph_pass_execute_callback)(brx_pal_graphics_command_buffer *graphics_command_buffer, brx_pal_render_graph const *render_graph, void *user_data);
+
 struct BRX_PAL_SAMPLED_ASSET_IMAGE_SUBRESOURCE
 {
     brx_pal_sampled_asset_image const *m_sampled_asset_images;
@@ -242,6 +485,39 @@ struct BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE
     brx_pal_bottom_level_acceleration_structure const *bottom_level_acceleration_structure;
 };
 
+// the instance written by the GPU (e.g. by the compute shader), which has the same layout (64 bytes) as both the "VkAccelerationStructureInstanceKHR" and the "D3D12_RAYTRACING_INSTANCE_DESC"
+struct BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_DEVICE_INSTANCE
+{
+    float transform_matrix[3][4];
+    // bits [0, 24): instance id // bits [24, 32): instance mask
+    uint32_t instance_id_and_mask;
+    // bits [0, 24): instance contribution to hit group index (should be zero) // bits [24, 32): "BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE_FLAG_BITS"
+    uint32_t instance_contribution_to_hit_group_index_and_flags;
+    // "get_device_memory_range_base" of the bottom level acceleration structure
+    uint64_t bottom_level_acceleration_structure_device_memory_range_base;
+};
+
+// the arguments written by the GPU (e.g. by the compute shader which culls the meshlets), which has the same layout (12 bytes) as both the "VkDrawMeshTasksIndirectCommandEXT" and the "D3D12_DISPATCH_MESH_ARGUMENTS"
+struct BRX_PAL_DRAW_MESH_TASKS_INDIRECT_COMMAND
+{
+    uint32_t group_count_x;
+    uint32_t group_count_y;
+    uint32_t group_count_z;
+};
+
+// the header (56 bytes) at the beginning of the serialized bottom level acceleration structure, which has the same layout as both the Vulkan serialized acceleration structure header and the "D3D12_SERIALIZED_RAYTRACING_ACCELERATION_STRUCTURE_HEADER"
+struct BRX_PAL_SERIALIZED_BOTTOM_LEVEL_ACCELERATION_STRUCTURE_HEADER
+{
+    // Vulkan: "driverUUID" and "accelerationStructureCompatibility" // D3D12: "D3D12_SERIALIZED_DATA_DRIVER_MATCHING_IDENTIFIER"
+    uint8_t driver_matching_identifier[32];
+    // including the header
+    uint64_t serialized_size;
+    // the size of the compacted bottom level acceleration structure to deserialize to
+    uint64_t deserialized_size;
+    // always zero for the bottom level acceleration structure
+    uint64_t bottom_level_acceleration_structure_pointer_count;
+};
+
 // struct brx_pal_xcb_connection_T
 // {
 //     xcb_connection_t *m_connection;
@@ -256,34 +532,110 @@ class brx_pal_device
 public:
     virtual BRX_PAL_BACKEND_NAME get_backend_name() const = 0;
     virtual bool is_ray_tracing_supported() const = 0;
+    virtual bool is_dynamic_rendering_supported() const = 0;
     virtual brx_pal_graphics_queue *create_graphics_queue() const = 0;
     virtual void destroy_graphics_queue(brx_pal_graphics_queue *graphics_queue) const = 0;
     virtual brx_pal_upload_queue *create_upload_queue() const = 0;
     virtual void destroy_upload_queue(brx_pal_upload_queue *upload_queue) const = 0;
+    virtual brx_pal_compute_queue *create_compute_queue() const = 0;
+    virtual void destroy_compute_queue(brx_pal_compute_queue *compute_queue) const = 0;
     virtual brx_pal_graphics_command_buffer *create_graphics_command_buffer() const = 0;
     virtual void reset_graphics_command_buffer(brx_pal_graphics_command_buffer *graphics_command_buffer) const = 0;
     virtual void destroy_graphics_command_buffer(brx_pal_graphics_command_buffer *graphics_command_buffer) const = 0;
     virtual brx_pal_upload_command_buffer *create_upload_command_buffer() const = 0;
     virtual void reset_upload_command_buffer(brx_pal_upload_command_buffer *upload_command_buffer) const = 0;
     virtual void destroy_upload_command_buffer(brx_pal_upload_command_buffer *upload_command_buffer) const = 0;
+    virtual brx_pal_compute_command_buffer *create_compute_command_buffer() const = 0;
+    virtual void reset_compute_command_buffer(brx_pal_compute_command_buffer *compute_command_buffer) const = 0;
+    virtual void destroy_compute_command_buffer(brx_pal_compute_command_buffer *compute_command_buffer) const = 0;
     virtual brx_pal_fence *create_fence(bool signaled) const = 0;
     virtual void wait_for_fence(brx_pal_fence *fence) const = 0;
     virtual void reset_fence(brx_pal_fence *fence) const = 0;
     virtual void destroy_fence(brx_pal_fence *fence) const = 0;
+    // NOTE: the bindings of the immutable samplers are NOT allowed to be written by the "write_descriptor_set" (the static samplers of the root signature on D3D12)
     virtual brx_pal_descriptor_set_layout *create_descriptor_set_layout(uint32_t descriptor_set_binding_count, BRX_PAL_DESCRIPTOR_SET_LAYOUT_BINDING const *descriptor_set_bindings) const = 0;
     virtual void destroy_descriptor_set_layout(brx_pal_descriptor_set_layout *descriptor_set_layout) const = 0;
-    virtual brx_pal_pipeline_layout *create_pipeline_layout(uint32_t descriptor_set_layout_count, brx_pal_descriptor_set_layout const *const *descriptor_set_layouts) const = 0;
+    // NOTE: the push constants are visible to all shader stages, and the "push_constant_size" should be multiple of 4 and NOT greater than "BRX_PAL_MAX_PUSH_CONSTANT_SIZE" (zero means no push constants)
+    // NOTE: on D3D12, the push constants are the root constants of the shader register "b0" within the register space "descriptor_set_layout_count"
+    virtual brx_pal_pipeline_layout *create_pipeline_layout(uint32_t descriptor_set_layout_count, brx_pal_descriptor_set_layout const *const *descriptor_set_layouts, uint32_t push_constant_size) const = 0;
     virtual void destroy_pipeline_layout(brx_pal_pipeline_layout *pipeline_layout) const = 0;
     virtual brx_pal_descriptor_set *create_descriptor_set(brx_pal_descriptor_set_layout const *descriptor_set_layout, uint32_t unbounded_descriptor_count) = 0;
     virtual void write_descriptor_set(brx_pal_descriptor_set *descriptor_set, uint32_t dst_binding, BRX_PAL_DESCRIPTOR_TYPE descriptor_type, uint32_t dst_descriptor_start_index, uint32_t src_descriptor_count, brx_pal_uniform_upload_buffer const *const *src_dynamic_uniform_buffers, uint32_t const *src_dynamic_uniform_buffer_ranges, brx_pal_read_only_storage_buffer const *const *src_read_only_storage_buffers, brx_pal_storage_buffer const *const *src_storage_buffers, brx_pal_sampled_image const *const *src_sampled_images, brx_pal_storage_image const *const *src_storage_images, brx_pal_sampler const *const *src_samplers, brx_pal_top_level_acceleration_structure const *const *src_top_level_acceleration_structures) = 0;
     virtual void destroy_descriptor_set(brx_pal_descriptor_set *descriptor_set) = 0;
-    virtual brx_pal_render_pass *create_render_pass(uint32_t color_attachment_count, BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT const *color_attachments, BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT const *depth_stencil_attachment) const = 0;
+    virtual brx_pal_descriptor_update_template *create_descriptor_update_template(brx_pal_descriptor_set_layout const *descriptor_set_layout, uint32_t entry_count, BRX_PAL_DESCRIPTOR_UPDATE_TEMPLATE_ENTRY const *entries) const = 0;
+    virtual void destroy_descriptor_update_template(brx_pal_descriptor_update_template *descriptor_update_template) const = 0;
+    // NOTE: all descriptor sets should be created by the same descriptor set layout as the descriptor update template
+    // NOTE: the "src_descriptors" are packed per descriptor set in the order of the entries, and each element is the "brx_pal_uniform_upload_buffer const *", "brx_pal_read_only_storage_buffer const *", "brx_pal_storage_buffer const *", "brx_pal_sampled_image const *", "brx_pal_storage_image const *", "brx_pal_sampler const *" or "brx_pal_top_level_acceleration_structure const *" according to the descriptor type of the entry
+    // NOTE: the "src_dynamic_uniform_buffer_ranges" is indexed in the same way as the "src_descriptors", and only the elements of the dynamic uniform buffers are used (NULL is allowed if there is no dynamic uniform buffer)
+    virtual void write_descriptor_sets_with_template(uint32_t descriptor_set_count, brx_pal_descriptor_set *const *descriptor_sets, brx_pal_descriptor_update_template const *descriptor_update_template, void const *const *src_descriptors, uint32_t const *src_dynamic_uniform_buffer_ranges) = 0;
+    // NOTE: the bindless descriptor set layout is only available when the "is_bindless_supported" is true (independent of the ray tracing)
+    virtual bool is_bindless_supported() const = 0;
+    // NOTE: each descriptor count of the bindless descriptor set layout should NOT be greater than the corresponding limit, and the sum of the "read_only_storage_buffer_descriptor_count" and the "sampled_image_descriptor_count" should NOT be greater than the "max_resource_descriptor_count"
+    virtual void get_bindless_descriptor_limits(BRX_PAL_BINDLESS_DESCRIPTOR_LIMITS *bindless_descriptor_limits) const = 0;
+    // NOTE: binding 0: read only storage buffers, binding 1: sampled images, binding 2: samplers
+    // NOTE: on D3D12, the SRV ranges within the same register space are NOT allowed to overlap, and the shader register of the sampled images is "read_only_storage_buffer_descriptor_count" rather than 1
+    // NOTE: the descriptor set of the bindless descriptor set layout is created by the "create_descriptor_set" with zero "unbounded_descriptor_count", and the descriptors, which are NOT being used by the GPU, are allowed to be written by the "write_descriptor_set" even if the descriptor set is being used by the GPU
+    virtual brx_pal_descriptor_set_layout *create_bindless_descriptor_set_layout(uint32_t read_only_storage_buffer_descriptor_count, uint32_t sampled_image_descriptor_count, uint32_t sampler_descriptor_count) const = 0;
+    virtual brx_pal_bindless_descriptor_index_allocator *create_bindless_descriptor_index_allocator(uint32_t read_only_storage_buffer_descriptor_count, uint32_t sampled_image_descriptor_count, uint32_t sampler_descriptor_count, uint32_t frame_throttling_count) const = 0;
+    virtual void destroy_bindless_descriptor_index_allocator(brx_pal_bindless_descriptor_index_allocator *bindless_descriptor_index_allocator) const = 0;
+    // NOTE: the transient resources are created by the render graph itself, and are kept for "frame_throttling_count" frames to make sure that the resources being used by the GPU are NOT reused
+    virtual brx_pal_render_graph *create_render_graph(uint32_t frame_throttling_count) const = 0;
+    virtual void destroy_render_graph(brx_pal_render_graph *render_graph) const = 0;
+    // NOTE: the objects are destroyed by the deferred destruction queue after "frame_throttling_count" frames, and the pending objects are destroyed immediately by the "destroy_deferred_destruction_queue" (the GPU should be idle)
+    virtual brx_pal_deferred_destruction_queue *create_deferred_destruction_queue(uint32_t frame_throttling_count) = 0;
+    virtual void destroy_deferred_destruction_queue(brx_pal_deferred_destruction_queue *deferred_destruction_queue) = 0;
+    virtual brx_pal_acceleration_structure_update_manager *create_acceleration_structure_update_manager(BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_POLICY const *policy) const = 0;
+    virtual void destroy_acceleration_structure_update_manager(brx_pal_acceleration_structure_update_manager *acceleration_structure_update_manager) const = 0;
+    // NOTE: the "reserved_object_count" is the number of the objects which can be created without allocating the memory, and the memory of the object pools is NOT released until the device is destroyed
+    virtual void get_object_pool_statistics(BRX_PAL_OBJECT_POOL_TYPE object_pool_type, uint32_t *live_object_count, uint32_t *reserved_object_count) const = 0;
+    // NOTE: on Vulkan, the memory pools are created when first used (NOT included in the device creation)
+    virtual void get_device_creation_timing(BRX_PAL_DEVICE_CREATION_TIMING *device_creation_timing) const = 0;
+    virtual void get_subgroup_properties(BRX_PAL_SUBGROUP_PROPERTIES *subgroup_properties) const = 0;
+    // NOTE: the "view_count" is one if the multiview is not used, otherwise the draw calls are broadcast to the views [0, "view_count") which are rendered to the layers with the same index ("gl_ViewIndex" or "SV_ViewID" in the shader), and all attachments should be the layered images with at least "view_count" layers
+    virtual brx_pal_render_pass *create_render_pass(uint32_t color_attachment_count, BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT const *color_attachments, BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT const *depth_stencil_attachment, uint32_t view_count) const = 0;
     virtual void destroy_render_pass(brx_pal_render_pass *render_pass) const = 0;
-    virtual brx_pal_graphics_pipeline *create_graphics_pipeline(brx_pal_render_pass const *render_pass, brx_pal_pipeline_layout const *pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const = 0;
+    // NOTE: the vertex buffer of the binding "i" is bound to the slot "i" by the "bind_vertex_buffers" and the stride is the "vertex_binding_strides[i]", and both the "vertex_binding_count" and "vertex_attribute_count" can be zero if the vertices are pulled in the shader
+    virtual brx_pal_graphics_pipeline *create_graphics_pipeline(brx_pal_render_pass const *render_pass, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const = 0;
+    // NOTE: the graphics pipeline created by the attachment formats can only be used between the "begin_rendering" and "end_rendering", and the "depth_stencil_attachment_format" is NULL if there is no depth stencil attachment
+    virtual brx_pal_graphics_pipeline *create_dynamic_rendering_graphics_pipeline(uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const = 0;
+    // NOTE: the shader modules are shared between the pipelines with different specializations of the same code, and the "specialization" can be NULL (the same as the pipeline created without specialization)
+    // NOTE: on D3D12, the entry point is determined when the DXIL is compiled, and the specialization constants are ignored (the default values in the shader, e.g., by the "[[vk::constant_id]]", are used)
+    virtual brx_pal_graphics_pipeline *create_specialized_graphics_pipeline(brx_pal_render_pass const *render_pass, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *vertex_shader_specialization, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *fragment_shader_specialization, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const = 0;
+    virtual brx_pal_graphics_pipeline *create_specialized_dynamic_rendering_graphics_pipeline(uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *vertex_shader_specialization, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *fragment_shader_specialization, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const = 0;
+    // NOTE: the cull mode, the depth compare operation and the blend operation of the graphics pipeline created with the extended dynamic state are NOT baked, and are set by the "set_cull_mode", "set_depth_compare_operation" and "set_blend_operation" of the command buffer
+    // NOTE: if the "is_extended_dynamic_state_supported" is false (always on D3D12 where these states are baked into the pipeline state object), the graphics pipeline should be created for each combination of the states instead
+    virtual bool is_extended_dynamic_state_supported() const = 0;
+    virtual brx_pal_graphics_pipeline *create_extended_dynamic_state_graphics_pipeline(brx_pal_render_pass const *render_pass, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *vertex_shader_specialization, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *fragment_shader_specialization) const = 0;
+    virtual brx_pal_graphics_pipeline *create_extended_dynamic_state_dynamic_rendering_graphics_pipeline(uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *vertex_shader_specialization, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *fragment_shader_specialization) const = 0;
+    // NOTE: the vertex input interface and the vertex shader are replaced by the (optional) task shader and the mesh shader, and the graphics pipeline is drawn by the "draw_mesh_tasks" rather than the "draw"
+    // NOTE: only available when the "is_mesh_shader_supported" is true, the "task_shader_module_code" is NULL if the task shader is NOT used, and the multiview is NOT supported (the "view_count" should be one)
+    virtual bool is_mesh_shader_supported() const = 0;
+    virtual brx_pal_graphics_pipeline *create_mesh_shader_graphics_pipeline(brx_pal_render_pass const *render_pass, brx_pal_pipeline_layout const *pipeline_layout, size_t task_shader_module_code_size, void const *task_shader_module_code, size_t mesh_shader_module_code_size, void const *mesh_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const = 0;
+    virtual brx_pal_graphics_pipeline *create_mesh_shader_dynamic_rendering_graphics_pipeline(uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, size_t task_shader_module_code_size, void const *task_shader_module_code, size_t mesh_shader_module_code_size, void const *mesh_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const = 0;
     virtual void destroy_graphics_pipeline(brx_pal_graphics_pipeline *graphics_pipeline) const = 0;
+    // NOTE: the graphics pipeline libraries are only available when the "is_dynamic_rendering_supported" is true, and the linked graphics pipeline can only be used between the "begin_rendering" and "end_rendering"
+    // NOTE: if the "is_graphics_pipeline_library_supported" is false, the libraries only record the states, and the "create_linked_graphics_pipeline" is as slow as the "create_dynamic_rendering_graphics_pipeline"
+    virtual bool is_graphics_pipeline_library_supported() const = 0;
+    // NOTE: the vertex input interface is NOT exposed, and no vertex attribute is used by the linked graphics pipeline (the vertices should be pulled in the shader)
+    // NOTE: the linked graphics pipeline has no vertex binding, and the "bind_vertex_buffers" should NOT be called while the linked graphics pipeline is bound
+    virtual brx_pal_graphics_pipeline_pre_rasterization_shader_library *create_graphics_pipeline_pre_rasterization_shader_library(uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, bool enable_back_face_cull, bool front_ccw) const = 0;
+    virtual void destroy_graphics_pipeline_pre_rasterization_shader_library(brx_pal_graphics_pipeline_pre_rasterization_shader_library *pre_rasterization_shader_library) const = 0;
+    virtual brx_pal_graphics_pipeline_fragment_shader_library *create_graphics_pipeline_fragment_shader_library(uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation) const = 0;
+    virtual void destroy_graphics_pipeline_fragment_shader_library(brx_pal_graphics_pipeline_fragment_shader_library *fragment_shader_library) const = 0;
+    virtual brx_pal_graphics_pipeline_fragment_output_interface_library *create_graphics_pipeline_fragment_output_interface_library(uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const = 0;
+    virtual void destroy_graphics_pipeline_fragment_output_interface_library(brx_pal_graphics_pipeline_fragment_output_interface_library *fragment_output_interface_library) const = 0;
+    // NOTE: the "pipeline_layout" and the "view_count" should be the same as the libraries, and the libraries can be destroyed after the linked graphics pipeline is created (the linked graphics pipeline is destroyed by the "destroy_graphics_pipeline")
+    // NOTE: the linking without the "link_time_optimization" is fast enough to be done at draw time, and the application is expected to create the optimized graphics pipeline with the "link_time_optimization" on the background thread and replace the fast linked one when it is ready
+    virtual brx_pal_graphics_pipeline *create_linked_graphics_pipeline(brx_pal_pipeline_layout const *pipeline_layout, brx_pal_graphics_pipeline_pre_rasterization_shader_library const *pre_rasterization_shader_library, brx_pal_graphics_pipeline_fragment_shader_library const *fragment_shader_library, brx_pal_graphics_pipeline_fragment_output_interface_library const *fragment_output_interface_library, bool link_time_optimization) const = 0;
     virtual brx_pal_compute_pipeline *create_compute_pipeline(brx_pal_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code) const = 0;
+    // NOTE: the workgroup size can be specialized by the "local_size_x_id" (the "SpecId" of the "WorkgroupSize") on Vulkan, but is fixed by the "numthreads" on D3D12
+    virtual brx_pal_compute_pipeline *create_specialized_compute_pipeline(brx_pal_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *compute_shader_specialization) const = 0;
+    // NOTE: only available when the "support_subgroup_size_control" of the "get_subgroup_properties" is true, the "required_subgroup_size" is zero if NOT required, otherwise a power of two within ["min_subgroup_size", "max_subgroup_size"]
+    // NOTE: the "require_full_subgroups" requires the workgroup size X to be a multiple of the (maximum) subgroup size, and all subgroups are guaranteed to be full (no inactive invocation)
+    virtual brx_pal_compute_pipeline *create_subgroup_size_control_compute_pipeline(brx_pal_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *compute_shader_specialization, uint32_t required_subgroup_size, bool require_full_subgroups) const = 0;
     virtual void destroy_compute_pipeline(brx_pal_compute_pipeline *compute_pipeline) const = 0;
-    virtual brx_pal_frame_buffer *create_frame_buffer(brx_pal_render_pass const *render_pass, uint32_t width, uint32_t height, uint32_t color_attachment_count, brx_pal_color_attachment_image const *const *color_attachments, brx_pal_depth_stencil_attachment_image const *depth_stencil_attachment) const = 0;
+    // NOTE: the "color_resolve_attachments" is NULL if the render pass is single sample, and the element is NULL if the "store_operation" of the corresponding color attachment is "DONT_CARE"
+    virtual brx_pal_frame_buffer *create_frame_buffer(brx_pal_render_pass const *render_pass, uint32_t width, uint32_t height, uint32_t color_attachment_count, brx_pal_color_attachment_image const *const *color_attachments, brx_pal_color_attachment_image const *const *color_resolve_attachments, brx_pal_depth_stencil_attachment_image const *depth_stencil_attachment) const = 0;
     virtual void destroy_frame_buffer(brx_pal_frame_buffer *frame_buffer) const = 0;
     virtual uint32_t get_uniform_upload_buffer_offset_alignment() const = 0;
     virtual brx_pal_uniform_upload_buffer *create_uniform_upload_buffer(uint32_t size) const = 0;
@@ -302,13 +654,42 @@ public:
     virtual BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT get_depth_stencil_attachment_image_format() const = 0;
     virtual brx_pal_depth_stencil_attachment_image *create_depth_stencil_attachment_image(BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT depth_stencil_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image) const = 0;
     virtual void destroy_depth_stencil_attachment_image(brx_pal_depth_stencil_attachment_image *depth_stencil_attachment_image) const = 0;
+    // NOTE: the power of two which is supported by both the color and depth stencil attachments
+    virtual uint32_t get_max_attachment_sample_count() const = 0;
+    // NOTE: the multisample attachment images are transient (can NOT be sampled), the integer color formats can NOT be resolved (averaged), and the images are destroyed by the "destroy_color_attachment_image" and "destroy_depth_stencil_attachment_image"
+    virtual brx_pal_color_attachment_image *create_multisample_color_attachment_image(BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT color_attachment_image_format, uint32_t width, uint32_t height, uint32_t sample_count) const = 0;
+    virtual brx_pal_depth_stencil_attachment_image *create_multisample_depth_stencil_attachment_image(BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT depth_stencil_attachment_image_format, uint32_t width, uint32_t height, uint32_t sample_count) const = 0;
+    // NOTE: one if the multiview is not supported (on D3D12, at most 4 views are supported by the view instancing)
+    virtual uint32_t get_max_multiview_view_count() const = 0;
+    // NOTE: the layered attachment images are single sample, the sampled image is the 2D array ("sampler2DArray" or "Texture2DArray" in the shader), and the images are destroyed by the "destroy_color_attachment_image" and "destroy_depth_stencil_attachment_image"
+    virtual brx_pal_color_attachment_image *create_layered_color_attachment_image(BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT color_attachment_image_format, uint32_t width, uint32_t height, uint32_t layer_count, bool allow_sampled_image) const = 0;
+    virtual brx_pal_depth_stencil_attachment_image *create_layered_depth_stencil_attachment_image(BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT depth_stencil_attachment_image_format, uint32_t width, uint32_t height, uint32_t layer_count, bool allow_sampled_image) const = 0;
     virtual brx_pal_storage_image *create_storage_image(BRX_PAL_STORAGE_IMAGE_FORMAT storage_image_format, uint32_t width, uint32_t height, bool allow_sampled_image) const = 0;
     virtual void destroy_storage_image(brx_pal_storage_image *storage_image) const = 0;
+    // NOTE: the memory heap is the explicit memory block, and the resources placed in the memory heap are sub-allocated by the application (the resources, whose lifetimes do NOT overlap, are allowed to alias the same memory range)
+    // NOTE: the "memory_heap_offset" of the placed resource should be multiple of the "alignment" from the "get_*_memory_requirements", and the range ["memory_heap_offset", "memory_heap_offset" + "size") should be within the memory heap
+    // NOTE: the content of the aliased memory is undefined after another resource has been used, and the first use of the placed resource should be the "CLEAR" load operation or the "DONT_CARE" load operation of the "begin_rendering" (attachment images) or the "DONT_CARE" load operation (storage images and storage buffers) after the "aliasing_barrier"
+    // NOTE: the placed resources are destroyed by the "destroy_color_attachment_image", "destroy_depth_stencil_attachment_image", "destroy_storage_image" and "destroy_storage_intermediate_buffer", and should be destroyed before the memory heap
+    virtual brx_pal_memory_heap *create_memory_heap(BRX_PAL_MEMORY_HEAP_TYPE memory_heap_type, uint32_t size) const = 0;
+    virtual void destroy_memory_heap(brx_pal_memory_heap *memory_heap) const = 0;
+    virtual void get_color_attachment_image_memory_requirements(BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT color_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image, uint32_t *size, uint32_t *alignment) const = 0;
+    virtual void get_depth_stencil_attachment_image_memory_requirements(BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT depth_stencil_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image, uint32_t *size, uint32_t *alignment) const = 0;
+    virtual void get_storage_image_memory_requirements(BRX_PAL_STORAGE_IMAGE_FORMAT storage_image_format, uint32_t width, uint32_t height, bool allow_sampled_image, uint32_t *size, uint32_t *alignment) const = 0;
+    virtual void get_storage_intermediate_buffer_memory_requirements(uint32_t storage_intermediate_buffer_size, uint32_t *size, uint32_t *alignment) const = 0;
+    // NOTE: the color attachment images and the depth stencil attachment images are placed in the "ATTACHMENT_IMAGE" memory heap
+    virtual brx_pal_color_attachment_image *create_placed_color_attachment_image(brx_pal_memory_heap const *memory_heap, uint32_t memory_heap_offset, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT color_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image) const = 0;
+    virtual brx_pal_depth_stencil_attachment_image *create_placed_depth_stencil_attachment_image(brx_pal_memory_heap const *memory_heap, uint32_t memory_heap_offset, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT depth_stencil_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image) const = 0;
+    virtual brx_pal_storage_image *create_placed_storage_image(brx_pal_memory_heap const *memory_heap, uint32_t memory_heap_offset, BRX_PAL_STORAGE_IMAGE_FORMAT storage_image_format, uint32_t width, uint32_t height, bool allow_sampled_image) const = 0;
+    virtual brx_pal_storage_intermediate_buffer *create_placed_storage_intermediate_buffer(brx_pal_memory_heap const *memory_heap, uint32_t memory_heap_offset, uint32_t size) const = 0;
     virtual bool is_sampled_asset_image_compression_bc_supported() const = 0;
     virtual bool is_sampled_asset_image_compression_astc_supported() const = 0;
     virtual brx_pal_sampled_asset_image *create_sampled_asset_image(BRX_PAL_SAMPLED_ASSET_IMAGE_FORMAT sampled_asset_image_format, uint32_t width, uint32_t height, uint32_t mip_levels) const = 0;
     virtual void destroy_sampled_asset_image(brx_pal_sampled_asset_image *sampled_asset_image) const = 0;
+    // NOTE: the samplers are deduplicated by the full sampler state, and the same sampler may be returned by different calls (each call should still be paired with one "destroy_sampler")
     virtual brx_pal_sampler *create_sampler(BRX_PAL_SAMPLER_FILTER filter, BRX_PAL_SAMPLER_ADDRESS_MODE address_mode) const = 0;
+    // NOTE: the "max_anisotropy" is clamped to one if the anisotropic filtering is NOT supported
+    virtual brx_pal_sampler *create_sampler_with_desc(BRX_PAL_SAMPLER_DESC const *sampler_desc) const = 0;
+    // NOTE: the immutable samplers should NOT be destroyed until all descriptor set layouts, pipeline layouts and pipelines which use them have been destroyed
     virtual void destroy_sampler(brx_pal_sampler *sampler) const = 0;
     // struct brx_pal_xcb_window_T
     // {
@@ -333,6 +714,13 @@ public:
     virtual void destroy_compacted_bottom_level_acceleration_structure_size_query_pool(brx_pal_compacted_bottom_level_acceleration_structure_size_query_pool *compacted_bottom_level_acceleration_structure_size_query_pool) const = 0;
     virtual brx_pal_compacted_bottom_level_acceleration_structure *create_compacted_bottom_level_acceleration_structure(uint32_t size) const = 0;
     virtual void destroy_compacted_bottom_level_acceleration_structure(brx_pal_compacted_bottom_level_acceleration_structure *compacted_bottom_level_acceleration_structure) const = 0;
+    virtual brx_pal_serialized_bottom_level_acceleration_structure_size_query_pool *create_serialized_bottom_level_acceleration_structure_size_query_pool(uint32_t query_count) const = 0;
+    virtual uint32_t get_serialized_bottom_level_acceleration_structure_size_query_pool_result(brx_pal_serialized_bottom_level_acceleration_structure_size_query_pool const *serialized_bottom_level_acceleration_structure_size_query_pool, uint32_t query_index) const = 0;
+    virtual void destroy_serialized_bottom_level_acceleration_structure_size_query_pool(brx_pal_serialized_bottom_level_acceleration_structure_size_query_pool *serialized_bottom_level_acceleration_structure_size_query_pool) const = 0;
+    virtual brx_pal_serialized_bottom_level_acceleration_structure_buffer *create_serialized_bottom_level_acceleration_structure_buffer(uint32_t size) const = 0;
+    virtual void destroy_serialized_bottom_level_acceleration_structure_buffer(brx_pal_serialized_bottom_level_acceleration_structure_buffer *serialized_bottom_level_acceleration_structure_buffer) const = 0;
+    // NOTE: the serialized data is only allowed to be deserialized by the compatible driver, and the bottom level acceleration structure should be rebuilt from the geometries if this returns false (e.g. after the driver update)
+    virtual bool is_serialized_bottom_level_acceleration_structure_compatible(BRX_PAL_SERIALIZED_BOTTOM_LEVEL_ACCELERATION_STRUCTURE_HEADER const *serialized_bottom_level_acceleration_structure_header) const = 0;
     virtual brx_pal_top_level_acceleration_structure_instance_upload_buffer *create_top_level_acceleration_structure_instance_upload_buffer(uint32_t instance_count) const = 0;
     virtual void destroy_top_level_acceleration_structure_instance_upload_buffer(brx_pal_top_level_acceleration_structure_instance_upload_buffer *top_level_acceleration_structure_instance_upload_buffer) const = 0;
     virtual void get_top_level_acceleration_structure_size(uint32_t top_level_acceleration_structure_instance_count, uint32_t *top_level_acceleration_structure_size, uint32_t *build_scratch_size, uint32_t *update_scratch_size) const = 0;
@@ -345,6 +733,10 @@ class brx_pal_graphics_queue
 public:
     virtual void wait_and_submit(brx_pal_upload_command_buffer const *upload_command_buffer, brx_pal_graphics_command_buffer const *graphics_command_buffer, brx_pal_fence *fence) const = 0;
     virtual bool submit_and_present(brx_pal_graphics_command_buffer *graphics_command_buffer, brx_pal_swap_chain *swap_chain, uint32_t swap_chain_image_index, brx_pal_fence *fence) const = 0;
+    // NOTE: the subsequent submissions to the graphics queue will wait for the compute command buffer (which has been submitted by "submit_and_signal" of the compute queue)
+    // NOTE: if there is no dedicated compute queue, the compute command buffer will be submitted to the graphics queue here
+    // NOTE: the compute queue does NOT wait for the graphics queue, and the storage buffers and storage images written by the compute command buffer and read by the graphics command buffer should be duplicated for each frame throttling index (the fence of the same frame throttling index guarantees that the previous reads have completed)
+    virtual void wait(brx_pal_compute_command_buffer const *compute_command_buffer) const = 0;
 };
 
 class brx_pal_upload_queue
@@ -353,6 +745,13 @@ public:
     virtual void submit_and_signal(brx_pal_upload_command_buffer const *upload_command_buffer) const = 0;
 };
 
+class brx_pal_compute_queue
+{
+public:
+    // NOTE: should be called after waiting for the fence of the same frame throttling index, since the "DONT_CARE" load of the compute command buffer does NOT wait for the previous reads of the graphics queue
+    virtual void submit_and_signal(brx_pal_compute_command_buffer const *compute_command_buffer) const = 0;
+};
+
 class brx_pal_graphics_command_buffer
 {
 public:
@@ -364,15 +763,52 @@ public:
     virtual void bind_graphics_pipeline(brx_pal_graphics_pipeline const *graphics_pipeline) = 0;
     virtual void set_view_port(uint32_t width, uint32_t height) = 0;
     virtual void set_scissor(int32_t offset_width, int32_t offset_height, uint32_t width, uint32_t height) = 0;
+    // NOTE: only available when the "is_extended_dynamic_state_supported" is true, and all of them should be called after the "bind_graphics_pipeline" with the graphics pipeline created with the extended dynamic state
+    virtual void set_cull_mode(bool enable_back_face_cull, bool front_ccw) = 0;
+    virtual void set_depth_compare_operation(BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation) = 0;
+    virtual void set_blend_operation(BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) = 0;
     virtual void bind_graphics_descriptor_sets(brx_pal_pipeline_layout const *pipeline_layout, uint32_t descriptor_set_count, brx_pal_descriptor_set const *const *descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets) = 0;
+    // NOTE: should be called after the "bind_graphics_descriptor_sets" with the same "pipeline_layout" (on D3D12, the root arguments become stale when the root signature is changed)
+    virtual void push_graphics_constants(brx_pal_pipeline_layout const *pipeline_layout, uint32_t offset, uint32_t size, void const *constants) = 0;
     virtual void draw(uint32_t vertex_count, uint32_t instance_count, uint32_t first_vertex, uint32_t first_instance) = 0;
+    // NOTE: the storage asset buffers should be acquired before used as the vertex buffers or the index buffer
+    // NOTE: should be called after the "bind_graphics_pipeline" (on D3D12, the strides of the vertex buffer views are provided by the graphics pipeline)
+    virtual void bind_vertex_buffers(uint32_t first_binding, uint32_t binding_count, brx_pal_storage_asset_buffer const *const *vertex_buffers, uint64_t const *offsets) = 0;
+    virtual void bind_index_buffer(brx_pal_storage_asset_buffer const *index_buffer, uint64_t offset, BRX_PAL_GRAPHICS_PIPELINE_INDEX_TYPE index_type) = 0;
+    virtual void draw_indexed(uint32_t index_count, uint32_t instance_count, uint32_t first_index, int32_t vertex_offset, uint32_t first_instance) = 0;
+    // NOTE: only available when the "is_mesh_shader_supported" is true, and should be called after the "bind_graphics_pipeline" with the mesh shader graphics pipeline
+    virtual void draw_mesh_tasks(uint32_t group_count_x, uint32_t group_count_y, uint32_t group_count_z) = 0;
+    // NOTE: the "argument_buffer" contains the "draw_count" (or at most the "max_draw_count") tightly packed "BRX_PAL_DRAW_MESH_TASKS_INDIRECT_COMMAND" starting at the "argument_offset", and the "count_buffer" contains the "uint32_t" draw count at the "count_offset"
+    // NOTE: the arguments and the count are written by the compute pass of the same graphics command buffer, and the "compute_pass_store" should be called before the "begin_render_pass" or the "begin_rendering"
+    // NOTE: the storage buffers written by the compute command buffer can NOT be used, since the graphics queue only waits for the compute queue at the shader stages rather than the draw indirect stage
+    virtual void draw_mesh_tasks_indirect(brx_pal_storage_buffer const *argument_buffer, uint64_t argument_offset, uint32_t draw_count) = 0;
+    virtual void draw_mesh_tasks_indirect_count(brx_pal_storage_buffer const *argument_buffer, uint64_t argument_offset, brx_pal_storage_buffer const *count_buffer, uint64_t count_offset, uint32_t max_draw_count) = 0;
     virtual void end_render_pass() = 0;
+    // NOTE: only available when the "is_dynamic_rendering_supported" is true, and no render pass or frame buffer object is required
+    // NOTE: the load and store operations have the same meaning as the render pass, and the image layout transitions are performed by the "begin_rendering" and "end_rendering"
+    virtual void begin_rendering(uint32_t width, uint32_t height, uint32_t view_count, uint32_t color_attachment_count, BRX_PAL_RENDERING_COLOR_ATTACHMENT const *color_attachments, BRX_PAL_RENDERING_DEPTH_STENCIL_ATTACHMENT const *depth_stencil_attachment) = 0;
+    virtual void end_rendering() = 0;
+    // NOTE: should be called right before the "begin_rendering" or the "compute_pass_load" which loads the placed resources when another resource may have been used in the same memory range, and the next "load" waits for all previous accesses to the aliased memory
+    virtual void aliasing_barrier(uint32_t color_attachment_image_count, brx_pal_color_attachment_image const *const *color_attachment_images, uint32_t depth_stencil_attachment_image_count, brx_pal_depth_stencil_attachment_image const *const *depth_stencil_attachment_images, uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *storage_buffers, uint32_t storage_image_count, brx_pal_storage_image const *const *storage_images) = 0;
     virtual void compute_pass_load(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *storage_buffers, BRX_PAL_COMPUTE_PASS_STORAGE_BUFFER_LOAD_OPERATION const *storage_buffer_load_operations, uint32_t storage_image_count, brx_pal_storage_image const *const *storage_images, BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_LOAD_OPERATION const *storage_image_load_operations) = 0;
     virtual void bind_compute_pipeline(brx_pal_compute_pipeline const *compute_pipeline) = 0;
     virtual void bind_compute_descriptor_sets(brx_pal_pipeline_layout const *pipeline_layout, uint32_t descriptor_set_count, brx_pal_descriptor_set const *const *descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets) = 0;
+    // NOTE: should be called after the "bind_compute_descriptor_sets" with the same "pipeline_layout"
+    virtual void push_compute_constants(brx_pal_pipeline_layout const *pipeline_layout, uint32_t offset, uint32_t size, void const *constants) = 0;
     virtual void dispatch(uint32_t group_count_x, uint32_t group_count_y, uint32_t group_count_z) = 0;
     virtual void compute_pass_barrier(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *storage_buffers, uint32_t storage_image_count, brx_pal_storage_image const *const *storage_images) = 0;
     virtual void compute_pass_store(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *storage_buffers, BRX_PAL_COMPUTE_PASS_STORAGE_BUFFER_STORE_OPERATION const *storage_buffer_store_operations, uint32_t storage_image_count, brx_pal_storage_image const *const *storage_images, BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_STORE_OPERATION const *storage_image_store_operations) = 0;
+    // NOTE: acquire the storage buffers and storage images which have been released by the "compute_pass_store" of the compute command buffer
+    virtual void acquire(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *storage_buffers, uint32_t storage_image_count, brx_pal_storage_image const *const *storage_images) = 0;
+    // NOTE: the storage buffers and storage images are in the same state as after the "compute_pass_store" both before and after the "copy", "fill" and "clear"
+    virtual void copy_buffer(brx_pal_storage_buffer const *dst_storage_buffer, uint64_t dst_offset, brx_pal_storage_buffer const *src_storage_buffer, uint64_t src_offset, uint32_t src_size) = 0;
+    // NOTE: the previous content of the destination storage image is discarded
+    virtual void copy_image(brx_pal_storage_image const *dst_storage_image, brx_pal_storage_image const *src_storage_image, uint32_t width, uint32_t height) = 0;
+    // NOTE: the "dst_offset" and the "dst_size" should be the multiple of 4
+    virtual void fill_buffer(brx_pal_storage_buffer const *dst_storage_buffer, uint64_t dst_offset, uint32_t dst_size, uint32_t data) = 0;
+    // NOTE: the "color_clear_value" is converted to the integer if the format is R32_UINT
+    // NOTE: the descriptor sets should be bound again after the "fill_buffer" or the "clear_storage_image", since the descriptor heaps may be changed by the D3D12 backend
+    virtual void clear_storage_image(brx_pal_storage_image const *storage_image, float const *color_clear_value) = 0;
     // NOTE: we do NOT need the "load", since the "acquire" already perform the synchronization
     virtual void build_intermediate_bottom_level_acceleration_structure(brx_pal_intermediate_bottom_level_acceleration_structure *intermediate_bottom_level_acceleration_structure, uint32_t bottom_level_acceleration_structure_geometry_count, BRX_PAL_BOTTOM_LEVEL_ACCELERATION_STRUCTURE_GEOMETRY const *bottom_level_acceleration_structure_geometries, brx_pal_scratch_buffer *scratch_buffer) = 0;
     virtual void build_intermediate_bottom_level_acceleration_structure_store(uint32_t intermediate_bottom_level_acceleration_structure_count, brx_pal_intermediate_bottom_level_acceleration_structure const *const *intermediate_bottom_level_acceleration_structures) = 0;
@@ -382,6 +818,9 @@ public:
     virtual void build_top_level_acceleration_structure_store(brx_pal_top_level_acceleration_structure *top_level_acceleration_structure) = 0;
     virtual void update_top_level_acceleration_structure(brx_pal_top_level_acceleration_structure *top_level_acceleration_structure, brx_pal_top_level_acceleration_structure_instance_upload_buffer *top_level_acceleration_structure_instance_upload_buffer, brx_pal_scratch_buffer *scratch_buffer) = 0;
     virtual void update_top_level_acceleration_structure_store(brx_pal_top_level_acceleration_structure *top_level_acceleration_structure) = 0;
+    // NOTE: the instances are written by the GPU in the layout of the "BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_DEVICE_INSTANCE" (e.g. the storage intermediate buffer written by the compute shader), and the "compute_pass_store" with "FLUSH_FOR_READ_ONLY_STORAGE_BUFFER_AND_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BUFFER" should be called before the build
+    virtual void build_top_level_acceleration_structure_from_device_instances(brx_pal_top_level_acceleration_structure *top_level_acceleration_structure, uint32_t top_level_acceleration_structure_instance_count, brx_pal_acceleration_structure_build_input_read_only_buffer const *top_level_acceleration_structure_device_instance_buffer, brx_pal_scratch_buffer *scratch_buffer) = 0;
+    virtual void update_top_level_acceleration_structure_from_device_instances(brx_pal_top_level_acceleration_structure *top_level_acceleration_structure, brx_pal_acceleration_structure_build_input_read_only_buffer const *top_level_acceleration_structure_device_instance_buffer, brx_pal_scratch_buffer *scratch_buffer) = 0;
     virtual void end() = 0;
 };
 
@@ -400,10 +839,35 @@ public:
     // PBR BOOK V3: ["4.3.4 Compact BVH For Traversal"](https://pbr-book.org/3ed-2018/Primitives_and_Intersection_Acceleration/Bounding_Volume_Hierarchies#CompactBVHForTraversal)
     // PBR BOOK V4: ["7.3.4 Compact BVH for Traversal"](https://pbr-book.org/4ed/Primitives_and_Intersection_Acceleration/Bounding_Volume_Hierarchies#CompactBVHforTraversal)
     virtual void compact_bottom_level_acceleration_structure(brx_pal_compacted_bottom_level_acceleration_structure *destination_compacted_bottom_level_acceleration_structure, brx_pal_non_compacted_bottom_level_acceleration_structure *source_non_compacted_bottom_level_acceleration_structure) = 0;
+    // NOTE: the compacted bottom level acceleration structure should NOT be released before it is serialized, and we use the fence to wait for the GPU completion to retrieve the size of the serialized acceleration structure before the "serialize" in the next submission
+    virtual void write_serialized_bottom_level_acceleration_structure_size(brx_pal_compacted_bottom_level_acceleration_structure const *compacted_bottom_level_acceleration_structure, brx_pal_serialized_bottom_level_acceleration_structure_size_query_pool *serialized_bottom_level_acceleration_structure_size_query_pool, uint32_t query_index) = 0;
+    // NOTE: the serialized data (starting with the "BRX_PAL_SERIALIZED_BOTTOM_LEVEL_ACCELERATION_STRUCTURE_HEADER") is available by the "get_host_memory_range_base" after we use the fence to wait for the GPU completion
+    virtual void serialize_compacted_bottom_level_acceleration_structure(brx_pal_serialized_bottom_level_acceleration_structure_buffer *destination_serialized_bottom_level_acceleration_structure_buffer, brx_pal_compacted_bottom_level_acceleration_structure const *source_compacted_bottom_level_acceleration_structure) = 0;
+    // NOTE: the size of the destination compacted bottom level acceleration structure should be the "deserialized_size" of the "BRX_PAL_SERIALIZED_BOTTOM_LEVEL_ACCELERATION_STRUCTURE_HEADER", and the "release" is still required after the "deserialize"
+    virtual void deserialize_compacted_bottom_level_acceleration_structure(brx_pal_compacted_bottom_level_acceleration_structure *destination_compacted_bottom_level_acceleration_structure, brx_pal_serialized_bottom_level_acceleration_structure_buffer const *source_serialized_bottom_level_acceleration_structure_buffer) = 0;
     virtual void release(uint32_t storage_asset_buffer_count, brx_pal_storage_asset_buffer const *const *storage_asset_buffers, uint32_t sampled_asset_image_subresource_count, BRX_PAL_SAMPLED_ASSET_IMAGE_SUBRESOURCE const *sampled_asset_image_subresources, uint32_t compacted_bottom_level_acceleration_structure_count, brx_pal_compacted_bottom_level_acceleration_structure const *const *compacted_bottom_level_acceleration_structures) = 0;
     virtual void end() = 0;
 };
 
+class brx_pal_compute_command_buffer
+{
+public:
+    virtual void begin() = 0;
+    virtual void begin_debug_utils_label(char const *label_name) = 0;
+    virtual void end_debug_utils_label() = 0;
+    // NOTE: the storage buffers and storage images should NOT be read by the graphics command buffer of another frame throttling index which may still be executed (see the "wait" of the graphics queue)
+    virtual void compute_pass_load(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *storage_buffers, BRX_PAL_COMPUTE_PASS_STORAGE_BUFFER_LOAD_OPERATION const *storage_buffer_load_operations, uint32_t storage_image_count, brx_pal_storage_image const *const *storage_images, BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_LOAD_OPERATION const *storage_image_load_operations) = 0;
+    virtual void bind_compute_pipeline(brx_pal_compute_pipeline const *compute_pipeline) = 0;
+    virtual void bind_compute_descriptor_sets(brx_pal_pipeline_layout const *pipeline_layout, uint32_t descriptor_set_count, brx_pal_descriptor_set const *const *descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets) = 0;
+    // NOTE: should be called after the "bind_compute_descriptor_sets" with the same "pipeline_layout"
+    virtual void push_compute_constants(brx_pal_pipeline_layout const *pipeline_layout, uint32_t offset, uint32_t size, void const *constants) = 0;
+    virtual void dispatch(uint32_t group_count_x, uint32_t group_count_y, uint32_t group_count_z) = 0;
+    virtual void compute_pass_barrier(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *storage_buffers, uint32_t storage_image_count, brx_pal_storage_image const *const *storage_images) = 0;
+    // NOTE: the "store" also releases the ownership to the graphics queue family, and the "acquire" of the graphics command buffer should be called later
+    virtual void compute_pass_store(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *storage_buffers, BRX_PAL_COMPUTE_PASS_STORAGE_BUFFER_STORE_OPERATION const *storage_buffer_store_operations, uint32_t storage_image_count, brx_pal_storage_image const *const *storage_images, BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_STORE_OPERATION const *storage_image_store_operations) = 0;
+    virtual void end() = 0;
+};
+
 class brx_pal_fence
 {
 };
@@ -420,6 +884,107 @@ class brx_pal_descriptor_set
 {
 };
 
+class brx_pal_descriptor_update_template
+{
+};
+
+class brx_pal_bindless_descriptor_index_allocator
+{
+public:
+    // NOTE: the "allocate_descriptor_index" and the "free_descriptor_index" are lock-free and can be called by multiple threads
+    // NOTE: the "descriptor_type" should be "BRX_PAL_DESCRIPTOR_TYPE_READ_ONLY_STORAGE_BUFFER", "BRX_PAL_DESCRIPTOR_TYPE_SAMPLED_IMAGE" or "BRX_PAL_DESCRIPTOR_TYPE_SAMPLER"
+    virtual uint32_t allocate_descriptor_index(BRX_PAL_DESCRIPTOR_TYPE descriptor_type) = 0;
+    // NOTE: the descriptor index is NOT reused until the "retire_frame" has been called "frame_throttling_count" times
+    virtual void free_descriptor_index(BRX_PAL_DESCRIPTOR_TYPE descriptor_type, uint32_t descriptor_index) = 0;
+    // NOTE: should be called once per frame after waiting for the fence of the oldest frame in flight
+    virtual void retire_frame() = 0;
+};
+
+class brx_pal_render_graph
+{
+public:
+    // NOTE: should be called once per frame after waiting for the fence of the oldest frame in flight, and all resources and passes of the previous frame become invalid
+    virtual void begin_frame() = 0;
+    // NOTE: the transient resources are only valid within the current frame, and the transient resources, whose lifetimes (from the writer to the last live reader) do NOT overlap, are placed in the same memory range of the memory heaps owned by the render graph (each frame throttling index has its own memory heaps)
+    virtual uint32_t create_transient_color_attachment_image(BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT color_attachment_image_format, uint32_t width, uint32_t height) = 0;
+    virtual uint32_t create_transient_depth_stencil_attachment_image(BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT depth_stencil_attachment_image_format, uint32_t width, uint32_t height) = 0;
+    virtual uint32_t create_transient_storage_image(BRX_PAL_STORAGE_IMAGE_FORMAT storage_image_format, uint32_t width, uint32_t height) = 0;
+    virtual uint32_t create_transient_storage_buffer(uint32_t size) = 0;
+    // NOTE: the imported resources are the outputs of the render graph, and the passes which write them are never culled
+    // NOTE: the imported resources should be in the same state as after the "store" both before and after the "execute" (the "store_operation" is used for the imported color attachment image, e.g. "FLUSH_FOR_PRESENT" for the swap chain image)
+    virtual uint32_t import_color_attachment_image(brx_pal_color_attachment_image const *color_attachment_image, BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT_STORE_OPERATION store_operation) = 0;
+    virtual uint32_t import_storage_image(brx_pal_storage_image const *storage_image) = 0;
+    virtual uint32_t import_storage_buffer(brx_pal_storage_intermediate_buffer const *storage_intermediate_buffer) = 0;
+    // NOTE: each resource can only be written by one pass within one frame, and should be written before being read (the order of the passes is the order of the "add_*_pass")
+    // NOTE: the "read_resources" are read as the sampled images or the read only storage buffers
+    // NOTE: only available when the "is_dynamic_rendering_supported" is true
+    virtual void add_rendering_pass(char const *pass_name, uint32_t width, uint32_t height, uint32_t color_attachment_count, BRX_PAL_RENDER_GRAPH_COLOR_ATTACHMENT const *color_attachments, BRX_PAL_RENDER_GRAPH_DEPTH_STENCIL_ATTACHMENT const *depth_stencil_attachment, uint32_t read_resource_count, uint32_t const *read_resources, brx_pal_render_graph_pass_execute_callback execute_callback, void *user_data) = 0;
+    // NOTE: the "write_resources" should be the storage images or the storage buffers, and the "compute_pass_barrier" (between the dispatches) is still the responsibility of the "execute_callback"
+    virtual void add_compute_pass(char const *pass_name, uint32_t write_resource_count, uint32_t const *write_resources, uint32_t read_resource_count, uint32_t const *read_resources, brx_pal_render_graph_pass_execute_callback execute_callback, void *user_data) = 0;
+    // NOTE: the passes, whose outputs are NOT used by any other pass or imported resource, are culled, and the "load" and "store" of each pass are batched
+    virtual void execute(brx_pal_graphics_command_buffer *graphics_command_buffer) = 0;
+    // NOTE: the physical resources are only available within the "execute_callback"
+    virtual brx_pal_color_attachment_image const *get_color_attachment_image(uint32_t resource) const = 0;
+    virtual brx_pal_depth_stencil_attachment_image const *get_depth_stencil_attachment_image(uint32_t resource) const = 0;
+    virtual brx_pal_storage_image const *get_storage_image(uint32_t resource) const = 0;
+    virtual brx_pal_storage_buffer const *get_storage_buffer(uint32_t resource) const = 0;
+    virtual brx_pal_sampled_image const *get_sampled_image(uint32_t resource) const = 0;
+    virtual brx_pal_read_only_storage_buffer const *get_read_only_storage_buffer(uint32_t resource) const = 0;
+};
+
+class brx_pal_deferred_destruction_queue
+{
+public:
+    // NOTE: the deferred destruction queue is NOT thread safe, and should be externally synchronized
+    // NOTE: the object is NOT destroyed until the "retire_frame" has been called "frame_throttling_count" times (the object may still be used by the GPU in the current frame)
+    virtual void destroy_descriptor_set(brx_pal_descriptor_set *descriptor_set) = 0;
+    virtual void destroy_graphics_pipeline(brx_pal_graphics_pipeline *graphics_pipeline) = 0;
+    virtual void destroy_compute_pipeline(brx_pal_compute_pipeline *compute_pipeline) = 0;
+    virtual void destroy_frame_buffer(brx_pal_frame_buffer *frame_buffer) = 0;
+    virtual void destroy_uniform_upload_buffer(brx_pal_uniform_upload_buffer *uniform_upload_buffer) = 0;
+    virtual void destroy_staging_upload_buffer(brx_pal_staging_upload_buffer *staging_upload_buffer) = 0;
+    virtual void destroy_storage_intermediate_buffer(brx_pal_storage_intermediate_buffer *storage_intermediate_buffer) = 0;
+    virtual void destroy_storage_asset_buffer(brx_pal_storage_asset_buffer *storage_asset_buffer) = 0;
+    virtual void destroy_color_attachment_image(brx_pal_color_attachment_image *color_attachment_image) = 0;
+    virtual void destroy_depth_stencil_attachment_image(brx_pal_depth_stencil_attachment_image *depth_stencil_attachment_image) = 0;
+    virtual void destroy_storage_image(brx_pal_storage_image *storage_image) = 0;
+    virtual void destroy_memory_heap(brx_pal_memory_heap *memory_heap) = 0;
+    virtual void destroy_sampled_asset_image(brx_pal_sampled_asset_image *sampled_asset_image) = 0;
+    virtual void destroy_sampler(brx_pal_sampler *sampler) = 0;
+    virtual void destroy_scratch_buffer(brx_pal_scratch_buffer *scratch_buffer) = 0;
+    virtual void destroy_intermediate_bottom_level_acceleration_structure(brx_pal_intermediate_bottom_level_acceleration_structure *intermediate_bottom_level_acceleration_structure) = 0;
+    virtual void destroy_non_compacted_bottom_level_acceleration_structure(brx_pal_non_compacted_bottom_level_acceleration_structure *non_compacted_bottom_level_acceleration_structure) = 0;
+    virtual void destroy_compacted_bottom_level_acceleration_structure(brx_pal_compacted_bottom_level_acceleration_structure *compacted_bottom_level_acceleration_structure) = 0;
+    virtual void destroy_top_level_acceleration_structure_instance_upload_buffer(brx_pal_top_level_acceleration_structure_instance_upload_buffer *top_level_acceleration_structure_instance_upload_buffer) = 0;
+    virtual void destroy_top_level_acceleration_structure(brx_pal_top_level_acceleration_structure *top_level_acceleration_structure) = 0;
+    // NOTE: should be called once per frame after waiting for the fence of the oldest frame in flight
+    virtual void retire_frame() = 0;
+};
+
+class brx_pal_acceleration_structure_update_manager
+{
+public:
+    // NOTE: the acceleration structure update manager is NOT thread safe, and should be externally synchronized
+    // NOTE: the manager only chooses the action, and the "build_*" or the "update_*" (as well as the "*_store") of the graphics command buffer is still the responsibility of the caller
+    // NOTE: the entry is associated with either the intermediate bottom level acceleration structure or the top level acceleration structure, and the first action of the entry is always BUILD
+    virtual uint32_t register_bottom_level_acceleration_structure() = 0;
+    virtual uint32_t register_top_level_acceleration_structure() = 0;
+    virtual void unregister_acceleration_structure(uint32_t entry) = 0;
+    // NOTE: the "dirty_instance_count" is the number of the instances whose transforms have changed (ignored by the bottom level acceleration structure)
+    // NOTE: the bounding box is the current bounding box of the vertex positions or the instances, and NULL is allowed if the bounding box growth is NOT tracked
+    virtual void mark_dirty(uint32_t entry, uint32_t dirty_instance_count, float const *bounding_box_min, float const *bounding_box_max) = 0;
+    // NOTE: should be called when the acceleration structure can NOT be updated (e.g. the geometries or the instance count have changed), and the BUILD is never deferred
+    virtual void mark_build_required(uint32_t entry) = 0;
+    // NOTE: should be called once per frame after all "mark_*", and the structures which are NOT dirty may also be built within the remaining budget
+    virtual void schedule() = 0;
+    virtual BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_ACTION get_action(uint32_t entry) const = 0;
+    virtual void get_statistics(BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_STATISTICS *statistics) const = 0;
+};
+
+class brx_pal_memory_heap
+{
+};
+
 class brx_pal_render_pass
 {
 };
@@ -428,6 +993,18 @@ class brx_pal_graphics_pipeline
 {
 };
 
+class brx_pal_graphics_pipeline_pre_rasterization_shader_library
+{
+};
+
+class brx_pal_graphics_pipeline_fragment_shader_library
+{
+};
+
+class brx_pal_graphics_pipeline_fragment_output_interface_library
+{
+};
+
 class brx_pal_compute_pipeline
 {
 };
@@ -528,6 +1105,9 @@ class brx_pal_scratch_buffer
 
 class brx_pal_bottom_level_acceleration_structure
 {
+public:
+    // NOTE: the "bottom_level_acceleration_structure_device_memory_range_base" of the "BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_DEVICE_INSTANCE" (passed to the compute shader by the uniform or storage buffer)
+    virtual uint64_t get_device_memory_range_base() const = 0;
 };
 
 class brx_pal_intermediate_bottom_level_acceleration_structure
@@ -550,10 +1130,23 @@ public:
     virtual brx_pal_bottom_level_acceleration_structure const *get_bottom_level_acceleration_structure() const = 0;
 };
 
+class brx_pal_serialized_bottom_level_acceleration_structure_size_query_pool
+{
+};
+
+class brx_pal_serialized_bottom_level_acceleration_structure_buffer
+{
+public:
+    // NOTE: the serialized data is written to here before the "deserialize" and is read from here after the "serialize"
+    virtual void *get_host_memory_range_base() const = 0;
+};
+
 class brx_pal_top_level_acceleration_structure_instance_upload_buffer
 {
 public:
     virtual void write_instance(uint32_t instance_index, BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE const *bottom_top_acceleration_structure_instance) = 0;
+    // NOTE: the instances [first_instance_index, first_instance_index + instance_count) are written by the non-temporal stores, and the disjoint ranges of the same upload buffer are allowed to be written by different threads concurrently (the threads should be joined before the upload buffer is used by the GPU)
+    virtual void write_instances(uint32_t first_instance_index, uint32_t instance_count, BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE const *bottom_top_acceleration_structure_instances) = 0;
 };
 
 class brx_pal_top_level_acceleration_structure
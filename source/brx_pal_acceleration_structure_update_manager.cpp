@@ -0,0 +1,253 @@
+//
+// Copyright (C) YuqiaoZhang(HanetakaChou)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#include "brx_pal_acceleration_structure_update_manager.h"
+#include <algorithm>
+#include <assert.h>
+
+brx_pal_budgeted_acceleration_structure_update_manager::brx_pal_budgeted_acceleration_structure_update_manager()
+    : m_max_update_count(0U),
+      m_max_bounding_box_surface_area_growth(0.0F),
+      m_max_build_count_per_frame(0U),
+      m_statistics{}
+{
+}
+
+void brx_pal_budgeted_acceleration_structure_update_manager::init(BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_POLICY const *policy)
+{
+    assert(NULL != policy);
+    assert(policy->max_bounding_box_surface_area_growth >= 0.0F);
+
+    this->m_max_update_count = policy->max_update_count;
+    this->m_max_bounding_box_surface_area_growth = policy->max_bounding_box_surface_area_growth;
+    this->m_max_build_count_per_frame = policy->max_build_count_per_frame;
+
+    assert(this->m_entries.empty());
+    assert(this->m_free_entries.empty());
+}
+
+void brx_pal_budgeted_acceleration_structure_update_manager::uninit()
+{
+    this->m_build_candidates.clear();
+    this->m_free_entries.clear();
+    this->m_entries.clear();
+}
+
+brx_pal_budgeted_acceleration_structure_update_manager::~brx_pal_budgeted_acceleration_structure_update_manager()
+{
+    assert(this->m_entries.empty());
+    assert(this->m_free_entries.empty());
+}
+
+uint32_t brx_pal_budgeted_acceleration_structure_update_manager::register_bottom_level_acceleration_structure()
+{
+    return this->register_acceleration_structure(false);
+}
+
+uint32_t brx_pal_budgeted_acceleration_structure_update_manager::register_top_level_acceleration_structure()
+{
+    return this->register_acceleration_structure(true);
+}
+
+uint32_t brx_pal_budgeted_acceleration_structure_update_manager::register_acceleration_structure(bool top_level)
+{
+    uint32_t entry_index;
+    if (!this->m_free_entries.empty())
+    {
+        entry_index = this->m_free_entries.back();
+        this->m_free_entries.pop_back();
+    }
+    else
+    {
+        entry_index = static_cast<uint32_t>(this->m_entries.size());
+        this->m_entries.emplace_back();
+    }
+
+    brx_pal_acceleration_structure_update_entry &entry = this->m_entries[entry_index];
+    entry.m_registered = true;
+    entry.m_top_level = top_level;
+    entry.m_build_required = true;
+    entry.m_dirty = false;
+    entry.m_dirty_instance_count = 0U;
+    entry.m_update_count = 0U;
+    entry.m_build_surface_area = 0.0F;
+    entry.m_current_surface_area = 0.0F;
+    entry.m_action = BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_ACTION_NONE;
+
+    assert(BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_ENTRY_INVALID != entry_index);
+    return entry_index;
+}
+
+void brx_pal_budgeted_acceleration_structure_update_manager::unregister_acceleration_structure(uint32_t entry_index)
+{
+    assert(entry_index < this->m_entries.size());
+    assert(this->m_entries[entry_index].m_registered);
+
+    this->m_entries[entry_index].m_registered = false;
+    this->m_free_entries.push_back(entry_index);
+}
+
+void brx_pal_budgeted_acceleration_structure_update_manager::mark_dirty(uint32_t entry_index, uint32_t dirty_instance_count, float const *bounding_box_min, float const *bounding_box_max)
+{
+    assert(entry_index < this->m_entries.size());
+    brx_pal_acceleration_structure_update_entry &entry = this->m_entries[entry_index];
+    assert(entry.m_registered);
+
+    entry.m_dirty = true;
+
+    if (entry.m_top_level)
+    {
+        entry.m_dirty_instance_count += dirty_instance_count;
+    }
+
+    assert((NULL == bounding_box_min) == (NULL == bounding_box_max));
+    if ((NULL != bounding_box_min) && (NULL != bounding_box_max))
+    {
+        float const extent_x = std::max(bounding_box_max[0] - bounding_box_min[0], 0.0F);
+        float const extent_y = std::max(bounding_box_max[1] - bounding_box_min[1], 0.0F);
+        float const extent_z = std::max(bounding_box_max[2] - bounding_box_min[2], 0.0F);
+        entry.m_current_surface_area = 2.0F * (extent_x * extent_y + extent_y * extent_z + extent_z * extent_x);
+    }
+}
+
+void brx_pal_budgeted_acceleration_structure_update_manager::mark_build_required(uint32_t entry_index)
+{
+    assert(entry_index < this->m_entries.size());
+    assert(this->m_entries[entry_index].m_registered);
+
+    this->m_entries[entry_index].m_build_required = true;
+}
+
+float brx_pal_budgeted_acceleration_structure_update_manager::get_degradation(brx_pal_acceleration_structure_update_entry const &entry) const
+{
+    // the degradation after the action of the current frame if the acceleration structure is NOT built, and the build is desired when the degradation is greater than one
+    float degradation = 0.0F;
+
+    if (this->m_max_update_count > 0U)
+    {
+        uint32_t const update_count = entry.m_update_count + (entry.m_dirty ? 1U : 0U);
+        degradation = std::max(degradation, static_cast<float>(update_count) / static_cast<float>(this->m_max_update_count));
+    }
+
+    if ((this->m_max_bounding_box_surface_area_growth > 0.0F) && (entry.m_build_surface_area > 0.0F))
+    {
+        float const growth = entry.m_current_surface_area / entry.m_build_surface_area - 1.0F;
+        degradation = std::max(degradation, growth / this->m_max_bounding_box_surface_area_growth);
+    }
+
+    return degradation;
+}
+
+void brx_pal_budgeted_acceleration_structure_update_manager::schedule()
+{
+    this->m_statistics = BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_STATISTICS{};
+
+    // the required builds are never deferred but still consume the budget
+    uint32_t build_count = 0U;
+
+    assert(this->m_build_candidates.empty());
+    for (uint32_t entry_index = 0U; entry_index < this->m_entries.size(); ++entry_index)
+    {
+        brx_pal_acceleration_structure_update_entry &entry = this->m_entries[entry_index];
+        if (!entry.m_registered)
+        {
+            continue;
+        }
+
+        if (entry.m_build_required)
+        {
+            entry.m_action = BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_ACTION_BUILD;
+            ++build_count;
+        }
+        else if (this->get_degradation(entry) > 1.0F)
+        {
+            this->m_build_candidates.push_back(entry_index);
+        }
+        else
+        {
+            entry.m_action = entry.m_dirty ? BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_ACTION_UPDATE : BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_ACTION_NONE;
+        }
+    }
+
+    // the most degraded acceleration structures are built first
+    std::stable_sort(this->m_build_candidates.begin(), this->m_build_candidates.end(), [this](uint32_t entry_index_a, uint32_t entry_index_b) -> bool
+                     { return this->get_degradation(this->m_entries[entry_index_a]) > this->get_degradation(this->m_entries[entry_index_b]); });
+
+    for (uint32_t const entry_index : this->m_build_candidates)
+    {
+        brx_pal_acceleration_structure_update_entry &entry = this->m_entries[entry_index];
+
+        if ((0U == this->m_max_build_count_per_frame) || (build_count < this->m_max_build_count_per_frame))
+        {
+            entry.m_action = BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_ACTION_BUILD;
+            ++build_count;
+        }
+        else
+        {
+            entry.m_action = entry.m_dirty ? BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_ACTION_UPDATE : BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_ACTION_NONE;
+            ++this->m_statistics.deferred_build_count;
+        }
+    }
+
+    this->m_build_candidates.clear();
+
+    for (brx_pal_acceleration_structure_update_entry &entry : this->m_entries)
+    {
+        if (!entry.m_registered)
+        {
+            continue;
+        }
+
+        if (BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_ACTION_BUILD == entry.m_action)
+        {
+            entry.m_update_count = 0U;
+            entry.m_build_surface_area = entry.m_current_surface_area;
+            ++(entry.m_top_level ? this->m_statistics.top_level_acceleration_structure_build_count : this->m_statistics.bottom_level_acceleration_structure_build_count);
+        }
+        else if (BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_ACTION_UPDATE == entry.m_action)
+        {
+            // the bounding box may NOT be provided before the first build, and the first tracked surface area is used as the baseline instead
+            if ((0.0F == entry.m_build_surface_area) && (entry.m_current_surface_area > 0.0F))
+            {
+                entry.m_build_surface_area = entry.m_current_surface_area;
+            }
+
+            ++entry.m_update_count;
+            ++(entry.m_top_level ? this->m_statistics.top_level_acceleration_structure_update_count : this->m_statistics.bottom_level_acceleration_structure_update_count);
+        }
+
+        this->m_statistics.dirty_instance_count += entry.m_dirty_instance_count;
+
+        entry.m_build_required = false;
+        entry.m_dirty = false;
+        entry.m_dirty_instance_count = 0U;
+    }
+}
+
+BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_ACTION brx_pal_budgeted_acceleration_structure_update_manager::get_action(uint32_t entry_index) const
+{
+    assert(entry_index < this->m_entries.size());
+    assert(this->m_entries[entry_index].m_registered);
+
+    return this->m_entries[entry_index].m_action;
+}
+
+void brx_pal_budgeted_acceleration_structure_update_manager::get_statistics(BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_STATISTICS *statistics) const
+{
+    assert(NULL != statistics);
+    (*statistics) = this->m_statistics;
+}
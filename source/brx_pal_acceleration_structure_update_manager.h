@@ -0,0 +1,68 @@
+//
+// Copyright (C) YuqiaoZhang(HanetakaChou)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#ifndef _BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_MANAGER_H_
+#define _BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_MANAGER_H_ 1
+
+#include "../include/brx_pal_device.h"
+#include "../../McRT-Malloc/include/mcrt_vector.h"
+
+struct brx_pal_acceleration_structure_update_entry
+{
+    bool m_registered;
+    bool m_top_level;
+    bool m_build_required;
+    bool m_dirty;
+    uint32_t m_dirty_instance_count;
+    // the number of the consecutive updates since the last build
+    uint32_t m_update_count;
+    // the surface area of the bounding box (zero if NOT tracked) when the acceleration structure was last built, or at the first update if NOT tracked by the build
+    float m_build_surface_area;
+    float m_current_surface_area;
+    BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_ACTION m_action;
+};
+
+// the builds, which are NOT required, are sorted by the degradation (the larger ratio of the update count and the bounding box growth to the policy) and only the most degraded ones within the budget are built (the others are updated or left as is)
+class brx_pal_budgeted_acceleration_structure_update_manager final : public brx_pal_acceleration_structure_update_manager
+{
+    uint32_t m_max_update_count;
+    float m_max_bounding_box_surface_area_growth;
+    uint32_t m_max_build_count_per_frame;
+    mcrt_vector<brx_pal_acceleration_structure_update_entry> m_entries;
+    mcrt_vector<uint32_t> m_free_entries;
+    mcrt_vector<uint32_t> m_build_candidates;
+    BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_STATISTICS m_statistics;
+
+    uint32_t register_acceleration_structure(bool top_level);
+    float get_degradation(brx_pal_acceleration_structure_update_entry const &entry) const;
+
+public:
+    brx_pal_budgeted_acceleration_structure_update_manager();
+    void init(BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_POLICY const *policy);
+    void uninit();
+    ~brx_pal_budgeted_acceleration_structure_update_manager();
+    uint32_t register_bottom_level_acceleration_structure() override;
+    uint32_t register_top_level_acceleration_structure() override;
+    void unregister_acceleration_structure(uint32_t entry) override;
+    void mark_dirty(uint32_t entry, uint32_t dirty_instance_count, float const *bounding_box_min, float const *bounding_box_max) override;
+    void mark_build_required(uint32_t entry) override;
+    void schedule() override;
+    BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_ACTION get_action(uint32_t entry) const override;
+    void get_statistics(BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_STATISTICS *statistics) const override;
+};
+
+#endif
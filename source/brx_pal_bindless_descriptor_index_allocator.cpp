@@ -0,0 +1,289 @@
+//
+// Copyright (C) YuqiaoZhang(HanetakaChou)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#include "brx_pal_bindless_descriptor_index_allocator.h"
+#include "../../McRT-Malloc/include/mcrt_malloc.h"
+#include <assert.h>
+#include <new>
+
+static inline uint64_t internal_make_list_head(uint32_t tag, uint32_t descriptor_index)
+{
+    return ((static_cast<uint64_t>(tag) << 32U) | static_cast<uint64_t>(descriptor_index));
+}
+
+static inline uint32_t internal_get_list_head_tag(uint64_t list_head)
+{
+    return static_cast<uint32_t>(list_head >> 32U);
+}
+
+static inline uint32_t internal_get_list_head_descriptor_index(uint64_t list_head)
+{
+    return static_cast<uint32_t>(list_head & 0XFFFFFFFFU);
+}
+
+brx_pal_lock_free_descriptor_index_pool::brx_pal_lock_free_descriptor_index_pool()
+    : m_descriptor_count(0U),
+      m_bump_descriptor_index(0U),
+      m_next_descriptor_indices(NULL),
+      m_free_list_head(internal_make_list_head(0U, BRX_PAL_BINDLESS_DESCRIPTOR_INDEX_INVALID)),
+      m_retire_list_count(0U),
+      m_retire_list_heads(NULL)
+{
+}
+
+void brx_pal_lock_free_descriptor_index_pool::init(uint32_t descriptor_count, uint32_t retire_list_count)
+{
+    assert(descriptor_count < BRX_PAL_BINDLESS_DESCRIPTOR_INDEX_INVALID);
+    assert(retire_list_count > 0U);
+
+    assert(0U == this->m_descriptor_count);
+    this->m_descriptor_count = descriptor_count;
+
+    assert(0U == this->m_bump_descriptor_index.load());
+
+    assert(NULL == this->m_next_descriptor_indices);
+    if (descriptor_count > 0U)
+    {
+        this->m_next_descriptor_indices = static_cast<std::atomic_uint32_t *>(mcrt_malloc(sizeof(std::atomic_uint32_t) * descriptor_count, alignof(std::atomic_uint32_t)));
+        assert(NULL != this->m_next_descriptor_indices);
+
+        for (uint32_t descriptor_index = 0U; descriptor_index < descriptor_count; ++descriptor_index)
+        {
+            new (&this->m_next_descriptor_indices[descriptor_index]) std::atomic_uint32_t{BRX_PAL_BINDLESS_DESCRIPTOR_INDEX_INVALID};
+        }
+    }
+
+    assert(BRX_PAL_BINDLESS_DESCRIPTOR_INDEX_INVALID == internal_get_list_head_descriptor_index(this->m_free_list_head.load()));
+
+    assert(0U == this->m_retire_list_count);
+    this->m_retire_list_count = retire_list_count;
+
+    assert(NULL == this->m_retire_list_heads);
+    this->m_retire_list_heads = static_cast<std::atomic_uint64_t *>(mcrt_malloc(sizeof(std::atomic_uint64_t) * retire_list_count, alignof(std::atomic_uint64_t)));
+    assert(NULL != this->m_retire_list_heads);
+
+    for (uint32_t retire_list_index = 0U; retire_list_index < retire_list_count; ++retire_list_index)
+    {
+        new (&this->m_retire_list_heads[retire_list_index]) std::atomic_uint64_t{internal_make_list_head(0U, BRX_PAL_BINDLESS_DESCRIPTOR_INDEX_INVALID)};
+    }
+}
+
+void brx_pal_lock_free_descriptor_index_pool::uninit()
+{
+    assert(NULL != this->m_retire_list_heads);
+    for (uint32_t retire_list_index = 0U; retire_list_index < this->m_retire_list_count; ++retire_list_index)
+    {
+        this->m_retire_list_heads[retire_list_index].~atomic();
+    }
+    mcrt_free(this->m_retire_list_heads);
+    this->m_retire_list_heads = NULL;
+    this->m_retire_list_count = 0U;
+
+    if (NULL != this->m_next_descriptor_indices)
+    {
+        for (uint32_t descriptor_index = 0U; descriptor_index < this->m_descriptor_count; ++descriptor_index)
+        {
+            this->m_next_descriptor_indices[descriptor_index].~atomic();
+        }
+        mcrt_free(this->m_next_descriptor_indices);
+        this->m_next_descriptor_indices = NULL;
+    }
+
+    this->m_free_list_head.store(internal_make_list_head(0U, BRX_PAL_BINDLESS_DESCRIPTOR_INDEX_INVALID));
+    this->m_bump_descriptor_index.store(0U);
+    this->m_descriptor_count = 0U;
+}
+
+brx_pal_lock_free_descriptor_index_pool::~brx_pal_lock_free_descriptor_index_pool()
+{
+    assert(NULL == this->m_next_descriptor_indices);
+    assert(NULL == this->m_retire_list_heads);
+}
+
+void brx_pal_lock_free_descriptor_index_pool::push(std::atomic_uint64_t *list_head, uint32_t first_descriptor_index, uint32_t last_descriptor_index)
+{
+    uint64_t old_list_head = list_head->load();
+    uint64_t new_list_head;
+    do
+    {
+        this->m_next_descriptor_indices[last_descriptor_index].store(internal_get_list_head_descriptor_index(old_list_head));
+        new_list_head = internal_make_list_head(internal_get_list_head_tag(old_list_head) + 1U, first_descriptor_index);
+    } while (!list_head->compare_exchange_weak(old_list_head, new_list_head));
+}
+
+uint32_t brx_pal_lock_free_descriptor_index_pool::pop(std::atomic_uint64_t *list_head)
+{
+    uint64_t old_list_head = list_head->load();
+    uint64_t new_list_head;
+    do
+    {
+        uint32_t const descriptor_index = internal_get_list_head_descriptor_index(old_list_head);
+        if (BRX_PAL_BINDLESS_DESCRIPTOR_INDEX_INVALID == descriptor_index)
+        {
+            return BRX_PAL_BINDLESS_DESCRIPTOR_INDEX_INVALID;
+        }
+
+        // the tag prevents the CAS from succeeding when the "next" has been changed by the other threads (ABA)
+        new_list_head = internal_make_list_head(internal_get_list_head_tag(old_list_head) + 1U, this->m_next_descriptor_indices[descriptor_index].load());
+    } while (!list_head->compare_exchange_weak(old_list_head, new_list_head));
+
+    return internal_get_list_head_descriptor_index(old_list_head);
+}
+
+uint32_t brx_pal_lock_free_descriptor_index_pool::allocate()
+{
+    // reuse the retired descriptor indices first
+    uint32_t const free_descriptor_index = this->pop(&this->m_free_list_head);
+    if (BRX_PAL_BINDLESS_DESCRIPTOR_INDEX_INVALID != free_descriptor_index)
+    {
+        assert(free_descriptor_index < this->m_descriptor_count);
+        return free_descriptor_index;
+    }
+
+    uint32_t bump_descriptor_index = this->m_bump_descriptor_index.load();
+    do
+    {
+        if (bump_descriptor_index >= this->m_descriptor_count)
+        {
+            // out of descriptors
+            assert(false);
+            return BRX_PAL_BINDLESS_DESCRIPTOR_INDEX_INVALID;
+        }
+    } while (!this->m_bump_descriptor_index.compare_exchange_weak(bump_descriptor_index, bump_descriptor_index + 1U));
+
+    return bump_descriptor_index;
+}
+
+void brx_pal_lock_free_descriptor_index_pool::free(uint32_t descriptor_index, uint32_t retire_list_index)
+{
+    assert(descriptor_index < this->m_bump_descriptor_index.load());
+    assert(retire_list_index < this->m_retire_list_count);
+
+    this->push(&this->m_retire_list_heads[retire_list_index], descriptor_index, descriptor_index);
+}
+
+void brx_pal_lock_free_descriptor_index_pool::retire(uint32_t retire_list_index)
+{
+    assert(retire_list_index < this->m_retire_list_count);
+
+    uint64_t const retire_list_head = this->m_retire_list_heads[retire_list_index].exchange(internal_make_list_head(0U, BRX_PAL_BINDLESS_DESCRIPTOR_INDEX_INVALID));
+
+    uint32_t const first_descriptor_index = internal_get_list_head_descriptor_index(retire_list_head);
+    if (BRX_PAL_BINDLESS_DESCRIPTOR_INDEX_INVALID != first_descriptor_index)
+    {
+        // the whole list has been detached and is only visible to the current thread
+        uint32_t last_descriptor_index = first_descriptor_index;
+        for (uint32_t next_descriptor_index = this->m_next_descriptor_indices[last_descriptor_index].load(); BRX_PAL_BINDLESS_DESCRIPTOR_INDEX_INVALID != next_descriptor_index; next_descriptor_index = this->m_next_descriptor_indices[last_descriptor_index].load())
+        {
+            last_descriptor_index = next_descriptor_index;
+        }
+
+        this->push(&this->m_free_list_head, first_descriptor_index, last_descriptor_index);
+    }
+}
+
+brx_pal_lock_free_bindless_descriptor_index_allocator::brx_pal_lock_free_bindless_descriptor_index_allocator()
+    : m_retire_list_count(0U),
+      m_current_retire_list_index(0U)
+{
+}
+
+void brx_pal_lock_free_bindless_descriptor_index_allocator::init(uint32_t read_only_storage_buffer_descriptor_count, uint32_t sampled_image_descriptor_count, uint32_t sampler_descriptor_count, uint32_t frame_throttling_count)
+{
+    assert(frame_throttling_count > 0U);
+
+    // the retire list of the oldest frame is released before it becomes the current retire list
+    // the descriptor index, freed when the frame "N" is being recorded, is released when the frame "N + frame_throttling_count" begins (the fence of the frame "N" has been waited)
+    assert(0U == this->m_retire_list_count);
+    this->m_retire_list_count = frame_throttling_count;
+
+    this->m_read_only_storage_buffer_descriptor_index_pool.init(read_only_storage_buffer_descriptor_count, frame_throttling_count);
+    this->m_sampled_image_descriptor_index_pool.init(sampled_image_descriptor_count, frame_throttling_count);
+    this->m_sampler_descriptor_index_pool.init(sampler_descriptor_count, frame_throttling_count);
+
+    assert(0U == this->m_current_retire_list_index.load());
+}
+
+void brx_pal_lock_free_bindless_descriptor_index_allocator::uninit()
+{
+    this->m_sampler_descriptor_index_pool.uninit();
+    this->m_sampled_image_descriptor_index_pool.uninit();
+    this->m_read_only_storage_buffer_descriptor_index_pool.uninit();
+
+    this->m_retire_list_count = 0U;
+    this->m_current_retire_list_index.store(0U);
+}
+
+brx_pal_lock_free_bindless_descriptor_index_allocator::~brx_pal_lock_free_bindless_descriptor_index_allocator()
+{
+    assert(0U == this->m_retire_list_count);
+}
+
+brx_pal_lock_free_descriptor_index_pool *brx_pal_lock_free_bindless_descriptor_index_allocator::get_descriptor_index_pool(BRX_PAL_DESCRIPTOR_TYPE descriptor_type)
+{
+    switch (descriptor_type)
+    {
+    case BRX_PAL_DESCRIPTOR_TYPE_READ_ONLY_STORAGE_BUFFER:
+    {
+        return &this->m_read_only_storage_buffer_descriptor_index_pool;
+    }
+    break;
+    case BRX_PAL_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+    {
+        return &this->m_sampled_image_descriptor_index_pool;
+    }
+    break;
+    case BRX_PAL_DESCRIPTOR_TYPE_SAMPLER:
+    {
+        return &this->m_sampler_descriptor_index_pool;
+    }
+    break;
+    default:
+    {
+        assert(false);
+        return NULL;
+    }
+    }
+}
+
+uint32_t brx_pal_lock_free_bindless_descriptor_index_allocator::allocate_descriptor_index(BRX_PAL_DESCRIPTOR_TYPE descriptor_type)
+{
+    brx_pal_lock_free_descriptor_index_pool *const descriptor_index_pool = this->get_descriptor_index_pool(descriptor_type);
+    assert(NULL != descriptor_index_pool);
+
+    return descriptor_index_pool->allocate();
+}
+
+void brx_pal_lock_free_bindless_descriptor_index_allocator::free_descriptor_index(BRX_PAL_DESCRIPTOR_TYPE descriptor_type, uint32_t descriptor_index)
+{
+    brx_pal_lock_free_descriptor_index_pool *const descriptor_index_pool = this->get_descriptor_index_pool(descriptor_type);
+    assert(NULL != descriptor_index_pool);
+
+    descriptor_index_pool->free(descriptor_index, this->m_current_retire_list_index.load());
+}
+
+void brx_pal_lock_free_bindless_descriptor_index_allocator::retire_frame()
+{
+    uint32_t const next_retire_list_index = (this->m_current_retire_list_index.load() + 1U) % this->m_retire_list_count;
+
+    // release the oldest retire list before it becomes the current retire list
+    this->m_read_only_storage_buffer_descriptor_index_pool.retire(next_retire_list_index);
+    this->m_sampled_image_descriptor_index_pool.retire(next_retire_list_index);
+    this->m_sampler_descriptor_index_pool.retire(next_retire_list_index);
+
+    this->m_current_retire_list_index.store(next_retire_list_index);
+}
@@ -0,0 +1,68 @@
+//
+// Copyright (C) YuqiaoZhang(HanetakaChou)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#ifndef _BRX_PAL_BINDLESS_DESCRIPTOR_INDEX_ALLOCATOR_H_
+#define _BRX_PAL_BINDLESS_DESCRIPTOR_INDEX_ALLOCATOR_H_ 1
+
+#include "../include/brx_pal_device.h"
+#include <atomic>
+
+// Treiber stack
+// the "next" links are intrusive (indexed by the descriptor index), and the head is tagged to avoid the ABA problem
+class brx_pal_lock_free_descriptor_index_pool
+{
+    uint32_t m_descriptor_count;
+    std::atomic_uint32_t m_bump_descriptor_index;
+    std::atomic_uint32_t *m_next_descriptor_indices;
+    std::atomic_uint64_t m_free_list_head;
+    uint32_t m_retire_list_count;
+    std::atomic_uint64_t *m_retire_list_heads;
+
+    void push(std::atomic_uint64_t *list_head, uint32_t first_descriptor_index, uint32_t last_descriptor_index);
+    uint32_t pop(std::atomic_uint64_t *list_head);
+
+public:
+    brx_pal_lock_free_descriptor_index_pool();
+    void init(uint32_t descriptor_count, uint32_t retire_list_count);
+    void uninit();
+    ~brx_pal_lock_free_descriptor_index_pool();
+    uint32_t allocate();
+    void free(uint32_t descriptor_index, uint32_t retire_list_index);
+    void retire(uint32_t retire_list_index);
+};
+
+class brx_pal_lock_free_bindless_descriptor_index_allocator final : public brx_pal_bindless_descriptor_index_allocator
+{
+    brx_pal_lock_free_descriptor_index_pool m_read_only_storage_buffer_descriptor_index_pool;
+    brx_pal_lock_free_descriptor_index_pool m_sampled_image_descriptor_index_pool;
+    brx_pal_lock_free_descriptor_index_pool m_sampler_descriptor_index_pool;
+    uint32_t m_retire_list_count;
+    std::atomic_uint32_t m_current_retire_list_index;
+
+    brx_pal_lock_free_descriptor_index_pool *get_descriptor_index_pool(BRX_PAL_DESCRIPTOR_TYPE descriptor_type);
+
+public:
+    brx_pal_lock_free_bindless_descriptor_index_allocator();
+    void init(uint32_t read_only_storage_buffer_descriptor_count, uint32_t sampled_image_descriptor_count, uint32_t sampler_descriptor_count, uint32_t frame_throttling_count);
+    void uninit();
+    ~brx_pal_lock_free_bindless_descriptor_index_allocator();
+    uint32_t allocate_descriptor_index(BRX_PAL_DESCRIPTOR_TYPE descriptor_type) override;
+    void free_descriptor_index(BRX_PAL_DESCRIPTOR_TYPE descriptor_type, uint32_t descriptor_index) override;
+    void retire_frame() override;
+};
+
+#endif
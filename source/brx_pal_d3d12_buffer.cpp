@@ -16,6 +16,8 @@
 //
 
 #include "brx_pal_d3d12_device.h"
+#include "brx_pal_top_level_acceleration_structure_instance_writer.h"
+#include <stddef.h>
 #include <assert.h>
 
 brx_pal_d3d12_uniform_upload_buffer::brx_pal_d3d12_uniform_upload_buffer() : m_resource(NULL), m_allocation(NULL), m_host_memory_range_base(NULL)
@@ -144,7 +146,7 @@ brx_pal_d3d12_storage_intermediate_buffer::brx_pal_d3d12_storage_intermediate_bu
 {
 }
 
-void brx_pal_d3d12_storage_intermediate_buffer::init(D3D12MA::Allocator *memory_allocator, D3D12MA::Pool *storage_buffer_memory_pool, uint32_t wrapped_size)
+void brx_pal_d3d12_storage_intermediate_buffer::init(D3D12MA::Allocator *memory_allocator, D3D12MA::Pool *storage_buffer_memory_pool, D3D12MA::Allocation *memory_heap_allocation, uint64_t memory_heap_offset, uint32_t wrapped_size)
 {
     uint32_t const num_elements = ((wrapped_size - 1U) / sizeof(uint32_t)) + 1U;
     uint32_t const size_elements = sizeof(uint32_t) * num_elements;
@@ -171,7 +173,16 @@ void brx_pal_d3d12_storage_intermediate_buffer::init(D3D12MA::Allocator *memory_
         D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
         D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS};
 
-    HRESULT hr_create_resource = memory_allocator->CreateResource(&allocation_desc, &resource_desc, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE, NULL, &this->m_allocation, IID_PPV_ARGS(&this->m_resource));
+    HRESULT hr_create_resource;
+    if (NULL == memory_heap_allocation)
+    {
+        hr_create_resource = memory_allocator->CreateResource(&allocation_desc, &resource_desc, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE, NULL, &this->m_allocation, IID_PPV_ARGS(&this->m_resource));
+    }
+    else
+    {
+        // only the resource is created and the allocation is owned by the memory heap
+        hr_create_resource = memory_allocator->CreateAliasingResource(memory_heap_allocation, memory_heap_offset, &resource_desc, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE, NULL, IID_PPV_ARGS(&this->m_resource));
+    }
     assert(SUCCEEDED(hr_create_resource));
 
     this->m_shader_resource_view_desc = D3D12_SHADER_RESOURCE_VIEW_DESC{
@@ -201,9 +212,12 @@ void brx_pal_d3d12_storage_intermediate_buffer::uninit()
     this->m_resource->Release();
     this->m_resource = NULL;
 
-    assert(NULL != this->m_allocation);
-    this->m_allocation->Release();
-    this->m_allocation = NULL;
+    // the allocation is NULL if the buffer is placed in the memory heap
+    if (NULL != this->m_allocation)
+    {
+        this->m_allocation->Release();
+        this->m_allocation = NULL;
+    }
 }
 
 brx_pal_d3d12_storage_intermediate_buffer::~brx_pal_d3d12_storage_intermediate_buffer()
@@ -212,6 +226,25 @@ brx_pal_d3d12_storage_intermediate_buffer::~brx_pal_d3d12_storage_intermediate_b
     assert(NULL == this->m_allocation);
 }
 
+void brx_pal_d3d12_storage_intermediate_buffer::get_memory_requirements(ID3D12Device *device, uint32_t wrapped_size, D3D12_RESOURCE_ALLOCATION_INFO *out_resource_allocation_info)
+{
+    uint32_t const num_elements = ((wrapped_size - 1U) / sizeof(uint32_t)) + 1U;
+    uint32_t const size_elements = sizeof(uint32_t) * num_elements;
+
+    D3D12_RESOURCE_DESC const resource_desc = {
+        D3D12_RESOURCE_DIMENSION_BUFFER,
+        D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT,
+        size_elements,
+        1U,
+        1U,
+        1U,
+        DXGI_FORMAT_UNKNOWN,
+        {1U, 0U},
+        D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
+        D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS};
+    (*out_resource_allocation_info) = device->GetResourceAllocationInfo(0U, 1U, &resource_desc);
+}
+
 D3D12_SHADER_RESOURCE_VIEW_DESC const *brx_pal_d3d12_storage_intermediate_buffer::get_shader_resource_view_desc() const
 {
     return &this->m_shader_resource_view_desc;
@@ -375,6 +408,11 @@ ID3D12Resource *brx_pal_d3d12_scratch_buffer::get_resource() const
     return this->m_resource;
 }
 
+uint64_t brx_pal_d3d12_bottom_level_acceleration_structure::get_device_memory_range_base() const
+{
+    return this->get_resource()->GetGPUVirtualAddress();
+}
+
 brx_pal_d3d12_intermediate_bottom_level_acceleration_structure::brx_pal_d3d12_intermediate_bottom_level_acceleration_structure() : m_resource(NULL), m_allocation(NULL)
 {
 }
@@ -628,6 +666,147 @@ brx_pal_bottom_level_acceleration_structure const *brx_pal_d3d12_compacted_botto
     return static_cast<brx_pal_d3d12_bottom_level_acceleration_structure const *>(this);
 }
 
+brx_pal_d3d12_serialized_bottom_level_acceleration_structure_size_query_pool::brx_pal_d3d12_serialized_bottom_level_acceleration_structure_size_query_pool() : m_resource(NULL), m_allocation(NULL), m_host_memory_range_base(NULL)
+{
+}
+
+void brx_pal_d3d12_serialized_bottom_level_acceleration_structure_size_query_pool::init(D3D12MA::Allocator *memory_allocator, D3D12MA::Pool *compacted_bottom_level_acceleration_structure_size_query_buffer_memory_pool, uint32_t query_count)
+{
+    // NOTE: we share the same memory pool with the compacted size query, since both are the postbuild info written by the GPU and read by the host
+    static_assert(alignof(D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_SERIALIZATION_DESC) == alignof(D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_COMPACTED_SIZE_DESC), "");
+
+    uint32_t const size = sizeof(D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_SERIALIZATION_DESC) * query_count;
+
+    D3D12MA::ALLOCATION_DESC const allocation_desc = {
+        D3D12MA::ALLOCATION_FLAG_NONE,
+        D3D12_HEAP_TYPE_CUSTOM,
+        D3D12_HEAP_FLAG_NONE,
+        compacted_bottom_level_acceleration_structure_size_query_buffer_memory_pool,
+        NULL};
+
+    D3D12_RESOURCE_DESC const resource_desc = {
+        D3D12_RESOURCE_DIMENSION_BUFFER,
+        D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT,
+        size,
+        1U,
+        1U,
+        1U,
+        DXGI_FORMAT_UNKNOWN,
+        {1U, 0U},
+        D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
+        D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS};
+
+    HRESULT const hr_create_resource = memory_allocator->CreateResource(&allocation_desc, &resource_desc, D3D12_RESOURCE_STATE_UNORDERED_ACCESS, NULL, &this->m_allocation, IID_PPV_ARGS(&this->m_resource));
+    assert(SUCCEEDED(hr_create_resource));
+
+    void *host_memory_range_base = NULL;
+    D3D12_RANGE const read_range = {0U, size};
+    HRESULT const hr_map = this->m_resource->Map(0U, &read_range, &host_memory_range_base);
+    assert(SUCCEEDED(hr_map));
+
+    assert(NULL == this->m_host_memory_range_base);
+    this->m_host_memory_range_base = static_cast<D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_SERIALIZATION_DESC *>(host_memory_range_base);
+}
+
+void brx_pal_d3d12_serialized_bottom_level_acceleration_structure_size_query_pool::uninit()
+{
+    assert(NULL != this->m_resource);
+    this->m_resource->Release();
+    this->m_resource = NULL;
+
+    assert(NULL != this->m_allocation);
+    this->m_allocation->Release();
+    this->m_allocation = NULL;
+}
+
+brx_pal_d3d12_serialized_bottom_level_acceleration_structure_size_query_pool::~brx_pal_d3d12_serialized_bottom_level_acceleration_structure_size_query_pool()
+{
+    assert(NULL == this->m_resource);
+    assert(NULL == this->m_allocation);
+}
+
+ID3D12Resource *brx_pal_d3d12_serialized_bottom_level_acceleration_structure_size_query_pool::get_resource() const
+{
+    return this->m_resource;
+}
+
+D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_SERIALIZATION_DESC volatile *brx_pal_d3d12_serialized_bottom_level_acceleration_structure_size_query_pool::get_host_memory_range_base() const
+{
+    return this->m_host_memory_range_base;
+}
+
+brx_pal_d3d12_serialized_bottom_level_acceleration_structure_buffer::brx_pal_d3d12_serialized_bottom_level_acceleration_structure_buffer() : m_resource(NULL), m_allocation(NULL), m_host_memory_range_base(NULL)
+{
+}
+
+void brx_pal_d3d12_serialized_bottom_level_acceleration_structure_buffer::init(D3D12MA::Allocator *memory_allocator, D3D12MA::Pool *serialized_bottom_level_acceleration_structure_buffer_memory_pool, uint32_t size)
+{
+    static_assert(sizeof(BRX_PAL_SERIALIZED_BOTTOM_LEVEL_ACCELERATION_STRUCTURE_HEADER) == sizeof(D3D12_SERIALIZED_RAYTRACING_ACCELERATION_STRUCTURE_HEADER), "");
+    static_assert(offsetof(BRX_PAL_SERIALIZED_BOTTOM_LEVEL_ACCELERATION_STRUCTURE_HEADER, serialized_size) == offsetof(D3D12_SERIALIZED_RAYTRACING_ACCELERATION_STRUCTURE_HEADER, SerializedSizeInBytesIncludingHeader), "");
+    static_assert(offsetof(BRX_PAL_SERIALIZED_BOTTOM_LEVEL_ACCELERATION_STRUCTURE_HEADER, deserialized_size) == offsetof(D3D12_SERIALIZED_RAYTRACING_ACCELERATION_STRUCTURE_HEADER, DeserializedSizeInBytes), "");
+    static_assert(offsetof(BRX_PAL_SERIALIZED_BOTTOM_LEVEL_ACCELERATION_STRUCTURE_HEADER, bottom_level_acceleration_structure_pointer_count) == offsetof(D3D12_SERIALIZED_RAYTRACING_ACCELERATION_STRUCTURE_HEADER, NumBottomLevelAccelerationStructurePointersAfterHeader), "");
+    assert(size >= sizeof(BRX_PAL_SERIALIZED_BOTTOM_LEVEL_ACCELERATION_STRUCTURE_HEADER));
+
+    D3D12MA::ALLOCATION_DESC const allocation_desc = {
+        D3D12MA::ALLOCATION_FLAG_NONE,
+        D3D12_HEAP_TYPE_CUSTOM,
+        D3D12_HEAP_FLAG_NONE,
+        serialized_bottom_level_acceleration_structure_buffer_memory_pool,
+        NULL};
+
+    D3D12_RESOURCE_DESC const resource_desc = {
+        D3D12_RESOURCE_DIMENSION_BUFFER,
+        D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT,
+        size,
+        1U,
+        1U,
+        1U,
+        DXGI_FORMAT_UNKNOWN,
+        {1U, 0U},
+        D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
+        D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS};
+
+    // NOTE: the "serialize" requires the "UNORDERED_ACCESS" state, and the "deserialize" transitions to the "NON_PIXEL_SHADER_RESOURCE" state temporarily
+    HRESULT const hr_create_resource = memory_allocator->CreateResource(&allocation_desc, &resource_desc, D3D12_RESOURCE_STATE_UNORDERED_ACCESS, NULL, &this->m_allocation, IID_PPV_ARGS(&this->m_resource));
+    assert(SUCCEEDED(hr_create_resource));
+    assert(0U == (this->m_resource->GetGPUVirtualAddress() % D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT));
+
+    void *host_memory_range_base = NULL;
+    D3D12_RANGE const read_range = {0U, size};
+    HRESULT const hr_map = this->m_resource->Map(0U, &read_range, &host_memory_range_base);
+    assert(SUCCEEDED(hr_map));
+
+    assert(NULL == this->m_host_memory_range_base);
+    this->m_host_memory_range_base = host_memory_range_base;
+}
+
+void brx_pal_d3d12_serialized_bottom_level_acceleration_structure_buffer::uninit()
+{
+    assert(NULL != this->m_resource);
+    this->m_resource->Release();
+    this->m_resource = NULL;
+
+    assert(NULL != this->m_allocation);
+    this->m_allocation->Release();
+    this->m_allocation = NULL;
+}
+
+brx_pal_d3d12_serialized_bottom_level_acceleration_structure_buffer::~brx_pal_d3d12_serialized_bottom_level_acceleration_structure_buffer()
+{
+    assert(NULL == this->m_resource);
+    assert(NULL == this->m_allocation);
+}
+
+ID3D12Resource *brx_pal_d3d12_serialized_bottom_level_acceleration_structure_buffer::get_resource() const
+{
+    return this->m_resource;
+}
+
+void *brx_pal_d3d12_serialized_bottom_level_acceleration_structure_buffer::get_host_memory_range_base() const
+{
+    return this->m_host_memory_range_base;
+}
+
 brx_pal_d3d12_top_level_acceleration_structure_instance_upload_buffer::brx_pal_d3d12_top_level_acceleration_structure_instance_upload_buffer() : m_resource(NULL), m_allocation(NULL), m_host_memory_range_base(NULL)
 {
 }
@@ -689,28 +868,40 @@ brx_pal_d3d12_top_level_acceleration_structure_instance_upload_buffer::~brx_pal_
 
 void brx_pal_d3d12_top_level_acceleration_structure_instance_upload_buffer::write_instance(uint32_t instance_index, BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE const *wrapped_bottom_top_acceleration_structure_instance)
 {
-    assert(wrapped_bottom_top_acceleration_structure_instance->instance_id < 0X1000000U);
-
-    brx_pal_d3d12_bottom_level_acceleration_structure const *const unwrapped_compacted_bottom_level_acceleration_structure = static_cast<brx_pal_d3d12_bottom_level_acceleration_structure const *>(wrapped_bottom_top_acceleration_structure_instance->bottom_level_acceleration_structure);
-    D3D12_GPU_VIRTUAL_ADDRESS const compacted_bottom_level_acceleration_structure_device_memory_range_base = unwrapped_compacted_bottom_level_acceleration_structure->get_resource()->GetGPUVirtualAddress();
-
-    this->m_host_memory_range_base[instance_index].Transform[0][0] = wrapped_bottom_top_acceleration_structure_instance->transform_matrix[0][0];
-    this->m_host_memory_range_base[instance_index].Transform[0][1] = wrapped_bottom_top_acceleration_structure_instance->transform_matrix[0][1];
-    this->m_host_memory_range_base[instance_index].Transform[0][2] = wrapped_bottom_top_acceleration_structure_instance->transform_matrix[0][2];
-    this->m_host_memory_range_base[instance_index].Transform[0][3] = wrapped_bottom_top_acceleration_structure_instance->transform_matrix[0][3];
-    this->m_host_memory_range_base[instance_index].Transform[1][0] = wrapped_bottom_top_acceleration_structure_instance->transform_matrix[1][0];
-    this->m_host_memory_range_base[instance_index].Transform[1][1] = wrapped_bottom_top_acceleration_structure_instance->transform_matrix[1][1];
-    this->m_host_memory_range_base[instance_index].Transform[1][2] = wrapped_bottom_top_acceleration_structure_instance->transform_matrix[1][2];
-    this->m_host_memory_range_base[instance_index].Transform[1][3] = wrapped_bottom_top_acceleration_structure_instance->transform_matrix[1][3];
-    this->m_host_memory_range_base[instance_index].Transform[2][0] = wrapped_bottom_top_acceleration_structure_instance->transform_matrix[2][0];
-    this->m_host_memory_range_base[instance_index].Transform[2][1] = wrapped_bottom_top_acceleration_structure_instance->transform_matrix[2][1];
-    this->m_host_memory_range_base[instance_index].Transform[2][2] = wrapped_bottom_top_acceleration_structure_instance->transform_matrix[2][2];
-    this->m_host_memory_range_base[instance_index].Transform[2][3] = wrapped_bottom_top_acceleration_structure_instance->transform_matrix[2][3];
-    this->m_host_memory_range_base[instance_index].InstanceID = wrapped_bottom_top_acceleration_structure_instance->instance_id;
-    this->m_host_memory_range_base[instance_index].InstanceMask = wrapped_bottom_top_acceleration_structure_instance->instance_mask;
-    this->m_host_memory_range_base[instance_index].InstanceContributionToHitGroupIndex = 0U;
-    this->m_host_memory_range_base[instance_index].Flags = (wrapped_bottom_top_acceleration_structure_instance->force_closest_hit ? D3D12_RAYTRACING_INSTANCE_FLAG_FORCE_OPAQUE : 0U) | (wrapped_bottom_top_acceleration_structure_instance->force_any_hit ? D3D12_RAYTRACING_INSTANCE_FLAG_FORCE_NON_OPAQUE : 0U) | (wrapped_bottom_top_acceleration_structure_instance->disable_back_face_cull ? D3D12_RAYTRACING_INSTANCE_FLAG_TRIANGLE_CULL_DISABLE : 0U) | (wrapped_bottom_top_acceleration_structure_instance->front_ccw ? D3D12_RAYTRACING_INSTANCE_FLAG_TRIANGLE_FRONT_COUNTERCLOCKWISE : 0U);
-    this->m_host_memory_range_base[instance_index].AccelerationStructure = compacted_bottom_level_acceleration_structure_device_memory_range_base;
+    this->write_instances(instance_index, 1U, wrapped_bottom_top_acceleration_structure_instance);
+}
+
+void brx_pal_d3d12_top_level_acceleration_structure_instance_upload_buffer::write_instances(uint32_t first_instance_index, uint32_t instance_count, BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE const *wrapped_bottom_top_acceleration_structure_instances)
+{
+    static_assert(sizeof(D3D12_RAYTRACING_INSTANCE_DESC) == sizeof(BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_DEVICE_INSTANCE), "");
+    static_assert(static_cast<uint32_t>(BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE_FLAG_TRIANGLE_CULL_DISABLE) == static_cast<uint32_t>(D3D12_RAYTRACING_INSTANCE_FLAG_TRIANGLE_CULL_DISABLE), "");
+    static_assert(static_cast<uint32_t>(BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE_FLAG_TRIANGLE_FRONT_COUNTERCLOCKWISE) == static_cast<uint32_t>(D3D12_RAYTRACING_INSTANCE_FLAG_TRIANGLE_FRONT_COUNTERCLOCKWISE), "");
+    static_assert(static_cast<uint32_t>(BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE_FLAG_FORCE_OPAQUE) == static_cast<uint32_t>(D3D12_RAYTRACING_INSTANCE_FLAG_FORCE_OPAQUE), "");
+    static_assert(static_cast<uint32_t>(BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE_FLAG_FORCE_NON_OPAQUE) == static_cast<uint32_t>(D3D12_RAYTRACING_INSTANCE_FLAG_FORCE_NON_OPAQUE), "");
+
+    assert((NULL != wrapped_bottom_top_acceleration_structure_instances) || (0U == instance_count));
+
+    BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_DEVICE_INSTANCE *const destination_instances = reinterpret_cast<BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_DEVICE_INSTANCE *>(this->m_host_memory_range_base + first_instance_index);
+
+    // the consecutive instances usually share the same bottom level acceleration structure, and the device memory range base is NOT queried again
+    brx_pal_bottom_level_acceleration_structure const *cached_bottom_level_acceleration_structure = NULL;
+    D3D12_GPU_VIRTUAL_ADDRESS cached_bottom_level_acceleration_structure_device_memory_range_base = 0U;
+
+    for (uint32_t instance_index = 0U; instance_index < instance_count; ++instance_index)
+    {
+        brx_pal_bottom_level_acceleration_structure const *const wrapped_bottom_level_acceleration_structure = wrapped_bottom_top_acceleration_structure_instances[instance_index].bottom_level_acceleration_structure;
+        if (cached_bottom_level_acceleration_structure != wrapped_bottom_level_acceleration_structure)
+        {
+            assert(NULL != wrapped_bottom_level_acceleration_structure);
+            brx_pal_d3d12_bottom_level_acceleration_structure const *const unwrapped_bottom_level_acceleration_structure = static_cast<brx_pal_d3d12_bottom_level_acceleration_structure const *>(wrapped_bottom_level_acceleration_structure);
+            cached_bottom_level_acceleration_structure = wrapped_bottom_level_acceleration_structure;
+            cached_bottom_level_acceleration_structure_device_memory_range_base = unwrapped_bottom_level_acceleration_structure->get_resource()->GetGPUVirtualAddress();
+        }
+
+        brx_pal_stream_top_level_acceleration_structure_instance(destination_instances + instance_index, wrapped_bottom_top_acceleration_structure_instances + instance_index, cached_bottom_level_acceleration_structure_device_memory_range_base);
+    }
+
+    brx_pal_stream_top_level_acceleration_structure_instance_fence();
 }
 
 ID3D12Resource *brx_pal_d3d12_top_level_acceleration_structure_instance_upload_buffer::get_resource() const
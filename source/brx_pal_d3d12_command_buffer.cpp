@@ -23,23 +23,38 @@
 #include <pix.h>
 #endif
 
+static constexpr uint32_t const INITIAL_CLEAR_UNORDERED_ACCESS_VIEW_DESCRIPTOR_CAPACITY = 64U;
+
+static inline void _internal_resolve_render_targets(ID3D12GraphicsCommandList *command_list, uint32_t resolve_count, ID3D12Resource *const *source_resources, ID3D12Resource *const *destination_resources, D3D12_RESOURCE_STATES const *destination_states);
+
+static inline void _internal_transition_storage_resources(ID3D12GraphicsCommandList *command_list, uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *wrapped_storage_buffers, uint32_t storage_image_count, brx_pal_storage_image const *const *wrapped_storage_images, D3D12_RESOURCE_STATES state_before, D3D12_RESOURCE_STATES state_after);
+
 brx_pal_d3d12_graphics_command_buffer::brx_pal_d3d12_graphics_command_buffer()
     : m_command_allocator(NULL),
       m_command_list(NULL),
+      m_mesh_shader_command_list(NULL),
+      m_draw_mesh_tasks_indirect_command_signature(NULL),
       m_descriptor_allocator(NULL),
+      m_device(NULL),
+      m_clear_unordered_access_view_shader_visible_descriptor_heap(NULL),
+      m_clear_unordered_access_view_non_shader_visible_descriptor_heap(NULL),
+      m_clear_unordered_access_view_descriptor_increment_size(0U),
+      m_clear_unordered_access_view_descriptor_capacity(0U),
+      m_clear_unordered_access_view_descriptor_count(0U),
       m_current_render_pass(NULL),
-      m_current_frame_buffer(NULL)
+      m_current_frame_buffer(NULL),
+      m_current_rendering(false)
 {
 }
 
-void brx_pal_d3d12_graphics_command_buffer::init(ID3D12Device *device, bool uma, bool support_ray_tracing, brx_pal_d3d12_descriptor_allocator *descriptor_allocator)
+void brx_pal_d3d12_graphics_command_buffer::init(ID3D12Device *device, D3D12_COMMAND_LIST_TYPE command_list_type, bool uma, bool support_ray_tracing, ID3D12CommandSignature *draw_mesh_tasks_indirect_command_signature, brx_pal_d3d12_descriptor_allocator *descriptor_allocator)
 {
     assert(NULL == this->m_command_allocator);
-    HRESULT const hr_create_command_allocator = device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&this->m_command_allocator));
+    HRESULT const hr_create_command_allocator = device->CreateCommandAllocator(command_list_type, IID_PPV_ARGS(&this->m_command_allocator));
     assert(SUCCEEDED(hr_create_command_allocator));
 
     assert(NULL == this->m_command_list);
-    HRESULT const hr_create_command_list = device->CreateCommandList(0U, D3D12_COMMAND_LIST_TYPE_DIRECT, this->m_command_allocator, NULL, IID_PPV_ARGS(&this->m_command_list));
+    HRESULT const hr_create_command_list = device->CreateCommandList(0U, command_list_type, this->m_command_allocator, NULL, IID_PPV_ARGS(&this->m_command_list));
     assert(SUCCEEDED(hr_create_command_list));
 
     HRESULT const hr_close = this->m_command_list->Close();
@@ -49,18 +64,71 @@ void brx_pal_d3d12_graphics_command_buffer::init(ID3D12Device *device, bool uma,
 
     this->m_support_ray_tracing = support_ray_tracing;
 
+    // the command signature is only created by the device when the mesh shader is supported
+    assert(NULL == this->m_mesh_shader_command_list);
+    assert(NULL == this->m_draw_mesh_tasks_indirect_command_signature);
+    if (NULL != draw_mesh_tasks_indirect_command_signature)
+    {
+        HRESULT const hr_query_interface = this->m_command_list->QueryInterface(IID_PPV_ARGS(&this->m_mesh_shader_command_list));
+        assert(SUCCEEDED(hr_query_interface));
+
+        this->m_draw_mesh_tasks_indirect_command_signature = draw_mesh_tasks_indirect_command_signature;
+    }
+
     assert(NULL == this->m_descriptor_allocator);
     this->m_descriptor_allocator = descriptor_allocator;
 
+    assert(NULL == this->m_device);
+    this->m_device = device;
+
+    // "fill_buffer" and "clear_storage_image"
+    this->m_clear_unordered_access_view_descriptor_increment_size = device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+
+    this->create_clear_unordered_access_view_descriptor_heaps(INITIAL_CLEAR_UNORDERED_ACCESS_VIEW_DESCRIPTOR_CAPACITY);
+
+    assert(0U == this->m_retired_clear_unordered_access_view_descriptor_heaps.size());
+
     assert(NULL == this->m_current_render_pass);
 
     assert(NULL == this->m_current_frame_buffer);
 
+    assert(!this->m_current_rendering);
+
+    assert(0U == this->m_current_rendering_store_barriers.size());
+
+    assert(0U == this->m_current_rendering_resolve_source_resources.size());
+
+    assert(0U == this->m_current_rendering_resolve_destination_resources.size());
+
+    assert(0U == this->m_current_rendering_resolve_destination_states.size());
+
     assert(0U == this->m_current_vertex_buffer_strides.size());
 }
 
 void brx_pal_d3d12_graphics_command_buffer::uninit()
 {
+    for (ID3D12DescriptorHeap *const retired_descriptor_heap : this->m_retired_clear_unordered_access_view_descriptor_heaps)
+    {
+        retired_descriptor_heap->Release();
+    }
+    this->m_retired_clear_unordered_access_view_descriptor_heaps.clear();
+
+    assert(NULL != this->m_clear_unordered_access_view_non_shader_visible_descriptor_heap);
+    this->m_clear_unordered_access_view_non_shader_visible_descriptor_heap->Release();
+    this->m_clear_unordered_access_view_non_shader_visible_descriptor_heap = NULL;
+
+    assert(NULL != this->m_clear_unordered_access_view_shader_visible_descriptor_heap);
+    this->m_clear_unordered_access_view_shader_visible_descriptor_heap->Release();
+    this->m_clear_unordered_access_view_shader_visible_descriptor_heap = NULL;
+
+    if (NULL != this->m_mesh_shader_command_list)
+    {
+        this->m_mesh_shader_command_list->Release();
+        this->m_mesh_shader_command_list = NULL;
+    }
+
+    this->m_draw_mesh_tasks_indirect_command_signature = NULL;
+
     assert(NULL != this->m_command_list);
     this->m_command_list->Release();
     this->m_command_list = NULL;
@@ -74,6 +142,58 @@ brx_pal_d3d12_graphics_command_buffer::~brx_pal_d3d12_graphics_command_buffer()
 {
     assert(NULL == this->m_command_allocator);
     assert(NULL == this->m_command_list);
+    assert(NULL == this->m_mesh_shader_command_list);
+    assert(NULL == this->m_draw_mesh_tasks_indirect_command_signature);
+    assert(NULL == this->m_clear_unordered_access_view_shader_visible_descriptor_heap);
+    assert(NULL == this->m_clear_unordered_access_view_non_shader_visible_descriptor_heap);
+    assert(0U == this->m_retired_clear_unordered_access_view_descriptor_heaps.size());
+}
+
+void brx_pal_d3d12_graphics_command_buffer::create_clear_unordered_access_view_descriptor_heaps(uint32_t descriptor_capacity)
+{
+    D3D12_DESCRIPTOR_HEAP_DESC const shader_visible_descriptor_heap_desc = {
+        D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV,
+        descriptor_capacity,
+        D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE,
+        0U};
+
+    assert(NULL == this->m_clear_unordered_access_view_shader_visible_descriptor_heap);
+    HRESULT const hr_create_shader_visible_descriptor_heap = this->m_device->CreateDescriptorHeap(&shader_visible_descriptor_heap_desc, IID_PPV_ARGS(&this->m_clear_unordered_access_view_shader_visible_descriptor_heap));
+    assert(SUCCEEDED(hr_create_shader_visible_descriptor_heap));
+
+    D3D12_DESCRIPTOR_HEAP_DESC const non_shader_visible_descriptor_heap_desc = {
+        D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV,
+        descriptor_capacity,
+        D3D12_DESCRIPTOR_HEAP_FLAG_NONE,
+        0U};
+
+    assert(NULL == this->m_clear_unordered_access_view_non_shader_visible_descriptor_heap);
+    HRESULT const hr_create_non_shader_visible_descriptor_heap = this->m_device->CreateDescriptorHeap(&non_shader_visible_descriptor_heap_desc, IID_PPV_ARGS(&this->m_clear_unordered_access_view_non_shader_visible_descriptor_heap));
+    assert(SUCCEEDED(hr_create_non_shader_visible_descriptor_heap));
+
+    this->m_clear_unordered_access_view_descriptor_capacity = descriptor_capacity;
+    this->m_clear_unordered_access_view_descriptor_count = 0U;
+}
+
+uint32_t brx_pal_d3d12_graphics_command_buffer::allocate_clear_unordered_access_view_descriptor()
+{
+    if (this->m_clear_unordered_access_view_descriptor_count >= this->m_clear_unordered_access_view_descriptor_capacity)
+    {
+        // the full heaps are retired rather than copied, and the new heaps are twice as large
+        this->m_retired_clear_unordered_access_view_descriptor_heaps.push_back(this->m_clear_unordered_access_view_shader_visible_descriptor_heap);
+        this->m_clear_unordered_access_view_shader_visible_descriptor_heap = NULL;
+
+        this->m_retired_clear_unordered_access_view_descriptor_heaps.push_back(this->m_clear_unordered_access_view_non_shader_visible_descriptor_heap);
+        this->m_clear_unordered_access_view_non_shader_visible_descriptor_heap = NULL;
+
+        this->create_clear_unordered_access_view_descriptor_heaps(this->m_clear_unordered_access_view_descriptor_capacity * 2U);
+    }
+
+    assert(this->m_clear_unordered_access_view_descriptor_count < this->m_clear_unordered_access_view_descriptor_capacity);
+    uint32_t const descriptor_index = this->m_clear_unordered_access_view_descriptor_count;
+    ++this->m_clear_unordered_access_view_descriptor_count;
+
+    return descriptor_index;
 }
 
 ID3D12CommandAllocator *brx_pal_d3d12_graphics_command_buffer::get_command_allocator() const
@@ -92,6 +212,15 @@ void brx_pal_d3d12_graphics_command_buffer::begin()
     assert(SUCCEEDED(hr_reset));
 
     this->m_current_vertex_buffer_strides.clear();
+
+    // the previous submission has completed since the command allocator has been reset
+    for (ID3D12DescriptorHeap *const retired_descriptor_heap : this->m_retired_clear_unordered_access_view_descriptor_heaps)
+    {
+        retired_descriptor_heap->Release();
+    }
+    this->m_retired_clear_unordered_access_view_descriptor_heaps.clear();
+
+    this->m_clear_unordered_access_view_descriptor_count = 0U;
 }
 
 void brx_pal_d3d12_graphics_command_buffer::acquire(uint32_t storage_asset_buffer_count, brx_pal_storage_asset_buffer const *const *wrapped_storage_asset_buffers, uint32_t sampled_asset_image_subresource_count, BRX_PAL_SAMPLED_ASSET_IMAGE_SUBRESOURCE const *wrapped_sampled_asset_image_subresources, uint32_t compacted_bottom_level_acceleration_structure_count, brx_pal_compacted_bottom_level_acceleration_structure const *const *wrapped_compacted_bottom_level_acceleration_structures)
@@ -109,7 +238,7 @@ void brx_pal_d3d12_graphics_command_buffer::acquire(uint32_t storage_asset_buffe
                 storage_asset_buffer_resource,
                 0U,
                 D3D12_RESOURCE_STATE_COMMON,
-                D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE}};
+                D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER | D3D12_RESOURCE_STATE_INDEX_BUFFER}};
     }
 
     for (uint32_t sampled_asset_image_subresource_index = 0U; sampled_asset_image_subresource_index < sampled_asset_image_subresource_count; ++sampled_asset_image_subresource_index)
@@ -203,51 +332,61 @@ void brx_pal_d3d12_graphics_command_buffer::begin_render_pass(brx_pal_render_pas
     // https://microsoft.github.io/DirectX-Specs/d3d/D3D12EnhancedBarriers.html
     // D3D12_BARRIER_LAYOUT_UNDEFINED
 
-    mcrt_vector<D3D12_RESOURCE_BARRIER> load_barriers(static_cast<size_t>(color_attachment_flush_for_sampled_image_count + color_attachment_flush_for_present_count + (depth_stencil_attachment_flush_for_sampled_image ? 1U : 0U)));
+    // the multisample render targets always stay in the "D3D12_RESOURCE_STATE_RENDER_TARGET" state, and only the resolve resources are transitioned at the end of the render pass
+    ID3D12Resource *const *resolve_resources = this->m_current_frame_buffer->get_resolve_resources();
+    assert((NULL == resolve_resources) || (!depth_stencil_attachment_flush_for_sampled_image));
 
-    for (uint32_t flush_for_sampled_image_index = 0U; flush_for_sampled_image_index < color_attachment_flush_for_sampled_image_count; ++flush_for_sampled_image_index)
+    if (NULL == resolve_resources)
     {
-        uint32_t const color_attachment_flush_for_sampled_image_index = color_attachment_flush_for_sampled_image_indices[flush_for_sampled_image_index];
-        ID3D12Resource *const render_target_resource = render_target_resources[color_attachment_flush_for_sampled_image_index];
+        mcrt_vector<D3D12_RESOURCE_BARRIER> load_barriers(static_cast<size_t>(color_attachment_flush_for_sampled_image_count + color_attachment_flush_for_present_count + (depth_stencil_attachment_flush_for_sampled_image ? 1U : 0U)));
 
-        load_barriers[flush_for_sampled_image_index] = D3D12_RESOURCE_BARRIER{
-            .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
-            .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
-            .Transition = {
-                render_target_resource,
-                0U,
-                D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
-                D3D12_RESOURCE_STATE_RENDER_TARGET}};
-    }
+        for (uint32_t flush_for_sampled_image_index = 0U; flush_for_sampled_image_index < color_attachment_flush_for_sampled_image_count; ++flush_for_sampled_image_index)
+        {
+            uint32_t const color_attachment_flush_for_sampled_image_index = color_attachment_flush_for_sampled_image_indices[flush_for_sampled_image_index];
+            ID3D12Resource *const render_target_resource = render_target_resources[color_attachment_flush_for_sampled_image_index];
 
-    for (uint32_t flush_for_present_index = 0U; flush_for_present_index < color_attachment_flush_for_present_count; ++flush_for_present_index)
-    {
-        uint32_t const color_attachment_flush_for_present_index = color_attachment_flush_for_present_indices[flush_for_present_index];
-        ID3D12Resource *const render_target_resource = render_target_resources[color_attachment_flush_for_present_index];
+            load_barriers[flush_for_sampled_image_index] = D3D12_RESOURCE_BARRIER{
+                .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+                .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+                .Transition = {
+                    render_target_resource,
+                    0U,
+                    D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+                    D3D12_RESOURCE_STATE_RENDER_TARGET}};
+        }
 
-        load_barriers[color_attachment_flush_for_sampled_image_count + flush_for_present_index] = D3D12_RESOURCE_BARRIER{
-            .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
-            .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
-            .Transition = {
-                render_target_resource,
-                0U,
-                D3D12_RESOURCE_STATE_PRESENT,
-                D3D12_RESOURCE_STATE_RENDER_TARGET}};
-    }
+        for (uint32_t flush_for_present_index = 0U; flush_for_present_index < color_attachment_flush_for_present_count; ++flush_for_present_index)
+        {
+            uint32_t const color_attachment_flush_for_present_index = color_attachment_flush_for_present_indices[flush_for_present_index];
+            ID3D12Resource *const render_target_resource = render_target_resources[color_attachment_flush_for_present_index];
 
-    if (depth_stencil_attachment_flush_for_sampled_image)
-    {
-        load_barriers[color_attachment_flush_for_sampled_image_count + color_attachment_flush_for_present_count] = D3D12_RESOURCE_BARRIER{
-            .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
-            .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
-            .Transition = {
-                depth_stencil_resource,
-                0U,
-                D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
-                D3D12_RESOURCE_STATE_DEPTH_WRITE}};
-    }
+            load_barriers[color_attachment_flush_for_sampled_image_count + flush_for_present_index] = D3D12_RESOURCE_BARRIER{
+                .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+                .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+                .Transition = {
+                    render_target_resource,
+                    0U,
+                    D3D12_RESOURCE_STATE_PRESENT,
+                    D3D12_RESOURCE_STATE_RENDER_TARGET}};
+        }
 
-    this->m_command_list->ResourceBarrier(static_cast<UINT>(load_barriers.size()), &load_barriers[0]);
+        if (depth_stencil_attachment_flush_for_sampled_image)
+        {
+            load_barriers[color_attachment_flush_for_sampled_image_count + color_attachment_flush_for_present_count] = D3D12_RESOURCE_BARRIER{
+                .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+                .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+                .Transition = {
+                    depth_stencil_resource,
+                    0U,
+                    D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+                    D3D12_RESOURCE_STATE_DEPTH_WRITE}};
+        }
+
+        if (load_barriers.size() > 0U)
+        {
+            this->m_command_list->ResourceBarrier(static_cast<UINT>(load_barriers.size()), &load_barriers[0]);
+        }
+    }
 #endif
 
     for (uint32_t clear_index = 0U; clear_index < color_clear_value_count; ++clear_index)
@@ -294,6 +433,13 @@ void brx_pal_d3d12_graphics_command_buffer::begin_render_pass(brx_pal_render_pas
     }
 
     this->m_command_list->OMSetRenderTargets(num_render_targets, render_target_view_descriptors, FALSE, depth_stencil_view_descriptor);
+
+    uint32_t const view_count = this->m_current_render_pass->get_view_count();
+    if (view_count > 1U)
+    {
+        // the view instance mask is ignored by the pipeline without the view instancing
+        this->m_command_list->SetViewInstanceMask((1U << view_count) - 1U);
+    }
 }
 
 void brx_pal_d3d12_graphics_command_buffer::bind_graphics_pipeline(brx_pal_graphics_pipeline const *wrapped_graphics_pipeline)
@@ -307,6 +453,14 @@ void brx_pal_d3d12_graphics_command_buffer::bind_graphics_pipeline(brx_pal_graph
     this->m_command_list->IASetPrimitiveTopology(primitive_topology);
 
     this->m_command_list->SetPipelineState(graphics_pipeline);
+
+    uint32_t const vertex_binding_count = unwrapped_graphics_pipeline->get_vertex_binding_count();
+    uint32_t const *const vertex_binding_strides = unwrapped_graphics_pipeline->get_vertex_binding_strides();
+    this->m_current_vertex_buffer_strides.resize(static_cast<size_t>(vertex_binding_count));
+    for (uint32_t vertex_binding_index = 0U; vertex_binding_index < vertex_binding_count; ++vertex_binding_index)
+    {
+        this->m_current_vertex_buffer_strides[vertex_binding_index] = vertex_binding_strides[vertex_binding_index];
+    }
 }
 
 void brx_pal_d3d12_graphics_command_buffer::set_view_port(uint32_t width, uint32_t height)
@@ -321,6 +475,21 @@ void brx_pal_d3d12_graphics_command_buffer::set_scissor(int32_t offset_width, in
     this->m_command_list->RSSetScissorRects(1U, &rect);
 }
 
+void brx_pal_d3d12_graphics_command_buffer::set_cull_mode(bool enable_back_face_cull, bool front_ccw)
+{
+    assert(false);
+}
+
+void brx_pal_d3d12_graphics_command_buffer::set_depth_compare_operation(BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation)
+{
+    assert(false);
+}
+
+void brx_pal_d3d12_graphics_command_buffer::set_blend_operation(BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation)
+{
+    assert(false);
+}
+
 void brx_pal_d3d12_graphics_command_buffer::bind_graphics_descriptor_sets(brx_pal_pipeline_layout const *wrapped_pipeline_layout, uint32_t descriptor_set_count, brx_pal_descriptor_set const *const *wrapped_descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets)
 {
     assert(NULL != wrapped_pipeline_layout);
@@ -433,11 +602,198 @@ void brx_pal_d3d12_graphics_command_buffer::bind_graphics_descriptor_sets(brx_pa
     assert(dynamic_offset_index == dynamic_offet_count);
 }
 
+void brx_pal_d3d12_graphics_command_buffer::push_graphics_constants(brx_pal_pipeline_layout const *wrapped_pipeline_layout, uint32_t offset, uint32_t size, void const *constants)
+{
+    assert(NULL != wrapped_pipeline_layout);
+    assert(NULL != constants);
+    assert(0U == (offset & 3U));
+    assert(0U == (size & 3U));
+    assert((offset + size) <= BRX_PAL_MAX_PUSH_CONSTANT_SIZE);
+
+    uint32_t const root_parameter_index = static_cast<brx_pal_d3d12_pipeline_layout const *>(wrapped_pipeline_layout)->get_root_constants_root_parameter_index();
+    assert(static_cast<uint32_t>(-1) != root_parameter_index);
+
+    this->m_command_list->SetGraphicsRoot32BitConstants(root_parameter_index, (size >> 2U), constants, (offset >> 2U));
+}
+
 void brx_pal_d3d12_graphics_command_buffer::draw(uint32_t vertex_count, uint32_t instance_count, uint32_t first_vertex, uint32_t first_instance)
 {
     this->m_command_list->DrawInstanced(vertex_count, instance_count, first_vertex, first_instance);
 }
 
+void brx_pal_d3d12_graphics_command_buffer::bind_vertex_buffers(uint32_t first_binding, uint32_t binding_count, brx_pal_storage_asset_buffer const *const *wrapped_vertex_buffers, uint64_t const *offsets)
+{
+    assert(NULL != wrapped_vertex_buffers);
+    assert(NULL != offsets);
+
+    constexpr uint32_t const max_vertex_binding_count = 16U;
+    assert(binding_count <= max_vertex_binding_count);
+    binding_count = (binding_count < max_vertex_binding_count) ? binding_count : max_vertex_binding_count;
+
+    D3D12_VERTEX_BUFFER_VIEW vertex_buffer_views[max_vertex_binding_count];
+    for (uint32_t binding_index = 0U; binding_index < binding_count; ++binding_index)
+    {
+        assert(NULL != wrapped_vertex_buffers[binding_index]);
+        ID3D12Resource *const vertex_buffer_resource = static_cast<brx_pal_d3d12_storage_asset_buffer const *>(wrapped_vertex_buffers[binding_index])->get_resource();
+
+        UINT64 const vertex_buffer_size = vertex_buffer_resource->GetDesc().Width;
+        assert(offsets[binding_index] <= vertex_buffer_size);
+
+        // the stride is provided by the "bind_graphics_pipeline"
+        assert((first_binding + binding_index) < this->m_current_vertex_buffer_strides.size());
+
+        vertex_buffer_views[binding_index] = D3D12_VERTEX_BUFFER_VIEW{
+            vertex_buffer_resource->GetGPUVirtualAddress() + offsets[binding_index],
+            static_cast<UINT>(vertex_buffer_size - offsets[binding_index]),
+            this->m_current_vertex_buffer_strides[first_binding + binding_index]};
+    }
+
+    this->m_command_list->IASetVertexBuffers(first_binding, binding_count, vertex_buffer_views);
+}
+
+void brx_pal_d3d12_graphics_command_buffer::bind_index_buffer(brx_pal_storage_asset_buffer const *wrapped_index_buffer, uint64_t offset, BRX_PAL_GRAPHICS_PIPELINE_INDEX_TYPE wrapped_index_type)
+{
+    assert(NULL != wrapped_index_buffer);
+    ID3D12Resource *const index_buffer_resource = static_cast<brx_pal_d3d12_storage_asset_buffer const *>(wrapped_index_buffer)->get_resource();
+
+    UINT64 const index_buffer_size = index_buffer_resource->GetDesc().Width;
+    assert(offset <= index_buffer_size);
+
+    DXGI_FORMAT index_format;
+    switch (wrapped_index_type)
+    {
+    case BRX_PAL_GRAPHICS_PIPELINE_INDEX_TYPE_UINT32:
+        index_format = DXGI_FORMAT_R32_UINT;
+        break;
+    case BRX_PAL_GRAPHICS_PIPELINE_INDEX_TYPE_UINT16:
+        index_format = DXGI_FORMAT_R16_UINT;
+        break;
+    default:
+        // the "BRX_PAL_GRAPHICS_PIPELINE_INDEX_TYPE_NONE" is only used by the acceleration structure
+        assert(false);
+        index_format = DXGI_FORMAT_UNKNOWN;
+    }
+
+    D3D12_INDEX_BUFFER_VIEW const index_buffer_view = {
+        index_buffer_resource->GetGPUVirtualAddress() + offset,
+        static_cast<UINT>(index_buffer_size - offset),
+        index_format};
+
+    this->m_command_list->IASetIndexBuffer(&index_buffer_view);
+}
+
+void brx_pal_d3d12_graphics_command_buffer::draw_indexed(uint32_t index_count, uint32_t instance_count, uint32_t first_index, int32_t vertex_offset, uint32_t first_instance)
+{
+    this->m_command_list->DrawIndexedInstanced(index_count, instance_count, first_index, vertex_offset, first_instance);
+}
+
+void brx_pal_d3d12_graphics_command_buffer::draw_mesh_tasks(uint32_t group_count_x, uint32_t group_count_y, uint32_t group_count_z)
+{
+    assert(NULL != this->m_mesh_shader_command_list);
+    this->m_mesh_shader_command_list->DispatchMesh(group_count_x, group_count_y, group_count_z);
+}
+
+void brx_pal_d3d12_graphics_command_buffer::draw_mesh_tasks_indirect(brx_pal_storage_buffer const *wrapped_argument_buffer, uint64_t argument_offset, uint32_t draw_count)
+{
+    assert(NULL != this->m_mesh_shader_command_list);
+    assert(NULL != this->m_draw_mesh_tasks_indirect_command_signature);
+
+    assert(NULL != wrapped_argument_buffer);
+    ID3D12Resource *const argument_buffer_resource = static_cast<brx_pal_d3d12_storage_buffer const *>(wrapped_argument_buffer)->get_resource();
+
+    // the render targets are bound by the "OMSetRenderTargets" rather than the "BeginRenderPass", and the barriers are allowed between the draw calls
+    {
+        D3D12_RESOURCE_BARRIER const load_barrier =
+            D3D12_RESOURCE_BARRIER{
+                .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+                .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+                .Transition = {
+                    argument_buffer_resource,
+                    0U,
+                    D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+                    D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT}};
+
+        this->m_command_list->ResourceBarrier(1U, &load_barrier);
+    }
+
+    this->m_command_list->ExecuteIndirect(this->m_draw_mesh_tasks_indirect_command_signature, draw_count, argument_buffer_resource, argument_offset, NULL, 0U);
+
+    {
+        D3D12_RESOURCE_BARRIER const store_barrier =
+            D3D12_RESOURCE_BARRIER{
+                .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+                .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+                .Transition = {
+                    argument_buffer_resource,
+                    0U,
+                    D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT,
+                    D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE}};
+
+        this->m_command_list->ResourceBarrier(1U, &store_barrier);
+    }
+}
+
+void brx_pal_d3d12_graphics_command_buffer::draw_mesh_tasks_indirect_count(brx_pal_storage_buffer const *wrapped_argument_buffer, uint64_t argument_offset, brx_pal_storage_buffer const *wrapped_count_buffer, uint64_t count_offset, uint32_t max_draw_count)
+{
+    assert(NULL != this->m_mesh_shader_command_list);
+    assert(NULL != this->m_draw_mesh_tasks_indirect_command_signature);
+
+    assert(NULL != wrapped_argument_buffer);
+    ID3D12Resource *const argument_buffer_resource = static_cast<brx_pal_d3d12_storage_buffer const *>(wrapped_argument_buffer)->get_resource();
+
+    assert(NULL != wrapped_count_buffer);
+    ID3D12Resource *const count_buffer_resource = static_cast<brx_pal_d3d12_storage_buffer const *>(wrapped_count_buffer)->get_resource();
+
+    // the arguments and the count may be stored in the same buffer
+    UINT const barrier_count = (argument_buffer_resource != count_buffer_resource) ? 2U : 1U;
+
+    {
+        D3D12_RESOURCE_BARRIER const load_barriers[2] = {
+            D3D12_RESOURCE_BARRIER{
+                .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+                .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+                .Transition = {
+                    argument_buffer_resource,
+                    0U,
+                    D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+                    D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT}},
+            D3D12_RESOURCE_BARRIER{
+                .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+                .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+                .Transition = {
+                    count_buffer_resource,
+                    0U,
+                    D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+                    D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT}}};
+
+        this->m_command_list->ResourceBarrier(barrier_count, load_barriers);
+    }
+
+    this->m_command_list->ExecuteIndirect(this->m_draw_mesh_tasks_indirect_command_signature, max_draw_count, argument_buffer_resource, argument_offset, count_buffer_resource, count_offset);
+
+    {
+        D3D12_RESOURCE_BARRIER const store_barriers[2] = {
+            D3D12_RESOURCE_BARRIER{
+                .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+                .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+                .Transition = {
+                    argument_buffer_resource,
+                    0U,
+                    D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT,
+                    D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE}},
+            D3D12_RESOURCE_BARRIER{
+                .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+                .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+                .Transition = {
+                    count_buffer_resource,
+                    0U,
+                    D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT,
+                    D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE}}};
+
+        this->m_command_list->ResourceBarrier(barrier_count, store_barriers);
+    }
+}
+
 void brx_pal_d3d12_graphics_command_buffer::end_render_pass()
 {
     assert(NULL != this->m_current_render_pass);
@@ -460,54 +816,323 @@ void brx_pal_d3d12_graphics_command_buffer::end_render_pass()
     assert((!depth_stencil_attachment_flush_for_sampled_image) || (NULL != depth_stencil_resource));
     assert((!depth_stencil_attachment_flush_for_sampled_image) || (NULL != depth_stencil_view_descriptor));
 
-    mcrt_vector<D3D12_RESOURCE_BARRIER> store_barriers(static_cast<size_t>(color_attachment_flush_for_sampled_image_count + color_attachment_flush_for_present_count + (depth_stencil_attachment_flush_for_sampled_image ? 1U : 0U)));
+    ID3D12Resource *const *resolve_resources = this->m_current_frame_buffer->get_resolve_resources();
 
-    for (uint32_t flush_for_sampled_image_index = 0U; flush_for_sampled_image_index < color_attachment_flush_for_sampled_image_count; ++flush_for_sampled_image_index)
+    if (NULL == resolve_resources)
     {
-        uint32_t const color_attachment_flush_for_sampled_image_index = color_attachment_flush_for_sampled_image_indices[flush_for_sampled_image_index];
-        ID3D12Resource *const render_target_resource = render_target_resources[color_attachment_flush_for_sampled_image_index];
+        mcrt_vector<D3D12_RESOURCE_BARRIER> store_barriers(static_cast<size_t>(color_attachment_flush_for_sampled_image_count + color_attachment_flush_for_present_count + (depth_stencil_attachment_flush_for_sampled_image ? 1U : 0U)));
 
-        store_barriers[flush_for_sampled_image_index] = D3D12_RESOURCE_BARRIER{
-            .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
-            .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
-            .Transition = {
-                render_target_resource,
-                0U,
-                D3D12_RESOURCE_STATE_RENDER_TARGET,
-                D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE}};
+        for (uint32_t flush_for_sampled_image_index = 0U; flush_for_sampled_image_index < color_attachment_flush_for_sampled_image_count; ++flush_for_sampled_image_index)
+        {
+            uint32_t const color_attachment_flush_for_sampled_image_index = color_attachment_flush_for_sampled_image_indices[flush_for_sampled_image_index];
+            ID3D12Resource *const render_target_resource = render_target_resources[color_attachment_flush_for_sampled_image_index];
+
+            store_barriers[flush_for_sampled_image_index] = D3D12_RESOURCE_BARRIER{
+                .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+                .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+                .Transition = {
+                    render_target_resource,
+                    0U,
+                    D3D12_RESOURCE_STATE_RENDER_TARGET,
+                    D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE}};
+        }
+
+        for (uint32_t flush_for_present_index = 0U; flush_for_present_index < color_attachment_flush_for_present_count; ++flush_for_present_index)
+        {
+            uint32_t const color_attachment_flush_for_present_index = color_attachment_flush_for_present_indices[flush_for_present_index];
+            ID3D12Resource *const render_target_resource = render_target_resources[color_attachment_flush_for_present_index];
+
+            store_barriers[color_attachment_flush_for_sampled_image_count + flush_for_present_index] = D3D12_RESOURCE_BARRIER{
+                .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+                .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+                .Transition = {
+                    render_target_resource,
+                    0U,
+                    D3D12_RESOURCE_STATE_RENDER_TARGET,
+                    D3D12_RESOURCE_STATE_PRESENT}};
+        }
+
+        if (depth_stencil_attachment_flush_for_sampled_image)
+        {
+            store_barriers[color_attachment_flush_for_sampled_image_count + color_attachment_flush_for_present_count] = D3D12_RESOURCE_BARRIER{
+                .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+                .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+                .Transition = {
+                    depth_stencil_resource,
+                    0U,
+                    D3D12_RESOURCE_STATE_DEPTH_WRITE,
+                    D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE}};
+        }
+
+        if (store_barriers.size() > 0U)
+        {
+            this->m_command_list->ResourceBarrier(static_cast<UINT>(store_barriers.size()), &store_barriers[0]);
+        }
+    }
+    else
+    {
+        // the multisample depth stencil attachment is NOT resolved
+        assert(!depth_stencil_attachment_flush_for_sampled_image);
+
+        mcrt_vector<ID3D12Resource *> resolve_source_resources;
+        mcrt_vector<ID3D12Resource *> resolve_destination_resources;
+        mcrt_vector<D3D12_RESOURCE_STATES> resolve_destination_states;
+
+        for (uint32_t flush_for_sampled_image_index = 0U; flush_for_sampled_image_index < color_attachment_flush_for_sampled_image_count; ++flush_for_sampled_image_index)
+        {
+            uint32_t const color_attachment_flush_for_sampled_image_index = color_attachment_flush_for_sampled_image_indices[flush_for_sampled_image_index];
+            assert(NULL != resolve_resources[color_attachment_flush_for_sampled_image_index]);
+
+            resolve_source_resources.push_back(render_target_resources[color_attachment_flush_for_sampled_image_index]);
+            resolve_destination_resources.push_back(resolve_resources[color_attachment_flush_for_sampled_image_index]);
+            resolve_destination_states.push_back(D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+        }
+
+        for (uint32_t flush_for_present_index = 0U; flush_for_present_index < color_attachment_flush_for_present_count; ++flush_for_present_index)
+        {
+            uint32_t const color_attachment_flush_for_present_index = color_attachment_flush_for_present_indices[flush_for_present_index];
+            assert(NULL != resolve_resources[color_attachment_flush_for_present_index]);
+
+            resolve_source_resources.push_back(render_target_resources[color_attachment_flush_for_present_index]);
+            resolve_destination_resources.push_back(resolve_resources[color_attachment_flush_for_present_index]);
+            resolve_destination_states.push_back(D3D12_RESOURCE_STATE_PRESENT);
+        }
+
+        _internal_resolve_render_targets(this->m_command_list, static_cast<uint32_t>(resolve_source_resources.size()), resolve_source_resources.data(), resolve_destination_resources.data(), resolve_destination_states.data());
     }
 
-    for (uint32_t flush_for_present_index = 0U; flush_for_present_index < color_attachment_flush_for_present_count; ++flush_for_present_index)
+    this->m_current_render_pass = NULL;
+    this->m_current_frame_buffer = NULL;
+}
+
+void brx_pal_d3d12_graphics_command_buffer::begin_rendering(uint32_t width, uint32_t height, uint32_t view_count, uint32_t color_attachment_count, BRX_PAL_RENDERING_COLOR_ATTACHMENT const *color_attachments, BRX_PAL_RENDERING_DEPTH_STENCIL_ATTACHMENT const *depth_stencil_attachment)
+{
+    assert(NULL == this->m_current_render_pass);
+    assert(NULL == this->m_current_frame_buffer);
+    assert(!this->m_current_rendering);
+    assert(this->m_current_rendering_store_barriers.empty());
+    assert(this->m_current_rendering_resolve_source_resources.empty());
+    this->m_current_rendering = true;
+
+    assert(color_attachment_count <= D3D12_SIMULTANEOUS_RENDER_TARGET_COUNT);
+    color_attachment_count = (color_attachment_count < D3D12_SIMULTANEOUS_RENDER_TARGET_COUNT) ? color_attachment_count : D3D12_SIMULTANEOUS_RENDER_TARGET_COUNT;
+
+    // the same as the "begin_render_pass", the resource barrier is only required for the attachments which are flushed by the store operation
+    D3D12_RESOURCE_BARRIER load_barriers[D3D12_SIMULTANEOUS_RENDER_TARGET_COUNT + 1U];
+    uint32_t load_barrier_count = 0U;
+
+    ID3D12Resource *render_target_resources[D3D12_SIMULTANEOUS_RENDER_TARGET_COUNT];
+    D3D12_CPU_DESCRIPTOR_HANDLE render_target_view_descriptors[D3D12_SIMULTANEOUS_RENDER_TARGET_COUNT];
+
+    for (uint32_t color_attachment_index = 0U; color_attachment_index < color_attachment_count; ++color_attachment_index)
     {
-        uint32_t const color_attachment_flush_for_present_index = color_attachment_flush_for_present_indices[flush_for_present_index];
-        ID3D12Resource *const render_target_resource = render_target_resources[color_attachment_flush_for_present_index];
+        assert(NULL != color_attachments[color_attachment_index].image);
+        brx_pal_d3d12_color_attachment_image const *const color_attachment_image = static_cast<brx_pal_d3d12_color_attachment_image const *>(color_attachments[color_attachment_index].image);
 
-        store_barriers[color_attachment_flush_for_sampled_image_count + flush_for_present_index] = D3D12_RESOURCE_BARRIER{
-            .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+        ID3D12Resource *const render_target_resource = color_attachment_image->get_resource();
+        render_target_resources[color_attachment_index] = render_target_resource;
+        render_target_view_descriptors[color_attachment_index] = color_attachment_image->get_render_target_view_descriptor();
+
+        D3D12_RESOURCE_STATES resource_state;
+        switch (color_attachments[color_attachment_index].store_operation)
+        {
+        case BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT_STORE_OPERATION_DONT_CARE:
+            resource_state = D3D12_RESOURCE_STATE_RENDER_TARGET;
+            break;
+        case BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT_STORE_OPERATION_FLUSH_FOR_SAMPLED_IMAGE:
+            resource_state = D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
+            break;
+        case BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT_STORE_OPERATION_FLUSH_FOR_PRESENT:
+            resource_state = D3D12_RESOURCE_STATE_PRESENT;
+            break;
+        default:
+            assert(false);
+            resource_state = D3D12_RESOURCE_STATE_RENDER_TARGET;
+        }
+
+        if (NULL != color_attachments[color_attachment_index].resolve_image)
+        {
+            // the multisample render target always stays in the "D3D12_RESOURCE_STATE_RENDER_TARGET" state, and only the resolve resource is transitioned at the end of the rendering
+            assert(D3D12_RESOURCE_STATE_RENDER_TARGET != resource_state);
+
+            this->m_current_rendering_resolve_source_resources.push_back(render_target_resource);
+            this->m_current_rendering_resolve_destination_resources.push_back(static_cast<brx_pal_d3d12_color_attachment_image const *>(color_attachments[color_attachment_index].resolve_image)->get_resource());
+            this->m_current_rendering_resolve_destination_states.push_back(resource_state);
+        }
+        else if (D3D12_RESOURCE_STATE_RENDER_TARGET != resource_state)
+        {
+            load_barriers[load_barrier_count] = D3D12_RESOURCE_BARRIER{
+                .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+                .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+                .Transition = {
+                    render_target_resource,
+                    0U,
+                    resource_state,
+                    D3D12_RESOURCE_STATE_RENDER_TARGET}};
+            ++load_barrier_count;
+
+            this->m_current_rendering_store_barriers.push_back(D3D12_RESOURCE_BARRIER{
+                .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+                .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+                .Transition = {
+                    render_target_resource,
+                    0U,
+                    D3D12_RESOURCE_STATE_RENDER_TARGET,
+                    resource_state}});
+        }
+    }
+
+    ID3D12Resource *depth_stencil_resource;
+    D3D12_CPU_DESCRIPTOR_HANDLE depth_stencil_view_descriptor;
+
+    if (NULL != depth_stencil_attachment)
+    {
+        assert(NULL != depth_stencil_attachment->image);
+        brx_pal_d3d12_depth_stencil_attachment_image const *const depth_stencil_attachment_image = static_cast<brx_pal_d3d12_depth_stencil_attachment_image const *>(depth_stencil_attachment->image);
+
+        depth_stencil_resource = depth_stencil_attachment_image->get_resource();
+        depth_stencil_view_descriptor = depth_stencil_attachment_image->get_depth_stencil_view_descriptor();
+
+        assert((BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT_STORE_OPERATION_DONT_CARE == depth_stencil_attachment->store_operation) || (BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT_STORE_OPERATION_FLUSH_FOR_SAMPLED_IMAGE == depth_stencil_attachment->store_operation));
+
+        if (BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT_STORE_OPERATION_FLUSH_FOR_SAMPLED_IMAGE == depth_stencil_attachment->store_operation)
+        {
+            load_barriers[load_barrier_count] = D3D12_RESOURCE_BARRIER{
+                .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+                .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+                .Transition = {
+                    depth_stencil_resource,
+                    0U,
+                    D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+                    D3D12_RESOURCE_STATE_DEPTH_WRITE}};
+            ++load_barrier_count;
+
+            this->m_current_rendering_store_barriers.push_back(D3D12_RESOURCE_BARRIER{
+                .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+                .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+                .Transition = {
+                    depth_stencil_resource,
+                    0U,
+                    D3D12_RESOURCE_STATE_DEPTH_WRITE,
+                    D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE}});
+        }
+    }
+
+    if (load_barrier_count > 0U)
+    {
+        this->m_command_list->ResourceBarrier(load_barrier_count, load_barriers);
+    }
+
+    // the "DONT_CARE" load operation is the discard, which also initializes the placed attachment after another resource has been used in the same memory range
+    for (uint32_t color_attachment_index = 0U; color_attachment_index < color_attachment_count; ++color_attachment_index)
+    {
+        assert((BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT_LOAD_OPERATION_DONT_CARE == color_attachments[color_attachment_index].load_operation) || (BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT_LOAD_OPERATION_CLEAR == color_attachments[color_attachment_index].load_operation));
+
+        if (BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT_LOAD_OPERATION_CLEAR == color_attachments[color_attachment_index].load_operation)
+        {
+            this->m_command_list->ClearRenderTargetView(render_target_view_descriptors[color_attachment_index], color_attachments[color_attachment_index].clear_value, 0U, NULL);
+        }
+        else
+        {
+            this->m_command_list->DiscardResource(render_target_resources[color_attachment_index], NULL);
+        }
+    }
+
+    if (NULL != depth_stencil_attachment)
+    {
+        assert((BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT_LOAD_OPERATION_DONT_CARE == depth_stencil_attachment->load_operation) || (BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT_LOAD_OPERATION_CLEAR == depth_stencil_attachment->load_operation));
+
+        if (BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT_LOAD_OPERATION_CLEAR == depth_stencil_attachment->load_operation)
+        {
+            D3D12_CLEAR_FLAGS const clear_flags = static_cast<brx_pal_d3d12_depth_stencil_attachment_image const *>(depth_stencil_attachment->image)->get_clear_flags();
+
+            this->m_command_list->ClearDepthStencilView(depth_stencil_view_descriptor, clear_flags, depth_stencil_attachment->depth_clear_value, depth_stencil_attachment->stencil_clear_value, 0U, NULL);
+        }
+        else
+        {
+            this->m_command_list->DiscardResource(depth_stencil_resource, NULL);
+        }
+    }
+
+    this->m_command_list->OMSetRenderTargets(color_attachment_count, render_target_view_descriptors, FALSE, (NULL != depth_stencil_attachment) ? &depth_stencil_view_descriptor : NULL);
+
+    // the view instance "i" is rendered into the array slice "i" of the (layered) attachments (should match the "create_dynamic_rendering_graphics_pipeline")
+    assert((1U <= view_count) && (view_count <= D3D12_MAX_VIEW_INSTANCE_COUNT));
+    if (view_count > 1U)
+    {
+        this->m_command_list->SetViewInstanceMask((1U << view_count) - 1U);
+    }
+}
+
+void brx_pal_d3d12_graphics_command_buffer::end_rendering()
+{
+    assert(this->m_current_rendering);
+
+    _internal_resolve_render_targets(this->m_command_list, static_cast<uint32_t>(this->m_current_rendering_resolve_source_resources.size()), this->m_current_rendering_resolve_source_resources.data(), this->m_current_rendering_resolve_destination_resources.data(), this->m_current_rendering_resolve_destination_states.data());
+
+    this->m_current_rendering_resolve_source_resources.clear();
+    this->m_current_rendering_resolve_destination_resources.clear();
+    this->m_current_rendering_resolve_destination_states.clear();
+
+    if (!this->m_current_rendering_store_barriers.empty())
+    {
+        this->m_command_list->ResourceBarrier(static_cast<UINT>(this->m_current_rendering_store_barriers.size()), this->m_current_rendering_store_barriers.data());
+    }
+
+    this->m_current_rendering_store_barriers.clear();
+    this->m_current_rendering = false;
+}
+
+void brx_pal_d3d12_graphics_command_buffer::aliasing_barrier(uint32_t color_attachment_image_count, brx_pal_color_attachment_image const *const *wrapped_color_attachment_images, uint32_t depth_stencil_attachment_image_count, brx_pal_depth_stencil_attachment_image const *const *wrapped_depth_stencil_attachment_images, uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *wrapped_storage_buffers, uint32_t storage_image_count, brx_pal_storage_image const *const *wrapped_storage_images)
+{
+    // the "pResourceBefore" is NULL, since any resource in the same memory range may have been used
+    mcrt_vector<D3D12_RESOURCE_BARRIER> aliasing_barriers;
+    aliasing_barriers.reserve(static_cast<size_t>(color_attachment_image_count + depth_stencil_attachment_image_count + storage_buffer_count + storage_image_count));
+
+    for (uint32_t color_attachment_image_index = 0U; color_attachment_image_index < color_attachment_image_count; ++color_attachment_image_index)
+    {
+        aliasing_barriers.push_back(D3D12_RESOURCE_BARRIER{
+            .Type = D3D12_RESOURCE_BARRIER_TYPE_ALIASING,
             .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
-            .Transition = {
-                render_target_resource,
-                0U,
-                D3D12_RESOURCE_STATE_RENDER_TARGET,
-                D3D12_RESOURCE_STATE_PRESENT}};
+            .Aliasing = {
+                NULL,
+                static_cast<brx_pal_d3d12_color_attachment_image const *>(wrapped_color_attachment_images[color_attachment_image_index])->get_resource()}});
     }
 
-    if (depth_stencil_attachment_flush_for_sampled_image)
+    for (uint32_t depth_stencil_attachment_image_index = 0U; depth_stencil_attachment_image_index < depth_stencil_attachment_image_count; ++depth_stencil_attachment_image_index)
     {
-        store_barriers[color_attachment_flush_for_sampled_image_count + color_attachment_flush_for_present_count] = D3D12_RESOURCE_BARRIER{
-            .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+        aliasing_barriers.push_back(D3D12_RESOURCE_BARRIER{
+            .Type = D3D12_RESOURCE_BARRIER_TYPE_ALIASING,
             .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
-            .Transition = {
-                depth_stencil_resource,
-                0U,
-                D3D12_RESOURCE_STATE_DEPTH_WRITE,
-                D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE}};
+            .Aliasing = {
+                NULL,
+                static_cast<brx_pal_d3d12_depth_stencil_attachment_image const *>(wrapped_depth_stencil_attachment_images[depth_stencil_attachment_image_index])->get_resource()}});
     }
 
-    this->m_command_list->ResourceBarrier(static_cast<UINT>(store_barriers.size()), &store_barriers[0]);
+    for (uint32_t storage_buffer_index = 0U; storage_buffer_index < storage_buffer_count; ++storage_buffer_index)
+    {
+        aliasing_barriers.push_back(D3D12_RESOURCE_BARRIER{
+            .Type = D3D12_RESOURCE_BARRIER_TYPE_ALIASING,
+            .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+            .Aliasing = {
+                NULL,
+                static_cast<brx_pal_d3d12_storage_buffer const *>(wrapped_storage_buffers[storage_buffer_index])->get_resource()}});
+    }
 
-    this->m_current_render_pass = NULL;
-    this->m_current_frame_buffer = NULL;
+    for (uint32_t storage_image_index = 0U; storage_image_index < storage_image_count; ++storage_image_index)
+    {
+        aliasing_barriers.push_back(D3D12_RESOURCE_BARRIER{
+            .Type = D3D12_RESOURCE_BARRIER_TYPE_ALIASING,
+            .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+            .Aliasing = {
+                NULL,
+                static_cast<brx_pal_d3d12_storage_image const *>(wrapped_storage_images[storage_image_index])->get_resource()}});
+    }
+
+    if (!aliasing_barriers.empty())
+    {
+        this->m_command_list->ResourceBarrier(static_cast<UINT>(aliasing_barriers.size()), aliasing_barriers.data());
+    }
 }
 
 void brx_pal_d3d12_graphics_command_buffer::compute_pass_load(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *wrapped_storage_buffers, BRX_PAL_COMPUTE_PASS_STORAGE_BUFFER_LOAD_OPERATION const *storage_buffer_load_operations, uint32_t storage_image_count, brx_pal_storage_image const *const *wrapped_storage_images, BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_LOAD_OPERATION const *storage_image_load_operations)
@@ -675,6 +1300,20 @@ void brx_pal_d3d12_graphics_command_buffer::bind_compute_descriptor_sets(brx_pal
     assert(dynamic_offset_index == dynamic_offet_count);
 }
 
+void brx_pal_d3d12_graphics_command_buffer::push_compute_constants(brx_pal_pipeline_layout const *wrapped_pipeline_layout, uint32_t offset, uint32_t size, void const *constants)
+{
+    assert(NULL != wrapped_pipeline_layout);
+    assert(NULL != constants);
+    assert(0U == (offset & 3U));
+    assert(0U == (size & 3U));
+    assert((offset + size) <= BRX_PAL_MAX_PUSH_CONSTANT_SIZE);
+
+    uint32_t const root_parameter_index = static_cast<brx_pal_d3d12_pipeline_layout const *>(wrapped_pipeline_layout)->get_root_constants_root_parameter_index();
+    assert(static_cast<uint32_t>(-1) != root_parameter_index);
+
+    this->m_command_list->SetComputeRoot32BitConstants(root_parameter_index, (size >> 2U), constants, (offset >> 2U));
+}
+
 void brx_pal_d3d12_graphics_command_buffer::dispatch(uint32_t group_count_x, uint32_t group_count_y, uint32_t group_count_z)
 {
     this->m_command_list->Dispatch(group_count_x, group_count_y, group_count_z);
@@ -695,47 +1334,296 @@ void brx_pal_d3d12_graphics_command_buffer::compute_pass_barrier(uint32_t storag
                 storage_buffer_resource}};
     }
 
-    for (uint32_t storage_image_index = 0U; storage_image_index < storage_image_count; ++storage_image_index)
+    for (uint32_t storage_image_index = 0U; storage_image_index < storage_image_count; ++storage_image_index)
+    {
+        ID3D12Resource *const storage_image_resource = static_cast<brx_pal_d3d12_storage_image const *>(wrapped_storage_images[storage_image_index])->get_resource();
+
+        intermediate_barriers[storage_buffer_count + storage_image_index] = D3D12_RESOURCE_BARRIER{
+            .Type = D3D12_RESOURCE_BARRIER_TYPE_UAV,
+            .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+            .UAV = {
+                storage_image_resource}};
+    }
+
+    this->m_command_list->ResourceBarrier(static_cast<UINT>(intermediate_barriers.size()), intermediate_barriers.data());
+}
+
+void brx_pal_d3d12_graphics_command_buffer::compute_pass_store(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *wrapped_storage_buffers, BRX_PAL_COMPUTE_PASS_STORAGE_BUFFER_STORE_OPERATION const *storage_buffer_store_operations, uint32_t storage_image_count, brx_pal_storage_image const *const *wrapped_storage_images, BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_STORE_OPERATION const *storage_image_store_operations)
+{
+    mcrt_vector<D3D12_RESOURCE_BARRIER> store_barriers(static_cast<size_t>(storage_buffer_count + storage_image_count));
+
+    for (uint32_t storage_buffer_index = 0U; storage_buffer_index < storage_buffer_count; ++storage_buffer_index)
+    {
+        ID3D12Resource *const storage_buffer_resource = static_cast<brx_pal_d3d12_storage_buffer const *>(wrapped_storage_buffers[storage_buffer_index])->get_resource();
+
+        assert(BRX_PAL_COMPUTE_PASS_STORAGE_BUFFER_STORE_OPERATION_FLUSH_FOR_READ_ONLY_STORAGE_BUFFER_AND_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BUFFER == storage_buffer_store_operations[storage_buffer_index]);
+
+        store_barriers[storage_buffer_index] = D3D12_RESOURCE_BARRIER{
+            .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+            .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+            .Transition = {
+                storage_buffer_resource,
+                0U,
+                D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
+                D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE}};
+    }
+
+    for (uint32_t storage_image_index = 0U; storage_image_index < storage_image_count; ++storage_image_index)
+    {
+        ID3D12Resource *const storage_image_resource = static_cast<brx_pal_d3d12_storage_image const *>(wrapped_storage_images[storage_image_index])->get_resource();
+
+        assert(BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_STORE_OPERATION_FLUSH_FOR_SAMPLED_IMAGE == storage_image_store_operations[storage_image_index]);
+
+        store_barriers[storage_buffer_count + storage_image_index] = D3D12_RESOURCE_BARRIER{
+            .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+            .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+            .Transition = {
+                storage_image_resource,
+                0U,
+                D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
+                D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE}};
+    }
+
+    this->m_command_list->ResourceBarrier(static_cast<UINT>(store_barriers.size()), store_barriers.data());
+}
+
+void brx_pal_d3d12_graphics_command_buffer::acquire(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *wrapped_storage_buffers, uint32_t storage_image_count, brx_pal_storage_image const *const *wrapped_storage_images)
+{
+    // the resources have been transitioned to the common state by the "compute_pass_store" of the compute command buffer
+    _internal_transition_storage_resources(this->m_command_list, storage_buffer_count, wrapped_storage_buffers, storage_image_count, wrapped_storage_images, D3D12_RESOURCE_STATE_COMMON, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+}
+
+void brx_pal_d3d12_graphics_command_buffer::copy_buffer(brx_pal_storage_buffer const *wrapped_dst_storage_buffer, uint64_t dst_offset, brx_pal_storage_buffer const *wrapped_src_storage_buffer, uint64_t src_offset, uint32_t src_size)
+{
+    assert(NULL != wrapped_dst_storage_buffer);
+    ID3D12Resource *const dst_storage_buffer_resource = static_cast<brx_pal_d3d12_storage_buffer const *>(wrapped_dst_storage_buffer)->get_resource();
+
+    assert(NULL != wrapped_src_storage_buffer);
+    ID3D12Resource *const src_storage_buffer_resource = static_cast<brx_pal_d3d12_storage_buffer const *>(wrapped_src_storage_buffer)->get_resource();
+
+    assert(dst_storage_buffer_resource != src_storage_buffer_resource);
+
+    {
+        D3D12_RESOURCE_BARRIER const load_barriers[2] = {
+            D3D12_RESOURCE_BARRIER{
+                .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+                .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+                .Transition = {
+                    dst_storage_buffer_resource,
+                    0U,
+                    D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+                    D3D12_RESOURCE_STATE_COPY_DEST}},
+            D3D12_RESOURCE_BARRIER{
+                .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+                .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+                .Transition = {
+                    src_storage_buffer_resource,
+                    0U,
+                    D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+                    D3D12_RESOURCE_STATE_COPY_SOURCE}}};
+
+        this->m_command_list->ResourceBarrier(sizeof(load_barriers) / sizeof(load_barriers[0]), load_barriers);
+    }
+
+    this->m_command_list->CopyBufferRegion(dst_storage_buffer_resource, dst_offset, src_storage_buffer_resource, src_offset, src_size);
+
+    {
+        D3D12_RESOURCE_BARRIER const store_barriers[2] = {
+            D3D12_RESOURCE_BARRIER{
+                .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+                .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+                .Transition = {
+                    dst_storage_buffer_resource,
+                    0U,
+                    D3D12_RESOURCE_STATE_COPY_DEST,
+                    D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE}},
+            D3D12_RESOURCE_BARRIER{
+                .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+                .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+                .Transition = {
+                    src_storage_buffer_resource,
+                    0U,
+                    D3D12_RESOURCE_STATE_COPY_SOURCE,
+                    D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE}}};
+
+        this->m_command_list->ResourceBarrier(sizeof(store_barriers) / sizeof(store_barriers[0]), store_barriers);
+    }
+}
+
+void brx_pal_d3d12_graphics_command_buffer::copy_image(brx_pal_storage_image const *wrapped_dst_storage_image, brx_pal_storage_image const *wrapped_src_storage_image, uint32_t width, uint32_t height)
+{
+    assert(NULL != wrapped_dst_storage_image);
+    ID3D12Resource *const dst_storage_image_resource = static_cast<brx_pal_d3d12_storage_image const *>(wrapped_dst_storage_image)->get_resource();
+
+    assert(NULL != wrapped_src_storage_image);
+    ID3D12Resource *const src_storage_image_resource = static_cast<brx_pal_d3d12_storage_image const *>(wrapped_src_storage_image)->get_resource();
+
+    assert(dst_storage_image_resource != src_storage_image_resource);
+
+    {
+        D3D12_RESOURCE_BARRIER const load_barriers[2] = {
+            D3D12_RESOURCE_BARRIER{
+                .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+                .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+                .Transition = {
+                    dst_storage_image_resource,
+                    0U,
+                    D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+                    D3D12_RESOURCE_STATE_COPY_DEST}},
+            D3D12_RESOURCE_BARRIER{
+                .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+                .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+                .Transition = {
+                    src_storage_image_resource,
+                    0U,
+                    D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+                    D3D12_RESOURCE_STATE_COPY_SOURCE}}};
+
+        this->m_command_list->ResourceBarrier(sizeof(load_barriers) / sizeof(load_barriers[0]), load_barriers);
+    }
+
+    D3D12_TEXTURE_COPY_LOCATION const dst_location = {
+        .pResource = dst_storage_image_resource,
+        .Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX,
+        .SubresourceIndex = 0U};
+
+    D3D12_TEXTURE_COPY_LOCATION const src_location = {
+        .pResource = src_storage_image_resource,
+        .Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX,
+        .SubresourceIndex = 0U};
+
+    D3D12_BOX const src_box = {0U, 0U, 0U, width, height, 1U};
+
+    this->m_command_list->CopyTextureRegion(&dst_location, 0U, 0U, 0U, &src_location, &src_box);
+
+    {
+        D3D12_RESOURCE_BARRIER const store_barriers[2] = {
+            D3D12_RESOURCE_BARRIER{
+                .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+                .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+                .Transition = {
+                    dst_storage_image_resource,
+                    0U,
+                    D3D12_RESOURCE_STATE_COPY_DEST,
+                    D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE}},
+            D3D12_RESOURCE_BARRIER{
+                .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+                .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+                .Transition = {
+                    src_storage_image_resource,
+                    0U,
+                    D3D12_RESOURCE_STATE_COPY_SOURCE,
+                    D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE}}};
+
+        this->m_command_list->ResourceBarrier(sizeof(store_barriers) / sizeof(store_barriers[0]), store_barriers);
+    }
+}
+
+void brx_pal_d3d12_graphics_command_buffer::fill_buffer(brx_pal_storage_buffer const *wrapped_dst_storage_buffer, uint64_t dst_offset, uint32_t dst_size, uint32_t data)
+{
+    assert(NULL != wrapped_dst_storage_buffer);
+    ID3D12Resource *const dst_storage_buffer_resource = static_cast<brx_pal_d3d12_storage_buffer const *>(wrapped_dst_storage_buffer)->get_resource();
+
+    assert(0U == (dst_offset % 4U));
+    assert(0U == (dst_size % 4U));
+
+    // ClearUnorderedAccessViewUint requires both the CPU descriptor handle and the GPU descriptor handle of the same UAV
+    // the UAV is limited to the range to fill
+    D3D12_UNORDERED_ACCESS_VIEW_DESC unordered_access_view_desc = (*static_cast<brx_pal_d3d12_storage_buffer const *>(wrapped_dst_storage_buffer)->get_unordered_access_view_desc());
+    assert(D3D12_UAV_DIMENSION_BUFFER == unordered_access_view_desc.ViewDimension);
+    assert(DXGI_FORMAT_R32_TYPELESS == unordered_access_view_desc.Format);
+    assert(D3D12_BUFFER_UAV_FLAG_RAW == unordered_access_view_desc.Buffer.Flags);
+    unordered_access_view_desc.Buffer.FirstElement = dst_offset / 4U;
+    unordered_access_view_desc.Buffer.NumElements = dst_size / 4U;
+
+    uint32_t const descriptor_index = this->allocate_clear_unordered_access_view_descriptor();
+
+    D3D12_CPU_DESCRIPTOR_HANDLE const shader_visible_cpu_descriptor_handle = D3D12_CPU_DESCRIPTOR_HANDLE{this->m_clear_unordered_access_view_shader_visible_descriptor_heap->GetCPUDescriptorHandleForHeapStart().ptr + this->m_clear_unordered_access_view_descriptor_increment_size * descriptor_index};
+    D3D12_GPU_DESCRIPTOR_HANDLE const shader_visible_gpu_descriptor_handle = D3D12_GPU_DESCRIPTOR_HANDLE{this->m_clear_unordered_access_view_shader_visible_descriptor_heap->GetGPUDescriptorHandleForHeapStart().ptr + this->m_clear_unordered_access_view_descriptor_increment_size * descriptor_index};
+    D3D12_CPU_DESCRIPTOR_HANDLE const non_shader_visible_cpu_descriptor_handle = D3D12_CPU_DESCRIPTOR_HANDLE{this->m_clear_unordered_access_view_non_shader_visible_descriptor_heap->GetCPUDescriptorHandleForHeapStart().ptr + this->m_clear_unordered_access_view_descriptor_increment_size * descriptor_index};
+
+    this->m_device->CreateUnorderedAccessView(dst_storage_buffer_resource, NULL, &unordered_access_view_desc, shader_visible_cpu_descriptor_handle);
+    this->m_device->CreateUnorderedAccessView(dst_storage_buffer_resource, NULL, &unordered_access_view_desc, non_shader_visible_cpu_descriptor_handle);
+
+    {
+        D3D12_RESOURCE_BARRIER const load_barrier = {
+            .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+            .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+            .Transition = {
+                dst_storage_buffer_resource,
+                0U,
+                D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+                D3D12_RESOURCE_STATE_UNORDERED_ACCESS}};
+
+        this->m_command_list->ResourceBarrier(1U, &load_barrier);
+    }
+
+    ID3D12DescriptorHeap *const descriptor_heaps[1] = {this->m_clear_unordered_access_view_shader_visible_descriptor_heap};
+    this->m_command_list->SetDescriptorHeaps(sizeof(descriptor_heaps) / sizeof(descriptor_heaps[0]), descriptor_heaps);
+
+    UINT const values[4] = {data, data, data, data};
+    this->m_command_list->ClearUnorderedAccessViewUint(shader_visible_gpu_descriptor_handle, non_shader_visible_cpu_descriptor_handle, dst_storage_buffer_resource, values, 0U, NULL);
+
     {
-        ID3D12Resource *const storage_image_resource = static_cast<brx_pal_d3d12_storage_image const *>(wrapped_storage_images[storage_image_index])->get_resource();
-
-        intermediate_barriers[storage_buffer_count + storage_image_index] = D3D12_RESOURCE_BARRIER{
-            .Type = D3D12_RESOURCE_BARRIER_TYPE_UAV,
+        D3D12_RESOURCE_BARRIER const store_barrier = {
+            .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
             .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
-            .UAV = {
-                storage_image_resource}};
-    }
+            .Transition = {
+                dst_storage_buffer_resource,
+                0U,
+                D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
+                D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE}};
 
-    this->m_command_list->ResourceBarrier(static_cast<UINT>(intermediate_barriers.size()), intermediate_barriers.data());
+        this->m_command_list->ResourceBarrier(1U, &store_barrier);
+    }
 }
 
-void brx_pal_d3d12_graphics_command_buffer::compute_pass_store(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *wrapped_storage_buffers, BRX_PAL_COMPUTE_PASS_STORAGE_BUFFER_STORE_OPERATION const *storage_buffer_store_operations, uint32_t storage_image_count, brx_pal_storage_image const *const *wrapped_storage_images, BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_STORE_OPERATION const *storage_image_store_operations)
+void brx_pal_d3d12_graphics_command_buffer::clear_storage_image(brx_pal_storage_image const *wrapped_storage_image, float const *color_clear_value)
 {
-    mcrt_vector<D3D12_RESOURCE_BARRIER> store_barriers(static_cast<size_t>(storage_buffer_count + storage_image_count));
+    assert(NULL != wrapped_storage_image);
+    ID3D12Resource *const storage_image_resource = static_cast<brx_pal_d3d12_storage_image const *>(wrapped_storage_image)->get_resource();
+    D3D12_UNORDERED_ACCESS_VIEW_DESC const *const unordered_access_view_desc = static_cast<brx_pal_d3d12_storage_image const *>(wrapped_storage_image)->get_unordered_access_view_desc();
 
-    for (uint32_t storage_buffer_index = 0U; storage_buffer_index < storage_buffer_count; ++storage_buffer_index)
-    {
-        ID3D12Resource *const storage_buffer_resource = static_cast<brx_pal_d3d12_storage_buffer const *>(wrapped_storage_buffers[storage_buffer_index])->get_resource();
+    assert(NULL != color_clear_value);
 
-        assert(BRX_PAL_COMPUTE_PASS_STORAGE_BUFFER_STORE_OPERATION_FLUSH_FOR_READ_ONLY_STORAGE_BUFFER_AND_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BUFFER == storage_buffer_store_operations[storage_buffer_index]);
+    // ClearUnorderedAccessViewFloat requires both the CPU descriptor handle and the GPU descriptor handle of the same UAV
+    uint32_t const descriptor_index = this->allocate_clear_unordered_access_view_descriptor();
 
-        store_barriers[storage_buffer_index] = D3D12_RESOURCE_BARRIER{
+    D3D12_CPU_DESCRIPTOR_HANDLE const shader_visible_cpu_descriptor_handle = D3D12_CPU_DESCRIPTOR_HANDLE{this->m_clear_unordered_access_view_shader_visible_descriptor_heap->GetCPUDescriptorHandleForHeapStart().ptr + this->m_clear_unordered_access_view_descriptor_increment_size * descriptor_index};
+    D3D12_GPU_DESCRIPTOR_HANDLE const shader_visible_gpu_descriptor_handle = D3D12_GPU_DESCRIPTOR_HANDLE{this->m_clear_unordered_access_view_shader_visible_descriptor_heap->GetGPUDescriptorHandleForHeapStart().ptr + this->m_clear_unordered_access_view_descriptor_increment_size * descriptor_index};
+    D3D12_CPU_DESCRIPTOR_HANDLE const non_shader_visible_cpu_descriptor_handle = D3D12_CPU_DESCRIPTOR_HANDLE{this->m_clear_unordered_access_view_non_shader_visible_descriptor_heap->GetCPUDescriptorHandleForHeapStart().ptr + this->m_clear_unordered_access_view_descriptor_increment_size * descriptor_index};
+
+    this->m_device->CreateUnorderedAccessView(storage_image_resource, NULL, unordered_access_view_desc, shader_visible_cpu_descriptor_handle);
+    this->m_device->CreateUnorderedAccessView(storage_image_resource, NULL, unordered_access_view_desc, non_shader_visible_cpu_descriptor_handle);
+
+    {
+        D3D12_RESOURCE_BARRIER const load_barrier = {
             .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
             .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
             .Transition = {
-                storage_buffer_resource,
+                storage_image_resource,
                 0U,
-                D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
-                D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE}};
+                D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+                D3D12_RESOURCE_STATE_UNORDERED_ACCESS}};
+
+        this->m_command_list->ResourceBarrier(1U, &load_barrier);
     }
 
-    for (uint32_t storage_image_index = 0U; storage_image_index < storage_image_count; ++storage_image_index)
-    {
-        ID3D12Resource *const storage_image_resource = static_cast<brx_pal_d3d12_storage_image const *>(wrapped_storage_images[storage_image_index])->get_resource();
+    ID3D12DescriptorHeap *const descriptor_heaps[1] = {this->m_clear_unordered_access_view_shader_visible_descriptor_heap};
+    this->m_command_list->SetDescriptorHeaps(sizeof(descriptor_heaps) / sizeof(descriptor_heaps[0]), descriptor_heaps);
 
-        assert(BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_STORE_OPERATION_FLUSH_FOR_SAMPLED_IMAGE == storage_image_store_operations[storage_image_index]);
+    if (DXGI_FORMAT_R32_UINT == unordered_access_view_desc->Format)
+    {
+        UINT const values[4] = {static_cast<UINT>(color_clear_value[0]), static_cast<UINT>(color_clear_value[1]), static_cast<UINT>(color_clear_value[2]), static_cast<UINT>(color_clear_value[3])};
+        this->m_command_list->ClearUnorderedAccessViewUint(shader_visible_gpu_descriptor_handle, non_shader_visible_cpu_descriptor_handle, storage_image_resource, values, 0U, NULL);
+    }
+    else
+    {
+        this->m_command_list->ClearUnorderedAccessViewFloat(shader_visible_gpu_descriptor_handle, non_shader_visible_cpu_descriptor_handle, storage_image_resource, color_clear_value, 0U, NULL);
+    }
 
-        store_barriers[storage_buffer_count + storage_image_index] = D3D12_RESOURCE_BARRIER{
+    {
+        D3D12_RESOURCE_BARRIER const store_barrier = {
             .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
             .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
             .Transition = {
@@ -743,9 +1631,9 @@ void brx_pal_d3d12_graphics_command_buffer::compute_pass_store(uint32_t storage_
                 0U,
                 D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
                 D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE}};
-    }
 
-    this->m_command_list->ResourceBarrier(static_cast<UINT>(store_barriers.size()), store_barriers.data());
+        this->m_command_list->ResourceBarrier(1U, &store_barrier);
+    }
 }
 
 void brx_pal_d3d12_graphics_command_buffer::build_intermediate_bottom_level_acceleration_structure(brx_pal_intermediate_bottom_level_acceleration_structure *wrapped_intermediate_bottom_level_acceleration_structure, uint32_t bottom_level_acceleration_structure_geometry_count, BRX_PAL_BOTTOM_LEVEL_ACCELERATION_STRUCTURE_GEOMETRY const *wrapped_bottom_level_acceleration_structure_geometries, brx_pal_scratch_buffer *wrapped_scratch_buffer)
@@ -962,15 +1850,29 @@ void brx_pal_d3d12_graphics_command_buffer::update_intermediate_bottom_level_acc
 }
 
 void brx_pal_d3d12_graphics_command_buffer::build_top_level_acceleration_structure(brx_pal_top_level_acceleration_structure *wrapped_top_level_acceleration_structure, uint32_t top_level_acceleration_structure_instance_count, brx_pal_top_level_acceleration_structure_instance_upload_buffer *wrapped_top_level_acceleration_structure_instance_upload_buffer, brx_pal_scratch_buffer *wrapped_scratch_buffer)
+{
+    assert(NULL != wrapped_top_level_acceleration_structure_instance_upload_buffer);
+    D3D12_GPU_VIRTUAL_ADDRESS const top_level_acceleration_structure_instance_upload_buffer_device_memory_range_base = static_cast<brx_pal_d3d12_top_level_acceleration_structure_instance_upload_buffer *>(wrapped_top_level_acceleration_structure_instance_upload_buffer)->get_resource()->GetGPUVirtualAddress();
+
+    this->build_top_level_acceleration_structure(wrapped_top_level_acceleration_structure, top_level_acceleration_structure_instance_count, top_level_acceleration_structure_instance_upload_buffer_device_memory_range_base, wrapped_scratch_buffer);
+}
+
+void brx_pal_d3d12_graphics_command_buffer::build_top_level_acceleration_structure_from_device_instances(brx_pal_top_level_acceleration_structure *wrapped_top_level_acceleration_structure, uint32_t top_level_acceleration_structure_instance_count, brx_pal_acceleration_structure_build_input_read_only_buffer const *wrapped_top_level_acceleration_structure_device_instance_buffer, brx_pal_scratch_buffer *wrapped_scratch_buffer)
+{
+    assert(NULL != wrapped_top_level_acceleration_structure_device_instance_buffer);
+    D3D12_GPU_VIRTUAL_ADDRESS const top_level_acceleration_structure_device_instance_buffer_device_memory_range_base = static_cast<brx_pal_d3d12_acceleration_structure_build_input_read_only_buffer const *>(wrapped_top_level_acceleration_structure_device_instance_buffer)->get_resource()->GetGPUVirtualAddress();
+
+    this->build_top_level_acceleration_structure(wrapped_top_level_acceleration_structure, top_level_acceleration_structure_instance_count, top_level_acceleration_structure_device_instance_buffer_device_memory_range_base, wrapped_scratch_buffer);
+}
+
+void brx_pal_d3d12_graphics_command_buffer::build_top_level_acceleration_structure(brx_pal_top_level_acceleration_structure *wrapped_top_level_acceleration_structure, uint32_t top_level_acceleration_structure_instance_count, D3D12_GPU_VIRTUAL_ADDRESS top_level_acceleration_structure_instance_buffer_device_memory_range_base, brx_pal_scratch_buffer *wrapped_scratch_buffer)
 {
     assert(NULL != wrapped_top_level_acceleration_structure);
     ID3D12Resource *const destination_acceleration_structure_buffer_resource = static_cast<brx_pal_d3d12_top_level_acceleration_structure *>(wrapped_top_level_acceleration_structure)->get_resource();
     D3D12_GPU_VIRTUAL_ADDRESS const destination_acceleration_structure_device_memory_range_base = destination_acceleration_structure_buffer_resource->GetGPUVirtualAddress();
     assert(0U == (destination_acceleration_structure_device_memory_range_base % D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT));
 
-    assert(NULL != wrapped_top_level_acceleration_structure_instance_upload_buffer);
-    D3D12_GPU_VIRTUAL_ADDRESS const top_level_acceleration_structure_instance_upload_buffer_device_memory_range_base = static_cast<brx_pal_d3d12_top_level_acceleration_structure_instance_upload_buffer *>(wrapped_top_level_acceleration_structure_instance_upload_buffer)->get_resource()->GetGPUVirtualAddress();
-    assert(0U == (top_level_acceleration_structure_instance_upload_buffer_device_memory_range_base % D3D12_RAYTRACING_INSTANCE_DESCS_BYTE_ALIGNMENT));
+    assert(0U == (top_level_acceleration_structure_instance_buffer_device_memory_range_base % D3D12_RAYTRACING_INSTANCE_DESCS_BYTE_ALIGNMENT));
 
     assert(NULL != wrapped_scratch_buffer);
     D3D12_GPU_VIRTUAL_ADDRESS const scratch_buffer_device_memory_range_base = static_cast<brx_pal_d3d12_scratch_buffer *>(wrapped_scratch_buffer)->get_resource()->GetGPUVirtualAddress();
@@ -982,7 +1884,7 @@ void brx_pal_d3d12_graphics_command_buffer::build_top_level_acceleration_structu
          D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_ALLOW_UPDATE | D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_PREFER_FAST_TRACE,
          static_cast<UINT>(top_level_acceleration_structure_instance_count),
          D3D12_ELEMENTS_LAYOUT_ARRAY,
-         {.InstanceDescs = top_level_acceleration_structure_instance_upload_buffer_device_memory_range_base}},
+         {.InstanceDescs = top_level_acceleration_structure_instance_buffer_device_memory_range_base}},
         0U,
         scratch_buffer_device_memory_range_base};
 
@@ -1006,6 +1908,22 @@ void brx_pal_d3d12_graphics_command_buffer::build_top_level_acceleration_structu
 }
 
 void brx_pal_d3d12_graphics_command_buffer::update_top_level_acceleration_structure(brx_pal_top_level_acceleration_structure *wrapped_top_level_acceleration_structure, brx_pal_top_level_acceleration_structure_instance_upload_buffer *wrapped_top_level_acceleration_structure_instance_upload_buffer, brx_pal_scratch_buffer *wrapped_scratch_buffer)
+{
+    assert(NULL != wrapped_top_level_acceleration_structure_instance_upload_buffer);
+    D3D12_GPU_VIRTUAL_ADDRESS const top_level_acceleration_structure_instance_upload_buffer_device_memory_range_base = static_cast<brx_pal_d3d12_top_level_acceleration_structure_instance_upload_buffer *>(wrapped_top_level_acceleration_structure_instance_upload_buffer)->get_resource()->GetGPUVirtualAddress();
+
+    this->update_top_level_acceleration_structure(wrapped_top_level_acceleration_structure, top_level_acceleration_structure_instance_upload_buffer_device_memory_range_base, wrapped_scratch_buffer);
+}
+
+void brx_pal_d3d12_graphics_command_buffer::update_top_level_acceleration_structure_from_device_instances(brx_pal_top_level_acceleration_structure *wrapped_top_level_acceleration_structure, brx_pal_acceleration_structure_build_input_read_only_buffer const *wrapped_top_level_acceleration_structure_device_instance_buffer, brx_pal_scratch_buffer *wrapped_scratch_buffer)
+{
+    assert(NULL != wrapped_top_level_acceleration_structure_device_instance_buffer);
+    D3D12_GPU_VIRTUAL_ADDRESS const top_level_acceleration_structure_device_instance_buffer_device_memory_range_base = static_cast<brx_pal_d3d12_acceleration_structure_build_input_read_only_buffer const *>(wrapped_top_level_acceleration_structure_device_instance_buffer)->get_resource()->GetGPUVirtualAddress();
+
+    this->update_top_level_acceleration_structure(wrapped_top_level_acceleration_structure, top_level_acceleration_structure_device_instance_buffer_device_memory_range_base, wrapped_scratch_buffer);
+}
+
+void brx_pal_d3d12_graphics_command_buffer::update_top_level_acceleration_structure(brx_pal_top_level_acceleration_structure *wrapped_top_level_acceleration_structure, D3D12_GPU_VIRTUAL_ADDRESS top_level_acceleration_structure_instance_buffer_device_memory_range_base, brx_pal_scratch_buffer *wrapped_scratch_buffer)
 {
     assert(NULL != wrapped_top_level_acceleration_structure);
     ID3D12Resource *const destination_acceleration_structure_buffer_resource = static_cast<brx_pal_d3d12_top_level_acceleration_structure *>(wrapped_top_level_acceleration_structure)->get_resource();
@@ -1015,9 +1933,7 @@ void brx_pal_d3d12_graphics_command_buffer::update_top_level_acceleration_struct
     // [Acceleration structure update constraints](https://microsoft.github.io/DirectX-Specs/d3d/Raytracing.html#acceleration-structure-update-constraints)
     uint32_t const top_level_acceleration_structure_instance_count = static_cast<brx_pal_d3d12_top_level_acceleration_structure *>(wrapped_top_level_acceleration_structure)->get_instance_count();
 
-    assert(NULL != wrapped_top_level_acceleration_structure_instance_upload_buffer);
-    D3D12_GPU_VIRTUAL_ADDRESS const top_level_acceleration_structure_instance_upload_buffer_device_memory_range_base = static_cast<brx_pal_d3d12_top_level_acceleration_structure_instance_upload_buffer *>(wrapped_top_level_acceleration_structure_instance_upload_buffer)->get_resource()->GetGPUVirtualAddress();
-    assert(0U == (top_level_acceleration_structure_instance_upload_buffer_device_memory_range_base % D3D12_RAYTRACING_INSTANCE_DESCS_BYTE_ALIGNMENT));
+    assert(0U == (top_level_acceleration_structure_instance_buffer_device_memory_range_base % D3D12_RAYTRACING_INSTANCE_DESCS_BYTE_ALIGNMENT));
 
     assert(NULL != wrapped_scratch_buffer);
     D3D12_GPU_VIRTUAL_ADDRESS const scratch_buffer_device_memory_range_base = static_cast<brx_pal_d3d12_scratch_buffer *>(wrapped_scratch_buffer)->get_resource()->GetGPUVirtualAddress();
@@ -1029,7 +1945,7 @@ void brx_pal_d3d12_graphics_command_buffer::update_top_level_acceleration_struct
          D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_PERFORM_UPDATE | D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_ALLOW_UPDATE | D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_PREFER_FAST_TRACE,
          static_cast<UINT>(top_level_acceleration_structure_instance_count),
          D3D12_ELEMENTS_LAYOUT_ARRAY,
-         {.InstanceDescs = top_level_acceleration_structure_instance_upload_buffer_device_memory_range_base}},
+         {.InstanceDescs = top_level_acceleration_structure_instance_buffer_device_memory_range_base}},
         destination_acceleration_structure_device_memory_range_base,
         scratch_buffer_device_memory_range_base};
 
@@ -1456,6 +2372,90 @@ void brx_pal_d3d12_upload_command_buffer::compact_bottom_level_acceleration_stru
     this->m_command_list->CopyRaytracingAccelerationStructure(destination_acceleration_structure_device_memory_range_base, source_acceleration_structure_device_memory_range_base, D3D12_RAYTRACING_ACCELERATION_STRUCTURE_COPY_MODE_COMPACT);
 }
 
+void brx_pal_d3d12_upload_command_buffer::write_serialized_bottom_level_acceleration_structure_size(brx_pal_compacted_bottom_level_acceleration_structure const *wrapped_compacted_bottom_level_acceleration_structure, brx_pal_serialized_bottom_level_acceleration_structure_size_query_pool *wrapped_serialized_bottom_level_acceleration_structure_size_query_pool, uint32_t query_index)
+{
+    assert(NULL != wrapped_compacted_bottom_level_acceleration_structure);
+    ID3D12Resource *const source_acceleration_structure_buffer_resource = static_cast<brx_pal_d3d12_compacted_bottom_level_acceleration_structure const *>(wrapped_compacted_bottom_level_acceleration_structure)->get_resource();
+    D3D12_GPU_VIRTUAL_ADDRESS const source_acceleration_structure_device_memory_range_base = source_acceleration_structure_buffer_resource->GetGPUVirtualAddress();
+    assert(0U == (source_acceleration_structure_device_memory_range_base % D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT));
+
+    assert(NULL != wrapped_serialized_bottom_level_acceleration_structure_size_query_pool);
+    D3D12_GPU_VIRTUAL_ADDRESS const query_pool_device_memory_range_base = static_cast<brx_pal_d3d12_serialized_bottom_level_acceleration_structure_size_query_pool *>(wrapped_serialized_bottom_level_acceleration_structure_size_query_pool)->get_resource()->GetGPUVirtualAddress();
+
+    // NOTE: the compacted bottom level acceleration structure may be written by the "compact" in the same submission
+    D3D12_RESOURCE_BARRIER const load_barrier = {
+        .Type = D3D12_RESOURCE_BARRIER_TYPE_UAV,
+        .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+        .UAV = {
+            source_acceleration_structure_buffer_resource}};
+    this->m_command_list->ResourceBarrier(1U, &load_barrier);
+
+    D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_DESC const ray_tracing_acceleration_structure_postbuild_info_desc = {
+        query_pool_device_memory_range_base + sizeof(D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_SERIALIZATION_DESC) * query_index,
+        D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_SERIALIZATION,
+    };
+
+    this->m_command_list->EmitRaytracingAccelerationStructurePostbuildInfo(&ray_tracing_acceleration_structure_postbuild_info_desc, 1U, &source_acceleration_structure_device_memory_range_base);
+}
+
+void brx_pal_d3d12_upload_command_buffer::serialize_compacted_bottom_level_acceleration_structure(brx_pal_serialized_bottom_level_acceleration_structure_buffer *wrapped_destination_serialized_bottom_level_acceleration_structure_buffer, brx_pal_compacted_bottom_level_acceleration_structure const *wrapped_source_compacted_bottom_level_acceleration_structure)
+{
+    // NOTE: we do NOT need the barrier to synchronize the serialized data read by the host, since we use the fence to wait for the GPU completion
+
+    assert(NULL != wrapped_source_compacted_bottom_level_acceleration_structure);
+    ID3D12Resource *const source_acceleration_structure_buffer_resource = static_cast<brx_pal_d3d12_compacted_bottom_level_acceleration_structure const *>(wrapped_source_compacted_bottom_level_acceleration_structure)->get_resource();
+    D3D12_GPU_VIRTUAL_ADDRESS const source_acceleration_structure_device_memory_range_base = source_acceleration_structure_buffer_resource->GetGPUVirtualAddress();
+    assert(0U == (source_acceleration_structure_device_memory_range_base % D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT));
+
+    assert(NULL != wrapped_destination_serialized_bottom_level_acceleration_structure_buffer);
+    D3D12_GPU_VIRTUAL_ADDRESS const destination_serialized_data_device_memory_range_base = static_cast<brx_pal_d3d12_serialized_bottom_level_acceleration_structure_buffer *>(wrapped_destination_serialized_bottom_level_acceleration_structure_buffer)->get_resource()->GetGPUVirtualAddress();
+    assert(0U == (destination_serialized_data_device_memory_range_base % D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT));
+
+    D3D12_RESOURCE_BARRIER const load_barrier = {
+        .Type = D3D12_RESOURCE_BARRIER_TYPE_UAV,
+        .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+        .UAV = {
+            source_acceleration_structure_buffer_resource}};
+    this->m_command_list->ResourceBarrier(1U, &load_barrier);
+
+    this->m_command_list->CopyRaytracingAccelerationStructure(destination_serialized_data_device_memory_range_base, source_acceleration_structure_device_memory_range_base, D3D12_RAYTRACING_ACCELERATION_STRUCTURE_COPY_MODE_SERIALIZE);
+}
+
+void brx_pal_d3d12_upload_command_buffer::deserialize_compacted_bottom_level_acceleration_structure(brx_pal_compacted_bottom_level_acceleration_structure *wrapped_destination_compacted_bottom_level_acceleration_structure, brx_pal_serialized_bottom_level_acceleration_structure_buffer const *wrapped_source_serialized_bottom_level_acceleration_structure_buffer)
+{
+    assert(NULL != wrapped_source_serialized_bottom_level_acceleration_structure_buffer);
+    ID3D12Resource *const source_serialized_data_buffer_resource = static_cast<brx_pal_d3d12_serialized_bottom_level_acceleration_structure_buffer const *>(wrapped_source_serialized_bottom_level_acceleration_structure_buffer)->get_resource();
+    D3D12_GPU_VIRTUAL_ADDRESS const source_serialized_data_device_memory_range_base = source_serialized_data_buffer_resource->GetGPUVirtualAddress();
+    assert(0U == (source_serialized_data_device_memory_range_base % D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT));
+
+    assert(NULL != wrapped_destination_compacted_bottom_level_acceleration_structure);
+    D3D12_GPU_VIRTUAL_ADDRESS const destination_acceleration_structure_device_memory_range_base = static_cast<brx_pal_d3d12_compacted_bottom_level_acceleration_structure *>(wrapped_destination_compacted_bottom_level_acceleration_structure)->get_resource()->GetGPUVirtualAddress();
+    assert(0U == (destination_acceleration_structure_device_memory_range_base % D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT));
+
+    // NOTE: the source of the "deserialize" should be in the "NON_PIXEL_SHADER_RESOURCE" state
+    D3D12_RESOURCE_BARRIER const load_barrier = {
+        .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+        .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+        .Transition = {
+            source_serialized_data_buffer_resource,
+            0U,
+            D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
+            D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE}};
+    this->m_command_list->ResourceBarrier(1U, &load_barrier);
+
+    this->m_command_list->CopyRaytracingAccelerationStructure(destination_acceleration_structure_device_memory_range_base, source_serialized_data_device_memory_range_base, D3D12_RAYTRACING_ACCELERATION_STRUCTURE_COPY_MODE_DESERIALIZE);
+
+    D3D12_RESOURCE_BARRIER const store_barrier = {
+        .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+        .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+        .Transition = {
+            source_serialized_data_buffer_resource,
+            0U,
+            D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE,
+            D3D12_RESOURCE_STATE_UNORDERED_ACCESS}};
+    this->m_command_list->ResourceBarrier(1U, &store_barrier);
+}
+
 void brx_pal_d3d12_upload_command_buffer::release(uint32_t storage_asset_buffer_count, brx_pal_storage_asset_buffer const *const *wrapped_storage_asset_buffers, uint32_t sampled_asset_image_subresource_count, BRX_PAL_SAMPLED_ASSET_IMAGE_SUBRESOURCE const *wrapped_sampled_asset_image_subresources, uint32_t compacted_bottom_level_acceleration_structure_count, brx_pal_compacted_bottom_level_acceleration_structure const *const *wrapped_compacted_bottom_level_acceleration_structures)
 {
     mcrt_vector<D3D12_RESOURCE_BARRIER> release_barriers(static_cast<size_t>((!this->m_uma) ? (storage_asset_buffer_count + sampled_asset_image_subresource_count + compacted_bottom_level_acceleration_structure_count) : compacted_bottom_level_acceleration_structure_count));
@@ -1522,3 +2522,265 @@ void brx_pal_d3d12_upload_command_buffer::end()
         assert(NULL == this->m_command_list);
     }
 }
+
+brx_pal_d3d12_compute_command_buffer::brx_pal_d3d12_compute_command_buffer() : m_compute_command_buffer(), m_graphics_queue_command_allocator(NULL), m_graphics_queue_command_list(NULL), m_graphics_queue_submit_fence(NULL), m_compute_queue_submit_fence(NULL)
+{
+}
+
+void brx_pal_d3d12_compute_command_buffer::init(ID3D12Device *device, bool uma, bool support_ray_tracing, brx_pal_d3d12_descriptor_allocator *descriptor_allocator)
+{
+    // the mesh shader is NOT supported by the compute command list
+    this->m_compute_command_buffer.init(device, D3D12_COMMAND_LIST_TYPE_COMPUTE, uma, support_ray_tracing, NULL, descriptor_allocator);
+
+    assert(NULL == this->m_graphics_queue_command_allocator);
+    HRESULT const hr_create_command_allocator = device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&this->m_graphics_queue_command_allocator));
+    assert(SUCCEEDED(hr_create_command_allocator));
+
+    assert(NULL == this->m_graphics_queue_command_list);
+    HRESULT const hr_create_command_list = device->CreateCommandList(0U, D3D12_COMMAND_LIST_TYPE_DIRECT, this->m_graphics_queue_command_allocator, NULL, IID_PPV_ARGS(&this->m_graphics_queue_command_list));
+    assert(SUCCEEDED(hr_create_command_list));
+
+    HRESULT const hr_close = this->m_graphics_queue_command_list->Close();
+    assert(SUCCEEDED(hr_close));
+
+    assert(NULL == this->m_graphics_queue_submit_fence);
+    HRESULT const hr_create_graphics_queue_submit_fence = device->CreateFence(0U, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&this->m_graphics_queue_submit_fence));
+    assert(SUCCEEDED(hr_create_graphics_queue_submit_fence));
+
+    assert(NULL == this->m_compute_queue_submit_fence);
+    HRESULT const hr_create_compute_queue_submit_fence = device->CreateFence(0U, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&this->m_compute_queue_submit_fence));
+    assert(SUCCEEDED(hr_create_compute_queue_submit_fence));
+}
+
+void brx_pal_d3d12_compute_command_buffer::uninit()
+{
+    assert(NULL != this->m_compute_queue_submit_fence);
+    this->m_compute_queue_submit_fence->Release();
+    this->m_compute_queue_submit_fence = NULL;
+
+    assert(NULL != this->m_graphics_queue_submit_fence);
+    this->m_graphics_queue_submit_fence->Release();
+    this->m_graphics_queue_submit_fence = NULL;
+
+    assert(NULL != this->m_graphics_queue_command_list);
+    this->m_graphics_queue_command_list->Release();
+    this->m_graphics_queue_command_list = NULL;
+
+    assert(NULL != this->m_graphics_queue_command_allocator);
+    this->m_graphics_queue_command_allocator->Release();
+    this->m_graphics_queue_command_allocator = NULL;
+
+    this->m_compute_command_buffer.uninit();
+}
+
+brx_pal_d3d12_compute_command_buffer::~brx_pal_d3d12_compute_command_buffer()
+{
+    assert(NULL == this->m_compute_command_buffer.get_command_allocator());
+    assert(NULL == this->m_compute_command_buffer.get_command_list());
+    assert(NULL == this->m_graphics_queue_command_allocator);
+    assert(NULL == this->m_graphics_queue_command_list);
+    assert(NULL == this->m_graphics_queue_submit_fence);
+    assert(NULL == this->m_compute_queue_submit_fence);
+}
+
+ID3D12CommandAllocator *brx_pal_d3d12_compute_command_buffer::get_command_allocator() const
+{
+    return this->m_compute_command_buffer.get_command_allocator();
+}
+
+ID3D12GraphicsCommandList4 *brx_pal_d3d12_compute_command_buffer::get_command_list() const
+{
+    return this->m_compute_command_buffer.get_command_list();
+}
+
+ID3D12CommandAllocator *brx_pal_d3d12_compute_command_buffer::get_graphics_queue_command_allocator() const
+{
+    return this->m_graphics_queue_command_allocator;
+}
+
+ID3D12GraphicsCommandList4 *brx_pal_d3d12_compute_command_buffer::get_graphics_queue_command_list() const
+{
+    return this->m_graphics_queue_command_list;
+}
+
+ID3D12Fence *brx_pal_d3d12_compute_command_buffer::get_graphics_queue_submit_fence() const
+{
+    return this->m_graphics_queue_submit_fence;
+}
+
+ID3D12Fence *brx_pal_d3d12_compute_command_buffer::get_compute_queue_submit_fence() const
+{
+    return this->m_compute_queue_submit_fence;
+}
+
+void brx_pal_d3d12_compute_command_buffer::begin()
+{
+    HRESULT hr_reset = this->m_graphics_queue_command_list->Reset(this->m_graphics_queue_command_allocator, NULL);
+    assert(SUCCEEDED(hr_reset));
+
+    this->m_compute_command_buffer.begin();
+}
+
+void brx_pal_d3d12_compute_command_buffer::begin_debug_utils_label(char const *label_name)
+{
+    this->m_compute_command_buffer.begin_debug_utils_label(label_name);
+}
+
+void brx_pal_d3d12_compute_command_buffer::end_debug_utils_label()
+{
+    this->m_compute_command_buffer.end_debug_utils_label();
+}
+
+void brx_pal_d3d12_compute_command_buffer::compute_pass_load(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *wrapped_storage_buffers, BRX_PAL_COMPUTE_PASS_STORAGE_BUFFER_LOAD_OPERATION const *storage_buffer_load_operations, uint32_t storage_image_count, brx_pal_storage_image const *const *wrapped_storage_images, BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_LOAD_OPERATION const *storage_image_load_operations)
+{
+    for (uint32_t storage_buffer_index = 0U; storage_buffer_index < storage_buffer_count; ++storage_buffer_index)
+    {
+        assert(BRX_PAL_COMPUTE_PASS_STORAGE_BUFFER_LOAD_OPERATION_DONT_CARE == storage_buffer_load_operations[storage_buffer_index]);
+    }
+
+    for (uint32_t storage_image_index = 0U; storage_image_index < storage_image_count; ++storage_image_index)
+    {
+        assert(BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_LOAD_OPERATION_DONT_CARE == storage_image_load_operations[storage_image_index]);
+    }
+
+    // the resting state (PIXEL_SHADER_RESOURCE) is NOT supported by the compute command list
+    _internal_transition_storage_resources(this->m_graphics_queue_command_list, storage_buffer_count, wrapped_storage_buffers, storage_image_count, wrapped_storage_images, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE, D3D12_RESOURCE_STATE_COMMON);
+
+    _internal_transition_storage_resources(this->m_compute_command_buffer.get_command_list(), storage_buffer_count, wrapped_storage_buffers, storage_image_count, wrapped_storage_images, D3D12_RESOURCE_STATE_COMMON, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
+}
+
+void brx_pal_d3d12_compute_command_buffer::bind_compute_pipeline(brx_pal_compute_pipeline const *wrapped_compute_pipeline)
+{
+    this->m_compute_command_buffer.bind_compute_pipeline(wrapped_compute_pipeline);
+}
+
+void brx_pal_d3d12_compute_command_buffer::bind_compute_descriptor_sets(brx_pal_pipeline_layout const *wrapped_pipeline_layout, uint32_t descriptor_set_count, brx_pal_descriptor_set const *const *wrapped_descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets)
+{
+    this->m_compute_command_buffer.bind_compute_descriptor_sets(wrapped_pipeline_layout, descriptor_set_count, wrapped_descriptor_sets, dynamic_offet_count, dynamic_offsets);
+}
+
+void brx_pal_d3d12_compute_command_buffer::push_compute_constants(brx_pal_pipeline_layout const *wrapped_pipeline_layout, uint32_t offset, uint32_t size, void const *constants)
+{
+    this->m_compute_command_buffer.push_compute_constants(wrapped_pipeline_layout, offset, size, constants);
+}
+
+void brx_pal_d3d12_compute_command_buffer::dispatch(uint32_t group_count_x, uint32_t group_count_y, uint32_t group_count_z)
+{
+    this->m_compute_command_buffer.dispatch(group_count_x, group_count_y, group_count_z);
+}
+
+void brx_pal_d3d12_compute_command_buffer::compute_pass_barrier(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *wrapped_storage_buffers, uint32_t storage_image_count, brx_pal_storage_image const *const *wrapped_storage_images)
+{
+    this->m_compute_command_buffer.compute_pass_barrier(storage_buffer_count, wrapped_storage_buffers, storage_image_count, wrapped_storage_images);
+}
+
+void brx_pal_d3d12_compute_command_buffer::compute_pass_store(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *wrapped_storage_buffers, BRX_PAL_COMPUTE_PASS_STORAGE_BUFFER_STORE_OPERATION const *storage_buffer_store_operations, uint32_t storage_image_count, brx_pal_storage_image const *const *wrapped_storage_images, BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_STORE_OPERATION const *storage_image_store_operations)
+{
+    for (uint32_t storage_buffer_index = 0U; storage_buffer_index < storage_buffer_count; ++storage_buffer_index)
+    {
+        assert(BRX_PAL_COMPUTE_PASS_STORAGE_BUFFER_STORE_OPERATION_FLUSH_FOR_READ_ONLY_STORAGE_BUFFER_AND_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BUFFER == storage_buffer_store_operations[storage_buffer_index]);
+    }
+
+    for (uint32_t storage_image_index = 0U; storage_image_index < storage_image_count; ++storage_image_index)
+    {
+        assert(BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_STORE_OPERATION_FLUSH_FOR_SAMPLED_IMAGE == storage_image_store_operations[storage_image_index]);
+    }
+
+    // the resources are transitioned to the resting state by the "acquire" of the graphics command buffer
+    _internal_transition_storage_resources(this->m_compute_command_buffer.get_command_list(), storage_buffer_count, wrapped_storage_buffers, storage_image_count, wrapped_storage_images, D3D12_RESOURCE_STATE_UNORDERED_ACCESS, D3D12_RESOURCE_STATE_COMMON);
+}
+
+void brx_pal_d3d12_compute_command_buffer::end()
+{
+    HRESULT const hr_close = this->m_graphics_queue_command_list->Close();
+    assert(SUCCEEDED(hr_close));
+
+    this->m_compute_command_buffer.end();
+}
+
+static inline void _internal_resolve_render_targets(ID3D12GraphicsCommandList *command_list, uint32_t resolve_count, ID3D12Resource *const *source_resources, ID3D12Resource *const *destination_resources, D3D12_RESOURCE_STATES const *destination_states)
+{
+    if (resolve_count > 0U)
+    {
+        mcrt_vector<D3D12_RESOURCE_BARRIER> resolve_barriers(static_cast<size_t>(2U * resolve_count));
+
+        for (uint32_t resolve_index = 0U; resolve_index < resolve_count; ++resolve_index)
+        {
+            resolve_barriers[2U * resolve_index] = D3D12_RESOURCE_BARRIER{
+                .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+                .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+                .Transition = {
+                    source_resources[resolve_index],
+                    0U,
+                    D3D12_RESOURCE_STATE_RENDER_TARGET,
+                    D3D12_RESOURCE_STATE_RESOLVE_SOURCE}};
+
+            resolve_barriers[2U * resolve_index + 1U] = D3D12_RESOURCE_BARRIER{
+                .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+                .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+                .Transition = {
+                    destination_resources[resolve_index],
+                    0U,
+                    destination_states[resolve_index],
+                    D3D12_RESOURCE_STATE_RESOLVE_DEST}};
+        }
+
+        command_list->ResourceBarrier(static_cast<UINT>(resolve_barriers.size()), resolve_barriers.data());
+
+        for (uint32_t resolve_index = 0U; resolve_index < resolve_count; ++resolve_index)
+        {
+            D3D12_RESOURCE_DESC const source_resource_desc = source_resources[resolve_index]->GetDesc();
+
+            command_list->ResolveSubresource(destination_resources[resolve_index], 0U, source_resources[resolve_index], 0U, source_resource_desc.Format);
+        }
+
+        for (uint32_t resolve_index = 0U; resolve_index < resolve_count; ++resolve_index)
+        {
+            resolve_barriers[2U * resolve_index].Transition.StateBefore = D3D12_RESOURCE_STATE_RESOLVE_SOURCE;
+            resolve_barriers[2U * resolve_index].Transition.StateAfter = D3D12_RESOURCE_STATE_RENDER_TARGET;
+
+            resolve_barriers[2U * resolve_index + 1U].Transition.StateBefore = D3D12_RESOURCE_STATE_RESOLVE_DEST;
+            resolve_barriers[2U * resolve_index + 1U].Transition.StateAfter = destination_states[resolve_index];
+        }
+
+        command_list->ResourceBarrier(static_cast<UINT>(resolve_barriers.size()), resolve_barriers.data());
+    }
+}
+
+static inline void _internal_transition_storage_resources(ID3D12GraphicsCommandList *command_list, uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *wrapped_storage_buffers, uint32_t storage_image_count, brx_pal_storage_image const *const *wrapped_storage_images, D3D12_RESOURCE_STATES state_before, D3D12_RESOURCE_STATES state_after)
+{
+    if (storage_buffer_count > 0U || storage_image_count > 0U)
+    {
+        mcrt_vector<D3D12_RESOURCE_BARRIER> transition_barriers(static_cast<size_t>(storage_buffer_count + storage_image_count));
+
+        for (uint32_t storage_buffer_index = 0U; storage_buffer_index < storage_buffer_count; ++storage_buffer_index)
+        {
+            ID3D12Resource *const storage_buffer_resource = static_cast<brx_pal_d3d12_storage_buffer const *>(wrapped_storage_buffers[storage_buffer_index])->get_resource();
+
+            transition_barriers[storage_buffer_index] = D3D12_RESOURCE_BARRIER{
+                .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+                .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+                .Transition = {
+                    storage_buffer_resource,
+                    0U,
+                    state_before,
+                    state_after}};
+        }
+
+        for (uint32_t storage_image_index = 0U; storage_image_index < storage_image_count; ++storage_image_index)
+        {
+            ID3D12Resource *const storage_image_resource = static_cast<brx_pal_d3d12_storage_image const *>(wrapped_storage_images[storage_image_index])->get_resource();
+
+            transition_barriers[storage_buffer_count + storage_image_index] = D3D12_RESOURCE_BARRIER{
+                .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+                .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+                .Transition = {
+                    storage_image_resource,
+                    0U,
+                    state_before,
+                    state_after}};
+        }
+
+        command_list->ResourceBarrier(static_cast<UINT>(transition_barriers.size()), transition_barriers.data());
+    }
+}
@@ -18,75 +18,158 @@
 #include "brx_pal_d3d12_device.h"
 #include <assert.h>
 
-brx_pal_d3d12_descriptor_set_layout::brx_pal_d3d12_descriptor_set_layout()
+brx_pal_d3d12_descriptor_set_layout::brx_pal_d3d12_descriptor_set_layout() : m_update_after_bind(false)
 {
 }
 
 void brx_pal_d3d12_descriptor_set_layout::init(uint32_t descriptor_set_binding_count, BRX_PAL_DESCRIPTOR_SET_LAYOUT_BINDING const *wrapped_descriptor_set_bindings)
 {
+	// the immutable samplers are baked into the root signature as the static samplers, and no root parameter is required
+	uint32_t immutable_sampler_binding_count = 0U;
+	for (uint32_t binding_index = 0U; binding_index < descriptor_set_binding_count; ++binding_index)
+	{
+		if (NULL != wrapped_descriptor_set_bindings[binding_index].immutable_samplers)
+		{
+			++immutable_sampler_binding_count;
+		}
+	}
+
 	assert(0U == this->m_descriptor_layouts.size());
-	this->m_descriptor_layouts.resize(descriptor_set_binding_count);
+	this->m_descriptor_layouts.resize(descriptor_set_binding_count - immutable_sampler_binding_count);
+	assert(0U == this->m_static_samplers.size());
+	uint32_t descriptor_layout_index = 0U;
 	for (uint32_t binding_index = 0U; binding_index < descriptor_set_binding_count; ++binding_index)
 	{
+		if (NULL != wrapped_descriptor_set_bindings[binding_index].immutable_samplers)
+		{
+			assert(BRX_PAL_DESCRIPTOR_TYPE_SAMPLER == wrapped_descriptor_set_bindings[binding_index].descriptor_type);
+
+			for (uint32_t descriptor_index = 0U; descriptor_index < wrapped_descriptor_set_bindings[binding_index].descriptor_count; ++descriptor_index)
+			{
+				D3D12_SAMPLER_DESC const *const sampler_desc = static_cast<brx_pal_d3d12_sampler const *>(wrapped_descriptor_set_bindings[binding_index].immutable_samplers[descriptor_index])->get_sampler_desc();
+
+				D3D12_STATIC_BORDER_COLOR border_color;
+				if (sampler_desc->BorderColor[3] < 0.5F)
+				{
+					border_color = D3D12_STATIC_BORDER_COLOR_TRANSPARENT_BLACK;
+				}
+				else if (sampler_desc->BorderColor[0] < 0.5F)
+				{
+					border_color = D3D12_STATIC_BORDER_COLOR_OPAQUE_BLACK;
+				}
+				else
+				{
+					border_color = D3D12_STATIC_BORDER_COLOR_OPAQUE_WHITE;
+				}
+
+				// the register space is assigned by the pipeline layout
+				this->m_static_samplers.push_back(D3D12_STATIC_SAMPLER_DESC{
+					sampler_desc->Filter,
+					sampler_desc->AddressU,
+					sampler_desc->AddressV,
+					sampler_desc->AddressW,
+					sampler_desc->MipLODBias,
+					sampler_desc->MaxAnisotropy,
+					sampler_desc->ComparisonFunc,
+					border_color,
+					sampler_desc->MinLOD,
+					sampler_desc->MaxLOD,
+					wrapped_descriptor_set_bindings[binding_index].binding + descriptor_index,
+					0U,
+					D3D12_SHADER_VISIBILITY_ALL});
+			}
+
+			continue;
+		}
+
 		switch (wrapped_descriptor_set_bindings[binding_index].descriptor_type)
 		{
 		case BRX_PAL_DESCRIPTOR_TYPE_DYNAMIC_UNIFORM_BUFFER:
 		{
-			this->m_descriptor_layouts[binding_index].m_root_parameter_type = BRX_PAL_DESCRIPTOR_TYPE_DYNAMIC_UNIFORM_BUFFER;
-			this->m_descriptor_layouts[binding_index].m_root_parameter_shader_register = wrapped_descriptor_set_bindings[binding_index].binding;
-			this->m_descriptor_layouts[binding_index].m_root_descriptor_table_num_descriptors = -1;
+			this->m_descriptor_layouts[descriptor_layout_index].m_root_parameter_type = BRX_PAL_DESCRIPTOR_TYPE_DYNAMIC_UNIFORM_BUFFER;
+			this->m_descriptor_layouts[descriptor_layout_index].m_root_parameter_shader_register = wrapped_descriptor_set_bindings[binding_index].binding;
+			this->m_descriptor_layouts[descriptor_layout_index].m_root_descriptor_table_num_descriptors = -1;
 			assert(1U == wrapped_descriptor_set_bindings[binding_index].descriptor_count);
 		}
 		break;
 		case BRX_PAL_DESCRIPTOR_TYPE_READ_ONLY_STORAGE_BUFFER:
 		{
-			this->m_descriptor_layouts[binding_index].m_root_parameter_type = BRX_PAL_DESCRIPTOR_TYPE_READ_ONLY_STORAGE_BUFFER;
-			this->m_descriptor_layouts[binding_index].m_root_parameter_shader_register = wrapped_descriptor_set_bindings[binding_index].binding;
-			this->m_descriptor_layouts[binding_index].m_root_descriptor_table_num_descriptors = wrapped_descriptor_set_bindings[binding_index].descriptor_count;
+			this->m_descriptor_layouts[descriptor_layout_index].m_root_parameter_type = BRX_PAL_DESCRIPTOR_TYPE_READ_ONLY_STORAGE_BUFFER;
+			this->m_descriptor_layouts[descriptor_layout_index].m_root_parameter_shader_register = wrapped_descriptor_set_bindings[binding_index].binding;
+			this->m_descriptor_layouts[descriptor_layout_index].m_root_descriptor_table_num_descriptors = wrapped_descriptor_set_bindings[binding_index].descriptor_count;
 		}
 		break;
 		case BRX_PAL_DESCRIPTOR_TYPE_STORAGE_BUFFER:
 		{
-			this->m_descriptor_layouts[binding_index].m_root_parameter_type = BRX_PAL_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-			this->m_descriptor_layouts[binding_index].m_root_parameter_shader_register = wrapped_descriptor_set_bindings[binding_index].binding;
-			this->m_descriptor_layouts[binding_index].m_root_descriptor_table_num_descriptors = wrapped_descriptor_set_bindings[binding_index].descriptor_count;
+			this->m_descriptor_layouts[descriptor_layout_index].m_root_parameter_type = BRX_PAL_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+			this->m_descriptor_layouts[descriptor_layout_index].m_root_parameter_shader_register = wrapped_descriptor_set_bindings[binding_index].binding;
+			this->m_descriptor_layouts[descriptor_layout_index].m_root_descriptor_table_num_descriptors = wrapped_descriptor_set_bindings[binding_index].descriptor_count;
 		}
 		break;
 		case BRX_PAL_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
 		{
-			this->m_descriptor_layouts[binding_index].m_root_parameter_type = BRX_PAL_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
-			this->m_descriptor_layouts[binding_index].m_root_parameter_shader_register = wrapped_descriptor_set_bindings[binding_index].binding;
-			this->m_descriptor_layouts[binding_index].m_root_descriptor_table_num_descriptors = wrapped_descriptor_set_bindings[binding_index].descriptor_count;
+			this->m_descriptor_layouts[descriptor_layout_index].m_root_parameter_type = BRX_PAL_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+			this->m_descriptor_layouts[descriptor_layout_index].m_root_parameter_shader_register = wrapped_descriptor_set_bindings[binding_index].binding;
+			this->m_descriptor_layouts[descriptor_layout_index].m_root_descriptor_table_num_descriptors = wrapped_descriptor_set_bindings[binding_index].descriptor_count;
 		}
 		break;
 		case BRX_PAL_DESCRIPTOR_TYPE_SAMPLER:
 		{
-			this->m_descriptor_layouts[binding_index].m_root_parameter_type = BRX_PAL_DESCRIPTOR_TYPE_SAMPLER;
-			this->m_descriptor_layouts[binding_index].m_root_parameter_shader_register = wrapped_descriptor_set_bindings[binding_index].binding;
-			this->m_descriptor_layouts[binding_index].m_root_descriptor_table_num_descriptors = wrapped_descriptor_set_bindings[binding_index].descriptor_count;
+			this->m_descriptor_layouts[descriptor_layout_index].m_root_parameter_type = BRX_PAL_DESCRIPTOR_TYPE_SAMPLER;
+			this->m_descriptor_layouts[descriptor_layout_index].m_root_parameter_shader_register = wrapped_descriptor_set_bindings[binding_index].binding;
+			this->m_descriptor_layouts[descriptor_layout_index].m_root_descriptor_table_num_descriptors = wrapped_descriptor_set_bindings[binding_index].descriptor_count;
 		}
 		break;
 		case BRX_PAL_DESCRIPTOR_TYPE_STORAGE_IMAGE:
 		{
-			this->m_descriptor_layouts[binding_index].m_root_parameter_type = BRX_PAL_DESCRIPTOR_TYPE_STORAGE_IMAGE;
-			this->m_descriptor_layouts[binding_index].m_root_parameter_shader_register = wrapped_descriptor_set_bindings[binding_index].binding;
-			this->m_descriptor_layouts[binding_index].m_root_descriptor_table_num_descriptors = wrapped_descriptor_set_bindings[binding_index].descriptor_count;
+			this->m_descriptor_layouts[descriptor_layout_index].m_root_parameter_type = BRX_PAL_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+			this->m_descriptor_layouts[descriptor_layout_index].m_root_parameter_shader_register = wrapped_descriptor_set_bindings[binding_index].binding;
+			this->m_descriptor_layouts[descriptor_layout_index].m_root_descriptor_table_num_descriptors = wrapped_descriptor_set_bindings[binding_index].descriptor_count;
 		}
 		break;
 		case BRX_PAL_DESCRIPTOR_TYPE_TOP_LEVEL_ACCELERATION_STRUCTURE:
 		{
-			this->m_descriptor_layouts[binding_index].m_root_parameter_type = BRX_PAL_DESCRIPTOR_TYPE_TOP_LEVEL_ACCELERATION_STRUCTURE;
-			this->m_descriptor_layouts[binding_index].m_root_parameter_shader_register = wrapped_descriptor_set_bindings[binding_index].binding;
-			this->m_descriptor_layouts[binding_index].m_root_descriptor_table_num_descriptors = wrapped_descriptor_set_bindings[binding_index].descriptor_count;
+			this->m_descriptor_layouts[descriptor_layout_index].m_root_parameter_type = BRX_PAL_DESCRIPTOR_TYPE_TOP_LEVEL_ACCELERATION_STRUCTURE;
+			this->m_descriptor_layouts[descriptor_layout_index].m_root_parameter_shader_register = wrapped_descriptor_set_bindings[binding_index].binding;
+			this->m_descriptor_layouts[descriptor_layout_index].m_root_descriptor_table_num_descriptors = wrapped_descriptor_set_bindings[binding_index].descriptor_count;
 		}
 		break;
 		default:
 		{
 			assert(false);
-			this->m_descriptor_layouts[binding_index].m_root_parameter_type = static_cast<BRX_PAL_DESCRIPTOR_TYPE>(-1);
+			this->m_descriptor_layouts[descriptor_layout_index].m_root_parameter_type = static_cast<BRX_PAL_DESCRIPTOR_TYPE>(-1);
 		}
 		}
+
+		++descriptor_layout_index;
 	}
+	assert(this->m_descriptor_layouts.size() == descriptor_layout_index);
+}
+
+void brx_pal_d3d12_descriptor_set_layout::init_bindless(uint32_t read_only_storage_buffer_descriptor_count, uint32_t sampled_image_descriptor_count, uint32_t sampler_descriptor_count)
+{
+	assert(0U < read_only_storage_buffer_descriptor_count);
+	assert(0U < sampled_image_descriptor_count);
+	assert(0U < sampler_descriptor_count);
+
+	assert(0U == this->m_descriptor_layouts.size());
+	this->m_descriptor_layouts.resize(3U);
+
+	this->m_descriptor_layouts[0].m_root_parameter_type = BRX_PAL_DESCRIPTOR_TYPE_READ_ONLY_STORAGE_BUFFER;
+	this->m_descriptor_layouts[0].m_root_parameter_shader_register = 0U;
+	this->m_descriptor_layouts[0].m_root_descriptor_table_num_descriptors = read_only_storage_buffer_descriptor_count;
+
+	// the SRV ranges within the same register space are NOT allowed to overlap
+	this->m_descriptor_layouts[1].m_root_parameter_type = BRX_PAL_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+	this->m_descriptor_layouts[1].m_root_parameter_shader_register = read_only_storage_buffer_descriptor_count;
+	this->m_descriptor_layouts[1].m_root_descriptor_table_num_descriptors = sampled_image_descriptor_count;
+
+	this->m_descriptor_layouts[2].m_root_parameter_type = BRX_PAL_DESCRIPTOR_TYPE_SAMPLER;
+	this->m_descriptor_layouts[2].m_root_parameter_shader_register = 0U;
+	this->m_descriptor_layouts[2].m_root_descriptor_table_num_descriptors = sampler_descriptor_count;
+
+	assert(!this->m_update_after_bind);
+	this->m_update_after_bind = true;
 }
 
 void brx_pal_d3d12_descriptor_set_layout::uninit()
@@ -114,16 +197,51 @@ brx_pal_d3d12_descriptor_layout const *brx_pal_d3d12_descriptor_set_layout::get_
 	return descriptor_layouts;
 }
 
-brx_pal_d3d12_pipeline_layout::brx_pal_d3d12_pipeline_layout() : m_root_signature(NULL)
+uint32_t brx_pal_d3d12_descriptor_set_layout::get_static_sampler_count() const
 {
+	return static_cast<uint32_t>(this->m_static_samplers.size());
 }
 
-void brx_pal_d3d12_pipeline_layout::init(ID3D12Device *device, decltype(D3D12SerializeRootSignature) *pfn_d3d12_serialize_root_signature, uint32_t descriptor_set_layout_count, brx_pal_descriptor_set_layout const *const *descriptor_set_layouts)
+D3D12_STATIC_SAMPLER_DESC const *brx_pal_d3d12_descriptor_set_layout::get_static_samplers() const
+{
+	D3D12_STATIC_SAMPLER_DESC const *static_samplers;
+
+	if (this->m_static_samplers.size() > 0U)
+	{
+		static_samplers = &this->m_static_samplers[0];
+	}
+	else
+	{
+		static_samplers = NULL;
+	}
+
+	return static_samplers;
+}
+
+bool brx_pal_d3d12_descriptor_set_layout::is_update_after_bind() const
+{
+	return this->m_update_after_bind;
+}
+
+brx_pal_d3d12_pipeline_layout::brx_pal_d3d12_pipeline_layout() : m_root_signature(NULL), m_root_constants_root_parameter_index(-1)
+{
+}
+
+void brx_pal_d3d12_pipeline_layout::init(ID3D12Device *device, decltype(D3D12SerializeRootSignature) *pfn_d3d12_serialize_root_signature, uint32_t descriptor_set_layout_count, brx_pal_descriptor_set_layout const *const *descriptor_set_layouts, uint32_t push_constant_size)
 {
 	mcrt_vector<D3D12_ROOT_PARAMETER> root_parameters;
 	mcrt_vector<D3D12_DESCRIPTOR_RANGE> root_descriptor_table_ranges;
+	mcrt_vector<D3D12_STATIC_SAMPLER_DESC> static_samplers;
 	for (uint32_t set_index = 0U; set_index < descriptor_set_layout_count; ++set_index)
 	{
+		uint32_t static_sampler_count = static_cast<brx_pal_d3d12_descriptor_set_layout const *>(descriptor_set_layouts[set_index])->get_static_sampler_count();
+		D3D12_STATIC_SAMPLER_DESC const *set_static_samplers = static_cast<brx_pal_d3d12_descriptor_set_layout const *>(descriptor_set_layouts[set_index])->get_static_samplers();
+		for (uint32_t static_sampler_index = 0U; static_sampler_index < static_sampler_count; ++static_sampler_index)
+		{
+			static_samplers.push_back(set_static_samplers[static_sampler_index]);
+			static_samplers.back().RegisterSpace = set_index;
+		}
+
 		uint32_t binding_count = static_cast<brx_pal_d3d12_descriptor_set_layout const *>(descriptor_set_layouts[set_index])->get_descriptor_layout_count();
 		brx_pal_d3d12_descriptor_layout const *descriptor_layouts = static_cast<brx_pal_d3d12_descriptor_set_layout const *>(descriptor_set_layouts[set_index])->get_descriptor_layouts();
 		for (uint32_t binding_index = 0U; binding_index < binding_count; ++binding_index)
@@ -288,6 +406,24 @@ void brx_pal_d3d12_pipeline_layout::init(ID3D12Device *device, decltype(D3D12Ser
 		}
 	}
 
+	assert(0U == (push_constant_size & 3U));
+	assert(push_constant_size <= BRX_PAL_MAX_PUSH_CONSTANT_SIZE);
+	if (push_constant_size > 0U)
+	{
+		// the root constants are placed after all descriptor sets, and the register space is the next one after the last descriptor set
+		uint32_t const new_root_parameter_index = static_cast<uint32_t>(root_parameters.size());
+		root_parameters.emplace_back();
+
+		root_parameters[new_root_parameter_index].ParameterType = D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS;
+		root_parameters[new_root_parameter_index].Constants.ShaderRegister = 0U;
+		root_parameters[new_root_parameter_index].Constants.RegisterSpace = descriptor_set_layout_count;
+		root_parameters[new_root_parameter_index].Constants.Num32BitValues = (push_constant_size >> 2U);
+		root_parameters[new_root_parameter_index].ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
+
+		assert(static_cast<uint32_t>(-1) == this->m_root_constants_root_parameter_index);
+		this->m_root_constants_root_parameter_index = new_root_parameter_index;
+	}
+
 	// The memory address within "root_descriptor_table_ranges" may change when "emplace_back"
 	uint32_t const num_root_parameters = static_cast<uint32_t>(root_parameters.size());
 	for (uint32_t root_parameter_index = 0U; root_parameter_index < num_root_parameters; ++root_parameter_index)
@@ -301,9 +437,9 @@ void brx_pal_d3d12_pipeline_layout::init(ID3D12Device *device, decltype(D3D12Ser
 
 	D3D12_ROOT_SIGNATURE_DESC const root_signature_desc = {
 		num_root_parameters,
-		&root_parameters[0],
-		0U,
-		NULL,
+		(num_root_parameters > 0U) ? &root_parameters[0] : NULL,
+		static_cast<uint32_t>(static_samplers.size()),
+		(static_samplers.size() > 0U) ? &static_samplers[0] : NULL,
 		D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT};
 
 	ID3DBlob *new_blob_with_root_signature = NULL;
@@ -336,7 +472,12 @@ ID3D12RootSignature *brx_pal_d3d12_pipeline_layout::get_root_signature() const
 	return this->m_root_signature;
 }
 
-brx_pal_d3d12_descriptor_set::brx_pal_d3d12_descriptor_set()
+uint32_t brx_pal_d3d12_pipeline_layout::get_root_constants_root_parameter_index() const
+{
+	return this->m_root_constants_root_parameter_index;
+}
+
+brx_pal_d3d12_descriptor_set::brx_pal_d3d12_descriptor_set() : m_update_after_bind(false)
 {
 }
 
@@ -446,6 +587,80 @@ void brx_pal_d3d12_descriptor_set::init(brx_pal_d3d12_descriptor_allocator *desc
 		}
 		}
 	}
+
+	this->m_update_after_bind = unwrapped_descriptor_set_layout->is_update_after_bind();
+
+	if (this->m_update_after_bind)
+	{
+		// the descriptors which have never been written are created as the null descriptors (with NULL resource) by the descriptor allocator
+		// the view desc of the null descriptor should still be valid
+		for (brx_pal_d3d12_descriptor_binding &descriptor_binding : this->m_descriptor_bindings)
+		{
+			switch (descriptor_binding.m_root_parameter_type)
+			{
+			case BRX_PAL_DESCRIPTOR_TYPE_READ_ONLY_STORAGE_BUFFER:
+			{
+				D3D12_SHADER_RESOURCE_VIEW_DESC const null_shader_resource_view_desc = {
+					.Format = DXGI_FORMAT_R32_TYPELESS,
+					.ViewDimension = D3D12_SRV_DIMENSION_BUFFER,
+					.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING,
+					.Buffer = {
+						0U,
+						0U,
+						0U,
+						D3D12_BUFFER_SRV_FLAG_RAW}};
+
+				for (D3D12_SHADER_RESOURCE_VIEW_DESC &shader_resource_view_desc : descriptor_binding.m_root_descriptor_table_shader_resource_views)
+				{
+					shader_resource_view_desc = null_shader_resource_view_desc;
+				}
+			}
+			break;
+			case BRX_PAL_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+			{
+				D3D12_SHADER_RESOURCE_VIEW_DESC const null_shader_resource_view_desc = {
+					.Format = DXGI_FORMAT_R8G8B8A8_UNORM,
+					.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D,
+					.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING,
+					.Texture2D = {
+						0U,
+						1U,
+						0U,
+						0.0F}};
+
+				for (D3D12_SHADER_RESOURCE_VIEW_DESC &shader_resource_view_desc : descriptor_binding.m_root_descriptor_table_shader_resource_views)
+				{
+					shader_resource_view_desc = null_shader_resource_view_desc;
+				}
+			}
+			break;
+			case BRX_PAL_DESCRIPTOR_TYPE_SAMPLER:
+			{
+				D3D12_SAMPLER_DESC const null_sampler_desc = {
+					D3D12_FILTER_MIN_MAG_MIP_POINT,
+					D3D12_TEXTURE_ADDRESS_MODE_CLAMP,
+					D3D12_TEXTURE_ADDRESS_MODE_CLAMP,
+					D3D12_TEXTURE_ADDRESS_MODE_CLAMP,
+					0.0F,
+					1U,
+					D3D12_COMPARISON_FUNC_NEVER,
+					{0.0F, 0.0F, 0.0F, 0.0F},
+					0.0F,
+					1000.0F};
+
+				for (D3D12_SAMPLER_DESC &sampler_desc : descriptor_binding.m_root_descriptor_table_samplers)
+				{
+					sampler_desc = null_sampler_desc;
+				}
+			}
+			break;
+			default:
+			{
+				assert(false);
+			}
+			}
+		}
+	}
 }
 
 void brx_pal_d3d12_descriptor_set::uninit(brx_pal_d3d12_descriptor_allocator *descriptor_allocator)
@@ -462,11 +677,21 @@ brx_pal_d3d12_descriptor_set::~brx_pal_d3d12_descriptor_set()
 
 void brx_pal_d3d12_descriptor_set::write_descriptor(ID3D12Device *device, brx_pal_d3d12_descriptor_allocator *descriptor_allocator, uint32_t dst_binding, BRX_PAL_DESCRIPTOR_TYPE wrapped_descriptor_type, uint32_t dst_descriptor_start_index, uint32_t src_descriptor_count, brx_pal_uniform_upload_buffer const *const *src_dynamic_uniform_buffers, uint32_t const *src_dynamic_uniform_buffer_ranges, brx_pal_read_only_storage_buffer const *const *src_read_only_storage_buffers, brx_pal_storage_buffer const *const *src_storage_buffers, brx_pal_sampled_image const *const *src_sampled_images, brx_pal_storage_image const *const *src_storage_images, brx_pal_sampler const *const *src_samplers, brx_pal_top_level_acceleration_structure const *const *src_top_level_acceleration_structures)
 {
-	// we are NOT allowed to write the descriptor when the GPU is using
-	// it is safe the delete the cache here
-	descriptor_allocator->invalidate_descriptor_set(this);
+	if (!this->m_update_after_bind)
+	{
+		// we are NOT allowed to write the descriptor when the GPU is using
+		// it is safe the delete the cache here
+		descriptor_allocator->invalidate_descriptor_set(this);
+	}
 
 	uint32_t destination_descriptor_layout_index = -1;
+	if (this->m_update_after_bind)
+	{
+		// the shader register of the sampled images of the bindless descriptor set layout is NOT the same as the binding
+		assert(dst_binding < this->m_descriptor_bindings.size());
+		destination_descriptor_layout_index = dst_binding;
+	}
+	else
 	{
 		uint32_t const descriptor_layout_count = static_cast<uint32_t>(this->m_descriptor_bindings.size());
 		assert(0U < descriptor_layout_count);
@@ -692,6 +917,13 @@ void brx_pal_d3d12_descriptor_set::write_descriptor(ID3D12Device *device, brx_pa
 		assert(false);
 	}
 	}
+
+	if (this->m_update_after_bind)
+	{
+		// the descriptor set may be being used by the GPU and the cache is NOT allowed to be deleted
+		// only the descriptors which are NOT being used by the GPU are written into the cache
+		descriptor_allocator->update_descriptor_set(this, destination_descriptor_layout_index, dst_descriptor_start_index, src_descriptor_count);
+	}
 }
 
 uint32_t brx_pal_d3d12_descriptor_set::get_descriptor_binding_count() const
@@ -703,3 +935,115 @@ brx_pal_d3d12_descriptor_binding const *brx_pal_d3d12_descriptor_set::get_descri
 {
 	return this->m_descriptor_bindings.data();
 }
+
+brx_pal_d3d12_descriptor_update_template::brx_pal_d3d12_descriptor_update_template() : m_descriptor_count(0U)
+{
+}
+
+void brx_pal_d3d12_descriptor_update_template::init(uint32_t entry_count, BRX_PAL_DESCRIPTOR_UPDATE_TEMPLATE_ENTRY const *entries)
+{
+	assert(0U < entry_count);
+	assert(NULL != entries);
+
+	assert(0U == this->m_entries.size());
+	this->m_entries.assign(entries, entries + entry_count);
+
+	assert(0U == this->m_descriptor_count);
+	for (uint32_t entry_index = 0U; entry_index < entry_count; ++entry_index)
+	{
+		this->m_descriptor_count += entries[entry_index].descriptor_count;
+	}
+}
+
+void brx_pal_d3d12_descriptor_update_template::uninit()
+{
+	this->m_entries.clear();
+	this->m_descriptor_count = 0U;
+}
+
+brx_pal_d3d12_descriptor_update_template::~brx_pal_d3d12_descriptor_update_template()
+{
+	assert(0U == this->m_entries.size());
+}
+
+void brx_pal_d3d12_descriptor_update_template::write_descriptor_sets(ID3D12Device *device, brx_pal_d3d12_descriptor_allocator *descriptor_allocator, uint32_t descriptor_set_count, brx_pal_descriptor_set *const *wrapped_descriptor_sets, void const *const *src_descriptors, uint32_t const *src_dynamic_uniform_buffer_ranges) const
+{
+	assert(NULL != wrapped_descriptor_sets);
+	assert(NULL != src_descriptors);
+
+	// there is no native template in D3D12, and the entries are replayed into the CPU side records of the descriptor set
+	for (uint32_t descriptor_set_index = 0U; descriptor_set_index < descriptor_set_count; ++descriptor_set_index)
+	{
+		assert(NULL != wrapped_descriptor_sets[descriptor_set_index]);
+		brx_pal_d3d12_descriptor_set *const unwrapped_descriptor_set = static_cast<brx_pal_d3d12_descriptor_set *>(wrapped_descriptor_sets[descriptor_set_index]);
+
+		uint32_t descriptor_index = this->m_descriptor_count * descriptor_set_index;
+		for (BRX_PAL_DESCRIPTOR_UPDATE_TEMPLATE_ENTRY const &entry : this->m_entries)
+		{
+			for (uint32_t entry_descriptor_index = 0U; entry_descriptor_index < entry.descriptor_count; ++entry_descriptor_index)
+			{
+				void const *const src_descriptor = src_descriptors[descriptor_index];
+				assert(NULL != src_descriptor);
+
+				brx_pal_uniform_upload_buffer const *src_dynamic_uniform_buffer = NULL;
+				uint32_t const *src_dynamic_uniform_buffer_range = NULL;
+				brx_pal_read_only_storage_buffer const *src_read_only_storage_buffer = NULL;
+				brx_pal_storage_buffer const *src_storage_buffer = NULL;
+				brx_pal_sampled_image const *src_sampled_image = NULL;
+				brx_pal_storage_image const *src_storage_image = NULL;
+				brx_pal_sampler const *src_sampler = NULL;
+				brx_pal_top_level_acceleration_structure const *src_top_level_acceleration_structure = NULL;
+
+				switch (entry.descriptor_type)
+				{
+				case BRX_PAL_DESCRIPTOR_TYPE_DYNAMIC_UNIFORM_BUFFER:
+				{
+					assert(NULL != src_dynamic_uniform_buffer_ranges);
+					src_dynamic_uniform_buffer = static_cast<brx_pal_uniform_upload_buffer const *>(src_descriptor);
+					src_dynamic_uniform_buffer_range = &src_dynamic_uniform_buffer_ranges[descriptor_index];
+				}
+				break;
+				case BRX_PAL_DESCRIPTOR_TYPE_READ_ONLY_STORAGE_BUFFER:
+				{
+					src_read_only_storage_buffer = static_cast<brx_pal_read_only_storage_buffer const *>(src_descriptor);
+				}
+				break;
+				case BRX_PAL_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+				{
+					src_storage_buffer = static_cast<brx_pal_storage_buffer const *>(src_descriptor);
+				}
+				break;
+				case BRX_PAL_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+				{
+					src_sampled_image = static_cast<brx_pal_sampled_image const *>(src_descriptor);
+				}
+				break;
+				case BRX_PAL_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+				{
+					src_storage_image = static_cast<brx_pal_storage_image const *>(src_descriptor);
+				}
+				break;
+				case BRX_PAL_DESCRIPTOR_TYPE_SAMPLER:
+				{
+					src_sampler = static_cast<brx_pal_sampler const *>(src_descriptor);
+				}
+				break;
+				case BRX_PAL_DESCRIPTOR_TYPE_TOP_LEVEL_ACCELERATION_STRUCTURE:
+				{
+					src_top_level_acceleration_structure = static_cast<brx_pal_top_level_acceleration_structure const *>(src_descriptor);
+				}
+				break;
+				default:
+				{
+					assert(false);
+				}
+				}
+
+				// the write_descriptor expects NULL for the arrays of the other descriptor types
+				unwrapped_descriptor_set->write_descriptor(device, descriptor_allocator, entry.dst_binding, entry.descriptor_type, entry.dst_descriptor_start_index + entry_descriptor_index, 1U, (NULL != src_dynamic_uniform_buffer) ? &src_dynamic_uniform_buffer : NULL, src_dynamic_uniform_buffer_range, (NULL != src_read_only_storage_buffer) ? &src_read_only_storage_buffer : NULL, (NULL != src_storage_buffer) ? &src_storage_buffer : NULL, (NULL != src_sampled_image) ? &src_sampled_image : NULL, (NULL != src_storage_image) ? &src_storage_image : NULL, (NULL != src_sampler) ? &src_sampler : NULL, (NULL != src_top_level_acceleration_structure) ? &src_top_level_acceleration_structure : NULL);
+
+				++descriptor_index;
+			}
+		}
+	}
+}
@@ -390,3 +390,72 @@ void brx_pal_d3d12_descriptor_allocator::invalidate_descriptor_set(brx_pal_descr
 		}
 	}
 }
+
+void brx_pal_d3d12_descriptor_allocator::update_descriptor_set(brx_pal_descriptor_set const *wrapped_descriptor_set, uint32_t binding_index, uint32_t descriptor_start_index, uint32_t descriptor_count)
+{
+	brx_pal_d3d12_descriptor_set const *const descriptor_set = static_cast<brx_pal_d3d12_descriptor_set const *>(wrapped_descriptor_set);
+
+	assert(binding_index < descriptor_set->get_descriptor_binding_count());
+	brx_pal_d3d12_descriptor_binding const &descriptor_binding = descriptor_set->get_descriptor_bindings()[binding_index];
+
+	assert((descriptor_start_index + descriptor_count) <= descriptor_binding.m_root_descriptor_table_num_descriptors);
+
+	for (auto const &pipeline_set_descriptor_heap : this->m_pipeline_sets_descriptor_heap)
+	{
+		uint32_t const descriptor_set_count = static_cast<uint32_t>(pipeline_set_descriptor_heap.first.m_descriptor_sets.size());
+		for (uint32_t descriptor_set_index = 0U; descriptor_set_index < descriptor_set_count; ++descriptor_set_index)
+		{
+			if (pipeline_set_descriptor_heap.first.m_descriptor_sets[descriptor_set_index] != descriptor_set)
+			{
+				continue;
+			}
+
+			D3D12_GPU_DESCRIPTOR_HANDLE const base_descriptor_handle = pipeline_set_descriptor_heap.second.m_descriptor_sets_base_descriptor_handle[descriptor_set_index][binding_index];
+
+			switch (descriptor_binding.m_root_parameter_type)
+			{
+			case BRX_PAL_DESCRIPTOR_TYPE_READ_ONLY_STORAGE_BUFFER:
+			case BRX_PAL_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+			{
+				assert(descriptor_binding.m_root_descriptor_table_num_descriptors == descriptor_binding.m_root_descriptor_table_resources.size());
+				assert(descriptor_binding.m_root_descriptor_table_num_descriptors == descriptor_binding.m_root_descriptor_table_shader_resource_views.size());
+
+				ID3D12DescriptorHeap *const cbv_srv_uav_descriptor_heap = pipeline_set_descriptor_heap.second.m_cbv_srv_uav_descriptor_heap;
+				assert(NULL != cbv_srv_uav_descriptor_heap);
+
+				// the descriptor heap is shader visible and the descriptors are written by the CPU descriptor handle at the same offset
+				SIZE_T const base_cpu_descriptor_handle = cbv_srv_uav_descriptor_heap->GetCPUDescriptorHandleForHeapStart().ptr + static_cast<SIZE_T>(base_descriptor_handle.ptr - cbv_srv_uav_descriptor_heap->GetGPUDescriptorHandleForHeapStart().ptr);
+
+				for (uint32_t descriptor_index = descriptor_start_index; descriptor_index < (descriptor_start_index + descriptor_count); ++descriptor_index)
+				{
+					ID3D12Resource *const resource = descriptor_binding.m_root_descriptor_table_resources[descriptor_index];
+					D3D12_SHADER_RESOURCE_VIEW_DESC const &shader_resource_view = descriptor_binding.m_root_descriptor_table_shader_resource_views[descriptor_index];
+					this->m_device->CreateShaderResourceView(resource, &shader_resource_view, D3D12_CPU_DESCRIPTOR_HANDLE{base_cpu_descriptor_handle + this->m_cbv_srv_uav_descriptor_heap_descriptor_increment_size * descriptor_index});
+				}
+			}
+			break;
+			case BRX_PAL_DESCRIPTOR_TYPE_SAMPLER:
+			{
+				assert(descriptor_binding.m_root_descriptor_table_num_descriptors == descriptor_binding.m_root_descriptor_table_samplers.size());
+
+				ID3D12DescriptorHeap *const sampler_descriptor_heap = pipeline_set_descriptor_heap.second.m_sampler_descriptor_heap;
+				assert(NULL != sampler_descriptor_heap);
+
+				SIZE_T const base_cpu_descriptor_handle = sampler_descriptor_heap->GetCPUDescriptorHandleForHeapStart().ptr + static_cast<SIZE_T>(base_descriptor_handle.ptr - sampler_descriptor_heap->GetGPUDescriptorHandleForHeapStart().ptr);
+
+				for (uint32_t descriptor_index = descriptor_start_index; descriptor_index < (descriptor_start_index + descriptor_count); ++descriptor_index)
+				{
+					D3D12_SAMPLER_DESC const &sample = descriptor_binding.m_root_descriptor_table_samplers[descriptor_index];
+					this->m_device->CreateSampler(&sample, D3D12_CPU_DESCRIPTOR_HANDLE{base_cpu_descriptor_handle + this->m_sampler_descriptor_heap_descriptor_increment_size * descriptor_index});
+				}
+			}
+			break;
+			default:
+			{
+				// only the read only storage buffers, the sampled images and the samplers are allowed to be updated after bind
+				assert(false);
+			}
+			}
+		}
+	}
+}
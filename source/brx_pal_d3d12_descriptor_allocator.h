@@ -88,6 +88,7 @@ public:
 
 	brx_pal_d3d12_pipeline_set_descriptor_heap const *create_or_get_pipeline_set_descriptor_heap(uint32_t descriptor_set_count, brx_pal_descriptor_set const *const *descriptor_sets);
 	void invalidate_descriptor_set(brx_pal_descriptor_set const *descriptor_set);
+	void update_descriptor_set(brx_pal_descriptor_set const *descriptor_set, uint32_t binding_index, uint32_t descriptor_start_index, uint32_t descriptor_count);
 };
 
 #endif
\ No newline at end of file
@@ -17,13 +17,22 @@
 
 #include "brx_pal_d3d12_device.h"
 #include "brx_pal_d3d12_descriptor_allocator.h"
+#include "brx_pal_bindless_descriptor_index_allocator.h"
+#include "brx_pal_render_graph.h"
+#include "brx_pal_deferred_destruction_queue.h"
+#include "brx_pal_acceleration_structure_update_manager.h"
 #include "../../McRT-Malloc/include/mcrt_malloc.h"
 #include <assert.h>
 #include <new>
+#include <chrono>
 
 static constexpr DXGI_FORMAT const g_preferred_swap_chain_image_format = DXGI_FORMAT_R8G8B8A8_UNORM;
 static constexpr uint32_t const g_preferred_swap_chain_image_count = 3U;
 
+static inline DXGI_FORMAT _internal_unwrap_storage_image_format(BRX_PAL_STORAGE_IMAGE_FORMAT wrapped_storage_image_format);
+
+static inline uint64_t _internal_get_elapsed_nanoseconds(std::chrono::steady_clock::time_point begin_time, std::chrono::steady_clock::time_point end_time);
+
 extern brx_pal_device *brx_pal_create_d3d12_device(void *wsi_connection, bool support_ray_tracing)
 {
     void *new_unwrapped_device_base = mcrt_malloc(sizeof(brx_pal_d3d12_device), alignof(brx_pal_d3d12_device));
@@ -39,8 +48,14 @@ brx_pal_d3d12_device::brx_pal_d3d12_device()
       m_factory(NULL),
       m_adapter(NULL),
       m_device(NULL),
+      m_support_mesh_shader(false),
+      m_draw_mesh_tasks_indirect_command_signature(NULL),
+      m_subgroup_properties{0U, 0U, 0U, false},
+      m_support_bindless(false),
+      m_bindless_descriptor_limits{0U, 0U, 0U, 0U},
       m_graphics_queue(NULL),
       m_upload_queue(NULL),
+      m_compute_queue(NULL),
       m_memory_allocator(NULL),
       m_uniform_upload_buffer_memory_pool(NULL),
       m_staging_upload_buffer_memory_pool(NULL),
@@ -55,13 +70,17 @@ brx_pal_d3d12_device::brx_pal_d3d12_device()
       m_non_compacted_bottom_level_acceleration_structure_memory_pool(NULL),
       m_compacted_bottom_level_acceleration_structure_size_query_buffer_memory_pool(NULL),
       m_compacted_bottom_level_acceleration_structure_memory_pool(NULL),
+      m_serialized_bottom_level_acceleration_structure_buffer_memory_pool(NULL),
       m_top_level_acceleration_structure_instance_upload_buffer_memory_pool(NULL),
-      m_top_level_acceleration_structure_memory_pool(NULL)
+      m_top_level_acceleration_structure_memory_pool(NULL),
+      m_device_creation_timing{0U, 0U, 0U, 0U, 0U}
 {
 }
 
 void brx_pal_d3d12_device::init(bool support_ray_tracing)
 {
+    std::chrono::steady_clock::time_point const init_begin_time = std::chrono::steady_clock::now();
+
     HMODULE const dynamic_library_dxgi = GetModuleHandleW(L"DXGI.dll");
     assert(NULL != dynamic_library_dxgi);
 
@@ -109,6 +128,8 @@ void brx_pal_d3d12_device::init(bool support_ray_tracing)
         assert(SUCCEEDED(hr_create_factory));
     }
 
+    std::chrono::steady_clock::time_point const instance_creation_end_time = std::chrono::steady_clock::now();
+
     IDXGIAdapter *first_discrete_gpu_adapter = NULL;
     IDXGIAdapter *first_non_discrete_gpu_adapter = NULL;
 
@@ -182,6 +203,8 @@ void brx_pal_d3d12_device::init(bool support_ray_tracing)
         assert(false);
     }
 
+    std::chrono::steady_clock::time_point const physical_device_selection_end_time = std::chrono::steady_clock::now();
+
     assert(NULL == this->m_device);
     {
         HRESULT hr_create_device = pfn_d3d12_create_device(this->m_adapter, D3D_FEATURE_LEVEL_12_0, IID_PPV_ARGS(&this->m_device));
@@ -202,6 +225,100 @@ void brx_pal_d3d12_device::init(bool support_ray_tracing)
         assert((!this->m_cache_coherent_uma) || this->m_uma);
     }
 
+    // the sample count which is supported by both the color and the depth stencil attachments
+    {
+        DXGI_FORMAT const attachment_formats[] = {DXGI_FORMAT_R8G8B8A8_UNORM, DXGI_FORMAT_D32_FLOAT, DXGI_FORMAT_D32_FLOAT_S8X24_UINT};
+
+        uint32_t max_attachment_sample_count = 1U;
+        for (uint32_t sample_count = 8U; sample_count > 1U; sample_count >>= 1U)
+        {
+            bool sample_count_supported = true;
+            for (DXGI_FORMAT const attachment_format : attachment_formats)
+            {
+                D3D12_FEATURE_DATA_MULTISAMPLE_QUALITY_LEVELS feature_support_data = {attachment_format, sample_count, D3D12_MULTISAMPLE_QUALITY_LEVELS_FLAG_NONE, 0U};
+                HRESULT hr_check_feature_support = this->m_device->CheckFeatureSupport(D3D12_FEATURE_MULTISAMPLE_QUALITY_LEVELS, &feature_support_data, sizeof(feature_support_data));
+                if ((!SUCCEEDED(hr_check_feature_support)) || (0U == feature_support_data.NumQualityLevels))
+                {
+                    sample_count_supported = false;
+                    break;
+                }
+            }
+
+            if (sample_count_supported)
+            {
+                max_attachment_sample_count = sample_count;
+                break;
+            }
+        }
+
+        this->m_max_attachment_sample_count = max_attachment_sample_count;
+    }
+
+    // the multiview is implemented by the view instancing
+    {
+        D3D12_FEATURE_DATA_D3D12_OPTIONS3 feature_support_data = {};
+        HRESULT hr_check_feature_support = this->m_device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS3, &feature_support_data, sizeof(feature_support_data));
+
+        this->m_max_multiview_view_count = (SUCCEEDED(hr_check_feature_support) && (D3D12_VIEW_INSTANCING_TIER_NOT_SUPPORTED != feature_support_data.ViewInstancingTier)) ? D3D12_MAX_VIEW_INSTANCE_COUNT : 1U;
+    }
+
+    // the mesh shader is optional, and the "draw_mesh_tasks_indirect" is implemented by the "ExecuteIndirect"
+    assert(!this->m_support_mesh_shader);
+    {
+        D3D12_FEATURE_DATA_D3D12_OPTIONS7 feature_support_data = {};
+        HRESULT hr_check_feature_support = this->m_device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS7, &feature_support_data, sizeof(feature_support_data));
+
+        this->m_support_mesh_shader = (SUCCEEDED(hr_check_feature_support) && (D3D12_MESH_SHADER_TIER_NOT_SUPPORTED != feature_support_data.MeshShaderTier));
+    }
+
+    assert(NULL == this->m_draw_mesh_tasks_indirect_command_signature);
+    if (this->m_support_mesh_shader)
+    {
+        static_assert(sizeof(BRX_PAL_DRAW_MESH_TASKS_INDIRECT_COMMAND) == sizeof(D3D12_DISPATCH_MESH_ARGUMENTS), "");
+
+        D3D12_INDIRECT_ARGUMENT_DESC const indirect_argument_desc = {D3D12_INDIRECT_ARGUMENT_TYPE_DISPATCH_MESH};
+
+        D3D12_COMMAND_SIGNATURE_DESC const command_signature_desc = {
+            sizeof(BRX_PAL_DRAW_MESH_TASKS_INDIRECT_COMMAND),
+            1U,
+            &indirect_argument_desc,
+            0U};
+
+        HRESULT const hr_create_command_signature = this->m_device->CreateCommandSignature(&command_signature_desc, NULL, IID_PPV_ARGS(&this->m_draw_mesh_tasks_indirect_command_signature));
+        assert(SUCCEEDED(hr_create_command_signature));
+    }
+
+    // the wave size is specified by the "WaveSize" attribute (SM 6.6) in the shader rather than by the pipeline state object in D3D12
+    assert(!this->m_subgroup_properties.support_subgroup_size_control);
+    {
+        D3D12_FEATURE_DATA_D3D12_OPTIONS1 feature_support_data = {};
+        HRESULT hr_check_feature_support = this->m_device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS1, &feature_support_data, sizeof(feature_support_data));
+        assert(SUCCEEDED(hr_check_feature_support));
+
+        this->m_subgroup_properties.min_subgroup_size = feature_support_data.WaveLaneCountMin;
+        this->m_subgroup_properties.max_subgroup_size = feature_support_data.WaveLaneCountMax;
+        this->m_subgroup_properties.supported_operations = (!feature_support_data.WaveOps) ? 0U : (BRX_PAL_SUBGROUP_OPERATION_FLAG_BASIC | BRX_PAL_SUBGROUP_OPERATION_FLAG_VOTE | BRX_PAL_SUBGROUP_OPERATION_FLAG_ARITHMETIC | BRX_PAL_SUBGROUP_OPERATION_FLAG_BALLOT | BRX_PAL_SUBGROUP_OPERATION_FLAG_SHUFFLE | BRX_PAL_SUBGROUP_OPERATION_FLAG_QUAD);
+        this->m_subgroup_properties.support_subgroup_size_control = false;
+    }
+
+    // the SRVs are limited to 128 per stage by the resource binding tier 1, and the full descriptor heap is accessible since the resource binding tier 2
+    assert(!this->m_support_bindless);
+    {
+        D3D12_FEATURE_DATA_D3D12_OPTIONS feature_support_data = {};
+        HRESULT hr_check_feature_support = this->m_device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS, &feature_support_data, sizeof(feature_support_data));
+        assert(SUCCEEDED(hr_check_feature_support));
+
+        this->m_support_bindless = (feature_support_data.ResourceBindingTier >= D3D12_RESOURCE_BINDING_TIER_2);
+
+        if (this->m_support_bindless)
+        {
+            this->m_bindless_descriptor_limits.max_read_only_storage_buffer_descriptor_count = D3D12_MAX_SHADER_VISIBLE_DESCRIPTOR_HEAP_SIZE_TIER_2;
+            this->m_bindless_descriptor_limits.max_sampled_image_descriptor_count = D3D12_MAX_SHADER_VISIBLE_DESCRIPTOR_HEAP_SIZE_TIER_2;
+            this->m_bindless_descriptor_limits.max_sampler_descriptor_count = D3D12_MAX_SHADER_VISIBLE_SAMPLER_HEAP_SIZE;
+            this->m_bindless_descriptor_limits.max_resource_descriptor_count = D3D12_MAX_SHADER_VISIBLE_DESCRIPTOR_HEAP_SIZE_TIER_2;
+        }
+    }
+
     assert(NULL == this->m_graphics_queue);
     {
         D3D12_COMMAND_QUEUE_DESC command_queue_desc = {
@@ -228,6 +345,19 @@ void brx_pal_d3d12_device::init(bool support_ray_tracing)
         assert(SUCCEEDED(hr_create_command_queue));
     }
 
+    assert(NULL == this->m_compute_queue);
+    {
+        D3D12_COMMAND_QUEUE_DESC command_queue_desc = {
+            D3D12_COMMAND_LIST_TYPE_COMPUTE,
+            D3D12_COMMAND_QUEUE_PRIORITY_NORMAL,
+            D3D12_COMMAND_QUEUE_FLAG_NONE,
+            0U};
+        HRESULT hr_create_command_queue = this->m_device->CreateCommandQueue(&command_queue_desc, IID_PPV_ARGS(&this->m_compute_queue));
+        assert(SUCCEEDED(hr_create_command_queue));
+    }
+
+    std::chrono::steady_clock::time_point const device_creation_end_time = std::chrono::steady_clock::now();
+
     assert(NULL == this->m_memory_allocator);
     {
         D3D12MA::ALLOCATOR_DESC allocator_desc = {D3D12MA::ALLOCATOR_FLAG_SINGLETHREADED, this->m_device, 0U, NULL, this->m_adapter};
@@ -489,6 +619,26 @@ void brx_pal_d3d12_device::init(bool support_ray_tracing)
             assert(SUCCEEDED(hr_create_pool));
         }
 
+        assert(NULL == this->m_serialized_bottom_level_acceleration_structure_buffer_memory_pool);
+        {
+            // NOTE: the serialized data is both read and written by the host
+            D3D12MA::POOL_DESC const pool_desc = {
+                D3D12MA::POOL_FLAG_NONE,
+                {D3D12_HEAP_TYPE_CUSTOM,
+                 D3D12_CPU_PAGE_PROPERTY_WRITE_BACK,
+                 D3D12_MEMORY_POOL_L0,
+                 0U,
+                 0U},
+                D3D12_HEAP_FLAG_DENY_RT_DS_TEXTURES | D3D12_HEAP_FLAG_DENY_NON_RT_DS_TEXTURES,
+                0U,
+                0U,
+                0U,
+                D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT,
+                NULL};
+            HRESULT const hr_create_pool = this->m_memory_allocator->CreatePool(&pool_desc, &this->m_serialized_bottom_level_acceleration_structure_buffer_memory_pool);
+            assert(SUCCEEDED(hr_create_pool));
+        }
+
         assert(NULL == this->m_top_level_acceleration_structure_instance_upload_buffer_memory_pool);
         {
             D3D12MA::POOL_DESC const pool_desc = {
@@ -528,7 +678,29 @@ void brx_pal_d3d12_device::init(bool support_ray_tracing)
         }
     }
 
+    std::chrono::steady_clock::time_point const memory_allocator_creation_end_time = std::chrono::steady_clock::now();
+
     this->m_descriptor_allocator.init(this->m_device);
+
+    this->m_fence_object_pool.init(sizeof(brx_pal_d3d12_fence), alignof(brx_pal_d3d12_fence));
+    this->m_descriptor_set_object_pool.init(sizeof(brx_pal_d3d12_descriptor_set), alignof(brx_pal_d3d12_descriptor_set));
+    this->m_graphics_pipeline_object_pool.init(sizeof(brx_pal_d3d12_graphics_pipeline), alignof(brx_pal_d3d12_graphics_pipeline));
+    this->m_compute_pipeline_object_pool.init(sizeof(brx_pal_d3d12_compute_pipeline), alignof(brx_pal_d3d12_compute_pipeline));
+    this->m_uniform_upload_buffer_object_pool.init(sizeof(brx_pal_d3d12_uniform_upload_buffer), alignof(brx_pal_d3d12_uniform_upload_buffer));
+    this->m_staging_upload_buffer_object_pool.init(sizeof(brx_pal_d3d12_staging_upload_buffer), alignof(brx_pal_d3d12_staging_upload_buffer));
+    this->m_storage_intermediate_buffer_object_pool.init(sizeof(brx_pal_d3d12_storage_intermediate_buffer), alignof(brx_pal_d3d12_storage_intermediate_buffer));
+    this->m_color_attachment_image_object_pool.init(sizeof(brx_pal_d3d12_color_attachment_intermediate_image), alignof(brx_pal_d3d12_color_attachment_intermediate_image));
+    this->m_depth_stencil_attachment_image_object_pool.init(sizeof(brx_pal_d3d12_depth_stencil_attachment_intermediate_image), alignof(brx_pal_d3d12_depth_stencil_attachment_intermediate_image));
+    this->m_storage_image_object_pool.init(sizeof(brx_pal_d3d12_storage_intermediate_image), alignof(brx_pal_d3d12_storage_intermediate_image));
+    this->m_sampled_asset_image_object_pool.init(sizeof(brx_pal_d3d12_sampled_asset_image), alignof(brx_pal_d3d12_sampled_asset_image));
+
+    std::chrono::steady_clock::time_point const init_end_time = std::chrono::steady_clock::now();
+
+    this->m_device_creation_timing.instance_creation_nanoseconds = _internal_get_elapsed_nanoseconds(init_begin_time, instance_creation_end_time);
+    this->m_device_creation_timing.physical_device_selection_nanoseconds = _internal_get_elapsed_nanoseconds(instance_creation_end_time, physical_device_selection_end_time);
+    this->m_device_creation_timing.device_creation_nanoseconds = _internal_get_elapsed_nanoseconds(physical_device_selection_end_time, device_creation_end_time);
+    this->m_device_creation_timing.memory_allocator_creation_nanoseconds = _internal_get_elapsed_nanoseconds(device_creation_end_time, memory_allocator_creation_end_time);
+    this->m_device_creation_timing.total_nanoseconds = _internal_get_elapsed_nanoseconds(init_begin_time, init_end_time);
 }
 
 extern void brx_pal_destroy_d3d12_device(brx_pal_device *wrapped_device)
@@ -546,6 +718,18 @@ void brx_pal_d3d12_device::uninit()
 {
     this->m_descriptor_allocator.uninit();
 
+    this->m_fence_object_pool.uninit();
+    this->m_descriptor_set_object_pool.uninit();
+    this->m_graphics_pipeline_object_pool.uninit();
+    this->m_compute_pipeline_object_pool.uninit();
+    this->m_uniform_upload_buffer_object_pool.uninit();
+    this->m_staging_upload_buffer_object_pool.uninit();
+    this->m_storage_intermediate_buffer_object_pool.uninit();
+    this->m_color_attachment_image_object_pool.uninit();
+    this->m_depth_stencil_attachment_image_object_pool.uninit();
+    this->m_storage_image_object_pool.uninit();
+    this->m_sampled_asset_image_object_pool.uninit();
+
     assert(NULL != this->m_uniform_upload_buffer_memory_pool);
     this->m_uniform_upload_buffer_memory_pool->Release();
     this->m_uniform_upload_buffer_memory_pool = NULL;
@@ -600,6 +784,10 @@ void brx_pal_d3d12_device::uninit()
         this->m_compacted_bottom_level_acceleration_structure_memory_pool->Release();
         this->m_compacted_bottom_level_acceleration_structure_memory_pool = NULL;
 
+        assert(NULL != this->m_serialized_bottom_level_acceleration_structure_buffer_memory_pool);
+        this->m_serialized_bottom_level_acceleration_structure_buffer_memory_pool->Release();
+        this->m_serialized_bottom_level_acceleration_structure_buffer_memory_pool = NULL;
+
         assert(NULL != this->m_top_level_acceleration_structure_instance_upload_buffer_memory_pool);
         this->m_top_level_acceleration_structure_instance_upload_buffer_memory_pool->Release();
         this->m_top_level_acceleration_structure_instance_upload_buffer_memory_pool = NULL;
@@ -617,6 +805,17 @@ void brx_pal_d3d12_device::uninit()
     this->m_graphics_queue->Release();
     this->m_graphics_queue = NULL;
 
+    if (this->m_support_mesh_shader)
+    {
+        assert(NULL != this->m_draw_mesh_tasks_indirect_command_signature);
+        this->m_draw_mesh_tasks_indirect_command_signature->Release();
+        this->m_draw_mesh_tasks_indirect_command_signature = NULL;
+    }
+    else
+    {
+        assert(NULL == this->m_draw_mesh_tasks_indirect_command_signature);
+    }
+
     if ((!this->m_uma) || this->m_support_ray_tracing)
     {
         this->m_upload_queue->Release();
@@ -627,6 +826,10 @@ void brx_pal_d3d12_device::uninit()
         assert(NULL == this->m_upload_queue);
     }
 
+    assert(NULL != this->m_compute_queue);
+    this->m_compute_queue->Release();
+    this->m_compute_queue = NULL;
+
     assert(NULL != this->m_device);
     this->m_device->Release();
     this->m_device = NULL;
@@ -648,6 +851,7 @@ brx_pal_d3d12_device::~brx_pal_d3d12_device()
     assert(NULL == this->m_factory);
     assert(NULL == this->m_adapter);
     assert(NULL == this->m_device);
+    assert(NULL == this->m_draw_mesh_tasks_indirect_command_signature);
     assert(NULL == this->m_memory_allocator);
     assert(NULL == this->m_uniform_upload_buffer_memory_pool);
     assert(NULL == this->m_staging_upload_buffer_memory_pool);
@@ -662,6 +866,7 @@ brx_pal_d3d12_device::~brx_pal_d3d12_device()
     assert(NULL == this->m_non_compacted_bottom_level_acceleration_structure_memory_pool);
     assert(NULL == this->m_compacted_bottom_level_acceleration_structure_size_query_buffer_memory_pool);
     assert(NULL == this->m_compacted_bottom_level_acceleration_structure_memory_pool);
+    assert(NULL == this->m_serialized_bottom_level_acceleration_structure_buffer_memory_pool);
     assert(NULL == this->m_top_level_acceleration_structure_instance_upload_buffer_memory_pool);
     assert(NULL == this->m_top_level_acceleration_structure_memory_pool);
 }
@@ -676,6 +881,12 @@ bool brx_pal_d3d12_device::is_ray_tracing_supported() const
     return this->m_support_ray_tracing;
 }
 
+bool brx_pal_d3d12_device::is_dynamic_rendering_supported() const
+{
+    // the render targets are always bound by the "OMSetRenderTargets" in D3D12
+    return true;
+}
+
 brx_pal_graphics_queue *brx_pal_d3d12_device::create_graphics_queue() const
 {
     void *new_unwrapped_graphics_queue_base = mcrt_malloc(sizeof(brx_pal_d3d12_graphics_queue), alignof(brx_pal_d3d12_graphics_queue));
@@ -718,13 +929,34 @@ void brx_pal_d3d12_device::destroy_upload_queue(brx_pal_upload_queue *wrapped_up
     mcrt_free(delete_unwrapped_upload_queue);
 }
 
+brx_pal_compute_queue *brx_pal_d3d12_device::create_compute_queue() const
+{
+    void *new_unwrapped_compute_queue_base = mcrt_malloc(sizeof(brx_pal_d3d12_compute_queue), alignof(brx_pal_d3d12_compute_queue));
+    assert(NULL != new_unwrapped_compute_queue_base);
+
+    brx_pal_d3d12_compute_queue *new_unwrapped_compute_queue = new (new_unwrapped_compute_queue_base) brx_pal_d3d12_compute_queue{};
+    new_unwrapped_compute_queue->init(this->m_graphics_queue, this->m_compute_queue);
+    return new_unwrapped_compute_queue;
+}
+
+void brx_pal_d3d12_device::destroy_compute_queue(brx_pal_compute_queue *wrapped_compute_queue) const
+{
+    assert(NULL != wrapped_compute_queue);
+    brx_pal_d3d12_compute_queue *delete_unwrapped_compute_queue = static_cast<brx_pal_d3d12_compute_queue *>(wrapped_compute_queue);
+
+    delete_unwrapped_compute_queue->uninit(this->m_graphics_queue, this->m_compute_queue);
+
+    delete_unwrapped_compute_queue->~brx_pal_d3d12_compute_queue();
+    mcrt_free(delete_unwrapped_compute_queue);
+}
+
 brx_pal_graphics_command_buffer *brx_pal_d3d12_device::create_graphics_command_buffer() const
 {
     void *new_unwrapped_graphics_command_buffer_base = mcrt_malloc(sizeof(brx_pal_d3d12_graphics_command_buffer), alignof(brx_pal_d3d12_graphics_command_buffer));
     assert(NULL != new_unwrapped_graphics_command_buffer_base);
 
     brx_pal_d3d12_graphics_command_buffer *new_unwrapped_graphics_command_buffer = new (new_unwrapped_graphics_command_buffer_base) brx_pal_d3d12_graphics_command_buffer{};
-    new_unwrapped_graphics_command_buffer->init(this->m_device, this->m_uma, this->m_support_ray_tracing, const_cast<brx_pal_d3d12_descriptor_allocator *>(&this->m_descriptor_allocator));
+    new_unwrapped_graphics_command_buffer->init(this->m_device, D3D12_COMMAND_LIST_TYPE_DIRECT, this->m_uma, this->m_support_ray_tracing, this->m_draw_mesh_tasks_indirect_command_signature, const_cast<brx_pal_d3d12_descriptor_allocator *>(&this->m_descriptor_allocator));
     return new_unwrapped_graphics_command_buffer;
 }
 
@@ -787,6 +1019,41 @@ void brx_pal_d3d12_device::destroy_upload_command_buffer(brx_pal_upload_command_
     mcrt_free(delete_unwrapped_upload_command_buffer);
 }
 
+brx_pal_compute_command_buffer *brx_pal_d3d12_device::create_compute_command_buffer() const
+{
+    void *new_unwrapped_compute_command_buffer_base = mcrt_malloc(sizeof(brx_pal_d3d12_compute_command_buffer), alignof(brx_pal_d3d12_compute_command_buffer));
+    assert(NULL != new_unwrapped_compute_command_buffer_base);
+
+    brx_pal_d3d12_compute_command_buffer *new_unwrapped_compute_command_buffer = new (new_unwrapped_compute_command_buffer_base) brx_pal_d3d12_compute_command_buffer{};
+    new_unwrapped_compute_command_buffer->init(this->m_device, this->m_uma, this->m_support_ray_tracing, const_cast<brx_pal_d3d12_descriptor_allocator *>(&this->m_descriptor_allocator));
+    return new_unwrapped_compute_command_buffer;
+}
+
+void brx_pal_d3d12_device::reset_compute_command_buffer(brx_pal_compute_command_buffer *compute_command_buffer) const
+{
+    assert(NULL != compute_command_buffer);
+
+    ID3D12CommandAllocator *command_allocator = static_cast<brx_pal_d3d12_compute_command_buffer *>(compute_command_buffer)->get_command_allocator();
+    ID3D12CommandAllocator *graphics_queue_command_allocator = static_cast<brx_pal_d3d12_compute_command_buffer *>(compute_command_buffer)->get_graphics_queue_command_allocator();
+
+    HRESULT hr_reset = command_allocator->Reset();
+    assert(SUCCEEDED(hr_reset));
+
+    HRESULT hr_reset_graphics_queue = graphics_queue_command_allocator->Reset();
+    assert(SUCCEEDED(hr_reset_graphics_queue));
+}
+
+void brx_pal_d3d12_device::destroy_compute_command_buffer(brx_pal_compute_command_buffer *wrapped_compute_command_buffer) const
+{
+    assert(NULL != wrapped_compute_command_buffer);
+    brx_pal_d3d12_compute_command_buffer *delete_unwrapped_compute_command_buffer = static_cast<brx_pal_d3d12_compute_command_buffer *>(wrapped_compute_command_buffer);
+
+    delete_unwrapped_compute_command_buffer->uninit();
+
+    delete_unwrapped_compute_command_buffer->~brx_pal_d3d12_compute_command_buffer();
+    mcrt_free(delete_unwrapped_compute_command_buffer);
+}
+
 brx_pal_fence *brx_pal_d3d12_device::create_fence(bool signaled) const
 {
     ID3D12Fence *new_fence = NULL;
@@ -800,7 +1067,7 @@ brx_pal_fence *brx_pal_d3d12_device::create_fence(bool signaled) const
         assert((signaled ? 1U : 0U) == new_fence->GetCompletedValue());
     }
 
-    void *new_brx_pal_fence_base = mcrt_malloc(sizeof(brx_pal_d3d12_fence), alignof(brx_pal_d3d12_fence));
+    void *new_brx_pal_fence_base = this->m_fence_object_pool.allocate();
     assert(NULL != new_brx_pal_fence_base);
 
     brx_pal_d3d12_fence *new_brx_pal_fence = new (new_brx_pal_fence_base) brx_pal_d3d12_fence{new_fence};
@@ -840,7 +1107,7 @@ void brx_pal_d3d12_device::destroy_fence(brx_pal_fence *brx_pal_fence) const
     delete_fence->steal(&stealed_fence);
 
     delete_fence->~brx_pal_d3d12_fence();
-    mcrt_free(delete_fence);
+    this->m_fence_object_pool.free(delete_fence);
 
     stealed_fence->Release();
 }
@@ -866,13 +1133,13 @@ void brx_pal_d3d12_device::destroy_descriptor_set_layout(brx_pal_descriptor_set_
     mcrt_free(delete_unwrapped_descriptor_set_layout);
 }
 
-brx_pal_pipeline_layout *brx_pal_d3d12_device::create_pipeline_layout(uint32_t descriptor_set_layout_count, brx_pal_descriptor_set_layout const *const *descriptor_set_layouts) const
+brx_pal_pipeline_layout *brx_pal_d3d12_device::create_pipeline_layout(uint32_t descriptor_set_layout_count, brx_pal_descriptor_set_layout const *const *descriptor_set_layouts, uint32_t push_constant_size) const
 {
     void *new_unwrapped_pipeline_layout_base = mcrt_malloc(sizeof(brx_pal_d3d12_pipeline_layout), alignof(brx_pal_d3d12_pipeline_layout));
     assert(NULL != new_unwrapped_pipeline_layout_base);
 
     brx_pal_d3d12_pipeline_layout *new_unwrapped_pipeline_layout = new (new_unwrapped_pipeline_layout_base) brx_pal_d3d12_pipeline_layout{};
-    new_unwrapped_pipeline_layout->init(this->m_device, this->m_pfn_d3d12_serialize_root_signature, descriptor_set_layout_count, descriptor_set_layouts);
+    new_unwrapped_pipeline_layout->init(this->m_device, this->m_pfn_d3d12_serialize_root_signature, descriptor_set_layout_count, descriptor_set_layouts, push_constant_size);
     return new_unwrapped_pipeline_layout;
 }
 
@@ -889,7 +1156,7 @@ void brx_pal_d3d12_device::destroy_pipeline_layout(brx_pal_pipeline_layout *wrap
 
 brx_pal_descriptor_set *brx_pal_d3d12_device::create_descriptor_set(brx_pal_descriptor_set_layout const *descriptor_set_layout, uint32_t unbounded_descriptor_count)
 {
-    void *new_unwrapped_descriptor_set_base = mcrt_malloc(sizeof(brx_pal_d3d12_descriptor_set), alignof(brx_pal_d3d12_descriptor_set));
+    void *new_unwrapped_descriptor_set_base = this->m_descriptor_set_object_pool.allocate();
     assert(NULL != new_unwrapped_descriptor_set_base);
 
     brx_pal_d3d12_descriptor_set *new_unwrapped_descriptor_set = new (new_unwrapped_descriptor_set_base) brx_pal_d3d12_descriptor_set{};
@@ -913,10 +1180,208 @@ void brx_pal_d3d12_device::destroy_descriptor_set(brx_pal_descriptor_set *wrappe
     delete_unwrapped_descriptor_set->uninit(&this->m_descriptor_allocator);
 
     delete_unwrapped_descriptor_set->~brx_pal_d3d12_descriptor_set();
-    mcrt_free(delete_unwrapped_descriptor_set);
+    this->m_descriptor_set_object_pool.free(delete_unwrapped_descriptor_set);
+}
+
+brx_pal_descriptor_update_template *brx_pal_d3d12_device::create_descriptor_update_template(brx_pal_descriptor_set_layout const *descriptor_set_layout, uint32_t entry_count, BRX_PAL_DESCRIPTOR_UPDATE_TEMPLATE_ENTRY const *entries) const
+{
+    assert(NULL != descriptor_set_layout);
+
+    void *new_unwrapped_descriptor_update_template_base = mcrt_malloc(sizeof(brx_pal_d3d12_descriptor_update_template), alignof(brx_pal_d3d12_descriptor_update_template));
+    assert(NULL != new_unwrapped_descriptor_update_template_base);
+
+    brx_pal_d3d12_descriptor_update_template *new_unwrapped_descriptor_update_template = new (new_unwrapped_descriptor_update_template_base) brx_pal_d3d12_descriptor_update_template{};
+    new_unwrapped_descriptor_update_template->init(entry_count, entries);
+    return new_unwrapped_descriptor_update_template;
+}
+
+void brx_pal_d3d12_device::destroy_descriptor_update_template(brx_pal_descriptor_update_template *wrapped_descriptor_update_template) const
+{
+    assert(NULL != wrapped_descriptor_update_template);
+    brx_pal_d3d12_descriptor_update_template *delete_unwrapped_descriptor_update_template = static_cast<brx_pal_d3d12_descriptor_update_template *>(wrapped_descriptor_update_template);
+
+    delete_unwrapped_descriptor_update_template->uninit();
+
+    delete_unwrapped_descriptor_update_template->~brx_pal_d3d12_descriptor_update_template();
+    mcrt_free(delete_unwrapped_descriptor_update_template);
+}
+
+void brx_pal_d3d12_device::write_descriptor_sets_with_template(uint32_t descriptor_set_count, brx_pal_descriptor_set *const *descriptor_sets, brx_pal_descriptor_update_template const *wrapped_descriptor_update_template, void const *const *src_descriptors, uint32_t const *src_dynamic_uniform_buffer_ranges)
+{
+    assert(NULL != wrapped_descriptor_update_template);
+    brx_pal_d3d12_descriptor_update_template const *const unwrapped_descriptor_update_template = static_cast<brx_pal_d3d12_descriptor_update_template const *>(wrapped_descriptor_update_template);
+
+    unwrapped_descriptor_update_template->write_descriptor_sets(this->m_device, &this->m_descriptor_allocator, descriptor_set_count, descriptor_sets, src_descriptors, src_dynamic_uniform_buffer_ranges);
+}
+
+bool brx_pal_d3d12_device::is_bindless_supported() const
+{
+    return this->m_support_bindless;
+}
+
+void brx_pal_d3d12_device::get_bindless_descriptor_limits(BRX_PAL_BINDLESS_DESCRIPTOR_LIMITS *bindless_descriptor_limits) const
+{
+    (*bindless_descriptor_limits) = this->m_bindless_descriptor_limits;
+}
+
+brx_pal_descriptor_set_layout *brx_pal_d3d12_device::create_bindless_descriptor_set_layout(uint32_t read_only_storage_buffer_descriptor_count, uint32_t sampled_image_descriptor_count, uint32_t sampler_descriptor_count) const
+{
+    assert(this->m_support_bindless);
+    assert(read_only_storage_buffer_descriptor_count <= this->m_bindless_descriptor_limits.max_read_only_storage_buffer_descriptor_count);
+    assert(sampled_image_descriptor_count <= this->m_bindless_descriptor_limits.max_sampled_image_descriptor_count);
+    assert(sampler_descriptor_count <= this->m_bindless_descriptor_limits.max_sampler_descriptor_count);
+    assert((static_cast<uint64_t>(read_only_storage_buffer_descriptor_count) + static_cast<uint64_t>(sampled_image_descriptor_count)) <= static_cast<uint64_t>(this->m_bindless_descriptor_limits.max_resource_descriptor_count));
+
+    void *new_unwrapped_descriptor_set_layout_base = mcrt_malloc(sizeof(brx_pal_d3d12_descriptor_set_layout), alignof(brx_pal_d3d12_descriptor_set_layout));
+    assert(NULL != new_unwrapped_descriptor_set_layout_base);
+
+    brx_pal_d3d12_descriptor_set_layout *new_unwrapped_descriptor_set_layout = new (new_unwrapped_descriptor_set_layout_base) brx_pal_d3d12_descriptor_set_layout{};
+    new_unwrapped_descriptor_set_layout->init_bindless(read_only_storage_buffer_descriptor_count, sampled_image_descriptor_count, sampler_descriptor_count);
+    return new_unwrapped_descriptor_set_layout;
+}
+
+brx_pal_bindless_descriptor_index_allocator *brx_pal_d3d12_device::create_bindless_descriptor_index_allocator(uint32_t read_only_storage_buffer_descriptor_count, uint32_t sampled_image_descriptor_count, uint32_t sampler_descriptor_count, uint32_t frame_throttling_count) const
+{
+    void *new_bindless_descriptor_index_allocator_base = mcrt_malloc(sizeof(brx_pal_lock_free_bindless_descriptor_index_allocator), alignof(brx_pal_lock_free_bindless_descriptor_index_allocator));
+    assert(NULL != new_bindless_descriptor_index_allocator_base);
+
+    brx_pal_lock_free_bindless_descriptor_index_allocator *new_bindless_descriptor_index_allocator = new (new_bindless_descriptor_index_allocator_base) brx_pal_lock_free_bindless_descriptor_index_allocator{};
+    new_bindless_descriptor_index_allocator->init(read_only_storage_buffer_descriptor_count, sampled_image_descriptor_count, sampler_descriptor_count, frame_throttling_count);
+    return new_bindless_descriptor_index_allocator;
+}
+
+void brx_pal_d3d12_device::destroy_bindless_descriptor_index_allocator(brx_pal_bindless_descriptor_index_allocator *wrapped_bindless_descriptor_index_allocator) const
+{
+    assert(NULL != wrapped_bindless_descriptor_index_allocator);
+    brx_pal_lock_free_bindless_descriptor_index_allocator *delete_bindless_descriptor_index_allocator = static_cast<brx_pal_lock_free_bindless_descriptor_index_allocator *>(wrapped_bindless_descriptor_index_allocator);
+
+    delete_bindless_descriptor_index_allocator->uninit();
+
+    delete_bindless_descriptor_index_allocator->~brx_pal_lock_free_bindless_descriptor_index_allocator();
+    mcrt_free(delete_bindless_descriptor_index_allocator);
+}
+
+brx_pal_render_graph *brx_pal_d3d12_device::create_render_graph(uint32_t frame_throttling_count) const
+{
+    void *new_render_graph_base = mcrt_malloc(sizeof(brx_pal_transient_render_graph), alignof(brx_pal_transient_render_graph));
+    assert(NULL != new_render_graph_base);
+
+    brx_pal_transient_render_graph *new_render_graph = new (new_render_graph_base) brx_pal_transient_render_graph{};
+    new_render_graph->init(this, frame_throttling_count);
+    return new_render_graph;
+}
+
+void brx_pal_d3d12_device::destroy_render_graph(brx_pal_render_graph *wrapped_render_graph) const
+{
+    assert(NULL != wrapped_render_graph);
+    brx_pal_transient_render_graph *delete_render_graph = static_cast<brx_pal_transient_render_graph *>(wrapped_render_graph);
+
+    delete_render_graph->uninit();
+
+    delete_render_graph->~brx_pal_transient_render_graph();
+    mcrt_free(delete_render_graph);
+}
+
+brx_pal_deferred_destruction_queue *brx_pal_d3d12_device::create_deferred_destruction_queue(uint32_t frame_throttling_count)
+{
+    void *new_deferred_destruction_queue_base = mcrt_malloc(sizeof(brx_pal_frame_deferred_destruction_queue), alignof(brx_pal_frame_deferred_destruction_queue));
+    assert(NULL != new_deferred_destruction_queue_base);
+
+    brx_pal_frame_deferred_destruction_queue *new_deferred_destruction_queue = new (new_deferred_destruction_queue_base) brx_pal_frame_deferred_destruction_queue{};
+    new_deferred_destruction_queue->init(this, frame_throttling_count);
+    return new_deferred_destruction_queue;
+}
+
+void brx_pal_d3d12_device::destroy_deferred_destruction_queue(brx_pal_deferred_destruction_queue *wrapped_deferred_destruction_queue)
+{
+    assert(NULL != wrapped_deferred_destruction_queue);
+    brx_pal_frame_deferred_destruction_queue *delete_deferred_destruction_queue = static_cast<brx_pal_frame_deferred_destruction_queue *>(wrapped_deferred_destruction_queue);
+
+    delete_deferred_destruction_queue->uninit();
+
+    delete_deferred_destruction_queue->~brx_pal_frame_deferred_destruction_queue();
+    mcrt_free(delete_deferred_destruction_queue);
+}
+
+brx_pal_acceleration_structure_update_manager *brx_pal_d3d12_device::create_acceleration_structure_update_manager(BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_POLICY const *policy) const
+{
+    void *new_acceleration_structure_update_manager_base = mcrt_malloc(sizeof(brx_pal_budgeted_acceleration_structure_update_manager), alignof(brx_pal_budgeted_acceleration_structure_update_manager));
+    assert(NULL != new_acceleration_structure_update_manager_base);
+
+    brx_pal_budgeted_acceleration_structure_update_manager *new_acceleration_structure_update_manager = new (new_acceleration_structure_update_manager_base) brx_pal_budgeted_acceleration_structure_update_manager{};
+    new_acceleration_structure_update_manager->init(policy);
+    return new_acceleration_structure_update_manager;
+}
+
+void brx_pal_d3d12_device::destroy_acceleration_structure_update_manager(brx_pal_acceleration_structure_update_manager *wrapped_acceleration_structure_update_manager) const
+{
+    assert(NULL != wrapped_acceleration_structure_update_manager);
+    brx_pal_budgeted_acceleration_structure_update_manager *delete_acceleration_structure_update_manager = static_cast<brx_pal_budgeted_acceleration_structure_update_manager *>(wrapped_acceleration_structure_update_manager);
+
+    delete_acceleration_structure_update_manager->uninit();
+
+    delete_acceleration_structure_update_manager->~brx_pal_budgeted_acceleration_structure_update_manager();
+    mcrt_free(delete_acceleration_structure_update_manager);
+}
+
+void brx_pal_d3d12_device::get_object_pool_statistics(BRX_PAL_OBJECT_POOL_TYPE object_pool_type, uint32_t *live_object_count, uint32_t *reserved_object_count) const
+{
+    brx_pal_lock_free_object_pool const *object_pool;
+    switch (object_pool_type)
+    {
+    case BRX_PAL_OBJECT_POOL_TYPE_FENCE:
+        object_pool = &this->m_fence_object_pool;
+        break;
+    case BRX_PAL_OBJECT_POOL_TYPE_DESCRIPTOR_SET:
+        object_pool = &this->m_descriptor_set_object_pool;
+        break;
+    case BRX_PAL_OBJECT_POOL_TYPE_GRAPHICS_PIPELINE:
+        object_pool = &this->m_graphics_pipeline_object_pool;
+        break;
+    case BRX_PAL_OBJECT_POOL_TYPE_COMPUTE_PIPELINE:
+        object_pool = &this->m_compute_pipeline_object_pool;
+        break;
+    case BRX_PAL_OBJECT_POOL_TYPE_UNIFORM_UPLOAD_BUFFER:
+        object_pool = &this->m_uniform_upload_buffer_object_pool;
+        break;
+    case BRX_PAL_OBJECT_POOL_TYPE_STAGING_UPLOAD_BUFFER:
+        object_pool = &this->m_staging_upload_buffer_object_pool;
+        break;
+    case BRX_PAL_OBJECT_POOL_TYPE_STORAGE_INTERMEDIATE_BUFFER:
+        object_pool = &this->m_storage_intermediate_buffer_object_pool;
+        break;
+    case BRX_PAL_OBJECT_POOL_TYPE_COLOR_ATTACHMENT_IMAGE:
+        object_pool = &this->m_color_attachment_image_object_pool;
+        break;
+    case BRX_PAL_OBJECT_POOL_TYPE_DEPTH_STENCIL_ATTACHMENT_IMAGE:
+        object_pool = &this->m_depth_stencil_attachment_image_object_pool;
+        break;
+    case BRX_PAL_OBJECT_POOL_TYPE_STORAGE_IMAGE:
+        object_pool = &this->m_storage_image_object_pool;
+        break;
+    case BRX_PAL_OBJECT_POOL_TYPE_SAMPLED_ASSET_IMAGE:
+        object_pool = &this->m_sampled_asset_image_object_pool;
+        break;
+    default:
+        assert(false);
+        object_pool = NULL;
+    }
+
+    assert(NULL != object_pool);
+    object_pool->get_statistics(live_object_count, reserved_object_count);
 }
 
-brx_pal_render_pass *brx_pal_d3d12_device::create_render_pass(uint32_t color_attachment_count, BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT const *color_attachments, BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT const *depth_stencil_attachment) const
+void brx_pal_d3d12_device::get_device_creation_timing(BRX_PAL_DEVICE_CREATION_TIMING *device_creation_timing) const
+{
+    (*device_creation_timing) = this->m_device_creation_timing;
+}
+
+void brx_pal_d3d12_device::get_subgroup_properties(BRX_PAL_SUBGROUP_PROPERTIES *subgroup_properties) const
+{
+    (*subgroup_properties) = this->m_subgroup_properties;
+}
+
+brx_pal_render_pass *brx_pal_d3d12_device::create_render_pass(uint32_t color_attachment_count, BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT const *color_attachments, BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT const *depth_stencil_attachment, uint32_t view_count) const
 {
     mcrt_vector<BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT> new_color_attachment_formats;
     mcrt_vector<uint32_t> new_color_attachment_clear_indices;
@@ -925,9 +1390,15 @@ brx_pal_render_pass *brx_pal_d3d12_device::create_render_pass(uint32_t color_att
     mcrt_vector<BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT> new_depth_stencil_attachment_format;
     bool new_depth_stencil_attachment_clear = false;
     bool new_depth_stencil_attachment_flush_for_sampled_image = false;
+    // all attachments should have the same sample count
+    uint32_t const new_sample_count = (color_attachment_count > 0U) ? color_attachments[0].sample_count : ((NULL != depth_stencil_attachment) ? depth_stencil_attachment->sample_count : 1U);
+    assert((1U <= new_sample_count) && (new_sample_count <= this->m_max_attachment_sample_count));
+    assert((1U <= view_count) && (view_count <= this->m_max_multiview_view_count));
     {
         for (uint32_t color_attachment_index = 0U; color_attachment_index < color_attachment_count; ++color_attachment_index)
         {
+            assert(new_sample_count == color_attachments[color_attachment_index].sample_count);
+
             new_color_attachment_formats.push_back(color_attachments[color_attachment_index].format);
 
             switch (color_attachments[color_attachment_index].load_operation)
@@ -960,6 +1431,10 @@ brx_pal_render_pass *brx_pal_d3d12_device::create_render_pass(uint32_t color_att
 
         if (NULL != depth_stencil_attachment)
         {
+            // the multisample depth stencil attachment is NOT resolved
+            assert(new_sample_count == depth_stencil_attachment->sample_count);
+            assert((1U == new_sample_count) || (BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT_STORE_OPERATION_DONT_CARE == depth_stencil_attachment->store_operation));
+
             new_depth_stencil_attachment_format.push_back(depth_stencil_attachment->format);
 
             switch (depth_stencil_attachment->load_operation)
@@ -1004,7 +1479,9 @@ brx_pal_render_pass *brx_pal_d3d12_device::create_render_pass(uint32_t color_att
         std::move(new_color_attachment_flush_for_present_indices),
         std::move(new_depth_stencil_attachment_format),
         new_depth_stencil_attachment_clear,
-        new_depth_stencil_attachment_flush_for_sampled_image};
+        new_depth_stencil_attachment_flush_for_sampled_image,
+        new_sample_count,
+        view_count};
     return new_brx_pal_render_pass;
 }
 
@@ -1017,16 +1494,46 @@ void brx_pal_d3d12_device::destroy_render_pass(brx_pal_render_pass *brx_pal_rend
     mcrt_free(delete_render_pass);
 }
 
-brx_pal_graphics_pipeline *brx_pal_d3d12_device::create_graphics_pipeline(brx_pal_render_pass const *render_pass, brx_pal_pipeline_layout const *pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const
+brx_pal_graphics_pipeline *brx_pal_d3d12_device::create_graphics_pipeline(brx_pal_render_pass const *render_pass, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const
 {
-    void *new_unwrapped_graphics_pipeline_base = mcrt_malloc(sizeof(brx_pal_d3d12_graphics_pipeline), alignof(brx_pal_d3d12_graphics_pipeline));
+    void *new_unwrapped_graphics_pipeline_base = this->m_graphics_pipeline_object_pool.allocate();
     assert(NULL != new_unwrapped_graphics_pipeline_base);
 
     brx_pal_d3d12_graphics_pipeline *new_unwrapped_graphics_pipeline = new (new_unwrapped_graphics_pipeline_base) brx_pal_d3d12_graphics_pipeline{};
-    new_unwrapped_graphics_pipeline->init(this->m_device, render_pass, pipeline_layout, vertex_shader_module_code_size, vertex_shader_module_code, fragment_shader_module_code_size, fragment_shader_module_code, enable_back_face_cull, front_ccw, depth_compare_operation, blend_operation);
+    new_unwrapped_graphics_pipeline->init(this->m_device, render_pass, pipeline_layout, vertex_binding_count, vertex_binding_strides, vertex_attribute_count, vertex_attributes, vertex_shader_module_code_size, vertex_shader_module_code, 0U, NULL, 0U, NULL, fragment_shader_module_code_size, fragment_shader_module_code, enable_back_face_cull, front_ccw, depth_compare_operation, blend_operation);
     return new_unwrapped_graphics_pipeline;
 }
 
+brx_pal_graphics_pipeline *brx_pal_d3d12_device::create_dynamic_rendering_graphics_pipeline(uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const
+{
+    assert((1U <= sample_count) && (sample_count <= this->m_max_attachment_sample_count));
+    assert((1U <= view_count) && (view_count <= this->m_max_multiview_view_count));
+
+    void *new_unwrapped_graphics_pipeline_base = this->m_graphics_pipeline_object_pool.allocate();
+    assert(NULL != new_unwrapped_graphics_pipeline_base);
+
+    brx_pal_d3d12_graphics_pipeline *new_unwrapped_graphics_pipeline = new (new_unwrapped_graphics_pipeline_base) brx_pal_d3d12_graphics_pipeline{};
+    new_unwrapped_graphics_pipeline->init(this->m_device, color_attachment_count, color_attachment_formats, depth_stencil_attachment_format, sample_count, view_count, pipeline_layout, vertex_binding_count, vertex_binding_strides, vertex_attribute_count, vertex_attributes, vertex_shader_module_code_size, vertex_shader_module_code, 0U, NULL, 0U, NULL, fragment_shader_module_code_size, fragment_shader_module_code, enable_back_face_cull, front_ccw, depth_compare_operation, blend_operation);
+    return new_unwrapped_graphics_pipeline;
+}
+
+brx_pal_graphics_pipeline *brx_pal_d3d12_device::create_specialized_graphics_pipeline(brx_pal_render_pass const *render_pass, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *vertex_shader_specialization, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *fragment_shader_specialization, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const
+{
+    // the DXIL is NOT able to be specialized, and the variants are expected to be compiled offline
+    (void)vertex_shader_specialization;
+    (void)fragment_shader_specialization;
+
+    return this->create_graphics_pipeline(render_pass, pipeline_layout, vertex_binding_count, vertex_binding_strides, vertex_attribute_count, vertex_attributes, vertex_shader_module_code_size, vertex_shader_module_code, fragment_shader_module_code_size, fragment_shader_module_code, enable_back_face_cull, front_ccw, depth_compare_operation, blend_operation);
+}
+
+brx_pal_graphics_pipeline *brx_pal_d3d12_device::create_specialized_dynamic_rendering_graphics_pipeline(uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *vertex_shader_specialization, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *fragment_shader_specialization, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const
+{
+    (void)vertex_shader_specialization;
+    (void)fragment_shader_specialization;
+
+    return this->create_dynamic_rendering_graphics_pipeline(color_attachment_count, color_attachment_formats, depth_stencil_attachment_format, sample_count, view_count, pipeline_layout, vertex_binding_count, vertex_binding_strides, vertex_attribute_count, vertex_attributes, vertex_shader_module_code_size, vertex_shader_module_code, fragment_shader_module_code_size, fragment_shader_module_code, enable_back_face_cull, front_ccw, depth_compare_operation, blend_operation);
+}
+
 void brx_pal_d3d12_device::destroy_graphics_pipeline(brx_pal_graphics_pipeline *wrapped_graphics_pipeline) const
 {
     assert(NULL != wrapped_graphics_pipeline);
@@ -1035,51 +1542,216 @@ void brx_pal_d3d12_device::destroy_graphics_pipeline(brx_pal_graphics_pipeline *
     delete_unwrapped_graphics_pipeline->uninit();
 
     delete_unwrapped_graphics_pipeline->~brx_pal_d3d12_graphics_pipeline();
-    mcrt_free(delete_unwrapped_graphics_pipeline);
+    this->m_graphics_pipeline_object_pool.free(delete_unwrapped_graphics_pipeline);
 }
 
-brx_pal_compute_pipeline *brx_pal_d3d12_device::create_compute_pipeline(brx_pal_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code) const
+bool brx_pal_d3d12_device::is_graphics_pipeline_library_supported() const
 {
-    void *new_unwrapped_compute_pipeline_base = mcrt_malloc(sizeof(brx_pal_d3d12_compute_pipeline), alignof(brx_pal_d3d12_compute_pipeline));
-    assert(NULL != new_unwrapped_compute_pipeline_base);
+    // the pipeline state object can NOT be linked in D3D12
+    return false;
+}
 
-    brx_pal_d3d12_compute_pipeline *new_unwrapped_compute_pipeline = new (new_unwrapped_compute_pipeline_base) brx_pal_d3d12_compute_pipeline{};
-    new_unwrapped_compute_pipeline->init(this->m_device, pipeline_layout, compute_shader_module_code_size, compute_shader_module_code);
-    return new_unwrapped_compute_pipeline;
+bool brx_pal_d3d12_device::is_extended_dynamic_state_supported() const
+{
+    // the rasterizer state, the depth stencil state and the blend state are baked into the pipeline state object in D3D12
+    return false;
 }
 
-void brx_pal_d3d12_device::destroy_compute_pipeline(brx_pal_compute_pipeline *wrapped_compute_pipeline) const
+brx_pal_graphics_pipeline *brx_pal_d3d12_device::create_extended_dynamic_state_graphics_pipeline(brx_pal_render_pass const *render_pass, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *vertex_shader_specialization, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *fragment_shader_specialization) const
 {
-    assert(NULL != wrapped_compute_pipeline);
-    brx_pal_d3d12_compute_pipeline *delete_unwrapped_compute_pipeline = static_cast<brx_pal_d3d12_compute_pipeline *>(wrapped_compute_pipeline);
+    assert(false);
+    return NULL;
+}
 
-    delete_unwrapped_compute_pipeline->uninit();
+brx_pal_graphics_pipeline *brx_pal_d3d12_device::create_extended_dynamic_state_dynamic_rendering_graphics_pipeline(uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *vertex_shader_specialization, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *fragment_shader_specialization) const
+{
+    assert(false);
+    return NULL;
+}
 
-    delete_unwrapped_compute_pipeline->~brx_pal_d3d12_compute_pipeline();
-    mcrt_free(delete_unwrapped_compute_pipeline);
+bool brx_pal_d3d12_device::is_mesh_shader_supported() const
+{
+    return this->m_support_mesh_shader;
 }
 
-brx_pal_frame_buffer *brx_pal_d3d12_device::create_frame_buffer(brx_pal_render_pass const *brx_pal_render_pass, uint32_t width, uint32_t height, uint32_t color_attachment_count, brx_pal_color_attachment_image const *const *color_attachments, brx_pal_depth_stencil_attachment_image const *depth_stencil_attachment) const
+brx_pal_graphics_pipeline *brx_pal_d3d12_device::create_mesh_shader_graphics_pipeline(brx_pal_render_pass const *render_pass, brx_pal_pipeline_layout const *pipeline_layout, size_t task_shader_module_code_size, void const *task_shader_module_code, size_t mesh_shader_module_code_size, void const *mesh_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const
 {
-    assert(NULL != brx_pal_render_pass);
-    assert(static_cast<brx_pal_d3d12_render_pass const *>(brx_pal_render_pass)->get_color_attachment_count() == color_attachment_count);
-    assert((NULL != static_cast<brx_pal_d3d12_render_pass const *>(brx_pal_render_pass)->get_depth_stencil_attachment_format()) == (NULL != depth_stencil_attachment));
+    assert(this->m_support_mesh_shader);
 
-    mcrt_vector<ID3D12Resource *> new_render_target_resources;
-    mcrt_vector<D3D12_CPU_DESCRIPTOR_HANDLE> new_render_target_view_descriptors;
-    ID3D12Resource *new_depth_stencil_resource;
-    mcrt_vector<D3D12_CPU_DESCRIPTOR_HANDLE> new_depth_stencil_view_descriptor;
-    {
-        new_render_target_resources.resize(color_attachment_count);
-        new_render_target_view_descriptors.resize(color_attachment_count);
-        assert(NULL != color_attachments || 0U == color_attachment_count);
-        for (uint32_t color_attachment_index = 0U; color_attachment_index < color_attachment_count; ++color_attachment_index)
-        {
-            assert(NULL != color_attachments[color_attachment_index]);
+    void *new_unwrapped_graphics_pipeline_base = this->m_graphics_pipeline_object_pool.allocate();
+    assert(NULL != new_unwrapped_graphics_pipeline_base);
+
+    brx_pal_d3d12_graphics_pipeline *new_unwrapped_graphics_pipeline = new (new_unwrapped_graphics_pipeline_base) brx_pal_d3d12_graphics_pipeline{};
+    new_unwrapped_graphics_pipeline->init(this->m_device, render_pass, pipeline_layout, 0U, NULL, 0U, NULL, 0U, NULL, task_shader_module_code_size, task_shader_module_code, mesh_shader_module_code_size, mesh_shader_module_code, fragment_shader_module_code_size, fragment_shader_module_code, enable_back_face_cull, front_ccw, depth_compare_operation, blend_operation);
+    return new_unwrapped_graphics_pipeline;
+}
+
+brx_pal_graphics_pipeline *brx_pal_d3d12_device::create_mesh_shader_dynamic_rendering_graphics_pipeline(uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, size_t task_shader_module_code_size, void const *task_shader_module_code, size_t mesh_shader_module_code_size, void const *mesh_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const
+{
+    assert(this->m_support_mesh_shader);
+    assert((1U <= sample_count) && (sample_count <= this->m_max_attachment_sample_count));
+    assert(1U == view_count);
+
+    void *new_unwrapped_graphics_pipeline_base = this->m_graphics_pipeline_object_pool.allocate();
+    assert(NULL != new_unwrapped_graphics_pipeline_base);
+
+    brx_pal_d3d12_graphics_pipeline *new_unwrapped_graphics_pipeline = new (new_unwrapped_graphics_pipeline_base) brx_pal_d3d12_graphics_pipeline{};
+    new_unwrapped_graphics_pipeline->init(this->m_device, color_attachment_count, color_attachment_formats, depth_stencil_attachment_format, sample_count, view_count, pipeline_layout, 0U, NULL, 0U, NULL, 0U, NULL, task_shader_module_code_size, task_shader_module_code, mesh_shader_module_code_size, mesh_shader_module_code, fragment_shader_module_code_size, fragment_shader_module_code, enable_back_face_cull, front_ccw, depth_compare_operation, blend_operation);
+    return new_unwrapped_graphics_pipeline;
+}
+
+brx_pal_graphics_pipeline_pre_rasterization_shader_library *brx_pal_d3d12_device::create_graphics_pipeline_pre_rasterization_shader_library(uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, bool enable_back_face_cull, bool front_ccw) const
+{
+    assert((1U <= view_count) && (view_count <= this->m_max_multiview_view_count));
+    assert(NULL != pipeline_layout);
+
+    void *new_unwrapped_pre_rasterization_shader_library_base = mcrt_malloc(sizeof(brx_pal_d3d12_graphics_pipeline_pre_rasterization_shader_library), alignof(brx_pal_d3d12_graphics_pipeline_pre_rasterization_shader_library));
+    assert(NULL != new_unwrapped_pre_rasterization_shader_library_base);
+
+    brx_pal_d3d12_graphics_pipeline_pre_rasterization_shader_library *new_unwrapped_pre_rasterization_shader_library = new (new_unwrapped_pre_rasterization_shader_library_base) brx_pal_d3d12_graphics_pipeline_pre_rasterization_shader_library{};
+    new_unwrapped_pre_rasterization_shader_library->init(view_count, vertex_shader_module_code_size, vertex_shader_module_code, enable_back_face_cull, front_ccw);
+    return new_unwrapped_pre_rasterization_shader_library;
+}
+
+void brx_pal_d3d12_device::destroy_graphics_pipeline_pre_rasterization_shader_library(brx_pal_graphics_pipeline_pre_rasterization_shader_library *wrapped_pre_rasterization_shader_library) const
+{
+    assert(NULL != wrapped_pre_rasterization_shader_library);
+    brx_pal_d3d12_graphics_pipeline_pre_rasterization_shader_library *delete_unwrapped_pre_rasterization_shader_library = static_cast<brx_pal_d3d12_graphics_pipeline_pre_rasterization_shader_library *>(wrapped_pre_rasterization_shader_library);
+
+    delete_unwrapped_pre_rasterization_shader_library->uninit();
+
+    delete_unwrapped_pre_rasterization_shader_library->~brx_pal_d3d12_graphics_pipeline_pre_rasterization_shader_library();
+    mcrt_free(delete_unwrapped_pre_rasterization_shader_library);
+}
+
+brx_pal_graphics_pipeline_fragment_shader_library *brx_pal_d3d12_device::create_graphics_pipeline_fragment_shader_library(uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation) const
+{
+    assert((1U <= view_count) && (view_count <= this->m_max_multiview_view_count));
+    assert(NULL != pipeline_layout);
+
+    void *new_unwrapped_fragment_shader_library_base = mcrt_malloc(sizeof(brx_pal_d3d12_graphics_pipeline_fragment_shader_library), alignof(brx_pal_d3d12_graphics_pipeline_fragment_shader_library));
+    assert(NULL != new_unwrapped_fragment_shader_library_base);
+
+    brx_pal_d3d12_graphics_pipeline_fragment_shader_library *new_unwrapped_fragment_shader_library = new (new_unwrapped_fragment_shader_library_base) brx_pal_d3d12_graphics_pipeline_fragment_shader_library{};
+    new_unwrapped_fragment_shader_library->init(view_count, fragment_shader_module_code_size, fragment_shader_module_code, depth_compare_operation);
+    return new_unwrapped_fragment_shader_library;
+}
+
+void brx_pal_d3d12_device::destroy_graphics_pipeline_fragment_shader_library(brx_pal_graphics_pipeline_fragment_shader_library *wrapped_fragment_shader_library) const
+{
+    assert(NULL != wrapped_fragment_shader_library);
+    brx_pal_d3d12_graphics_pipeline_fragment_shader_library *delete_unwrapped_fragment_shader_library = static_cast<brx_pal_d3d12_graphics_pipeline_fragment_shader_library *>(wrapped_fragment_shader_library);
+
+    delete_unwrapped_fragment_shader_library->uninit();
+
+    delete_unwrapped_fragment_shader_library->~brx_pal_d3d12_graphics_pipeline_fragment_shader_library();
+    mcrt_free(delete_unwrapped_fragment_shader_library);
+}
+
+brx_pal_graphics_pipeline_fragment_output_interface_library *brx_pal_d3d12_device::create_graphics_pipeline_fragment_output_interface_library(uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const
+{
+    assert((1U <= sample_count) && (sample_count <= this->m_max_attachment_sample_count));
+    assert((1U <= view_count) && (view_count <= this->m_max_multiview_view_count));
+
+    void *new_unwrapped_fragment_output_interface_library_base = mcrt_malloc(sizeof(brx_pal_d3d12_graphics_pipeline_fragment_output_interface_library), alignof(brx_pal_d3d12_graphics_pipeline_fragment_output_interface_library));
+    assert(NULL != new_unwrapped_fragment_output_interface_library_base);
+
+    brx_pal_d3d12_graphics_pipeline_fragment_output_interface_library *new_unwrapped_fragment_output_interface_library = new (new_unwrapped_fragment_output_interface_library_base) brx_pal_d3d12_graphics_pipeline_fragment_output_interface_library{};
+    new_unwrapped_fragment_output_interface_library->init(color_attachment_count, color_attachment_formats, depth_stencil_attachment_format, sample_count, view_count, blend_operation);
+    return new_unwrapped_fragment_output_interface_library;
+}
+
+void brx_pal_d3d12_device::destroy_graphics_pipeline_fragment_output_interface_library(brx_pal_graphics_pipeline_fragment_output_interface_library *wrapped_fragment_output_interface_library) const
+{
+    assert(NULL != wrapped_fragment_output_interface_library);
+    brx_pal_d3d12_graphics_pipeline_fragment_output_interface_library *delete_unwrapped_fragment_output_interface_library = static_cast<brx_pal_d3d12_graphics_pipeline_fragment_output_interface_library *>(wrapped_fragment_output_interface_library);
+
+    delete_unwrapped_fragment_output_interface_library->uninit();
+
+    delete_unwrapped_fragment_output_interface_library->~brx_pal_d3d12_graphics_pipeline_fragment_output_interface_library();
+    mcrt_free(delete_unwrapped_fragment_output_interface_library);
+}
+
+brx_pal_graphics_pipeline *brx_pal_d3d12_device::create_linked_graphics_pipeline(brx_pal_pipeline_layout const *pipeline_layout, brx_pal_graphics_pipeline_pre_rasterization_shader_library const *pre_rasterization_shader_library, brx_pal_graphics_pipeline_fragment_shader_library const *fragment_shader_library, brx_pal_graphics_pipeline_fragment_output_interface_library const *fragment_output_interface_library, bool link_time_optimization) const
+{
+    // the pipeline state object is always fully compiled
+    (void)link_time_optimization;
+
+    void *new_unwrapped_graphics_pipeline_base = this->m_graphics_pipeline_object_pool.allocate();
+    assert(NULL != new_unwrapped_graphics_pipeline_base);
+
+    brx_pal_d3d12_graphics_pipeline *new_unwrapped_graphics_pipeline = new (new_unwrapped_graphics_pipeline_base) brx_pal_d3d12_graphics_pipeline{};
+    new_unwrapped_graphics_pipeline->init(this->m_device, pipeline_layout, pre_rasterization_shader_library, fragment_shader_library, fragment_output_interface_library);
+    return new_unwrapped_graphics_pipeline;
+}
+
+brx_pal_compute_pipeline *brx_pal_d3d12_device::create_compute_pipeline(brx_pal_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code) const
+{
+    void *new_unwrapped_compute_pipeline_base = this->m_compute_pipeline_object_pool.allocate();
+    assert(NULL != new_unwrapped_compute_pipeline_base);
+
+    brx_pal_d3d12_compute_pipeline *new_unwrapped_compute_pipeline = new (new_unwrapped_compute_pipeline_base) brx_pal_d3d12_compute_pipeline{};
+    new_unwrapped_compute_pipeline->init(this->m_device, pipeline_layout, compute_shader_module_code_size, compute_shader_module_code);
+    return new_unwrapped_compute_pipeline;
+}
+
+brx_pal_compute_pipeline *brx_pal_d3d12_device::create_specialized_compute_pipeline(brx_pal_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *compute_shader_specialization) const
+{
+    (void)compute_shader_specialization;
+
+    return this->create_compute_pipeline(pipeline_layout, compute_shader_module_code_size, compute_shader_module_code);
+}
+
+brx_pal_compute_pipeline *brx_pal_d3d12_device::create_subgroup_size_control_compute_pipeline(brx_pal_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *compute_shader_specialization, uint32_t required_subgroup_size, bool require_full_subgroups) const
+{
+    assert(false);
+    return NULL;
+}
+
+void brx_pal_d3d12_device::destroy_compute_pipeline(brx_pal_compute_pipeline *wrapped_compute_pipeline) const
+{
+    assert(NULL != wrapped_compute_pipeline);
+    brx_pal_d3d12_compute_pipeline *delete_unwrapped_compute_pipeline = static_cast<brx_pal_d3d12_compute_pipeline *>(wrapped_compute_pipeline);
+
+    delete_unwrapped_compute_pipeline->uninit();
+
+    delete_unwrapped_compute_pipeline->~brx_pal_d3d12_compute_pipeline();
+    this->m_compute_pipeline_object_pool.free(delete_unwrapped_compute_pipeline);
+}
+
+brx_pal_frame_buffer *brx_pal_d3d12_device::create_frame_buffer(brx_pal_render_pass const *brx_pal_render_pass, uint32_t width, uint32_t height, uint32_t color_attachment_count, brx_pal_color_attachment_image const *const *color_attachments, brx_pal_color_attachment_image const *const *color_resolve_attachments, brx_pal_depth_stencil_attachment_image const *depth_stencil_attachment) const
+{
+    assert(NULL != brx_pal_render_pass);
+    assert((NULL == color_resolve_attachments) || (static_cast<brx_pal_d3d12_render_pass const *>(brx_pal_render_pass)->get_sample_count() > 1U));
+    assert(static_cast<brx_pal_d3d12_render_pass const *>(brx_pal_render_pass)->get_color_attachment_count() == color_attachment_count);
+    assert((NULL != static_cast<brx_pal_d3d12_render_pass const *>(brx_pal_render_pass)->get_depth_stencil_attachment_format()) == (NULL != depth_stencil_attachment));
+
+    mcrt_vector<ID3D12Resource *> new_render_target_resources;
+    mcrt_vector<D3D12_CPU_DESCRIPTOR_HANDLE> new_render_target_view_descriptors;
+    mcrt_vector<ID3D12Resource *> new_resolve_resources;
+    ID3D12Resource *new_depth_stencil_resource;
+    mcrt_vector<D3D12_CPU_DESCRIPTOR_HANDLE> new_depth_stencil_view_descriptor;
+    {
+        new_render_target_resources.resize(color_attachment_count);
+        new_render_target_view_descriptors.resize(color_attachment_count);
+        assert(NULL != color_attachments || 0U == color_attachment_count);
+        for (uint32_t color_attachment_index = 0U; color_attachment_index < color_attachment_count; ++color_attachment_index)
+        {
+            assert(NULL != color_attachments[color_attachment_index]);
             new_render_target_resources[color_attachment_index] = static_cast<brx_pal_d3d12_color_attachment_image const *>(color_attachments[color_attachment_index])->get_resource();
             new_render_target_view_descriptors[color_attachment_index] = static_cast<brx_pal_d3d12_color_attachment_image const *>(color_attachments[color_attachment_index])->get_render_target_view_descriptor();
         }
 
+        if (NULL != color_resolve_attachments)
+        {
+            // the element is NULL if the store operation is "DONT_CARE"
+            new_resolve_resources.resize(color_attachment_count);
+            for (uint32_t color_attachment_index = 0U; color_attachment_index < color_attachment_count; ++color_attachment_index)
+            {
+                new_resolve_resources[color_attachment_index] = (NULL != color_resolve_attachments[color_attachment_index]) ? static_cast<brx_pal_d3d12_color_attachment_image const *>(color_resolve_attachments[color_attachment_index])->get_resource() : NULL;
+            }
+        }
+
         if (NULL != depth_stencil_attachment)
         {
             new_depth_stencil_resource = static_cast<brx_pal_d3d12_depth_stencil_attachment_image const *>(depth_stencil_attachment)->get_resource();
@@ -1096,7 +1768,7 @@ brx_pal_frame_buffer *brx_pal_d3d12_device::create_frame_buffer(brx_pal_render_p
     void *new_brx_pal_frame_buffer_base = mcrt_malloc(sizeof(brx_pal_d3d12_frame_buffer), alignof(brx_pal_d3d12_frame_buffer));
     assert(NULL != new_brx_pal_frame_buffer_base);
 
-    brx_pal_d3d12_frame_buffer *new_brx_pal_frame_buffer = new (new_brx_pal_frame_buffer_base) brx_pal_d3d12_frame_buffer{std::move(new_render_target_resources), std::move(new_render_target_view_descriptors), new_depth_stencil_resource, std::move(new_depth_stencil_view_descriptor)};
+    brx_pal_d3d12_frame_buffer *new_brx_pal_frame_buffer = new (new_brx_pal_frame_buffer_base) brx_pal_d3d12_frame_buffer{std::move(new_render_target_resources), std::move(new_render_target_view_descriptors), std::move(new_resolve_resources), new_depth_stencil_resource, std::move(new_depth_stencil_view_descriptor)};
     return new_brx_pal_frame_buffer;
 }
 
@@ -1116,7 +1788,7 @@ uint32_t brx_pal_d3d12_device::get_uniform_upload_buffer_offset_alignment() cons
 
 brx_pal_uniform_upload_buffer *brx_pal_d3d12_device::create_uniform_upload_buffer(uint32_t size) const
 {
-    void *new_unwrapped_uniform_upload_buffer_base = mcrt_malloc(sizeof(brx_pal_d3d12_uniform_upload_buffer), alignof(brx_pal_d3d12_uniform_upload_buffer));
+    void *new_unwrapped_uniform_upload_buffer_base = this->m_uniform_upload_buffer_object_pool.allocate();
     assert(NULL != new_unwrapped_uniform_upload_buffer_base);
 
     brx_pal_d3d12_uniform_upload_buffer *new_unwrapped_uniform_upload_buffer = new (new_unwrapped_uniform_upload_buffer_base) brx_pal_d3d12_uniform_upload_buffer{};
@@ -1132,7 +1804,7 @@ void brx_pal_d3d12_device::destroy_uniform_upload_buffer(brx_pal_uniform_upload_
     delete_unwrapped_uniform_upload_buffer->uninit();
 
     delete_unwrapped_uniform_upload_buffer->~brx_pal_d3d12_uniform_upload_buffer();
-    mcrt_free(delete_unwrapped_uniform_upload_buffer);
+    this->m_uniform_upload_buffer_object_pool.free(delete_unwrapped_uniform_upload_buffer);
 }
 
 uint32_t brx_pal_d3d12_device::get_staging_upload_buffer_offset_alignment() const
@@ -1147,7 +1819,7 @@ uint32_t brx_pal_d3d12_device::get_staging_upload_buffer_row_pitch_alignment() c
 
 brx_pal_staging_upload_buffer *brx_pal_d3d12_device::create_staging_upload_buffer(uint32_t size) const
 {
-    void *new_unwrapped_staging_upload_buffer_base = mcrt_malloc(sizeof(brx_pal_d3d12_staging_upload_buffer), alignof(brx_pal_d3d12_staging_upload_buffer));
+    void *new_unwrapped_staging_upload_buffer_base = this->m_staging_upload_buffer_object_pool.allocate();
     assert(NULL != new_unwrapped_staging_upload_buffer_base);
 
     brx_pal_d3d12_staging_upload_buffer *new_unwrapped_staging_upload_buffer = new (new_unwrapped_staging_upload_buffer_base) brx_pal_d3d12_staging_upload_buffer{};
@@ -1163,16 +1835,16 @@ void brx_pal_d3d12_device::destroy_staging_upload_buffer(brx_pal_staging_upload_
     delete_unwrapped_staging_upload_buffer->uninit();
 
     delete_unwrapped_staging_upload_buffer->~brx_pal_d3d12_staging_upload_buffer();
-    mcrt_free(delete_unwrapped_staging_upload_buffer);
+    this->m_staging_upload_buffer_object_pool.free(delete_unwrapped_staging_upload_buffer);
 }
 
 brx_pal_storage_intermediate_buffer *brx_pal_d3d12_device::create_storage_intermediate_buffer(uint32_t size) const
 {
-    void *new_unwrapped_storage_intermediate_buffer_base = mcrt_malloc(sizeof(brx_pal_d3d12_storage_intermediate_buffer), alignof(brx_pal_d3d12_storage_intermediate_buffer));
+    void *new_unwrapped_storage_intermediate_buffer_base = this->m_storage_intermediate_buffer_object_pool.allocate();
     assert(NULL != new_unwrapped_storage_intermediate_buffer_base);
 
     brx_pal_d3d12_storage_intermediate_buffer *new_unwrapped_storage_intermediate_buffer = new (new_unwrapped_storage_intermediate_buffer_base) brx_pal_d3d12_storage_intermediate_buffer{};
-    new_unwrapped_storage_intermediate_buffer->init(this->m_memory_allocator, this->m_storage_intermediate_buffer_memory_pool, size);
+    new_unwrapped_storage_intermediate_buffer->init(this->m_memory_allocator, this->m_storage_intermediate_buffer_memory_pool, NULL, 0U, size);
     return new_unwrapped_storage_intermediate_buffer;
 }
 
@@ -1184,7 +1856,7 @@ void brx_pal_d3d12_device::destroy_storage_intermediate_buffer(brx_pal_storage_i
     delete_unwrapped_storage_intermediate_buffer->uninit();
 
     delete_unwrapped_storage_intermediate_buffer->~brx_pal_d3d12_storage_intermediate_buffer();
-    mcrt_free(delete_unwrapped_storage_intermediate_buffer);
+    this->m_storage_intermediate_buffer_object_pool.free(delete_unwrapped_storage_intermediate_buffer);
 }
 
 brx_pal_storage_asset_buffer *brx_pal_d3d12_device::create_storage_asset_buffer(uint32_t size) const
@@ -1220,11 +1892,11 @@ BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT brx_pal_d3d12_device::get_depth_st
 
 brx_pal_color_attachment_image *brx_pal_d3d12_device::create_color_attachment_image(BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT color_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image) const
 {
-    void *new_unwrapped_color_attachment_image_base = mcrt_malloc(sizeof(brx_pal_d3d12_color_attachment_intermediate_image), alignof(brx_pal_d3d12_color_attachment_intermediate_image));
+    void *new_unwrapped_color_attachment_image_base = this->m_color_attachment_image_object_pool.allocate();
     assert(NULL != new_unwrapped_color_attachment_image_base);
 
     brx_pal_d3d12_color_attachment_intermediate_image *new_unwrapped_color_attachment_image = new (new_unwrapped_color_attachment_image_base) brx_pal_d3d12_color_attachment_intermediate_image{};
-    new_unwrapped_color_attachment_image->init(this->m_device, this->m_memory_allocator, this->m_color_attachment_intermediate_image_memory_pool, color_attachment_image_format, width, height, allow_sampled_image);
+    new_unwrapped_color_attachment_image->init(this->m_device, this->m_memory_allocator, this->m_color_attachment_intermediate_image_memory_pool, NULL, 0U, color_attachment_image_format, width, height, 1U, 1U, allow_sampled_image);
     return new_unwrapped_color_attachment_image;
 }
 
@@ -1236,16 +1908,16 @@ void brx_pal_d3d12_device::destroy_color_attachment_image(brx_pal_color_attachme
     delete_unwrapped_color_attachment_image->uninit();
 
     delete_unwrapped_color_attachment_image->~brx_pal_d3d12_color_attachment_intermediate_image();
-    mcrt_free(delete_unwrapped_color_attachment_image);
+    this->m_color_attachment_image_object_pool.free(delete_unwrapped_color_attachment_image);
 }
 
 brx_pal_depth_stencil_attachment_image *brx_pal_d3d12_device::create_depth_stencil_attachment_image(BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT depth_stencil_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image) const
 {
-    void *new_unwrapped_depth_stencil_attachment_image_base = mcrt_malloc(sizeof(brx_pal_d3d12_depth_stencil_attachment_intermediate_image), alignof(brx_pal_d3d12_depth_stencil_attachment_intermediate_image));
+    void *new_unwrapped_depth_stencil_attachment_image_base = this->m_depth_stencil_attachment_image_object_pool.allocate();
     assert(NULL != new_unwrapped_depth_stencil_attachment_image_base);
 
     brx_pal_d3d12_depth_stencil_attachment_intermediate_image *new_unwrapped_depth_stencil_attachment_image = new (new_unwrapped_depth_stencil_attachment_image_base) brx_pal_d3d12_depth_stencil_attachment_intermediate_image{};
-    new_unwrapped_depth_stencil_attachment_image->init(this->m_device, this->m_memory_allocator, this->m_depth_stencil_attachment_intermediate_image_memory_pool, depth_stencil_attachment_image_format, width, height, allow_sampled_image);
+    new_unwrapped_depth_stencil_attachment_image->init(this->m_device, this->m_memory_allocator, this->m_depth_stencil_attachment_intermediate_image_memory_pool, NULL, 0U, depth_stencil_attachment_image_format, width, height, 1U, 1U, allow_sampled_image);
     return new_unwrapped_depth_stencil_attachment_image;
 }
 
@@ -1257,45 +1929,225 @@ void brx_pal_d3d12_device::destroy_depth_stencil_attachment_image(brx_pal_depth_
     delete_unwrapped_depth_stencil_attachment_image->uninit();
 
     delete_unwrapped_depth_stencil_attachment_image->~brx_pal_d3d12_depth_stencil_attachment_intermediate_image();
-    mcrt_free(delete_unwrapped_depth_stencil_attachment_image);
+    this->m_depth_stencil_attachment_image_object_pool.free(delete_unwrapped_depth_stencil_attachment_image);
+}
+
+uint32_t brx_pal_d3d12_device::get_max_attachment_sample_count() const
+{
+    return this->m_max_attachment_sample_count;
+}
+
+brx_pal_color_attachment_image *brx_pal_d3d12_device::create_multisample_color_attachment_image(BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT color_attachment_image_format, uint32_t width, uint32_t height, uint32_t sample_count) const
+{
+    assert((1U <= sample_count) && (sample_count <= this->m_max_attachment_sample_count));
+
+    void *new_unwrapped_color_attachment_image_base = this->m_color_attachment_image_object_pool.allocate();
+    assert(NULL != new_unwrapped_color_attachment_image_base);
+
+    brx_pal_d3d12_color_attachment_intermediate_image *new_unwrapped_color_attachment_image = new (new_unwrapped_color_attachment_image_base) brx_pal_d3d12_color_attachment_intermediate_image{};
+    new_unwrapped_color_attachment_image->init(this->m_device, this->m_memory_allocator, this->m_color_attachment_intermediate_image_memory_pool, NULL, 0U, color_attachment_image_format, width, height, 1U, sample_count, false);
+    return new_unwrapped_color_attachment_image;
+}
+
+brx_pal_depth_stencil_attachment_image *brx_pal_d3d12_device::create_multisample_depth_stencil_attachment_image(BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT depth_stencil_attachment_image_format, uint32_t width, uint32_t height, uint32_t sample_count) const
+{
+    assert((1U <= sample_count) && (sample_count <= this->m_max_attachment_sample_count));
+
+    void *new_unwrapped_depth_stencil_attachment_image_base = this->m_depth_stencil_attachment_image_object_pool.allocate();
+    assert(NULL != new_unwrapped_depth_stencil_attachment_image_base);
+
+    brx_pal_d3d12_depth_stencil_attachment_intermediate_image *new_unwrapped_depth_stencil_attachment_image = new (new_unwrapped_depth_stencil_attachment_image_base) brx_pal_d3d12_depth_stencil_attachment_intermediate_image{};
+    new_unwrapped_depth_stencil_attachment_image->init(this->m_device, this->m_memory_allocator, this->m_depth_stencil_attachment_intermediate_image_memory_pool, NULL, 0U, depth_stencil_attachment_image_format, width, height, 1U, sample_count, false);
+    return new_unwrapped_depth_stencil_attachment_image;
+}
+
+uint32_t brx_pal_d3d12_device::get_max_multiview_view_count() const
+{
+    return this->m_max_multiview_view_count;
+}
+
+brx_pal_color_attachment_image *brx_pal_d3d12_device::create_layered_color_attachment_image(BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT color_attachment_image_format, uint32_t width, uint32_t height, uint32_t layer_count, bool allow_sampled_image) const
+{
+    assert(1U <= layer_count);
+
+    void *new_unwrapped_color_attachment_image_base = this->m_color_attachment_image_object_pool.allocate();
+    assert(NULL != new_unwrapped_color_attachment_image_base);
+
+    brx_pal_d3d12_color_attachment_intermediate_image *new_unwrapped_color_attachment_image = new (new_unwrapped_color_attachment_image_base) brx_pal_d3d12_color_attachment_intermediate_image{};
+    new_unwrapped_color_attachment_image->init(this->m_device, this->m_memory_allocator, this->m_color_attachment_intermediate_image_memory_pool, NULL, 0U, color_attachment_image_format, width, height, layer_count, 1U, allow_sampled_image);
+    return new_unwrapped_color_attachment_image;
+}
+
+brx_pal_depth_stencil_attachment_image *brx_pal_d3d12_device::create_layered_depth_stencil_attachment_image(BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT depth_stencil_attachment_image_format, uint32_t width, uint32_t height, uint32_t layer_count, bool allow_sampled_image) const
+{
+    assert(1U <= layer_count);
+
+    void *new_unwrapped_depth_stencil_attachment_image_base = this->m_depth_stencil_attachment_image_object_pool.allocate();
+    assert(NULL != new_unwrapped_depth_stencil_attachment_image_base);
+
+    brx_pal_d3d12_depth_stencil_attachment_intermediate_image *new_unwrapped_depth_stencil_attachment_image = new (new_unwrapped_depth_stencil_attachment_image_base) brx_pal_d3d12_depth_stencil_attachment_intermediate_image{};
+    new_unwrapped_depth_stencil_attachment_image->init(this->m_device, this->m_memory_allocator, this->m_depth_stencil_attachment_intermediate_image_memory_pool, NULL, 0U, depth_stencil_attachment_image_format, width, height, layer_count, 1U, allow_sampled_image);
+    return new_unwrapped_depth_stencil_attachment_image;
 }
 
 brx_pal_storage_image *brx_pal_d3d12_device::create_storage_image(BRX_PAL_STORAGE_IMAGE_FORMAT wrapped_storage_image_format, uint32_t width, uint32_t height, bool allow_sampled_image) const
 {
-    DXGI_FORMAT unwrapped_storage_image_format;
-    switch (wrapped_storage_image_format)
+    void *new_unwrapped_storage_image_base = this->m_storage_image_object_pool.allocate();
+    assert(NULL != new_unwrapped_storage_image_base);
+
+    brx_pal_d3d12_storage_intermediate_image *new_unwrapped_storage_image = new (new_unwrapped_storage_image_base) brx_pal_d3d12_storage_intermediate_image{};
+    new_unwrapped_storage_image->init(this->m_memory_allocator, this->m_storage_intermediate_image_memory_pool, NULL, 0U, _internal_unwrap_storage_image_format(wrapped_storage_image_format), width, height, allow_sampled_image);
+    return new_unwrapped_storage_image;
+}
+
+void brx_pal_d3d12_device::destroy_storage_image(brx_pal_storage_image *wrapped_storage_image) const
+{
+    assert(NULL != wrapped_storage_image);
+    brx_pal_d3d12_storage_intermediate_image *delete_unwrapped_storage_image = static_cast<brx_pal_d3d12_storage_intermediate_image *>(wrapped_storage_image);
+
+    delete_unwrapped_storage_image->uninit();
+
+    delete_unwrapped_storage_image->~brx_pal_d3d12_storage_intermediate_image();
+    this->m_storage_image_object_pool.free(delete_unwrapped_storage_image);
+}
+
+brx_pal_memory_heap *brx_pal_d3d12_device::create_memory_heap(BRX_PAL_MEMORY_HEAP_TYPE memory_heap_type, uint32_t size) const
+{
+    // the heap flags of the color attachment memory pool and the depth stencil attachment memory pool are the same (both "DENY_BUFFERS | DENY_NON_RT_DS_TEXTURES")
+    D3D12MA::Pool *memory_pool;
+    switch (memory_heap_type)
     {
-    case BRX_PAL_STORAGE_IMAGE_FORMAT_R16_SFLOAT:
-        unwrapped_storage_image_format = DXGI_FORMAT_R16_FLOAT;
+    case BRX_PAL_MEMORY_HEAP_TYPE_ATTACHMENT_IMAGE:
+        memory_pool = this->m_color_attachment_intermediate_image_memory_pool;
         break;
-    case BRX_PAL_STORAGE_IMAGE_FORMAT_R16G16B16A16_SFLOAT:
-        unwrapped_storage_image_format = DXGI_FORMAT_R16G16B16A16_FLOAT;
+    case BRX_PAL_MEMORY_HEAP_TYPE_STORAGE_IMAGE:
+        memory_pool = this->m_storage_intermediate_image_memory_pool;
         break;
-    case BRX_PAL_STORAGE_IMAGE_FORMAT_R32_UINT:
-        unwrapped_storage_image_format = DXGI_FORMAT_R32_UINT;
+    case BRX_PAL_MEMORY_HEAP_TYPE_STORAGE_BUFFER:
+        memory_pool = this->m_storage_intermediate_buffer_memory_pool;
         break;
     default:
         assert(false);
-        unwrapped_storage_image_format = static_cast<DXGI_FORMAT>(-1);
+        memory_pool = NULL;
     }
 
-    void *new_unwrapped_storage_image_base = mcrt_malloc(sizeof(brx_pal_d3d12_storage_intermediate_image), alignof(brx_pal_d3d12_storage_intermediate_image));
+    void *new_unwrapped_memory_heap_base = mcrt_malloc(sizeof(brx_pal_d3d12_memory_heap), alignof(brx_pal_d3d12_memory_heap));
+    assert(NULL != new_unwrapped_memory_heap_base);
+
+    brx_pal_d3d12_memory_heap *new_unwrapped_memory_heap = new (new_unwrapped_memory_heap_base) brx_pal_d3d12_memory_heap{};
+    new_unwrapped_memory_heap->init(this->m_memory_allocator, memory_pool, memory_heap_type, size);
+    return new_unwrapped_memory_heap;
+}
+
+void brx_pal_d3d12_device::destroy_memory_heap(brx_pal_memory_heap *wrapped_memory_heap) const
+{
+    assert(NULL != wrapped_memory_heap);
+    brx_pal_d3d12_memory_heap *delete_unwrapped_memory_heap = static_cast<brx_pal_d3d12_memory_heap *>(wrapped_memory_heap);
+
+    delete_unwrapped_memory_heap->uninit();
+
+    delete_unwrapped_memory_heap->~brx_pal_d3d12_memory_heap();
+    mcrt_free(delete_unwrapped_memory_heap);
+}
+
+void brx_pal_d3d12_device::get_color_attachment_image_memory_requirements(BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT color_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image, uint32_t *size, uint32_t *alignment) const
+{
+    D3D12_RESOURCE_ALLOCATION_INFO resource_allocation_info;
+    brx_pal_d3d12_color_attachment_intermediate_image::get_memory_requirements(this->m_device, color_attachment_image_format, width, height, &resource_allocation_info);
+
+    assert(resource_allocation_info.SizeInBytes <= static_cast<UINT64>(UINT32_MAX));
+    (*size) = static_cast<uint32_t>(resource_allocation_info.SizeInBytes);
+    (*alignment) = static_cast<uint32_t>(resource_allocation_info.Alignment);
+}
+
+void brx_pal_d3d12_device::get_depth_stencil_attachment_image_memory_requirements(BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT depth_stencil_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image, uint32_t *size, uint32_t *alignment) const
+{
+    D3D12_RESOURCE_ALLOCATION_INFO resource_allocation_info;
+    brx_pal_d3d12_depth_stencil_attachment_intermediate_image::get_memory_requirements(this->m_device, depth_stencil_attachment_image_format, width, height, allow_sampled_image, &resource_allocation_info);
+
+    assert(resource_allocation_info.SizeInBytes <= static_cast<UINT64>(UINT32_MAX));
+    (*size) = static_cast<uint32_t>(resource_allocation_info.SizeInBytes);
+    (*alignment) = static_cast<uint32_t>(resource_allocation_info.Alignment);
+}
+
+void brx_pal_d3d12_device::get_storage_image_memory_requirements(BRX_PAL_STORAGE_IMAGE_FORMAT wrapped_storage_image_format, uint32_t width, uint32_t height, bool allow_sampled_image, uint32_t *size, uint32_t *alignment) const
+{
+    D3D12_RESOURCE_ALLOCATION_INFO resource_allocation_info;
+    brx_pal_d3d12_storage_intermediate_image::get_memory_requirements(this->m_device, _internal_unwrap_storage_image_format(wrapped_storage_image_format), width, height, &resource_allocation_info);
+
+    assert(resource_allocation_info.SizeInBytes <= static_cast<UINT64>(UINT32_MAX));
+    (*size) = static_cast<uint32_t>(resource_allocation_info.SizeInBytes);
+    (*alignment) = static_cast<uint32_t>(resource_allocation_info.Alignment);
+}
+
+void brx_pal_d3d12_device::get_storage_intermediate_buffer_memory_requirements(uint32_t storage_intermediate_buffer_size, uint32_t *size, uint32_t *alignment) const
+{
+    D3D12_RESOURCE_ALLOCATION_INFO resource_allocation_info;
+    brx_pal_d3d12_storage_intermediate_buffer::get_memory_requirements(this->m_device, storage_intermediate_buffer_size, &resource_allocation_info);
+
+    assert(resource_allocation_info.SizeInBytes <= static_cast<UINT64>(UINT32_MAX));
+    (*size) = static_cast<uint32_t>(resource_allocation_info.SizeInBytes);
+    (*alignment) = static_cast<uint32_t>(resource_allocation_info.Alignment);
+}
+
+brx_pal_color_attachment_image *brx_pal_d3d12_device::create_placed_color_attachment_image(brx_pal_memory_heap const *wrapped_memory_heap, uint32_t memory_heap_offset, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT color_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image) const
+{
+    assert(NULL != wrapped_memory_heap);
+    brx_pal_d3d12_memory_heap const *unwrapped_memory_heap = static_cast<brx_pal_d3d12_memory_heap const *>(wrapped_memory_heap);
+    assert(BRX_PAL_MEMORY_HEAP_TYPE_ATTACHMENT_IMAGE == unwrapped_memory_heap->get_type());
+    assert(static_cast<uint64_t>(memory_heap_offset) < unwrapped_memory_heap->get_size());
+
+    void *new_unwrapped_color_attachment_image_base = this->m_color_attachment_image_object_pool.allocate();
+    assert(NULL != new_unwrapped_color_attachment_image_base);
+
+    brx_pal_d3d12_color_attachment_intermediate_image *new_unwrapped_color_attachment_image = new (new_unwrapped_color_attachment_image_base) brx_pal_d3d12_color_attachment_intermediate_image{};
+    new_unwrapped_color_attachment_image->init(this->m_device, this->m_memory_allocator, this->m_color_attachment_intermediate_image_memory_pool, unwrapped_memory_heap->get_allocation(), memory_heap_offset, color_attachment_image_format, width, height, 1U, 1U, allow_sampled_image);
+    return new_unwrapped_color_attachment_image;
+}
+
+brx_pal_depth_stencil_attachment_image *brx_pal_d3d12_device::create_placed_depth_stencil_attachment_image(brx_pal_memory_heap const *wrapped_memory_heap, uint32_t memory_heap_offset, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT depth_stencil_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image) const
+{
+    assert(NULL != wrapped_memory_heap);
+    brx_pal_d3d12_memory_heap const *unwrapped_memory_heap = static_cast<brx_pal_d3d12_memory_heap const *>(wrapped_memory_heap);
+    assert(BRX_PAL_MEMORY_HEAP_TYPE_ATTACHMENT_IMAGE == unwrapped_memory_heap->get_type());
+    assert(static_cast<uint64_t>(memory_heap_offset) < unwrapped_memory_heap->get_size());
+
+    void *new_unwrapped_depth_stencil_attachment_image_base = this->m_depth_stencil_attachment_image_object_pool.allocate();
+    assert(NULL != new_unwrapped_depth_stencil_attachment_image_base);
+
+    brx_pal_d3d12_depth_stencil_attachment_intermediate_image *new_unwrapped_depth_stencil_attachment_image = new (new_unwrapped_depth_stencil_attachment_image_base) brx_pal_d3d12_depth_stencil_attachment_intermediate_image{};
+    new_unwrapped_depth_stencil_attachment_image->init(this->m_device, this->m_memory_allocator, this->m_depth_stencil_attachment_intermediate_image_memory_pool, unwrapped_memory_heap->get_allocation(), memory_heap_offset, depth_stencil_attachment_image_format, width, height, 1U, 1U, allow_sampled_image);
+    return new_unwrapped_depth_stencil_attachment_image;
+}
+
+brx_pal_storage_image *brx_pal_d3d12_device::create_placed_storage_image(brx_pal_memory_heap const *wrapped_memory_heap, uint32_t memory_heap_offset, BRX_PAL_STORAGE_IMAGE_FORMAT wrapped_storage_image_format, uint32_t width, uint32_t height, bool allow_sampled_image) const
+{
+    assert(NULL != wrapped_memory_heap);
+    brx_pal_d3d12_memory_heap const *unwrapped_memory_heap = static_cast<brx_pal_d3d12_memory_heap const *>(wrapped_memory_heap);
+    assert(BRX_PAL_MEMORY_HEAP_TYPE_STORAGE_IMAGE == unwrapped_memory_heap->get_type());
+    assert(static_cast<uint64_t>(memory_heap_offset) < unwrapped_memory_heap->get_size());
+
+    void *new_unwrapped_storage_image_base = this->m_storage_image_object_pool.allocate();
     assert(NULL != new_unwrapped_storage_image_base);
 
     brx_pal_d3d12_storage_intermediate_image *new_unwrapped_storage_image = new (new_unwrapped_storage_image_base) brx_pal_d3d12_storage_intermediate_image{};
-    new_unwrapped_storage_image->init(this->m_memory_allocator, this->m_storage_intermediate_image_memory_pool, unwrapped_storage_image_format, width, height, allow_sampled_image);
+    new_unwrapped_storage_image->init(this->m_memory_allocator, this->m_storage_intermediate_image_memory_pool, unwrapped_memory_heap->get_allocation(), memory_heap_offset, _internal_unwrap_storage_image_format(wrapped_storage_image_format), width, height, allow_sampled_image);
     return new_unwrapped_storage_image;
 }
 
-void brx_pal_d3d12_device::destroy_storage_image(brx_pal_storage_image *wrapped_storage_image) const
+brx_pal_storage_intermediate_buffer *brx_pal_d3d12_device::create_placed_storage_intermediate_buffer(brx_pal_memory_heap const *wrapped_memory_heap, uint32_t memory_heap_offset, uint32_t size) const
 {
-    assert(NULL != wrapped_storage_image);
-    brx_pal_d3d12_storage_intermediate_image *delete_unwrapped_storage_image = static_cast<brx_pal_d3d12_storage_intermediate_image *>(wrapped_storage_image);
+    assert(NULL != wrapped_memory_heap);
+    brx_pal_d3d12_memory_heap const *unwrapped_memory_heap = static_cast<brx_pal_d3d12_memory_heap const *>(wrapped_memory_heap);
+    assert(BRX_PAL_MEMORY_HEAP_TYPE_STORAGE_BUFFER == unwrapped_memory_heap->get_type());
+    assert((static_cast<uint64_t>(memory_heap_offset) + static_cast<uint64_t>(size)) <= unwrapped_memory_heap->get_size());
 
-    delete_unwrapped_storage_image->uninit();
+    void *new_unwrapped_storage_intermediate_buffer_base = this->m_storage_intermediate_buffer_object_pool.allocate();
+    assert(NULL != new_unwrapped_storage_intermediate_buffer_base);
 
-    delete_unwrapped_storage_image->~brx_pal_d3d12_storage_intermediate_image();
-    mcrt_free(delete_unwrapped_storage_image);
+    brx_pal_d3d12_storage_intermediate_buffer *new_unwrapped_storage_intermediate_buffer = new (new_unwrapped_storage_intermediate_buffer_base) brx_pal_d3d12_storage_intermediate_buffer{};
+    new_unwrapped_storage_intermediate_buffer->init(this->m_memory_allocator, this->m_storage_intermediate_buffer_memory_pool, unwrapped_memory_heap->get_allocation(), memory_heap_offset, size);
+    return new_unwrapped_storage_intermediate_buffer;
 }
 
 bool brx_pal_d3d12_device::is_sampled_asset_image_compression_bc_supported() const
@@ -1333,7 +2185,7 @@ brx_pal_sampled_asset_image *brx_pal_d3d12_device::create_sampled_asset_image(BR
         unwrapped_sampled_asset_image_format = DXGI_FORMAT_UNKNOWN;
     }
 
-    void *new_unwrapped_sampled_asset_image_base = mcrt_malloc(sizeof(brx_pal_d3d12_sampled_asset_image), alignof(brx_pal_d3d12_sampled_asset_image));
+    void *new_unwrapped_sampled_asset_image_base = this->m_sampled_asset_image_object_pool.allocate();
     assert(NULL != new_unwrapped_sampled_asset_image_base);
 
     brx_pal_d3d12_sampled_asset_image *new_unwrapped_sampled_asset_image = new (new_unwrapped_sampled_asset_image_base) brx_pal_d3d12_sampled_asset_image{};
@@ -1350,50 +2202,146 @@ void brx_pal_d3d12_device::destroy_sampled_asset_image(brx_pal_sampled_asset_ima
     delete_unwrapped_sampled_asset_image->uninit();
 
     delete_unwrapped_sampled_asset_image->~brx_pal_d3d12_sampled_asset_image();
-    mcrt_free(delete_unwrapped_sampled_asset_image);
+    this->m_sampled_asset_image_object_pool.free(delete_unwrapped_sampled_asset_image);
 }
 
-brx_pal_sampler *brx_pal_d3d12_device::create_sampler(BRX_PAL_SAMPLER_FILTER wrapped_filter, BRX_PAL_SAMPLER_ADDRESS_MODE wrapped_address_mode) const
+brx_pal_sampler *brx_pal_d3d12_device::create_sampler(BRX_PAL_SAMPLER_FILTER filter, BRX_PAL_SAMPLER_ADDRESS_MODE address_mode) const
 {
+    BRX_PAL_SAMPLER_DESC const sampler_desc = {
+        filter,
+        address_mode,
+        address_mode,
+        address_mode,
+        1U,
+        0.0F,
+        0.0F,
+        BRX_PAL_SAMPLER_LOD_CLAMP_NONE,
+        BRX_PAL_SAMPLER_COMPARE_OPERATION_DISABLE,
+        BRX_PAL_SAMPLER_BORDER_COLOR_TRANSPARENT_BLACK};
+
+    return this->create_sampler_with_desc(&sampler_desc);
+}
+
+brx_pal_sampler *brx_pal_d3d12_device::create_sampler_with_desc(BRX_PAL_SAMPLER_DESC const *wrapped_sampler_desc) const
+{
+    // the sampler is merely the state which is copied into the descriptor heap, and there is nothing to be shared on D3D12
+    assert(NULL != wrapped_sampler_desc);
+
+    bool const comparison = (BRX_PAL_SAMPLER_COMPARE_OPERATION_DISABLE != wrapped_sampler_desc->compare_operation);
+
+    uint32_t max_anisotropy = wrapped_sampler_desc->max_anisotropy;
+    if ((BRX_PAL_SAMPLER_FILTER_LINEAR != wrapped_sampler_desc->filter) || (max_anisotropy < 1U))
+    {
+        max_anisotropy = 1U;
+    }
+    else if (max_anisotropy > BRX_PAL_SAMPLER_MAX_ANISOTROPY)
+    {
+        max_anisotropy = BRX_PAL_SAMPLER_MAX_ANISOTROPY;
+    }
+
     D3D12_FILTER unwrapped_filter;
-    switch (wrapped_filter)
+    switch (wrapped_sampler_desc->filter)
     {
     case BRX_PAL_SAMPLER_FILTER_NEAREST:
-        unwrapped_filter = D3D12_FILTER_MIN_MAG_MIP_POINT;
+        unwrapped_filter = comparison ? D3D12_FILTER_COMPARISON_MIN_MAG_MIP_POINT : D3D12_FILTER_MIN_MAG_MIP_POINT;
         break;
     case BRX_PAL_SAMPLER_FILTER_LINEAR:
-        unwrapped_filter = D3D12_FILTER_MIN_MAG_MIP_LINEAR;
+        if (max_anisotropy > 1U)
+        {
+            unwrapped_filter = comparison ? D3D12_FILTER_COMPARISON_ANISOTROPIC : D3D12_FILTER_ANISOTROPIC;
+        }
+        else
+        {
+            unwrapped_filter = comparison ? D3D12_FILTER_COMPARISON_MIN_MAG_MIP_LINEAR : D3D12_FILTER_MIN_MAG_MIP_LINEAR;
+        }
         break;
     default:
         assert(false);
         unwrapped_filter = static_cast<D3D12_FILTER>(-1);
     }
 
-    D3D12_TEXTURE_ADDRESS_MODE unwrapped_address_mode;
-    switch (wrapped_address_mode)
+    D3D12_TEXTURE_ADDRESS_MODE unwrapped_address_modes[3];
+    BRX_PAL_SAMPLER_ADDRESS_MODE const wrapped_address_modes[3] = {wrapped_sampler_desc->address_mode_u, wrapped_sampler_desc->address_mode_v, wrapped_sampler_desc->address_mode_w};
+    for (uint32_t address_mode_index = 0U; address_mode_index < 3U; ++address_mode_index)
     {
-    case BRX_PAL_SAMPLER_ADDRESS_MODE_WRAP:
-        unwrapped_address_mode = D3D12_TEXTURE_ADDRESS_MODE_WRAP;
+        switch (wrapped_address_modes[address_mode_index])
+        {
+        case BRX_PAL_SAMPLER_ADDRESS_MODE_WRAP:
+            unwrapped_address_modes[address_mode_index] = D3D12_TEXTURE_ADDRESS_MODE_WRAP;
+            break;
+        case BRX_PAL_SAMPLER_ADDRESS_MODE_CLAMP:
+            unwrapped_address_modes[address_mode_index] = D3D12_TEXTURE_ADDRESS_MODE_CLAMP;
+            break;
+        case BRX_PAL_SAMPLER_ADDRESS_MODE_MIRROR:
+            unwrapped_address_modes[address_mode_index] = D3D12_TEXTURE_ADDRESS_MODE_MIRROR;
+            break;
+        case BRX_PAL_SAMPLER_ADDRESS_MODE_BORDER:
+            unwrapped_address_modes[address_mode_index] = D3D12_TEXTURE_ADDRESS_MODE_BORDER;
+            break;
+        default:
+            assert(false);
+            unwrapped_address_modes[address_mode_index] = static_cast<D3D12_TEXTURE_ADDRESS_MODE>(-1);
+        }
+    }
+
+    D3D12_COMPARISON_FUNC unwrapped_comparison_func;
+    switch (wrapped_sampler_desc->compare_operation)
+    {
+    case BRX_PAL_SAMPLER_COMPARE_OPERATION_DISABLE:
+        unwrapped_comparison_func = D3D12_COMPARISON_FUNC_NEVER;
+        break;
+    case BRX_PAL_SAMPLER_COMPARE_OPERATION_GREATER:
+        unwrapped_comparison_func = D3D12_COMPARISON_FUNC_GREATER;
+        break;
+    case BRX_PAL_SAMPLER_COMPARE_OPERATION_GREATER_EQUAL:
+        unwrapped_comparison_func = D3D12_COMPARISON_FUNC_GREATER_EQUAL;
         break;
-    case BRX_PAL_SAMPLER_ADDRESS_MODE_CLAMP:
-        unwrapped_address_mode = D3D12_TEXTURE_ADDRESS_MODE_CLAMP;
+    case BRX_PAL_SAMPLER_COMPARE_OPERATION_LESS:
+        unwrapped_comparison_func = D3D12_COMPARISON_FUNC_LESS;
+        break;
+    case BRX_PAL_SAMPLER_COMPARE_OPERATION_LESS_EQUAL:
+        unwrapped_comparison_func = D3D12_COMPARISON_FUNC_LESS_EQUAL;
         break;
     default:
         assert(false);
-        unwrapped_address_mode = static_cast<D3D12_TEXTURE_ADDRESS_MODE>(-1);
+        unwrapped_comparison_func = static_cast<D3D12_COMPARISON_FUNC>(-1);
     }
 
+    float unwrapped_border_color;
+    float unwrapped_border_alpha;
+    switch (wrapped_sampler_desc->border_color)
+    {
+    case BRX_PAL_SAMPLER_BORDER_COLOR_TRANSPARENT_BLACK:
+        unwrapped_border_color = 0.0F;
+        unwrapped_border_alpha = 0.0F;
+        break;
+    case BRX_PAL_SAMPLER_BORDER_COLOR_OPAQUE_BLACK:
+        unwrapped_border_color = 0.0F;
+        unwrapped_border_alpha = 1.0F;
+        break;
+    case BRX_PAL_SAMPLER_BORDER_COLOR_OPAQUE_WHITE:
+        unwrapped_border_color = 1.0F;
+        unwrapped_border_alpha = 1.0F;
+        break;
+    default:
+        assert(false);
+        unwrapped_border_color = -1.0F;
+        unwrapped_border_alpha = -1.0F;
+    }
+
+    assert(wrapped_sampler_desc->min_lod <= wrapped_sampler_desc->max_lod);
+
     D3D12_SAMPLER_DESC sampler_desc = {
         unwrapped_filter,
-        unwrapped_address_mode,
-        unwrapped_address_mode,
-        unwrapped_address_mode,
-        0.0F,
-        1U,
-        D3D12_COMPARISON_FUNC_NEVER,
-        {0.0F, 0.0F, 0.0F, 0.0F},
-        0.0F,
-        1000.0F};
+        unwrapped_address_modes[0],
+        unwrapped_address_modes[1],
+        unwrapped_address_modes[2],
+        wrapped_sampler_desc->mip_lod_bias,
+        max_anisotropy,
+        unwrapped_comparison_func,
+        {unwrapped_border_color, unwrapped_border_color, unwrapped_border_color, unwrapped_border_alpha},
+        wrapped_sampler_desc->min_lod,
+        wrapped_sampler_desc->max_lod};
 
     void *new_brx_pal_sampler_base = mcrt_malloc(sizeof(brx_pal_d3d12_sampler), alignof(brx_pal_d3d12_sampler));
     assert(NULL != new_brx_pal_sampler_base);
@@ -1832,6 +2780,71 @@ void brx_pal_d3d12_device::destroy_compacted_bottom_level_acceleration_structure
     mcrt_free(delete_unwrapped_compacted_bottom_level_acceleration_structure);
 }
 
+brx_pal_serialized_bottom_level_acceleration_structure_size_query_pool *brx_pal_d3d12_device::create_serialized_bottom_level_acceleration_structure_size_query_pool(uint32_t query_count) const
+{
+    void *new_unwrapped_serialized_bottom_level_acceleration_structure_size_query_pool_base = mcrt_malloc(sizeof(brx_pal_d3d12_serialized_bottom_level_acceleration_structure_size_query_pool), alignof(brx_pal_d3d12_serialized_bottom_level_acceleration_structure_size_query_pool));
+    assert(NULL != new_unwrapped_serialized_bottom_level_acceleration_structure_size_query_pool_base);
+
+    brx_pal_d3d12_serialized_bottom_level_acceleration_structure_size_query_pool *new_unwrapped_serialized_bottom_level_acceleration_structure_size_query_pool = new (new_unwrapped_serialized_bottom_level_acceleration_structure_size_query_pool_base) brx_pal_d3d12_serialized_bottom_level_acceleration_structure_size_query_pool{};
+    new_unwrapped_serialized_bottom_level_acceleration_structure_size_query_pool->init(this->m_memory_allocator, this->m_compacted_bottom_level_acceleration_structure_size_query_buffer_memory_pool, query_count);
+    return new_unwrapped_serialized_bottom_level_acceleration_structure_size_query_pool;
+}
+
+uint32_t brx_pal_d3d12_device::get_serialized_bottom_level_acceleration_structure_size_query_pool_result(brx_pal_serialized_bottom_level_acceleration_structure_size_query_pool const *wrapped_serialized_bottom_level_acceleration_structure_size_query_pool, uint32_t query_index) const
+{
+    assert(NULL != wrapped_serialized_bottom_level_acceleration_structure_size_query_pool);
+    brx_pal_d3d12_serialized_bottom_level_acceleration_structure_size_query_pool const *const unwrapped_serialized_bottom_level_acceleration_structure_size_query_pool = static_cast<brx_pal_d3d12_serialized_bottom_level_acceleration_structure_size_query_pool const *>(wrapped_serialized_bottom_level_acceleration_structure_size_query_pool);
+
+    D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_SERIALIZATION_DESC volatile *const query_pool_memory_range_base = unwrapped_serialized_bottom_level_acceleration_structure_size_query_pool->get_host_memory_range_base();
+
+    assert(0U == query_pool_memory_range_base[query_index].NumBottomLevelAccelerationStructurePointers);
+    return static_cast<uint32_t>(query_pool_memory_range_base[query_index].SerializedSizeInBytes);
+}
+
+void brx_pal_d3d12_device::destroy_serialized_bottom_level_acceleration_structure_size_query_pool(brx_pal_serialized_bottom_level_acceleration_structure_size_query_pool *wrapped_serialized_bottom_level_acceleration_structure_size_query_pool) const
+{
+    assert(NULL != wrapped_serialized_bottom_level_acceleration_structure_size_query_pool);
+    brx_pal_d3d12_serialized_bottom_level_acceleration_structure_size_query_pool *delete_unwrapped_serialized_bottom_level_acceleration_structure_size_query_pool = static_cast<brx_pal_d3d12_serialized_bottom_level_acceleration_structure_size_query_pool *>(wrapped_serialized_bottom_level_acceleration_structure_size_query_pool);
+
+    delete_unwrapped_serialized_bottom_level_acceleration_structure_size_query_pool->uninit();
+
+    delete_unwrapped_serialized_bottom_level_acceleration_structure_size_query_pool->~brx_pal_d3d12_serialized_bottom_level_acceleration_structure_size_query_pool();
+    mcrt_free(delete_unwrapped_serialized_bottom_level_acceleration_structure_size_query_pool);
+}
+
+brx_pal_serialized_bottom_level_acceleration_structure_buffer *brx_pal_d3d12_device::create_serialized_bottom_level_acceleration_structure_buffer(uint32_t size) const
+{
+    void *new_unwrapped_serialized_bottom_level_acceleration_structure_buffer_base = mcrt_malloc(sizeof(brx_pal_d3d12_serialized_bottom_level_acceleration_structure_buffer), alignof(brx_pal_d3d12_serialized_bottom_level_acceleration_structure_buffer));
+    assert(NULL != new_unwrapped_serialized_bottom_level_acceleration_structure_buffer_base);
+
+    brx_pal_d3d12_serialized_bottom_level_acceleration_structure_buffer *new_unwrapped_serialized_bottom_level_acceleration_structure_buffer = new (new_unwrapped_serialized_bottom_level_acceleration_structure_buffer_base) brx_pal_d3d12_serialized_bottom_level_acceleration_structure_buffer{};
+    new_unwrapped_serialized_bottom_level_acceleration_structure_buffer->init(this->m_memory_allocator, this->m_serialized_bottom_level_acceleration_structure_buffer_memory_pool, size);
+    return new_unwrapped_serialized_bottom_level_acceleration_structure_buffer;
+}
+
+void brx_pal_d3d12_device::destroy_serialized_bottom_level_acceleration_structure_buffer(brx_pal_serialized_bottom_level_acceleration_structure_buffer *wrapped_serialized_bottom_level_acceleration_structure_buffer) const
+{
+    assert(NULL != wrapped_serialized_bottom_level_acceleration_structure_buffer);
+    brx_pal_d3d12_serialized_bottom_level_acceleration_structure_buffer *delete_unwrapped_serialized_bottom_level_acceleration_structure_buffer = static_cast<brx_pal_d3d12_serialized_bottom_level_acceleration_structure_buffer *>(wrapped_serialized_bottom_level_acceleration_structure_buffer);
+
+    delete_unwrapped_serialized_bottom_level_acceleration_structure_buffer->uninit();
+
+    delete_unwrapped_serialized_bottom_level_acceleration_structure_buffer->~brx_pal_d3d12_serialized_bottom_level_acceleration_structure_buffer();
+    mcrt_free(delete_unwrapped_serialized_bottom_level_acceleration_structure_buffer);
+}
+
+bool brx_pal_d3d12_device::is_serialized_bottom_level_acceleration_structure_compatible(BRX_PAL_SERIALIZED_BOTTOM_LEVEL_ACCELERATION_STRUCTURE_HEADER const *serialized_bottom_level_acceleration_structure_header) const
+{
+    assert(this->m_support_ray_tracing);
+
+    static_assert(sizeof(serialized_bottom_level_acceleration_structure_header->driver_matching_identifier) == sizeof(D3D12_SERIALIZED_DATA_DRIVER_MATCHING_IDENTIFIER), "");
+
+    assert(NULL != serialized_bottom_level_acceleration_structure_header);
+    D3D12_DRIVER_MATCHING_IDENTIFIER_STATUS const driver_matching_identifier_status = this->m_device->CheckDriverMatchingIdentifier(D3D12_SERIALIZED_DATA_RAYTRACING_ACCELERATION_STRUCTURE, reinterpret_cast<D3D12_SERIALIZED_DATA_DRIVER_MATCHING_IDENTIFIER const *>(serialized_bottom_level_acceleration_structure_header->driver_matching_identifier));
+
+    return (D3D12_DRIVER_MATCHING_IDENTIFIER_COMPATIBLE_WITH_DEVICE == driver_matching_identifier_status);
+}
+
 brx_pal_top_level_acceleration_structure_instance_upload_buffer *brx_pal_d3d12_device::create_top_level_acceleration_structure_instance_upload_buffer(uint32_t instance_count) const
 {
     void *new_unwrapped_top_level_acceleration_structure_instance_upload_buffer_base = mcrt_malloc(sizeof(brx_pal_d3d12_top_level_acceleration_structure_instance_upload_buffer), alignof(brx_pal_d3d12_top_level_acceleration_structure_instance_upload_buffer));
@@ -1898,3 +2911,29 @@ void brx_pal_d3d12_device::destroy_top_level_acceleration_structure(brx_pal_top_
     delete_unwrapped_top_level_acceleration_structure->~brx_pal_d3d12_top_level_acceleration_structure();
     mcrt_free(delete_unwrapped_top_level_acceleration_structure);
 }
+
+static inline DXGI_FORMAT _internal_unwrap_storage_image_format(BRX_PAL_STORAGE_IMAGE_FORMAT wrapped_storage_image_format)
+{
+    DXGI_FORMAT unwrapped_storage_image_format;
+    switch (wrapped_storage_image_format)
+    {
+    case BRX_PAL_STORAGE_IMAGE_FORMAT_R16_SFLOAT:
+        unwrapped_storage_image_format = DXGI_FORMAT_R16_FLOAT;
+        break;
+    case BRX_PAL_STORAGE_IMAGE_FORMAT_R16G16B16A16_SFLOAT:
+        unwrapped_storage_image_format = DXGI_FORMAT_R16G16B16A16_FLOAT;
+        break;
+    case BRX_PAL_STORAGE_IMAGE_FORMAT_R32_UINT:
+        unwrapped_storage_image_format = DXGI_FORMAT_R32_UINT;
+        break;
+    default:
+        assert(false);
+        unwrapped_storage_image_format = static_cast<DXGI_FORMAT>(-1);
+    }
+    return unwrapped_storage_image_format;
+}
+
+static inline uint64_t _internal_get_elapsed_nanoseconds(std::chrono::steady_clock::time_point begin_time, std::chrono::steady_clock::time_point end_time)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - begin_time).count());
+}
@@ -29,6 +29,7 @@
 #define D3D12MA_D3D12_HEADERS_ALREADY_INCLUDED 1
 #include "../thirdparty/D3D12MemoryAllocator/include/D3D12MemAlloc.h"
 #include "brx_pal_d3d12_descriptor_allocator.h"
+#include "brx_pal_object_pool.h"
 
 class brx_pal_d3d12_device final : public brx_pal_device
 {
@@ -44,8 +45,21 @@ class brx_pal_d3d12_device final : public brx_pal_device
     bool m_uma;
     bool m_cache_coherent_uma;
 
+    uint32_t m_max_attachment_sample_count;
+
+    uint32_t m_max_multiview_view_count;
+
+    bool m_support_mesh_shader;
+    ID3D12CommandSignature *m_draw_mesh_tasks_indirect_command_signature;
+
+    BRX_PAL_SUBGROUP_PROPERTIES m_subgroup_properties;
+
+    bool m_support_bindless;
+    BRX_PAL_BINDLESS_DESCRIPTOR_LIMITS m_bindless_descriptor_limits;
+
     ID3D12CommandQueue *m_graphics_queue;
     ID3D12CommandQueue *m_upload_queue;
+    ID3D12CommandQueue *m_compute_queue;
 
     D3D12MA::Allocator *m_memory_allocator;
     D3D12MA::Pool *m_uniform_upload_buffer_memory_pool;
@@ -61,11 +75,26 @@ class brx_pal_d3d12_device final : public brx_pal_device
     D3D12MA::Pool *m_non_compacted_bottom_level_acceleration_structure_memory_pool;
     D3D12MA::Pool *m_compacted_bottom_level_acceleration_structure_size_query_buffer_memory_pool;
     D3D12MA::Pool *m_compacted_bottom_level_acceleration_structure_memory_pool;
+    D3D12MA::Pool *m_serialized_bottom_level_acceleration_structure_buffer_memory_pool;
     D3D12MA::Pool *m_top_level_acceleration_structure_instance_upload_buffer_memory_pool;
     D3D12MA::Pool *m_top_level_acceleration_structure_memory_pool;
 
     brx_pal_d3d12_descriptor_allocator m_descriptor_allocator;
 
+    mutable brx_pal_lock_free_object_pool m_fence_object_pool;
+    mutable brx_pal_lock_free_object_pool m_descriptor_set_object_pool;
+    mutable brx_pal_lock_free_object_pool m_graphics_pipeline_object_pool;
+    mutable brx_pal_lock_free_object_pool m_compute_pipeline_object_pool;
+    mutable brx_pal_lock_free_object_pool m_uniform_upload_buffer_object_pool;
+    mutable brx_pal_lock_free_object_pool m_staging_upload_buffer_object_pool;
+    mutable brx_pal_lock_free_object_pool m_storage_intermediate_buffer_object_pool;
+    mutable brx_pal_lock_free_object_pool m_color_attachment_image_object_pool;
+    mutable brx_pal_lock_free_object_pool m_depth_stencil_attachment_image_object_pool;
+    mutable brx_pal_lock_free_object_pool m_storage_image_object_pool;
+    mutable brx_pal_lock_free_object_pool m_sampled_asset_image_object_pool;
+
+    BRX_PAL_DEVICE_CREATION_TIMING m_device_creation_timing;
+
 public:
     brx_pal_d3d12_device();
     void init(bool support_ray_tracing);
@@ -75,34 +104,76 @@ public:
 private:
     BRX_PAL_BACKEND_NAME get_backend_name() const override;
     bool is_ray_tracing_supported() const override;
+    bool is_dynamic_rendering_supported() const override;
     brx_pal_graphics_queue *create_graphics_queue() const override;
     void destroy_graphics_queue(brx_pal_graphics_queue *graphics_queue) const override;
     brx_pal_upload_queue *create_upload_queue() const override;
     void destroy_upload_queue(brx_pal_upload_queue *upload_queue) const override;
+    brx_pal_compute_queue *create_compute_queue() const override;
+    void destroy_compute_queue(brx_pal_compute_queue *compute_queue) const override;
     brx_pal_graphics_command_buffer *create_graphics_command_buffer() const override;
     void reset_graphics_command_buffer(brx_pal_graphics_command_buffer *graphics_command_buffer) const override;
     void destroy_graphics_command_buffer(brx_pal_graphics_command_buffer *graphics_command_buffer) const override;
     brx_pal_upload_command_buffer *create_upload_command_buffer() const override;
     void reset_upload_command_buffer(brx_pal_upload_command_buffer *upload_command_buffer) const override;
     void destroy_upload_command_buffer(brx_pal_upload_command_buffer *upload_command_buffer) const override;
+    brx_pal_compute_command_buffer *create_compute_command_buffer() const override;
+    void reset_compute_command_buffer(brx_pal_compute_command_buffer *compute_command_buffer) const override;
+    void destroy_compute_command_buffer(brx_pal_compute_command_buffer *compute_command_buffer) const override;
     brx_pal_fence *create_fence(bool signaled) const override;
     void wait_for_fence(brx_pal_fence *fence) const override;
     void reset_fence(brx_pal_fence *fence) const override;
     void destroy_fence(brx_pal_fence *fence) const override;
     brx_pal_descriptor_set_layout *create_descriptor_set_layout(uint32_t descriptor_set_binding_count, BRX_PAL_DESCRIPTOR_SET_LAYOUT_BINDING const *descriptor_set_bindings) const override;
     void destroy_descriptor_set_layout(brx_pal_descriptor_set_layout *descriptor_set_layout) const override;
-    brx_pal_pipeline_layout *create_pipeline_layout(uint32_t descriptor_set_layout_count, brx_pal_descriptor_set_layout const *const *descriptor_set_layouts) const override;
+    brx_pal_pipeline_layout *create_pipeline_layout(uint32_t descriptor_set_layout_count, brx_pal_descriptor_set_layout const *const *descriptor_set_layouts, uint32_t push_constant_size) const override;
     void destroy_pipeline_layout(brx_pal_pipeline_layout *pipeline_layout) const override;
     brx_pal_descriptor_set *create_descriptor_set(brx_pal_descriptor_set_layout const *descriptor_set_layout, uint32_t unbounded_descriptor_count) override;
     void write_descriptor_set(brx_pal_descriptor_set *descriptor_set, uint32_t dst_binding, BRX_PAL_DESCRIPTOR_TYPE descriptor_type, uint32_t dst_descriptor_start_index, uint32_t src_descriptor_count, brx_pal_uniform_upload_buffer const *const *src_dynamic_uniform_buffers, uint32_t const *src_dynamic_uniform_buffer_ranges, brx_pal_read_only_storage_buffer const *const *src_read_only_storage_buffers, brx_pal_storage_buffer const *const *src_storage_buffers, brx_pal_sampled_image const *const *src_sampled_images, brx_pal_storage_image const *const *src_storage_images, brx_pal_sampler const *const *src_samplers, brx_pal_top_level_acceleration_structure const *const *src_top_level_acceleration_structures) override;
     void destroy_descriptor_set(brx_pal_descriptor_set *descriptor_set) override;
-    brx_pal_render_pass *create_render_pass(uint32_t color_attachment_count, BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT const *color_attachments, BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT const *depth_stencil_attachment) const override;
+    brx_pal_descriptor_update_template *create_descriptor_update_template(brx_pal_descriptor_set_layout const *descriptor_set_layout, uint32_t entry_count, BRX_PAL_DESCRIPTOR_UPDATE_TEMPLATE_ENTRY const *entries) const override;
+    void destroy_descriptor_update_template(brx_pal_descriptor_update_template *descriptor_update_template) const override;
+    void write_descriptor_sets_with_template(uint32_t descriptor_set_count, brx_pal_descriptor_set *const *descriptor_sets, brx_pal_descriptor_update_template const *descriptor_update_template, void const *const *src_descriptors, uint32_t const *src_dynamic_uniform_buffer_ranges) override;
+    bool is_bindless_supported() const override;
+    void get_bindless_descriptor_limits(BRX_PAL_BINDLESS_DESCRIPTOR_LIMITS *bindless_descriptor_limits) const override;
+    brx_pal_descriptor_set_layout *create_bindless_descriptor_set_layout(uint32_t read_only_storage_buffer_descriptor_count, uint32_t sampled_image_descriptor_count, uint32_t sampler_descriptor_count) const override;
+    brx_pal_bindless_descriptor_index_allocator *create_bindless_descriptor_index_allocator(uint32_t read_only_storage_buffer_descriptor_count, uint32_t sampled_image_descriptor_count, uint32_t sampler_descriptor_count, uint32_t frame_throttling_count) const override;
+    void destroy_bindless_descriptor_index_allocator(brx_pal_bindless_descriptor_index_allocator *bindless_descriptor_index_allocator) const override;
+    brx_pal_render_graph *create_render_graph(uint32_t frame_throttling_count) const override;
+    void destroy_render_graph(brx_pal_render_graph *render_graph) const override;
+    brx_pal_deferred_destruction_queue *create_deferred_destruction_queue(uint32_t frame_throttling_count) override;
+    void destroy_deferred_destruction_queue(brx_pal_deferred_destruction_queue *deferred_destruction_queue) override;
+    brx_pal_acceleration_structure_update_manager *create_acceleration_structure_update_manager(BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_POLICY const *policy) const override;
+    void destroy_acceleration_structure_update_manager(brx_pal_acceleration_structure_update_manager *acceleration_structure_update_manager) const override;
+    void get_object_pool_statistics(BRX_PAL_OBJECT_POOL_TYPE object_pool_type, uint32_t *live_object_count, uint32_t *reserved_object_count) const override;
+    void get_device_creation_timing(BRX_PAL_DEVICE_CREATION_TIMING *device_creation_timing) const override;
+    void get_subgroup_properties(BRX_PAL_SUBGROUP_PROPERTIES *subgroup_properties) const override;
+    brx_pal_render_pass *create_render_pass(uint32_t color_attachment_count, BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT const *color_attachments, BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT const *depth_stencil_attachment, uint32_t view_count) const override;
     void destroy_render_pass(brx_pal_render_pass *render_pass) const override;
-    brx_pal_graphics_pipeline *create_graphics_pipeline(brx_pal_render_pass const *render_pass, brx_pal_pipeline_layout const *pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const override;
+    brx_pal_graphics_pipeline *create_graphics_pipeline(brx_pal_render_pass const *render_pass, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const override;
+    brx_pal_graphics_pipeline *create_dynamic_rendering_graphics_pipeline(uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const override;
+    brx_pal_graphics_pipeline *create_specialized_graphics_pipeline(brx_pal_render_pass const *render_pass, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *vertex_shader_specialization, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *fragment_shader_specialization, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const override;
+    brx_pal_graphics_pipeline *create_specialized_dynamic_rendering_graphics_pipeline(uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *vertex_shader_specialization, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *fragment_shader_specialization, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const override;
     void destroy_graphics_pipeline(brx_pal_graphics_pipeline *graphics_pipeline) const override;
+    bool is_graphics_pipeline_library_supported() const override;
+    bool is_extended_dynamic_state_supported() const override;
+    brx_pal_graphics_pipeline *create_extended_dynamic_state_graphics_pipeline(brx_pal_render_pass const *render_pass, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *vertex_shader_specialization, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *fragment_shader_specialization) const override;
+    brx_pal_graphics_pipeline *create_extended_dynamic_state_dynamic_rendering_graphics_pipeline(uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *vertex_shader_specialization, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *fragment_shader_specialization) const override;
+    bool is_mesh_shader_supported() const override;
+    brx_pal_graphics_pipeline *create_mesh_shader_graphics_pipeline(brx_pal_render_pass const *render_pass, brx_pal_pipeline_layout const *pipeline_layout, size_t task_shader_module_code_size, void const *task_shader_module_code, size_t mesh_shader_module_code_size, void const *mesh_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const override;
+    brx_pal_graphics_pipeline *create_mesh_shader_dynamic_rendering_graphics_pipeline(uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, size_t task_shader_module_code_size, void const *task_shader_module_code, size_t mesh_shader_module_code_size, void const *mesh_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const override;
+    brx_pal_graphics_pipeline_pre_rasterization_shader_library *create_graphics_pipeline_pre_rasterization_shader_library(uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, bool enable_back_face_cull, bool front_ccw) const override;
+    void destroy_graphics_pipeline_pre_rasterization_shader_library(brx_pal_graphics_pipeline_pre_rasterization_shader_library *pre_rasterization_shader_library) const override;
+    brx_pal_graphics_pipeline_fragment_shader_library *create_graphics_pipeline_fragment_shader_library(uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation) const override;
+    void destroy_graphics_pipeline_fragment_shader_library(brx_pal_graphics_pipeline_fragment_shader_library *fragment_shader_library) const override;
+    brx_pal_graphics_pipeline_fragment_output_interface_library *create_graphics_pipeline_fragment_output_interface_library(uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const override;
+    void destroy_graphics_pipeline_fragment_output_interface_library(brx_pal_graphics_pipeline_fragment_output_interface_library *fragment_output_interface_library) const override;
+    brx_pal_graphics_pipeline *create_linked_graphics_pipeline(brx_pal_pipeline_layout const *pipeline_layout, brx_pal_graphics_pipeline_pre_rasterization_shader_library const *pre_rasterization_shader_library, brx_pal_graphics_pipeline_fragment_shader_library const *fragment_shader_library, brx_pal_graphics_pipeline_fragment_output_interface_library const *fragment_output_interface_library, bool link_time_optimization) const override;
     brx_pal_compute_pipeline *create_compute_pipeline(brx_pal_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code) const override;
+    brx_pal_compute_pipeline *create_specialized_compute_pipeline(brx_pal_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *compute_shader_specialization) const override;
+    brx_pal_compute_pipeline *create_subgroup_size_control_compute_pipeline(brx_pal_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *compute_shader_specialization, uint32_t required_subgroup_size, bool require_full_subgroups) const override;
     void destroy_compute_pipeline(brx_pal_compute_pipeline *compute_pipeline) const override;
-    brx_pal_frame_buffer *create_frame_buffer(brx_pal_render_pass const *render_pass, uint32_t width, uint32_t height, uint32_t color_attachment_count, brx_pal_color_attachment_image const *const *color_attachments, brx_pal_depth_stencil_attachment_image const *depth_stencil_attachment) const override;
+    brx_pal_frame_buffer *create_frame_buffer(brx_pal_render_pass const *render_pass, uint32_t width, uint32_t height, uint32_t color_attachment_count, brx_pal_color_attachment_image const *const *color_attachments, brx_pal_color_attachment_image const *const *color_resolve_attachments, brx_pal_depth_stencil_attachment_image const *depth_stencil_attachment) const override;
     void destroy_frame_buffer(brx_pal_frame_buffer *frame_buffer) const override;
     uint32_t get_uniform_upload_buffer_offset_alignment() const override;
     brx_pal_uniform_upload_buffer *create_uniform_upload_buffer(uint32_t size) const override;
@@ -121,13 +192,30 @@ private:
     BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT get_depth_stencil_attachment_image_format() const override;
     brx_pal_depth_stencil_attachment_image *create_depth_stencil_attachment_image(BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT depth_stencil_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image) const override;
     void destroy_depth_stencil_attachment_image(brx_pal_depth_stencil_attachment_image *depth_stencil_attachment_image) const override;
+    uint32_t get_max_attachment_sample_count() const override;
+    brx_pal_color_attachment_image *create_multisample_color_attachment_image(BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT color_attachment_image_format, uint32_t width, uint32_t height, uint32_t sample_count) const override;
+    brx_pal_depth_stencil_attachment_image *create_multisample_depth_stencil_attachment_image(BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT depth_stencil_attachment_image_format, uint32_t width, uint32_t height, uint32_t sample_count) const override;
+    uint32_t get_max_multiview_view_count() const override;
+    brx_pal_color_attachment_image *create_layered_color_attachment_image(BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT color_attachment_image_format, uint32_t width, uint32_t height, uint32_t layer_count, bool allow_sampled_image) const override;
+    brx_pal_depth_stencil_attachment_image *create_layered_depth_stencil_attachment_image(BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT depth_stencil_attachment_image_format, uint32_t width, uint32_t height, uint32_t layer_count, bool allow_sampled_image) const override;
     brx_pal_storage_image *create_storage_image(BRX_PAL_STORAGE_IMAGE_FORMAT storage_image_format, uint32_t width, uint32_t height, bool allow_sampled_image) const override;
     void destroy_storage_image(brx_pal_storage_image *storage_image) const override;
+    brx_pal_memory_heap *create_memory_heap(BRX_PAL_MEMORY_HEAP_TYPE memory_heap_type, uint32_t size) const override;
+    void destroy_memory_heap(brx_pal_memory_heap *memory_heap) const override;
+    void get_color_attachment_image_memory_requirements(BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT color_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image, uint32_t *size, uint32_t *alignment) const override;
+    void get_depth_stencil_attachment_image_memory_requirements(BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT depth_stencil_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image, uint32_t *size, uint32_t *alignment) const override;
+    void get_storage_image_memory_requirements(BRX_PAL_STORAGE_IMAGE_FORMAT storage_image_format, uint32_t width, uint32_t height, bool allow_sampled_image, uint32_t *size, uint32_t *alignment) const override;
+    void get_storage_intermediate_buffer_memory_requirements(uint32_t storage_intermediate_buffer_size, uint32_t *size, uint32_t *alignment) const override;
+    brx_pal_color_attachment_image *create_placed_color_attachment_image(brx_pal_memory_heap const *memory_heap, uint32_t memory_heap_offset, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT color_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image) const override;
+    brx_pal_depth_stencil_attachment_image *create_placed_depth_stencil_attachment_image(brx_pal_memory_heap const *memory_heap, uint32_t memory_heap_offset, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT depth_stencil_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image) const override;
+    brx_pal_storage_image *create_placed_storage_image(brx_pal_memory_heap const *memory_heap, uint32_t memory_heap_offset, BRX_PAL_STORAGE_IMAGE_FORMAT storage_image_format, uint32_t width, uint32_t height, bool allow_sampled_image) const override;
+    brx_pal_storage_intermediate_buffer *create_placed_storage_intermediate_buffer(brx_pal_memory_heap const *memory_heap, uint32_t memory_heap_offset, uint32_t size) const override;
     bool is_sampled_asset_image_compression_bc_supported() const override;
     bool is_sampled_asset_image_compression_astc_supported() const override;
     brx_pal_sampled_asset_image *create_sampled_asset_image(BRX_PAL_SAMPLED_ASSET_IMAGE_FORMAT sampled_asset_image_format, uint32_t width, uint32_t height, uint32_t mip_levels) const override;
     void destroy_sampled_asset_image(brx_pal_sampled_asset_image *sampled_asset_image) const override;
     brx_pal_sampler *create_sampler(BRX_PAL_SAMPLER_FILTER filter, BRX_PAL_SAMPLER_ADDRESS_MODE address_mode) const override;
+    brx_pal_sampler *create_sampler_with_desc(BRX_PAL_SAMPLER_DESC const *sampler_desc) const override;
     void destroy_sampler(brx_pal_sampler *sampler) const override;
     brx_pal_surface *create_surface(void *wsi_window) const override;
     void destroy_surface(brx_pal_surface *surface) const override;
@@ -147,6 +235,12 @@ private:
     void destroy_compacted_bottom_level_acceleration_structure_size_query_pool(brx_pal_compacted_bottom_level_acceleration_structure_size_query_pool *compacted_bottom_level_acceleration_structure_size_query_pool) const override;
     brx_pal_compacted_bottom_level_acceleration_structure *create_compacted_bottom_level_acceleration_structure(uint32_t size) const override;
     void destroy_compacted_bottom_level_acceleration_structure(brx_pal_compacted_bottom_level_acceleration_structure *compacted_bottom_level_acceleration_structure) const override;
+    brx_pal_serialized_bottom_level_acceleration_structure_size_query_pool *create_serialized_bottom_level_acceleration_structure_size_query_pool(uint32_t query_count) const override;
+    uint32_t get_serialized_bottom_level_acceleration_structure_size_query_pool_result(brx_pal_serialized_bottom_level_acceleration_structure_size_query_pool const *serialized_bottom_level_acceleration_structure_size_query_pool, uint32_t query_index) const override;
+    void destroy_serialized_bottom_level_acceleration_structure_size_query_pool(brx_pal_serialized_bottom_level_acceleration_structure_size_query_pool *serialized_bottom_level_acceleration_structure_size_query_pool) const override;
+    brx_pal_serialized_bottom_level_acceleration_structure_buffer *create_serialized_bottom_level_acceleration_structure_buffer(uint32_t size) const override;
+    void destroy_serialized_bottom_level_acceleration_structure_buffer(brx_pal_serialized_bottom_level_acceleration_structure_buffer *serialized_bottom_level_acceleration_structure_buffer) const override;
+    bool is_serialized_bottom_level_acceleration_structure_compatible(BRX_PAL_SERIALIZED_BOTTOM_LEVEL_ACCELERATION_STRUCTURE_HEADER const *serialized_bottom_level_acceleration_structure_header) const override;
     brx_pal_top_level_acceleration_structure_instance_upload_buffer *create_top_level_acceleration_structure_instance_upload_buffer(uint32_t instance_count) const override;
     void destroy_top_level_acceleration_structure_instance_upload_buffer(brx_pal_top_level_acceleration_structure_instance_upload_buffer *top_level_acceleration_structure_instance_upload_buffer) const override;
     void get_top_level_acceleration_structure_size(uint32_t top_level_acceleration_structure_instance_count, uint32_t *top_level_acceleration_structure_size, uint32_t *build_scratch_size, uint32_t *update_scratch_size) const override;
@@ -167,6 +261,7 @@ public:
     ~brx_pal_d3d12_graphics_queue();
     void wait_and_submit(brx_pal_upload_command_buffer const *upload_command_buffer_to_wait, brx_pal_graphics_command_buffer const *graphics_command_buffer_to_submit, brx_pal_fence *fence_to_signal) const override;
     bool submit_and_present(brx_pal_graphics_command_buffer *graphics_command_buffer_to_submit, brx_pal_swap_chain *swap_chain_to_present, uint32_t swap_chain_image_index, brx_pal_fence *fence_to_signal) const override;
+    void wait(brx_pal_compute_command_buffer const *compute_command_buffer_to_wait) const override;
 };
 
 class brx_pal_d3d12_upload_queue final : public brx_pal_upload_queue
@@ -183,20 +278,49 @@ public:
     void submit_and_signal(brx_pal_upload_command_buffer const *upload_command_buffer_to_submit_and_signal) const override;
 };
 
+// The resting state of the storage resources (PIXEL_SHADER_RESOURCE) is NOT supported by the compute queue, and the storage resources are transitioned to the common state by the graphics queue before the compute command list is executed
+class brx_pal_d3d12_compute_queue final : public brx_pal_compute_queue
+{
+    ID3D12CommandQueue *m_graphics_queue;
+    ID3D12CommandQueue *m_compute_queue;
+
+public:
+    brx_pal_d3d12_compute_queue();
+    void init(ID3D12CommandQueue *graphics_queue, ID3D12CommandQueue *compute_queue);
+    void uninit(ID3D12CommandQueue *graphics_queue, ID3D12CommandQueue *compute_queue);
+    ~brx_pal_d3d12_compute_queue();
+    void submit_and_signal(brx_pal_compute_command_buffer const *compute_command_buffer_to_submit_and_signal) const override;
+};
+
 class brx_pal_d3d12_graphics_command_buffer final : public brx_pal_graphics_command_buffer
 {
     bool m_uma;
     bool m_support_ray_tracing;
     ID3D12CommandAllocator *m_command_allocator;
     ID3D12GraphicsCommandList4 *m_command_list;
+    ID3D12GraphicsCommandList6 *m_mesh_shader_command_list;
+    ID3D12CommandSignature *m_draw_mesh_tasks_indirect_command_signature;
     brx_pal_d3d12_descriptor_allocator *m_descriptor_allocator;
+    ID3D12Device *m_device;
+    ID3D12DescriptorHeap *m_clear_unordered_access_view_shader_visible_descriptor_heap;
+    ID3D12DescriptorHeap *m_clear_unordered_access_view_non_shader_visible_descriptor_heap;
+    UINT m_clear_unordered_access_view_descriptor_increment_size;
+    uint32_t m_clear_unordered_access_view_descriptor_capacity;
+    uint32_t m_clear_unordered_access_view_descriptor_count;
+    // the full heaps are still referenced by the recorded commands and are released by the next "begin"
+    mcrt_vector<ID3D12DescriptorHeap *> m_retired_clear_unordered_access_view_descriptor_heaps;
     class brx_pal_d3d12_render_pass const *m_current_render_pass;
     class brx_pal_d3d12_frame_buffer const *m_current_frame_buffer;
+    bool m_current_rendering;
+    mcrt_vector<D3D12_RESOURCE_BARRIER> m_current_rendering_store_barriers;
+    mcrt_vector<ID3D12Resource *> m_current_rendering_resolve_source_resources;
+    mcrt_vector<ID3D12Resource *> m_current_rendering_resolve_destination_resources;
+    mcrt_vector<D3D12_RESOURCE_STATES> m_current_rendering_resolve_destination_states;
     mcrt_vector<uint32_t> m_current_vertex_buffer_strides;
 
 public:
     brx_pal_d3d12_graphics_command_buffer();
-    void init(ID3D12Device *device, bool uma, bool support_ray_tracing, brx_pal_d3d12_descriptor_allocator *descriptor_allocator);
+    void init(ID3D12Device *device, D3D12_COMMAND_LIST_TYPE command_list_type, bool uma, bool support_ray_tracing, ID3D12CommandSignature *draw_mesh_tasks_indirect_command_signature, brx_pal_d3d12_descriptor_allocator *descriptor_allocator);
     void uninit();
     ~brx_pal_d3d12_graphics_command_buffer();
     ID3D12CommandAllocator *get_command_allocator() const;
@@ -209,15 +333,34 @@ public:
     void bind_graphics_pipeline(brx_pal_graphics_pipeline const *graphics_pipeline) override;
     void set_view_port(uint32_t width, uint32_t height) override;
     void set_scissor(int32_t offset_width, int32_t offset_height, uint32_t width, uint32_t height) override;
+    void set_cull_mode(bool enable_back_face_cull, bool front_ccw) override;
+    void set_depth_compare_operation(BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation) override;
+    void set_blend_operation(BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) override;
     void bind_graphics_descriptor_sets(brx_pal_pipeline_layout const *pipeline_layout, uint32_t descriptor_set_count, brx_pal_descriptor_set const *const *descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets) override;
+    void push_graphics_constants(brx_pal_pipeline_layout const *pipeline_layout, uint32_t offset, uint32_t size, void const *constants) override;
     void draw(uint32_t vertex_count, uint32_t instance_count, uint32_t first_vertex, uint32_t first_instance) override;
+    void bind_vertex_buffers(uint32_t first_binding, uint32_t binding_count, brx_pal_storage_asset_buffer const *const *vertex_buffers, uint64_t const *offsets) override;
+    void bind_index_buffer(brx_pal_storage_asset_buffer const *index_buffer, uint64_t offset, BRX_PAL_GRAPHICS_PIPELINE_INDEX_TYPE index_type) override;
+    void draw_indexed(uint32_t index_count, uint32_t instance_count, uint32_t first_index, int32_t vertex_offset, uint32_t first_instance) override;
+    void draw_mesh_tasks(uint32_t group_count_x, uint32_t group_count_y, uint32_t group_count_z) override;
+    void draw_mesh_tasks_indirect(brx_pal_storage_buffer const *argument_buffer, uint64_t argument_offset, uint32_t draw_count) override;
+    void draw_mesh_tasks_indirect_count(brx_pal_storage_buffer const *argument_buffer, uint64_t argument_offset, brx_pal_storage_buffer const *count_buffer, uint64_t count_offset, uint32_t max_draw_count) override;
     void end_render_pass() override;
+    void begin_rendering(uint32_t width, uint32_t height, uint32_t view_count, uint32_t color_attachment_count, BRX_PAL_RENDERING_COLOR_ATTACHMENT const *color_attachments, BRX_PAL_RENDERING_DEPTH_STENCIL_ATTACHMENT const *depth_stencil_attachment) override;
+    void end_rendering() override;
+    void aliasing_barrier(uint32_t color_attachment_image_count, brx_pal_color_attachment_image const *const *color_attachment_images, uint32_t depth_stencil_attachment_image_count, brx_pal_depth_stencil_attachment_image const *const *depth_stencil_attachment_images, uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *storage_buffers, uint32_t storage_image_count, brx_pal_storage_image const *const *storage_images) override;
     void compute_pass_load(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *storage_buffers, BRX_PAL_COMPUTE_PASS_STORAGE_BUFFER_LOAD_OPERATION const *storage_buffer_load_operations, uint32_t storage_image_count, brx_pal_storage_image const *const *storage_images, BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_LOAD_OPERATION const *storage_image_load_operations) override;
     void bind_compute_pipeline(brx_pal_compute_pipeline const *compute_pipeline) override;
     void bind_compute_descriptor_sets(brx_pal_pipeline_layout const *pipeline_layout, uint32_t descriptor_set_count, brx_pal_descriptor_set const *const *descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets) override;
+    void push_compute_constants(brx_pal_pipeline_layout const *pipeline_layout, uint32_t offset, uint32_t size, void const *constants) override;
     void dispatch(uint32_t group_count_x, uint32_t group_count_y, uint32_t group_count_z) override;
     void compute_pass_barrier(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *storage_buffers, uint32_t storage_image_count, brx_pal_storage_image const *const *storage_images) override;
     void compute_pass_store(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *storage_buffers, BRX_PAL_COMPUTE_PASS_STORAGE_BUFFER_STORE_OPERATION const *storage_buffer_store_operations, uint32_t storage_image_count, brx_pal_storage_image const *const *storage_images, BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_STORE_OPERATION const *storage_image_store_operations) override;
+    void acquire(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *storage_buffers, uint32_t storage_image_count, brx_pal_storage_image const *const *storage_images) override;
+    void copy_buffer(brx_pal_storage_buffer const *dst_storage_buffer, uint64_t dst_offset, brx_pal_storage_buffer const *src_storage_buffer, uint64_t src_offset, uint32_t src_size) override;
+    void copy_image(brx_pal_storage_image const *dst_storage_image, brx_pal_storage_image const *src_storage_image, uint32_t width, uint32_t height) override;
+    void fill_buffer(brx_pal_storage_buffer const *dst_storage_buffer, uint64_t dst_offset, uint32_t dst_size, uint32_t data) override;
+    void clear_storage_image(brx_pal_storage_image const *storage_image, float const *color_clear_value) override;
     void build_intermediate_bottom_level_acceleration_structure(brx_pal_intermediate_bottom_level_acceleration_structure *intermediate_bottom_level_acceleration_structure, uint32_t bottom_level_acceleration_structure_geometry_count, BRX_PAL_BOTTOM_LEVEL_ACCELERATION_STRUCTURE_GEOMETRY const *bottom_level_acceleration_structure_geometries, brx_pal_scratch_buffer *scratch_buffer) override;
     void build_intermediate_bottom_level_acceleration_structure_store(uint32_t intermediate_bottom_level_acceleration_structure_count, brx_pal_intermediate_bottom_level_acceleration_structure const *const *intermediate_bottom_level_acceleration_structures) override;
     void update_intermediate_bottom_level_acceleration_structure(brx_pal_intermediate_bottom_level_acceleration_structure *intermediate_bottom_level_acceleration_structure, brx_pal_acceleration_structure_build_input_read_only_buffer const *const *bottom_level_acceleration_structure_geometry_vertex_position_buffers, brx_pal_scratch_buffer *scratch_buffer) override;
@@ -226,7 +369,15 @@ public:
     void build_top_level_acceleration_structure_store(brx_pal_top_level_acceleration_structure *top_level_acceleration_structure) override;
     void update_top_level_acceleration_structure(brx_pal_top_level_acceleration_structure *top_level_acceleration_structure, brx_pal_top_level_acceleration_structure_instance_upload_buffer *top_level_acceleration_structure_instance_upload_buffer, brx_pal_scratch_buffer *scratch_buffer) override;
     void update_top_level_acceleration_structure_store(brx_pal_top_level_acceleration_structure *top_level_acceleration_structure) override;
+    void build_top_level_acceleration_structure_from_device_instances(brx_pal_top_level_acceleration_structure *top_level_acceleration_structure, uint32_t top_level_acceleration_structure_instance_count, brx_pal_acceleration_structure_build_input_read_only_buffer const *top_level_acceleration_structure_device_instance_buffer, brx_pal_scratch_buffer *scratch_buffer) override;
+    void update_top_level_acceleration_structure_from_device_instances(brx_pal_top_level_acceleration_structure *top_level_acceleration_structure, brx_pal_acceleration_structure_build_input_read_only_buffer const *top_level_acceleration_structure_device_instance_buffer, brx_pal_scratch_buffer *scratch_buffer) override;
     void end() override;
+
+private:
+    void create_clear_unordered_access_view_descriptor_heaps(uint32_t descriptor_capacity);
+    uint32_t allocate_clear_unordered_access_view_descriptor();
+    void build_top_level_acceleration_structure(brx_pal_top_level_acceleration_structure *top_level_acceleration_structure, uint32_t top_level_acceleration_structure_instance_count, D3D12_GPU_VIRTUAL_ADDRESS top_level_acceleration_structure_instance_buffer_device_memory_range_base, brx_pal_scratch_buffer *scratch_buffer);
+    void update_top_level_acceleration_structure(brx_pal_top_level_acceleration_structure *top_level_acceleration_structure, D3D12_GPU_VIRTUAL_ADDRESS top_level_acceleration_structure_instance_buffer_device_memory_range_base, brx_pal_scratch_buffer *scratch_buffer);
 };
 
 class brx_pal_d3d12_upload_command_buffer final : public brx_pal_upload_command_buffer
@@ -253,10 +404,49 @@ public:
     void build_non_compacted_bottom_level_acceleration_structure(brx_pal_non_compacted_bottom_level_acceleration_structure *non_compacted_bottom_level_acceleration_structure, uint32_t bottom_level_acceleration_structure_geometry_count, BRX_PAL_BOTTOM_LEVEL_ACCELERATION_STRUCTURE_GEOMETRY const *bottom_level_acceleration_structure_geometries, brx_pal_scratch_buffer *scratch_buffer, brx_pal_compacted_bottom_level_acceleration_structure_size_query_pool *compacted_bottom_level_acceleration_structure_size_query_pool, uint32_t query_index) override;
     void build_non_compacted_bottom_level_acceleration_structure_pass_store(uint32_t acceleration_structure_build_input_read_only_buffer_count, brx_pal_acceleration_structure_build_input_read_only_buffer const *const *acceleration_structure_build_input_read_only_buffers) override;
     void compact_bottom_level_acceleration_structure(brx_pal_compacted_bottom_level_acceleration_structure *destination_compacted_bottom_level_acceleration_structure, brx_pal_non_compacted_bottom_level_acceleration_structure *source_non_compacted_bottom_level_acceleration_structure) override;
+    void write_serialized_bottom_level_acceleration_structure_size(brx_pal_compacted_bottom_level_acceleration_structure const *compacted_bottom_level_acceleration_structure, brx_pal_serialized_bottom_level_acceleration_structure_size_query_pool *serialized_bottom_level_acceleration_structure_size_query_pool, uint32_t query_index) override;
+    void serialize_compacted_bottom_level_acceleration_structure(brx_pal_serialized_bottom_level_acceleration_structure_buffer *destination_serialized_bottom_level_acceleration_structure_buffer, brx_pal_compacted_bottom_level_acceleration_structure const *source_compacted_bottom_level_acceleration_structure) override;
+    void deserialize_compacted_bottom_level_acceleration_structure(brx_pal_compacted_bottom_level_acceleration_structure *destination_compacted_bottom_level_acceleration_structure, brx_pal_serialized_bottom_level_acceleration_structure_buffer const *source_serialized_bottom_level_acceleration_structure_buffer) override;
     void release(uint32_t storage_asset_buffer_count, brx_pal_storage_asset_buffer const *const *storage_asset_buffers, uint32_t sampled_asset_image_subresource_count, BRX_PAL_SAMPLED_ASSET_IMAGE_SUBRESOURCE const *sampled_asset_image_subresources, uint32_t compacted_bottom_level_acceleration_structure_count, brx_pal_compacted_bottom_level_acceleration_structure const *const *compacted_bottom_level_acceleration_structures) override;
     void end() override;
 };
 
+class brx_pal_d3d12_compute_command_buffer final : public brx_pal_compute_command_buffer
+{
+    // the compute command list is executed by the compute queue
+    brx_pal_d3d12_graphics_command_buffer m_compute_command_buffer;
+
+    // the load barriers (from the resting state to the common state) are executed by the graphics queue
+    ID3D12CommandAllocator *m_graphics_queue_command_allocator;
+    ID3D12GraphicsCommandList4 *m_graphics_queue_command_list;
+
+    ID3D12Fence *m_graphics_queue_submit_fence;
+    ID3D12Fence *m_compute_queue_submit_fence;
+
+public:
+    brx_pal_d3d12_compute_command_buffer();
+    void init(ID3D12Device *device, bool uma, bool support_ray_tracing, brx_pal_d3d12_descriptor_allocator *descriptor_allocator);
+    void uninit();
+    ~brx_pal_d3d12_compute_command_buffer();
+    ID3D12CommandAllocator *get_command_allocator() const;
+    ID3D12GraphicsCommandList4 *get_command_list() const;
+    ID3D12CommandAllocator *get_graphics_queue_command_allocator() const;
+    ID3D12GraphicsCommandList4 *get_graphics_queue_command_list() const;
+    ID3D12Fence *get_graphics_queue_submit_fence() const;
+    ID3D12Fence *get_compute_queue_submit_fence() const;
+    void begin() override;
+    void begin_debug_utils_label(char const *label_name) override;
+    void end_debug_utils_label() override;
+    void compute_pass_load(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *storage_buffers, BRX_PAL_COMPUTE_PASS_STORAGE_BUFFER_LOAD_OPERATION const *storage_buffer_load_operations, uint32_t storage_image_count, brx_pal_storage_image const *const *storage_images, BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_LOAD_OPERATION const *storage_image_load_operations) override;
+    void bind_compute_pipeline(brx_pal_compute_pipeline const *compute_pipeline) override;
+    void bind_compute_descriptor_sets(brx_pal_pipeline_layout const *pipeline_layout, uint32_t descriptor_set_count, brx_pal_descriptor_set const *const *descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets) override;
+    void push_compute_constants(brx_pal_pipeline_layout const *pipeline_layout, uint32_t offset, uint32_t size, void const *constants) override;
+    void dispatch(uint32_t group_count_x, uint32_t group_count_y, uint32_t group_count_z) override;
+    void compute_pass_barrier(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *storage_buffers, uint32_t storage_image_count, brx_pal_storage_image const *const *storage_images) override;
+    void compute_pass_store(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *storage_buffers, BRX_PAL_COMPUTE_PASS_STORAGE_BUFFER_STORE_OPERATION const *storage_buffer_store_operations, uint32_t storage_image_count, brx_pal_storage_image const *const *storage_images, BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_STORE_OPERATION const *storage_image_store_operations) override;
+    void end() override;
+};
+
 class brx_pal_d3d12_fence : public brx_pal_fence
 {
     ID3D12Fence *m_fence;
@@ -278,25 +468,33 @@ struct brx_pal_d3d12_descriptor_layout
 class brx_pal_d3d12_descriptor_set_layout final : public brx_pal_descriptor_set_layout
 {
     mcrt_vector<brx_pal_d3d12_descriptor_layout> m_descriptor_layouts;
+    mcrt_vector<D3D12_STATIC_SAMPLER_DESC> m_static_samplers;
+    bool m_update_after_bind;
 
 public:
     brx_pal_d3d12_descriptor_set_layout();
     void init(uint32_t descriptor_set_binding_count, BRX_PAL_DESCRIPTOR_SET_LAYOUT_BINDING const *wrapped_descriptor_set_bindingst);
+    void init_bindless(uint32_t read_only_storage_buffer_descriptor_count, uint32_t sampled_image_descriptor_count, uint32_t sampler_descriptor_count);
     void uninit();
     uint32_t get_descriptor_layout_count() const;
     brx_pal_d3d12_descriptor_layout const *get_descriptor_layouts() const;
+    uint32_t get_static_sampler_count() const;
+    D3D12_STATIC_SAMPLER_DESC const *get_static_samplers() const;
+    bool is_update_after_bind() const;
 };
 
 class brx_pal_d3d12_pipeline_layout final : public brx_pal_pipeline_layout
 {
     ID3D12RootSignature *m_root_signature;
+    uint32_t m_root_constants_root_parameter_index;
 
 public:
     brx_pal_d3d12_pipeline_layout();
-    void init(ID3D12Device *device, decltype(D3D12SerializeRootSignature) *pfn_d3d12_serialize_root_signature, uint32_t descriptor_set_layout_count, brx_pal_descriptor_set_layout const *const *descriptor_set_layouts);
+    void init(ID3D12Device *device, decltype(D3D12SerializeRootSignature) *pfn_d3d12_serialize_root_signature, uint32_t descriptor_set_layout_count, brx_pal_descriptor_set_layout const *const *descriptor_set_layouts, uint32_t push_constant_size);
     void uninit();
     ~brx_pal_d3d12_pipeline_layout();
     ID3D12RootSignature *get_root_signature() const;
+    uint32_t get_root_constants_root_parameter_index() const;
 };
 
 struct brx_pal_d3d12_descriptor_binding
@@ -314,6 +512,7 @@ struct brx_pal_d3d12_descriptor_binding
 class brx_pal_d3d12_descriptor_set final : public brx_pal_descriptor_set
 {
     mcrt_vector<brx_pal_d3d12_descriptor_binding> m_descriptor_bindings;
+    bool m_update_after_bind;
 
 public:
     brx_pal_d3d12_descriptor_set();
@@ -325,6 +524,19 @@ public:
     brx_pal_d3d12_descriptor_binding const *get_descriptor_bindings() const;
 };
 
+class brx_pal_d3d12_descriptor_update_template final : public brx_pal_descriptor_update_template
+{
+    mcrt_vector<BRX_PAL_DESCRIPTOR_UPDATE_TEMPLATE_ENTRY> m_entries;
+    uint32_t m_descriptor_count;
+
+public:
+    brx_pal_d3d12_descriptor_update_template();
+    void init(uint32_t entry_count, BRX_PAL_DESCRIPTOR_UPDATE_TEMPLATE_ENTRY const *entries);
+    void uninit();
+    ~brx_pal_d3d12_descriptor_update_template();
+    void write_descriptor_sets(ID3D12Device *device, brx_pal_d3d12_descriptor_allocator *descriptor_allocator, uint32_t descriptor_set_count, brx_pal_descriptor_set *const *descriptor_sets, void const *const *src_descriptors, uint32_t const *src_dynamic_uniform_buffer_ranges) const;
+};
+
 class brx_pal_d3d12_render_pass final : public brx_pal_render_pass
 {
     mcrt_vector<BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT> m_color_attachment_formats;
@@ -334,6 +546,8 @@ class brx_pal_d3d12_render_pass final : public brx_pal_render_pass
     mcrt_vector<BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT> m_depth_stencil_attachment_format;
     bool m_depth_stencil_attachment_clear;
     bool m_depth_stencil_attachment_flush_for_sampled_image;
+    uint32_t m_sample_count;
+    uint32_t m_view_count;
 
 public:
     brx_pal_d3d12_render_pass(
@@ -343,7 +557,9 @@ public:
         mcrt_vector<uint32_t> &&color_attachment_flush_for_present_indices,
         mcrt_vector<BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT> &&depth_stencil_attachment_format,
         bool depth_stencil_attachment_clear,
-        bool depth_stencil_attachment_flush_for_sampled_image);
+        bool depth_stencil_attachment_flush_for_sampled_image,
+        uint32_t sample_count,
+        uint32_t view_count);
     uint32_t get_color_attachment_count() const;
     BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *get_color_attachment_formats() const;
     uint32_t get_color_attachments_clear_count() const;
@@ -355,22 +571,87 @@ public:
     BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *get_depth_stencil_attachment_format() const;
     bool get_depth_stencil_attachment_clear() const;
     bool get_depth_stencil_attachment_flush_for_sampled_image() const;
+    uint32_t get_sample_count() const;
+    uint32_t get_view_count() const;
 };
 
 class brx_pal_d3d12_graphics_pipeline final : public brx_pal_graphics_pipeline
 {
     D3D12_PRIMITIVE_TOPOLOGY m_primitive_topology;
     ID3D12PipelineState *m_pipeline_state;
+    mcrt_vector<uint32_t> m_vertex_binding_strides;
 
 public:
     brx_pal_d3d12_graphics_pipeline();
-    void init(ID3D12Device *device, brx_pal_render_pass const *render_pass, brx_pal_pipeline_layout const *pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation);
+    void init(ID3D12Device2 *device, brx_pal_render_pass const *render_pass, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t task_shader_module_code_size, void const *task_shader_module_code, size_t mesh_shader_module_code_size, void const *mesh_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation);
+    void init(ID3D12Device2 *device, uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t task_shader_module_code_size, void const *task_shader_module_code, size_t mesh_shader_module_code_size, void const *mesh_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation);
+    void init(ID3D12Device2 *device, brx_pal_pipeline_layout const *pipeline_layout, brx_pal_graphics_pipeline_pre_rasterization_shader_library const *pre_rasterization_shader_library, brx_pal_graphics_pipeline_fragment_shader_library const *fragment_shader_library, brx_pal_graphics_pipeline_fragment_output_interface_library const *fragment_output_interface_library);
     void uninit();
     ~brx_pal_d3d12_graphics_pipeline();
     D3D12_PRIMITIVE_TOPOLOGY get_primitive_topology() const;
+    uint32_t get_vertex_binding_count() const;
+    uint32_t const *get_vertex_binding_strides() const;
     ID3D12PipelineState *get_pipeline() const;
 };
 
+// the pipeline state object can NOT be linked in D3D12, and the libraries only record the states which are used by the "create_linked_graphics_pipeline"
+class brx_pal_d3d12_graphics_pipeline_pre_rasterization_shader_library final : public brx_pal_graphics_pipeline_pre_rasterization_shader_library
+{
+    mcrt_vector<uint8_t> m_vertex_shader_module_code;
+    uint32_t m_view_count;
+    bool m_enable_back_face_cull;
+    bool m_front_ccw;
+
+public:
+    brx_pal_d3d12_graphics_pipeline_pre_rasterization_shader_library();
+    void init(uint32_t view_count, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, bool enable_back_face_cull, bool front_ccw);
+    void uninit();
+    ~brx_pal_d3d12_graphics_pipeline_pre_rasterization_shader_library();
+    size_t get_vertex_shader_module_code_size() const;
+    void const *get_vertex_shader_module_code() const;
+    uint32_t get_view_count() const;
+    bool get_enable_back_face_cull() const;
+    bool get_front_ccw() const;
+};
+
+class brx_pal_d3d12_graphics_pipeline_fragment_shader_library final : public brx_pal_graphics_pipeline_fragment_shader_library
+{
+    mcrt_vector<uint8_t> m_fragment_shader_module_code;
+    uint32_t m_view_count;
+    BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION m_depth_compare_operation;
+
+public:
+    brx_pal_d3d12_graphics_pipeline_fragment_shader_library();
+    void init(uint32_t view_count, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation);
+    void uninit();
+    ~brx_pal_d3d12_graphics_pipeline_fragment_shader_library();
+    size_t get_fragment_shader_module_code_size() const;
+    void const *get_fragment_shader_module_code() const;
+    uint32_t get_view_count() const;
+    BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION get_depth_compare_operation() const;
+};
+
+class brx_pal_d3d12_graphics_pipeline_fragment_output_interface_library final : public brx_pal_graphics_pipeline_fragment_output_interface_library
+{
+    mcrt_vector<BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT> m_color_attachment_formats;
+    mcrt_vector<BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT> m_depth_stencil_attachment_format;
+    uint32_t m_sample_count;
+    uint32_t m_view_count;
+    BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION m_blend_operation;
+
+public:
+    brx_pal_d3d12_graphics_pipeline_fragment_output_interface_library();
+    void init(uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation);
+    void uninit();
+    ~brx_pal_d3d12_graphics_pipeline_fragment_output_interface_library();
+    uint32_t get_color_attachment_count() const;
+    BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *get_color_attachment_formats() const;
+    BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *get_depth_stencil_attachment_format() const;
+    uint32_t get_sample_count() const;
+    uint32_t get_view_count() const;
+    BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION get_blend_operation() const;
+};
+
 class brx_pal_d3d12_compute_pipeline final : public brx_pal_compute_pipeline
 {
     ID3D12PipelineState *m_pipeline_state;
@@ -387,18 +668,37 @@ class brx_pal_d3d12_frame_buffer final : public brx_pal_frame_buffer
 {
     mcrt_vector<ID3D12Resource *> m_render_target_resources;
     mcrt_vector<D3D12_CPU_DESCRIPTOR_HANDLE> m_render_target_view_descriptors;
+    mcrt_vector<ID3D12Resource *> m_resolve_resources;
     ID3D12Resource *m_depth_stencil_resource;
     mcrt_vector<D3D12_CPU_DESCRIPTOR_HANDLE> m_depth_stencil_view_descriptor;
 
 public:
-    brx_pal_d3d12_frame_buffer(mcrt_vector<ID3D12Resource *> &&render_target_resources, mcrt_vector<D3D12_CPU_DESCRIPTOR_HANDLE> &&render_target_view_descriptors, ID3D12Resource *depth_stencil_resource, mcrt_vector<D3D12_CPU_DESCRIPTOR_HANDLE> &&depth_stencil_view_descriptor);
+    brx_pal_d3d12_frame_buffer(mcrt_vector<ID3D12Resource *> &&render_target_resources, mcrt_vector<D3D12_CPU_DESCRIPTOR_HANDLE> &&render_target_view_descriptors, mcrt_vector<ID3D12Resource *> &&resolve_resources, ID3D12Resource *depth_stencil_resource, mcrt_vector<D3D12_CPU_DESCRIPTOR_HANDLE> &&depth_stencil_view_descriptor);
     uint32_t get_num_render_targets() const;
     ID3D12Resource *const *get_render_target_view_resources() const;
     D3D12_CPU_DESCRIPTOR_HANDLE const *get_render_target_view_descriptors() const;
+    ID3D12Resource *const *get_resolve_resources() const;
     ID3D12Resource *get_depth_stencil_resource() const;
     D3D12_CPU_DESCRIPTOR_HANDLE const *get_depth_stencil_view_descriptor() const;
 };
 
+// the memory heap is sub-allocated from the memory pool of the same resource category, and the placed resources are bound to the memory heap by the "CreateAliasingResource"
+class brx_pal_d3d12_memory_heap final : public brx_pal_memory_heap
+{
+    D3D12MA::Allocation *m_allocation;
+    BRX_PAL_MEMORY_HEAP_TYPE m_type;
+    uint64_t m_size;
+
+public:
+    brx_pal_d3d12_memory_heap();
+    void init(D3D12MA::Allocator *memory_allocator, D3D12MA::Pool *memory_pool, BRX_PAL_MEMORY_HEAP_TYPE memory_heap_type, uint32_t size);
+    void uninit();
+    ~brx_pal_d3d12_memory_heap();
+    D3D12MA::Allocation *get_allocation() const;
+    BRX_PAL_MEMORY_HEAP_TYPE get_type() const;
+    uint64_t get_size() const;
+};
+
 class brx_pal_d3d12_uniform_upload_buffer final : public brx_pal_uniform_upload_buffer
 {
     ID3D12Resource *m_resource = NULL;
@@ -458,7 +758,8 @@ class brx_pal_d3d12_storage_intermediate_buffer final : public brx_pal_storage_i
 
 public:
     brx_pal_d3d12_storage_intermediate_buffer();
-    void init(D3D12MA::Allocator *memory_allocator, D3D12MA::Pool *storage_buffer_memory_pool, uint32_t size);
+    void init(D3D12MA::Allocator *memory_allocator, D3D12MA::Pool *storage_buffer_memory_pool, D3D12MA::Allocation *memory_heap_allocation, uint64_t memory_heap_offset, uint32_t size);
+    static void get_memory_requirements(ID3D12Device *device, uint32_t size, D3D12_RESOURCE_ALLOCATION_INFO *out_resource_allocation_info);
     void uninit();
     ~brx_pal_d3d12_storage_intermediate_buffer();
 
@@ -510,6 +811,7 @@ class brx_pal_d3d12_depth_stencil_attachment_image : public brx_pal_depth_stenci
 public:
     virtual ID3D12Resource *get_resource() const = 0;
     virtual D3D12_CPU_DESCRIPTOR_HANDLE get_depth_stencil_view_descriptor() const = 0;
+    virtual D3D12_CLEAR_FLAGS get_clear_flags() const = 0;
 };
 
 class brx_pal_d3d12_storage_image : public brx_pal_storage_image
@@ -529,7 +831,8 @@ class brx_pal_d3d12_color_attachment_intermediate_image final : public brx_pal_d
 
 public:
     brx_pal_d3d12_color_attachment_intermediate_image();
-    void init(ID3D12Device *device, D3D12MA::Allocator *memory_allocator, D3D12MA::Pool *color_attachment_intermediate_image_memory_pool, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT color_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image);
+    void init(ID3D12Device *device, D3D12MA::Allocator *memory_allocator, D3D12MA::Pool *color_attachment_intermediate_image_memory_pool, D3D12MA::Allocation *memory_heap_allocation, uint64_t memory_heap_offset, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT color_attachment_image_format, uint32_t width, uint32_t height, uint32_t layer_count, uint32_t sample_count, bool allow_sampled_image);
+    static void get_memory_requirements(ID3D12Device *device, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT color_attachment_image_format, uint32_t width, uint32_t height, D3D12_RESOURCE_ALLOCATION_INFO *out_resource_allocation_info);
     void uninit();
     ~brx_pal_d3d12_color_attachment_intermediate_image();
 
@@ -546,17 +849,20 @@ class brx_pal_d3d12_depth_stencil_attachment_intermediate_image final : public b
     D3D12MA::Allocation *m_allocation;
     ID3D12DescriptorHeap *m_depth_stencil_view_descriptor_heap;
     D3D12_CPU_DESCRIPTOR_HANDLE m_depth_stencil_view_descriptor;
+    D3D12_CLEAR_FLAGS m_clear_flags;
     D3D12_SHADER_RESOURCE_VIEW_DESC m_shader_resource_view_desc;
 
 public:
     brx_pal_d3d12_depth_stencil_attachment_intermediate_image();
-    void init(ID3D12Device *device, D3D12MA::Allocator *memory_allocator, D3D12MA::Pool *depth_stencil_attachment_intermediate_image_memory_pool, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT wrapped_depth_stencil_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image);
+    void init(ID3D12Device *device, D3D12MA::Allocator *memory_allocator, D3D12MA::Pool *depth_stencil_attachment_intermediate_image_memory_pool, D3D12MA::Allocation *memory_heap_allocation, uint64_t memory_heap_offset, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT wrapped_depth_stencil_attachment_image_format, uint32_t width, uint32_t height, uint32_t layer_count, uint32_t sample_count, bool allow_sampled_image);
+    static void get_memory_requirements(ID3D12Device *device, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT depth_stencil_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image, D3D12_RESOURCE_ALLOCATION_INFO *out_resource_allocation_info);
     void uninit();
     ~brx_pal_d3d12_depth_stencil_attachment_intermediate_image();
 
 private:
     ID3D12Resource *get_resource() const override;
     D3D12_CPU_DESCRIPTOR_HANDLE get_depth_stencil_view_descriptor() const override;
+    D3D12_CLEAR_FLAGS get_clear_flags() const override;
     D3D12_SHADER_RESOURCE_VIEW_DESC const *get_shader_resource_view_desc() const override;
     brx_pal_sampled_image const *get_sampled_image() const override;
 };
@@ -570,7 +876,8 @@ class brx_pal_d3d12_storage_intermediate_image final : public brx_pal_d3d12_stor
 
 public:
     brx_pal_d3d12_storage_intermediate_image();
-    void init(D3D12MA::Allocator *memory_allocator, D3D12MA::Pool *storage_intermediate_image_memory_pool, DXGI_FORMAT storage_image_format, uint32_t width, uint32_t height, bool allow_sampled_image);
+    void init(D3D12MA::Allocator *memory_allocator, D3D12MA::Pool *storage_intermediate_image_memory_pool, D3D12MA::Allocation *memory_heap_allocation, uint64_t memory_heap_offset, DXGI_FORMAT storage_image_format, uint32_t width, uint32_t height, bool allow_sampled_image);
+    static void get_memory_requirements(ID3D12Device *device, DXGI_FORMAT storage_image_format, uint32_t width, uint32_t height, D3D12_RESOURCE_ALLOCATION_INFO *out_resource_allocation_info);
     void uninit();
     ~brx_pal_d3d12_storage_intermediate_image();
 
@@ -663,6 +970,7 @@ class brx_pal_d3d12_bottom_level_acceleration_structure : public brx_pal_bottom_
 {
 public:
     virtual ID3D12Resource *get_resource() const = 0;
+    uint64_t get_device_memory_range_base() const override;
 };
 
 class brx_pal_d3d12_intermediate_bottom_level_acceleration_structure final : public brx_pal_intermediate_bottom_level_acceleration_structure, brx_pal_d3d12_bottom_level_acceleration_structure
@@ -728,6 +1036,36 @@ private:
     brx_pal_bottom_level_acceleration_structure const *get_bottom_level_acceleration_structure() const override;
 };
 
+class brx_pal_d3d12_serialized_bottom_level_acceleration_structure_size_query_pool final : public brx_pal_serialized_bottom_level_acceleration_structure_size_query_pool
+{
+    ID3D12Resource *m_resource;
+    D3D12MA::Allocation *m_allocation;
+    D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_SERIALIZATION_DESC volatile *m_host_memory_range_base;
+
+public:
+    brx_pal_d3d12_serialized_bottom_level_acceleration_structure_size_query_pool();
+    void init(D3D12MA::Allocator *memory_allocator, D3D12MA::Pool *compacted_bottom_level_acceleration_structure_size_query_buffer_memory_pool, uint32_t query_count);
+    void uninit();
+    ~brx_pal_d3d12_serialized_bottom_level_acceleration_structure_size_query_pool();
+    ID3D12Resource *get_resource() const;
+    D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_SERIALIZATION_DESC volatile *get_host_memory_range_base() const;
+};
+
+class brx_pal_d3d12_serialized_bottom_level_acceleration_structure_buffer final : public brx_pal_serialized_bottom_level_acceleration_structure_buffer
+{
+    ID3D12Resource *m_resource;
+    D3D12MA::Allocation *m_allocation;
+    void *m_host_memory_range_base;
+
+public:
+    brx_pal_d3d12_serialized_bottom_level_acceleration_structure_buffer();
+    void init(D3D12MA::Allocator *memory_allocator, D3D12MA::Pool *serialized_bottom_level_acceleration_structure_buffer_memory_pool, uint32_t size);
+    void uninit();
+    ~brx_pal_d3d12_serialized_bottom_level_acceleration_structure_buffer();
+    ID3D12Resource *get_resource() const;
+    void *get_host_memory_range_base() const override;
+};
+
 class brx_pal_d3d12_top_level_acceleration_structure_instance_upload_buffer final : public brx_pal_top_level_acceleration_structure_instance_upload_buffer
 {
     ID3D12Resource *m_resource;
@@ -740,6 +1078,7 @@ public:
     void uninit();
     ~brx_pal_d3d12_top_level_acceleration_structure_instance_upload_buffer();
     void write_instance(uint32_t instance_index, BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE const *bottom_top_acceleration_structure_instance) override;
+    void write_instances(uint32_t first_instance_index, uint32_t instance_count, BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE const *bottom_top_acceleration_structure_instances) override;
     ID3D12Resource *get_resource() const;
 };
 
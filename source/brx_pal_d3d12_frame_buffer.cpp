@@ -18,9 +18,10 @@
 #include "brx_pal_d3d12_device.h"
 #include <assert.h>
 
-brx_pal_d3d12_frame_buffer::brx_pal_d3d12_frame_buffer(mcrt_vector<ID3D12Resource *> &&render_target_resources, mcrt_vector<D3D12_CPU_DESCRIPTOR_HANDLE> &&render_target_view_descriptors, ID3D12Resource *depth_stencil_resource, mcrt_vector<D3D12_CPU_DESCRIPTOR_HANDLE> &&depth_stencil_view_descriptor) : m_render_target_resources(std::move(render_target_resources)), m_render_target_view_descriptors(std::move(render_target_view_descriptors)), m_depth_stencil_resource(depth_stencil_resource), m_depth_stencil_view_descriptor(std::move(depth_stencil_view_descriptor))
+brx_pal_d3d12_frame_buffer::brx_pal_d3d12_frame_buffer(mcrt_vector<ID3D12Resource *> &&render_target_resources, mcrt_vector<D3D12_CPU_DESCRIPTOR_HANDLE> &&render_target_view_descriptors, mcrt_vector<ID3D12Resource *> &&resolve_resources, ID3D12Resource *depth_stencil_resource, mcrt_vector<D3D12_CPU_DESCRIPTOR_HANDLE> &&depth_stencil_view_descriptor) : m_render_target_resources(std::move(render_target_resources)), m_render_target_view_descriptors(std::move(render_target_view_descriptors)), m_resolve_resources(std::move(resolve_resources)), m_depth_stencil_resource(depth_stencil_resource), m_depth_stencil_view_descriptor(std::move(depth_stencil_view_descriptor))
 {
 	assert(this->m_render_target_resources.size() == this->m_render_target_view_descriptors.size());
+	assert(0U == this->m_resolve_resources.size() || this->m_render_target_resources.size() == this->m_resolve_resources.size());
 	assert(((NULL != this->m_depth_stencil_resource) ? 1U : 0U) == this->m_depth_stencil_view_descriptor.size());
 }
 
@@ -64,6 +65,22 @@ D3D12_CPU_DESCRIPTOR_HANDLE const *brx_pal_d3d12_frame_buffer::get_render_target
 	return render_target_view_descriptor;
 }
 
+ID3D12Resource *const *brx_pal_d3d12_frame_buffer::get_resolve_resources() const
+{
+	ID3D12Resource *const *resolve_resources;
+
+	if (this->m_resolve_resources.size() > 0U)
+	{
+		resolve_resources = &this->m_resolve_resources[0];
+	}
+	else
+	{
+		resolve_resources = NULL;
+	}
+
+	return resolve_resources;
+}
+
 ID3D12Resource *brx_pal_d3d12_frame_buffer::get_depth_stencil_resource() const
 {
 	return this->m_depth_stencil_resource;
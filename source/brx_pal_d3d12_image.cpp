@@ -18,38 +18,25 @@
 #include "brx_pal_d3d12_device.h"
 #include <assert.h>
 
+static inline DXGI_FORMAT _internal_unwrap_color_attachment_image_format(BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT wrapped_color_attachment_image_format);
+
+static inline void _internal_unwrap_depth_stencil_attachment_image_format(BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT wrapped_depth_stencil_attachment_image_format, DXGI_FORMAT *out_unwrapped_resource_format, DXGI_FORMAT *out_unwrapped_depth_stencil_view_format, DXGI_FORMAT *out_unwrapped_shader_resource_view_format, D3D12_CLEAR_FLAGS *out_clear_flags);
+
 brx_pal_d3d12_color_attachment_intermediate_image::brx_pal_d3d12_color_attachment_intermediate_image() : m_resource(NULL), m_allocation(NULL), m_render_target_view_descriptor_heap(NULL), m_render_target_view_descriptor{0U}
 {
 }
 
-void brx_pal_d3d12_color_attachment_intermediate_image::init(ID3D12Device *device, D3D12MA::Allocator *memory_allocator, D3D12MA::Pool *color_attachment_intermediate_image_memory_pool, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT wrapped_color_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image)
+void brx_pal_d3d12_color_attachment_intermediate_image::init(ID3D12Device *device, D3D12MA::Allocator *memory_allocator, D3D12MA::Pool *color_attachment_intermediate_image_memory_pool, D3D12MA::Allocation *memory_heap_allocation, uint64_t memory_heap_offset, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT wrapped_color_attachment_image_format, uint32_t width, uint32_t height, uint32_t layer_count, uint32_t sample_count, bool allow_sampled_image)
 {
-	DXGI_FORMAT unwrapped_format;
-	switch (wrapped_color_attachment_image_format)
-	{
-	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_B8G8R8A8_UNORM:
-		unwrapped_format = DXGI_FORMAT_B8G8R8A8_UNORM;
-		break;
-	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_R8G8B8A8_UNORM:
-		unwrapped_format = DXGI_FORMAT_R8G8B8A8_UNORM;
-		break;
-	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_A2B10G10R10_UNORM_PACK32:
-		assert(false);
-		unwrapped_format = static_cast<DXGI_FORMAT>(-1);
-		break;
-	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_A2R10G10B10_UNORM_PACK32:
-		unwrapped_format = DXGI_FORMAT_R10G10B10A2_UNORM;
-		break;
-	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_R32G32_UINT:
-		unwrapped_format = DXGI_FORMAT_R32G32_UINT;
-		break;
-	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_R32G32B32A32_UINT:
-		unwrapped_format = DXGI_FORMAT_R32G32B32A32_UINT;
-		break;
-	default:
-		assert(false);
-		unwrapped_format = static_cast<DXGI_FORMAT>(-1);
-	}
+	// the multisample image is only used as the transient attachment which is resolved at the end of the render pass
+	assert((1U == sample_count) || (!allow_sampled_image));
+	// the layered image (used by the multiview) is always single sample
+	assert((1U == sample_count) || (1U == layer_count));
+
+	// the placed image is always single sample and non-layered (the same as the "create_color_attachment_image")
+	assert((NULL == memory_heap_allocation) || ((1U == sample_count) && (1U == layer_count)));
+
+	DXGI_FORMAT const unwrapped_format = _internal_unwrap_color_attachment_image_format(wrapped_color_attachment_image_format);
 
 	D3D12MA::ALLOCATION_DESC allocation_desc = {
 		D3D12MA::ALLOCATION_FLAG_NONE,
@@ -59,13 +46,13 @@ void brx_pal_d3d12_color_attachment_intermediate_image::init(ID3D12Device *devic
 		NULL};
 	D3D12_RESOURCE_DESC const resource_desc = {
 		D3D12_RESOURCE_DIMENSION_TEXTURE2D,
-		D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT,
+		(1U == sample_count) ? D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT : D3D12_DEFAULT_MSAA_RESOURCE_PLACEMENT_ALIGNMENT,
 		width,
 		height,
-		1U,
+		layer_count,
 		1U,
 		unwrapped_format,
-		{1U, 0U},
+		{sample_count, 0U},
 		D3D12_TEXTURE_LAYOUT_UNKNOWN,
 		D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET};
 	D3D12_CLEAR_VALUE const optimized_clear_value = {
@@ -77,7 +64,17 @@ void brx_pal_d3d12_color_attachment_intermediate_image::init(ID3D12Device *devic
 			0.0F}};
 	assert(NULL == this->m_resource);
 	assert(NULL == this->m_allocation);
-	HRESULT hr_create_resource = memory_allocator->CreateResource(&allocation_desc, &resource_desc, (!allow_sampled_image) ? D3D12_RESOURCE_STATE_UNORDERED_ACCESS : (D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE), &optimized_clear_value, &this->m_allocation, IID_PPV_ARGS(&this->m_resource));
+	// the transient attachment always stays in the render target state (the same as the "DONT_CARE" store operation)
+	HRESULT hr_create_resource;
+	if (NULL == memory_heap_allocation)
+	{
+		hr_create_resource = memory_allocator->CreateResource(&allocation_desc, &resource_desc, (!allow_sampled_image) ? D3D12_RESOURCE_STATE_RENDER_TARGET : (D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE), &optimized_clear_value, &this->m_allocation, IID_PPV_ARGS(&this->m_resource));
+	}
+	else
+	{
+		// only the resource is created and the allocation is owned by the memory heap
+		hr_create_resource = memory_allocator->CreateAliasingResource(memory_heap_allocation, memory_heap_offset, &resource_desc, (!allow_sampled_image) ? D3D12_RESOURCE_STATE_RENDER_TARGET : (D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE), &optimized_clear_value, IID_PPV_ARGS(&this->m_resource));
+	}
 	assert(SUCCEEDED(hr_create_resource));
 
 	D3D12_DESCRIPTOR_HEAP_DESC const descriptor_heap_desc = {
@@ -94,15 +91,40 @@ void brx_pal_d3d12_color_attachment_intermediate_image::init(ID3D12Device *devic
 	assert(0U == this->m_render_target_view_descriptor.ptr);
 	this->m_render_target_view_descriptor = D3D12_CPU_DESCRIPTOR_HANDLE{new_dsv_descriptor_heap_cpu_descriptor_handle_start.ptr + new_dsv_descriptor_heap_descriptor_increment_size * 0U};
 
-	D3D12_RENDER_TARGET_VIEW_DESC const depth_stencil_view_desc{
-		.Format = unwrapped_format,
-		.ViewDimension = D3D12_RTV_DIMENSION_TEXTURE2D,
-		.Texture2D = {
-			0U,
-			0U}};
-	device->CreateRenderTargetView(this->m_resource, &depth_stencil_view_desc, this->m_render_target_view_descriptor);
+	if ((1U == sample_count) && (1U == layer_count))
+	{
+		D3D12_RENDER_TARGET_VIEW_DESC const render_target_view_desc{
+			.Format = unwrapped_format,
+			.ViewDimension = D3D12_RTV_DIMENSION_TEXTURE2D,
+			.Texture2D = {
+				0U,
+				0U}};
+		device->CreateRenderTargetView(this->m_resource, &render_target_view_desc, this->m_render_target_view_descriptor);
+	}
+	else if (1U == sample_count)
+	{
+		// the view instance selects the array slice by the "RenderTargetArrayIndex" of the view instance location
+		D3D12_RENDER_TARGET_VIEW_DESC const render_target_view_desc{
+			.Format = unwrapped_format,
+			.ViewDimension = D3D12_RTV_DIMENSION_TEXTURE2DARRAY,
+			.Texture2DArray = {
+				0U,
+				0U,
+				layer_count,
+				0U}};
+		device->CreateRenderTargetView(this->m_resource, &render_target_view_desc, this->m_render_target_view_descriptor);
+	}
+	else
+	{
+		D3D12_RENDER_TARGET_VIEW_DESC const render_target_view_desc{
+			.Format = unwrapped_format,
+			.ViewDimension = D3D12_RTV_DIMENSION_TEXTURE2DMS,
+			.Texture2DMS = {
+				0U}};
+		device->CreateRenderTargetView(this->m_resource, &render_target_view_desc, this->m_render_target_view_descriptor);
+	}
 
-	if (allow_sampled_image)
+	if (allow_sampled_image && (1U == layer_count))
 	{
 		this->m_shader_resource_view_desc = D3D12_SHADER_RESOURCE_VIEW_DESC{
 			.Format = unwrapped_format,
@@ -114,6 +136,20 @@ void brx_pal_d3d12_color_attachment_intermediate_image::init(ID3D12Device *devic
 				0U,
 				0.0F}};
 	}
+	else if (allow_sampled_image)
+	{
+		this->m_shader_resource_view_desc = D3D12_SHADER_RESOURCE_VIEW_DESC{
+			.Format = unwrapped_format,
+			.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2DARRAY,
+			.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING,
+			.Texture2DArray = {
+				0U,
+				1U,
+				0U,
+				layer_count,
+				0U,
+				0.0F}};
+	}
 	else
 	{
 		this->m_shader_resource_view_desc.ViewDimension = D3D12_SRV_DIMENSION_UNKNOWN;
@@ -130,9 +166,12 @@ void brx_pal_d3d12_color_attachment_intermediate_image::uninit()
 	this->m_resource->Release();
 	this->m_resource = NULL;
 
-	assert(NULL != this->m_allocation);
-	this->m_allocation->Release();
-	this->m_allocation = NULL;
+	// the allocation is NULL if the image is placed in the memory heap
+	if (NULL != this->m_allocation)
+	{
+		this->m_allocation->Release();
+		this->m_allocation = NULL;
+	}
 }
 
 brx_pal_d3d12_color_attachment_intermediate_image::~brx_pal_d3d12_color_attachment_intermediate_image()
@@ -159,42 +198,32 @@ D3D12_SHADER_RESOURCE_VIEW_DESC const *brx_pal_d3d12_color_attachment_intermedia
 
 brx_pal_sampled_image const *brx_pal_d3d12_color_attachment_intermediate_image::get_sampled_image() const
 {
-	assert(D3D12_SRV_DIMENSION_TEXTURE2D == this->m_shader_resource_view_desc.ViewDimension);
+	assert((D3D12_SRV_DIMENSION_TEXTURE2D == this->m_shader_resource_view_desc.ViewDimension) || (D3D12_SRV_DIMENSION_TEXTURE2DARRAY == this->m_shader_resource_view_desc.ViewDimension));
 	return static_cast<brx_pal_d3d12_sampled_image const *>(this);
 }
 
-brx_pal_d3d12_depth_stencil_attachment_intermediate_image::brx_pal_d3d12_depth_stencil_attachment_intermediate_image() : m_resource(NULL), m_allocation(NULL), m_depth_stencil_view_descriptor_heap(NULL), m_depth_stencil_view_descriptor{0U}
+brx_pal_d3d12_depth_stencil_attachment_intermediate_image::brx_pal_d3d12_depth_stencil_attachment_intermediate_image() : m_resource(NULL), m_allocation(NULL), m_depth_stencil_view_descriptor_heap(NULL), m_depth_stencil_view_descriptor{0U}, m_clear_flags(static_cast<D3D12_CLEAR_FLAGS>(0))
 {
 }
 
-void brx_pal_d3d12_depth_stencil_attachment_intermediate_image::init(ID3D12Device *device, D3D12MA::Allocator *memory_allocator, D3D12MA::Pool *depth_stencil_attachment_intermediate_image_memory_pool, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT wrapped_depth_stencil_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image)
+void brx_pal_d3d12_depth_stencil_attachment_intermediate_image::init(ID3D12Device *device, D3D12MA::Allocator *memory_allocator, D3D12MA::Pool *depth_stencil_attachment_intermediate_image_memory_pool, D3D12MA::Allocation *memory_heap_allocation, uint64_t memory_heap_offset, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT wrapped_depth_stencil_attachment_image_format, uint32_t width, uint32_t height, uint32_t layer_count, uint32_t sample_count, bool allow_sampled_image)
 {
+	// the multisample image is only used as the transient attachment
+	assert((1U == sample_count) || (!allow_sampled_image));
+	// the layered image (used by the multiview) is always single sample
+	assert((1U == sample_count) || (1U == layer_count));
+
+	// the placed image is always single sample and non-layered (the same as the "create_depth_stencil_attachment_image")
+	assert((NULL == memory_heap_allocation) || ((1U == sample_count) && (1U == layer_count)));
+
 	DXGI_FORMAT unwrapped_resource_format;
 	DXGI_FORMAT unwrapped_depth_stencil_view_format;
 	DXGI_FORMAT unwrapped_shader_resource_view_format;
-	switch (wrapped_depth_stencil_attachment_image_format)
-	{
-	case BRX_PAL_DEPTH_STENCIL_ATTACHMENT_FORMAT_D32_SFLOAT:
-		unwrapped_resource_format = DXGI_FORMAT_R32_TYPELESS;
-		unwrapped_depth_stencil_view_format = DXGI_FORMAT_D32_FLOAT;
-		unwrapped_shader_resource_view_format = DXGI_FORMAT_R32_FLOAT;
-		break;
-	case BRX_PAL_DEPTH_STENCIL_ATTACHMENT_FORMAT_D32_SFLOAT_S8_UINT:
-		unwrapped_resource_format = DXGI_FORMAT_X32_TYPELESS_G8X24_UINT;
-		unwrapped_depth_stencil_view_format = DXGI_FORMAT_D32_FLOAT_S8X24_UINT;
-		unwrapped_shader_resource_view_format = DXGI_FORMAT_R32_FLOAT_X8X24_TYPELESS;
-		break;
-	case BRX_PAL_DEPTH_STENCIL_ATTACHMENT_FORMAT_D24_UNORM_S8_UINT:
-		unwrapped_resource_format = DXGI_FORMAT_X24_TYPELESS_G8_UINT;
-		unwrapped_depth_stencil_view_format = DXGI_FORMAT_D24_UNORM_S8_UINT;
-		unwrapped_shader_resource_view_format = DXGI_FORMAT_R24_UNORM_X8_TYPELESS;
-		break;
-	default:
-		assert(false);
-		unwrapped_resource_format = static_cast<DXGI_FORMAT>(-1);
-		unwrapped_depth_stencil_view_format = static_cast<DXGI_FORMAT>(-1);
-		unwrapped_shader_resource_view_format = static_cast<DXGI_FORMAT>(-1);
-	}
+	D3D12_CLEAR_FLAGS clear_flags;
+	_internal_unwrap_depth_stencil_attachment_image_format(wrapped_depth_stencil_attachment_image_format, &unwrapped_resource_format, &unwrapped_depth_stencil_view_format, &unwrapped_shader_resource_view_format, &clear_flags);
+
+	assert(0 == this->m_clear_flags);
+	this->m_clear_flags = clear_flags;
 
 	D3D12MA::ALLOCATION_DESC allocation_desc = {
 		D3D12MA::ALLOCATION_FLAG_NONE,
@@ -204,13 +233,13 @@ void brx_pal_d3d12_depth_stencil_attachment_intermediate_image::init(ID3D12Devic
 		NULL};
 	D3D12_RESOURCE_DESC const resource_desc = {
 		D3D12_RESOURCE_DIMENSION_TEXTURE2D,
-		D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT,
+		(1U == sample_count) ? D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT : D3D12_DEFAULT_MSAA_RESOURCE_PLACEMENT_ALIGNMENT,
 		width,
 		height,
-		1U,
+		layer_count,
 		1U,
 		unwrapped_resource_format,
-		{1U, 0U},
+		{sample_count, 0U},
 		D3D12_TEXTURE_LAYOUT_UNKNOWN,
 		(!allow_sampled_image) ? (D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL | D3D12_RESOURCE_FLAG_DENY_SHADER_RESOURCE) : D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL};
 	D3D12_CLEAR_VALUE const optimized_clear_value = {
@@ -220,7 +249,17 @@ void brx_pal_d3d12_depth_stencil_attachment_intermediate_image::init(ID3D12Devic
 			0U}};
 	assert(NULL == this->m_resource);
 	assert(NULL == this->m_allocation);
-	HRESULT hr_create_resource = memory_allocator->CreateResource(&allocation_desc, &resource_desc, (!allow_sampled_image) ? D3D12_RESOURCE_STATE_UNORDERED_ACCESS : (D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE), &optimized_clear_value, &this->m_allocation, IID_PPV_ARGS(&this->m_resource));
+	// the transient attachment always stays in the depth write state (the same as the "DONT_CARE" store operation)
+	HRESULT hr_create_resource;
+	if (NULL == memory_heap_allocation)
+	{
+		hr_create_resource = memory_allocator->CreateResource(&allocation_desc, &resource_desc, (!allow_sampled_image) ? D3D12_RESOURCE_STATE_DEPTH_WRITE : (D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE), &optimized_clear_value, &this->m_allocation, IID_PPV_ARGS(&this->m_resource));
+	}
+	else
+	{
+		// only the resource is created and the allocation is owned by the memory heap
+		hr_create_resource = memory_allocator->CreateAliasingResource(memory_heap_allocation, memory_heap_offset, &resource_desc, (!allow_sampled_image) ? D3D12_RESOURCE_STATE_DEPTH_WRITE : (D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE), &optimized_clear_value, IID_PPV_ARGS(&this->m_resource));
+	}
 	assert(SUCCEEDED(hr_create_resource));
 
 	D3D12_DESCRIPTOR_HEAP_DESC const descriptor_heap_desc = {
@@ -237,15 +276,40 @@ void brx_pal_d3d12_depth_stencil_attachment_intermediate_image::init(ID3D12Devic
 	assert(0U == this->m_depth_stencil_view_descriptor.ptr);
 	this->m_depth_stencil_view_descriptor = D3D12_CPU_DESCRIPTOR_HANDLE{new_dsv_descriptor_heap_cpu_descriptor_handle_start.ptr + new_dsv_descriptor_heap_descriptor_increment_size * 0U};
 
-	D3D12_DEPTH_STENCIL_VIEW_DESC const depth_stencil_view_desc{
-		.Format = unwrapped_depth_stencil_view_format,
-		.ViewDimension = D3D12_DSV_DIMENSION_TEXTURE2D,
-		.Flags = D3D12_DSV_FLAG_NONE,
-		.Texture2D = {
-			0U}};
-	device->CreateDepthStencilView(this->m_resource, &depth_stencil_view_desc, this->m_depth_stencil_view_descriptor);
+	if ((1U == sample_count) && (1U == layer_count))
+	{
+		D3D12_DEPTH_STENCIL_VIEW_DESC const depth_stencil_view_desc{
+			.Format = unwrapped_depth_stencil_view_format,
+			.ViewDimension = D3D12_DSV_DIMENSION_TEXTURE2D,
+			.Flags = D3D12_DSV_FLAG_NONE,
+			.Texture2D = {
+				0U}};
+		device->CreateDepthStencilView(this->m_resource, &depth_stencil_view_desc, this->m_depth_stencil_view_descriptor);
+	}
+	else if (1U == sample_count)
+	{
+		D3D12_DEPTH_STENCIL_VIEW_DESC const depth_stencil_view_desc{
+			.Format = unwrapped_depth_stencil_view_format,
+			.ViewDimension = D3D12_DSV_DIMENSION_TEXTURE2DARRAY,
+			.Flags = D3D12_DSV_FLAG_NONE,
+			.Texture2DArray = {
+				0U,
+				0U,
+				layer_count}};
+		device->CreateDepthStencilView(this->m_resource, &depth_stencil_view_desc, this->m_depth_stencil_view_descriptor);
+	}
+	else
+	{
+		D3D12_DEPTH_STENCIL_VIEW_DESC const depth_stencil_view_desc{
+			.Format = unwrapped_depth_stencil_view_format,
+			.ViewDimension = D3D12_DSV_DIMENSION_TEXTURE2DMS,
+			.Flags = D3D12_DSV_FLAG_NONE,
+			.Texture2DMS = {
+				0U}};
+		device->CreateDepthStencilView(this->m_resource, &depth_stencil_view_desc, this->m_depth_stencil_view_descriptor);
+	}
 
-	if (allow_sampled_image)
+	if (allow_sampled_image && (1U == layer_count))
 	{
 		this->m_shader_resource_view_desc = D3D12_SHADER_RESOURCE_VIEW_DESC{
 			.Format = unwrapped_shader_resource_view_format,
@@ -257,6 +321,20 @@ void brx_pal_d3d12_depth_stencil_attachment_intermediate_image::init(ID3D12Devic
 				0U,
 				0.0F}};
 	}
+	else if (allow_sampled_image)
+	{
+		this->m_shader_resource_view_desc = D3D12_SHADER_RESOURCE_VIEW_DESC{
+			.Format = unwrapped_shader_resource_view_format,
+			.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2DARRAY,
+			.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING,
+			.Texture2DArray = {
+				0U,
+				1U,
+				0U,
+				layer_count,
+				0U,
+				0.0F}};
+	}
 	else
 	{
 		this->m_shader_resource_view_desc.ViewDimension = D3D12_SRV_DIMENSION_UNKNOWN;
@@ -273,9 +351,14 @@ void brx_pal_d3d12_depth_stencil_attachment_intermediate_image::uninit()
 	this->m_resource->Release();
 	this->m_resource = NULL;
 
-	assert(NULL != this->m_allocation);
-	this->m_allocation->Release();
-	this->m_allocation = NULL;
+	// the allocation is NULL if the image is placed in the memory heap
+	if (NULL != this->m_allocation)
+	{
+		this->m_allocation->Release();
+		this->m_allocation = NULL;
+	}
+
+	this->m_clear_flags = static_cast<D3D12_CLEAR_FLAGS>(0);
 }
 
 brx_pal_d3d12_depth_stencil_attachment_intermediate_image::~brx_pal_d3d12_depth_stencil_attachment_intermediate_image()
@@ -295,6 +378,11 @@ D3D12_CPU_DESCRIPTOR_HANDLE brx_pal_d3d12_depth_stencil_attachment_intermediate_
 	return this->m_depth_stencil_view_descriptor;
 }
 
+D3D12_CLEAR_FLAGS brx_pal_d3d12_depth_stencil_attachment_intermediate_image::get_clear_flags() const
+{
+	return this->m_clear_flags;
+}
+
 D3D12_SHADER_RESOURCE_VIEW_DESC const *brx_pal_d3d12_depth_stencil_attachment_intermediate_image::get_shader_resource_view_desc() const
 {
 	return &this->m_shader_resource_view_desc;
@@ -302,7 +390,7 @@ D3D12_SHADER_RESOURCE_VIEW_DESC const *brx_pal_d3d12_depth_stencil_attachment_in
 
 brx_pal_sampled_image const *brx_pal_d3d12_depth_stencil_attachment_intermediate_image::get_sampled_image() const
 {
-	assert(D3D12_SRV_DIMENSION_TEXTURE2D == this->m_shader_resource_view_desc.ViewDimension);
+	assert((D3D12_SRV_DIMENSION_TEXTURE2D == this->m_shader_resource_view_desc.ViewDimension) || (D3D12_SRV_DIMENSION_TEXTURE2DARRAY == this->m_shader_resource_view_desc.ViewDimension));
 	return static_cast<brx_pal_d3d12_sampled_image const *>(this);
 }
 
@@ -310,7 +398,7 @@ brx_pal_d3d12_storage_intermediate_image::brx_pal_d3d12_storage_intermediate_ima
 {
 }
 
-void brx_pal_d3d12_storage_intermediate_image::init(D3D12MA::Allocator *memory_allocator, D3D12MA::Pool *storage_intermediate_image_memory_pool, DXGI_FORMAT unwrapped_storage_image_format, uint32_t width, uint32_t height, bool allow_sampled_image)
+void brx_pal_d3d12_storage_intermediate_image::init(D3D12MA::Allocator *memory_allocator, D3D12MA::Pool *storage_intermediate_image_memory_pool, D3D12MA::Allocation *memory_heap_allocation, uint64_t memory_heap_offset, DXGI_FORMAT unwrapped_storage_image_format, uint32_t width, uint32_t height, bool allow_sampled_image)
 {
 	D3D12MA::ALLOCATION_DESC allocation_desc = {
 		D3D12MA::ALLOCATION_FLAG_NONE,
@@ -333,7 +421,16 @@ void brx_pal_d3d12_storage_intermediate_image::init(D3D12MA::Allocator *memory_a
 
 	assert(NULL == this->m_resource);
 	assert(NULL == this->m_allocation);
-	HRESULT hr_create_resource = memory_allocator->CreateResource(&allocation_desc, &resource_desc, (!allow_sampled_image) ? D3D12_RESOURCE_STATE_UNORDERED_ACCESS : (D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE), NULL, &this->m_allocation, IID_PPV_ARGS(&this->m_resource));
+	HRESULT hr_create_resource;
+	if (NULL == memory_heap_allocation)
+	{
+		hr_create_resource = memory_allocator->CreateResource(&allocation_desc, &resource_desc, (!allow_sampled_image) ? D3D12_RESOURCE_STATE_UNORDERED_ACCESS : (D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE), NULL, &this->m_allocation, IID_PPV_ARGS(&this->m_resource));
+	}
+	else
+	{
+		// only the resource is created and the allocation is owned by the memory heap
+		hr_create_resource = memory_allocator->CreateAliasingResource(memory_heap_allocation, memory_heap_offset, &resource_desc, (!allow_sampled_image) ? D3D12_RESOURCE_STATE_UNORDERED_ACCESS : (D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE), NULL, IID_PPV_ARGS(&this->m_resource));
+	}
 	assert(SUCCEEDED(hr_create_resource));
 
 	this->m_unordered_access_view_desc = D3D12_UNORDERED_ACCESS_VIEW_DESC{
@@ -367,9 +464,12 @@ void brx_pal_d3d12_storage_intermediate_image::uninit()
 	this->m_resource->Release();
 	this->m_resource = NULL;
 
-	assert(NULL != this->m_allocation);
-	this->m_allocation->Release();
-	this->m_allocation = NULL;
+	// the allocation is NULL if the image is placed in the memory heap
+	if (NULL != this->m_allocation)
+	{
+		this->m_allocation->Release();
+		this->m_allocation = NULL;
+	}
 }
 
 brx_pal_d3d12_storage_intermediate_image::~brx_pal_d3d12_storage_intermediate_image()
@@ -479,3 +579,119 @@ uint32_t brx_pal_d3d12_sampled_asset_image::get_mip_levels() const
 {
 	return this->m_mip_levels;
 }
+
+void brx_pal_d3d12_color_attachment_intermediate_image::get_memory_requirements(ID3D12Device *device, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT wrapped_color_attachment_image_format, uint32_t width, uint32_t height, D3D12_RESOURCE_ALLOCATION_INFO *out_resource_allocation_info)
+{
+	D3D12_RESOURCE_DESC const resource_desc = {
+		D3D12_RESOURCE_DIMENSION_TEXTURE2D,
+		D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT,
+		width,
+		height,
+		1U,
+		1U,
+		_internal_unwrap_color_attachment_image_format(wrapped_color_attachment_image_format),
+		{1U, 0U},
+		D3D12_TEXTURE_LAYOUT_UNKNOWN,
+		D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET};
+	(*out_resource_allocation_info) = device->GetResourceAllocationInfo(0U, 1U, &resource_desc);
+}
+
+void brx_pal_d3d12_depth_stencil_attachment_intermediate_image::get_memory_requirements(ID3D12Device *device, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT wrapped_depth_stencil_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image, D3D12_RESOURCE_ALLOCATION_INFO *out_resource_allocation_info)
+{
+	DXGI_FORMAT unwrapped_resource_format;
+	DXGI_FORMAT unwrapped_depth_stencil_view_format;
+	DXGI_FORMAT unwrapped_shader_resource_view_format;
+	D3D12_CLEAR_FLAGS clear_flags;
+	_internal_unwrap_depth_stencil_attachment_image_format(wrapped_depth_stencil_attachment_image_format, &unwrapped_resource_format, &unwrapped_depth_stencil_view_format, &unwrapped_shader_resource_view_format, &clear_flags);
+
+	D3D12_RESOURCE_DESC const resource_desc = {
+		D3D12_RESOURCE_DIMENSION_TEXTURE2D,
+		D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT,
+		width,
+		height,
+		1U,
+		1U,
+		unwrapped_resource_format,
+		{1U, 0U},
+		D3D12_TEXTURE_LAYOUT_UNKNOWN,
+		(!allow_sampled_image) ? (D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL | D3D12_RESOURCE_FLAG_DENY_SHADER_RESOURCE) : D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL};
+	(*out_resource_allocation_info) = device->GetResourceAllocationInfo(0U, 1U, &resource_desc);
+}
+
+void brx_pal_d3d12_storage_intermediate_image::get_memory_requirements(ID3D12Device *device, DXGI_FORMAT unwrapped_storage_image_format, uint32_t width, uint32_t height, D3D12_RESOURCE_ALLOCATION_INFO *out_resource_allocation_info)
+{
+	D3D12_RESOURCE_DESC const resource_desc = {
+		D3D12_RESOURCE_DIMENSION_TEXTURE2D,
+		D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT,
+		width,
+		height,
+		1U,
+		1U,
+		unwrapped_storage_image_format,
+		{1U, 0U},
+		D3D12_TEXTURE_LAYOUT_UNKNOWN,
+		D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS};
+	(*out_resource_allocation_info) = device->GetResourceAllocationInfo(0U, 1U, &resource_desc);
+}
+
+static inline DXGI_FORMAT _internal_unwrap_color_attachment_image_format(BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT wrapped_color_attachment_image_format)
+{
+	DXGI_FORMAT unwrapped_format;
+	switch (wrapped_color_attachment_image_format)
+	{
+	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_B8G8R8A8_UNORM:
+		unwrapped_format = DXGI_FORMAT_B8G8R8A8_UNORM;
+		break;
+	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_R8G8B8A8_UNORM:
+		unwrapped_format = DXGI_FORMAT_R8G8B8A8_UNORM;
+		break;
+	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_A2B10G10R10_UNORM_PACK32:
+		assert(false);
+		unwrapped_format = static_cast<DXGI_FORMAT>(-1);
+		break;
+	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_A2R10G10B10_UNORM_PACK32:
+		unwrapped_format = DXGI_FORMAT_R10G10B10A2_UNORM;
+		break;
+	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_R32G32_UINT:
+		unwrapped_format = DXGI_FORMAT_R32G32_UINT;
+		break;
+	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_R32G32B32A32_UINT:
+		unwrapped_format = DXGI_FORMAT_R32G32B32A32_UINT;
+		break;
+	default:
+		assert(false);
+		unwrapped_format = static_cast<DXGI_FORMAT>(-1);
+	}
+	return unwrapped_format;
+}
+
+static inline void _internal_unwrap_depth_stencil_attachment_image_format(BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT wrapped_depth_stencil_attachment_image_format, DXGI_FORMAT *out_unwrapped_resource_format, DXGI_FORMAT *out_unwrapped_depth_stencil_view_format, DXGI_FORMAT *out_unwrapped_shader_resource_view_format, D3D12_CLEAR_FLAGS *out_clear_flags)
+{
+	switch (wrapped_depth_stencil_attachment_image_format)
+	{
+	case BRX_PAL_DEPTH_STENCIL_ATTACHMENT_FORMAT_D32_SFLOAT:
+		(*out_unwrapped_resource_format) = DXGI_FORMAT_R32_TYPELESS;
+		(*out_unwrapped_depth_stencil_view_format) = DXGI_FORMAT_D32_FLOAT;
+		(*out_unwrapped_shader_resource_view_format) = DXGI_FORMAT_R32_FLOAT;
+		(*out_clear_flags) = D3D12_CLEAR_FLAG_DEPTH;
+		break;
+	case BRX_PAL_DEPTH_STENCIL_ATTACHMENT_FORMAT_D32_SFLOAT_S8_UINT:
+		(*out_unwrapped_resource_format) = DXGI_FORMAT_X32_TYPELESS_G8X24_UINT;
+		(*out_unwrapped_depth_stencil_view_format) = DXGI_FORMAT_D32_FLOAT_S8X24_UINT;
+		(*out_unwrapped_shader_resource_view_format) = DXGI_FORMAT_R32_FLOAT_X8X24_TYPELESS;
+		(*out_clear_flags) = D3D12_CLEAR_FLAG_DEPTH | D3D12_CLEAR_FLAG_STENCIL;
+		break;
+	case BRX_PAL_DEPTH_STENCIL_ATTACHMENT_FORMAT_D24_UNORM_S8_UINT:
+		(*out_unwrapped_resource_format) = DXGI_FORMAT_X24_TYPELESS_G8_UINT;
+		(*out_unwrapped_depth_stencil_view_format) = DXGI_FORMAT_D24_UNORM_S8_UINT;
+		(*out_unwrapped_shader_resource_view_format) = DXGI_FORMAT_R24_UNORM_X8_TYPELESS;
+		(*out_clear_flags) = D3D12_CLEAR_FLAG_DEPTH | D3D12_CLEAR_FLAG_STENCIL;
+		break;
+	default:
+		assert(false);
+		(*out_unwrapped_resource_format) = static_cast<DXGI_FORMAT>(-1);
+		(*out_unwrapped_depth_stencil_view_format) = static_cast<DXGI_FORMAT>(-1);
+		(*out_unwrapped_shader_resource_view_format) = static_cast<DXGI_FORMAT>(-1);
+		(*out_clear_flags) = static_cast<D3D12_CLEAR_FLAGS>(0);
+	}
+}
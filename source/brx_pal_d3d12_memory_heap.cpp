@@ -0,0 +1,77 @@
+//
+// Copyright (C) YuqiaoZhang(HanetakaChou)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#include "brx_pal_d3d12_device.h"
+#include <assert.h>
+
+brx_pal_d3d12_memory_heap::brx_pal_d3d12_memory_heap() : m_allocation(NULL), m_type(static_cast<BRX_PAL_MEMORY_HEAP_TYPE>(-1)), m_size(0U)
+{
+}
+
+void brx_pal_d3d12_memory_heap::init(D3D12MA::Allocator *memory_allocator, D3D12MA::Pool *memory_pool, BRX_PAL_MEMORY_HEAP_TYPE memory_heap_type, uint32_t size)
+{
+	assert(0U < size);
+
+	// the heap type and the heap flags are decided by the memory pool
+	D3D12MA::ALLOCATION_DESC const allocation_desc = {
+		D3D12MA::ALLOCATION_FLAG_NONE,
+		D3D12_HEAP_TYPE_CUSTOM,
+		D3D12_HEAP_FLAG_NONE,
+		memory_pool,
+		NULL};
+
+	D3D12_RESOURCE_ALLOCATION_INFO const resource_allocation_info = {
+		size,
+		D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT};
+
+	assert(NULL == this->m_allocation);
+	HRESULT const hr_allocate_memory = memory_allocator->AllocateMemory(&allocation_desc, &resource_allocation_info, &this->m_allocation);
+	assert(SUCCEEDED(hr_allocate_memory));
+
+	assert(static_cast<BRX_PAL_MEMORY_HEAP_TYPE>(-1) == this->m_type);
+	this->m_type = memory_heap_type;
+
+	assert(0U == this->m_size);
+	this->m_size = size;
+}
+
+void brx_pal_d3d12_memory_heap::uninit()
+{
+	assert(NULL != this->m_allocation);
+	this->m_allocation->Release();
+	this->m_allocation = NULL;
+}
+
+brx_pal_d3d12_memory_heap::~brx_pal_d3d12_memory_heap()
+{
+	assert(NULL == this->m_allocation);
+}
+
+D3D12MA::Allocation *brx_pal_d3d12_memory_heap::get_allocation() const
+{
+	return this->m_allocation;
+}
+
+BRX_PAL_MEMORY_HEAP_TYPE brx_pal_d3d12_memory_heap::get_type() const
+{
+	return this->m_type;
+}
+
+uint64_t brx_pal_d3d12_memory_heap::get_size() const
+{
+	return this->m_size;
+}
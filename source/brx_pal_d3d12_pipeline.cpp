@@ -22,16 +22,25 @@ brx_pal_d3d12_graphics_pipeline::brx_pal_d3d12_graphics_pipeline() : m_pipeline_
 {
 }
 
-void brx_pal_d3d12_graphics_pipeline::init(ID3D12Device *device, brx_pal_render_pass const *wrapped_render_pass, brx_pal_pipeline_layout const *wrapped_pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION wrapped_depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION wrapped_blend_operation)
+void brx_pal_d3d12_graphics_pipeline::init(ID3D12Device2 *device, brx_pal_render_pass const *wrapped_render_pass, brx_pal_pipeline_layout const *wrapped_pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t task_shader_module_code_size, void const *task_shader_module_code, size_t mesh_shader_module_code_size, void const *mesh_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION wrapped_depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION wrapped_blend_operation)
 {
-	D3D12_PRIMITIVE_TOPOLOGY_TYPE const new_primitive_topology_type = D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE;
-	this->m_primitive_topology = D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
-
 	assert(NULL != wrapped_render_pass);
-	assert(NULL != wrapped_pipeline_layout);
 	uint32_t const color_attachment_count = static_cast<brx_pal_d3d12_render_pass const *>(wrapped_render_pass)->get_color_attachment_count();
 	BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *const color_attachment_formats = static_cast<brx_pal_d3d12_render_pass const *>(wrapped_render_pass)->get_color_attachment_formats();
 	BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *const depth_stencil_attachment_format = static_cast<brx_pal_d3d12_render_pass const *>(wrapped_render_pass)->get_depth_stencil_attachment_format();
+	uint32_t const sample_count = static_cast<brx_pal_d3d12_render_pass const *>(wrapped_render_pass)->get_sample_count();
+	uint32_t const view_count = static_cast<brx_pal_d3d12_render_pass const *>(wrapped_render_pass)->get_view_count();
+
+	this->init(device, color_attachment_count, color_attachment_formats, depth_stencil_attachment_format, sample_count, view_count, wrapped_pipeline_layout, vertex_binding_count, vertex_binding_strides, vertex_attribute_count, vertex_attributes, vertex_shader_module_code_size, vertex_shader_module_code, task_shader_module_code_size, task_shader_module_code, mesh_shader_module_code_size, mesh_shader_module_code, fragment_shader_module_code_size, fragment_shader_module_code, enable_back_face_cull, front_ccw, wrapped_depth_compare_operation, wrapped_blend_operation);
+}
+
+void brx_pal_d3d12_graphics_pipeline::init(ID3D12Device2 *device, uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, brx_pal_pipeline_layout const *wrapped_pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t task_shader_module_code_size, void const *task_shader_module_code, size_t mesh_shader_module_code_size, void const *mesh_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION wrapped_depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION wrapped_blend_operation)
+{
+	D3D12_PRIMITIVE_TOPOLOGY_TYPE const new_primitive_topology_type = D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE;
+	this->m_primitive_topology = D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+
+	assert(NULL != wrapped_pipeline_layout);
+	assert((0U == color_attachment_count) || (NULL != color_attachment_formats));
 	ID3D12RootSignature *const root_signature = static_cast<brx_pal_d3d12_pipeline_layout const *>(wrapped_pipeline_layout)->get_root_signature();
 
 	D3D12_DEPTH_STENCIL_DESC depth_stencil_state;
@@ -214,34 +223,218 @@ void brx_pal_d3d12_graphics_pipeline::init(ID3D12Device *device, brx_pal_render_
 		dsv_format = DXGI_FORMAT_UNKNOWN;
 	}
 
-	D3D12_GRAPHICS_PIPELINE_STATE_DESC const desc = {
+	// the strides are used by the "bind_vertex_buffers" since the D3D12_VERTEX_BUFFER_VIEW (rather than the input layout) provides the stride
+	assert((0U == vertex_binding_count) || (NULL != vertex_binding_strides));
+	assert(this->m_vertex_binding_strides.empty());
+	this->m_vertex_binding_strides.resize(static_cast<size_t>(vertex_binding_count));
+	for (uint32_t vertex_binding_index = 0U; vertex_binding_index < vertex_binding_count; ++vertex_binding_index)
+	{
+		this->m_vertex_binding_strides[vertex_binding_index] = vertex_binding_strides[vertex_binding_index];
+	}
+
+	// the semantic of the vertex shader input is "LOCATION" and the semantic index is the location
+	assert((0U == vertex_attribute_count) || (NULL != vertex_attributes));
+	mcrt_vector<D3D12_INPUT_ELEMENT_DESC> input_element_descs(static_cast<size_t>(vertex_attribute_count));
+	for (uint32_t vertex_attribute_index = 0U; vertex_attribute_index < vertex_attribute_count; ++vertex_attribute_index)
+	{
+		DXGI_FORMAT vertex_attribute_format;
+		switch (vertex_attributes[vertex_attribute_index].format)
+		{
+		case BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE_FORMAT_R32G32B32_SFLOAT:
+			vertex_attribute_format = DXGI_FORMAT_R32G32B32_FLOAT;
+			break;
+		case BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE_FORMAT_R32G32_SFLOAT:
+			vertex_attribute_format = DXGI_FORMAT_R32G32_FLOAT;
+			break;
+		case BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE_FORMAT_R32G32B32A32_SFLOAT:
+			vertex_attribute_format = DXGI_FORMAT_R32G32B32A32_FLOAT;
+			break;
+		case BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE_FORMAT_R16G16B16A16_UINT:
+			vertex_attribute_format = DXGI_FORMAT_R16G16B16A16_UINT;
+			break;
+		case BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE_FORMAT_R8G8B8A8_UNORM:
+			vertex_attribute_format = DXGI_FORMAT_R8G8B8A8_UNORM;
+			break;
+		default:
+			assert(false);
+			vertex_attribute_format = static_cast<DXGI_FORMAT>(-1);
+		}
+
+		assert(vertex_attributes[vertex_attribute_index].binding < vertex_binding_count);
+		input_element_descs[vertex_attribute_index] = D3D12_INPUT_ELEMENT_DESC{
+			"LOCATION",
+			vertex_attributes[vertex_attribute_index].location,
+			vertex_attribute_format,
+			vertex_attributes[vertex_attribute_index].binding,
+			vertex_attributes[vertex_attribute_index].offset,
+			D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA,
+			0U};
+	}
+
+	// the mesh shader graphics pipeline has neither the input assembler nor the vertex shader, and the amplification shader (task shader) is optional
+	if (NULL != mesh_shader_module_code)
+	{
+		assert(0U == vertex_binding_count);
+		assert(0U == vertex_attribute_count);
+		assert(NULL == vertex_shader_module_code);
+		assert(1U == view_count);
+
+		struct
+		{
+			alignas(void *) D3D12_PIPELINE_STATE_SUBOBJECT_TYPE root_signature_type;
+			ID3D12RootSignature *root_signature;
+			alignas(void *) D3D12_PIPELINE_STATE_SUBOBJECT_TYPE as_type;
+			D3D12_SHADER_BYTECODE as;
+			alignas(void *) D3D12_PIPELINE_STATE_SUBOBJECT_TYPE ms_type;
+			D3D12_SHADER_BYTECODE ms;
+			alignas(void *) D3D12_PIPELINE_STATE_SUBOBJECT_TYPE ps_type;
+			D3D12_SHADER_BYTECODE ps;
+			alignas(void *) D3D12_PIPELINE_STATE_SUBOBJECT_TYPE blend_state_type;
+			D3D12_BLEND_DESC blend_state;
+			alignas(void *) D3D12_PIPELINE_STATE_SUBOBJECT_TYPE sample_mask_type;
+			UINT sample_mask;
+			alignas(void *) D3D12_PIPELINE_STATE_SUBOBJECT_TYPE rasterizer_state_type;
+			D3D12_RASTERIZER_DESC rasterizer_state;
+			alignas(void *) D3D12_PIPELINE_STATE_SUBOBJECT_TYPE depth_stencil_state_type;
+			D3D12_DEPTH_STENCIL_DESC depth_stencil_state;
+			alignas(void *) D3D12_PIPELINE_STATE_SUBOBJECT_TYPE render_target_formats_type;
+			D3D12_RT_FORMAT_ARRAY render_target_formats;
+			alignas(void *) D3D12_PIPELINE_STATE_SUBOBJECT_TYPE depth_stencil_format_type;
+			DXGI_FORMAT depth_stencil_format;
+			alignas(void *) D3D12_PIPELINE_STATE_SUBOBJECT_TYPE sample_desc_type;
+			DXGI_SAMPLE_DESC sample_desc;
+		} const mesh_shader_pipeline_state_stream = {
+			D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_ROOT_SIGNATURE,
+			root_signature,
+			D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_AS,
+			{task_shader_module_code, (NULL != task_shader_module_code) ? task_shader_module_code_size : 0U},
+			D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_MS,
+			{mesh_shader_module_code, mesh_shader_module_code_size},
+			D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_PS,
+			{fragment_shader_module_code, fragment_shader_module_code_size},
+			D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_BLEND,
+			{blend_state},
+			D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_SAMPLE_MASK,
+			0XFFFFFFFFU,
+			D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_RASTERIZER,
+			{D3D12_FILL_MODE_SOLID, enable_back_face_cull ? D3D12_CULL_MODE_BACK : D3D12_CULL_MODE_NONE, front_ccw ? TRUE : FALSE, 0, 0.0F, 0.0F, TRUE, FALSE, FALSE, 0U, D3D12_CONSERVATIVE_RASTERIZATION_MODE_OFF},
+			D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_DEPTH_STENCIL,
+			{depth_stencil_state},
+			D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_RENDER_TARGET_FORMATS,
+			{{rtv_formats[0], rtv_formats[1], rtv_formats[2], rtv_formats[3], rtv_formats[4], rtv_formats[5], rtv_formats[6], rtv_formats[7]}, color_attachment_count},
+			D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_DEPTH_STENCIL_FORMAT,
+			dsv_format,
+			D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_SAMPLE_DESC,
+			{sample_count, 0U}};
+
+		D3D12_PIPELINE_STATE_STREAM_DESC const mesh_shader_desc = {
+			sizeof(mesh_shader_pipeline_state_stream),
+			const_cast<void *>(static_cast<void const *>(&mesh_shader_pipeline_state_stream))};
+
+		assert(NULL == this->m_pipeline_state);
+		HRESULT const hr_create_mesh_shader_graphics_pipeline_state = device->CreatePipelineState(&mesh_shader_desc, IID_PPV_ARGS(&this->m_pipeline_state));
+		assert(SUCCEEDED(hr_create_mesh_shader_graphics_pipeline_state));
+		return;
+	}
+
+	assert(NULL == task_shader_module_code);
+
+	// the view instance "i" is rendered into the array slice "i" of the (layered) attachments (should match the "begin_rendering")
+	assert((1U <= view_count) && (view_count <= D3D12_MAX_VIEW_INSTANCE_COUNT));
+	D3D12_VIEW_INSTANCE_LOCATION view_instance_locations[D3D12_MAX_VIEW_INSTANCE_COUNT];
+	for (uint32_t view_index = 0U; view_index < view_count; ++view_index)
+	{
+		view_instance_locations[view_index] = D3D12_VIEW_INSTANCE_LOCATION{0U, view_index};
+	}
+
+	// the "D3D12_GRAPHICS_PIPELINE_STATE_DESC" does NOT support the view instancing
+	// we use the pipeline state stream instead (each subobject is aligned to the pointer size)
+	struct
+	{
+		alignas(void *) D3D12_PIPELINE_STATE_SUBOBJECT_TYPE root_signature_type;
+		ID3D12RootSignature *root_signature;
+		alignas(void *) D3D12_PIPELINE_STATE_SUBOBJECT_TYPE vs_type;
+		D3D12_SHADER_BYTECODE vs;
+		alignas(void *) D3D12_PIPELINE_STATE_SUBOBJECT_TYPE ps_type;
+		D3D12_SHADER_BYTECODE ps;
+		alignas(void *) D3D12_PIPELINE_STATE_SUBOBJECT_TYPE blend_state_type;
+		D3D12_BLEND_DESC blend_state;
+		alignas(void *) D3D12_PIPELINE_STATE_SUBOBJECT_TYPE sample_mask_type;
+		UINT sample_mask;
+		alignas(void *) D3D12_PIPELINE_STATE_SUBOBJECT_TYPE rasterizer_state_type;
+		D3D12_RASTERIZER_DESC rasterizer_state;
+		alignas(void *) D3D12_PIPELINE_STATE_SUBOBJECT_TYPE depth_stencil_state_type;
+		D3D12_DEPTH_STENCIL_DESC depth_stencil_state;
+		alignas(void *) D3D12_PIPELINE_STATE_SUBOBJECT_TYPE input_layout_type;
+		D3D12_INPUT_LAYOUT_DESC input_layout;
+		alignas(void *) D3D12_PIPELINE_STATE_SUBOBJECT_TYPE ib_strip_cut_value_type;
+		D3D12_INDEX_BUFFER_STRIP_CUT_VALUE ib_strip_cut_value;
+		alignas(void *) D3D12_PIPELINE_STATE_SUBOBJECT_TYPE primitive_topology_type_type;
+		D3D12_PRIMITIVE_TOPOLOGY_TYPE primitive_topology_type;
+		alignas(void *) D3D12_PIPELINE_STATE_SUBOBJECT_TYPE render_target_formats_type;
+		D3D12_RT_FORMAT_ARRAY render_target_formats;
+		alignas(void *) D3D12_PIPELINE_STATE_SUBOBJECT_TYPE depth_stencil_format_type;
+		DXGI_FORMAT depth_stencil_format;
+		alignas(void *) D3D12_PIPELINE_STATE_SUBOBJECT_TYPE sample_desc_type;
+		DXGI_SAMPLE_DESC sample_desc;
+		alignas(void *) D3D12_PIPELINE_STATE_SUBOBJECT_TYPE view_instancing_type;
+		D3D12_VIEW_INSTANCING_DESC view_instancing;
+	} const pipeline_state_stream = {
+		D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_ROOT_SIGNATURE,
 		root_signature,
+		D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_VS,
 		{vertex_shader_module_code, vertex_shader_module_code_size},
+		D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_PS,
 		{fragment_shader_module_code, fragment_shader_module_code_size},
-		{NULL, 0U},
-		{NULL, 0U},
-		{NULL, 0U},
-		{NULL, 0U, NULL, 0U, 0U},
+		D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_BLEND,
 		{blend_state},
+		D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_SAMPLE_MASK,
 		0XFFFFFFFFU,
+		D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_RASTERIZER,
 		{D3D12_FILL_MODE_SOLID, enable_back_face_cull ? D3D12_CULL_MODE_BACK : D3D12_CULL_MODE_NONE, front_ccw ? TRUE : FALSE, 0, 0.0F, 0.0F, TRUE, FALSE, FALSE, 0U, D3D12_CONSERVATIVE_RASTERIZATION_MODE_OFF},
+		D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_DEPTH_STENCIL,
 		{depth_stencil_state},
-		{NULL, 0U},
+		D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_INPUT_LAYOUT,
+		{input_element_descs.data(), vertex_attribute_count},
+		D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_IB_STRIP_CUT_VALUE,
 		D3D12_INDEX_BUFFER_STRIP_CUT_VALUE_DISABLED,
+		D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_PRIMITIVE_TOPOLOGY,
 		new_primitive_topology_type,
-		color_attachment_count,
-		{rtv_formats[0], rtv_formats[1], rtv_formats[2], rtv_formats[3], rtv_formats[4], rtv_formats[5], rtv_formats[6], rtv_formats[7]},
+		D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_RENDER_TARGET_FORMATS,
+		{{rtv_formats[0], rtv_formats[1], rtv_formats[2], rtv_formats[3], rtv_formats[4], rtv_formats[5], rtv_formats[6], rtv_formats[7]}, color_attachment_count},
+		D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_DEPTH_STENCIL_FORMAT,
 		dsv_format,
-		{1U, 0U},
-		0U,
-		{NULL, 0U},
-		D3D12_PIPELINE_STATE_FLAG_NONE};
+		D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_SAMPLE_DESC,
+		{sample_count, 0U},
+		D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_VIEW_INSTANCING,
+		{(1U == view_count) ? 0U : view_count, (1U == view_count) ? NULL : view_instance_locations, D3D12_VIEW_INSTANCING_FLAG_NONE}};
+
+	D3D12_PIPELINE_STATE_STREAM_DESC const desc = {
+		sizeof(pipeline_state_stream),
+		const_cast<void *>(static_cast<void const *>(&pipeline_state_stream))};
 
 	assert(NULL == this->m_pipeline_state);
-	HRESULT const hr_create_graphics_pipeline_state = device->CreateGraphicsPipelineState(&desc, IID_PPV_ARGS(&this->m_pipeline_state));
+	HRESULT const hr_create_graphics_pipeline_state = device->CreatePipelineState(&desc, IID_PPV_ARGS(&this->m_pipeline_state));
 	assert(SUCCEEDED(hr_create_graphics_pipeline_state));
 }
 
+void brx_pal_d3d12_graphics_pipeline::init(ID3D12Device2 *device, brx_pal_pipeline_layout const *wrapped_pipeline_layout, brx_pal_graphics_pipeline_pre_rasterization_shader_library const *wrapped_pre_rasterization_shader_library, brx_pal_graphics_pipeline_fragment_shader_library const *wrapped_fragment_shader_library, brx_pal_graphics_pipeline_fragment_output_interface_library const *wrapped_fragment_output_interface_library)
+{
+	assert(NULL != wrapped_pre_rasterization_shader_library);
+	brx_pal_d3d12_graphics_pipeline_pre_rasterization_shader_library const *const pre_rasterization_shader_library = static_cast<brx_pal_d3d12_graphics_pipeline_pre_rasterization_shader_library const *>(wrapped_pre_rasterization_shader_library);
+
+	assert(NULL != wrapped_fragment_shader_library);
+	brx_pal_d3d12_graphics_pipeline_fragment_shader_library const *const fragment_shader_library = static_cast<brx_pal_d3d12_graphics_pipeline_fragment_shader_library const *>(wrapped_fragment_shader_library);
+
+	assert(NULL != wrapped_fragment_output_interface_library);
+	brx_pal_d3d12_graphics_pipeline_fragment_output_interface_library const *const fragment_output_interface_library = static_cast<brx_pal_d3d12_graphics_pipeline_fragment_output_interface_library const *>(wrapped_fragment_output_interface_library);
+
+	assert(pre_rasterization_shader_library->get_view_count() == fragment_output_interface_library->get_view_count());
+	assert(fragment_shader_library->get_view_count() == fragment_output_interface_library->get_view_count());
+
+	this->init(device, fragment_output_interface_library->get_color_attachment_count(), fragment_output_interface_library->get_color_attachment_formats(), fragment_output_interface_library->get_depth_stencil_attachment_format(), fragment_output_interface_library->get_sample_count(), fragment_output_interface_library->get_view_count(), wrapped_pipeline_layout, 0U, NULL, 0U, NULL, pre_rasterization_shader_library->get_vertex_shader_module_code_size(), pre_rasterization_shader_library->get_vertex_shader_module_code(), 0U, NULL, 0U, NULL, fragment_shader_library->get_fragment_shader_module_code_size(), fragment_shader_library->get_fragment_shader_module_code(), pre_rasterization_shader_library->get_enable_back_face_cull(), pre_rasterization_shader_library->get_front_ccw(), fragment_shader_library->get_depth_compare_operation(), fragment_output_interface_library->get_blend_operation());
+}
+
 void brx_pal_d3d12_graphics_pipeline::uninit()
 {
 	assert(NULL != this->m_pipeline_state);
@@ -261,11 +454,211 @@ D3D12_PRIMITIVE_TOPOLOGY brx_pal_d3d12_graphics_pipeline::get_primitive_topology
 	return this->m_primitive_topology;
 }
 
+uint32_t brx_pal_d3d12_graphics_pipeline::get_vertex_binding_count() const
+{
+	return static_cast<uint32_t>(this->m_vertex_binding_strides.size());
+}
+
+uint32_t const *brx_pal_d3d12_graphics_pipeline::get_vertex_binding_strides() const
+{
+	return this->m_vertex_binding_strides.data();
+}
+
 ID3D12PipelineState *brx_pal_d3d12_graphics_pipeline::get_pipeline() const
 {
 	return this->m_pipeline_state;
 }
 
+brx_pal_d3d12_graphics_pipeline_pre_rasterization_shader_library::brx_pal_d3d12_graphics_pipeline_pre_rasterization_shader_library() : m_view_count(0U), m_enable_back_face_cull(false), m_front_ccw(false)
+{
+}
+
+void brx_pal_d3d12_graphics_pipeline_pre_rasterization_shader_library::init(uint32_t view_count, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, bool enable_back_face_cull, bool front_ccw)
+{
+	assert(0U < vertex_shader_module_code_size);
+	assert(NULL != vertex_shader_module_code);
+
+	// the bytecode is copied since the application may release the bytecode after the library is created
+	assert(this->m_vertex_shader_module_code.empty());
+	this->m_vertex_shader_module_code.assign(static_cast<uint8_t const *>(vertex_shader_module_code), static_cast<uint8_t const *>(vertex_shader_module_code) + vertex_shader_module_code_size);
+
+	assert(0U == this->m_view_count);
+	this->m_view_count = view_count;
+
+	this->m_enable_back_face_cull = enable_back_face_cull;
+	this->m_front_ccw = front_ccw;
+}
+
+void brx_pal_d3d12_graphics_pipeline_pre_rasterization_shader_library::uninit()
+{
+	assert(!this->m_vertex_shader_module_code.empty());
+	this->m_vertex_shader_module_code.clear();
+
+	assert(0U != this->m_view_count);
+	this->m_view_count = 0U;
+}
+
+brx_pal_d3d12_graphics_pipeline_pre_rasterization_shader_library::~brx_pal_d3d12_graphics_pipeline_pre_rasterization_shader_library()
+{
+	assert(this->m_vertex_shader_module_code.empty());
+	assert(0U == this->m_view_count);
+}
+
+size_t brx_pal_d3d12_graphics_pipeline_pre_rasterization_shader_library::get_vertex_shader_module_code_size() const
+{
+	return this->m_vertex_shader_module_code.size();
+}
+
+void const *brx_pal_d3d12_graphics_pipeline_pre_rasterization_shader_library::get_vertex_shader_module_code() const
+{
+	return this->m_vertex_shader_module_code.data();
+}
+
+uint32_t brx_pal_d3d12_graphics_pipeline_pre_rasterization_shader_library::get_view_count() const
+{
+	return this->m_view_count;
+}
+
+bool brx_pal_d3d12_graphics_pipeline_pre_rasterization_shader_library::get_enable_back_face_cull() const
+{
+	return this->m_enable_back_face_cull;
+}
+
+bool brx_pal_d3d12_graphics_pipeline_pre_rasterization_shader_library::get_front_ccw() const
+{
+	return this->m_front_ccw;
+}
+
+brx_pal_d3d12_graphics_pipeline_fragment_shader_library::brx_pal_d3d12_graphics_pipeline_fragment_shader_library() : m_view_count(0U), m_depth_compare_operation(BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION_DISABLE)
+{
+}
+
+void brx_pal_d3d12_graphics_pipeline_fragment_shader_library::init(uint32_t view_count, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation)
+{
+	assert(0U < fragment_shader_module_code_size);
+	assert(NULL != fragment_shader_module_code);
+
+	assert(this->m_fragment_shader_module_code.empty());
+	this->m_fragment_shader_module_code.assign(static_cast<uint8_t const *>(fragment_shader_module_code), static_cast<uint8_t const *>(fragment_shader_module_code) + fragment_shader_module_code_size);
+
+	assert(0U == this->m_view_count);
+	this->m_view_count = view_count;
+
+	this->m_depth_compare_operation = depth_compare_operation;
+}
+
+void brx_pal_d3d12_graphics_pipeline_fragment_shader_library::uninit()
+{
+	assert(!this->m_fragment_shader_module_code.empty());
+	this->m_fragment_shader_module_code.clear();
+
+	assert(0U != this->m_view_count);
+	this->m_view_count = 0U;
+}
+
+brx_pal_d3d12_graphics_pipeline_fragment_shader_library::~brx_pal_d3d12_graphics_pipeline_fragment_shader_library()
+{
+	assert(this->m_fragment_shader_module_code.empty());
+	assert(0U == this->m_view_count);
+}
+
+size_t brx_pal_d3d12_graphics_pipeline_fragment_shader_library::get_fragment_shader_module_code_size() const
+{
+	return this->m_fragment_shader_module_code.size();
+}
+
+void const *brx_pal_d3d12_graphics_pipeline_fragment_shader_library::get_fragment_shader_module_code() const
+{
+	return this->m_fragment_shader_module_code.data();
+}
+
+uint32_t brx_pal_d3d12_graphics_pipeline_fragment_shader_library::get_view_count() const
+{
+	return this->m_view_count;
+}
+
+BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION brx_pal_d3d12_graphics_pipeline_fragment_shader_library::get_depth_compare_operation() const
+{
+	return this->m_depth_compare_operation;
+}
+
+brx_pal_d3d12_graphics_pipeline_fragment_output_interface_library::brx_pal_d3d12_graphics_pipeline_fragment_output_interface_library() : m_sample_count(0U), m_view_count(0U), m_blend_operation(BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION_DISABLE)
+{
+}
+
+void brx_pal_d3d12_graphics_pipeline_fragment_output_interface_library::init(uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation)
+{
+	assert((0U == color_attachment_count) || (NULL != color_attachment_formats));
+
+	assert(this->m_color_attachment_formats.empty());
+	this->m_color_attachment_formats.assign(color_attachment_formats, color_attachment_formats + color_attachment_count);
+
+	assert(this->m_depth_stencil_attachment_format.empty());
+	if (NULL != depth_stencil_attachment_format)
+	{
+		this->m_depth_stencil_attachment_format.push_back(*depth_stencil_attachment_format);
+	}
+
+	assert(0U == this->m_sample_count);
+	this->m_sample_count = sample_count;
+
+	assert(0U == this->m_view_count);
+	this->m_view_count = view_count;
+
+	this->m_blend_operation = blend_operation;
+}
+
+void brx_pal_d3d12_graphics_pipeline_fragment_output_interface_library::uninit()
+{
+	this->m_color_attachment_formats.clear();
+
+	this->m_depth_stencil_attachment_format.clear();
+
+	assert(0U != this->m_sample_count);
+	this->m_sample_count = 0U;
+
+	assert(0U != this->m_view_count);
+	this->m_view_count = 0U;
+}
+
+brx_pal_d3d12_graphics_pipeline_fragment_output_interface_library::~brx_pal_d3d12_graphics_pipeline_fragment_output_interface_library()
+{
+	assert(this->m_color_attachment_formats.empty());
+	assert(this->m_depth_stencil_attachment_format.empty());
+	assert(0U == this->m_sample_count);
+	assert(0U == this->m_view_count);
+}
+
+uint32_t brx_pal_d3d12_graphics_pipeline_fragment_output_interface_library::get_color_attachment_count() const
+{
+	return static_cast<uint32_t>(this->m_color_attachment_formats.size());
+}
+
+BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *brx_pal_d3d12_graphics_pipeline_fragment_output_interface_library::get_color_attachment_formats() const
+{
+	return this->m_color_attachment_formats.data();
+}
+
+BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *brx_pal_d3d12_graphics_pipeline_fragment_output_interface_library::get_depth_stencil_attachment_format() const
+{
+	return (!this->m_depth_stencil_attachment_format.empty()) ? &this->m_depth_stencil_attachment_format[0] : NULL;
+}
+
+uint32_t brx_pal_d3d12_graphics_pipeline_fragment_output_interface_library::get_sample_count() const
+{
+	return this->m_sample_count;
+}
+
+uint32_t brx_pal_d3d12_graphics_pipeline_fragment_output_interface_library::get_view_count() const
+{
+	return this->m_view_count;
+}
+
+BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION brx_pal_d3d12_graphics_pipeline_fragment_output_interface_library::get_blend_operation() const
+{
+	return this->m_blend_operation;
+}
+
 brx_pal_d3d12_compute_pipeline::brx_pal_d3d12_compute_pipeline() : m_pipeline_state(NULL)
 {
 }
@@ -113,6 +113,19 @@ bool brx_pal_d3d12_graphics_queue::submit_and_present(brx_pal_graphics_command_b
 	return true;
 }
 
+void brx_pal_d3d12_graphics_queue::wait(brx_pal_compute_command_buffer const *wrapped_compute_command_buffer) const
+{
+	assert(NULL != wrapped_compute_command_buffer);
+	ID3D12Fence *compute_queue_submit_fence = static_cast<brx_pal_d3d12_compute_command_buffer const *>(wrapped_compute_command_buffer)->get_compute_queue_submit_fence();
+	assert(NULL != compute_queue_submit_fence);
+
+	HRESULT hr_wait = this->m_graphics_queue->Wait(compute_queue_submit_fence, 1U);
+	assert(SUCCEEDED(hr_wait));
+
+	HRESULT hr_reset = this->m_graphics_queue->Signal(compute_queue_submit_fence, 0U);
+	assert(SUCCEEDED(hr_reset));
+}
+
 brx_pal_d3d12_upload_queue::brx_pal_d3d12_upload_queue() : m_upload_queue(NULL)
 {
 }
@@ -164,3 +177,64 @@ void brx_pal_d3d12_upload_queue::submit_and_signal(brx_pal_upload_command_buffer
 		assert(NULL == this->m_upload_queue);
 	}
 }
+
+brx_pal_d3d12_compute_queue::brx_pal_d3d12_compute_queue() : m_graphics_queue(NULL), m_compute_queue(NULL)
+{
+}
+
+void brx_pal_d3d12_compute_queue::init(ID3D12CommandQueue *graphics_queue, ID3D12CommandQueue *compute_queue)
+{
+	assert(NULL == this->m_graphics_queue);
+	this->m_graphics_queue = graphics_queue;
+
+	assert(NULL == this->m_compute_queue);
+	this->m_compute_queue = compute_queue;
+}
+
+void brx_pal_d3d12_compute_queue::uninit(ID3D12CommandQueue *graphics_queue, ID3D12CommandQueue *compute_queue)
+{
+	assert(NULL != this->m_graphics_queue);
+
+	assert(graphics_queue == this->m_graphics_queue);
+
+	this->m_graphics_queue = NULL;
+
+	assert(NULL != this->m_compute_queue);
+
+	assert(compute_queue == this->m_compute_queue);
+
+	this->m_compute_queue = NULL;
+}
+
+brx_pal_d3d12_compute_queue::~brx_pal_d3d12_compute_queue()
+{
+	assert(NULL == this->m_graphics_queue);
+	assert(NULL == this->m_compute_queue);
+}
+
+void brx_pal_d3d12_compute_queue::submit_and_signal(brx_pal_compute_command_buffer const *wrapped_compute_command_buffer) const
+{
+	assert(NULL != wrapped_compute_command_buffer);
+	ID3D12CommandList *graphics_queue_command_list = static_cast<brx_pal_d3d12_compute_command_buffer const *>(wrapped_compute_command_buffer)->get_graphics_queue_command_list();
+	ID3D12Fence *graphics_queue_submit_fence = static_cast<brx_pal_d3d12_compute_command_buffer const *>(wrapped_compute_command_buffer)->get_graphics_queue_submit_fence();
+	ID3D12CommandList *compute_command_list = static_cast<brx_pal_d3d12_compute_command_buffer const *>(wrapped_compute_command_buffer)->get_command_list();
+	ID3D12Fence *compute_queue_submit_fence = static_cast<brx_pal_d3d12_compute_command_buffer const *>(wrapped_compute_command_buffer)->get_compute_queue_submit_fence();
+
+	// the load barriers (from the resting state to the common state) are executed by the graphics queue
+	this->m_graphics_queue->ExecuteCommandLists(1U, &graphics_queue_command_list);
+
+	HRESULT hr_graphics_queue_signal = this->m_graphics_queue->Signal(graphics_queue_submit_fence, 1U);
+	assert(SUCCEEDED(hr_graphics_queue_signal));
+
+	HRESULT hr_wait = this->m_compute_queue->Wait(graphics_queue_submit_fence, 1U);
+	assert(SUCCEEDED(hr_wait));
+
+	HRESULT hr_reset = this->m_compute_queue->Signal(graphics_queue_submit_fence, 0U);
+	assert(SUCCEEDED(hr_reset));
+
+	this->m_compute_queue->ExecuteCommandLists(1U, &compute_command_list);
+
+	// waited by the graphics queue "wait"
+	HRESULT hr_compute_queue_signal = this->m_compute_queue->Signal(compute_queue_submit_fence, 1U);
+	assert(SUCCEEDED(hr_compute_queue_signal));
+}
@@ -25,18 +25,24 @@ brx_pal_d3d12_render_pass::brx_pal_d3d12_render_pass(
 	mcrt_vector<uint32_t> &&color_attachment_flush_for_present_indices,
 	mcrt_vector<BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT> &&depth_stencil_attachment_format,
 	bool depth_stencil_attachment_clear,
-	bool depth_stencil_attachment_flush_for_sampled_image)
+	bool depth_stencil_attachment_flush_for_sampled_image,
+	uint32_t sample_count,
+	uint32_t view_count)
 	: m_color_attachment_formats(std::move(color_attachment_formats)),
 	  m_color_attachment_clear_indices(std::move(color_attachment_clear_indices)),
 	  m_color_attachment_flush_for_sampled_image_indices(std::move(color_attachment_flush_for_sampled_image_indices)),
 	  m_color_attachment_flush_for_present_indices(std::move(color_attachment_flush_for_present_indices)),
 	  m_depth_stencil_attachment_format(std::move(depth_stencil_attachment_format)),
 	  m_depth_stencil_attachment_clear(depth_stencil_attachment_clear),
-	  m_depth_stencil_attachment_flush_for_sampled_image(depth_stencil_attachment_flush_for_sampled_image)
+	  m_depth_stencil_attachment_flush_for_sampled_image(depth_stencil_attachment_flush_for_sampled_image),
+	  m_sample_count(sample_count),
+	  m_view_count(view_count)
 {
 	assert(0U == this->m_depth_stencil_attachment_format.size() || 1U == this->m_depth_stencil_attachment_format.size());
 	assert((!this->m_depth_stencil_attachment_clear) || 1U == this->m_depth_stencil_attachment_format.size());
 	assert((!this->m_depth_stencil_attachment_flush_for_sampled_image) || 1U == this->m_depth_stencil_attachment_format.size());
+	assert((!this->m_depth_stencil_attachment_flush_for_sampled_image) || 1U == this->m_sample_count);
+	assert(1U <= this->m_view_count);
 }
 
 uint32_t brx_pal_d3d12_render_pass::get_color_attachment_count() const
@@ -148,4 +154,14 @@ bool brx_pal_d3d12_render_pass::get_depth_stencil_attachment_clear() const
 bool brx_pal_d3d12_render_pass::get_depth_stencil_attachment_flush_for_sampled_image() const
 {
 	return this->m_depth_stencil_attachment_flush_for_sampled_image;
-}
\ No newline at end of file
+}
+
+uint32_t brx_pal_d3d12_render_pass::get_sample_count() const
+{
+	return this->m_sample_count;
+}
+
+uint32_t brx_pal_d3d12_render_pass::get_view_count() const
+{
+	return this->m_view_count;
+}
@@ -0,0 +1,299 @@
+//
+// Copyright (C) YuqiaoZhang(HanetakaChou)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#include "brx_pal_deferred_destruction_queue.h"
+#include <assert.h>
+
+brx_pal_frame_deferred_destruction_queue::brx_pal_frame_deferred_destruction_queue()
+    : m_device(NULL),
+      m_frame_throttling_count(0U),
+      m_frame_throttling_index(0U)
+{
+}
+
+void brx_pal_frame_deferred_destruction_queue::init(brx_pal_device *device, uint32_t frame_throttling_count)
+{
+    assert(NULL != device);
+    assert(frame_throttling_count > 0U);
+
+    assert(NULL == this->m_device);
+    this->m_device = device;
+
+    assert(0U == this->m_frame_throttling_count);
+    this->m_frame_throttling_count = frame_throttling_count;
+
+    assert(0U == this->m_frame_throttling_index);
+
+    assert(this->m_retire_lists.empty());
+    this->m_retire_lists.resize(frame_throttling_count);
+}
+
+void brx_pal_frame_deferred_destruction_queue::uninit()
+{
+    // the GPU is assumed to be idle, and the pending objects are released from the oldest frame
+    for (uint32_t retire_list_offset = 1U; retire_list_offset <= this->m_frame_throttling_count; ++retire_list_offset)
+    {
+        this->release(&this->m_retire_lists[(this->m_frame_throttling_index + retire_list_offset) % this->m_frame_throttling_count]);
+    }
+    this->m_retire_lists.clear();
+
+    this->m_frame_throttling_index = 0U;
+    this->m_frame_throttling_count = 0U;
+
+    assert(NULL != this->m_device);
+    this->m_device = NULL;
+}
+
+brx_pal_frame_deferred_destruction_queue::~brx_pal_frame_deferred_destruction_queue()
+{
+    assert(NULL == this->m_device);
+    assert(this->m_retire_lists.empty());
+}
+
+void brx_pal_frame_deferred_destruction_queue::push(BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE type, void *object)
+{
+    assert(NULL != object);
+    this->m_retire_lists[this->m_frame_throttling_index].push_back(brx_pal_deferred_destruction_object{type, object});
+}
+
+void brx_pal_frame_deferred_destruction_queue::release(mcrt_vector<brx_pal_deferred_destruction_object> *retire_list)
+{
+    // the objects are destroyed in the same order as the "destroy_*" (e.g. the images placed in the memory heap are destroyed before the memory heap)
+    for (brx_pal_deferred_destruction_object const &deferred_destruction_object : (*retire_list))
+    {
+        switch (deferred_destruction_object.m_type)
+        {
+        case BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_DESCRIPTOR_SET:
+        {
+            this->m_device->destroy_descriptor_set(static_cast<brx_pal_descriptor_set *>(deferred_destruction_object.m_object));
+        }
+        break;
+        case BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_GRAPHICS_PIPELINE:
+        {
+            this->m_device->destroy_graphics_pipeline(static_cast<brx_pal_graphics_pipeline *>(deferred_destruction_object.m_object));
+        }
+        break;
+        case BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_COMPUTE_PIPELINE:
+        {
+            this->m_device->destroy_compute_pipeline(static_cast<brx_pal_compute_pipeline *>(deferred_destruction_object.m_object));
+        }
+        break;
+        case BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_FRAME_BUFFER:
+        {
+            this->m_device->destroy_frame_buffer(static_cast<brx_pal_frame_buffer *>(deferred_destruction_object.m_object));
+        }
+        break;
+        case BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_UNIFORM_UPLOAD_BUFFER:
+        {
+            this->m_device->destroy_uniform_upload_buffer(static_cast<brx_pal_uniform_upload_buffer *>(deferred_destruction_object.m_object));
+        }
+        break;
+        case BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_STAGING_UPLOAD_BUFFER:
+        {
+            this->m_device->destroy_staging_upload_buffer(static_cast<brx_pal_staging_upload_buffer *>(deferred_destruction_object.m_object));
+        }
+        break;
+        case BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_STORAGE_INTERMEDIATE_BUFFER:
+        {
+            this->m_device->destroy_storage_intermediate_buffer(static_cast<brx_pal_storage_intermediate_buffer *>(deferred_destruction_object.m_object));
+        }
+        break;
+        case BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_STORAGE_ASSET_BUFFER:
+        {
+            this->m_device->destroy_storage_asset_buffer(static_cast<brx_pal_storage_asset_buffer *>(deferred_destruction_object.m_object));
+        }
+        break;
+        case BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_COLOR_ATTACHMENT_IMAGE:
+        {
+            this->m_device->destroy_color_attachment_image(static_cast<brx_pal_color_attachment_image *>(deferred_destruction_object.m_object));
+        }
+        break;
+        case BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_DEPTH_STENCIL_ATTACHMENT_IMAGE:
+        {
+            this->m_device->destroy_depth_stencil_attachment_image(static_cast<brx_pal_depth_stencil_attachment_image *>(deferred_destruction_object.m_object));
+        }
+        break;
+        case BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_STORAGE_IMAGE:
+        {
+            this->m_device->destroy_storage_image(static_cast<brx_pal_storage_image *>(deferred_destruction_object.m_object));
+        }
+        break;
+        case BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_MEMORY_HEAP:
+        {
+            this->m_device->destroy_memory_heap(static_cast<brx_pal_memory_heap *>(deferred_destruction_object.m_object));
+        }
+        break;
+        case BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_SAMPLED_ASSET_IMAGE:
+        {
+            this->m_device->destroy_sampled_asset_image(static_cast<brx_pal_sampled_asset_image *>(deferred_destruction_object.m_object));
+        }
+        break;
+        case BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_SAMPLER:
+        {
+            this->m_device->destroy_sampler(static_cast<brx_pal_sampler *>(deferred_destruction_object.m_object));
+        }
+        break;
+        case BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_SCRATCH_BUFFER:
+        {
+            this->m_device->destroy_scratch_buffer(static_cast<brx_pal_scratch_buffer *>(deferred_destruction_object.m_object));
+        }
+        break;
+        case BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_INTERMEDIATE_BOTTOM_LEVEL_ACCELERATION_STRUCTURE:
+        {
+            this->m_device->destroy_intermediate_bottom_level_acceleration_structure(static_cast<brx_pal_intermediate_bottom_level_acceleration_structure *>(deferred_destruction_object.m_object));
+        }
+        break;
+        case BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_NON_COMPACTED_BOTTOM_LEVEL_ACCELERATION_STRUCTURE:
+        {
+            this->m_device->destroy_non_compacted_bottom_level_acceleration_structure(static_cast<brx_pal_non_compacted_bottom_level_acceleration_structure *>(deferred_destruction_object.m_object));
+        }
+        break;
+        case BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_COMPACTED_BOTTOM_LEVEL_ACCELERATION_STRUCTURE:
+        {
+            this->m_device->destroy_compacted_bottom_level_acceleration_structure(static_cast<brx_pal_compacted_bottom_level_acceleration_structure *>(deferred_destruction_object.m_object));
+        }
+        break;
+        case BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE_UPLOAD_BUFFER:
+        {
+            this->m_device->destroy_top_level_acceleration_structure_instance_upload_buffer(static_cast<brx_pal_top_level_acceleration_structure_instance_upload_buffer *>(deferred_destruction_object.m_object));
+        }
+        break;
+        case BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_TOP_LEVEL_ACCELERATION_STRUCTURE:
+        {
+            this->m_device->destroy_top_level_acceleration_structure(static_cast<brx_pal_top_level_acceleration_structure *>(deferred_destruction_object.m_object));
+        }
+        break;
+        default:
+        {
+            assert(false);
+        }
+        }
+    }
+
+    // the capacity is kept to avoid the memory allocation in the following frames
+    retire_list->clear();
+}
+
+void brx_pal_frame_deferred_destruction_queue::destroy_descriptor_set(brx_pal_descriptor_set *descriptor_set)
+{
+    this->push(BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_DESCRIPTOR_SET, descriptor_set);
+}
+
+void brx_pal_frame_deferred_destruction_queue::destroy_graphics_pipeline(brx_pal_graphics_pipeline *graphics_pipeline)
+{
+    this->push(BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_GRAPHICS_PIPELINE, graphics_pipeline);
+}
+
+void brx_pal_frame_deferred_destruction_queue::destroy_compute_pipeline(brx_pal_compute_pipeline *compute_pipeline)
+{
+    this->push(BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_COMPUTE_PIPELINE, compute_pipeline);
+}
+
+void brx_pal_frame_deferred_destruction_queue::destroy_frame_buffer(brx_pal_frame_buffer *frame_buffer)
+{
+    this->push(BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_FRAME_BUFFER, frame_buffer);
+}
+
+void brx_pal_frame_deferred_destruction_queue::destroy_uniform_upload_buffer(brx_pal_uniform_upload_buffer *uniform_upload_buffer)
+{
+    this->push(BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_UNIFORM_UPLOAD_BUFFER, uniform_upload_buffer);
+}
+
+void brx_pal_frame_deferred_destruction_queue::destroy_staging_upload_buffer(brx_pal_staging_upload_buffer *staging_upload_buffer)
+{
+    this->push(BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_STAGING_UPLOAD_BUFFER, staging_upload_buffer);
+}
+
+void brx_pal_frame_deferred_destruction_queue::destroy_storage_intermediate_buffer(brx_pal_storage_intermediate_buffer *storage_intermediate_buffer)
+{
+    this->push(BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_STORAGE_INTERMEDIATE_BUFFER, storage_intermediate_buffer);
+}
+
+void brx_pal_frame_deferred_destruction_queue::destroy_storage_asset_buffer(brx_pal_storage_asset_buffer *storage_asset_buffer)
+{
+    this->push(BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_STORAGE_ASSET_BUFFER, storage_asset_buffer);
+}
+
+void brx_pal_frame_deferred_destruction_queue::destroy_color_attachment_image(brx_pal_color_attachment_image *color_attachment_image)
+{
+    this->push(BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_COLOR_ATTACHMENT_IMAGE, color_attachment_image);
+}
+
+void brx_pal_frame_deferred_destruction_queue::destroy_depth_stencil_attachment_image(brx_pal_depth_stencil_attachment_image *depth_stencil_attachment_image)
+{
+    this->push(BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_DEPTH_STENCIL_ATTACHMENT_IMAGE, depth_stencil_attachment_image);
+}
+
+void brx_pal_frame_deferred_destruction_queue::destroy_storage_image(brx_pal_storage_image *storage_image)
+{
+    this->push(BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_STORAGE_IMAGE, storage_image);
+}
+
+void brx_pal_frame_deferred_destruction_queue::destroy_memory_heap(brx_pal_memory_heap *memory_heap)
+{
+    this->push(BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_MEMORY_HEAP, memory_heap);
+}
+
+void brx_pal_frame_deferred_destruction_queue::destroy_sampled_asset_image(brx_pal_sampled_asset_image *sampled_asset_image)
+{
+    this->push(BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_SAMPLED_ASSET_IMAGE, sampled_asset_image);
+}
+
+void brx_pal_frame_deferred_destruction_queue::destroy_sampler(brx_pal_sampler *sampler)
+{
+    this->push(BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_SAMPLER, sampler);
+}
+
+void brx_pal_frame_deferred_destruction_queue::destroy_scratch_buffer(brx_pal_scratch_buffer *scratch_buffer)
+{
+    this->push(BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_SCRATCH_BUFFER, scratch_buffer);
+}
+
+void brx_pal_frame_deferred_destruction_queue::destroy_intermediate_bottom_level_acceleration_structure(brx_pal_intermediate_bottom_level_acceleration_structure *intermediate_bottom_level_acceleration_structure)
+{
+    this->push(BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_INTERMEDIATE_BOTTOM_LEVEL_ACCELERATION_STRUCTURE, intermediate_bottom_level_acceleration_structure);
+}
+
+void brx_pal_frame_deferred_destruction_queue::destroy_non_compacted_bottom_level_acceleration_structure(brx_pal_non_compacted_bottom_level_acceleration_structure *non_compacted_bottom_level_acceleration_structure)
+{
+    this->push(BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_NON_COMPACTED_BOTTOM_LEVEL_ACCELERATION_STRUCTURE, non_compacted_bottom_level_acceleration_structure);
+}
+
+void brx_pal_frame_deferred_destruction_queue::destroy_compacted_bottom_level_acceleration_structure(brx_pal_compacted_bottom_level_acceleration_structure *compacted_bottom_level_acceleration_structure)
+{
+    this->push(BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_COMPACTED_BOTTOM_LEVEL_ACCELERATION_STRUCTURE, compacted_bottom_level_acceleration_structure);
+}
+
+void brx_pal_frame_deferred_destruction_queue::destroy_top_level_acceleration_structure_instance_upload_buffer(brx_pal_top_level_acceleration_structure_instance_upload_buffer *top_level_acceleration_structure_instance_upload_buffer)
+{
+    this->push(BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE_UPLOAD_BUFFER, top_level_acceleration_structure_instance_upload_buffer);
+}
+
+void brx_pal_frame_deferred_destruction_queue::destroy_top_level_acceleration_structure(brx_pal_top_level_acceleration_structure *top_level_acceleration_structure)
+{
+    this->push(BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_TOP_LEVEL_ACCELERATION_STRUCTURE, top_level_acceleration_structure);
+}
+
+void brx_pal_frame_deferred_destruction_queue::retire_frame()
+{
+    uint32_t const next_frame_throttling_index = (this->m_frame_throttling_index + 1U) % this->m_frame_throttling_count;
+
+    // release the oldest retire list before it becomes the current retire list
+    this->release(&this->m_retire_lists[next_frame_throttling_index]);
+
+    this->m_frame_throttling_index = next_frame_throttling_index;
+}
@@ -0,0 +1,94 @@
+//
+// Copyright (C) YuqiaoZhang(HanetakaChou)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#ifndef _BRX_PAL_DEFERRED_DESTRUCTION_QUEUE_H_
+#define _BRX_PAL_DEFERRED_DESTRUCTION_QUEUE_H_ 1
+
+#include "../include/brx_pal_device.h"
+#include "../../McRT-Malloc/include/mcrt_vector.h"
+
+enum BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE
+{
+    BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_DESCRIPTOR_SET = 1,
+    BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_GRAPHICS_PIPELINE = 2,
+    BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_COMPUTE_PIPELINE = 3,
+    BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_FRAME_BUFFER = 4,
+    BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_UNIFORM_UPLOAD_BUFFER = 5,
+    BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_STAGING_UPLOAD_BUFFER = 6,
+    BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_STORAGE_INTERMEDIATE_BUFFER = 7,
+    BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_STORAGE_ASSET_BUFFER = 8,
+    BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_COLOR_ATTACHMENT_IMAGE = 9,
+    BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_DEPTH_STENCIL_ATTACHMENT_IMAGE = 10,
+    BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_STORAGE_IMAGE = 11,
+    BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_MEMORY_HEAP = 12,
+    BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_SAMPLED_ASSET_IMAGE = 13,
+    BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_SAMPLER = 14,
+    BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_SCRATCH_BUFFER = 15,
+    BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_INTERMEDIATE_BOTTOM_LEVEL_ACCELERATION_STRUCTURE = 16,
+    BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_NON_COMPACTED_BOTTOM_LEVEL_ACCELERATION_STRUCTURE = 17,
+    BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_COMPACTED_BOTTOM_LEVEL_ACCELERATION_STRUCTURE = 18,
+    BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE_UPLOAD_BUFFER = 19,
+    BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE_TOP_LEVEL_ACCELERATION_STRUCTURE = 20
+};
+
+// the "object" is the pointer to the abstract object (e.g. "brx_pal_sampler *") of the "type"
+struct brx_pal_deferred_destruction_object
+{
+    BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE m_type;
+    void *m_object;
+};
+
+// the retire lists are indexed by the frame throttling index, and the retire list which is about to become the current retire list is released by the "retire_frame"
+class brx_pal_frame_deferred_destruction_queue final : public brx_pal_deferred_destruction_queue
+{
+    brx_pal_device *m_device;
+    uint32_t m_frame_throttling_count;
+    uint32_t m_frame_throttling_index;
+    mcrt_vector<mcrt_vector<brx_pal_deferred_destruction_object>> m_retire_lists;
+
+    void push(BRX_PAL_DEFERRED_DESTRUCTION_OBJECT_TYPE type, void *object);
+    void release(mcrt_vector<brx_pal_deferred_destruction_object> *retire_list);
+
+public:
+    brx_pal_frame_deferred_destruction_queue();
+    void init(brx_pal_device *device, uint32_t frame_throttling_count);
+    void uninit();
+    ~brx_pal_frame_deferred_destruction_queue();
+    void destroy_descriptor_set(brx_pal_descriptor_set *descriptor_set) override;
+    void destroy_graphics_pipeline(brx_pal_graphics_pipeline *graphics_pipeline) override;
+    void destroy_compute_pipeline(brx_pal_compute_pipeline *compute_pipeline) override;
+    void destroy_frame_buffer(brx_pal_frame_buffer *frame_buffer) override;
+    void destroy_uniform_upload_buffer(brx_pal_uniform_upload_buffer *uniform_upload_buffer) override;
+    void destroy_staging_upload_buffer(brx_pal_staging_upload_buffer *staging_upload_buffer) override;
+    void destroy_storage_intermediate_buffer(brx_pal_storage_intermediate_buffer *storage_intermediate_buffer) override;
+    void destroy_storage_asset_buffer(brx_pal_storage_asset_buffer *storage_asset_buffer) override;
+    void destroy_color_attachment_image(brx_pal_color_attachment_image *color_attachment_image) override;
+    void destroy_depth_stencil_attachment_image(brx_pal_depth_stencil_attachment_image *depth_stencil_attachment_image) override;
+    void destroy_storage_image(brx_pal_storage_image *storage_image) override;
+    void destroy_memory_heap(brx_pal_memory_heap *memory_heap) override;
+    void destroy_sampled_asset_image(brx_pal_sampled_asset_image *sampled_asset_image) override;
+    void destroy_sampler(brx_pal_sampler *sampler) override;
+    void destroy_scratch_buffer(brx_pal_scratch_buffer *scratch_buffer) override;
+    void destroy_intermediate_bottom_level_acceleration_structure(brx_pal_intermediate_bottom_level_acceleration_structure *intermediate_bottom_level_acceleration_structure) override;
+    void destroy_non_compacted_bottom_level_acceleration_structure(brx_pal_non_compacted_bottom_level_acceleration_structure *non_compacted_bottom_level_acceleration_structure) override;
+    void destroy_compacted_bottom_level_acceleration_structure(brx_pal_compacted_bottom_level_acceleration_structure *compacted_bottom_level_acceleration_structure) override;
+    void destroy_top_level_acceleration_structure_instance_upload_buffer(brx_pal_top_level_acceleration_structure_instance_upload_buffer *top_level_acceleration_structure_instance_upload_buffer) override;
+    void destroy_top_level_acceleration_structure(brx_pal_top_level_acceleration_structure *top_level_acceleration_structure) override;
+    void retire_frame() override;
+};
+
+#endif
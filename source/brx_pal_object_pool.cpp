@@ -0,0 +1,247 @@
+//
+// Copyright (C) YuqiaoZhang(HanetakaChou)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#include "brx_pal_object_pool.h"
+#include "../../McRT-Malloc/include/mcrt_malloc.h"
+#include <assert.h>
+#include <new>
+
+#define INTERNAL_OBJECT_POOL_INDEX_INVALID 0XFFFFFFFFU
+
+// 64 objects per slab and at most 8192 slabs (524288 objects) for each type, and the objects beyond the slab table are allocated individually
+static constexpr uint32_t const g_slab_object_count = 64U;
+static constexpr uint32_t const g_max_slab_count = 8192U;
+
+static inline uint64_t internal_make_list_head(uint32_t tag, uint32_t object_index)
+{
+    return ((static_cast<uint64_t>(tag) << 32U) | static_cast<uint64_t>(object_index));
+}
+
+static inline uint32_t internal_get_list_head_tag(uint64_t list_head)
+{
+    return static_cast<uint32_t>(list_head >> 32U);
+}
+
+static inline uint32_t internal_get_list_head_object_index(uint64_t list_head)
+{
+    return static_cast<uint32_t>(list_head & 0XFFFFFFFFU);
+}
+
+static inline uint32_t internal_align_up(uint32_t value, uint32_t alignment)
+{
+    return (((value - 1U) / alignment) + 1U) * alignment;
+}
+
+brx_pal_lock_free_object_pool::brx_pal_lock_free_object_pool()
+    : m_slot_size(0U),
+      m_slot_alignment(0U),
+      m_object_offset(0U),
+      m_bump_object_index(0U),
+      m_slabs(NULL),
+      m_free_list_head(internal_make_list_head(0U, INTERNAL_OBJECT_POOL_INDEX_INVALID)),
+      m_live_object_count(0U),
+      m_slab_count(0U)
+{
+}
+
+void brx_pal_lock_free_object_pool::init(uint32_t object_size, uint32_t object_alignment)
+{
+    assert(object_size > 0U);
+    assert((object_alignment > 0U) && (0U == (object_alignment & (object_alignment - 1U))));
+
+    uint32_t const slot_alignment = (object_alignment > alignof(brx_pal_object_pool_slot_header)) ? object_alignment : static_cast<uint32_t>(alignof(brx_pal_object_pool_slot_header));
+
+    assert(0U == this->m_slot_alignment);
+    this->m_slot_alignment = slot_alignment;
+
+    assert(0U == this->m_object_offset);
+    this->m_object_offset = internal_align_up(sizeof(brx_pal_object_pool_slot_header), slot_alignment);
+
+    assert(0U == this->m_slot_size);
+    this->m_slot_size = internal_align_up(this->m_object_offset + object_size, slot_alignment);
+
+    assert(NULL == this->m_slabs);
+    this->m_slabs = static_cast<std::atomic_uintptr_t *>(mcrt_malloc(sizeof(std::atomic_uintptr_t) * g_max_slab_count, alignof(std::atomic_uintptr_t)));
+    assert(NULL != this->m_slabs);
+
+    for (uint32_t slab_index = 0U; slab_index < g_max_slab_count; ++slab_index)
+    {
+        new (&this->m_slabs[slab_index]) std::atomic_uintptr_t{0U};
+    }
+}
+
+void brx_pal_lock_free_object_pool::uninit()
+{
+    // all objects should have been destroyed before the device
+    assert(0U == this->m_live_object_count.load());
+
+    assert(NULL != this->m_slabs);
+    for (uint32_t slab_index = 0U; slab_index < g_max_slab_count; ++slab_index)
+    {
+        void *const slab = reinterpret_cast<void *>(this->m_slabs[slab_index].load());
+        if (NULL != slab)
+        {
+            for (uint32_t slot_index = 0U; slot_index < g_slab_object_count; ++slot_index)
+            {
+                reinterpret_cast<brx_pal_object_pool_slot_header *>(static_cast<uint8_t *>(slab) + this->m_slot_size * slot_index)->~brx_pal_object_pool_slot_header();
+            }
+            mcrt_free(slab);
+        }
+
+        this->m_slabs[slab_index].~atomic();
+    }
+    mcrt_free(this->m_slabs);
+    this->m_slabs = NULL;
+
+    this->m_slab_count.store(0U);
+    this->m_free_list_head.store(internal_make_list_head(0U, INTERNAL_OBJECT_POOL_INDEX_INVALID));
+    this->m_bump_object_index.store(0U);
+    this->m_slot_size = 0U;
+    this->m_slot_alignment = 0U;
+    this->m_object_offset = 0U;
+}
+
+brx_pal_lock_free_object_pool::~brx_pal_lock_free_object_pool()
+{
+    assert(NULL == this->m_slabs);
+}
+
+brx_pal_object_pool_slot_header *brx_pal_lock_free_object_pool::get_slot_header(uint32_t object_index) const
+{
+    void *const slab = reinterpret_cast<void *>(this->m_slabs[object_index / g_slab_object_count].load());
+    assert(NULL != slab);
+
+    return reinterpret_cast<brx_pal_object_pool_slot_header *>(static_cast<uint8_t *>(slab) + this->m_slot_size * (object_index % g_slab_object_count));
+}
+
+void brx_pal_lock_free_object_pool::push(uint32_t object_index)
+{
+    brx_pal_object_pool_slot_header *const slot_header = this->get_slot_header(object_index);
+
+    uint64_t old_list_head = this->m_free_list_head.load();
+    uint64_t new_list_head;
+    do
+    {
+        slot_header->m_next_object_index.store(internal_get_list_head_object_index(old_list_head));
+        new_list_head = internal_make_list_head(internal_get_list_head_tag(old_list_head) + 1U, object_index);
+    } while (!this->m_free_list_head.compare_exchange_weak(old_list_head, new_list_head));
+}
+
+uint32_t brx_pal_lock_free_object_pool::pop()
+{
+    uint64_t old_list_head = this->m_free_list_head.load();
+    uint64_t new_list_head;
+    do
+    {
+        uint32_t const object_index = internal_get_list_head_object_index(old_list_head);
+        if (INTERNAL_OBJECT_POOL_INDEX_INVALID == object_index)
+        {
+            return INTERNAL_OBJECT_POOL_INDEX_INVALID;
+        }
+
+        // the tag prevents the CAS from succeeding when the "next" has been changed by the other threads (ABA)
+        new_list_head = internal_make_list_head(internal_get_list_head_tag(old_list_head) + 1U, this->get_slot_header(object_index)->m_next_object_index.load());
+    } while (!this->m_free_list_head.compare_exchange_weak(old_list_head, new_list_head));
+
+    return internal_get_list_head_object_index(old_list_head);
+}
+
+void *brx_pal_lock_free_object_pool::allocate()
+{
+    // reuse the freed objects first
+    uint32_t object_index = this->pop();
+    if (INTERNAL_OBJECT_POOL_INDEX_INVALID == object_index)
+    {
+        // the bump index never exceeds the capacity of the slab table, and the object is allocated by the "mcrt_malloc" when the slab table is exhausted (the invalid object index marks the slot which is NOT in any slab)
+        object_index = this->m_bump_object_index.load();
+        do
+        {
+            if (object_index >= (g_slab_object_count * g_max_slab_count))
+            {
+                void *const new_slot = mcrt_malloc(this->m_slot_size, this->m_slot_alignment);
+                assert(NULL != new_slot);
+
+                brx_pal_object_pool_slot_header *const new_slot_header = new (new_slot) brx_pal_object_pool_slot_header{{INTERNAL_OBJECT_POOL_INDEX_INVALID}, INTERNAL_OBJECT_POOL_INDEX_INVALID};
+
+                this->m_live_object_count.fetch_add(1U);
+
+                return reinterpret_cast<uint8_t *>(new_slot_header) + this->m_object_offset;
+            }
+        } while (!this->m_bump_object_index.compare_exchange_weak(object_index, object_index + 1U));
+
+        uint32_t const slab_index = object_index / g_slab_object_count;
+        if (0U == this->m_slabs[slab_index].load())
+        {
+            // multiple threads may race to create the same slab, and only one of them is kept
+            void *const new_slab = mcrt_malloc(this->m_slot_size * g_slab_object_count, this->m_slot_alignment);
+            assert(NULL != new_slab);
+
+            for (uint32_t slot_index = 0U; slot_index < g_slab_object_count; ++slot_index)
+            {
+                new (static_cast<uint8_t *>(new_slab) + this->m_slot_size * slot_index) brx_pal_object_pool_slot_header{{INTERNAL_OBJECT_POOL_INDEX_INVALID}, slab_index * g_slab_object_count + slot_index};
+            }
+
+            uintptr_t expected_slab = 0U;
+            if (this->m_slabs[slab_index].compare_exchange_strong(expected_slab, reinterpret_cast<uintptr_t>(new_slab)))
+            {
+                this->m_slab_count.fetch_add(1U);
+            }
+            else
+            {
+                for (uint32_t slot_index = 0U; slot_index < g_slab_object_count; ++slot_index)
+                {
+                    reinterpret_cast<brx_pal_object_pool_slot_header *>(static_cast<uint8_t *>(new_slab) + this->m_slot_size * slot_index)->~brx_pal_object_pool_slot_header();
+                }
+                mcrt_free(new_slab);
+            }
+        }
+    }
+
+    this->m_live_object_count.fetch_add(1U);
+
+    brx_pal_object_pool_slot_header *const slot_header = this->get_slot_header(object_index);
+    assert(object_index == slot_header->m_object_index);
+    return reinterpret_cast<uint8_t *>(slot_header) + this->m_object_offset;
+}
+
+void brx_pal_lock_free_object_pool::free(void *object)
+{
+    assert(NULL != object);
+
+    brx_pal_object_pool_slot_header *const slot_header = reinterpret_cast<brx_pal_object_pool_slot_header *>(static_cast<uint8_t *>(object) - this->m_object_offset);
+
+    if (INTERNAL_OBJECT_POOL_INDEX_INVALID != slot_header->m_object_index)
+    {
+        assert(slot_header->m_object_index < this->m_bump_object_index.load());
+
+        this->push(slot_header->m_object_index);
+    }
+    else
+    {
+        slot_header->~brx_pal_object_pool_slot_header();
+        mcrt_free(slot_header);
+    }
+
+    assert(this->m_live_object_count.load() > 0U);
+    this->m_live_object_count.fetch_sub(1U);
+}
+
+void brx_pal_lock_free_object_pool::get_statistics(uint32_t *live_object_count, uint32_t *reserved_object_count) const
+{
+    (*live_object_count) = this->m_live_object_count.load();
+    (*reserved_object_count) = this->m_slab_count.load() * g_slab_object_count;
+}
@@ -0,0 +1,58 @@
+//
+// Copyright (C) YuqiaoZhang(HanetakaChou)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#ifndef _BRX_PAL_OBJECT_POOL_H_
+#define _BRX_PAL_OBJECT_POOL_H_ 1
+
+#include "../include/brx_pal_device.h"
+#include <atomic>
+
+// the header is in front of each object, and the "next" link of the free list is still valid after the object is freed
+struct brx_pal_object_pool_slot_header
+{
+    std::atomic_uint32_t m_next_object_index;
+    uint32_t m_object_index;
+};
+
+// Treiber stack of the object indices (the same as the "brx_pal_lock_free_descriptor_index_pool")
+// the objects are allocated from the slabs, and the slabs are never released until the object pool is destroyed (the slot header is always accessible)
+class brx_pal_lock_free_object_pool
+{
+    uint32_t m_slot_size;
+    uint32_t m_slot_alignment;
+    uint32_t m_object_offset;
+    std::atomic_uint32_t m_bump_object_index;
+    std::atomic_uintptr_t *m_slabs;
+    std::atomic_uint64_t m_free_list_head;
+    std::atomic_uint32_t m_live_object_count;
+    std::atomic_uint32_t m_slab_count;
+
+    brx_pal_object_pool_slot_header *get_slot_header(uint32_t object_index) const;
+    void push(uint32_t object_index);
+    uint32_t pop();
+
+public:
+    brx_pal_lock_free_object_pool();
+    void init(uint32_t object_size, uint32_t object_alignment);
+    void uninit();
+    ~brx_pal_lock_free_object_pool();
+    void *allocate();
+    void free(void *object);
+    void get_statistics(uint32_t *live_object_count, uint32_t *reserved_object_count) const;
+};
+
+#endif
@@ -0,0 +1,866 @@
+//
+// Copyright (C) YuqiaoZhang(HanetakaChou)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#include "brx_pal_render_graph.h"
+#include <assert.h>
+
+#define INTERNAL_RENDER_GRAPH_PASS_INDEX_INVALID 0XFFFFFFFFU
+#define INTERNAL_RENDER_GRAPH_MEMORY_HEAP_TYPE_COUNT 3U
+
+static inline BRX_PAL_MEMORY_HEAP_TYPE _internal_get_memory_heap_type(BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE resource_type);
+
+brx_pal_transient_render_graph::brx_pal_transient_render_graph()
+    : m_device(NULL),
+      m_frame_throttling_count(0U),
+      m_frame_throttling_index(0U)
+{
+}
+
+void brx_pal_transient_render_graph::init(brx_pal_device const *device, uint32_t frame_throttling_count)
+{
+    assert(NULL != device);
+    assert(frame_throttling_count > 0U);
+
+    assert(NULL == this->m_device);
+    this->m_device = device;
+
+    assert(0U == this->m_frame_throttling_count);
+    this->m_frame_throttling_count = frame_throttling_count;
+
+    assert(0U == this->m_frame_throttling_index);
+
+    assert(this->m_physical_resources.empty());
+    this->m_physical_resources.resize(frame_throttling_count);
+
+    assert(this->m_memory_heaps.empty());
+    this->m_memory_heaps.resize(frame_throttling_count);
+    for (mcrt_vector<brx_pal_render_graph_memory_heap> &memory_heaps : this->m_memory_heaps)
+    {
+        memory_heaps.assign(INTERNAL_RENDER_GRAPH_MEMORY_HEAP_TYPE_COUNT, brx_pal_render_graph_memory_heap{NULL, 0U});
+    }
+}
+
+void brx_pal_transient_render_graph::uninit()
+{
+    for (mcrt_vector<brx_pal_render_graph_physical_resource> &physical_resources : this->m_physical_resources)
+    {
+        for (brx_pal_render_graph_physical_resource &physical_resource : physical_resources)
+        {
+            this->destroy_physical_resource(&physical_resource);
+        }
+    }
+    this->m_physical_resources.clear();
+
+    for (mcrt_vector<brx_pal_render_graph_memory_heap> &memory_heaps : this->m_memory_heaps)
+    {
+        for (brx_pal_render_graph_memory_heap &memory_heap : memory_heaps)
+        {
+            if (NULL != memory_heap.m_memory_heap)
+            {
+                this->m_device->destroy_memory_heap(memory_heap.m_memory_heap);
+                memory_heap.m_memory_heap = NULL;
+                memory_heap.m_size = 0U;
+            }
+        }
+    }
+    this->m_memory_heaps.clear();
+
+    this->m_resources.clear();
+    this->m_passes.clear();
+    this->m_pass_color_attachments.clear();
+    this->m_pass_write_resources.clear();
+    this->m_pass_read_resources.clear();
+
+    this->m_frame_throttling_index = 0U;
+    this->m_frame_throttling_count = 0U;
+
+    assert(NULL != this->m_device);
+    this->m_device = NULL;
+}
+
+brx_pal_transient_render_graph::~brx_pal_transient_render_graph()
+{
+    assert(NULL == this->m_device);
+    assert(this->m_physical_resources.empty());
+    assert(this->m_memory_heaps.empty());
+}
+
+void brx_pal_transient_render_graph::begin_frame()
+{
+    this->m_resources.clear();
+    this->m_passes.clear();
+    this->m_pass_color_attachments.clear();
+    this->m_pass_write_resources.clear();
+    this->m_pass_read_resources.clear();
+}
+
+uint32_t brx_pal_transient_render_graph::add_resource(BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE type, uint32_t format, uint32_t width, uint32_t height)
+{
+    uint32_t const resource = static_cast<uint32_t>(this->m_resources.size());
+    assert(BRX_PAL_RENDER_GRAPH_RESOURCE_INVALID != resource);
+
+    this->m_resources.push_back(
+        brx_pal_render_graph_resource{
+            type,
+            format,
+            width,
+            height,
+            false,
+            BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT_STORE_OPERATION_DONT_CARE,
+            INTERNAL_RENDER_GRAPH_PASS_INDEX_INVALID,
+            false,
+            INTERNAL_RENDER_GRAPH_PASS_INDEX_INVALID,
+            false,
+            0U,
+            0U,
+            false,
+            NULL,
+            NULL,
+            NULL,
+            NULL});
+
+    return resource;
+}
+
+uint32_t brx_pal_transient_render_graph::create_transient_color_attachment_image(BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT color_attachment_image_format, uint32_t width, uint32_t height)
+{
+    return this->add_resource(BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_COLOR_ATTACHMENT_IMAGE, static_cast<uint32_t>(color_attachment_image_format), width, height);
+}
+
+uint32_t brx_pal_transient_render_graph::create_transient_depth_stencil_attachment_image(BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT depth_stencil_attachment_image_format, uint32_t width, uint32_t height)
+{
+    return this->add_resource(BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_DEPTH_STENCIL_ATTACHMENT_IMAGE, static_cast<uint32_t>(depth_stencil_attachment_image_format), width, height);
+}
+
+uint32_t brx_pal_transient_render_graph::create_transient_storage_image(BRX_PAL_STORAGE_IMAGE_FORMAT storage_image_format, uint32_t width, uint32_t height)
+{
+    return this->add_resource(BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_STORAGE_IMAGE, static_cast<uint32_t>(storage_image_format), width, height);
+}
+
+uint32_t brx_pal_transient_render_graph::create_transient_storage_buffer(uint32_t size)
+{
+    return this->add_resource(BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_STORAGE_BUFFER, 0U, size, 0U);
+}
+
+uint32_t brx_pal_transient_render_graph::import_color_attachment_image(brx_pal_color_attachment_image const *color_attachment_image, BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT_STORE_OPERATION store_operation)
+{
+    assert(NULL != color_attachment_image);
+    assert(BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT_STORE_OPERATION_DONT_CARE != store_operation);
+
+    uint32_t const resource = this->add_resource(BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_COLOR_ATTACHMENT_IMAGE, 0U, 0U, 0U);
+    this->m_resources[resource].m_imported = true;
+    this->m_resources[resource].m_imported_color_attachment_store_operation = store_operation;
+    this->m_resources[resource].m_color_attachment_image = color_attachment_image;
+    return resource;
+}
+
+uint32_t brx_pal_transient_render_graph::import_storage_image(brx_pal_storage_image const *storage_image)
+{
+    assert(NULL != storage_image);
+
+    uint32_t const resource = this->add_resource(BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_STORAGE_IMAGE, 0U, 0U, 0U);
+    this->m_resources[resource].m_imported = true;
+    this->m_resources[resource].m_storage_image = storage_image;
+    return resource;
+}
+
+uint32_t brx_pal_transient_render_graph::import_storage_buffer(brx_pal_storage_intermediate_buffer const *storage_intermediate_buffer)
+{
+    assert(NULL != storage_intermediate_buffer);
+
+    uint32_t const resource = this->add_resource(BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_STORAGE_BUFFER, 0U, 0U, 0U);
+    this->m_resources[resource].m_imported = true;
+    this->m_resources[resource].m_storage_buffer = storage_intermediate_buffer;
+    return resource;
+}
+
+void brx_pal_transient_render_graph::add_pass_write_resource(uint32_t pass_index, uint32_t write_resource)
+{
+    assert(write_resource < this->m_resources.size());
+
+    // each resource can only be written once
+    assert(INTERNAL_RENDER_GRAPH_PASS_INDEX_INVALID == this->m_resources[write_resource].m_write_pass_index);
+    this->m_resources[write_resource].m_write_pass_index = pass_index;
+
+    this->m_pass_write_resources.push_back(write_resource);
+}
+
+void brx_pal_transient_render_graph::add_pass_read_resources(uint32_t pass_index, uint32_t read_resource_count, uint32_t const *read_resources)
+{
+    assert((0U == read_resource_count) || (NULL != read_resources));
+
+    this->m_passes[pass_index].m_read_resource_begin = static_cast<uint32_t>(this->m_pass_read_resources.size());
+    this->m_passes[pass_index].m_read_resource_count = read_resource_count;
+
+    for (uint32_t read_resource_index = 0U; read_resource_index < read_resource_count; ++read_resource_index)
+    {
+        uint32_t const read_resource = read_resources[read_resource_index];
+        assert(read_resource < this->m_resources.size());
+
+        // the transient resource should be written by the previous pass
+        assert(this->m_resources[read_resource].m_imported || (this->m_resources[read_resource].m_write_pass_index < pass_index));
+
+        this->m_pass_read_resources.push_back(read_resource);
+    }
+}
+
+void brx_pal_transient_render_graph::add_rendering_pass(char const *pass_name, uint32_t width, uint32_t height, uint32_t color_attachment_count, BRX_PAL_RENDER_GRAPH_COLOR_ATTACHMENT const *color_attachments, BRX_PAL_RENDER_GRAPH_DEPTH_STENCIL_ATTACHMENT const *depth_stencil_attachment, uint32_t read_resource_count, uint32_t const *read_resources, brx_pal_render_graph_pass_execute_callback execute_callback, void *user_data)
+{
+    assert(this->m_device->is_dynamic_rendering_supported());
+    assert((0U == color_attachment_count) || (NULL != color_attachments));
+    assert(NULL != execute_callback);
+
+    uint32_t const pass_index = static_cast<uint32_t>(this->m_passes.size());
+
+    this->m_passes.push_back(
+        brx_pal_render_graph_pass{
+            pass_name,
+            true,
+            width,
+            height,
+            static_cast<uint32_t>(this->m_pass_color_attachments.size()),
+            color_attachment_count,
+            (NULL != depth_stencil_attachment),
+            (NULL != depth_stencil_attachment) ? (*depth_stencil_attachment) : BRX_PAL_RENDER_GRAPH_DEPTH_STENCIL_ATTACHMENT{BRX_PAL_RENDER_GRAPH_RESOURCE_INVALID, BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT_LOAD_OPERATION_DONT_CARE, 0.0F, 0U},
+            static_cast<uint32_t>(this->m_pass_write_resources.size()),
+            0U,
+            0U,
+            0U,
+            execute_callback,
+            user_data,
+            false});
+
+    for (uint32_t color_attachment_index = 0U; color_attachment_index < color_attachment_count; ++color_attachment_index)
+    {
+        assert(color_attachments[color_attachment_index].resource < this->m_resources.size());
+        assert(BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_COLOR_ATTACHMENT_IMAGE == this->m_resources[color_attachments[color_attachment_index].resource].m_type);
+
+        this->add_pass_write_resource(pass_index, color_attachments[color_attachment_index].resource);
+        this->m_pass_color_attachments.push_back(color_attachments[color_attachment_index]);
+    }
+
+    if (NULL != depth_stencil_attachment)
+    {
+        assert(depth_stencil_attachment->resource < this->m_resources.size());
+        assert(BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_DEPTH_STENCIL_ATTACHMENT_IMAGE == this->m_resources[depth_stencil_attachment->resource].m_type);
+
+        this->add_pass_write_resource(pass_index, depth_stencil_attachment->resource);
+    }
+
+    this->m_passes[pass_index].m_write_resource_count = static_cast<uint32_t>(this->m_pass_write_resources.size()) - this->m_passes[pass_index].m_write_resource_begin;
+
+    this->add_pass_read_resources(pass_index, read_resource_count, read_resources);
+}
+
+void brx_pal_transient_render_graph::add_compute_pass(char const *pass_name, uint32_t write_resource_count, uint32_t const *write_resources, uint32_t read_resource_count, uint32_t const *read_resources, brx_pal_render_graph_pass_execute_callback execute_callback, void *user_data)
+{
+    assert((0U == write_resource_count) || (NULL != write_resources));
+    assert(NULL != execute_callback);
+
+    uint32_t const pass_index = static_cast<uint32_t>(this->m_passes.size());
+
+    this->m_passes.push_back(
+        brx_pal_render_graph_pass{
+            pass_name,
+            false,
+            0U,
+            0U,
+            0U,
+            0U,
+            false,
+            BRX_PAL_RENDER_GRAPH_DEPTH_STENCIL_ATTACHMENT{BRX_PAL_RENDER_GRAPH_RESOURCE_INVALID, BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT_LOAD_OPERATION_DONT_CARE, 0.0F, 0U},
+            static_cast<uint32_t>(this->m_pass_write_resources.size()),
+            write_resource_count,
+            0U,
+            0U,
+            execute_callback,
+            user_data,
+            false});
+
+    for (uint32_t write_resource_index = 0U; write_resource_index < write_resource_count; ++write_resource_index)
+    {
+        assert(write_resources[write_resource_index] < this->m_resources.size());
+        assert((BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_STORAGE_IMAGE == this->m_resources[write_resources[write_resource_index]].m_type) || (BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_STORAGE_BUFFER == this->m_resources[write_resources[write_resource_index]].m_type));
+
+        this->add_pass_write_resource(pass_index, write_resources[write_resource_index]);
+    }
+
+    this->add_pass_read_resources(pass_index, read_resource_count, read_resources);
+}
+
+void brx_pal_transient_render_graph::cull_passes()
+{
+    for (brx_pal_render_graph_resource &resource : this->m_resources)
+    {
+        resource.m_read_by_live_pass = false;
+    }
+
+    // the readers are always after the writer, and the liveness of all readers is known when the writer is visited in the reverse order
+    for (uint32_t pass_index_plus_one = static_cast<uint32_t>(this->m_passes.size()); pass_index_plus_one > 0U; --pass_index_plus_one)
+    {
+        brx_pal_render_graph_pass &pass = this->m_passes[pass_index_plus_one - 1U];
+
+        // the pass without any output is assumed to have the side effect
+        bool live = (0U == pass.m_write_resource_count);
+        for (uint32_t write_resource_index = 0U; write_resource_index < pass.m_write_resource_count; ++write_resource_index)
+        {
+            brx_pal_render_graph_resource const &write_resource = this->m_resources[this->m_pass_write_resources[pass.m_write_resource_begin + write_resource_index]];
+            if (write_resource.m_imported || write_resource.m_read_by_live_pass)
+            {
+                live = true;
+                break;
+            }
+        }
+
+        pass.m_live = live;
+
+        if (live)
+        {
+            for (uint32_t read_resource_index = 0U; read_resource_index < pass.m_read_resource_count; ++read_resource_index)
+            {
+                this->m_resources[this->m_pass_read_resources[pass.m_read_resource_begin + read_resource_index]].m_read_by_live_pass = true;
+            }
+        }
+    }
+}
+
+void brx_pal_transient_render_graph::place_transient_resources()
+{
+    uint32_t const pass_count = static_cast<uint32_t>(this->m_passes.size());
+
+    // the passes are visited in the execution order, and the lifetime of the transient resource ends at the last live reader (or the writer itself when it is NOT read)
+    for (uint32_t pass_index = 0U; pass_index < pass_count; ++pass_index)
+    {
+        brx_pal_render_graph_pass const &pass = this->m_passes[pass_index];
+        if (!pass.m_live)
+        {
+            continue;
+        }
+
+        for (uint32_t write_resource_index = 0U; write_resource_index < pass.m_write_resource_count; ++write_resource_index)
+        {
+            this->m_resources[this->m_pass_write_resources[pass.m_write_resource_begin + write_resource_index]].m_last_pass_index = pass_index;
+        }
+
+        for (uint32_t read_resource_index = 0U; read_resource_index < pass.m_read_resource_count; ++read_resource_index)
+        {
+            this->m_resources[this->m_pass_read_resources[pass.m_read_resource_begin + read_resource_index]].m_last_pass_index = pass_index;
+        }
+    }
+
+    // the first fit in the order of the writers, and the memory range of the transient resource, whose lifetime has ended, is reused by the later ones
+    mcrt_vector<uint32_t> placed_resources;
+
+    for (uint32_t pass_index = 0U; pass_index < pass_count; ++pass_index)
+    {
+        brx_pal_render_graph_pass const &pass = this->m_passes[pass_index];
+        if (!pass.m_live)
+        {
+            continue;
+        }
+
+        for (uint32_t write_resource_index = 0U; write_resource_index < pass.m_write_resource_count; ++write_resource_index)
+        {
+            uint32_t const write_resource = this->m_pass_write_resources[pass.m_write_resource_begin + write_resource_index];
+            brx_pal_render_graph_resource &placed_write_resource = this->m_resources[write_resource];
+            if (placed_write_resource.m_imported)
+            {
+                continue;
+            }
+
+            // the attachment, which is never sampled, can be created as the transient attachment
+            placed_write_resource.m_allow_sampled_image = (BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_STORAGE_IMAGE == placed_write_resource.m_type) || ((BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_STORAGE_BUFFER != placed_write_resource.m_type) && placed_write_resource.m_read_by_live_pass);
+
+            uint32_t alignment;
+            switch (placed_write_resource.m_type)
+            {
+            case BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_COLOR_ATTACHMENT_IMAGE:
+                this->m_device->get_color_attachment_image_memory_requirements(static_cast<BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT>(placed_write_resource.m_format), placed_write_resource.m_width, placed_write_resource.m_height, placed_write_resource.m_allow_sampled_image, &placed_write_resource.m_memory_size, &alignment);
+                break;
+            case BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_DEPTH_STENCIL_ATTACHMENT_IMAGE:
+                this->m_device->get_depth_stencil_attachment_image_memory_requirements(static_cast<BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT>(placed_write_resource.m_format), placed_write_resource.m_width, placed_write_resource.m_height, placed_write_resource.m_allow_sampled_image, &placed_write_resource.m_memory_size, &alignment);
+                break;
+            case BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_STORAGE_IMAGE:
+                this->m_device->get_storage_image_memory_requirements(static_cast<BRX_PAL_STORAGE_IMAGE_FORMAT>(placed_write_resource.m_format), placed_write_resource.m_width, placed_write_resource.m_height, placed_write_resource.m_allow_sampled_image, &placed_write_resource.m_memory_size, &alignment);
+                break;
+            case BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_STORAGE_BUFFER:
+                this->m_device->get_storage_intermediate_buffer_memory_requirements(placed_write_resource.m_width, &placed_write_resource.m_memory_size, &alignment);
+                break;
+            default:
+                assert(false);
+                placed_write_resource.m_memory_size = 0U;
+                alignment = 1U;
+            }
+            assert(alignment > 0U);
+
+            BRX_PAL_MEMORY_HEAP_TYPE const memory_heap_type = _internal_get_memory_heap_type(placed_write_resource.m_type);
+
+            // the offset only increases when the memory range overlaps the placed resource which is still alive
+            uint32_t memory_heap_offset = 0U;
+            bool overlapped;
+            do
+            {
+                overlapped = false;
+                for (uint32_t const placed_resource : placed_resources)
+                {
+                    brx_pal_render_graph_resource const &placed_live_resource = this->m_resources[placed_resource];
+                    if ((_internal_get_memory_heap_type(placed_live_resource.m_type) == memory_heap_type) && (placed_live_resource.m_last_pass_index >= pass_index) && (memory_heap_offset < (placed_live_resource.m_memory_heap_offset + placed_live_resource.m_memory_size)) && (placed_live_resource.m_memory_heap_offset < (memory_heap_offset + placed_write_resource.m_memory_size)))
+                    {
+                        memory_heap_offset = ((placed_live_resource.m_memory_heap_offset + placed_live_resource.m_memory_size + alignment - 1U) / alignment) * alignment;
+                        overlapped = true;
+                        break;
+                    }
+                }
+            } while (overlapped);
+
+            placed_write_resource.m_memory_heap_offset = memory_heap_offset;
+
+            placed_resources.push_back(write_resource);
+        }
+    }
+
+    // the aliasing barrier is required when another transient resource is placed in the same memory range (either used before in the current frame, or last used by the previous frame with the same frame throttling index)
+    for (uint32_t const placed_resource : placed_resources)
+    {
+        brx_pal_render_graph_resource &placed_aliased_resource = this->m_resources[placed_resource];
+
+        for (uint32_t const other_placed_resource : placed_resources)
+        {
+            brx_pal_render_graph_resource const &placed_other_resource = this->m_resources[other_placed_resource];
+            if ((other_placed_resource != placed_resource) && (_internal_get_memory_heap_type(placed_other_resource.m_type) == _internal_get_memory_heap_type(placed_aliased_resource.m_type)) && (placed_aliased_resource.m_memory_heap_offset < (placed_other_resource.m_memory_heap_offset + placed_other_resource.m_memory_size)) && (placed_other_resource.m_memory_heap_offset < (placed_aliased_resource.m_memory_heap_offset + placed_aliased_resource.m_memory_size)))
+            {
+                placed_aliased_resource.m_aliased = true;
+                break;
+            }
+        }
+    }
+}
+
+void brx_pal_transient_render_graph::allocate_physical_resources()
+{
+    this->place_transient_resources();
+
+    uint32_t const pass_count = static_cast<uint32_t>(this->m_passes.size());
+
+    // the physical resources and the memory heaps of the current frame throttling index are no longer used by the GPU
+    mcrt_vector<brx_pal_render_graph_physical_resource> &physical_resources = this->m_physical_resources[this->m_frame_throttling_index];
+    mcrt_vector<brx_pal_render_graph_memory_heap> &memory_heaps = this->m_memory_heaps[this->m_frame_throttling_index];
+
+    for (brx_pal_render_graph_physical_resource &physical_resource : physical_resources)
+    {
+        physical_resource.m_used_by_current_frame = false;
+    }
+
+    uint32_t memory_heap_sizes[INTERNAL_RENDER_GRAPH_MEMORY_HEAP_TYPE_COUNT] = {0U, 0U, 0U};
+    for (brx_pal_render_graph_resource const &resource : this->m_resources)
+    {
+        if ((!resource.m_imported) && (INTERNAL_RENDER_GRAPH_PASS_INDEX_INVALID != resource.m_last_pass_index))
+        {
+            uint32_t &memory_heap_size = memory_heap_sizes[_internal_get_memory_heap_type(resource.m_type) - 1U];
+            memory_heap_size = ((resource.m_memory_heap_offset + resource.m_memory_size) > memory_heap_size) ? (resource.m_memory_heap_offset + resource.m_memory_size) : memory_heap_size;
+        }
+    }
+
+    // the memory heap is only recreated when it is too small (e.g. the size of the swap chain has been increased), and the placed resources should be destroyed before the memory heap
+    for (uint32_t memory_heap_index = 0U; memory_heap_index < INTERNAL_RENDER_GRAPH_MEMORY_HEAP_TYPE_COUNT; ++memory_heap_index)
+    {
+        brx_pal_render_graph_memory_heap &memory_heap = memory_heaps[memory_heap_index];
+        if (memory_heap_sizes[memory_heap_index] > memory_heap.m_size)
+        {
+            BRX_PAL_MEMORY_HEAP_TYPE const memory_heap_type = static_cast<BRX_PAL_MEMORY_HEAP_TYPE>(memory_heap_index + 1U);
+
+            uint32_t kept_physical_resource_count = 0U;
+            for (uint32_t physical_resource_index = 0U; physical_resource_index < physical_resources.size(); ++physical_resource_index)
+            {
+                if (_internal_get_memory_heap_type(physical_resources[physical_resource_index].m_type) != memory_heap_type)
+                {
+                    physical_resources[kept_physical_resource_count] = physical_resources[physical_resource_index];
+                    ++kept_physical_resource_count;
+                }
+                else
+                {
+                    this->destroy_physical_resource(&physical_resources[physical_resource_index]);
+                }
+            }
+            physical_resources.resize(kept_physical_resource_count);
+
+            if (NULL != memory_heap.m_memory_heap)
+            {
+                this->m_device->destroy_memory_heap(memory_heap.m_memory_heap);
+            }
+
+            memory_heap.m_memory_heap = this->m_device->create_memory_heap(memory_heap_type, memory_heap_sizes[memory_heap_index]);
+            memory_heap.m_size = memory_heap_sizes[memory_heap_index];
+        }
+    }
+
+    // the placed resources are reused in the later frames by the transient resources with the same type, format, size and memory heap offset
+    for (uint32_t pass_index = 0U; pass_index < pass_count; ++pass_index)
+    {
+        brx_pal_render_graph_pass const &pass = this->m_passes[pass_index];
+        if (!pass.m_live)
+        {
+            continue;
+        }
+
+        for (uint32_t write_resource_index = 0U; write_resource_index < pass.m_write_resource_count; ++write_resource_index)
+        {
+            brx_pal_render_graph_resource &write_resource = this->m_resources[this->m_pass_write_resources[pass.m_write_resource_begin + write_resource_index]];
+            if (write_resource.m_imported)
+            {
+                continue;
+            }
+
+            uint32_t found_physical_resource_index = INTERNAL_RENDER_GRAPH_PASS_INDEX_INVALID;
+            for (uint32_t physical_resource_index = 0U; physical_resource_index < physical_resources.size(); ++physical_resource_index)
+            {
+                brx_pal_render_graph_physical_resource const &physical_resource = physical_resources[physical_resource_index];
+                if ((physical_resource.m_type == write_resource.m_type) && (physical_resource.m_format == write_resource.m_format) && (physical_resource.m_width == write_resource.m_width) && (physical_resource.m_height == write_resource.m_height) && (physical_resource.m_allow_sampled_image == write_resource.m_allow_sampled_image) && (physical_resource.m_memory_heap_offset == write_resource.m_memory_heap_offset) && (!physical_resource.m_used_by_current_frame))
+                {
+                    found_physical_resource_index = physical_resource_index;
+                    break;
+                }
+            }
+
+            if (INTERNAL_RENDER_GRAPH_PASS_INDEX_INVALID == found_physical_resource_index)
+            {
+                brx_pal_render_graph_physical_resource new_physical_resource = {
+                    write_resource.m_type,
+                    write_resource.m_format,
+                    write_resource.m_width,
+                    write_resource.m_height,
+                    write_resource.m_allow_sampled_image,
+                    write_resource.m_memory_heap_offset,
+                    NULL,
+                    NULL,
+                    NULL,
+                    NULL,
+                    false};
+
+                brx_pal_memory_heap const *const memory_heap = memory_heaps[_internal_get_memory_heap_type(write_resource.m_type) - 1U].m_memory_heap;
+                assert(NULL != memory_heap);
+
+                switch (write_resource.m_type)
+                {
+                case BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_COLOR_ATTACHMENT_IMAGE:
+                    new_physical_resource.m_color_attachment_image = this->m_device->create_placed_color_attachment_image(memory_heap, write_resource.m_memory_heap_offset, static_cast<BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT>(write_resource.m_format), write_resource.m_width, write_resource.m_height, write_resource.m_allow_sampled_image);
+                    break;
+                case BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_DEPTH_STENCIL_ATTACHMENT_IMAGE:
+                    new_physical_resource.m_depth_stencil_attachment_image = this->m_device->create_placed_depth_stencil_attachment_image(memory_heap, write_resource.m_memory_heap_offset, static_cast<BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT>(write_resource.m_format), write_resource.m_width, write_resource.m_height, write_resource.m_allow_sampled_image);
+                    break;
+                case BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_STORAGE_IMAGE:
+                    new_physical_resource.m_storage_image = this->m_device->create_placed_storage_image(memory_heap, write_resource.m_memory_heap_offset, static_cast<BRX_PAL_STORAGE_IMAGE_FORMAT>(write_resource.m_format), write_resource.m_width, write_resource.m_height, write_resource.m_allow_sampled_image);
+                    break;
+                case BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_STORAGE_BUFFER:
+                    new_physical_resource.m_storage_buffer = this->m_device->create_placed_storage_intermediate_buffer(memory_heap, write_resource.m_memory_heap_offset, write_resource.m_width);
+                    break;
+                default:
+                    assert(false);
+                }
+
+                found_physical_resource_index = static_cast<uint32_t>(physical_resources.size());
+                physical_resources.push_back(new_physical_resource);
+            }
+
+            brx_pal_render_graph_physical_resource &found_physical_resource = physical_resources[found_physical_resource_index];
+            found_physical_resource.m_used_by_current_frame = true;
+
+            write_resource.m_color_attachment_image = found_physical_resource.m_color_attachment_image;
+            write_resource.m_depth_stencil_attachment_image = found_physical_resource.m_depth_stencil_attachment_image;
+            write_resource.m_storage_image = found_physical_resource.m_storage_image;
+            write_resource.m_storage_buffer = found_physical_resource.m_storage_buffer;
+        }
+    }
+
+    // release the physical resources which are not used by the current frame (e.g. the size of the swap chain has been changed)
+    uint32_t kept_physical_resource_count = 0U;
+    for (uint32_t physical_resource_index = 0U; physical_resource_index < physical_resources.size(); ++physical_resource_index)
+    {
+        if (physical_resources[physical_resource_index].m_used_by_current_frame)
+        {
+            physical_resources[kept_physical_resource_count] = physical_resources[physical_resource_index];
+            ++kept_physical_resource_count;
+        }
+        else
+        {
+            this->destroy_physical_resource(&physical_resources[physical_resource_index]);
+        }
+    }
+    physical_resources.resize(kept_physical_resource_count);
+}
+
+void brx_pal_transient_render_graph::destroy_physical_resource(brx_pal_render_graph_physical_resource *physical_resource) const
+{
+    switch (physical_resource->m_type)
+    {
+    case BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_COLOR_ATTACHMENT_IMAGE:
+        this->m_device->destroy_color_attachment_image(physical_resource->m_color_attachment_image);
+        physical_resource->m_color_attachment_image = NULL;
+        break;
+    case BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_DEPTH_STENCIL_ATTACHMENT_IMAGE:
+        this->m_device->destroy_depth_stencil_attachment_image(physical_resource->m_depth_stencil_attachment_image);
+        physical_resource->m_depth_stencil_attachment_image = NULL;
+        break;
+    case BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_STORAGE_IMAGE:
+        this->m_device->destroy_storage_image(physical_resource->m_storage_image);
+        physical_resource->m_storage_image = NULL;
+        break;
+    case BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_STORAGE_BUFFER:
+        this->m_device->destroy_storage_intermediate_buffer(physical_resource->m_storage_buffer);
+        physical_resource->m_storage_buffer = NULL;
+        break;
+    default:
+        assert(false);
+    }
+}
+
+void brx_pal_transient_render_graph::execute(brx_pal_graphics_command_buffer *graphics_command_buffer)
+{
+    assert(NULL != graphics_command_buffer);
+    assert(this->m_frame_throttling_index < this->m_frame_throttling_count);
+
+    this->cull_passes();
+
+    this->allocate_physical_resources();
+
+    mcrt_vector<BRX_PAL_RENDERING_COLOR_ATTACHMENT> color_attachments;
+    mcrt_vector<brx_pal_color_attachment_image const *> aliased_color_attachment_images;
+    mcrt_vector<brx_pal_depth_stencil_attachment_image const *> aliased_depth_stencil_attachment_images;
+    mcrt_vector<brx_pal_storage_buffer const *> aliased_storage_buffers;
+    mcrt_vector<brx_pal_storage_image const *> aliased_storage_images;
+    mcrt_vector<brx_pal_storage_buffer const *> storage_buffers;
+    mcrt_vector<BRX_PAL_COMPUTE_PASS_STORAGE_BUFFER_LOAD_OPERATION> storage_buffer_load_operations;
+    mcrt_vector<BRX_PAL_COMPUTE_PASS_STORAGE_BUFFER_STORE_OPERATION> storage_buffer_store_operations;
+    mcrt_vector<brx_pal_storage_image const *> storage_images;
+    mcrt_vector<BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_LOAD_OPERATION> storage_image_load_operations;
+    mcrt_vector<BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_STORE_OPERATION> storage_image_store_operations;
+
+    for (brx_pal_render_graph_pass const &pass : this->m_passes)
+    {
+        if (!pass.m_live)
+        {
+            continue;
+        }
+
+        if (NULL != pass.m_name)
+        {
+            graphics_command_buffer->begin_debug_utils_label(pass.m_name);
+        }
+
+        if (pass.m_rendering)
+        {
+            // the attachment, which is NOT read by any live pass, is NOT flushed
+            color_attachments.clear();
+            aliased_color_attachment_images.clear();
+            aliased_depth_stencil_attachment_images.clear();
+            for (uint32_t color_attachment_index = 0U; color_attachment_index < pass.m_color_attachment_count; ++color_attachment_index)
+            {
+                BRX_PAL_RENDER_GRAPH_COLOR_ATTACHMENT const &color_attachment = this->m_pass_color_attachments[pass.m_color_attachment_begin + color_attachment_index];
+                brx_pal_render_graph_resource const &color_attachment_resource = this->m_resources[color_attachment.resource];
+
+                if (color_attachment_resource.m_aliased)
+                {
+                    aliased_color_attachment_images.push_back(color_attachment_resource.m_color_attachment_image);
+                }
+
+                BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT_STORE_OPERATION const store_operation = color_attachment_resource.m_imported ? color_attachment_resource.m_imported_color_attachment_store_operation : (color_attachment_resource.m_read_by_live_pass ? BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT_STORE_OPERATION_FLUSH_FOR_SAMPLED_IMAGE : BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT_STORE_OPERATION_DONT_CARE);
+
+                color_attachments.push_back(
+                    BRX_PAL_RENDERING_COLOR_ATTACHMENT{
+                        color_attachment_resource.m_color_attachment_image,
+                        NULL,
+                        color_attachment.load_operation,
+                        store_operation,
+                        {color_attachment.clear_value[0], color_attachment.clear_value[1], color_attachment.clear_value[2], color_attachment.clear_value[3]}});
+            }
+
+            BRX_PAL_RENDERING_DEPTH_STENCIL_ATTACHMENT depth_stencil_attachment;
+            if (pass.m_has_depth_stencil_attachment)
+            {
+                brx_pal_render_graph_resource const &depth_stencil_attachment_resource = this->m_resources[pass.m_depth_stencil_attachment.resource];
+
+                if (depth_stencil_attachment_resource.m_aliased)
+                {
+                    aliased_depth_stencil_attachment_images.push_back(depth_stencil_attachment_resource.m_depth_stencil_attachment_image);
+                }
+
+                depth_stencil_attachment = BRX_PAL_RENDERING_DEPTH_STENCIL_ATTACHMENT{
+                    depth_stencil_attachment_resource.m_depth_stencil_attachment_image,
+                    pass.m_depth_stencil_attachment.load_operation,
+                    depth_stencil_attachment_resource.m_read_by_live_pass ? BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT_STORE_OPERATION_FLUSH_FOR_SAMPLED_IMAGE : BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT_STORE_OPERATION_DONT_CARE,
+                    pass.m_depth_stencil_attachment.depth_clear_value,
+                    pass.m_depth_stencil_attachment.stencil_clear_value};
+            }
+
+            if ((!aliased_color_attachment_images.empty()) || (!aliased_depth_stencil_attachment_images.empty()))
+            {
+                graphics_command_buffer->aliasing_barrier(static_cast<uint32_t>(aliased_color_attachment_images.size()), aliased_color_attachment_images.data(), static_cast<uint32_t>(aliased_depth_stencil_attachment_images.size()), aliased_depth_stencil_attachment_images.data(), 0U, NULL, 0U, NULL);
+            }
+
+            graphics_command_buffer->begin_rendering(pass.m_width, pass.m_height, 1U, static_cast<uint32_t>(color_attachments.size()), color_attachments.data(), pass.m_has_depth_stencil_attachment ? &depth_stencil_attachment : NULL);
+
+            pass.m_execute_callback(graphics_command_buffer, this, pass.m_user_data);
+
+            graphics_command_buffer->end_rendering();
+        }
+        else
+        {
+            // all outputs of the compute pass are loaded and stored by one barrier respectively
+            storage_buffers.clear();
+            storage_images.clear();
+            aliased_storage_buffers.clear();
+            aliased_storage_images.clear();
+            for (uint32_t write_resource_index = 0U; write_resource_index < pass.m_write_resource_count; ++write_resource_index)
+            {
+                brx_pal_render_graph_resource const &write_resource = this->m_resources[this->m_pass_write_resources[pass.m_write_resource_begin + write_resource_index]];
+                if (BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_STORAGE_BUFFER == write_resource.m_type)
+                {
+                    storage_buffers.push_back(write_resource.m_storage_buffer->get_storage_buffer());
+
+                    if (write_resource.m_aliased)
+                    {
+                        aliased_storage_buffers.push_back(write_resource.m_storage_buffer->get_storage_buffer());
+                    }
+                }
+                else
+                {
+                    assert(BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_STORAGE_IMAGE == write_resource.m_type);
+                    storage_images.push_back(write_resource.m_storage_image);
+
+                    if (write_resource.m_aliased)
+                    {
+                        aliased_storage_images.push_back(write_resource.m_storage_image);
+                    }
+                }
+            }
+
+            storage_buffer_load_operations.assign(storage_buffers.size(), BRX_PAL_COMPUTE_PASS_STORAGE_BUFFER_LOAD_OPERATION_DONT_CARE);
+            storage_buffer_store_operations.assign(storage_buffers.size(), BRX_PAL_COMPUTE_PASS_STORAGE_BUFFER_STORE_OPERATION_FLUSH_FOR_READ_ONLY_STORAGE_BUFFER_AND_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BUFFER);
+            storage_image_load_operations.assign(storage_images.size(), BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_LOAD_OPERATION_DONT_CARE);
+            storage_image_store_operations.assign(storage_images.size(), BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_STORE_OPERATION_FLUSH_FOR_SAMPLED_IMAGE);
+
+            if ((!aliased_storage_buffers.empty()) || (!aliased_storage_images.empty()))
+            {
+                graphics_command_buffer->aliasing_barrier(0U, NULL, 0U, NULL, static_cast<uint32_t>(aliased_storage_buffers.size()), aliased_storage_buffers.data(), static_cast<uint32_t>(aliased_storage_images.size()), aliased_storage_images.data());
+            }
+
+            if (pass.m_write_resource_count > 0U)
+            {
+                graphics_command_buffer->compute_pass_load(static_cast<uint32_t>(storage_buffers.size()), storage_buffers.data(), storage_buffer_load_operations.data(), static_cast<uint32_t>(storage_images.size()), storage_images.data(), storage_image_load_operations.data());
+            }
+
+            pass.m_execute_callback(graphics_command_buffer, this, pass.m_user_data);
+
+            if (pass.m_write_resource_count > 0U)
+            {
+                graphics_command_buffer->compute_pass_store(static_cast<uint32_t>(storage_buffers.size()), storage_buffers.data(), storage_buffer_store_operations.data(), static_cast<uint32_t>(storage_images.size()), storage_images.data(), storage_image_store_operations.data());
+            }
+        }
+
+        if (NULL != pass.m_name)
+        {
+            graphics_command_buffer->end_debug_utils_label();
+        }
+    }
+
+    this->m_frame_throttling_index = (this->m_frame_throttling_index + 1U) % this->m_frame_throttling_count;
+}
+
+brx_pal_color_attachment_image const *brx_pal_transient_render_graph::get_color_attachment_image(uint32_t resource) const
+{
+    assert(resource < this->m_resources.size());
+    assert(BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_COLOR_ATTACHMENT_IMAGE == this->m_resources[resource].m_type);
+    assert(NULL != this->m_resources[resource].m_color_attachment_image);
+    return this->m_resources[resource].m_color_attachment_image;
+}
+
+brx_pal_depth_stencil_attachment_image const *brx_pal_transient_render_graph::get_depth_stencil_attachment_image(uint32_t resource) const
+{
+    assert(resource < this->m_resources.size());
+    assert(BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_DEPTH_STENCIL_ATTACHMENT_IMAGE == this->m_resources[resource].m_type);
+    assert(NULL != this->m_resources[resource].m_depth_stencil_attachment_image);
+    return this->m_resources[resource].m_depth_stencil_attachment_image;
+}
+
+brx_pal_storage_image const *brx_pal_transient_render_graph::get_storage_image(uint32_t resource) const
+{
+    assert(resource < this->m_resources.size());
+    assert(BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_STORAGE_IMAGE == this->m_resources[resource].m_type);
+    assert(NULL != this->m_resources[resource].m_storage_image);
+    return this->m_resources[resource].m_storage_image;
+}
+
+brx_pal_storage_buffer const *brx_pal_transient_render_graph::get_storage_buffer(uint32_t resource) const
+{
+    assert(resource < this->m_resources.size());
+    assert(BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_STORAGE_BUFFER == this->m_resources[resource].m_type);
+    assert(NULL != this->m_resources[resource].m_storage_buffer);
+    return this->m_resources[resource].m_storage_buffer->get_storage_buffer();
+}
+
+brx_pal_sampled_image const *brx_pal_transient_render_graph::get_sampled_image(uint32_t resource) const
+{
+    assert(resource < this->m_resources.size());
+    brx_pal_render_graph_resource const &sampled_image_resource = this->m_resources[resource];
+
+    brx_pal_sampled_image const *sampled_image;
+    switch (sampled_image_resource.m_type)
+    {
+    case BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_COLOR_ATTACHMENT_IMAGE:
+        assert(NULL != sampled_image_resource.m_color_attachment_image);
+        sampled_image = sampled_image_resource.m_color_attachment_image->get_sampled_image();
+        break;
+    case BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_DEPTH_STENCIL_ATTACHMENT_IMAGE:
+        assert(NULL != sampled_image_resource.m_depth_stencil_attachment_image);
+        sampled_image = sampled_image_resource.m_depth_stencil_attachment_image->get_sampled_image();
+        break;
+    case BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_STORAGE_IMAGE:
+        assert(NULL != sampled_image_resource.m_storage_image);
+        sampled_image = sampled_image_resource.m_storage_image->get_sampled_image();
+        break;
+    default:
+        assert(false);
+        sampled_image = NULL;
+    }
+
+    return sampled_image;
+}
+
+brx_pal_read_only_storage_buffer const *brx_pal_transient_render_graph::get_read_only_storage_buffer(uint32_t resource) const
+{
+    assert(resource < this->m_resources.size());
+    assert(BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_STORAGE_BUFFER == this->m_resources[resource].m_type);
+    assert(NULL != this->m_resources[resource].m_storage_buffer);
+    return this->m_resources[resource].m_storage_buffer->get_read_only_storage_buffer();
+}
+
+static inline BRX_PAL_MEMORY_HEAP_TYPE _internal_get_memory_heap_type(BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE resource_type)
+{
+    switch (resource_type)
+    {
+    case BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_COLOR_ATTACHMENT_IMAGE:
+    case BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_DEPTH_STENCIL_ATTACHMENT_IMAGE:
+        return BRX_PAL_MEMORY_HEAP_TYPE_ATTACHMENT_IMAGE;
+    case BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_STORAGE_IMAGE:
+        return BRX_PAL_MEMORY_HEAP_TYPE_STORAGE_IMAGE;
+    case BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_STORAGE_BUFFER:
+        return BRX_PAL_MEMORY_HEAP_TYPE_STORAGE_BUFFER;
+    default:
+        assert(false);
+        return BRX_PAL_MEMORY_HEAP_TYPE_STORAGE_BUFFER;
+    }
+}
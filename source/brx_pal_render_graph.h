@@ -0,0 +1,142 @@
+//
+// Copyright (C) YuqiaoZhang(HanetakaChou)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#ifndef _BRX_PAL_RENDER_GRAPH_H_
+#define _BRX_PAL_RENDER_GRAPH_H_ 1
+
+#include "../include/brx_pal_device.h"
+#include "../../McRT-Malloc/include/mcrt_vector.h"
+
+enum BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE
+{
+    BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_COLOR_ATTACHMENT_IMAGE = 1,
+    BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_DEPTH_STENCIL_ATTACHMENT_IMAGE = 2,
+    BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_STORAGE_IMAGE = 3,
+    BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE_STORAGE_BUFFER = 4
+};
+
+// the "format" is the color attachment image format, the depth stencil attachment image format or the storage image format, and the "width" is the size of the storage buffer
+struct brx_pal_render_graph_physical_resource
+{
+    BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE m_type;
+    uint32_t m_format;
+    uint32_t m_width;
+    uint32_t m_height;
+    bool m_allow_sampled_image;
+    uint32_t m_memory_heap_offset;
+    brx_pal_color_attachment_image *m_color_attachment_image;
+    brx_pal_depth_stencil_attachment_image *m_depth_stencil_attachment_image;
+    brx_pal_storage_image *m_storage_image;
+    brx_pal_storage_intermediate_buffer *m_storage_buffer;
+    bool m_used_by_current_frame;
+};
+
+struct brx_pal_render_graph_resource
+{
+    BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE m_type;
+    uint32_t m_format;
+    uint32_t m_width;
+    uint32_t m_height;
+    bool m_imported;
+    BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT_STORE_OPERATION m_imported_color_attachment_store_operation;
+    uint32_t m_write_pass_index;
+    bool m_read_by_live_pass;
+    uint32_t m_last_pass_index;
+    bool m_allow_sampled_image;
+    uint32_t m_memory_heap_offset;
+    uint32_t m_memory_size;
+    bool m_aliased;
+    brx_pal_color_attachment_image const *m_color_attachment_image;
+    brx_pal_depth_stencil_attachment_image const *m_depth_stencil_attachment_image;
+    brx_pal_storage_image const *m_storage_image;
+    brx_pal_storage_intermediate_buffer const *m_storage_buffer;
+};
+
+struct brx_pal_render_graph_memory_heap
+{
+    brx_pal_memory_heap *m_memory_heap;
+    uint32_t m_size;
+};
+
+struct brx_pal_render_graph_pass
+{
+    char const *m_name;
+    bool m_rendering;
+    uint32_t m_width;
+    uint32_t m_height;
+    uint32_t m_color_attachment_begin;
+    uint32_t m_color_attachment_count;
+    bool m_has_depth_stencil_attachment;
+    BRX_PAL_RENDER_GRAPH_DEPTH_STENCIL_ATTACHMENT m_depth_stencil_attachment;
+    uint32_t m_write_resource_begin;
+    uint32_t m_write_resource_count;
+    uint32_t m_read_resource_begin;
+    uint32_t m_read_resource_count;
+    brx_pal_render_graph_pass_execute_callback m_execute_callback;
+    void *m_user_data;
+    bool m_live;
+};
+
+// the resources are in the static single assignment form (each resource is written by exactly one pass), since the "load" of the storage images and attachments always discards the previous content
+// the passes are always executed in the order of the "add_*_pass", and a pass is culled when none of its outputs is read by the live passes or imported
+// the transient resources, whose lifetimes (from the writer to the last live reader) do NOT overlap, are placed in the same memory range, and each frame throttling index has its own memory heaps (indexed by the "BRX_PAL_MEMORY_HEAP_TYPE" minus one)
+class brx_pal_transient_render_graph final : public brx_pal_render_graph
+{
+    brx_pal_device const *m_device;
+    uint32_t m_frame_throttling_count;
+    uint32_t m_frame_throttling_index;
+    mcrt_vector<mcrt_vector<brx_pal_render_graph_physical_resource>> m_physical_resources;
+    mcrt_vector<mcrt_vector<brx_pal_render_graph_memory_heap>> m_memory_heaps;
+    mcrt_vector<brx_pal_render_graph_resource> m_resources;
+    mcrt_vector<brx_pal_render_graph_pass> m_passes;
+    mcrt_vector<BRX_PAL_RENDER_GRAPH_COLOR_ATTACHMENT> m_pass_color_attachments;
+    mcrt_vector<uint32_t> m_pass_write_resources;
+    mcrt_vector<uint32_t> m_pass_read_resources;
+
+    uint32_t add_resource(BRX_PAL_RENDER_GRAPH_RESOURCE_TYPE type, uint32_t format, uint32_t width, uint32_t height);
+    void add_pass_read_resources(uint32_t pass_index, uint32_t read_resource_count, uint32_t const *read_resources);
+    void add_pass_write_resource(uint32_t pass_index, uint32_t write_resource);
+    void cull_passes();
+    void place_transient_resources();
+    void allocate_physical_resources();
+    void destroy_physical_resource(brx_pal_render_graph_physical_resource *physical_resource) const;
+
+public:
+    brx_pal_transient_render_graph();
+    void init(brx_pal_device const *device, uint32_t frame_throttling_count);
+    void uninit();
+    ~brx_pal_transient_render_graph();
+    void begin_frame() override;
+    uint32_t create_transient_color_attachment_image(BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT color_attachment_image_format, uint32_t width, uint32_t height) override;
+    uint32_t create_transient_depth_stencil_attachment_image(BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT depth_stencil_attachment_image_format, uint32_t width, uint32_t height) override;
+    uint32_t create_transient_storage_image(BRX_PAL_STORAGE_IMAGE_FORMAT storage_image_format, uint32_t width, uint32_t height) override;
+    uint32_t create_transient_storage_buffer(uint32_t size) override;
+    uint32_t import_color_attachment_image(brx_pal_color_attachment_image const *color_attachment_image, BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT_STORE_OPERATION store_operation) override;
+    uint32_t import_storage_image(brx_pal_storage_image const *storage_image) override;
+    uint32_t import_storage_buffer(brx_pal_storage_intermediate_buffer const *storage_intermediate_buffer) override;
+    void add_rendering_pass(char const *pass_name, uint32_t width, uint32_t height, uint32_t color_attachment_count, BRX_PAL_RENDER_GRAPH_COLOR_ATTACHMENT const *color_attachments, BRX_PAL_RENDER_GRAPH_DEPTH_STENCIL_ATTACHMENT const *depth_stencil_attachment, uint32_t read_resource_count, uint32_t const *read_resources, brx_pal_render_graph_pass_execute_callback execute_callback, void *user_data) override;
+    void add_compute_pass(char const *pass_name, uint32_t write_resource_count, uint32_t const *write_resources, uint32_t read_resource_count, uint32_t const *read_resources, brx_pal_render_graph_pass_execute_callback execute_callback, void *user_data) override;
+    void execute(brx_pal_graphics_command_buffer *graphics_command_buffer) override;
+    brx_pal_color_attachment_image const *get_color_attachment_image(uint32_t resource) const override;
+    brx_pal_depth_stencil_attachment_image const *get_depth_stencil_attachment_image(uint32_t resource) const override;
+    brx_pal_storage_image const *get_storage_image(uint32_t resource) const override;
+    brx_pal_storage_buffer const *get_storage_buffer(uint32_t resource) const override;
+    brx_pal_sampled_image const *get_sampled_image(uint32_t resource) const override;
+    brx_pal_read_only_storage_buffer const *get_read_only_storage_buffer(uint32_t resource) const override;
+};
+
+#endif
@@ -0,0 +1,114 @@
+//
+// Copyright (C) YuqiaoZhang(HanetakaChou)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#ifndef _BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE_WRITER_H_
+#define _BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE_WRITER_H_ 1
+
+#include "../include/brx_pal_device.h"
+#include <stdint.h>
+#include <assert.h>
+
+#if defined(__GNUC__)
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#elif defined(__aarch64__) || defined(__arm__)
+#include <arm_neon.h>
+#else
+#error Unknown Architecture
+#endif
+#elif defined(_MSC_VER)
+#if defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#elif defined(_M_ARM64) || defined(_M_ARM)
+#include <arm64_neon.h>
+#else
+#error Unknown Architecture
+#endif
+#else
+#error Unknown Compiler
+#endif
+
+// the upload buffer is mapped as the write-combined memory, and the whole instance (one cache line) is written by the full-width non-temporal stores without reading back
+static inline void brx_pal_stream_top_level_acceleration_structure_instance(BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_DEVICE_INSTANCE *destination_instance, BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE const *source_instance, uint64_t bottom_level_acceleration_structure_device_memory_range_base)
+{
+    assert(source_instance->instance_id < 0X1000000U);
+
+    // the instance contribution to hit group index (instance shader binding table record offset) is always zero
+    uint32_t const instance_id_and_mask = (source_instance->instance_id & 0XFFFFFFU) | (static_cast<uint32_t>(source_instance->instance_mask) << 24U);
+    uint32_t const instance_contribution_to_hit_group_index_and_flags = ((source_instance->force_closest_hit ? static_cast<uint32_t>(BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE_FLAG_FORCE_OPAQUE) : 0U) | (source_instance->force_any_hit ? static_cast<uint32_t>(BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE_FLAG_FORCE_NON_OPAQUE) : 0U) | (source_instance->disable_back_face_cull ? static_cast<uint32_t>(BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE_FLAG_TRIANGLE_CULL_DISABLE) : 0U) | (source_instance->front_ccw ? static_cast<uint32_t>(BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE_FLAG_TRIANGLE_FRONT_COUNTERCLOCKWISE) : 0U)) << 24U;
+
+    // the instances in the upload buffer are at least 16-byte aligned (required by both Vulkan and Direct3D12)
+    assert(0U == (reinterpret_cast<uintptr_t>(destination_instance) & 15U));
+
+#if defined(__GNUC__)
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_stream_ps(&destination_instance->transform_matrix[0][0], _mm_loadu_ps(&source_instance->transform_matrix[0][0]));
+    _mm_stream_ps(&destination_instance->transform_matrix[1][0], _mm_loadu_ps(&source_instance->transform_matrix[1][0]));
+    _mm_stream_ps(&destination_instance->transform_matrix[2][0], _mm_loadu_ps(&source_instance->transform_matrix[2][0]));
+    _mm_stream_si128(reinterpret_cast<__m128i *>(&destination_instance->instance_id_and_mask), _mm_set_epi64x(static_cast<int64_t>(bottom_level_acceleration_structure_device_memory_range_base), static_cast<int64_t>((static_cast<uint64_t>(instance_contribution_to_hit_group_index_and_flags) << 32U) | static_cast<uint64_t>(instance_id_and_mask))));
+#elif defined(__aarch64__) || defined(__arm__)
+    vst1q_f32(&destination_instance->transform_matrix[0][0], vld1q_f32(&source_instance->transform_matrix[0][0]));
+    vst1q_f32(&destination_instance->transform_matrix[1][0], vld1q_f32(&source_instance->transform_matrix[1][0]));
+    vst1q_f32(&destination_instance->transform_matrix[2][0], vld1q_f32(&source_instance->transform_matrix[2][0]));
+    vst1q_u64(reinterpret_cast<uint64_t *>(&destination_instance->instance_id_and_mask), vcombine_u64(vcreate_u64((static_cast<uint64_t>(instance_contribution_to_hit_group_index_and_flags) << 32U) | static_cast<uint64_t>(instance_id_and_mask)), vcreate_u64(bottom_level_acceleration_structure_device_memory_range_base)));
+#else
+#error Unknown Architecture
+#endif
+#elif defined(_MSC_VER)
+#if defined(_M_X64) || defined(_M_IX86)
+    _mm_stream_ps(&destination_instance->transform_matrix[0][0], _mm_loadu_ps(&source_instance->transform_matrix[0][0]));
+    _mm_stream_ps(&destination_instance->transform_matrix[1][0], _mm_loadu_ps(&source_instance->transform_matrix[1][0]));
+    _mm_stream_ps(&destination_instance->transform_matrix[2][0], _mm_loadu_ps(&source_instance->transform_matrix[2][0]));
+    _mm_stream_si128(reinterpret_cast<__m128i *>(&destination_instance->instance_id_and_mask), _mm_set_epi64x(static_cast<int64_t>(bottom_level_acceleration_structure_device_memory_range_base), static_cast<int64_t>((static_cast<uint64_t>(instance_contribution_to_hit_group_index_and_flags) << 32U) | static_cast<uint64_t>(instance_id_and_mask))));
+#elif defined(_M_ARM64) || defined(_M_ARM)
+    vst1q_f32(&destination_instance->transform_matrix[0][0], vld1q_f32(&source_instance->transform_matrix[0][0]));
+    vst1q_f32(&destination_instance->transform_matrix[1][0], vld1q_f32(&source_instance->transform_matrix[1][0]));
+    vst1q_f32(&destination_instance->transform_matrix[2][0], vld1q_f32(&source_instance->transform_matrix[2][0]));
+    vst1q_u64(reinterpret_cast<uint64_t *>(&destination_instance->instance_id_and_mask), vcombine_u64(vcreate_u64((static_cast<uint64_t>(instance_contribution_to_hit_group_index_and_flags) << 32U) | static_cast<uint64_t>(instance_id_and_mask)), vcreate_u64(bottom_level_acceleration_structure_device_memory_range_base)));
+#else
+#error Unknown Architecture
+#endif
+#else
+#error Unknown Compiler
+#endif
+}
+
+// the non-temporal stores are weakly ordered, and should be visible before the upload buffer is used by the GPU
+static inline void brx_pal_stream_top_level_acceleration_structure_instance_fence()
+{
+#if defined(__GNUC__)
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_sfence();
+#elif defined(__aarch64__) || defined(__arm__)
+    // the regular stores are used
+#else
+#error Unknown Architecture
+#endif
+#elif defined(_MSC_VER)
+#if defined(_M_X64) || defined(_M_IX86)
+    _mm_sfence();
+#elif defined(_M_ARM64) || defined(_M_ARM)
+    // the regular stores are used
+#else
+#error Unknown Architecture
+#endif
+#else
+#error Unknown Compiler
+#endif
+}
+
+#endif
@@ -16,8 +16,11 @@
 //
 
 #include "brx_pal_vk_device.h"
+#include "brx_pal_top_level_acceleration_structure_instance_writer.h"
 #include <assert.h>
 
+static inline VkBufferCreateInfo _internal_get_storage_intermediate_buffer_create_info(bool support_ray_tracing, uint32_t size);
+
 brx_pal_vk_uniform_upload_buffer::brx_pal_vk_uniform_upload_buffer() : m_buffer(VK_NULL_HANDLE), m_allocation(VK_NULL_HANDLE), m_host_memory_range_base(NULL)
 {
 }
@@ -151,34 +154,33 @@ brx_pal_vk_storage_intermediate_buffer::brx_pal_vk_storage_intermediate_buffer()
 {
 }
 
-void brx_pal_vk_storage_intermediate_buffer::init(bool support_ray_tracing, VkDevice device, PFN_vkGetBufferDeviceAddressKHR pfn_get_buffer_device_address, VmaAllocator memory_allocator, VmaPool storage_intermediate_buffer_memory_pool, uint32_t size)
+void brx_pal_vk_storage_intermediate_buffer::init(bool support_ray_tracing, VkDevice device, PFN_vkGetBufferDeviceAddressKHR pfn_get_buffer_device_address, VmaAllocator memory_allocator, VmaPool storage_intermediate_buffer_memory_pool, VmaAllocation memory_heap_allocation, VkDeviceSize memory_heap_offset, uint32_t size)
 {
-    VkBufferUsageFlags const usage = (!support_ray_tracing) ? (VK_BUFFER_USAGE_STORAGE_BUFFER_BIT) : (VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT_KHR);
-
-    VkBufferCreateInfo const buffer_create_info = {
-        VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
-        NULL,
-        0U,
-        size,
-        usage,
-        VK_SHARING_MODE_EXCLUSIVE,
-        0U,
-        NULL};
-
-    VmaAllocationCreateInfo const allocation_create_info = {
-        0U,
-        VMA_MEMORY_USAGE_UNKNOWN,
-        0U,
-        0U,
-        0U,
-        storage_intermediate_buffer_memory_pool,
-        NULL,
-        1.0F};
+    VkBufferCreateInfo const buffer_create_info = _internal_get_storage_intermediate_buffer_create_info(support_ray_tracing, size);
 
     assert(VK_NULL_HANDLE == this->m_buffer);
     assert(VK_NULL_HANDLE == this->m_allocation);
-    VkResult const res_vma_create_buffer = vmaCreateBuffer(memory_allocator, &buffer_create_info, &allocation_create_info, &this->m_buffer, &this->m_allocation, NULL);
-    assert(VK_SUCCESS == res_vma_create_buffer);
+    if (VK_NULL_HANDLE == memory_heap_allocation)
+    {
+        VmaAllocationCreateInfo const allocation_create_info = {
+            0U,
+            VMA_MEMORY_USAGE_UNKNOWN,
+            0U,
+            0U,
+            0U,
+            storage_intermediate_buffer_memory_pool,
+            NULL,
+            1.0F};
+
+        VkResult const res_vma_create_buffer = vmaCreateBuffer(memory_allocator, &buffer_create_info, &allocation_create_info, &this->m_buffer, &this->m_allocation, NULL);
+        assert(VK_SUCCESS == res_vma_create_buffer);
+    }
+    else
+    {
+        // the placed buffer does NOT own the allocation
+        VkResult const res_vma_create_aliasing_buffer = vmaCreateAliasingBuffer2(memory_allocator, memory_heap_allocation, memory_heap_offset, &buffer_create_info, &this->m_buffer);
+        assert(VK_SUCCESS == res_vma_create_aliasing_buffer);
+    }
 
     assert(0U == this->m_device_memory_range_base);
     if (support_ray_tracing)
@@ -197,8 +199,8 @@ void brx_pal_vk_storage_intermediate_buffer::init(bool support_ray_tracing, VkDe
 void brx_pal_vk_storage_intermediate_buffer::uninit(VmaAllocator memory_allocator)
 {
     assert(VK_NULL_HANDLE != this->m_buffer);
-    assert(VK_NULL_HANDLE != this->m_allocation);
 
+    // only the buffer is destroyed if the allocation is NULL (placed in the memory heap)
     vmaDestroyBuffer(memory_allocator, this->m_buffer, this->m_allocation);
 
     this->m_buffer = VK_NULL_HANDLE;
@@ -211,6 +213,19 @@ brx_pal_vk_storage_intermediate_buffer::~brx_pal_vk_storage_intermediate_buffer(
     assert(VK_NULL_HANDLE == this->m_allocation);
 }
 
+void brx_pal_vk_storage_intermediate_buffer::get_memory_requirements(bool support_ray_tracing, VkDevice device, PFN_vkCreateBuffer pfn_create_buffer, PFN_vkGetBufferMemoryRequirements pfn_get_buffer_memory_requirements, PFN_vkDestroyBuffer pfn_destroy_buffer, VkAllocationCallbacks const *allocation_callbacks, uint32_t size, VkMemoryRequirements *out_memory_requirements)
+{
+    VkBufferCreateInfo const buffer_create_info = _internal_get_storage_intermediate_buffer_create_info(support_ray_tracing, size);
+
+    VkBuffer dummy_buf = VK_NULL_HANDLE;
+    VkResult const res_create_buffer = pfn_create_buffer(device, &buffer_create_info, allocation_callbacks, &dummy_buf);
+    assert(VK_SUCCESS == res_create_buffer);
+
+    pfn_get_buffer_memory_requirements(device, dummy_buf, out_memory_requirements);
+
+    pfn_destroy_buffer(device, dummy_buf, allocation_callbacks);
+}
+
 VkBuffer brx_pal_vk_storage_intermediate_buffer::get_buffer() const
 {
     return this->m_buffer;
@@ -247,7 +262,7 @@ brx_pal_vk_storage_asset_buffer::brx_pal_vk_storage_asset_buffer() : m_buffer(VK
 
 void brx_pal_vk_storage_asset_buffer::init(bool support_ray_tracing, VkDevice device, PFN_vkGetBufferDeviceAddressKHR pfn_get_buffer_device_address, VmaAllocator memory_allocator, VmaPool storage_asset_buffer_memory_pool, uint32_t size)
 {
-    VkBufferUsageFlags const usage = (!support_ray_tracing) ? (VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT) : (VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT_KHR);
+    VkBufferUsageFlags const usage = (!support_ray_tracing) ? (VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT) : (VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT_KHR);
 
     VkBufferCreateInfo const buffer_create_info = {
         VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
@@ -722,6 +737,123 @@ brx_pal_bottom_level_acceleration_structure const *brx_pal_vk_compacted_bottom_l
     return static_cast<brx_pal_bottom_level_acceleration_structure const *>(this);
 }
 
+brx_pal_vk_serialized_bottom_level_acceleration_structure_size_query_pool::brx_pal_vk_serialized_bottom_level_acceleration_structure_size_query_pool() : m_query_pool(VK_NULL_HANDLE)
+{
+}
+
+void brx_pal_vk_serialized_bottom_level_acceleration_structure_size_query_pool::init(VkDevice device, PFN_vkCreateQueryPool pfn_create_query_pool, VkAllocationCallbacks const *allocation_callbacks, uint32_t query_count)
+{
+    VkQueryPoolCreateInfo const query_pool_create_info =
+        {
+            VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+            NULL,
+            0U,
+            VK_QUERY_TYPE_ACCELERATION_STRUCTURE_SERIALIZATION_SIZE_KHR,
+            query_count};
+
+    assert(VK_NULL_HANDLE == this->m_query_pool);
+    VkResult const res_create_query_pool = pfn_create_query_pool(device, &query_pool_create_info, allocation_callbacks, &this->m_query_pool);
+    assert(VK_SUCCESS == res_create_query_pool);
+}
+
+void brx_pal_vk_serialized_bottom_level_acceleration_structure_size_query_pool::uninit(VkDevice device, PFN_vkDestroyQueryPool pfn_destroy_query_pool, VkAllocationCallbacks const *allocation_callbacks)
+{
+    assert(VK_NULL_HANDLE != this->m_query_pool);
+    pfn_destroy_query_pool(device, this->m_query_pool, allocation_callbacks);
+    this->m_query_pool = VK_NULL_HANDLE;
+}
+
+brx_pal_vk_serialized_bottom_level_acceleration_structure_size_query_pool::~brx_pal_vk_serialized_bottom_level_acceleration_structure_size_query_pool()
+{
+    assert(VK_NULL_HANDLE == this->m_query_pool);
+}
+
+VkQueryPool brx_pal_vk_serialized_bottom_level_acceleration_structure_size_query_pool::get_query_pool() const
+{
+    return this->m_query_pool;
+}
+
+brx_pal_vk_serialized_bottom_level_acceleration_structure_buffer::brx_pal_vk_serialized_bottom_level_acceleration_structure_buffer() : m_buffer(VK_NULL_HANDLE), m_allocation(VK_NULL_HANDLE), m_device_memory_range_base(0U), m_host_memory_range_base(NULL)
+{
+}
+
+void brx_pal_vk_serialized_bottom_level_acceleration_structure_buffer::init(VkDevice device, PFN_vkGetBufferDeviceAddressKHR pfn_get_buffer_device_address, VmaAllocator memory_allocator, VmaPool serialized_bottom_level_acceleration_structure_buffer_memory_pool, uint32_t size)
+{
+    static_assert(sizeof(BRX_PAL_SERIALIZED_BOTTOM_LEVEL_ACCELERATION_STRUCTURE_HEADER) == (2U * VK_UUID_SIZE + 3U * sizeof(uint64_t)), "");
+    assert(size >= sizeof(BRX_PAL_SERIALIZED_BOTTOM_LEVEL_ACCELERATION_STRUCTURE_HEADER));
+
+    VkBufferCreateInfo const buffer_create_info = {
+        VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+        NULL,
+        0U,
+        size,
+        VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT_KHR,
+        VK_SHARING_MODE_EXCLUSIVE,
+        0U,
+        NULL};
+
+    VmaAllocationCreateInfo const allocation_create_info = {
+        VMA_ALLOCATION_CREATE_MAPPED_BIT,
+        VMA_MEMORY_USAGE_UNKNOWN,
+        0U,
+        0U,
+        0U,
+        serialized_bottom_level_acceleration_structure_buffer_memory_pool,
+        NULL,
+        1.0F};
+
+    assert(VK_NULL_HANDLE == this->m_buffer);
+    assert(VK_NULL_HANDLE == this->m_allocation);
+    VmaAllocationInfo allocation_info;
+    VkResult const res_vma_create_buffer = vmaCreateBuffer(memory_allocator, &buffer_create_info, &allocation_create_info, &this->m_buffer, &this->m_allocation, &allocation_info);
+    assert(VK_SUCCESS == res_vma_create_buffer);
+
+    assert(0U == this->m_device_memory_range_base);
+    VkBufferDeviceAddressInfo const buffer_device_address_info = {
+        VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO,
+        NULL,
+        this->m_buffer};
+    this->m_device_memory_range_base = pfn_get_buffer_device_address(device, &buffer_device_address_info);
+    // NOTE: "VUID-vkCmdCopyAccelerationStructureToMemoryKHR-pInfo-03740" and "VUID-vkCmdCopyMemoryToAccelerationStructureKHR-pInfo-03742"
+    assert(0U == (this->m_device_memory_range_base % 256U));
+
+    assert(NULL != allocation_info.pMappedData);
+    assert(NULL == this->m_host_memory_range_base);
+    this->m_host_memory_range_base = allocation_info.pMappedData;
+}
+
+void brx_pal_vk_serialized_bottom_level_acceleration_structure_buffer::uninit(VmaAllocator memory_allocator)
+{
+    assert(VK_NULL_HANDLE != this->m_buffer);
+    assert(VK_NULL_HANDLE != this->m_allocation);
+
+    vmaDestroyBuffer(memory_allocator, this->m_buffer, this->m_allocation);
+
+    this->m_buffer = VK_NULL_HANDLE;
+    this->m_allocation = VK_NULL_HANDLE;
+}
+
+brx_pal_vk_serialized_bottom_level_acceleration_structure_buffer::~brx_pal_vk_serialized_bottom_level_acceleration_structure_buffer()
+{
+    assert(VK_NULL_HANDLE == this->m_buffer);
+    assert(VK_NULL_HANDLE == this->m_allocation);
+}
+
+VkBuffer brx_pal_vk_serialized_bottom_level_acceleration_structure_buffer::get_buffer() const
+{
+    return this->m_buffer;
+}
+
+VkDeviceAddress brx_pal_vk_serialized_bottom_level_acceleration_structure_buffer::get_device_memory_range_base() const
+{
+    return this->m_device_memory_range_base;
+}
+
+void *brx_pal_vk_serialized_bottom_level_acceleration_structure_buffer::get_host_memory_range_base() const
+{
+    return this->m_host_memory_range_base;
+}
+
 brx_pal_vk_top_level_acceleration_structure_instance_upload_buffer::brx_pal_vk_top_level_acceleration_structure_instance_upload_buffer() : m_buffer(VK_NULL_HANDLE), m_allocation(VK_NULL_HANDLE), m_device_memory_range_base(0U), m_host_memory_range_base(NULL)
 {
 }
@@ -787,28 +919,40 @@ brx_pal_vk_top_level_acceleration_structure_instance_upload_buffer::~brx_pal_vk_
 
 void brx_pal_vk_top_level_acceleration_structure_instance_upload_buffer::write_instance(uint32_t instance_index, BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE const *wrapped_bottom_top_acceleration_structure_instance)
 {
-    assert(wrapped_bottom_top_acceleration_structure_instance->instance_id < 0X1000000U);
-
-    brx_pal_vk_bottom_level_acceleration_structure const *const unwrapped_compacted_bottom_level_acceleration_structure = static_cast<brx_pal_vk_bottom_level_acceleration_structure const *>(wrapped_bottom_top_acceleration_structure_instance->bottom_level_acceleration_structure);
-    VkDeviceAddress const compacted_bottom_level_acceleration_structure_device_memory_range_base = unwrapped_compacted_bottom_level_acceleration_structure->get_device_memory_range_base();
-
-    this->m_host_memory_range_base[instance_index].transform.matrix[0][0] = wrapped_bottom_top_acceleration_structure_instance->transform_matrix[0][0];
-    this->m_host_memory_range_base[instance_index].transform.matrix[0][1] = wrapped_bottom_top_acceleration_structure_instance->transform_matrix[0][1];
-    this->m_host_memory_range_base[instance_index].transform.matrix[0][2] = wrapped_bottom_top_acceleration_structure_instance->transform_matrix[0][2];
-    this->m_host_memory_range_base[instance_index].transform.matrix[0][3] = wrapped_bottom_top_acceleration_structure_instance->transform_matrix[0][3];
-    this->m_host_memory_range_base[instance_index].transform.matrix[1][0] = wrapped_bottom_top_acceleration_structure_instance->transform_matrix[1][0];
-    this->m_host_memory_range_base[instance_index].transform.matrix[1][1] = wrapped_bottom_top_acceleration_structure_instance->transform_matrix[1][1];
-    this->m_host_memory_range_base[instance_index].transform.matrix[1][2] = wrapped_bottom_top_acceleration_structure_instance->transform_matrix[1][2];
-    this->m_host_memory_range_base[instance_index].transform.matrix[1][3] = wrapped_bottom_top_acceleration_structure_instance->transform_matrix[1][3];
-    this->m_host_memory_range_base[instance_index].transform.matrix[2][0] = wrapped_bottom_top_acceleration_structure_instance->transform_matrix[2][0];
-    this->m_host_memory_range_base[instance_index].transform.matrix[2][1] = wrapped_bottom_top_acceleration_structure_instance->transform_matrix[2][1];
-    this->m_host_memory_range_base[instance_index].transform.matrix[2][2] = wrapped_bottom_top_acceleration_structure_instance->transform_matrix[2][2];
-    this->m_host_memory_range_base[instance_index].transform.matrix[2][3] = wrapped_bottom_top_acceleration_structure_instance->transform_matrix[2][3];
-    this->m_host_memory_range_base[instance_index].instanceCustomIndex = wrapped_bottom_top_acceleration_structure_instance->instance_id;
-    this->m_host_memory_range_base[instance_index].mask = wrapped_bottom_top_acceleration_structure_instance->instance_mask;
-    this->m_host_memory_range_base[instance_index].instanceShaderBindingTableRecordOffset = 0U;
-    this->m_host_memory_range_base[instance_index].flags = (wrapped_bottom_top_acceleration_structure_instance->force_closest_hit ? VK_GEOMETRY_INSTANCE_FORCE_OPAQUE_BIT_KHR : 0U) | (wrapped_bottom_top_acceleration_structure_instance->force_any_hit ? VK_GEOMETRY_INSTANCE_FORCE_NO_OPAQUE_BIT_KHR : 0U) | (wrapped_bottom_top_acceleration_structure_instance->disable_back_face_cull ? VK_GEOMETRY_INSTANCE_TRIANGLE_FACING_CULL_DISABLE_BIT_KHR : 0U) | (wrapped_bottom_top_acceleration_structure_instance->front_ccw ? VK_GEOMETRY_INSTANCE_TRIANGLE_FLIP_FACING_BIT_KHR : 0U);
-    this->m_host_memory_range_base[instance_index].accelerationStructureReference = compacted_bottom_level_acceleration_structure_device_memory_range_base;
+    this->write_instances(instance_index, 1U, wrapped_bottom_top_acceleration_structure_instance);
+}
+
+void brx_pal_vk_top_level_acceleration_structure_instance_upload_buffer::write_instances(uint32_t first_instance_index, uint32_t instance_count, BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE const *wrapped_bottom_top_acceleration_structure_instances)
+{
+    static_assert(sizeof(VkAccelerationStructureInstanceKHR) == sizeof(BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_DEVICE_INSTANCE), "");
+    static_assert(static_cast<uint32_t>(BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE_FLAG_TRIANGLE_CULL_DISABLE) == static_cast<uint32_t>(VK_GEOMETRY_INSTANCE_TRIANGLE_FACING_CULL_DISABLE_BIT_KHR), "");
+    static_assert(static_cast<uint32_t>(BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE_FLAG_TRIANGLE_FRONT_COUNTERCLOCKWISE) == static_cast<uint32_t>(VK_GEOMETRY_INSTANCE_TRIANGLE_FLIP_FACING_BIT_KHR), "");
+    static_assert(static_cast<uint32_t>(BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE_FLAG_FORCE_OPAQUE) == static_cast<uint32_t>(VK_GEOMETRY_INSTANCE_FORCE_OPAQUE_BIT_KHR), "");
+    static_assert(static_cast<uint32_t>(BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE_FLAG_FORCE_NON_OPAQUE) == static_cast<uint32_t>(VK_GEOMETRY_INSTANCE_FORCE_NO_OPAQUE_BIT_KHR), "");
+
+    assert((NULL != wrapped_bottom_top_acceleration_structure_instances) || (0U == instance_count));
+
+    BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_DEVICE_INSTANCE *const destination_instances = reinterpret_cast<BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_DEVICE_INSTANCE *>(this->m_host_memory_range_base + first_instance_index);
+
+    // the consecutive instances usually share the same bottom level acceleration structure, and the device memory range base is NOT queried again
+    brx_pal_bottom_level_acceleration_structure const *cached_bottom_level_acceleration_structure = NULL;
+    VkDeviceAddress cached_bottom_level_acceleration_structure_device_memory_range_base = 0U;
+
+    for (uint32_t instance_index = 0U; instance_index < instance_count; ++instance_index)
+    {
+        brx_pal_bottom_level_acceleration_structure const *const wrapped_bottom_level_acceleration_structure = wrapped_bottom_top_acceleration_structure_instances[instance_index].bottom_level_acceleration_structure;
+        if (cached_bottom_level_acceleration_structure != wrapped_bottom_level_acceleration_structure)
+        {
+            assert(NULL != wrapped_bottom_level_acceleration_structure);
+            brx_pal_vk_bottom_level_acceleration_structure const *const unwrapped_bottom_level_acceleration_structure = static_cast<brx_pal_vk_bottom_level_acceleration_structure const *>(wrapped_bottom_level_acceleration_structure);
+            cached_bottom_level_acceleration_structure = wrapped_bottom_level_acceleration_structure;
+            cached_bottom_level_acceleration_structure_device_memory_range_base = unwrapped_bottom_level_acceleration_structure->get_device_memory_range_base();
+        }
+
+        brx_pal_stream_top_level_acceleration_structure_instance(destination_instances + instance_index, wrapped_bottom_top_acceleration_structure_instances + instance_index, cached_bottom_level_acceleration_structure_device_memory_range_base);
+    }
+
+    brx_pal_stream_top_level_acceleration_structure_instance_fence();
 }
 
 VkBuffer brx_pal_vk_top_level_acceleration_structure_instance_upload_buffer::get_buffer() const
@@ -910,3 +1054,20 @@ uint32_t brx_pal_vk_top_level_acceleration_structure::get_instance_count() const
 {
     return this->m_instance_count;
 }
+
+static inline VkBufferCreateInfo _internal_get_storage_intermediate_buffer_create_info(bool support_ray_tracing, uint32_t size)
+{
+    // TRANSFER_SRC and TRANSFER_DST: "copy_buffer" and "fill_buffer" of the graphics command buffer
+    // INDIRECT_BUFFER: "draw_mesh_tasks_indirect" and "draw_mesh_tasks_indirect_count" of the graphics command buffer
+    VkBufferUsageFlags const usage = (!support_ray_tracing) ? (VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT) : (VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT_KHR);
+
+    return VkBufferCreateInfo{
+        VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+        NULL,
+        0U,
+        size,
+        usage,
+        VK_SHARING_MODE_EXCLUSIVE,
+        0U,
+        NULL};
+}
@@ -33,26 +33,56 @@ brx_pal_vk_graphics_command_buffer::brx_pal_vk_graphics_command_buffer()
       m_pfn_cmd_bind_pipeline(NULL),
       m_pfn_cmd_set_view_port(NULL),
       m_pfn_cmd_set_scissor(NULL),
+      m_pfn_cmd_set_cull_mode(NULL),
+      m_pfn_cmd_set_front_face(NULL),
+      m_pfn_cmd_set_depth_test_enable(NULL),
+      m_pfn_cmd_set_depth_compare_op(NULL),
+      m_pfn_cmd_set_color_blend_enable(NULL),
+      m_pfn_cmd_set_color_blend_equation(NULL),
       m_pfn_cmd_bind_descriptor_sets(NULL),
+      m_pfn_cmd_push_constants(NULL),
       m_pfn_cmd_bind_vertex_buffers(NULL),
       m_pfn_cmd_bind_index_buffer(NULL),
       m_pfn_cmd_draw(NULL),
       m_pfn_cmd_draw_indexed(NULL),
+      m_pfn_cmd_draw_mesh_tasks(NULL),
+      m_pfn_cmd_draw_mesh_tasks_indirect(NULL),
+      m_pfn_cmd_draw_mesh_tasks_indirect_count(NULL),
       m_pfn_cmd_end_render_pass(NULL),
+      m_pfn_cmd_begin_rendering(NULL),
+      m_pfn_cmd_end_rendering(NULL),
       m_pfn_cmd_dispatch(NULL),
+      m_pfn_cmd_copy_buffer(NULL),
+      m_pfn_cmd_copy_image(NULL),
+      m_pfn_cmd_fill_buffer(NULL),
+      m_pfn_cmd_clear_color_image(NULL),
       m_pfn_cmd_build_acceleration_structure(NULL),
-      m_pfn_end_command_buffer(NULL)
+      m_pfn_end_command_buffer(NULL),
+      m_end_rendering_destination_stage_mask(0U),
+      m_color_attachment_count(0U),
+      m_current_vertex_binding_count(0U),
+      m_aliasing_source_stage_mask(0U),
+      m_aliasing_source_access_mask(0U)
 {
 }
 
-void brx_pal_vk_graphics_command_buffer::init(bool support_ray_tracing, bool has_dedicated_upload_queue, uint32_t graphics_queue_family_index, uint32_t upload_queue_family_index, PFN_vkGetInstanceProcAddr pfn_get_instance_proc_addr, VkInstance instance, PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+void brx_pal_vk_graphics_command_buffer::init(bool support_ray_tracing, bool support_dynamic_rendering, bool support_extended_dynamic_state, bool support_mesh_shader, bool has_dedicated_upload_queue, uint32_t graphics_queue_family_index, uint32_t upload_queue_family_index, bool has_dedicated_compute_queue, uint32_t compute_queue_family_index, PFN_vkGetInstanceProcAddr pfn_get_instance_proc_addr, VkInstance instance, PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
 {
     this->m_support_ray_tracing = support_ray_tracing;
 
+    this->m_support_dynamic_rendering = support_dynamic_rendering;
+
+    this->m_support_extended_dynamic_state = support_extended_dynamic_state;
+
+    this->m_support_mesh_shader = support_mesh_shader;
+
     this->m_has_dedicated_upload_queue = has_dedicated_upload_queue;
     this->m_graphics_queue_family_index = graphics_queue_family_index;
     this->m_upload_queue_family_index = upload_queue_family_index;
 
+    this->m_has_dedicated_compute_queue = has_dedicated_compute_queue;
+    this->m_compute_queue_family_index = compute_queue_family_index;
+
     PFN_vkCreateCommandPool const pfn_create_command_pool = reinterpret_cast<PFN_vkCreateCommandPool>(pfn_get_device_proc_addr(device, "vkCreateCommandPool"));
     assert(NULL != pfn_create_command_pool);
     PFN_vkAllocateCommandBuffers const pfn_allocate_command_buffers = reinterpret_cast<PFN_vkAllocateCommandBuffers>(pfn_get_device_proc_addr(device, "vkAllocateCommandBuffers"));
@@ -113,8 +143,25 @@ void brx_pal_vk_graphics_command_buffer::init(bool support_ray_tracing, bool has
     this->m_pfn_cmd_set_view_port = reinterpret_cast<PFN_vkCmdSetViewport>(pfn_get_device_proc_addr(device, "vkCmdSetViewport"));
     assert(NULL == this->m_pfn_cmd_set_scissor);
     this->m_pfn_cmd_set_scissor = reinterpret_cast<PFN_vkCmdSetScissor>(pfn_get_device_proc_addr(device, "vkCmdSetScissor"));
+    assert(NULL == this->m_pfn_cmd_set_cull_mode);
+    assert(NULL == this->m_pfn_cmd_set_front_face);
+    assert(NULL == this->m_pfn_cmd_set_depth_test_enable);
+    assert(NULL == this->m_pfn_cmd_set_depth_compare_op);
+    assert(NULL == this->m_pfn_cmd_set_color_blend_enable);
+    assert(NULL == this->m_pfn_cmd_set_color_blend_equation);
+    if (this->m_support_extended_dynamic_state)
+    {
+        this->m_pfn_cmd_set_cull_mode = reinterpret_cast<PFN_vkCmdSetCullModeEXT>(pfn_get_device_proc_addr(device, "vkCmdSetCullModeEXT"));
+        this->m_pfn_cmd_set_front_face = reinterpret_cast<PFN_vkCmdSetFrontFaceEXT>(pfn_get_device_proc_addr(device, "vkCmdSetFrontFaceEXT"));
+        this->m_pfn_cmd_set_depth_test_enable = reinterpret_cast<PFN_vkCmdSetDepthTestEnableEXT>(pfn_get_device_proc_addr(device, "vkCmdSetDepthTestEnableEXT"));
+        this->m_pfn_cmd_set_depth_compare_op = reinterpret_cast<PFN_vkCmdSetDepthCompareOpEXT>(pfn_get_device_proc_addr(device, "vkCmdSetDepthCompareOpEXT"));
+        this->m_pfn_cmd_set_color_blend_enable = reinterpret_cast<PFN_vkCmdSetColorBlendEnableEXT>(pfn_get_device_proc_addr(device, "vkCmdSetColorBlendEnableEXT"));
+        this->m_pfn_cmd_set_color_blend_equation = reinterpret_cast<PFN_vkCmdSetColorBlendEquationEXT>(pfn_get_device_proc_addr(device, "vkCmdSetColorBlendEquationEXT"));
+    }
     assert(NULL == this->m_pfn_cmd_bind_descriptor_sets);
     this->m_pfn_cmd_bind_descriptor_sets = reinterpret_cast<PFN_vkCmdBindDescriptorSets>(pfn_get_device_proc_addr(device, "vkCmdBindDescriptorSets"));
+    assert(NULL == this->m_pfn_cmd_push_constants);
+    this->m_pfn_cmd_push_constants = reinterpret_cast<PFN_vkCmdPushConstants>(pfn_get_device_proc_addr(device, "vkCmdPushConstants"));
     assert(NULL == this->m_pfn_cmd_bind_vertex_buffers);
     this->m_pfn_cmd_bind_vertex_buffers = reinterpret_cast<PFN_vkCmdBindVertexBuffers>(pfn_get_device_proc_addr(device, "vkCmdBindVertexBuffers"));
     assert(NULL == this->m_pfn_cmd_bind_index_buffer);
@@ -123,10 +170,34 @@ void brx_pal_vk_graphics_command_buffer::init(bool support_ray_tracing, bool has
     this->m_pfn_cmd_draw = reinterpret_cast<PFN_vkCmdDraw>(pfn_get_device_proc_addr(device, "vkCmdDraw"));
     assert(NULL == this->m_pfn_cmd_draw_indexed);
     this->m_pfn_cmd_draw_indexed = reinterpret_cast<PFN_vkCmdDrawIndexed>(pfn_get_device_proc_addr(device, "vkCmdDrawIndexed"));
+    assert(NULL == this->m_pfn_cmd_draw_mesh_tasks);
+    assert(NULL == this->m_pfn_cmd_draw_mesh_tasks_indirect);
+    assert(NULL == this->m_pfn_cmd_draw_mesh_tasks_indirect_count);
+    if (this->m_support_mesh_shader)
+    {
+        this->m_pfn_cmd_draw_mesh_tasks = reinterpret_cast<PFN_vkCmdDrawMeshTasksEXT>(pfn_get_device_proc_addr(device, "vkCmdDrawMeshTasksEXT"));
+        this->m_pfn_cmd_draw_mesh_tasks_indirect = reinterpret_cast<PFN_vkCmdDrawMeshTasksIndirectEXT>(pfn_get_device_proc_addr(device, "vkCmdDrawMeshTasksIndirectEXT"));
+        this->m_pfn_cmd_draw_mesh_tasks_indirect_count = reinterpret_cast<PFN_vkCmdDrawMeshTasksIndirectCountEXT>(pfn_get_device_proc_addr(device, "vkCmdDrawMeshTasksIndirectCountEXT"));
+    }
     assert(NULL == this->m_pfn_cmd_end_render_pass);
     this->m_pfn_cmd_end_render_pass = reinterpret_cast<PFN_vkCmdEndRenderPass>(pfn_get_device_proc_addr(device, "vkCmdEndRenderPass"));
+    assert(NULL == this->m_pfn_cmd_begin_rendering);
+    assert(NULL == this->m_pfn_cmd_end_rendering);
+    if (this->m_support_dynamic_rendering)
+    {
+        this->m_pfn_cmd_begin_rendering = reinterpret_cast<PFN_vkCmdBeginRenderingKHR>(pfn_get_device_proc_addr(device, "vkCmdBeginRenderingKHR"));
+        this->m_pfn_cmd_end_rendering = reinterpret_cast<PFN_vkCmdEndRenderingKHR>(pfn_get_device_proc_addr(device, "vkCmdEndRenderingKHR"));
+    }
     assert(NULL == this->m_pfn_cmd_dispatch);
     this->m_pfn_cmd_dispatch = reinterpret_cast<PFN_vkCmdDispatch>(pfn_get_device_proc_addr(device, "vkCmdDispatch"));
+    assert(NULL == this->m_pfn_cmd_copy_buffer);
+    this->m_pfn_cmd_copy_buffer = reinterpret_cast<PFN_vkCmdCopyBuffer>(pfn_get_device_proc_addr(device, "vkCmdCopyBuffer"));
+    assert(NULL == this->m_pfn_cmd_copy_image);
+    this->m_pfn_cmd_copy_image = reinterpret_cast<PFN_vkCmdCopyImage>(pfn_get_device_proc_addr(device, "vkCmdCopyImage"));
+    assert(NULL == this->m_pfn_cmd_fill_buffer);
+    this->m_pfn_cmd_fill_buffer = reinterpret_cast<PFN_vkCmdFillBuffer>(pfn_get_device_proc_addr(device, "vkCmdFillBuffer"));
+    assert(NULL == this->m_pfn_cmd_clear_color_image);
+    this->m_pfn_cmd_clear_color_image = reinterpret_cast<PFN_vkCmdClearColorImage>(pfn_get_device_proc_addr(device, "vkCmdClearColorImage"));
     assert(NULL == this->m_pfn_cmd_build_acceleration_structure);
     if (this->m_support_ray_tracing)
     {
@@ -222,7 +293,7 @@ void brx_pal_vk_graphics_command_buffer::acquire(uint32_t storage_asset_buffer_c
                     VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
                     NULL,
                     0U,
-                    VK_ACCESS_SHADER_READ_BIT,
+                    VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT,
                     this->m_upload_queue_family_index,
                     this->m_graphics_queue_family_index,
                     storage_asset_buffer,
@@ -268,7 +339,8 @@ void brx_pal_vk_graphics_command_buffer::acquire(uint32_t storage_asset_buffer_c
 
             if (storage_asset_buffer_count > 0U)
             {
-                VkPipelineStageFlags const graphics_queue_family_store_destination_stage = (!this->m_support_ray_tracing) ? (g_graphics_queue_family_graphics_compute_pipeline_shader_read_stages) : (g_graphics_queue_family_graphics_compute_pipeline_shader_read_stages | g_graphics_queue_family_ray_tracing_pipeline_shader_read_stages);
+                // the storage asset buffers may also be used as the vertex buffers or the index buffer
+                VkPipelineStageFlags const graphics_queue_family_store_destination_stage = (!this->m_support_ray_tracing) ? (VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | g_graphics_queue_family_graphics_compute_pipeline_shader_read_stages) : (VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | g_graphics_queue_family_graphics_compute_pipeline_shader_read_stages | g_graphics_queue_family_ray_tracing_pipeline_shader_read_stages);
                 this->m_pfn_cmd_pipeline_barrier(this->m_command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, graphics_queue_family_store_destination_stage, 0U, 0U, NULL, static_cast<uint32_t>(buffer_acquire_barriers.size()), buffer_acquire_barriers.data(), 0U, NULL);
             }
 
@@ -295,6 +367,71 @@ void brx_pal_vk_graphics_command_buffer::acquire(uint32_t storage_asset_buffer_c
     }
 }
 
+void brx_pal_vk_graphics_command_buffer::acquire(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *wrapped_storage_buffers, uint32_t storage_image_count, brx_pal_storage_image const *const *wrapped_storage_images)
+{
+    if (this->m_has_dedicated_compute_queue)
+    {
+        if (this->m_compute_queue_family_index != this->m_graphics_queue_family_index)
+        {
+            mcrt_vector<VkBufferMemoryBarrier> buffer_acquire_barriers(static_cast<size_t>(storage_buffer_count));
+
+            mcrt_vector<VkImageMemoryBarrier> image_acquire_barriers(static_cast<size_t>(storage_image_count));
+
+            for (uint32_t storage_buffer_index = 0U; storage_buffer_index < storage_buffer_count; ++storage_buffer_index)
+            {
+                VkBuffer const storage_buffer = static_cast<brx_pal_vk_storage_buffer const *>(wrapped_storage_buffers[storage_buffer_index])->get_buffer();
+
+                buffer_acquire_barriers[storage_buffer_index] = VkBufferMemoryBarrier{
+                    VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+                    NULL,
+                    0U,
+                    VK_ACCESS_SHADER_READ_BIT,
+                    this->m_compute_queue_family_index,
+                    this->m_graphics_queue_family_index,
+                    storage_buffer,
+                    0U,
+                    VK_WHOLE_SIZE};
+            }
+
+            for (uint32_t storage_image_index = 0U; storage_image_index < storage_image_count; ++storage_image_index)
+            {
+                VkImage const storage_image = static_cast<brx_pal_vk_storage_image const *>(wrapped_storage_images[storage_image_index])->get_image();
+
+                VkImageSubresourceRange const storage_image_subresource_range = {VK_IMAGE_ASPECT_COLOR_BIT, 0U, 1U, 0U, 1U};
+
+                image_acquire_barriers[storage_image_index] =
+                    VkImageMemoryBarrier{
+                        VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+                        NULL,
+                        0U,
+                        VK_ACCESS_SHADER_READ_BIT,
+                        VK_IMAGE_LAYOUT_GENERAL,
+                        VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                        this->m_compute_queue_family_index,
+                        this->m_graphics_queue_family_index,
+                        storage_image,
+                        storage_image_subresource_range};
+            }
+
+            // source stage: the same as the wait destination stage of the compute queue submit semaphore
+            VkPipelineStageFlags const graphics_queue_family_store_destination_stage = (!this->m_support_ray_tracing) ? (g_graphics_queue_family_graphics_compute_pipeline_shader_read_stages) : (g_graphics_queue_family_graphics_compute_pipeline_shader_read_stages | g_graphics_queue_family_ray_tracing_pipeline_shader_read_stages | g_graphics_queue_family_acceleration_structure_build_shader_read_stages);
+
+            if ((storage_buffer_count > 0U) || (storage_image_count > 0U))
+            {
+                this->m_pfn_cmd_pipeline_barrier(this->m_command_buffer, graphics_queue_family_store_destination_stage, graphics_queue_family_store_destination_stage, 0U, 0U, NULL, static_cast<uint32_t>(buffer_acquire_barriers.size()), buffer_acquire_barriers.data(), static_cast<uint32_t>(image_acquire_barriers.size()), image_acquire_barriers.data());
+            }
+        }
+        else
+        {
+            // do nothing
+        }
+    }
+    else
+    {
+        // do nothing
+    }
+}
+
 void brx_pal_vk_graphics_command_buffer::begin_debug_utils_label(char const *label_name)
 {
 #ifndef NDEBUG
@@ -350,14 +487,20 @@ void brx_pal_vk_graphics_command_buffer::begin_render_pass(brx_pal_render_pass c
     };
 
     this->m_pfn_cmd_begin_render_pass(this->m_command_buffer, &render_pass_begin_info, VK_SUBPASS_CONTENTS_INLINE);
+
+    this->m_color_attachment_count = static_cast<brx_pal_vk_render_pass const *>(brx_pal_render_pass)->get_color_attachment_count();
 }
 
 void brx_pal_vk_graphics_command_buffer::bind_graphics_pipeline(brx_pal_graphics_pipeline const *wrapped_graphics_pipeline)
 {
     assert(NULL != wrapped_graphics_pipeline);
-    VkPipeline const graphics_pipeline = static_cast<brx_pal_vk_graphics_pipeline const *>(wrapped_graphics_pipeline)->get_pipeline();
+    brx_pal_vk_graphics_pipeline const *const unwrapped_graphics_pipeline = static_cast<brx_pal_vk_graphics_pipeline const *>(wrapped_graphics_pipeline);
+
+    VkPipeline const graphics_pipeline = unwrapped_graphics_pipeline->get_pipeline();
 
     this->m_pfn_cmd_bind_pipeline(this->m_command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, graphics_pipeline);
+
+    this->m_current_vertex_binding_count = unwrapped_graphics_pipeline->get_vertex_binding_count();
 }
 
 void brx_pal_vk_graphics_command_buffer::set_view_port(uint32_t width, uint32_t height)
@@ -376,6 +519,87 @@ void brx_pal_vk_graphics_command_buffer::set_scissor(int32_t offset_width, int32
     this->m_pfn_cmd_set_scissor(this->m_command_buffer, 0U, 1U, &scissor);
 }
 
+void brx_pal_vk_graphics_command_buffer::set_cull_mode(bool enable_back_face_cull, bool front_ccw)
+{
+    assert(this->m_support_extended_dynamic_state);
+
+    this->m_pfn_cmd_set_cull_mode(this->m_command_buffer, enable_back_face_cull ? VK_CULL_MODE_BACK_BIT : VK_CULL_MODE_NONE);
+    this->m_pfn_cmd_set_front_face(this->m_command_buffer, front_ccw ? VK_FRONT_FACE_COUNTER_CLOCKWISE : VK_FRONT_FACE_CLOCKWISE);
+}
+
+void brx_pal_vk_graphics_command_buffer::set_depth_compare_operation(BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation)
+{
+    assert(this->m_support_extended_dynamic_state);
+
+    VkBool32 depth_test_enable;
+    VkCompareOp depth_compare_op;
+    switch (depth_compare_operation)
+    {
+    case BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION_DISABLE:
+    {
+        depth_test_enable = VK_FALSE;
+        depth_compare_op = VK_COMPARE_OP_ALWAYS;
+    }
+    break;
+    case BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION_GREATER:
+    {
+        depth_test_enable = VK_TRUE;
+        depth_compare_op = VK_COMPARE_OP_GREATER;
+    }
+    break;
+    case BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION_LESS:
+    {
+        depth_test_enable = VK_TRUE;
+        depth_compare_op = VK_COMPARE_OP_LESS;
+    }
+    break;
+    default:
+    {
+        assert(false);
+        depth_test_enable = VK_FALSE;
+        depth_compare_op = VK_COMPARE_OP_ALWAYS;
+    }
+    }
+
+    this->m_pfn_cmd_set_depth_test_enable(this->m_command_buffer, depth_test_enable);
+    this->m_pfn_cmd_set_depth_compare_op(this->m_command_buffer, depth_compare_op);
+}
+
+void brx_pal_vk_graphics_command_buffer::set_blend_operation(BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation)
+{
+    assert(this->m_support_extended_dynamic_state);
+
+    if (0U == this->m_color_attachment_count)
+    {
+        return;
+    }
+
+    constexpr uint32_t const max_color_attachment_count = 8U;
+    assert(this->m_color_attachment_count <= max_color_attachment_count);
+    uint32_t const color_attachment_count = (this->m_color_attachment_count < max_color_attachment_count) ? this->m_color_attachment_count : max_color_attachment_count;
+
+    // the blend operation is only applied to the first color attachment (the same as the "create_graphics_pipeline")
+    VkBool32 color_blend_enables[max_color_attachment_count];
+    VkColorBlendEquationEXT color_blend_equations[max_color_attachment_count];
+    for (uint32_t color_attachment_index = 0U; color_attachment_index < color_attachment_count; ++color_attachment_index)
+    {
+        if ((0U == color_attachment_index) && (BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION_OVER == blend_operation))
+        {
+            color_blend_enables[color_attachment_index] = VK_TRUE;
+            color_blend_equations[color_attachment_index] = VkColorBlendEquationEXT{VK_BLEND_FACTOR_SRC_ALPHA, VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA, VK_BLEND_OP_ADD, VK_BLEND_FACTOR_ONE, VK_BLEND_FACTOR_ONE, VK_BLEND_OP_MAX};
+        }
+        else
+        {
+            assert((0U != color_attachment_index) || (BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION_DISABLE == blend_operation));
+            color_blend_enables[color_attachment_index] = VK_FALSE;
+            color_blend_equations[color_attachment_index] = VkColorBlendEquationEXT{VK_BLEND_FACTOR_ONE, VK_BLEND_FACTOR_ZERO, VK_BLEND_OP_ADD, VK_BLEND_FACTOR_ONE, VK_BLEND_FACTOR_ZERO, VK_BLEND_OP_ADD};
+        }
+    }
+
+    this->m_pfn_cmd_set_color_blend_enable(this->m_command_buffer, 0U, color_attachment_count, color_blend_enables);
+    this->m_pfn_cmd_set_color_blend_equation(this->m_command_buffer, 0U, color_attachment_count, color_blend_equations);
+}
+
 void brx_pal_vk_graphics_command_buffer::bind_graphics_descriptor_sets(brx_pal_pipeline_layout const *wrapped_pipeline_layout, uint32_t descriptor_set_count, brx_pal_descriptor_set const *const *wrapped_descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets)
 {
     assert(NULL != wrapped_pipeline_layout);
@@ -392,16 +616,366 @@ void brx_pal_vk_graphics_command_buffer::bind_graphics_descriptor_sets(brx_pal_p
     this->m_pfn_cmd_bind_descriptor_sets(this->m_command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout, 0U, descriptor_set_count, &descriptor_sets[0], dynamic_offet_count, dynamic_offsets);
 }
 
+void brx_pal_vk_graphics_command_buffer::push_graphics_constants(brx_pal_pipeline_layout const *wrapped_pipeline_layout, uint32_t offset, uint32_t size, void const *constants)
+{
+    assert(NULL != wrapped_pipeline_layout);
+    assert(NULL != constants);
+    assert(0U == (offset & 3U));
+    assert(0U == (size & 3U));
+    assert((offset + size) <= BRX_PAL_MAX_PUSH_CONSTANT_SIZE);
+    VkPipelineLayout const pipeline_layout = static_cast<brx_pal_vk_pipeline_layout const *>(wrapped_pipeline_layout)->get_pipeline_layout();
+
+    this->m_pfn_cmd_push_constants(this->m_command_buffer, pipeline_layout, VK_SHADER_STAGE_ALL, offset, size, constants);
+}
+
 void brx_pal_vk_graphics_command_buffer::draw(uint32_t vertex_count, uint32_t instance_count, uint32_t first_vertex, uint32_t first_instance)
 {
     this->m_pfn_cmd_draw(this->m_command_buffer, vertex_count, instance_count, first_vertex, first_instance);
 }
 
+void brx_pal_vk_graphics_command_buffer::bind_vertex_buffers(uint32_t first_binding, uint32_t binding_count, brx_pal_storage_asset_buffer const *const *wrapped_vertex_buffers, uint64_t const *offsets)
+{
+    assert(NULL != wrapped_vertex_buffers);
+    assert(NULL != offsets);
+
+    constexpr uint32_t const max_vertex_binding_count = 16U;
+    assert(binding_count <= max_vertex_binding_count);
+    binding_count = (binding_count < max_vertex_binding_count) ? binding_count : max_vertex_binding_count;
+
+    VkBuffer vertex_buffers[max_vertex_binding_count];
+    VkDeviceSize vertex_buffer_offsets[max_vertex_binding_count];
+    for (uint32_t binding_index = 0U; binding_index < binding_count; ++binding_index)
+    {
+        assert(NULL != wrapped_vertex_buffers[binding_index]);
+
+        // the bound graphics pipeline should have the vertex binding (the linked graphics pipeline has none)
+        assert((first_binding + binding_index) < this->m_current_vertex_binding_count);
+
+        vertex_buffers[binding_index] = static_cast<brx_pal_vk_storage_asset_buffer const *>(wrapped_vertex_buffers[binding_index])->get_buffer();
+        vertex_buffer_offsets[binding_index] = offsets[binding_index];
+    }
+
+    this->m_pfn_cmd_bind_vertex_buffers(this->m_command_buffer, first_binding, binding_count, vertex_buffers, vertex_buffer_offsets);
+}
+
+void brx_pal_vk_graphics_command_buffer::bind_index_buffer(brx_pal_storage_asset_buffer const *wrapped_index_buffer, uint64_t offset, BRX_PAL_GRAPHICS_PIPELINE_INDEX_TYPE wrapped_index_type)
+{
+    assert(NULL != wrapped_index_buffer);
+    VkBuffer const index_buffer = static_cast<brx_pal_vk_storage_asset_buffer const *>(wrapped_index_buffer)->get_buffer();
+
+    VkIndexType index_type;
+    switch (wrapped_index_type)
+    {
+    case BRX_PAL_GRAPHICS_PIPELINE_INDEX_TYPE_UINT32:
+        index_type = VK_INDEX_TYPE_UINT32;
+        break;
+    case BRX_PAL_GRAPHICS_PIPELINE_INDEX_TYPE_UINT16:
+        index_type = VK_INDEX_TYPE_UINT16;
+        break;
+    default:
+        // the "BRX_PAL_GRAPHICS_PIPELINE_INDEX_TYPE_NONE" is only used by the acceleration structure
+        assert(false);
+        index_type = static_cast<VkIndexType>(-1);
+    }
+
+    this->m_pfn_cmd_bind_index_buffer(this->m_command_buffer, index_buffer, offset, index_type);
+}
+
+void brx_pal_vk_graphics_command_buffer::draw_indexed(uint32_t index_count, uint32_t instance_count, uint32_t first_index, int32_t vertex_offset, uint32_t first_instance)
+{
+    this->m_pfn_cmd_draw_indexed(this->m_command_buffer, index_count, instance_count, first_index, vertex_offset, first_instance);
+}
+
+void brx_pal_vk_graphics_command_buffer::draw_mesh_tasks(uint32_t group_count_x, uint32_t group_count_y, uint32_t group_count_z)
+{
+    assert(this->m_support_mesh_shader);
+    this->m_pfn_cmd_draw_mesh_tasks(this->m_command_buffer, group_count_x, group_count_y, group_count_z);
+}
+
+void brx_pal_vk_graphics_command_buffer::draw_mesh_tasks_indirect(brx_pal_storage_buffer const *wrapped_argument_buffer, uint64_t argument_offset, uint32_t draw_count)
+{
+    assert(this->m_support_mesh_shader);
+
+    assert(NULL != wrapped_argument_buffer);
+    VkBuffer const argument_buffer = static_cast<brx_pal_vk_storage_buffer const *>(wrapped_argument_buffer)->get_buffer();
+
+    static_assert(sizeof(BRX_PAL_DRAW_MESH_TASKS_INDIRECT_COMMAND) == sizeof(VkDrawMeshTasksIndirectCommandEXT), "");
+    this->m_pfn_cmd_draw_mesh_tasks_indirect(this->m_command_buffer, argument_buffer, argument_offset, draw_count, sizeof(BRX_PAL_DRAW_MESH_TASKS_INDIRECT_COMMAND));
+}
+
+void brx_pal_vk_graphics_command_buffer::draw_mesh_tasks_indirect_count(brx_pal_storage_buffer const *wrapped_argument_buffer, uint64_t argument_offset, brx_pal_storage_buffer const *wrapped_count_buffer, uint64_t count_offset, uint32_t max_draw_count)
+{
+    assert(this->m_support_mesh_shader);
+
+    assert(NULL != wrapped_argument_buffer);
+    VkBuffer const argument_buffer = static_cast<brx_pal_vk_storage_buffer const *>(wrapped_argument_buffer)->get_buffer();
+
+    assert(NULL != wrapped_count_buffer);
+    VkBuffer const count_buffer = static_cast<brx_pal_vk_storage_buffer const *>(wrapped_count_buffer)->get_buffer();
+
+    this->m_pfn_cmd_draw_mesh_tasks_indirect_count(this->m_command_buffer, argument_buffer, argument_offset, count_buffer, count_offset, max_draw_count, sizeof(BRX_PAL_DRAW_MESH_TASKS_INDIRECT_COMMAND));
+}
+
 void brx_pal_vk_graphics_command_buffer::end_render_pass()
 {
     this->m_pfn_cmd_end_render_pass(this->m_command_buffer);
 }
 
+void brx_pal_vk_graphics_command_buffer::begin_rendering(uint32_t width, uint32_t height, uint32_t view_count, uint32_t color_attachment_count, BRX_PAL_RENDERING_COLOR_ATTACHMENT const *color_attachments, BRX_PAL_RENDERING_DEPTH_STENCIL_ATTACHMENT const *depth_stencil_attachment)
+{
+    assert(this->m_support_dynamic_rendering);
+    assert(this->m_end_rendering_store_barriers.empty());
+    assert(0U == this->m_end_rendering_destination_stage_mask);
+
+    constexpr uint32_t const max_color_attachment_count = 8U;
+    assert(color_attachment_count <= max_color_attachment_count);
+    color_attachment_count = (color_attachment_count < max_color_attachment_count) ? color_attachment_count : max_color_attachment_count;
+
+    this->m_color_attachment_count = color_attachment_count;
+
+    VkPipelineStageFlags const graphics_queue_family_store_destination_stage = (!this->m_support_ray_tracing) ? (g_graphics_queue_family_graphics_compute_pipeline_shader_read_stages) : (g_graphics_queue_family_graphics_compute_pipeline_shader_read_stages | g_graphics_queue_family_ray_tracing_pipeline_shader_read_stages);
+
+    // the views [0, "view_count") are rendered to the layers with the same index, and the multiview is disabled by the zero view mask
+    assert(1U <= view_count);
+    uint32_t const view_mask = (1U == view_count) ? 0U : ((1U << view_count) - 1U);
+
+    // the content of the attachments is always discarded at the beginning (the same as the "initialLayout" of the render pass)
+    // all layers of the layered attachments are transitioned
+    VkImageMemoryBarrier load_barriers[max_color_attachment_count + 1U + max_color_attachment_count];
+    uint32_t load_barrier_count = 0U;
+    VkRenderingAttachmentInfoKHR rendering_color_attachments[max_color_attachment_count];
+
+    for (uint32_t color_attachment_index = 0U; color_attachment_index < color_attachment_count; ++color_attachment_index)
+    {
+        assert(NULL != color_attachments[color_attachment_index].image);
+        brx_pal_vk_color_attachment_image const *const color_attachment_image = static_cast<brx_pal_vk_color_attachment_image const *>(color_attachments[color_attachment_index].image);
+
+        // the multisample content is discarded and the store operation is applied to the resolve image
+        brx_pal_vk_color_attachment_image const *const resolve_image = static_cast<brx_pal_vk_color_attachment_image const *>(color_attachments[color_attachment_index].resolve_image);
+        assert((NULL == resolve_image) || (BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT_STORE_OPERATION_DONT_CARE != color_attachments[color_attachment_index].store_operation));
+        VkImage const store_image = (NULL != resolve_image) ? resolve_image->get_image() : color_attachment_image->get_image();
+
+        load_barriers[load_barrier_count] = VkImageMemoryBarrier{
+            VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+            NULL,
+            0U,
+            VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+            VK_IMAGE_LAYOUT_UNDEFINED,
+            VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+            VK_QUEUE_FAMILY_IGNORED,
+            VK_QUEUE_FAMILY_IGNORED,
+            color_attachment_image->get_image(),
+            {VK_IMAGE_ASPECT_COLOR_BIT, 0U, 1U, 0U, VK_REMAINING_ARRAY_LAYERS}};
+        ++load_barrier_count;
+
+        if (NULL != resolve_image)
+        {
+            load_barriers[load_barrier_count] = VkImageMemoryBarrier{
+                VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+                NULL,
+                0U,
+                VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+                VK_IMAGE_LAYOUT_UNDEFINED,
+                VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+                VK_QUEUE_FAMILY_IGNORED,
+                VK_QUEUE_FAMILY_IGNORED,
+                resolve_image->get_image(),
+                {VK_IMAGE_ASPECT_COLOR_BIT, 0U, 1U, 0U, VK_REMAINING_ARRAY_LAYERS}};
+            ++load_barrier_count;
+        }
+
+        switch (color_attachments[color_attachment_index].store_operation)
+        {
+        case BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT_STORE_OPERATION_DONT_CARE:
+            break;
+        case BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT_STORE_OPERATION_FLUSH_FOR_SAMPLED_IMAGE:
+            this->m_end_rendering_store_barriers.push_back(VkImageMemoryBarrier{
+                VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+                NULL,
+                VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+                VK_ACCESS_SHADER_READ_BIT,
+                VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+                VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                VK_QUEUE_FAMILY_IGNORED,
+                VK_QUEUE_FAMILY_IGNORED,
+                store_image,
+                {VK_IMAGE_ASPECT_COLOR_BIT, 0U, 1U, 0U, VK_REMAINING_ARRAY_LAYERS}});
+            this->m_end_rendering_destination_stage_mask |= graphics_queue_family_store_destination_stage;
+            break;
+        case BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT_STORE_OPERATION_FLUSH_FOR_PRESENT:
+            this->m_end_rendering_store_barriers.push_back(VkImageMemoryBarrier{
+                VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+                NULL,
+                VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+                0U,
+                VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+                VK_IMAGE_LAYOUT_PRESENT_SRC_KHR,
+                VK_QUEUE_FAMILY_IGNORED,
+                VK_QUEUE_FAMILY_IGNORED,
+                store_image,
+                {VK_IMAGE_ASPECT_COLOR_BIT, 0U, 1U, 0U, VK_REMAINING_ARRAY_LAYERS}});
+            this->m_end_rendering_destination_stage_mask |= VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+            break;
+        default:
+            assert(false);
+        }
+
+        VkClearValue clear_value;
+        clear_value.color.float32[0] = color_attachments[color_attachment_index].clear_value[0];
+        clear_value.color.float32[1] = color_attachments[color_attachment_index].clear_value[1];
+        clear_value.color.float32[2] = color_attachments[color_attachment_index].clear_value[2];
+        clear_value.color.float32[3] = color_attachments[color_attachment_index].clear_value[3];
+
+        assert((BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT_LOAD_OPERATION_DONT_CARE == color_attachments[color_attachment_index].load_operation) || (BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT_LOAD_OPERATION_CLEAR == color_attachments[color_attachment_index].load_operation));
+
+        rendering_color_attachments[color_attachment_index] = VkRenderingAttachmentInfoKHR{
+            VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR,
+            NULL,
+            color_attachment_image->get_image_view(),
+            VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+            (NULL != resolve_image) ? VK_RESOLVE_MODE_AVERAGE_BIT_KHR : VK_RESOLVE_MODE_NONE_KHR,
+            (NULL != resolve_image) ? resolve_image->get_image_view() : VK_NULL_HANDLE,
+            (NULL != resolve_image) ? VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL : VK_IMAGE_LAYOUT_UNDEFINED,
+            (BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT_LOAD_OPERATION_CLEAR == color_attachments[color_attachment_index].load_operation) ? VK_ATTACHMENT_LOAD_OP_CLEAR : VK_ATTACHMENT_LOAD_OP_DONT_CARE,
+            ((NULL == resolve_image) && (BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT_STORE_OPERATION_DONT_CARE != color_attachments[color_attachment_index].store_operation)) ? VK_ATTACHMENT_STORE_OP_STORE : VK_ATTACHMENT_STORE_OP_DONT_CARE,
+            clear_value};
+    }
+
+    VkPipelineStageFlags load_destination_stage_mask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+
+    VkRenderingAttachmentInfoKHR rendering_depth_attachment;
+    VkRenderingAttachmentInfoKHR rendering_stencil_attachment;
+    bool has_stencil_attachment = false;
+
+    if (NULL != depth_stencil_attachment)
+    {
+        assert(NULL != depth_stencil_attachment->image);
+        brx_pal_vk_depth_stencil_attachment_image const *const depth_stencil_attachment_image = static_cast<brx_pal_vk_depth_stencil_attachment_image const *>(depth_stencil_attachment->image);
+
+        VkImageAspectFlags const aspect_mask = depth_stencil_attachment_image->get_aspect_mask();
+
+        load_barriers[load_barrier_count] = VkImageMemoryBarrier{
+            VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+            NULL,
+            0U,
+            VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT,
+            VK_IMAGE_LAYOUT_UNDEFINED,
+            VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+            VK_QUEUE_FAMILY_IGNORED,
+            VK_QUEUE_FAMILY_IGNORED,
+            depth_stencil_attachment_image->get_image(),
+            {aspect_mask, 0U, 1U, 0U, VK_REMAINING_ARRAY_LAYERS}};
+        ++load_barrier_count;
+
+        load_destination_stage_mask |= (VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT);
+
+        switch (depth_stencil_attachment->store_operation)
+        {
+        case BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT_STORE_OPERATION_DONT_CARE:
+            break;
+        case BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT_STORE_OPERATION_FLUSH_FOR_SAMPLED_IMAGE:
+            this->m_end_rendering_store_barriers.push_back(VkImageMemoryBarrier{
+                VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+                NULL,
+                VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT,
+                VK_ACCESS_SHADER_READ_BIT,
+                VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+                VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                VK_QUEUE_FAMILY_IGNORED,
+                VK_QUEUE_FAMILY_IGNORED,
+                depth_stencil_attachment_image->get_image(),
+                {aspect_mask, 0U, 1U, 0U, VK_REMAINING_ARRAY_LAYERS}});
+            this->m_end_rendering_destination_stage_mask |= graphics_queue_family_store_destination_stage;
+            break;
+        default:
+            assert(false);
+        }
+
+        VkClearValue clear_value;
+        clear_value.depthStencil.depth = depth_stencil_attachment->depth_clear_value;
+        clear_value.depthStencil.stencil = depth_stencil_attachment->stencil_clear_value;
+
+        assert((BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT_LOAD_OPERATION_DONT_CARE == depth_stencil_attachment->load_operation) || (BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT_LOAD_OPERATION_CLEAR == depth_stencil_attachment->load_operation));
+
+        rendering_depth_attachment = VkRenderingAttachmentInfoKHR{
+            VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR,
+            NULL,
+            depth_stencil_attachment_image->get_image_view(),
+            VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+            VK_RESOLVE_MODE_NONE_KHR,
+            VK_NULL_HANDLE,
+            VK_IMAGE_LAYOUT_UNDEFINED,
+            (BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT_LOAD_OPERATION_CLEAR == depth_stencil_attachment->load_operation) ? VK_ATTACHMENT_LOAD_OP_CLEAR : VK_ATTACHMENT_LOAD_OP_DONT_CARE,
+            (BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT_STORE_OPERATION_DONT_CARE != depth_stencil_attachment->store_operation) ? VK_ATTACHMENT_STORE_OP_STORE : VK_ATTACHMENT_STORE_OP_DONT_CARE,
+            clear_value};
+
+        // the same view is used by both the depth and the stencil attachment
+        if (0U != (VK_IMAGE_ASPECT_STENCIL_BIT & aspect_mask))
+        {
+            rendering_stencil_attachment = rendering_depth_attachment;
+            has_stencil_attachment = true;
+        }
+    }
+
+    if (load_barrier_count > 0U)
+    {
+        // the previous accesses to the aliased memory are waited by the load barrier itself, since a separate barrier does NOT chain with the load barrier whose source scope is the "TOP_OF_PIPE"
+        VkPipelineStageFlags const load_source_stage_mask = (0U != this->m_aliasing_source_stage_mask) ? this->m_aliasing_source_stage_mask : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+        for (uint32_t load_barrier_index = 0U; load_barrier_index < load_barrier_count; ++load_barrier_index)
+        {
+            load_barriers[load_barrier_index].srcAccessMask = this->m_aliasing_source_access_mask;
+        }
+
+        this->m_pfn_cmd_pipeline_barrier(this->m_command_buffer, load_source_stage_mask, load_destination_stage_mask, 0U, 0U, NULL, 0U, NULL, load_barrier_count, load_barriers);
+
+        this->m_aliasing_source_stage_mask = 0U;
+        this->m_aliasing_source_access_mask = 0U;
+    }
+
+    VkRenderingInfoKHR const rendering_info = {
+        VK_STRUCTURE_TYPE_RENDERING_INFO_KHR,
+        NULL,
+        0U,
+        {{0U, 0U}, {width, height}},
+        1U,
+        view_mask,
+        color_attachment_count,
+        rendering_color_attachments,
+        (NULL != depth_stencil_attachment) ? &rendering_depth_attachment : NULL,
+        has_stencil_attachment ? &rendering_stencil_attachment : NULL};
+
+    this->m_pfn_cmd_begin_rendering(this->m_command_buffer, &rendering_info);
+}
+
+void brx_pal_vk_graphics_command_buffer::end_rendering()
+{
+    assert(this->m_support_dynamic_rendering);
+
+    this->m_pfn_cmd_end_rendering(this->m_command_buffer);
+
+    if (!this->m_end_rendering_store_barriers.empty())
+    {
+        this->m_pfn_cmd_pipeline_barrier(this->m_command_buffer, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT, this->m_end_rendering_destination_stage_mask, 0U, 0U, NULL, 0U, NULL, static_cast<uint32_t>(this->m_end_rendering_store_barriers.size()), this->m_end_rendering_store_barriers.data());
+    }
+
+    this->m_end_rendering_store_barriers.clear();
+    this->m_end_rendering_destination_stage_mask = 0U;
+}
+
+void brx_pal_vk_graphics_command_buffer::aliasing_barrier(uint32_t color_attachment_image_count, brx_pal_color_attachment_image const *const *color_attachment_images, uint32_t depth_stencil_attachment_image_count, brx_pal_depth_stencil_attachment_image const *const *depth_stencil_attachment_images, uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *storage_buffers, uint32_t storage_image_count, brx_pal_storage_image const *const *storage_images)
+{
+    assert((0U == color_attachment_image_count) || (NULL != color_attachment_images));
+    assert((0U == depth_stencil_attachment_image_count) || (NULL != depth_stencil_attachment_images));
+    assert((0U == storage_buffer_count) || (NULL != storage_buffers));
+    assert((0U == storage_image_count) || (NULL != storage_images));
+
+    // the load barriers always transition the images from the "VK_IMAGE_LAYOUT_UNDEFINED" (the content is discarded), and only the source scope (the previous reads and writes of any resource in the same memory range) is required
+    VkPipelineStageFlags const graphics_queue_family_shader_read_stage = (!this->m_support_ray_tracing) ? (g_graphics_queue_family_graphics_compute_pipeline_shader_read_stages) : (g_graphics_queue_family_graphics_compute_pipeline_shader_read_stages | g_graphics_queue_family_ray_tracing_pipeline_shader_read_stages | g_graphics_queue_family_acceleration_structure_build_shader_read_stages);
+
+    this->m_aliasing_source_stage_mask |= (graphics_queue_family_shader_read_stage | VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT);
+    this->m_aliasing_source_access_mask |= (VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT | VK_ACCESS_SHADER_WRITE_BIT);
+}
+
 void brx_pal_vk_graphics_command_buffer::compute_pass_load(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *wrapped_storage_buffers, BRX_PAL_COMPUTE_PASS_STORAGE_BUFFER_LOAD_OPERATION const *storage_buffer_load_operations, uint32_t storage_image_count, brx_pal_storage_image const *const *wrapped_storage_images, BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_LOAD_OPERATION const *storage_image_load_operations)
 {
     mcrt_vector<VkBufferMemoryBarrier> buffer_load_barriers(static_cast<size_t>(storage_buffer_count));
@@ -417,7 +991,7 @@ void brx_pal_vk_graphics_command_buffer::compute_pass_load(uint32_t storage_buff
         buffer_load_barriers[storage_buffer_index] = VkBufferMemoryBarrier{
             VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
             NULL,
-            0U,
+            this->m_aliasing_source_access_mask,
             VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
             VK_QUEUE_FAMILY_IGNORED,
             VK_QUEUE_FAMILY_IGNORED,
@@ -438,7 +1012,7 @@ void brx_pal_vk_graphics_command_buffer::compute_pass_load(uint32_t storage_buff
             VkImageMemoryBarrier{
                 VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
                 NULL,
-                0U,
+                this->m_aliasing_source_access_mask,
                 VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
                 VK_IMAGE_LAYOUT_UNDEFINED,
                 VK_IMAGE_LAYOUT_GENERAL,
@@ -448,7 +1022,12 @@ void brx_pal_vk_graphics_command_buffer::compute_pass_load(uint32_t storage_buff
                 storage_image_subresource_range};
     }
 
-    this->m_pfn_cmd_pipeline_barrier(this->m_command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0U, 0U, NULL, static_cast<uint32_t>(buffer_load_barriers.size()), buffer_load_barriers.data(), static_cast<uint32_t>(image_load_barriers.size()), image_load_barriers.data());
+    VkPipelineStageFlags const load_source_stage_mask = (0U != this->m_aliasing_source_stage_mask) ? this->m_aliasing_source_stage_mask : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+
+    this->m_pfn_cmd_pipeline_barrier(this->m_command_buffer, load_source_stage_mask, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0U, 0U, NULL, static_cast<uint32_t>(buffer_load_barriers.size()), buffer_load_barriers.data(), static_cast<uint32_t>(image_load_barriers.size()), image_load_barriers.data());
+
+    this->m_aliasing_source_stage_mask = 0U;
+    this->m_aliasing_source_access_mask = 0U;
 }
 
 void brx_pal_vk_graphics_command_buffer::bind_compute_pipeline(brx_pal_compute_pipeline const *wrapped_compute_pipeline)
@@ -475,6 +1054,18 @@ void brx_pal_vk_graphics_command_buffer::bind_compute_descriptor_sets(brx_pal_pi
     this->m_pfn_cmd_bind_descriptor_sets(this->m_command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_layout, 0U, descriptor_set_count, &descriptor_sets[0], dynamic_offet_count, dynamic_offsets);
 }
 
+void brx_pal_vk_graphics_command_buffer::push_compute_constants(brx_pal_pipeline_layout const *wrapped_pipeline_layout, uint32_t offset, uint32_t size, void const *constants)
+{
+    assert(NULL != wrapped_pipeline_layout);
+    assert(NULL != constants);
+    assert(0U == (offset & 3U));
+    assert(0U == (size & 3U));
+    assert((offset + size) <= BRX_PAL_MAX_PUSH_CONSTANT_SIZE);
+    VkPipelineLayout const pipeline_layout = static_cast<brx_pal_vk_pipeline_layout const *>(wrapped_pipeline_layout)->get_pipeline_layout();
+
+    this->m_pfn_cmd_push_constants(this->m_command_buffer, pipeline_layout, VK_SHADER_STAGE_ALL, offset, size, constants);
+}
+
 void brx_pal_vk_graphics_command_buffer::dispatch(uint32_t group_count_x, uint32_t group_count_y, uint32_t group_count_z)
 {
     this->m_pfn_cmd_dispatch(this->m_command_buffer, group_count_x, group_count_y, group_count_z);
@@ -537,11 +1128,12 @@ void brx_pal_vk_graphics_command_buffer::compute_pass_store(uint32_t storage_buf
 
         assert(BRX_PAL_COMPUTE_PASS_STORAGE_BUFFER_STORE_OPERATION_FLUSH_FOR_READ_ONLY_STORAGE_BUFFER_AND_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BUFFER == storage_buffer_store_operations[storage_buffer_index]);
 
+        // INDIRECT_COMMAND_READ: the arguments of the "draw_mesh_tasks_indirect" and "draw_mesh_tasks_indirect_count"
         buffer_store_barriers[storage_buffer_index] = VkBufferMemoryBarrier{
             VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
             NULL,
             VK_ACCESS_SHADER_WRITE_BIT,
-            VK_ACCESS_SHADER_READ_BIT,
+            VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_INDIRECT_COMMAND_READ_BIT,
             VK_QUEUE_FAMILY_IGNORED,
             VK_QUEUE_FAMILY_IGNORED,
             storage_buffer,
@@ -571,11 +1163,244 @@ void brx_pal_vk_graphics_command_buffer::compute_pass_store(uint32_t storage_buf
                 storage_image_subresource_range};
     }
 
-    VkPipelineStageFlags const graphics_queue_family_store_destination_stage = (!this->m_support_ray_tracing) ? (g_graphics_queue_family_graphics_compute_pipeline_shader_read_stages) : (g_graphics_queue_family_graphics_compute_pipeline_shader_read_stages | g_graphics_queue_family_ray_tracing_pipeline_shader_read_stages | g_graphics_queue_family_acceleration_structure_build_shader_read_stages);
+    VkPipelineStageFlags const graphics_queue_family_store_destination_stage = (!this->m_support_ray_tracing) ? (VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | g_graphics_queue_family_graphics_compute_pipeline_shader_read_stages) : (VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | g_graphics_queue_family_graphics_compute_pipeline_shader_read_stages | g_graphics_queue_family_ray_tracing_pipeline_shader_read_stages | g_graphics_queue_family_acceleration_structure_build_shader_read_stages);
 
     this->m_pfn_cmd_pipeline_barrier(this->m_command_buffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, graphics_queue_family_store_destination_stage, 0U, 0U, NULL, static_cast<uint32_t>(buffer_store_barriers.size()), buffer_store_barriers.data(), static_cast<uint32_t>(image_store_barriers.size()), image_store_barriers.data());
 }
 
+void brx_pal_vk_graphics_command_buffer::copy_buffer(brx_pal_storage_buffer const *wrapped_dst_storage_buffer, uint64_t dst_offset, brx_pal_storage_buffer const *wrapped_src_storage_buffer, uint64_t src_offset, uint32_t src_size)
+{
+    assert(NULL != wrapped_dst_storage_buffer);
+    VkBuffer const dst_storage_buffer = static_cast<brx_pal_vk_storage_buffer const *>(wrapped_dst_storage_buffer)->get_buffer();
+
+    assert(NULL != wrapped_src_storage_buffer);
+    VkBuffer const src_storage_buffer = static_cast<brx_pal_vk_storage_buffer const *>(wrapped_src_storage_buffer)->get_buffer();
+
+    assert(dst_storage_buffer != src_storage_buffer);
+
+    VkPipelineStageFlags const graphics_queue_family_store_destination_stage = (!this->m_support_ray_tracing) ? (g_graphics_queue_family_graphics_compute_pipeline_shader_read_stages) : (g_graphics_queue_family_graphics_compute_pipeline_shader_read_stages | g_graphics_queue_family_ray_tracing_pipeline_shader_read_stages | g_graphics_queue_family_acceleration_structure_build_shader_read_stages);
+
+    {
+        // the writes have already been made available by the "compute_pass_store"
+        VkBufferMemoryBarrier const buffer_load_barriers[2] = {
+            {VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+             NULL,
+             0U,
+             VK_ACCESS_TRANSFER_WRITE_BIT,
+             VK_QUEUE_FAMILY_IGNORED,
+             VK_QUEUE_FAMILY_IGNORED,
+             dst_storage_buffer,
+             dst_offset,
+             src_size},
+            {VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+             NULL,
+             0U,
+             VK_ACCESS_TRANSFER_READ_BIT,
+             VK_QUEUE_FAMILY_IGNORED,
+             VK_QUEUE_FAMILY_IGNORED,
+             src_storage_buffer,
+             src_offset,
+             src_size}};
+
+        this->m_pfn_cmd_pipeline_barrier(this->m_command_buffer, graphics_queue_family_store_destination_stage, VK_PIPELINE_STAGE_TRANSFER_BIT, 0U, 0U, NULL, sizeof(buffer_load_barriers) / sizeof(buffer_load_barriers[0]), buffer_load_barriers, 0U, NULL);
+    }
+
+    VkBufferCopy const region = {src_offset, dst_offset, src_size};
+
+    this->m_pfn_cmd_copy_buffer(this->m_command_buffer, src_storage_buffer, dst_storage_buffer, 1U, &region);
+
+    {
+        VkBufferMemoryBarrier const buffer_store_barrier = {
+            VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+            NULL,
+            VK_ACCESS_TRANSFER_WRITE_BIT,
+            VK_ACCESS_SHADER_READ_BIT,
+            VK_QUEUE_FAMILY_IGNORED,
+            VK_QUEUE_FAMILY_IGNORED,
+            dst_storage_buffer,
+            dst_offset,
+            src_size};
+
+        this->m_pfn_cmd_pipeline_barrier(this->m_command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, graphics_queue_family_store_destination_stage, 0U, 0U, NULL, 1U, &buffer_store_barrier, 0U, NULL);
+    }
+}
+
+void brx_pal_vk_graphics_command_buffer::copy_image(brx_pal_storage_image const *wrapped_dst_storage_image, brx_pal_storage_image const *wrapped_src_storage_image, uint32_t width, uint32_t height)
+{
+    assert(NULL != wrapped_dst_storage_image);
+    VkImage const dst_storage_image = static_cast<brx_pal_vk_storage_image const *>(wrapped_dst_storage_image)->get_image();
+
+    assert(NULL != wrapped_src_storage_image);
+    VkImage const src_storage_image = static_cast<brx_pal_vk_storage_image const *>(wrapped_src_storage_image)->get_image();
+
+    assert(dst_storage_image != src_storage_image);
+
+    VkImageSubresourceRange const storage_image_subresource_range = {VK_IMAGE_ASPECT_COLOR_BIT, 0U, 1U, 0U, 1U};
+
+    VkPipelineStageFlags const graphics_queue_family_store_destination_stage = (!this->m_support_ray_tracing) ? (g_graphics_queue_family_graphics_compute_pipeline_shader_read_stages) : (g_graphics_queue_family_graphics_compute_pipeline_shader_read_stages | g_graphics_queue_family_ray_tracing_pipeline_shader_read_stages | g_graphics_queue_family_acceleration_structure_build_shader_read_stages);
+
+    {
+        VkImageMemoryBarrier const image_load_barriers[2] = {
+            {VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+             NULL,
+             0U,
+             VK_ACCESS_TRANSFER_WRITE_BIT,
+             VK_IMAGE_LAYOUT_UNDEFINED,
+             VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+             VK_QUEUE_FAMILY_IGNORED,
+             VK_QUEUE_FAMILY_IGNORED,
+             dst_storage_image,
+             storage_image_subresource_range},
+            {VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+             NULL,
+             0U,
+             VK_ACCESS_TRANSFER_READ_BIT,
+             VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+             VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+             VK_QUEUE_FAMILY_IGNORED,
+             VK_QUEUE_FAMILY_IGNORED,
+             src_storage_image,
+             storage_image_subresource_range}};
+
+        this->m_pfn_cmd_pipeline_barrier(this->m_command_buffer, graphics_queue_family_store_destination_stage, VK_PIPELINE_STAGE_TRANSFER_BIT, 0U, 0U, NULL, 0U, NULL, sizeof(image_load_barriers) / sizeof(image_load_barriers[0]), image_load_barriers);
+    }
+
+    VkImageCopy const region = {{VK_IMAGE_ASPECT_COLOR_BIT, 0U, 0U, 1U}, {0, 0, 0}, {VK_IMAGE_ASPECT_COLOR_BIT, 0U, 0U, 1U}, {0, 0, 0}, {width, height, 1U}};
+
+    this->m_pfn_cmd_copy_image(this->m_command_buffer, src_storage_image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, dst_storage_image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1U, &region);
+
+    {
+        VkImageMemoryBarrier const image_store_barriers[2] = {
+            {VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+             NULL,
+             VK_ACCESS_TRANSFER_WRITE_BIT,
+             VK_ACCESS_SHADER_READ_BIT,
+             VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+             VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+             VK_QUEUE_FAMILY_IGNORED,
+             VK_QUEUE_FAMILY_IGNORED,
+             dst_storage_image,
+             storage_image_subresource_range},
+            {VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+             NULL,
+             0U,
+             VK_ACCESS_SHADER_READ_BIT,
+             VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+             VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+             VK_QUEUE_FAMILY_IGNORED,
+             VK_QUEUE_FAMILY_IGNORED,
+             src_storage_image,
+             storage_image_subresource_range}};
+
+        this->m_pfn_cmd_pipeline_barrier(this->m_command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, graphics_queue_family_store_destination_stage, 0U, 0U, NULL, 0U, NULL, sizeof(image_store_barriers) / sizeof(image_store_barriers[0]), image_store_barriers);
+    }
+}
+
+void brx_pal_vk_graphics_command_buffer::fill_buffer(brx_pal_storage_buffer const *wrapped_dst_storage_buffer, uint64_t dst_offset, uint32_t dst_size, uint32_t data)
+{
+    assert(NULL != wrapped_dst_storage_buffer);
+    VkBuffer const dst_storage_buffer = static_cast<brx_pal_vk_storage_buffer const *>(wrapped_dst_storage_buffer)->get_buffer();
+
+    assert(0U == (dst_offset % 4U));
+    assert(0U == (dst_size % 4U));
+
+    VkPipelineStageFlags const graphics_queue_family_store_destination_stage = (!this->m_support_ray_tracing) ? (g_graphics_queue_family_graphics_compute_pipeline_shader_read_stages) : (g_graphics_queue_family_graphics_compute_pipeline_shader_read_stages | g_graphics_queue_family_ray_tracing_pipeline_shader_read_stages | g_graphics_queue_family_acceleration_structure_build_shader_read_stages);
+
+    {
+        VkBufferMemoryBarrier const buffer_load_barrier = {
+            VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+            NULL,
+            0U,
+            VK_ACCESS_TRANSFER_WRITE_BIT,
+            VK_QUEUE_FAMILY_IGNORED,
+            VK_QUEUE_FAMILY_IGNORED,
+            dst_storage_buffer,
+            dst_offset,
+            dst_size};
+
+        this->m_pfn_cmd_pipeline_barrier(this->m_command_buffer, graphics_queue_family_store_destination_stage, VK_PIPELINE_STAGE_TRANSFER_BIT, 0U, 0U, NULL, 1U, &buffer_load_barrier, 0U, NULL);
+    }
+
+    this->m_pfn_cmd_fill_buffer(this->m_command_buffer, dst_storage_buffer, dst_offset, dst_size, data);
+
+    {
+        VkBufferMemoryBarrier const buffer_store_barrier = {
+            VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+            NULL,
+            VK_ACCESS_TRANSFER_WRITE_BIT,
+            VK_ACCESS_SHADER_READ_BIT,
+            VK_QUEUE_FAMILY_IGNORED,
+            VK_QUEUE_FAMILY_IGNORED,
+            dst_storage_buffer,
+            dst_offset,
+            dst_size};
+
+        this->m_pfn_cmd_pipeline_barrier(this->m_command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, graphics_queue_family_store_destination_stage, 0U, 0U, NULL, 1U, &buffer_store_barrier, 0U, NULL);
+    }
+}
+
+void brx_pal_vk_graphics_command_buffer::clear_storage_image(brx_pal_storage_image const *wrapped_storage_image, float const *color_clear_value)
+{
+    assert(NULL != wrapped_storage_image);
+    VkImage const storage_image = static_cast<brx_pal_vk_storage_image const *>(wrapped_storage_image)->get_image();
+    VkFormat const storage_image_format = static_cast<brx_pal_vk_storage_image const *>(wrapped_storage_image)->get_format();
+
+    assert(NULL != color_clear_value);
+    VkClearColorValue clear_color_value;
+    if (VK_FORMAT_R32_UINT == storage_image_format)
+    {
+        clear_color_value.uint32[0] = static_cast<uint32_t>(color_clear_value[0]);
+        clear_color_value.uint32[1] = static_cast<uint32_t>(color_clear_value[1]);
+        clear_color_value.uint32[2] = static_cast<uint32_t>(color_clear_value[2]);
+        clear_color_value.uint32[3] = static_cast<uint32_t>(color_clear_value[3]);
+    }
+    else
+    {
+        clear_color_value.float32[0] = color_clear_value[0];
+        clear_color_value.float32[1] = color_clear_value[1];
+        clear_color_value.float32[2] = color_clear_value[2];
+        clear_color_value.float32[3] = color_clear_value[3];
+    }
+
+    VkImageSubresourceRange const storage_image_subresource_range = {VK_IMAGE_ASPECT_COLOR_BIT, 0U, 1U, 0U, 1U};
+
+    VkPipelineStageFlags const graphics_queue_family_store_destination_stage = (!this->m_support_ray_tracing) ? (g_graphics_queue_family_graphics_compute_pipeline_shader_read_stages) : (g_graphics_queue_family_graphics_compute_pipeline_shader_read_stages | g_graphics_queue_family_ray_tracing_pipeline_shader_read_stages | g_graphics_queue_family_acceleration_structure_build_shader_read_stages);
+
+    {
+        VkImageMemoryBarrier const image_load_barrier = {
+            VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+            NULL,
+            0U,
+            VK_ACCESS_TRANSFER_WRITE_BIT,
+            VK_IMAGE_LAYOUT_UNDEFINED,
+            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            VK_QUEUE_FAMILY_IGNORED,
+            VK_QUEUE_FAMILY_IGNORED,
+            storage_image,
+            storage_image_subresource_range};
+
+        this->m_pfn_cmd_pipeline_barrier(this->m_command_buffer, graphics_queue_family_store_destination_stage, VK_PIPELINE_STAGE_TRANSFER_BIT, 0U, 0U, NULL, 0U, NULL, 1U, &image_load_barrier);
+    }
+
+    this->m_pfn_cmd_clear_color_image(this->m_command_buffer, storage_image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &clear_color_value, 1U, &storage_image_subresource_range);
+
+    {
+        VkImageMemoryBarrier const image_store_barrier = {
+            VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+            NULL,
+            VK_ACCESS_TRANSFER_WRITE_BIT,
+            VK_ACCESS_SHADER_READ_BIT,
+            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+            VK_QUEUE_FAMILY_IGNORED,
+            VK_QUEUE_FAMILY_IGNORED,
+            storage_image,
+            storage_image_subresource_range};
+
+        this->m_pfn_cmd_pipeline_barrier(this->m_command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, graphics_queue_family_store_destination_stage, 0U, 0U, NULL, 0U, NULL, 1U, &image_store_barrier);
+    }
+}
+
 void brx_pal_vk_graphics_command_buffer::build_intermediate_bottom_level_acceleration_structure(brx_pal_intermediate_bottom_level_acceleration_structure *wrapped_intermediate_bottom_level_acceleration_structure, uint32_t bottom_level_acceleration_structure_geometry_count, BRX_PAL_BOTTOM_LEVEL_ACCELERATION_STRUCTURE_GEOMETRY const *wrapped_bottom_level_acceleration_structure_geometries, brx_pal_scratch_buffer *wrapped_scratch_buffer)
 {
     assert(NULL != wrapped_intermediate_bottom_level_acceleration_structure);
@@ -829,12 +1654,27 @@ void brx_pal_vk_graphics_command_buffer::update_intermediate_bottom_level_accele
 }
 
 void brx_pal_vk_graphics_command_buffer::build_top_level_acceleration_structure(brx_pal_top_level_acceleration_structure *wrapped_top_level_acceleration_structure, uint32_t top_level_acceleration_structure_instance_count, brx_pal_top_level_acceleration_structure_instance_upload_buffer *wrapped_top_level_acceleration_structure_instance_upload_buffer, brx_pal_scratch_buffer *wrapped_scratch_buffer)
+{
+    assert(NULL != wrapped_top_level_acceleration_structure_instance_upload_buffer);
+    VkDeviceAddress const top_level_acceleration_structure_instance_upload_buffer_device_memory_range_base = static_cast<brx_pal_vk_top_level_acceleration_structure_instance_upload_buffer *>(wrapped_top_level_acceleration_structure_instance_upload_buffer)->get_device_memory_range_base();
+
+    this->build_top_level_acceleration_structure(wrapped_top_level_acceleration_structure, top_level_acceleration_structure_instance_count, top_level_acceleration_structure_instance_upload_buffer_device_memory_range_base, wrapped_scratch_buffer);
+}
+
+void brx_pal_vk_graphics_command_buffer::build_top_level_acceleration_structure_from_device_instances(brx_pal_top_level_acceleration_structure *wrapped_top_level_acceleration_structure, uint32_t top_level_acceleration_structure_instance_count, brx_pal_acceleration_structure_build_input_read_only_buffer const *wrapped_top_level_acceleration_structure_device_instance_buffer, brx_pal_scratch_buffer *wrapped_scratch_buffer)
+{
+    assert(NULL != wrapped_top_level_acceleration_structure_device_instance_buffer);
+    VkDeviceAddress const top_level_acceleration_structure_device_instance_buffer_device_memory_range_base = static_cast<brx_pal_vk_acceleration_structure_build_input_read_only_buffer const *>(wrapped_top_level_acceleration_structure_device_instance_buffer)->get_device_memory_range_base();
+
+    this->build_top_level_acceleration_structure(wrapped_top_level_acceleration_structure, top_level_acceleration_structure_instance_count, top_level_acceleration_structure_device_instance_buffer_device_memory_range_base, wrapped_scratch_buffer);
+}
+
+void brx_pal_vk_graphics_command_buffer::build_top_level_acceleration_structure(brx_pal_top_level_acceleration_structure *wrapped_top_level_acceleration_structure, uint32_t top_level_acceleration_structure_instance_count, VkDeviceAddress top_level_acceleration_structure_instance_buffer_device_memory_range_base, brx_pal_scratch_buffer *wrapped_scratch_buffer)
 {
     assert(NULL != wrapped_top_level_acceleration_structure);
     VkAccelerationStructureKHR const destination_acceleration_structure = static_cast<brx_pal_vk_top_level_acceleration_structure *>(wrapped_top_level_acceleration_structure)->get_acceleration_structure();
 
-    assert(NULL != wrapped_top_level_acceleration_structure_instance_upload_buffer);
-    VkDeviceAddress const top_level_acceleration_structure_instance_upload_buffer_device_memory_range_base = static_cast<brx_pal_vk_top_level_acceleration_structure_instance_upload_buffer *>(wrapped_top_level_acceleration_structure_instance_upload_buffer)->get_device_memory_range_base();
+    assert(0U == (top_level_acceleration_structure_instance_buffer_device_memory_range_base % 16U));
 
     assert(NULL != wrapped_scratch_buffer);
     VkDeviceAddress const scratch_buffer_device_memory_range_base = static_cast<brx_pal_vk_scratch_buffer *>(wrapped_scratch_buffer)->get_device_memory_range_base();
@@ -848,7 +1688,7 @@ void brx_pal_vk_graphics_command_buffer::build_top_level_acceleration_structure(
                  VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_INSTANCES_DATA_KHR,
                  NULL,
                  VK_FALSE,
-                 {top_level_acceleration_structure_instance_upload_buffer_device_memory_range_base}}}};
+                 {top_level_acceleration_structure_instance_buffer_device_memory_range_base}}}};
 
     VkAccelerationStructureBuildGeometryInfoKHR const acceleration_structure_build_geometry_info = {
         VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR,
@@ -895,14 +1735,29 @@ void brx_pal_vk_graphics_command_buffer::build_top_level_acceleration_structure_
 }
 
 void brx_pal_vk_graphics_command_buffer::update_top_level_acceleration_structure(brx_pal_top_level_acceleration_structure *wrapped_top_level_acceleration_structure, brx_pal_top_level_acceleration_structure_instance_upload_buffer *wrapped_top_level_acceleration_structure_instance_upload_buffer, brx_pal_scratch_buffer *wrapped_scratch_buffer)
+{
+    assert(NULL != wrapped_top_level_acceleration_structure_instance_upload_buffer);
+    VkDeviceAddress const top_level_acceleration_structure_instance_upload_buffer_device_memory_range_base = static_cast<brx_pal_vk_top_level_acceleration_structure_instance_upload_buffer *>(wrapped_top_level_acceleration_structure_instance_upload_buffer)->get_device_memory_range_base();
+
+    this->update_top_level_acceleration_structure(wrapped_top_level_acceleration_structure, top_level_acceleration_structure_instance_upload_buffer_device_memory_range_base, wrapped_scratch_buffer);
+}
+
+void brx_pal_vk_graphics_command_buffer::update_top_level_acceleration_structure_from_device_instances(brx_pal_top_level_acceleration_structure *wrapped_top_level_acceleration_structure, brx_pal_acceleration_structure_build_input_read_only_buffer const *wrapped_top_level_acceleration_structure_device_instance_buffer, brx_pal_scratch_buffer *wrapped_scratch_buffer)
+{
+    assert(NULL != wrapped_top_level_acceleration_structure_device_instance_buffer);
+    VkDeviceAddress const top_level_acceleration_structure_device_instance_buffer_device_memory_range_base = static_cast<brx_pal_vk_acceleration_structure_build_input_read_only_buffer const *>(wrapped_top_level_acceleration_structure_device_instance_buffer)->get_device_memory_range_base();
+
+    this->update_top_level_acceleration_structure(wrapped_top_level_acceleration_structure, top_level_acceleration_structure_device_instance_buffer_device_memory_range_base, wrapped_scratch_buffer);
+}
+
+void brx_pal_vk_graphics_command_buffer::update_top_level_acceleration_structure(brx_pal_top_level_acceleration_structure *wrapped_top_level_acceleration_structure, VkDeviceAddress top_level_acceleration_structure_instance_buffer_device_memory_range_base, brx_pal_scratch_buffer *wrapped_scratch_buffer)
 {
     assert(NULL != wrapped_top_level_acceleration_structure);
     VkAccelerationStructureKHR const destination_acceleration_structure = static_cast<brx_pal_vk_top_level_acceleration_structure *>(wrapped_top_level_acceleration_structure)->get_acceleration_structure();
 
     uint32_t const top_level_acceleration_structure_instance_count = static_cast<brx_pal_vk_top_level_acceleration_structure *>(wrapped_top_level_acceleration_structure)->get_instance_count();
 
-    assert(NULL != wrapped_top_level_acceleration_structure_instance_upload_buffer);
-    VkDeviceAddress const top_level_acceleration_structure_instance_upload_buffer_device_memory_range_base = static_cast<brx_pal_vk_top_level_acceleration_structure_instance_upload_buffer *>(wrapped_top_level_acceleration_structure_instance_upload_buffer)->get_device_memory_range_base();
+    assert(0U == (top_level_acceleration_structure_instance_buffer_device_memory_range_base % 16U));
 
     VkAccelerationStructureGeometryKHR const acceleration_structure_geometry = {
         VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_KHR,
@@ -913,7 +1768,7 @@ void brx_pal_vk_graphics_command_buffer::update_top_level_acceleration_structure
                  VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_INSTANCES_DATA_KHR,
                  NULL,
                  VK_FALSE,
-                 {top_level_acceleration_structure_instance_upload_buffer_device_memory_range_base}}}};
+                 {top_level_acceleration_structure_instance_buffer_device_memory_range_base}}}};
 
     assert(NULL != wrapped_scratch_buffer);
     VkDeviceAddress const scratch_buffer_device_memory_range_base = static_cast<brx_pal_vk_scratch_buffer *>(wrapped_scratch_buffer)->get_device_memory_range_base();
@@ -980,6 +1835,8 @@ brx_pal_vk_upload_command_buffer::brx_pal_vk_upload_command_buffer()
       m_pfn_cmd_reset_query_pool(NULL),
       m_pfn_cmd_write_acceleration_structures_properties(NULL),
       m_pfn_cmd_copy_acceleration_structure(NULL),
+      m_pfn_cmd_copy_acceleration_structure_to_memory(NULL),
+      m_pfn_cmd_copy_memory_to_acceleration_structure(NULL),
       m_pfn_end_command_buffer(NULL)
 {
 }
@@ -1091,12 +1948,16 @@ void brx_pal_vk_upload_command_buffer::init(bool support_ray_tracing, bool has_d
     assert(NULL == this->m_pfn_cmd_reset_query_pool);
     assert(NULL == this->m_pfn_cmd_write_acceleration_structures_properties);
     assert(NULL == this->m_pfn_cmd_copy_acceleration_structure);
+    assert(NULL == this->m_pfn_cmd_copy_acceleration_structure_to_memory);
+    assert(NULL == this->m_pfn_cmd_copy_memory_to_acceleration_structure);
     if (this->m_support_ray_tracing)
     {
         this->m_pfn_cmd_build_acceleration_structure = reinterpret_cast<PFN_vkCmdBuildAccelerationStructuresKHR>(pfn_get_device_proc_addr(device, "vkCmdBuildAccelerationStructuresKHR"));
         this->m_pfn_cmd_reset_query_pool = reinterpret_cast<PFN_vkCmdResetQueryPool>(pfn_get_device_proc_addr(device, "vkCmdResetQueryPool"));
         this->m_pfn_cmd_write_acceleration_structures_properties = reinterpret_cast<PFN_vkCmdWriteAccelerationStructuresPropertiesKHR>(pfn_get_device_proc_addr(device, "vkCmdWriteAccelerationStructuresPropertiesKHR"));
         this->m_pfn_cmd_copy_acceleration_structure = reinterpret_cast<PFN_vkCmdCopyAccelerationStructureKHR>(pfn_get_device_proc_addr(device, "vkCmdCopyAccelerationStructureKHR"));
+        this->m_pfn_cmd_copy_acceleration_structure_to_memory = reinterpret_cast<PFN_vkCmdCopyAccelerationStructureToMemoryKHR>(pfn_get_device_proc_addr(device, "vkCmdCopyAccelerationStructureToMemoryKHR"));
+        this->m_pfn_cmd_copy_memory_to_acceleration_structure = reinterpret_cast<PFN_vkCmdCopyMemoryToAccelerationStructureKHR>(pfn_get_device_proc_addr(device, "vkCmdCopyMemoryToAccelerationStructureKHR"));
     }
     assert(NULL == this->m_pfn_end_command_buffer);
     this->m_pfn_end_command_buffer = reinterpret_cast<PFN_vkEndCommandBuffer>(pfn_get_device_proc_addr(device, "vkEndCommandBuffer"));
@@ -1570,6 +2431,175 @@ void brx_pal_vk_upload_command_buffer::compact_bottom_level_acceleration_structu
     }
 }
 
+void brx_pal_vk_upload_command_buffer::write_serialized_bottom_level_acceleration_structure_size(brx_pal_compacted_bottom_level_acceleration_structure const *wrapped_compacted_bottom_level_acceleration_structure, brx_pal_serialized_bottom_level_acceleration_structure_size_query_pool *wrapped_serialized_bottom_level_acceleration_structure_size_query_pool, uint32_t query_index)
+{
+    assert(NULL != wrapped_compacted_bottom_level_acceleration_structure);
+    brx_pal_vk_compacted_bottom_level_acceleration_structure const *const unwrapped_compacted_bottom_level_acceleration_structure = static_cast<brx_pal_vk_compacted_bottom_level_acceleration_structure const *>(wrapped_compacted_bottom_level_acceleration_structure);
+    VkAccelerationStructureKHR const source_acceleration_structure = unwrapped_compacted_bottom_level_acceleration_structure->get_acceleration_structure();
+
+    assert(NULL != wrapped_serialized_bottom_level_acceleration_structure_size_query_pool);
+    VkQueryPool const query_pool = static_cast<brx_pal_vk_serialized_bottom_level_acceleration_structure_size_query_pool *>(wrapped_serialized_bottom_level_acceleration_structure_size_query_pool)->get_query_pool();
+
+    // NOTE: the compacted bottom level acceleration structure may be written by the "compact" in the same submission
+    VkBufferMemoryBarrier const load_barrier = {
+        VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+        NULL,
+        VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR,
+        VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR,
+        VK_QUEUE_FAMILY_IGNORED,
+        VK_QUEUE_FAMILY_IGNORED,
+        unwrapped_compacted_bottom_level_acceleration_structure->get_buffer(),
+        0U,
+        VK_WHOLE_SIZE};
+
+    if (this->m_has_dedicated_upload_queue)
+    {
+        if (this->m_upload_queue_family_index != this->m_graphics_queue_family_index)
+        {
+            assert(VK_NULL_HANDLE != this->m_upload_command_pool && VK_NULL_HANDLE != this->m_upload_command_buffer && VK_NULL_HANDLE == this->m_graphics_command_pool && VK_NULL_HANDLE == this->m_graphics_command_buffer && VK_NULL_HANDLE != this->m_upload_queue_submit_semaphore);
+
+            this->m_pfn_cmd_pipeline_barrier(this->m_upload_command_buffer, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, 0U, 0U, NULL, 1U, &load_barrier, 0U, NULL);
+
+            this->m_pfn_cmd_reset_query_pool(this->m_upload_command_buffer, query_pool, query_index, 1U);
+
+            this->m_pfn_cmd_write_acceleration_structures_properties(this->m_upload_command_buffer, 1U, &source_acceleration_structure, VK_QUERY_TYPE_ACCELERATION_STRUCTURE_SERIALIZATION_SIZE_KHR, query_pool, query_index);
+        }
+        else
+        {
+            assert(VK_NULL_HANDLE != this->m_upload_command_pool && VK_NULL_HANDLE != this->m_upload_command_buffer && VK_NULL_HANDLE == this->m_graphics_command_pool && VK_NULL_HANDLE == this->m_graphics_command_buffer && VK_NULL_HANDLE != this->m_upload_queue_submit_semaphore);
+
+            this->m_pfn_cmd_pipeline_barrier(this->m_upload_command_buffer, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, 0U, 0U, NULL, 1U, &load_barrier, 0U, NULL);
+
+            this->m_pfn_cmd_reset_query_pool(this->m_upload_command_buffer, query_pool, query_index, 1U);
+
+            this->m_pfn_cmd_write_acceleration_structures_properties(this->m_upload_command_buffer, 1U, &source_acceleration_structure, VK_QUERY_TYPE_ACCELERATION_STRUCTURE_SERIALIZATION_SIZE_KHR, query_pool, query_index);
+        }
+    }
+    else
+    {
+        assert(VK_NULL_HANDLE == this->m_upload_command_pool && VK_NULL_HANDLE == this->m_upload_command_buffer && VK_NULL_HANDLE != this->m_graphics_command_pool && VK_NULL_HANDLE != this->m_graphics_command_buffer && VK_NULL_HANDLE == this->m_upload_queue_submit_semaphore);
+
+        this->m_pfn_cmd_pipeline_barrier(this->m_graphics_command_buffer, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, 0U, 0U, NULL, 1U, &load_barrier, 0U, NULL);
+
+        this->m_pfn_cmd_reset_query_pool(this->m_graphics_command_buffer, query_pool, query_index, 1U);
+
+        this->m_pfn_cmd_write_acceleration_structures_properties(this->m_graphics_command_buffer, 1U, &source_acceleration_structure, VK_QUERY_TYPE_ACCELERATION_STRUCTURE_SERIALIZATION_SIZE_KHR, query_pool, query_index);
+    }
+}
+
+void brx_pal_vk_upload_command_buffer::serialize_compacted_bottom_level_acceleration_structure(brx_pal_serialized_bottom_level_acceleration_structure_buffer *wrapped_destination_serialized_bottom_level_acceleration_structure_buffer, brx_pal_compacted_bottom_level_acceleration_structure const *wrapped_source_compacted_bottom_level_acceleration_structure)
+{
+    assert(NULL != wrapped_source_compacted_bottom_level_acceleration_structure);
+    brx_pal_vk_compacted_bottom_level_acceleration_structure const *const unwrapped_source_compacted_bottom_level_acceleration_structure = static_cast<brx_pal_vk_compacted_bottom_level_acceleration_structure const *>(wrapped_source_compacted_bottom_level_acceleration_structure);
+
+    assert(NULL != wrapped_destination_serialized_bottom_level_acceleration_structure_buffer);
+    brx_pal_vk_serialized_bottom_level_acceleration_structure_buffer const *const unwrapped_destination_serialized_bottom_level_acceleration_structure_buffer = static_cast<brx_pal_vk_serialized_bottom_level_acceleration_structure_buffer *>(wrapped_destination_serialized_bottom_level_acceleration_structure_buffer);
+
+    VkCopyAccelerationStructureToMemoryInfoKHR const copy_acceleration_structure_to_memory_info = {
+        VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_TO_MEMORY_INFO_KHR,
+        NULL,
+        unwrapped_source_compacted_bottom_level_acceleration_structure->get_acceleration_structure(),
+        {.deviceAddress = unwrapped_destination_serialized_bottom_level_acceleration_structure_buffer->get_device_memory_range_base()},
+        VK_COPY_ACCELERATION_STRUCTURE_MODE_SERIALIZE_KHR};
+
+    VkBufferMemoryBarrier const load_barrier = {
+        VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+        NULL,
+        VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR,
+        VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR,
+        VK_QUEUE_FAMILY_IGNORED,
+        VK_QUEUE_FAMILY_IGNORED,
+        unwrapped_source_compacted_bottom_level_acceleration_structure->get_buffer(),
+        0U,
+        VK_WHOLE_SIZE};
+
+    // NOTE: the serialized data is read by the host after we use the fence to wait for the GPU completion
+    VkBufferMemoryBarrier const store_barrier = {
+        VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+        NULL,
+        VK_ACCESS_TRANSFER_WRITE_BIT,
+        VK_ACCESS_HOST_READ_BIT,
+        VK_QUEUE_FAMILY_IGNORED,
+        VK_QUEUE_FAMILY_IGNORED,
+        unwrapped_destination_serialized_bottom_level_acceleration_structure_buffer->get_buffer(),
+        0U,
+        VK_WHOLE_SIZE};
+
+    if (this->m_has_dedicated_upload_queue)
+    {
+        if (this->m_upload_queue_family_index != this->m_graphics_queue_family_index)
+        {
+            assert(VK_NULL_HANDLE != this->m_upload_command_pool && VK_NULL_HANDLE != this->m_upload_command_buffer && VK_NULL_HANDLE == this->m_graphics_command_pool && VK_NULL_HANDLE == this->m_graphics_command_buffer && VK_NULL_HANDLE != this->m_upload_queue_submit_semaphore);
+
+            this->m_pfn_cmd_pipeline_barrier(this->m_upload_command_buffer, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, 0U, 0U, NULL, 1U, &load_barrier, 0U, NULL);
+
+            this->m_pfn_cmd_copy_acceleration_structure_to_memory(this->m_upload_command_buffer, &copy_acceleration_structure_to_memory_info);
+
+            this->m_pfn_cmd_pipeline_barrier(this->m_upload_command_buffer, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, VK_PIPELINE_STAGE_HOST_BIT, 0U, 0U, NULL, 1U, &store_barrier, 0U, NULL);
+        }
+        else
+        {
+            assert(VK_NULL_HANDLE != this->m_upload_command_pool && VK_NULL_HANDLE != this->m_upload_command_buffer && VK_NULL_HANDLE == this->m_graphics_command_pool && VK_NULL_HANDLE == this->m_graphics_command_buffer && VK_NULL_HANDLE != this->m_upload_queue_submit_semaphore);
+
+            this->m_pfn_cmd_pipeline_barrier(this->m_upload_command_buffer, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, 0U, 0U, NULL, 1U, &load_barrier, 0U, NULL);
+
+            this->m_pfn_cmd_copy_acceleration_structure_to_memory(this->m_upload_command_buffer, &copy_acceleration_structure_to_memory_info);
+
+            this->m_pfn_cmd_pipeline_barrier(this->m_upload_command_buffer, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, VK_PIPELINE_STAGE_HOST_BIT, 0U, 0U, NULL, 1U, &store_barrier, 0U, NULL);
+        }
+    }
+    else
+    {
+        assert(VK_NULL_HANDLE == this->m_upload_command_pool && VK_NULL_HANDLE == this->m_upload_command_buffer && VK_NULL_HANDLE != this->m_graphics_command_pool && VK_NULL_HANDLE != this->m_graphics_command_buffer && VK_NULL_HANDLE == this->m_upload_queue_submit_semaphore);
+
+        this->m_pfn_cmd_pipeline_barrier(this->m_graphics_command_buffer, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, 0U, 0U, NULL, 1U, &load_barrier, 0U, NULL);
+
+        this->m_pfn_cmd_copy_acceleration_structure_to_memory(this->m_graphics_command_buffer, &copy_acceleration_structure_to_memory_info);
+
+        this->m_pfn_cmd_pipeline_barrier(this->m_graphics_command_buffer, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, VK_PIPELINE_STAGE_HOST_BIT, 0U, 0U, NULL, 1U, &store_barrier, 0U, NULL);
+    }
+}
+
+void brx_pal_vk_upload_command_buffer::deserialize_compacted_bottom_level_acceleration_structure(brx_pal_compacted_bottom_level_acceleration_structure *wrapped_destination_compacted_bottom_level_acceleration_structure, brx_pal_serialized_bottom_level_acceleration_structure_buffer const *wrapped_source_serialized_bottom_level_acceleration_structure_buffer)
+{
+    // NOTE: we do NOT need the barrier to synchronize the serialized data written by the host, since the host writes are implicitly visible to the GPU by the "vkQueueSubmit"
+
+    assert(NULL != wrapped_source_serialized_bottom_level_acceleration_structure_buffer);
+    VkDeviceAddress const source_serialized_bottom_level_acceleration_structure_buffer_device_memory_range_base = static_cast<brx_pal_vk_serialized_bottom_level_acceleration_structure_buffer const *>(wrapped_source_serialized_bottom_level_acceleration_structure_buffer)->get_device_memory_range_base();
+
+    assert(NULL != wrapped_destination_compacted_bottom_level_acceleration_structure);
+    VkAccelerationStructureKHR const destination_acceleration_structure = static_cast<brx_pal_vk_compacted_bottom_level_acceleration_structure *>(wrapped_destination_compacted_bottom_level_acceleration_structure)->get_acceleration_structure();
+
+    VkCopyMemoryToAccelerationStructureInfoKHR const copy_memory_to_acceleration_structure_info = {
+        VK_STRUCTURE_TYPE_COPY_MEMORY_TO_ACCELERATION_STRUCTURE_INFO_KHR,
+        NULL,
+        {.deviceAddress = source_serialized_bottom_level_acceleration_structure_buffer_device_memory_range_base},
+        destination_acceleration_structure,
+        VK_COPY_ACCELERATION_STRUCTURE_MODE_DESERIALIZE_KHR};
+
+    if (this->m_has_dedicated_upload_queue)
+    {
+        if (this->m_upload_queue_family_index != this->m_graphics_queue_family_index)
+        {
+            assert(VK_NULL_HANDLE != this->m_upload_command_pool && VK_NULL_HANDLE != this->m_upload_command_buffer && VK_NULL_HANDLE == this->m_graphics_command_pool && VK_NULL_HANDLE == this->m_graphics_command_buffer && VK_NULL_HANDLE != this->m_upload_queue_submit_semaphore);
+
+            this->m_pfn_cmd_copy_memory_to_acceleration_structure(this->m_upload_command_buffer, &copy_memory_to_acceleration_structure_info);
+        }
+        else
+        {
+            assert(VK_NULL_HANDLE != this->m_upload_command_pool && VK_NULL_HANDLE != this->m_upload_command_buffer && VK_NULL_HANDLE == this->m_graphics_command_pool && VK_NULL_HANDLE == this->m_graphics_command_buffer && VK_NULL_HANDLE != this->m_upload_queue_submit_semaphore);
+
+            this->m_pfn_cmd_copy_memory_to_acceleration_structure(this->m_upload_command_buffer, &copy_memory_to_acceleration_structure_info);
+        }
+    }
+    else
+    {
+        assert(VK_NULL_HANDLE == this->m_upload_command_pool && VK_NULL_HANDLE == this->m_upload_command_buffer && VK_NULL_HANDLE != this->m_graphics_command_pool && VK_NULL_HANDLE != this->m_graphics_command_buffer && VK_NULL_HANDLE == this->m_upload_queue_submit_semaphore);
+
+        this->m_pfn_cmd_copy_memory_to_acceleration_structure(this->m_graphics_command_buffer, &copy_memory_to_acceleration_structure_info);
+    }
+}
+
 void brx_pal_vk_upload_command_buffer::release(uint32_t storage_asset_buffer_count, brx_pal_storage_asset_buffer const *const *wrapped_storage_asset_buffers, uint32_t sampled_asset_image_subresource_count, BRX_PAL_SAMPLED_ASSET_IMAGE_SUBRESOURCE const *wrapped_sampled_asset_image_subresources, uint32_t compacted_bottom_level_acceleration_structure_count, brx_pal_compacted_bottom_level_acceleration_structure const *const *wrapped_compacted_bottom_level_acceleration_structures)
 {
     mcrt_vector<VkBufferMemoryBarrier> upload_queue_family_buffer_release_barriers(static_cast<size_t>(storage_asset_buffer_count));
@@ -1600,7 +2630,7 @@ void brx_pal_vk_upload_command_buffer::release(uint32_t storage_asset_buffer_cou
             VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
             NULL,
             VK_ACCESS_TRANSFER_WRITE_BIT,
-            VK_ACCESS_SHADER_READ_BIT,
+            VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT,
             VK_QUEUE_FAMILY_IGNORED,
             VK_QUEUE_FAMILY_IGNORED,
             storage_asset_buffer,
@@ -1670,7 +2700,7 @@ void brx_pal_vk_upload_command_buffer::release(uint32_t storage_asset_buffer_cou
     VkPipelineStageFlags const upload_queue_family_release_destination_stage = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
 
     VkPipelineStageFlags const graphics_queue_family_buffer_image_release_source_stage = VK_PIPELINE_STAGE_TRANSFER_BIT;
-    VkPipelineStageFlags const graphics_queue_family_buffer_image_release_destination_stage = (!this->m_support_ray_tracing) ? (g_graphics_queue_family_graphics_compute_pipeline_shader_read_stages) : (g_graphics_queue_family_graphics_compute_pipeline_shader_read_stages | g_graphics_queue_family_ray_tracing_pipeline_shader_read_stages);
+    VkPipelineStageFlags const graphics_queue_family_buffer_image_release_destination_stage = (!this->m_support_ray_tracing) ? (VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | g_graphics_queue_family_graphics_compute_pipeline_shader_read_stages) : (VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | g_graphics_queue_family_graphics_compute_pipeline_shader_read_stages | g_graphics_queue_family_ray_tracing_pipeline_shader_read_stages);
 
     VkPipelineStageFlags const upload_queue_family_acceleration_structure_release_source_stage = VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR;
 
@@ -1752,3 +2782,413 @@ void brx_pal_vk_upload_command_buffer::end()
         assert(VK_SUCCESS == res_end_graphics_command_buffer);
     }
 }
+
+brx_pal_vk_compute_command_buffer::brx_pal_vk_compute_command_buffer()
+    : m_command_pool(VK_NULL_HANDLE),
+      m_command_buffer(VK_NULL_HANDLE),
+      m_compute_queue_submit_semaphore(VK_NULL_HANDLE),
+      m_pfn_begin_command_buffer(NULL),
+      m_pfn_cmd_pipeline_barrier(NULL),
+#ifndef NDEBUG
+      m_pfn_cmd_begin_debug_utils_label(NULL),
+      m_pfn_cmd_end_debug_utils_label(NULL),
+#endif
+      m_pfn_cmd_bind_pipeline(NULL),
+      m_pfn_cmd_bind_descriptor_sets(NULL),
+      m_pfn_cmd_push_constants(NULL),
+      m_pfn_cmd_dispatch(NULL),
+      m_pfn_end_command_buffer(NULL)
+{
+}
+
+void brx_pal_vk_compute_command_buffer::init(bool support_ray_tracing, bool has_dedicated_compute_queue, uint32_t graphics_queue_family_index, uint32_t compute_queue_family_index, PFN_vkGetInstanceProcAddr pfn_get_instance_proc_addr, VkInstance instance, PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+{
+    this->m_support_ray_tracing = support_ray_tracing;
+
+    this->m_has_dedicated_compute_queue = has_dedicated_compute_queue;
+    this->m_graphics_queue_family_index = graphics_queue_family_index;
+    this->m_compute_queue_family_index = compute_queue_family_index;
+
+    PFN_vkCreateCommandPool const pfn_create_command_pool = reinterpret_cast<PFN_vkCreateCommandPool>(pfn_get_device_proc_addr(device, "vkCreateCommandPool"));
+    assert(NULL != pfn_create_command_pool);
+    PFN_vkAllocateCommandBuffers const pfn_allocate_command_buffers = reinterpret_cast<PFN_vkAllocateCommandBuffers>(pfn_get_device_proc_addr(device, "vkAllocateCommandBuffers"));
+    assert(NULL != pfn_allocate_command_buffers);
+    PFN_vkCreateSemaphore const pfn_create_semaphore = reinterpret_cast<PFN_vkCreateSemaphore>(pfn_get_device_proc_addr(device, "vkCreateSemaphore"));
+    assert(NULL != pfn_create_semaphore);
+
+    // the compute command buffer will be submitted to the graphics queue if there is no dedicated compute queue
+    assert(VK_NULL_HANDLE == this->m_command_pool);
+    VkCommandPoolCreateInfo const command_pool_create_info = {
+        VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+        NULL,
+        0U,
+        this->m_has_dedicated_compute_queue ? this->m_compute_queue_family_index : this->m_graphics_queue_family_index};
+    VkResult const res_create_command_pool = pfn_create_command_pool(device, &command_pool_create_info, allocation_callbacks, &this->m_command_pool);
+    assert(VK_SUCCESS == res_create_command_pool);
+
+    assert(VK_NULL_HANDLE == this->m_command_buffer);
+    VkCommandBufferAllocateInfo const command_buffer_allocate_info = {
+        VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+        NULL,
+        this->m_command_pool,
+        VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+        1U};
+    VkResult const res_allocate_command_buffers = pfn_allocate_command_buffers(device, &command_buffer_allocate_info, &this->m_command_buffer);
+    assert(VK_SUCCESS == res_allocate_command_buffers);
+
+    assert(VK_NULL_HANDLE == this->m_compute_queue_submit_semaphore);
+    if (this->m_has_dedicated_compute_queue)
+    {
+        VkSemaphoreCreateInfo const compute_queue_submit_semaphore_create_info = {
+            VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+            NULL,
+            0U};
+        VkResult const res_create_compute_queue_submit_semaphore = pfn_create_semaphore(device, &compute_queue_submit_semaphore_create_info, allocation_callbacks, &this->m_compute_queue_submit_semaphore);
+        assert(VK_SUCCESS == res_create_compute_queue_submit_semaphore);
+    }
+
+    assert(NULL == this->m_pfn_begin_command_buffer);
+    this->m_pfn_begin_command_buffer = reinterpret_cast<PFN_vkBeginCommandBuffer>(pfn_get_device_proc_addr(device, "vkBeginCommandBuffer"));
+    assert(NULL == this->m_pfn_cmd_pipeline_barrier);
+    this->m_pfn_cmd_pipeline_barrier = reinterpret_cast<PFN_vkCmdPipelineBarrier>(pfn_get_device_proc_addr(device, "vkCmdPipelineBarrier"));
+#ifndef NDEBUG
+    assert(NULL == this->m_pfn_cmd_begin_debug_utils_label);
+    this->m_pfn_cmd_begin_debug_utils_label = reinterpret_cast<PFN_vkCmdBeginDebugUtilsLabelEXT>(pfn_get_instance_proc_addr(instance, "vkCmdBeginDebugUtilsLabelEXT"));
+    assert(NULL == this->m_pfn_cmd_end_debug_utils_label);
+    this->m_pfn_cmd_end_debug_utils_label = reinterpret_cast<PFN_vkCmdEndDebugUtilsLabelEXT>(pfn_get_instance_proc_addr(instance, "vkCmdEndDebugUtilsLabelEXT"));
+#endif
+    assert(NULL == this->m_pfn_cmd_bind_pipeline);
+    this->m_pfn_cmd_bind_pipeline = reinterpret_cast<PFN_vkCmdBindPipeline>(pfn_get_device_proc_addr(device, "vkCmdBindPipeline"));
+    assert(NULL == this->m_pfn_cmd_bind_descriptor_sets);
+    this->m_pfn_cmd_bind_descriptor_sets = reinterpret_cast<PFN_vkCmdBindDescriptorSets>(pfn_get_device_proc_addr(device, "vkCmdBindDescriptorSets"));
+    assert(NULL == this->m_pfn_cmd_push_constants);
+    this->m_pfn_cmd_push_constants = reinterpret_cast<PFN_vkCmdPushConstants>(pfn_get_device_proc_addr(device, "vkCmdPushConstants"));
+    assert(NULL == this->m_pfn_cmd_dispatch);
+    this->m_pfn_cmd_dispatch = reinterpret_cast<PFN_vkCmdDispatch>(pfn_get_device_proc_addr(device, "vkCmdDispatch"));
+    assert(NULL == this->m_pfn_end_command_buffer);
+    this->m_pfn_end_command_buffer = reinterpret_cast<PFN_vkEndCommandBuffer>(pfn_get_device_proc_addr(device, "vkEndCommandBuffer"));
+}
+
+void brx_pal_vk_compute_command_buffer::uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+{
+    PFN_vkDestroyCommandPool const pfn_destroy_command_pool = reinterpret_cast<PFN_vkDestroyCommandPool>(pfn_get_device_proc_addr(device, "vkDestroyCommandPool"));
+    assert(NULL != pfn_destroy_command_pool);
+    PFN_vkFreeCommandBuffers const pfn_free_command_buffers = reinterpret_cast<PFN_vkFreeCommandBuffers>(pfn_get_device_proc_addr(device, "vkFreeCommandBuffers"));
+    assert(NULL != pfn_free_command_buffers);
+    PFN_vkDestroySemaphore const pfn_destroy_semaphore = reinterpret_cast<PFN_vkDestroySemaphore>(pfn_get_device_proc_addr(device, "vkDestroySemaphore"));
+    assert(NULL != pfn_destroy_semaphore);
+
+    assert(VK_NULL_HANDLE != this->m_command_buffer);
+    pfn_free_command_buffers(device, this->m_command_pool, 1U, &this->m_command_buffer);
+    this->m_command_buffer = VK_NULL_HANDLE;
+
+    assert(VK_NULL_HANDLE != this->m_command_pool);
+    pfn_destroy_command_pool(device, this->m_command_pool, allocation_callbacks);
+    this->m_command_pool = VK_NULL_HANDLE;
+
+    if (this->m_has_dedicated_compute_queue)
+    {
+        assert(VK_NULL_HANDLE != this->m_compute_queue_submit_semaphore);
+        pfn_destroy_semaphore(device, this->m_compute_queue_submit_semaphore, allocation_callbacks);
+        this->m_compute_queue_submit_semaphore = VK_NULL_HANDLE;
+    }
+    else
+    {
+        assert(VK_NULL_HANDLE == this->m_compute_queue_submit_semaphore);
+    }
+}
+
+brx_pal_vk_compute_command_buffer::~brx_pal_vk_compute_command_buffer()
+{
+    assert(VK_NULL_HANDLE == this->m_command_pool);
+    assert(VK_NULL_HANDLE == this->m_command_buffer);
+    assert(VK_NULL_HANDLE == this->m_compute_queue_submit_semaphore);
+}
+
+VkCommandPool brx_pal_vk_compute_command_buffer::get_command_pool() const
+{
+    return this->m_command_pool;
+}
+
+VkCommandBuffer brx_pal_vk_compute_command_buffer::get_command_buffer() const
+{
+    return this->m_command_buffer;
+}
+
+VkSemaphore brx_pal_vk_compute_command_buffer::get_compute_queue_submit_semaphore() const
+{
+    return this->m_compute_queue_submit_semaphore;
+}
+
+void brx_pal_vk_compute_command_buffer::begin()
+{
+    VkCommandBufferBeginInfo command_buffer_begin_info = {
+        VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+        NULL,
+        VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+        NULL};
+    VkResult res_begin_command_buffer = this->m_pfn_begin_command_buffer(this->m_command_buffer, &command_buffer_begin_info);
+    assert(VK_SUCCESS == res_begin_command_buffer);
+}
+
+void brx_pal_vk_compute_command_buffer::begin_debug_utils_label(char const *label_name)
+{
+#ifndef NDEBUG
+    VkDebugUtilsLabelEXT debug_utils_label = {VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT, NULL, label_name, {1.0F, 1.0F, 1.0F, 1.0F}};
+    this->m_pfn_cmd_begin_debug_utils_label(this->m_command_buffer, &debug_utils_label);
+#endif
+}
+
+void brx_pal_vk_compute_command_buffer::end_debug_utils_label()
+{
+#ifndef NDEBUG
+    this->m_pfn_cmd_end_debug_utils_label(this->m_command_buffer);
+#endif
+}
+
+void brx_pal_vk_compute_command_buffer::compute_pass_load(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *wrapped_storage_buffers, BRX_PAL_COMPUTE_PASS_STORAGE_BUFFER_LOAD_OPERATION const *storage_buffer_load_operations, uint32_t storage_image_count, brx_pal_storage_image const *const *wrapped_storage_images, BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_LOAD_OPERATION const *storage_image_load_operations)
+{
+    // the content is discarded (DONT_CARE) and thus there is no need to acquire the ownership from the graphics queue family
+    mcrt_vector<VkBufferMemoryBarrier> buffer_load_barriers(static_cast<size_t>(storage_buffer_count));
+
+    mcrt_vector<VkImageMemoryBarrier> image_load_barriers(static_cast<size_t>(storage_image_count));
+
+    for (uint32_t storage_buffer_index = 0U; storage_buffer_index < storage_buffer_count; ++storage_buffer_index)
+    {
+        VkBuffer const storage_buffer = static_cast<brx_pal_vk_storage_buffer const *>(wrapped_storage_buffers[storage_buffer_index])->get_buffer();
+
+        assert(BRX_PAL_COMPUTE_PASS_STORAGE_BUFFER_LOAD_OPERATION_DONT_CARE == storage_buffer_load_operations[storage_buffer_index]);
+
+        buffer_load_barriers[storage_buffer_index] = VkBufferMemoryBarrier{
+            VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+            NULL,
+            0U,
+            VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+            VK_QUEUE_FAMILY_IGNORED,
+            VK_QUEUE_FAMILY_IGNORED,
+            storage_buffer,
+            0U,
+            VK_WHOLE_SIZE};
+    }
+
+    for (uint32_t storage_image_index = 0U; storage_image_index < storage_image_count; ++storage_image_index)
+    {
+        VkImage const storage_image = static_cast<brx_pal_vk_storage_image const *>(wrapped_storage_images[storage_image_index])->get_image();
+
+        VkImageSubresourceRange const storage_image_subresource_range = {VK_IMAGE_ASPECT_COLOR_BIT, 0U, 1U, 0U, 1U};
+
+        assert(BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_LOAD_OPERATION_DONT_CARE == storage_image_load_operations[storage_image_index]);
+
+        image_load_barriers[storage_image_index] =
+            VkImageMemoryBarrier{
+                VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+                NULL,
+                0U,
+                VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+                VK_IMAGE_LAYOUT_UNDEFINED,
+                VK_IMAGE_LAYOUT_GENERAL,
+                VK_QUEUE_FAMILY_IGNORED,
+                VK_QUEUE_FAMILY_IGNORED,
+                storage_image,
+                storage_image_subresource_range};
+    }
+
+    this->m_pfn_cmd_pipeline_barrier(this->m_command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0U, 0U, NULL, static_cast<uint32_t>(buffer_load_barriers.size()), buffer_load_barriers.data(), static_cast<uint32_t>(image_load_barriers.size()), image_load_barriers.data());
+}
+
+void brx_pal_vk_compute_command_buffer::bind_compute_pipeline(brx_pal_compute_pipeline const *wrapped_compute_pipeline)
+{
+    assert(NULL != wrapped_compute_pipeline);
+    VkPipeline const compute_pipeline = static_cast<brx_pal_vk_compute_pipeline const *>(wrapped_compute_pipeline)->get_pipeline();
+
+    this->m_pfn_cmd_bind_pipeline(this->m_command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, compute_pipeline);
+}
+
+void brx_pal_vk_compute_command_buffer::bind_compute_descriptor_sets(brx_pal_pipeline_layout const *wrapped_pipeline_layout, uint32_t descriptor_set_count, brx_pal_descriptor_set const *const *wrapped_descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets)
+{
+    assert(NULL != wrapped_pipeline_layout);
+    assert(NULL != wrapped_descriptor_sets);
+    VkPipelineLayout const pipeline_layout = static_cast<brx_pal_vk_pipeline_layout const *>(wrapped_pipeline_layout)->get_pipeline_layout();
+
+    mcrt_vector<VkDescriptorSet> descriptor_sets(static_cast<size_t>(descriptor_set_count));
+    for (uint32_t descriptor_set_index = 0U; descriptor_set_index < descriptor_set_count; ++descriptor_set_index)
+    {
+        assert(NULL != wrapped_descriptor_sets[descriptor_set_index]);
+        descriptor_sets[descriptor_set_index] = static_cast<brx_pal_vk_descriptor_set const *>(wrapped_descriptor_sets[descriptor_set_index])->get_descriptor_set();
+    }
+
+    this->m_pfn_cmd_bind_descriptor_sets(this->m_command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_layout, 0U, descriptor_set_count, &descriptor_sets[0], dynamic_offet_count, dynamic_offsets);
+}
+
+void brx_pal_vk_compute_command_buffer::push_compute_constants(brx_pal_pipeline_layout const *wrapped_pipeline_layout, uint32_t offset, uint32_t size, void const *constants)
+{
+    assert(NULL != wrapped_pipeline_layout);
+    assert(NULL != constants);
+    assert(0U == (offset & 3U));
+    assert(0U == (size & 3U));
+    assert((offset + size) <= BRX_PAL_MAX_PUSH_CONSTANT_SIZE);
+    VkPipelineLayout const pipeline_layout = static_cast<brx_pal_vk_pipeline_layout const *>(wrapped_pipeline_layout)->get_pipeline_layout();
+
+    this->m_pfn_cmd_push_constants(this->m_command_buffer, pipeline_layout, VK_SHADER_STAGE_ALL, offset, size, constants);
+}
+
+void brx_pal_vk_compute_command_buffer::dispatch(uint32_t group_count_x, uint32_t group_count_y, uint32_t group_count_z)
+{
+    this->m_pfn_cmd_dispatch(this->m_command_buffer, group_count_x, group_count_y, group_count_z);
+}
+
+void brx_pal_vk_compute_command_buffer::compute_pass_barrier(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *wrapped_storage_buffers, uint32_t storage_image_count, brx_pal_storage_image const *const *wrapped_storage_images)
+{
+    mcrt_vector<VkBufferMemoryBarrier> buffer_intermediate_barriers(static_cast<size_t>(storage_buffer_count));
+
+    mcrt_vector<VkImageMemoryBarrier> image_intermediate_barriers(static_cast<size_t>(storage_image_count));
+
+    for (uint32_t storage_buffer_index = 0U; storage_buffer_index < storage_buffer_count; ++storage_buffer_index)
+    {
+        VkBuffer const storage_buffer = static_cast<brx_pal_vk_storage_buffer const *>(wrapped_storage_buffers[storage_buffer_index])->get_buffer();
+
+        buffer_intermediate_barriers[storage_buffer_index] = VkBufferMemoryBarrier{
+            VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+            NULL,
+            VK_ACCESS_SHADER_WRITE_BIT,
+            VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+            VK_QUEUE_FAMILY_IGNORED,
+            VK_QUEUE_FAMILY_IGNORED,
+            storage_buffer,
+            0U,
+            VK_WHOLE_SIZE};
+    }
+
+    for (uint32_t storage_image_index = 0U; storage_image_index < storage_image_count; ++storage_image_index)
+    {
+        VkImage const storage_image = static_cast<brx_pal_vk_storage_image const *>(wrapped_storage_images[storage_image_index])->get_image();
+
+        VkImageSubresourceRange const storage_image_subresource_range = {VK_IMAGE_ASPECT_COLOR_BIT, 0U, 1U, 0U, 1U};
+
+        image_intermediate_barriers[storage_image_index] =
+            VkImageMemoryBarrier{
+                VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+                NULL,
+                VK_ACCESS_SHADER_WRITE_BIT,
+                VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+                VK_IMAGE_LAYOUT_GENERAL,
+                VK_IMAGE_LAYOUT_GENERAL,
+                VK_QUEUE_FAMILY_IGNORED,
+                VK_QUEUE_FAMILY_IGNORED,
+                storage_image,
+                storage_image_subresource_range};
+    }
+
+    this->m_pfn_cmd_pipeline_barrier(this->m_command_buffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0U, 0U, NULL, static_cast<uint32_t>(buffer_intermediate_barriers.size()), buffer_intermediate_barriers.data(), static_cast<uint32_t>(image_intermediate_barriers.size()), image_intermediate_barriers.data());
+}
+
+void brx_pal_vk_compute_command_buffer::compute_pass_store(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *wrapped_storage_buffers, BRX_PAL_COMPUTE_PASS_STORAGE_BUFFER_STORE_OPERATION const *storage_buffer_store_operations, uint32_t storage_image_count, brx_pal_storage_image const *const *wrapped_storage_images, BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_STORE_OPERATION const *storage_image_store_operations)
+{
+    if (this->m_has_dedicated_compute_queue && (this->m_compute_queue_family_index != this->m_graphics_queue_family_index))
+    {
+        // release the ownership to the graphics queue family
+        mcrt_vector<VkBufferMemoryBarrier> buffer_release_barriers(static_cast<size_t>(storage_buffer_count));
+
+        mcrt_vector<VkImageMemoryBarrier> image_release_barriers(static_cast<size_t>(storage_image_count));
+
+        for (uint32_t storage_buffer_index = 0U; storage_buffer_index < storage_buffer_count; ++storage_buffer_index)
+        {
+            VkBuffer const storage_buffer = static_cast<brx_pal_vk_storage_buffer const *>(wrapped_storage_buffers[storage_buffer_index])->get_buffer();
+
+            assert(BRX_PAL_COMPUTE_PASS_STORAGE_BUFFER_STORE_OPERATION_FLUSH_FOR_READ_ONLY_STORAGE_BUFFER_AND_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BUFFER == storage_buffer_store_operations[storage_buffer_index]);
+
+            buffer_release_barriers[storage_buffer_index] = VkBufferMemoryBarrier{
+                VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+                NULL,
+                VK_ACCESS_SHADER_WRITE_BIT,
+                0U,
+                this->m_compute_queue_family_index,
+                this->m_graphics_queue_family_index,
+                storage_buffer,
+                0U,
+                VK_WHOLE_SIZE};
+        }
+
+        for (uint32_t storage_image_index = 0U; storage_image_index < storage_image_count; ++storage_image_index)
+        {
+            VkImage const storage_image = static_cast<brx_pal_vk_storage_image const *>(wrapped_storage_images[storage_image_index])->get_image();
+
+            VkImageSubresourceRange const storage_image_subresource_range = {VK_IMAGE_ASPECT_COLOR_BIT, 0U, 1U, 0U, 1U};
+
+            assert(BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_STORE_OPERATION_FLUSH_FOR_SAMPLED_IMAGE == storage_image_store_operations[storage_image_index]);
+
+            image_release_barriers[storage_image_index] =
+                VkImageMemoryBarrier{
+                    VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+                    NULL,
+                    VK_ACCESS_SHADER_WRITE_BIT,
+                    0U,
+                    VK_IMAGE_LAYOUT_GENERAL,
+                    VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                    this->m_compute_queue_family_index,
+                    this->m_graphics_queue_family_index,
+                    storage_image,
+                    storage_image_subresource_range};
+        }
+
+        // the graphics stages are NOT supported by the compute queue family
+        this->m_pfn_cmd_pipeline_barrier(this->m_command_buffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0U, 0U, NULL, static_cast<uint32_t>(buffer_release_barriers.size()), buffer_release_barriers.data(), static_cast<uint32_t>(image_release_barriers.size()), image_release_barriers.data());
+    }
+    else
+    {
+        mcrt_vector<VkBufferMemoryBarrier> buffer_store_barriers(static_cast<size_t>(storage_buffer_count));
+
+        mcrt_vector<VkImageMemoryBarrier> image_store_barriers(static_cast<size_t>(storage_image_count));
+
+        for (uint32_t storage_buffer_index = 0U; storage_buffer_index < storage_buffer_count; ++storage_buffer_index)
+        {
+            VkBuffer const storage_buffer = static_cast<brx_pal_vk_storage_buffer const *>(wrapped_storage_buffers[storage_buffer_index])->get_buffer();
+
+            assert(BRX_PAL_COMPUTE_PASS_STORAGE_BUFFER_STORE_OPERATION_FLUSH_FOR_READ_ONLY_STORAGE_BUFFER_AND_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BUFFER == storage_buffer_store_operations[storage_buffer_index]);
+
+            buffer_store_barriers[storage_buffer_index] = VkBufferMemoryBarrier{
+                VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+                NULL,
+                VK_ACCESS_SHADER_WRITE_BIT,
+                VK_ACCESS_SHADER_READ_BIT,
+                VK_QUEUE_FAMILY_IGNORED,
+                VK_QUEUE_FAMILY_IGNORED,
+                storage_buffer,
+                0U,
+                VK_WHOLE_SIZE};
+        }
+
+        for (uint32_t storage_image_index = 0U; storage_image_index < storage_image_count; ++storage_image_index)
+        {
+            VkImage const storage_image = static_cast<brx_pal_vk_storage_image const *>(wrapped_storage_images[storage_image_index])->get_image();
+
+            VkImageSubresourceRange const storage_image_subresource_range = {VK_IMAGE_ASPECT_COLOR_BIT, 0U, 1U, 0U, 1U};
+
+            assert(BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_STORE_OPERATION_FLUSH_FOR_SAMPLED_IMAGE == storage_image_store_operations[storage_image_index]);
+
+            image_store_barriers[storage_image_index] =
+                VkImageMemoryBarrier{
+                    VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+                    NULL,
+                    VK_ACCESS_SHADER_WRITE_BIT,
+                    VK_ACCESS_SHADER_READ_BIT,
+                    VK_IMAGE_LAYOUT_GENERAL,
+                    VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                    VK_QUEUE_FAMILY_IGNORED,
+                    VK_QUEUE_FAMILY_IGNORED,
+                    storage_image,
+                    storage_image_subresource_range};
+        }
+
+        // the same queue family as the graphics queue
+        VkPipelineStageFlags const graphics_queue_family_store_destination_stage = (!this->m_support_ray_tracing) ? (g_graphics_queue_family_graphics_compute_pipeline_shader_read_stages) : (g_graphics_queue_family_graphics_compute_pipeline_shader_read_stages | g_graphics_queue_family_ray_tracing_pipeline_shader_read_stages | g_graphics_queue_family_acceleration_structure_build_shader_read_stages);
+
+        this->m_pfn_cmd_pipeline_barrier(this->m_command_buffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, graphics_queue_family_store_destination_stage, 0U, 0U, NULL, static_cast<uint32_t>(buffer_store_barriers.size()), buffer_store_barriers.data(), static_cast<uint32_t>(image_store_barriers.size()), image_store_barriers.data());
+    }
+}
+
+void brx_pal_vk_compute_command_buffer::end()
+{
+    VkResult res_end_command_buffer = this->m_pfn_end_command_buffer(this->m_command_buffer);
+    assert(VK_SUCCESS == res_end_command_buffer);
+}
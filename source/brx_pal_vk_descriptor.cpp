@@ -26,7 +26,8 @@ brx_pal_vk_descriptor_set_layout::brx_pal_vk_descriptor_set_layout()
       m_sampler_descriptor_count(0U),
       m_storage_image_descriptor_count(0U),
       m_top_level_acceleration_structure_descriptor_count(0U),
-      m_unbounded_descriptor_type(static_cast<VkDescriptorType>(-1))
+      m_unbounded_descriptor_type(static_cast<VkDescriptorType>(-1)),
+      m_update_after_bind(false)
 {
 }
 
@@ -41,6 +42,19 @@ void brx_pal_vk_descriptor_set_layout::init(uint32_t support_ray_tracing, uint32
 
     mcrt_vector<VkDescriptorSetLayoutBinding> descriptor_set_bindings(static_cast<size_t>(descriptor_set_binding_count));
     mcrt_vector<VkDescriptorBindingFlagsEXT> binding_flags(static_cast<size_t>(descriptor_set_binding_count));
+    // the storage is reserved up front, and the address within "immutable_samplers" does NOT change when "push_back"
+    mcrt_vector<VkSampler> immutable_samplers;
+    {
+        uint32_t immutable_sampler_count = 0U;
+        for (uint32_t binding_index = 0U; binding_index < descriptor_set_binding_count; ++binding_index)
+        {
+            if (NULL != wrapped_descriptor_set_bindings[binding_index].immutable_samplers)
+            {
+                immutable_sampler_count += wrapped_descriptor_set_bindings[binding_index].descriptor_count;
+            }
+        }
+        immutable_samplers.reserve(immutable_sampler_count);
+    }
     assert(0U == this->m_dynamic_uniform_buffer_descriptor_count);
     assert(0U == this->m_storage_buffer_descriptor_count);
     assert(0U == this->m_sampled_image_descriptor_count);
@@ -119,6 +133,7 @@ void brx_pal_vk_descriptor_set_layout::init(uint32_t support_ray_tracing, uint32
             descriptor_set_bindings[binding_index].descriptorType = VK_DESCRIPTOR_TYPE_SAMPLER;
             assert(BRX_PAL_DESCRIPTOR_SET_LAYOUT_BINDING_DESCRIPTOR_COUNT_UNBOUNDED != wrapped_descriptor_set_bindings[binding_index].descriptor_count);
             descriptor_set_bindings[binding_index].descriptorCount = wrapped_descriptor_set_bindings[binding_index].descriptor_count;
+            // the immutable samplers still consume the sampler descriptors of the descriptor pool
             this->m_sampler_descriptor_count += wrapped_descriptor_set_bindings[binding_index].descriptor_count;
             binding_flags[binding_index] = 0U;
         }
@@ -152,7 +167,25 @@ void brx_pal_vk_descriptor_set_layout::init(uint32_t support_ray_tracing, uint32
         }
         // TODO:
         descriptor_set_bindings[binding_index].stageFlags = VK_SHADER_STAGE_ALL;
-        descriptor_set_bindings[binding_index].pImmutableSamplers = NULL;
+
+        if (NULL != wrapped_descriptor_set_bindings[binding_index].immutable_samplers)
+        {
+            assert(BRX_PAL_DESCRIPTOR_TYPE_SAMPLER == wrapped_descriptor_set_bindings[binding_index].descriptor_type);
+
+            size_t const new_immutable_sampler_index = immutable_samplers.size();
+            for (uint32_t descriptor_index = 0U; descriptor_index < wrapped_descriptor_set_bindings[binding_index].descriptor_count; ++descriptor_index)
+            {
+                assert(NULL != wrapped_descriptor_set_bindings[binding_index].immutable_samplers[descriptor_index]);
+                assert(immutable_samplers.size() < immutable_samplers.capacity());
+                immutable_samplers.push_back(static_cast<brx_pal_vk_sampler const *>(wrapped_descriptor_set_bindings[binding_index].immutable_samplers[descriptor_index])->get_sampler());
+            }
+
+            descriptor_set_bindings[binding_index].pImmutableSamplers = immutable_samplers.data() + new_immutable_sampler_index;
+        }
+        else
+        {
+            descriptor_set_bindings[binding_index].pImmutableSamplers = NULL;
+        }
     }
 
     VkDescriptorSetLayoutBindingFlagsCreateInfoEXT const descriptor_set_layout_binding_flags_create_info = {
@@ -173,6 +206,59 @@ void brx_pal_vk_descriptor_set_layout::init(uint32_t support_ray_tracing, uint32
     assert(VK_SUCCESS == res_create_global_descriptor_set_layout);
 }
 
+void brx_pal_vk_descriptor_set_layout::init_bindless(uint32_t read_only_storage_buffer_descriptor_count, uint32_t sampled_image_descriptor_count, uint32_t sampler_descriptor_count, PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+{
+    PFN_vkCreateDescriptorSetLayout const pfn_create_descriptor_set_layout = reinterpret_cast<PFN_vkCreateDescriptorSetLayout>(pfn_get_device_proc_addr(device, "vkCreateDescriptorSetLayout"));
+    assert(NULL != pfn_create_descriptor_set_layout);
+
+    assert(0U < read_only_storage_buffer_descriptor_count);
+    assert(0U < sampled_image_descriptor_count);
+    assert(0U < sampler_descriptor_count);
+
+    VkDescriptorSetLayoutBinding const descriptor_set_bindings[3] = {
+        {0U, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, read_only_storage_buffer_descriptor_count, VK_SHADER_STAGE_ALL, NULL},
+        {1U, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, sampled_image_descriptor_count, VK_SHADER_STAGE_ALL, NULL},
+        {2U, VK_DESCRIPTOR_TYPE_SAMPLER, sampler_descriptor_count, VK_SHADER_STAGE_ALL, NULL}};
+
+    // the descriptors which are NOT used by the GPU can be written even if the descriptor set is being used by the GPU
+    // the descriptors which have never been written are allowed to be NOT accessed by the GPU
+    VkDescriptorBindingFlagsEXT const binding_flags[3] = {
+        VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT | VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT | VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT,
+        VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT | VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT | VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT,
+        VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT | VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT | VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT};
+
+    VkDescriptorSetLayoutBindingFlagsCreateInfoEXT const descriptor_set_layout_binding_flags_create_info = {
+        VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO_EXT,
+        NULL,
+        sizeof(binding_flags) / sizeof(binding_flags[0]),
+        binding_flags};
+
+    VkDescriptorSetLayoutCreateInfo const descriptor_set_layout_create_info = {
+        VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+        &descriptor_set_layout_binding_flags_create_info,
+        VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT,
+        sizeof(descriptor_set_bindings) / sizeof(descriptor_set_bindings[0]),
+        descriptor_set_bindings};
+
+    assert(VK_NULL_HANDLE == this->m_descriptor_set_layout);
+    VkResult const res_create_descriptor_set_layout = pfn_create_descriptor_set_layout(device, &descriptor_set_layout_create_info, allocation_callbacks, &this->m_descriptor_set_layout);
+    assert(VK_SUCCESS == res_create_descriptor_set_layout);
+
+    assert(0U == this->m_dynamic_uniform_buffer_descriptor_count);
+    assert(0U == this->m_storage_buffer_descriptor_count);
+    this->m_storage_buffer_descriptor_count = read_only_storage_buffer_descriptor_count;
+    assert(0U == this->m_sampled_image_descriptor_count);
+    this->m_sampled_image_descriptor_count = sampled_image_descriptor_count;
+    assert(0U == this->m_sampler_descriptor_count);
+    this->m_sampler_descriptor_count = sampler_descriptor_count;
+    assert(0U == this->m_storage_image_descriptor_count);
+    assert(0U == this->m_top_level_acceleration_structure_descriptor_count);
+    assert(static_cast<VkDescriptorType>(-1) == this->m_unbounded_descriptor_type);
+
+    assert(!this->m_update_after_bind);
+    this->m_update_after_bind = true;
+}
+
 void brx_pal_vk_descriptor_set_layout::uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
 {
     PFN_vkDestroyDescriptorSetLayout const pfn_destroy_descriptor_set_layout = reinterpret_cast<PFN_vkDestroyDescriptorSetLayout>(pfn_get_device_proc_addr(device, "vkDestroyDescriptorSetLayout"));
@@ -230,6 +316,11 @@ VkDescriptorType brx_pal_vk_descriptor_set_layout::get_unbounded_descriptor_type
     return this->m_unbounded_descriptor_type;
 }
 
+bool brx_pal_vk_descriptor_set_layout::is_update_after_bind() const
+{
+    return this->m_update_after_bind;
+}
+
 brx_pal_vk_pipeline_layout::brx_pal_vk_pipeline_layout(VkPipelineLayout pipeline_layout) : m_pipeline_layout(pipeline_layout)
 {
 }
@@ -342,7 +433,7 @@ void brx_pal_vk_descriptor_set::init(bool support_ray_tracing, brx_pal_descripto
     VkDescriptorPoolCreateInfo const descriptor_pool_create_info = {
         VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
         NULL,
-        0U,
+        (!unwrapped_descriptor_set_layout->is_update_after_bind()) ? 0U : static_cast<VkDescriptorPoolCreateFlags>(VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT_EXT),
         1U,
         static_cast<uint32_t>(descriptor_pool_sizes.size()),
         &descriptor_pool_sizes[0]};
@@ -612,3 +703,308 @@ VkDescriptorSet brx_pal_vk_descriptor_set::get_descriptor_set() const
 {
     return this->m_descriptor_set;
 }
+
+brx_pal_vk_descriptor_update_template::brx_pal_vk_descriptor_update_template() : m_descriptor_update_template(VK_NULL_HANDLE), m_descriptor_count(0U)
+{
+}
+
+void brx_pal_vk_descriptor_update_template::init(brx_pal_descriptor_set_layout const *wrapped_descriptor_set_layout, uint32_t entry_count, BRX_PAL_DESCRIPTOR_UPDATE_TEMPLATE_ENTRY const *entries, bool support_descriptor_update_template, PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+{
+    assert(NULL != wrapped_descriptor_set_layout);
+    VkDescriptorSetLayout const descriptor_set_layout = static_cast<brx_pal_vk_descriptor_set_layout const *>(wrapped_descriptor_set_layout)->get_descriptor_set_layout();
+
+    assert(0U < entry_count);
+    assert(NULL != entries);
+
+    assert(0U == this->m_entries.size());
+    this->m_entries.assign(entries, entries + entry_count);
+
+    // each descriptor occupies one element of the packed data, and the stride is the same for all descriptor types
+    assert(0U == this->m_descriptor_update_template_entries.size());
+    this->m_descriptor_update_template_entries.resize(static_cast<size_t>(entry_count));
+
+    assert(0U == this->m_descriptor_count);
+    for (uint32_t entry_index = 0U; entry_index < entry_count; ++entry_index)
+    {
+        VkDescriptorType descriptor_type;
+        switch (entries[entry_index].descriptor_type)
+        {
+        case BRX_PAL_DESCRIPTOR_TYPE_DYNAMIC_UNIFORM_BUFFER:
+        {
+            descriptor_type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+        }
+        break;
+        case BRX_PAL_DESCRIPTOR_TYPE_READ_ONLY_STORAGE_BUFFER:
+        case BRX_PAL_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        {
+            descriptor_type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        }
+        break;
+        case BRX_PAL_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        {
+            descriptor_type = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+        }
+        break;
+        case BRX_PAL_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        {
+            descriptor_type = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+        }
+        break;
+        case BRX_PAL_DESCRIPTOR_TYPE_SAMPLER:
+        {
+            descriptor_type = VK_DESCRIPTOR_TYPE_SAMPLER;
+        }
+        break;
+        case BRX_PAL_DESCRIPTOR_TYPE_TOP_LEVEL_ACCELERATION_STRUCTURE:
+        {
+            descriptor_type = VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR;
+        }
+        break;
+        default:
+        {
+            assert(false);
+            descriptor_type = static_cast<VkDescriptorType>(-1);
+        }
+        }
+
+        this->m_descriptor_update_template_entries[entry_index] = VkDescriptorUpdateTemplateEntryKHR{
+            entries[entry_index].dst_binding,
+            entries[entry_index].dst_descriptor_start_index,
+            entries[entry_index].descriptor_count,
+            descriptor_type,
+            sizeof(brx_pal_vk_descriptor_update_template_data) * this->m_descriptor_count,
+            sizeof(brx_pal_vk_descriptor_update_template_data)};
+
+        this->m_descriptor_count += entries[entry_index].descriptor_count;
+    }
+
+    // the entries are written by the "vkUpdateDescriptorSets" when the VK_KHR_descriptor_update_template is NOT supported
+    assert(VK_NULL_HANDLE == this->m_descriptor_update_template);
+    if (support_descriptor_update_template)
+    {
+        PFN_vkCreateDescriptorUpdateTemplateKHR const pfn_create_descriptor_update_template = reinterpret_cast<PFN_vkCreateDescriptorUpdateTemplateKHR>(pfn_get_device_proc_addr(device, "vkCreateDescriptorUpdateTemplateKHR"));
+        assert(NULL != pfn_create_descriptor_update_template);
+
+        VkDescriptorUpdateTemplateCreateInfoKHR const descriptor_update_template_create_info = {
+            VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO_KHR,
+            NULL,
+            0U,
+            entry_count,
+            &this->m_descriptor_update_template_entries[0],
+            VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET_KHR,
+            descriptor_set_layout,
+            VK_PIPELINE_BIND_POINT_GRAPHICS,
+            VK_NULL_HANDLE,
+            0U};
+
+        VkResult const res_create_descriptor_update_template = pfn_create_descriptor_update_template(device, &descriptor_update_template_create_info, allocation_callbacks, &this->m_descriptor_update_template);
+        assert(VK_SUCCESS == res_create_descriptor_update_template);
+    }
+}
+
+void brx_pal_vk_descriptor_update_template::uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+{
+    if (VK_NULL_HANDLE != this->m_descriptor_update_template)
+    {
+        PFN_vkDestroyDescriptorUpdateTemplateKHR const pfn_destroy_descriptor_update_template = reinterpret_cast<PFN_vkDestroyDescriptorUpdateTemplateKHR>(pfn_get_device_proc_addr(device, "vkDestroyDescriptorUpdateTemplateKHR"));
+        assert(NULL != pfn_destroy_descriptor_update_template);
+
+        pfn_destroy_descriptor_update_template(device, this->m_descriptor_update_template, allocation_callbacks);
+        this->m_descriptor_update_template = VK_NULL_HANDLE;
+    }
+
+    this->m_entries.clear();
+    this->m_descriptor_update_template_entries.clear();
+    this->m_descriptor_count = 0U;
+}
+
+brx_pal_vk_descriptor_update_template::~brx_pal_vk_descriptor_update_template()
+{
+    assert(VK_NULL_HANDLE == this->m_descriptor_update_template);
+}
+
+void brx_pal_vk_descriptor_update_template::write_descriptor_sets(uint32_t descriptor_set_count, brx_pal_descriptor_set *const *wrapped_descriptor_sets, void const *const *src_descriptors, uint32_t const *src_dynamic_uniform_buffer_ranges, PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device) const
+{
+    PFN_vkUpdateDescriptorSetWithTemplateKHR const pfn_update_descriptor_set_with_template = (VK_NULL_HANDLE != this->m_descriptor_update_template) ? reinterpret_cast<PFN_vkUpdateDescriptorSetWithTemplateKHR>(pfn_get_device_proc_addr(device, "vkUpdateDescriptorSetWithTemplateKHR")) : NULL;
+    assert((VK_NULL_HANDLE == this->m_descriptor_update_template) || (NULL != pfn_update_descriptor_set_with_template));
+
+    PFN_vkUpdateDescriptorSets const pfn_update_descriptor_sets = (VK_NULL_HANDLE == this->m_descriptor_update_template) ? reinterpret_cast<PFN_vkUpdateDescriptorSets>(pfn_get_device_proc_addr(device, "vkUpdateDescriptorSets")) : NULL;
+    assert((VK_NULL_HANDLE != this->m_descriptor_update_template) || (NULL != pfn_update_descriptor_sets));
+
+    assert(NULL != wrapped_descriptor_sets);
+    assert(NULL != src_descriptors);
+
+    // the packed data of all descriptor sets is allocated at once
+    mcrt_vector<brx_pal_vk_descriptor_update_template_data> descriptor_update_template_data(static_cast<size_t>(this->m_descriptor_count) * descriptor_set_count);
+
+    for (uint32_t descriptor_set_index = 0U; descriptor_set_index < descriptor_set_count; ++descriptor_set_index)
+    {
+        uint32_t const base_descriptor_index = this->m_descriptor_count * descriptor_set_index;
+
+        uint32_t descriptor_index = base_descriptor_index;
+        for (BRX_PAL_DESCRIPTOR_UPDATE_TEMPLATE_ENTRY const &entry : this->m_entries)
+        {
+            for (uint32_t entry_descriptor_index = 0U; entry_descriptor_index < entry.descriptor_count; ++entry_descriptor_index)
+            {
+                void const *const src_descriptor = src_descriptors[descriptor_index];
+                assert(NULL != src_descriptor);
+
+                brx_pal_vk_descriptor_update_template_data &data = descriptor_update_template_data[descriptor_index];
+
+                switch (entry.descriptor_type)
+                {
+                case BRX_PAL_DESCRIPTOR_TYPE_DYNAMIC_UNIFORM_BUFFER:
+                {
+                    assert(NULL != src_dynamic_uniform_buffer_ranges);
+                    data.m_buffer_info.buffer = static_cast<brx_pal_vk_uniform_upload_buffer const *>(static_cast<brx_pal_uniform_upload_buffer const *>(src_descriptor))->get_buffer();
+                    data.m_buffer_info.offset = 0U;
+                    data.m_buffer_info.range = src_dynamic_uniform_buffer_ranges[descriptor_index];
+                }
+                break;
+                case BRX_PAL_DESCRIPTOR_TYPE_READ_ONLY_STORAGE_BUFFER:
+                {
+                    data.m_buffer_info.buffer = static_cast<brx_pal_vk_read_only_storage_buffer const *>(static_cast<brx_pal_read_only_storage_buffer const *>(src_descriptor))->get_buffer();
+                    data.m_buffer_info.offset = 0U;
+                    data.m_buffer_info.range = static_cast<brx_pal_vk_read_only_storage_buffer const *>(static_cast<brx_pal_read_only_storage_buffer const *>(src_descriptor))->get_size();
+                }
+                break;
+                case BRX_PAL_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+                {
+                    data.m_buffer_info.buffer = static_cast<brx_pal_vk_storage_buffer const *>(static_cast<brx_pal_storage_buffer const *>(src_descriptor))->get_buffer();
+                    data.m_buffer_info.offset = 0U;
+                    data.m_buffer_info.range = static_cast<brx_pal_vk_storage_buffer const *>(static_cast<brx_pal_storage_buffer const *>(src_descriptor))->get_size();
+                }
+                break;
+                case BRX_PAL_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+                {
+                    data.m_image_info.sampler = VK_NULL_HANDLE;
+                    data.m_image_info.imageView = static_cast<brx_pal_vk_sampled_image const *>(static_cast<brx_pal_sampled_image const *>(src_descriptor))->get_image_view();
+                    data.m_image_info.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+                }
+                break;
+                case BRX_PAL_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+                {
+                    data.m_image_info.sampler = VK_NULL_HANDLE;
+                    data.m_image_info.imageView = static_cast<brx_pal_vk_storage_image const *>(static_cast<brx_pal_storage_image const *>(src_descriptor))->get_image_view();
+                    data.m_image_info.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+                }
+                break;
+                case BRX_PAL_DESCRIPTOR_TYPE_SAMPLER:
+                {
+                    data.m_image_info.sampler = static_cast<brx_pal_vk_sampler const *>(static_cast<brx_pal_sampler const *>(src_descriptor))->get_sampler();
+                    data.m_image_info.imageView = VK_NULL_HANDLE;
+                    data.m_image_info.imageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+                }
+                break;
+                case BRX_PAL_DESCRIPTOR_TYPE_TOP_LEVEL_ACCELERATION_STRUCTURE:
+                {
+                    data.m_acceleration_structure = static_cast<brx_pal_vk_top_level_acceleration_structure const *>(static_cast<brx_pal_top_level_acceleration_structure const *>(src_descriptor))->get_acceleration_structure();
+                }
+                break;
+                default:
+                {
+                    assert(false);
+                }
+                }
+
+                ++descriptor_index;
+            }
+        }
+
+        assert((base_descriptor_index + this->m_descriptor_count) == descriptor_index);
+
+        assert(NULL != wrapped_descriptor_sets[descriptor_set_index]);
+        VkDescriptorSet const descriptor_set = static_cast<brx_pal_vk_descriptor_set const *>(wrapped_descriptor_sets[descriptor_set_index])->get_descriptor_set();
+
+        if (VK_NULL_HANDLE != this->m_descriptor_update_template)
+        {
+            pfn_update_descriptor_set_with_template(device, descriptor_set, this->m_descriptor_update_template, &descriptor_update_template_data[base_descriptor_index]);
+        }
+        else
+        {
+            this->write_descriptor_set_without_template(descriptor_set, &descriptor_update_template_data[base_descriptor_index], pfn_update_descriptor_sets, device);
+        }
+    }
+}
+
+void brx_pal_vk_descriptor_update_template::write_descriptor_set_without_template(VkDescriptorSet descriptor_set, brx_pal_vk_descriptor_update_template_data const *descriptor_update_template_data, PFN_vkUpdateDescriptorSets pfn_update_descriptor_sets, VkDevice device) const
+{
+    // the stride of the packed data is the size of the union, and the data is copied to the tightly packed arrays of each element type
+    mcrt_vector<VkDescriptorBufferInfo> buffer_info(static_cast<size_t>(this->m_descriptor_count));
+    mcrt_vector<VkDescriptorImageInfo> image_info(static_cast<size_t>(this->m_descriptor_count));
+    mcrt_vector<VkAccelerationStructureKHR> acceleration_structure_info(static_cast<size_t>(this->m_descriptor_count));
+
+    uint32_t const descriptor_write_count = static_cast<uint32_t>(this->m_descriptor_update_template_entries.size());
+    mcrt_vector<VkWriteDescriptorSetAccelerationStructureKHR> acceleration_structure_descriptor_writes(static_cast<size_t>(descriptor_write_count));
+    mcrt_vector<VkWriteDescriptorSet> descriptor_writes(static_cast<size_t>(descriptor_write_count));
+
+    uint32_t descriptor_index = 0U;
+    for (uint32_t descriptor_write_index = 0U; descriptor_write_index < descriptor_write_count; ++descriptor_write_index)
+    {
+        VkDescriptorUpdateTemplateEntryKHR const &descriptor_update_template_entry = this->m_descriptor_update_template_entries[descriptor_write_index];
+        assert((sizeof(brx_pal_vk_descriptor_update_template_data) * descriptor_index) == descriptor_update_template_entry.offset);
+
+        VkWriteDescriptorSet &descriptor_write = descriptor_writes[descriptor_write_index];
+        descriptor_write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        descriptor_write.pNext = NULL;
+        descriptor_write.dstSet = descriptor_set;
+        descriptor_write.dstBinding = descriptor_update_template_entry.dstBinding;
+        descriptor_write.dstArrayElement = descriptor_update_template_entry.dstArrayElement;
+        descriptor_write.descriptorCount = descriptor_update_template_entry.descriptorCount;
+        descriptor_write.descriptorType = descriptor_update_template_entry.descriptorType;
+        descriptor_write.pImageInfo = NULL;
+        descriptor_write.pBufferInfo = NULL;
+        descriptor_write.pTexelBufferView = NULL;
+
+        switch (descriptor_update_template_entry.descriptorType)
+        {
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        {
+            for (uint32_t entry_descriptor_index = 0U; entry_descriptor_index < descriptor_update_template_entry.descriptorCount; ++entry_descriptor_index)
+            {
+                buffer_info[descriptor_index + entry_descriptor_index] = descriptor_update_template_data[descriptor_index + entry_descriptor_index].m_buffer_info;
+            }
+
+            descriptor_write.pBufferInfo = &buffer_info[descriptor_index];
+        }
+        break;
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+        {
+            for (uint32_t entry_descriptor_index = 0U; entry_descriptor_index < descriptor_update_template_entry.descriptorCount; ++entry_descriptor_index)
+            {
+                image_info[descriptor_index + entry_descriptor_index] = descriptor_update_template_data[descriptor_index + entry_descriptor_index].m_image_info;
+            }
+
+            descriptor_write.pImageInfo = &image_info[descriptor_index];
+        }
+        break;
+        case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
+        {
+            for (uint32_t entry_descriptor_index = 0U; entry_descriptor_index < descriptor_update_template_entry.descriptorCount; ++entry_descriptor_index)
+            {
+                acceleration_structure_info[descriptor_index + entry_descriptor_index] = descriptor_update_template_data[descriptor_index + entry_descriptor_index].m_acceleration_structure;
+            }
+
+            acceleration_structure_descriptor_writes[descriptor_write_index].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR;
+            acceleration_structure_descriptor_writes[descriptor_write_index].pNext = NULL;
+            acceleration_structure_descriptor_writes[descriptor_write_index].accelerationStructureCount = descriptor_update_template_entry.descriptorCount;
+            acceleration_structure_descriptor_writes[descriptor_write_index].pAccelerationStructures = &acceleration_structure_info[descriptor_index];
+
+            descriptor_write.pNext = &acceleration_structure_descriptor_writes[descriptor_write_index];
+        }
+        break;
+        default:
+        {
+            assert(false);
+        }
+        }
+
+        descriptor_index += descriptor_update_template_entry.descriptorCount;
+    }
+    assert(this->m_descriptor_count == descriptor_index);
+
+    pfn_update_descriptor_sets(device, descriptor_write_count, &descriptor_writes[0], 0U, NULL);
+}
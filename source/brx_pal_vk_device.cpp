@@ -16,9 +16,15 @@
 //
 
 #include "brx_pal_vk_device.h"
+#include "brx_pal_bindless_descriptor_index_allocator.h"
+#include "brx_pal_render_graph.h"
+#include "brx_pal_deferred_destruction_queue.h"
+#include "brx_pal_acceleration_structure_update_manager.h"
 #include "../../McRT-Malloc/include/mcrt_malloc.h"
 #include <assert.h>
+#include <string.h>
 #include <new>
+#include <chrono>
 
 #if defined(__GNUC__)
 #if defined(__linux__)
@@ -56,8 +62,17 @@ static inline uint32_t _internal_find_lowest_memory_type_index(struct VkPhysical
 
 static inline uint32_t _internal_find_lowest_memory_type_index(struct VkPhysicalDeviceMemoryProperties const *physical_device_memory_properties, VkDeviceSize memory_requirements_size, uint32_t memory_requirements_memory_type_bits, VkMemoryPropertyFlags required_property_flags, VkMemoryPropertyFlags preferred_property_flags);
 
+static constexpr VkDeviceSize const D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT = 256U;
+static constexpr VkDeviceSize const D3D12_RAYTRACING_INSTANCE_DESCS_BYTE_ALIGNMENT = 16;
+
+static inline uint32_t _internal_find_max_sample_count(VkSampleCountFlags sample_counts);
+
+static inline VkFormat _internal_unwrap_storage_image_format(BRX_PAL_STORAGE_IMAGE_FORMAT wrapped_storage_image_format);
+
 static inline void _internal_pause();
 
+static inline uint64_t _internal_get_elapsed_nanoseconds(std::chrono::steady_clock::time_point begin_time, std::chrono::steady_clock::time_point end_time);
+
 extern brx_pal_device *brx_pal_create_vk_device(void *wsi_connection, bool support_ray_tracing)
 {
     void *new_unwrapped_device_base = mcrt_malloc(sizeof(brx_pal_vk_device), alignof(brx_pal_vk_device));
@@ -85,20 +100,36 @@ brx_pal_vk_device::brx_pal_vk_device()
       m_max_per_stage_descriptor_sampled_images(static_cast<uint32_t>(-1)),
       m_max_descriptor_set_storage_buffers(static_cast<uint32_t>(-1)),
       m_max_descriptor_set_sampled_images(static_cast<uint32_t>(-1)),
+      m_max_attachment_sample_count(static_cast<uint32_t>(-1)),
       m_has_dedicated_upload_queue(false),
       m_graphics_queue_family_index(VK_QUEUE_FAMILY_IGNORED),
       m_upload_queue_family_index(VK_QUEUE_FAMILY_IGNORED),
+      m_has_dedicated_compute_queue(false),
+      m_compute_queue_family_index(VK_QUEUE_FAMILY_IGNORED),
+      m_support_dynamic_rendering(false),
+      m_support_multiview(false),
+      m_max_multiview_view_count(static_cast<uint32_t>(-1)),
+      m_support_graphics_pipeline_library(false),
+      m_support_extended_dynamic_state(false),
+      m_support_mesh_shader(false),
+      m_support_descriptor_update_template(false),
+      m_subgroup_properties{0U, 0U, 0U, false},
+      m_support_bindless(false),
+      m_bindless_descriptor_limits{0U, 0U, 0U, 0U},
       m_pfn_get_device_proc_addr(NULL),
       m_physical_device_feature_texture_compression_BC(false),
       m_physical_device_feature_texture_compression_ASTC_LDR(false),
+      m_physical_device_feature_sampler_anisotropy(false),
       m_device(VK_NULL_HANDLE),
       m_graphics_queue(VK_NULL_HANDLE),
       m_upload_queue(VK_NULL_HANDLE),
+      m_compute_queue(VK_NULL_HANDLE),
       m_depth_attachment_image_format(VK_FORMAT_UNDEFINED),
       m_depth_stencil_attachment_image_format(VK_FORMAT_UNDEFINED),
       m_depth_attachment_image_format_support_sampled_image(false),
       m_depth_stencil_attachment_image_format_support_sampled_image(false),
       m_memory_allocator(VK_NULL_HANDLE),
+      m_physical_device_memory_properties{},
       m_uniform_upload_buffer_memory_pool(VK_NULL_HANDLE),
       m_staging_upload_buffer_memory_pool(VK_NULL_HANDLE),
       m_storage_intermediate_buffer_memory_pool(VK_NULL_HANDLE),
@@ -115,6 +146,7 @@ brx_pal_vk_device::brx_pal_vk_device()
       m_intermediate_bottom_level_acceleration_structure_memory_pool(VK_NULL_HANDLE),
       m_non_compacted_bottom_level_acceleration_structure_memory_pool(VK_NULL_HANDLE),
       m_compacted_bottom_level_acceleration_structure_memory_pool(VK_NULL_HANDLE),
+      m_serialized_bottom_level_acceleration_structure_buffer_memory_pool(VK_NULL_HANDLE),
       m_top_level_acceleration_structure_instance_upload_buffer_memory_pool(VK_NULL_HANDLE),
       m_top_level_acceleration_structure_memory_pool(VK_NULL_HANDLE),
       m_pfn_wait_for_fences(NULL),
@@ -123,16 +155,38 @@ brx_pal_vk_device::brx_pal_vk_device()
       m_pfn_acquire_next_image(NULL),
       m_pfn_create_image_view(NULL),
       m_pfn_destroy_image_view(NULL),
+      m_pfn_create_buffer(NULL),
+      m_pfn_get_buffer_memory_requirements(NULL),
+      m_pfn_destroy_buffer(NULL),
+      m_pfn_create_image(NULL),
+      m_pfn_get_image_memory_requirements(NULL),
+      m_pfn_destroy_image(NULL),
       m_pfn_get_buffer_device_address(NULL),
       m_pfn_create_acceleration_structure(NULL),
       m_pfn_destroy_acceleration_structure(NULL),
       m_pfn_get_acceleration_structure_device_address(NULL),
-      m_pfn_get_query_pool_results(NULL) {
+      m_pfn_get_query_pool_results(NULL),
+      m_graphics_pipeline_vertex_input_interface_library(VK_NULL_HANDLE),
+      m_device_creation_timing{0U, 0U, 0U, 0U, 0U} {
 
       };
 
 void brx_pal_vk_device::init(void *wsi_connection, bool support_ray_tracing)
 {
+    std::chrono::steady_clock::time_point const init_begin_time = std::chrono::steady_clock::now();
+
+    this->m_fence_object_pool.init(sizeof(brx_pal_vk_fence), alignof(brx_pal_vk_fence));
+    this->m_descriptor_set_object_pool.init(sizeof(brx_pal_vk_descriptor_set), alignof(brx_pal_vk_descriptor_set));
+    this->m_graphics_pipeline_object_pool.init(sizeof(brx_pal_vk_graphics_pipeline), alignof(brx_pal_vk_graphics_pipeline));
+    this->m_compute_pipeline_object_pool.init(sizeof(brx_pal_vk_compute_pipeline), alignof(brx_pal_vk_compute_pipeline));
+    this->m_uniform_upload_buffer_object_pool.init(sizeof(brx_pal_vk_uniform_upload_buffer), alignof(brx_pal_vk_uniform_upload_buffer));
+    this->m_staging_upload_buffer_object_pool.init(sizeof(brx_pal_vk_staging_upload_buffer), alignof(brx_pal_vk_staging_upload_buffer));
+    this->m_storage_intermediate_buffer_object_pool.init(sizeof(brx_pal_vk_storage_intermediate_buffer), alignof(brx_pal_vk_storage_intermediate_buffer));
+    this->m_color_attachment_image_object_pool.init(sizeof(brx_pal_vk_color_attachment_intermediate_image), alignof(brx_pal_vk_color_attachment_intermediate_image));
+    this->m_depth_stencil_attachment_image_object_pool.init(sizeof(brx_pal_vk_depth_stencil_attachment_intermediate_image), alignof(brx_pal_vk_depth_stencil_attachment_intermediate_image));
+    this->m_storage_image_object_pool.init(sizeof(brx_pal_vk_storage_intermediate_image), alignof(brx_pal_vk_storage_intermediate_image));
+    this->m_sampled_asset_image_object_pool.init(sizeof(brx_pal_vk_sampled_asset_image), alignof(brx_pal_vk_sampled_asset_image));
+
 #if defined(__GNUC__)
 
 #if defined(__linux__)
@@ -159,6 +213,17 @@ void brx_pal_vk_device::init(void *wsi_connection, bool support_ray_tracing)
 
     assert(NULL == this->m_allocation_callbacks);
 
+    // the Vulkan 1.1 is requested when the loader supports it, since the Vulkan 1.0 loader (without the "vkEnumerateInstanceVersion") rejects any other API version
+    uint32_t instance_api_version = VK_API_VERSION_1_0;
+    {
+        PFN_vkEnumerateInstanceVersion const pfn_enumerate_instance_version = reinterpret_cast<PFN_vkEnumerateInstanceVersion>(this->m_pfn_get_instance_proc_addr(VK_NULL_HANDLE, "vkEnumerateInstanceVersion"));
+        if (NULL != pfn_enumerate_instance_version)
+        {
+            instance_api_version = VK_API_VERSION_1_1;
+        }
+    }
+
+    // the memory allocator only uses the Vulkan 1.0 functions and the extensions
     uint32_t const vulkan_api_version = VK_API_VERSION_1_0;
 
     assert(VK_NULL_HANDLE == this->m_instance);
@@ -173,7 +238,7 @@ void brx_pal_vk_device::init(void *wsi_connection, bool support_ray_tracing)
             0,
             "BRX-PAL-VK",
             0,
-            vulkan_api_version};
+            instance_api_version};
 
 #ifndef NDEBUG
         char const *const enabled_layer_names[] = {
@@ -184,6 +249,8 @@ void brx_pal_vk_device::init(void *wsi_connection, bool support_ray_tracing)
 #ifndef NDEBUG
             VK_EXT_DEBUG_UTILS_EXTENSION_NAME,
 #endif
+            // required by the device extensions (e.g. VK_KHR_dynamic_rendering) since the API version is 1.0
+            VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME,
             VK_KHR_SURFACE_EXTENSION_NAME,
 #if defined(__GNUC__)
 #if defined(__linux__)
@@ -246,6 +313,8 @@ void brx_pal_vk_device::init(void *wsi_connection, bool support_ray_tracing)
     }
 #endif
 
+    std::chrono::steady_clock::time_point const instance_creation_end_time = std::chrono::steady_clock::now();
+
     assert(VK_NULL_HANDLE == this->m_physical_device);
     assert(static_cast<uint32_t>(-1) == this->m_min_uniform_buffer_offset_alignment);
     assert(static_cast<uint32_t>(-1) == this->m_min_storage_buffer_offset_alignment);
@@ -255,6 +324,7 @@ void brx_pal_vk_device::init(void *wsi_connection, bool support_ray_tracing)
     assert(static_cast<uint32_t>(-1) == this->m_max_per_stage_descriptor_sampled_images);
     assert(static_cast<uint32_t>(-1) == this->m_max_descriptor_set_storage_buffers);
     assert(static_cast<uint32_t>(-1) == this->m_max_descriptor_set_sampled_images);
+    assert(static_cast<uint32_t>(-1) == this->m_max_attachment_sample_count);
     {
         PFN_vkEnumeratePhysicalDevices const pfn_enumerate_physical_devices = reinterpret_cast<PFN_vkEnumeratePhysicalDevices>(this->m_pfn_get_instance_proc_addr(this->m_instance, "vkEnumeratePhysicalDevices"));
         assert(NULL != pfn_enumerate_physical_devices);
@@ -279,6 +349,7 @@ void brx_pal_vk_device::init(void *wsi_connection, bool support_ray_tracing)
         uint32_t gpu_max_Per_stage_descriptor_sampled_images = static_cast<uint32_t>(-1);
         uint32_t gpu_max_descriptor_set_storage_buffers = static_cast<uint32_t>(-1);
         uint32_t gpu_max_descriptor_set_sampled_images = static_cast<uint32_t>(-1);
+        uint32_t gpu_max_attachment_sample_count = static_cast<uint32_t>(-1);
         bool gpu_physical_device_found = false;
         for (uint32_t physical_device_index = 0U; physical_device_index < physical_device_count; ++physical_device_index)
         {
@@ -295,6 +366,7 @@ void brx_pal_vk_device::init(void *wsi_connection, bool support_ray_tracing)
                 gpu_max_Per_stage_descriptor_sampled_images = physical_device_properties.limits.maxPerStageDescriptorSampledImages;
                 gpu_max_descriptor_set_storage_buffers = physical_device_properties.limits.maxDescriptorSetStorageBuffers;
                 gpu_max_descriptor_set_sampled_images = physical_device_properties.limits.maxDescriptorSetSampledImages;
+                gpu_max_attachment_sample_count = _internal_find_max_sample_count(physical_device_properties.limits.framebufferColorSampleCounts & physical_device_properties.limits.framebufferDepthSampleCounts & physical_device_properties.limits.framebufferStencilSampleCounts);
                 gpu_physical_device_found = true;
 
                 // The discrete gpu is preferred
@@ -316,6 +388,7 @@ void brx_pal_vk_device::init(void *wsi_connection, bool support_ray_tracing)
                 gpu_max_Per_stage_descriptor_sampled_images = physical_device_properties.limits.maxPerStageDescriptorSampledImages;
                 gpu_max_descriptor_set_storage_buffers = physical_device_properties.limits.maxDescriptorSetStorageBuffers;
                 gpu_max_descriptor_set_sampled_images = physical_device_properties.limits.maxDescriptorSetSampledImages;
+                gpu_max_attachment_sample_count = _internal_find_max_sample_count(physical_device_properties.limits.framebufferColorSampleCounts & physical_device_properties.limits.framebufferDepthSampleCounts & physical_device_properties.limits.framebufferStencilSampleCounts);
                 gpu_physical_device_found = true;
             }
         }
@@ -331,6 +404,7 @@ void brx_pal_vk_device::init(void *wsi_connection, bool support_ray_tracing)
             this->m_max_per_stage_descriptor_sampled_images = static_cast<uint32_t>(gpu_max_Per_stage_descriptor_sampled_images);
             this->m_max_descriptor_set_storage_buffers = static_cast<uint32_t>(gpu_max_descriptor_set_storage_buffers);
             this->m_max_descriptor_set_sampled_images = static_cast<uint32_t>(gpu_max_descriptor_set_sampled_images);
+            this->m_max_attachment_sample_count = gpu_max_attachment_sample_count;
         }
         else
         {
@@ -349,8 +423,11 @@ void brx_pal_vk_device::init(void *wsi_connection, bool support_ray_tracing)
     // m_upload_queue
     assert(VK_QUEUE_FAMILY_IGNORED == this->m_graphics_queue_family_index);
     assert(VK_QUEUE_FAMILY_IGNORED == this->m_upload_queue_family_index);
+    assert(false == this->m_has_dedicated_compute_queue);
+    assert(VK_QUEUE_FAMILY_IGNORED == this->m_compute_queue_family_index);
     uint32_t new_graphics_queue_queue_index = static_cast<uint32_t>(-1);
     uint32_t new_upload_queue_queue_index = static_cast<uint32_t>(-1);
+    uint32_t new_compute_queue_queue_index = static_cast<uint32_t>(-1);
     {
         PFN_vkGetPhysicalDeviceQueueFamilyProperties const pfn_vk_get_physical_device_queue_family_properties = reinterpret_cast<PFN_vkGetPhysicalDeviceQueueFamilyProperties>(this->m_pfn_get_instance_proc_addr(this->m_instance, "vkGetPhysicalDeviceQueueFamilyProperties"));
         assert(NULL != pfn_vk_get_physical_device_queue_family_properties);
@@ -525,77 +602,512 @@ void brx_pal_vk_device::init(void *wsi_connection, bool support_ray_tracing)
         }
 
         assert(!this->m_has_dedicated_upload_queue || (VK_QUEUE_FAMILY_IGNORED != this->m_upload_queue_family_index && static_cast<uint32_t>(-1) != new_upload_queue_queue_index));
+
+        // Find compute queue
+        // The "async compute" queue family (compute but not graphics) is preferred, since the compute work can overlap the rasterization
+        for (uint32_t queue_family_index = 0U; queue_family_index < queue_family_property_count; ++queue_family_index)
+        {
+            if ((this->m_graphics_queue_family_index != queue_family_index) && (this->m_upload_queue_family_index != queue_family_index) && (VK_QUEUE_COMPUTE_BIT == (queue_family_properties[queue_family_index].queueFlags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT))))
+            {
+                this->m_compute_queue_family_index = queue_family_index;
+                new_compute_queue_queue_index = 0U;
+                this->m_has_dedicated_compute_queue = true;
+                break;
+            }
+        }
+
+        // Fallback to the other queue of the upload queue family
+        if (VK_QUEUE_FAMILY_IGNORED == this->m_compute_queue_family_index)
+        {
+            if (this->m_has_dedicated_upload_queue && (this->m_graphics_queue_family_index != this->m_upload_queue_family_index) && (0U != (queue_family_properties[this->m_upload_queue_family_index].queueFlags & VK_QUEUE_COMPUTE_BIT)) && ((new_upload_queue_queue_index + 2U) <= queue_family_properties[this->m_upload_queue_family_index].queueCount))
+            {
+                this->m_compute_queue_family_index = this->m_upload_queue_family_index;
+                new_compute_queue_queue_index = new_upload_queue_queue_index + 1U;
+                this->m_has_dedicated_compute_queue = true;
+            }
+        }
+
+        // Fallback to other graphics queues
+        if (VK_QUEUE_FAMILY_IGNORED == this->m_compute_queue_family_index)
+        {
+            for (uint32_t queue_family_index = 0U; queue_family_index < queue_family_property_count; ++queue_family_index)
+            {
+                if ((this->m_graphics_queue_family_index != queue_family_index) && (this->m_upload_queue_family_index != queue_family_index) && (0U != (queue_family_properties[queue_family_index].queueFlags & VK_QUEUE_COMPUTE_BIT)))
+                {
+                    this->m_compute_queue_family_index = queue_family_index;
+                    new_compute_queue_queue_index = 0U;
+                    this->m_has_dedicated_compute_queue = true;
+                    break;
+                }
+            }
+        }
+
+        // Try the same queue family
+        if (VK_QUEUE_FAMILY_IGNORED == this->m_compute_queue_family_index)
+        {
+            uint32_t const graphics_queue_family_next_queue_index = (this->m_has_dedicated_upload_queue && (this->m_graphics_queue_family_index == this->m_upload_queue_family_index)) ? (new_upload_queue_queue_index + 1U) : (new_graphics_queue_queue_index + 1U);
+
+            if ((graphics_queue_family_next_queue_index + 1U) <= queue_family_properties[this->m_graphics_queue_family_index].queueCount)
+            {
+                this->m_compute_queue_family_index = this->m_graphics_queue_family_index;
+                new_compute_queue_queue_index = graphics_queue_family_next_queue_index;
+                this->m_has_dedicated_compute_queue = true;
+            }
+            else
+            {
+                // The compute command buffer will be submitted to the graphics queue
+                this->m_compute_queue_family_index = VK_QUEUE_FAMILY_IGNORED;
+                assert(static_cast<uint32_t>(-1) == new_compute_queue_queue_index);
+                this->m_has_dedicated_compute_queue = false;
+            }
+        }
+
+        assert(!this->m_has_dedicated_compute_queue || (VK_QUEUE_FAMILY_IGNORED != this->m_compute_queue_family_index && static_cast<uint32_t>(-1) != new_compute_queue_queue_index));
     }
 
-    assert(false == this->m_physical_device_feature_texture_compression_BC);
-    assert(false == this->m_physical_device_feature_texture_compression_ASTC_LDR);
-    assert(VK_NULL_HANDLE == this->m_device);
+    // VK_KHR_dynamic_rendering is optional, and the render pass and frame buffer objects are still available when it is not supported
+    // VK_KHR_multiview is optional, and the "view_count" should be one when it is not supported
+    // VK_EXT_graphics_pipeline_library is optional, and the graphics pipeline libraries only record the states when it is not supported
+    // VK_EXT_extended_dynamic_state and VK_EXT_extended_dynamic_state3 are optional, and the graphics pipeline with the extended dynamic state is NOT available when they are not supported
+    // VK_EXT_mesh_shader is optional, and the mesh shader graphics pipeline is NOT available when it is not supported
+    // VK_EXT_subgroup_size_control is optional, and the subgroup size is NOT able to be controlled when it is not supported
+    // VK_EXT_descriptor_indexing is optional, and the bindless descriptor set layout is NOT available when it is not supported
+    // VK_KHR_descriptor_update_template is optional, and the descriptor sets are written by the "vkUpdateDescriptorSets" when it is not supported
+    assert(!this->m_support_dynamic_rendering);
+    assert(!this->m_support_multiview);
+    assert(!this->m_support_graphics_pipeline_library);
+    assert(!this->m_support_extended_dynamic_state);
+    assert(!this->m_support_mesh_shader);
+    assert(!this->m_support_descriptor_update_template);
+    bool support_pipeline_library_extension = false;
+    bool support_graphics_pipeline_library_extension = false;
+    bool support_extended_dynamic_state_extension = false;
+    bool support_extended_dynamic_state_3_extension = false;
+    bool support_mesh_shader_extension = false;
+    bool support_spirv_1_4_extension = false;
+    bool support_shader_float_controls_extension = false;
+    bool support_draw_indirect_count_extension = false;
+    bool support_subgroup_size_control_extension = false;
+    bool support_maintenance3_extension = false;
+    bool support_descriptor_indexing_extension = false;
     {
-        float const graphics_queue_priority = 1.0F;
-        float const upload_queue_priority = 1.0F;
-        float const graphics_upload_queue_priorities[2] = {graphics_queue_priority, upload_queue_priority};
-        VkDeviceQueueCreateInfo device_queue_create_infos[2];
-        uint32_t device_queue_create_info_count = static_cast<uint32_t>(-1);
-        if (this->m_has_dedicated_upload_queue)
+        PFN_vkEnumerateDeviceExtensionProperties const pfn_enumerate_device_extension_properties = reinterpret_cast<PFN_vkEnumerateDeviceExtensionProperties>(this->m_pfn_get_instance_proc_addr(this->m_instance, "vkEnumerateDeviceExtensionProperties"));
+        assert(NULL != pfn_enumerate_device_extension_properties);
+
+        uint32_t extension_property_count = static_cast<uint32_t>(-1);
+        VkResult const res_enumerate_device_extension_properties_1 = pfn_enumerate_device_extension_properties(this->m_physical_device, NULL, &extension_property_count, NULL);
+        assert(VK_SUCCESS == res_enumerate_device_extension_properties_1);
+
+        mcrt_vector<VkExtensionProperties> extension_properties(static_cast<size_t>(extension_property_count));
+
+        if (extension_property_count > 0U)
         {
-            if (this->m_graphics_queue_family_index != this->m_upload_queue_family_index)
+            VkResult const res_enumerate_device_extension_properties_2 = pfn_enumerate_device_extension_properties(this->m_physical_device, NULL, &extension_property_count, &extension_properties[0]);
+            assert(VK_SUCCESS == res_enumerate_device_extension_properties_2 && extension_properties.size() == extension_property_count);
+        }
+
+        for (uint32_t extension_property_index = 0U; extension_property_index < extension_property_count; ++extension_property_index)
+        {
+            if (0 == strcmp(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME, extension_properties[extension_property_index].extensionName))
             {
-                device_queue_create_infos[0].sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-                device_queue_create_infos[0].pNext = NULL;
-                device_queue_create_infos[0].flags = 0U;
-                device_queue_create_infos[0].queueFamilyIndex = this->m_graphics_queue_family_index;
-                assert(0U == new_graphics_queue_queue_index);
-                device_queue_create_infos[0].queueCount = 1U;
-                device_queue_create_infos[0].pQueuePriorities = &graphics_queue_priority;
-
-                device_queue_create_infos[1].sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-                device_queue_create_infos[1].pNext = NULL;
-                device_queue_create_infos[1].flags = 0U;
-                device_queue_create_infos[1].queueFamilyIndex = this->m_upload_queue_family_index;
-                assert(0U == new_upload_queue_queue_index);
-                device_queue_create_infos[1].queueCount = 1U;
-                device_queue_create_infos[1].pQueuePriorities = &upload_queue_priority;
-
-                device_queue_create_info_count = 2U;
+                this->m_support_dynamic_rendering = true;
             }
-            else
+            else if (0 == strcmp(VK_KHR_MULTIVIEW_EXTENSION_NAME, extension_properties[extension_property_index].extensionName))
+            {
+                this->m_support_multiview = true;
+            }
+            else if (0 == strcmp(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME, extension_properties[extension_property_index].extensionName))
+            {
+                support_pipeline_library_extension = true;
+            }
+            else if (0 == strcmp(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME, extension_properties[extension_property_index].extensionName))
+            {
+                support_graphics_pipeline_library_extension = true;
+            }
+            else if (0 == strcmp(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME, extension_properties[extension_property_index].extensionName))
+            {
+                support_extended_dynamic_state_extension = true;
+            }
+            else if (0 == strcmp(VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME, extension_properties[extension_property_index].extensionName))
+            {
+                support_extended_dynamic_state_3_extension = true;
+            }
+            else if (0 == strcmp(VK_EXT_MESH_SHADER_EXTENSION_NAME, extension_properties[extension_property_index].extensionName))
+            {
+                support_mesh_shader_extension = true;
+            }
+            else if (0 == strcmp(VK_KHR_SPIRV_1_4_EXTENSION_NAME, extension_properties[extension_property_index].extensionName))
             {
-                device_queue_create_infos[0].sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-                device_queue_create_infos[0].pNext = NULL;
-                device_queue_create_infos[0].flags = 0U;
-                device_queue_create_infos[0].queueFamilyIndex = this->m_graphics_queue_family_index;
-                assert(0U == new_graphics_queue_queue_index);
-                assert(1U == new_upload_queue_queue_index);
-                device_queue_create_infos[0].queueCount = 2U;
-                device_queue_create_infos[0].pQueuePriorities = graphics_upload_queue_priorities;
-                device_queue_create_info_count = 1U;
+                support_spirv_1_4_extension = true;
+            }
+            else if (0 == strcmp(VK_KHR_SHADER_FLOAT_CONTROLS_EXTENSION_NAME, extension_properties[extension_property_index].extensionName))
+            {
+                support_shader_float_controls_extension = true;
+            }
+            else if (0 == strcmp(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME, extension_properties[extension_property_index].extensionName))
+            {
+                support_draw_indirect_count_extension = true;
+            }
+            else if (0 == strcmp(VK_EXT_SUBGROUP_SIZE_CONTROL_EXTENSION_NAME, extension_properties[extension_property_index].extensionName))
+            {
+                support_subgroup_size_control_extension = true;
+            }
+            else if (0 == strcmp(VK_KHR_DESCRIPTOR_UPDATE_TEMPLATE_EXTENSION_NAME, extension_properties[extension_property_index].extensionName))
+            {
+                this->m_support_descriptor_update_template = true;
+            }
+            else if (0 == strcmp(VK_KHR_MAINTENANCE3_EXTENSION_NAME, extension_properties[extension_property_index].extensionName))
+            {
+                support_maintenance3_extension = true;
+            }
+            else if (0 == strcmp(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME, extension_properties[extension_property_index].extensionName))
+            {
+                support_descriptor_indexing_extension = true;
             }
         }
-        else
+
+        // VK_KHR_dynamic_rendering => VK_KHR_depth_stencil_resolve => VK_KHR_create_renderpass2 => VK_KHR_multiview
+        assert((!this->m_support_dynamic_rendering) || this->m_support_multiview);
+    }
+
+    assert(static_cast<uint32_t>(-1) == this->m_max_multiview_view_count);
+    if (this->m_support_multiview)
+    {
+        PFN_vkGetPhysicalDeviceProperties2KHR const pfn_get_physical_device_properties_2 = reinterpret_cast<PFN_vkGetPhysicalDeviceProperties2KHR>(this->m_pfn_get_instance_proc_addr(this->m_instance, "vkGetPhysicalDeviceProperties2KHR"));
+        assert(NULL != pfn_get_physical_device_properties_2);
+
+        VkPhysicalDeviceMultiviewPropertiesKHR physical_device_multiview_properties = {
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PROPERTIES_KHR,
+            NULL,
+            0U,
+            0U};
+
+        VkPhysicalDeviceProperties2KHR physical_device_properties_2 = {
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2_KHR,
+            &physical_device_multiview_properties};
+
+        pfn_get_physical_device_properties_2(this->m_physical_device, &physical_device_properties_2);
+
+        // the view mask is 32-bit
+        this->m_max_multiview_view_count = (physical_device_multiview_properties.maxMultiviewViewCount < 32U) ? physical_device_multiview_properties.maxMultiviewViewCount : 32U;
+    }
+    else
+    {
+        this->m_max_multiview_view_count = 1U;
+    }
+
+    // the graphics pipeline libraries are created with the dynamic rendering
+    if (this->m_support_dynamic_rendering && support_pipeline_library_extension && support_graphics_pipeline_library_extension)
+    {
+        PFN_vkGetPhysicalDeviceFeatures2KHR const pfn_get_physical_device_features_2 = reinterpret_cast<PFN_vkGetPhysicalDeviceFeatures2KHR>(this->m_pfn_get_instance_proc_addr(this->m_instance, "vkGetPhysicalDeviceFeatures2KHR"));
+        assert(NULL != pfn_get_physical_device_features_2);
+
+        VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT physical_device_graphics_pipeline_library_features = {
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT,
+            NULL,
+            VK_FALSE};
+
+        VkPhysicalDeviceFeatures2KHR physical_device_features_2 = {
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2_KHR,
+            &physical_device_graphics_pipeline_library_features,
+            {}};
+
+        pfn_get_physical_device_features_2(this->m_physical_device, &physical_device_features_2);
+
+        this->m_support_graphics_pipeline_library = (VK_FALSE != physical_device_graphics_pipeline_library_features.graphicsPipelineLibrary);
+    }
+
+    // the cull mode and the depth compare operation are provided by the VK_EXT_extended_dynamic_state, and the blend operation is provided by the VK_EXT_extended_dynamic_state3
+    if (support_extended_dynamic_state_extension && support_extended_dynamic_state_3_extension)
+    {
+        PFN_vkGetPhysicalDeviceFeatures2KHR const pfn_get_physical_device_features_2 = reinterpret_cast<PFN_vkGetPhysicalDeviceFeatures2KHR>(this->m_pfn_get_instance_proc_addr(this->m_instance, "vkGetPhysicalDeviceFeatures2KHR"));
+        assert(NULL != pfn_get_physical_device_features_2);
+
+        VkPhysicalDeviceExtendedDynamicState3FeaturesEXT physical_device_extended_dynamic_state_3_features = {};
+        physical_device_extended_dynamic_state_3_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_FEATURES_EXT;
+        physical_device_extended_dynamic_state_3_features.pNext = NULL;
+
+        VkPhysicalDeviceExtendedDynamicStateFeaturesEXT physical_device_extended_dynamic_state_features = {
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT,
+            &physical_device_extended_dynamic_state_3_features,
+            VK_FALSE};
+
+        VkPhysicalDeviceFeatures2KHR physical_device_features_2 = {
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2_KHR,
+            &physical_device_extended_dynamic_state_features,
+            {}};
+
+        pfn_get_physical_device_features_2(this->m_physical_device, &physical_device_features_2);
+
+        this->m_support_extended_dynamic_state = (VK_FALSE != physical_device_extended_dynamic_state_features.extendedDynamicState) && (VK_FALSE != physical_device_extended_dynamic_state_3_features.extendedDynamicState3ColorBlendEnable) && (VK_FALSE != physical_device_extended_dynamic_state_3_features.extendedDynamicState3ColorBlendEquation);
+    }
+
+    // VK_EXT_mesh_shader => VK_KHR_spirv_1_4 => VK_KHR_shader_float_controls, and the "draw_mesh_tasks_indirect_count" is provided by the VK_KHR_draw_indirect_count
+    if (support_mesh_shader_extension && support_spirv_1_4_extension && support_shader_float_controls_extension && support_draw_indirect_count_extension)
+    {
+        PFN_vkGetPhysicalDeviceFeatures2KHR const pfn_get_physical_device_features_2 = reinterpret_cast<PFN_vkGetPhysicalDeviceFeatures2KHR>(this->m_pfn_get_instance_proc_addr(this->m_instance, "vkGetPhysicalDeviceFeatures2KHR"));
+        assert(NULL != pfn_get_physical_device_features_2);
+
+        VkPhysicalDeviceMeshShaderFeaturesEXT physical_device_mesh_shader_features = {
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_EXT,
+            NULL,
+            VK_FALSE,
+            VK_FALSE,
+            VK_FALSE,
+            VK_FALSE,
+            VK_FALSE};
+
+        VkPhysicalDeviceFeatures2KHR physical_device_features_2 = {
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2_KHR,
+            &physical_device_mesh_shader_features,
+            {}};
+
+        pfn_get_physical_device_features_2(this->m_physical_device, &physical_device_features_2);
+
+        this->m_support_mesh_shader = (VK_FALSE != physical_device_mesh_shader_features.taskShader) && (VK_FALSE != physical_device_mesh_shader_features.meshShader);
+    }
+
+    // the subgroup size is fixed to the "subgroupSize" when the VK_EXT_subgroup_size_control is not supported
+    // the subgroup properties and the VK_EXT_subgroup_size_control require the Vulkan 1.1, and all subgroup properties are zero when either the instance or the physical device is Vulkan 1.0
+    assert(0U == this->m_subgroup_properties.min_subgroup_size);
+    assert(0U == this->m_subgroup_properties.max_subgroup_size);
+    assert(0U == this->m_subgroup_properties.supported_operations);
+    assert(!this->m_subgroup_properties.support_subgroup_size_control);
+    {
+        PFN_vkGetPhysicalDeviceProperties const pfn_get_physical_device_properties = reinterpret_cast<PFN_vkGetPhysicalDeviceProperties>(this->m_pfn_get_instance_proc_addr(this->m_instance, "vkGetPhysicalDeviceProperties"));
+        assert(NULL != pfn_get_physical_device_properties);
+
+        VkPhysicalDeviceProperties physical_device_properties;
+        pfn_get_physical_device_properties(this->m_physical_device, &physical_device_properties);
+
+        if ((instance_api_version >= VK_API_VERSION_1_1) && (physical_device_properties.apiVersion >= VK_API_VERSION_1_1))
         {
-            device_queue_create_infos[0].sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-            device_queue_create_infos[0].pNext = NULL;
-            device_queue_create_infos[0].flags = 0U;
-            device_queue_create_infos[0].queueFamilyIndex = this->m_graphics_queue_family_index;
+            PFN_vkGetPhysicalDeviceProperties2KHR const pfn_get_physical_device_properties_2 = reinterpret_cast<PFN_vkGetPhysicalDeviceProperties2KHR>(this->m_pfn_get_instance_proc_addr(this->m_instance, "vkGetPhysicalDeviceProperties2KHR"));
+            assert(NULL != pfn_get_physical_device_properties_2);
+
+            VkPhysicalDeviceSubgroupSizeControlPropertiesEXT physical_device_subgroup_size_control_properties = {
+                VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_PROPERTIES_EXT,
+                NULL,
+                0U,
+                0U,
+                0U,
+                0U};
+
+            VkPhysicalDeviceSubgroupProperties physical_device_subgroup_properties = {
+                VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES,
+                support_subgroup_size_control_extension ? &physical_device_subgroup_size_control_properties : NULL,
+                0U,
+                0U,
+                0U,
+                VK_FALSE};
+
+            VkPhysicalDeviceProperties2KHR physical_device_properties_2 = {
+                VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2_KHR,
+                &physical_device_subgroup_properties};
+
+            pfn_get_physical_device_properties_2(this->m_physical_device, &physical_device_properties_2);
+
+            VkPhysicalDeviceSubgroupSizeControlFeaturesEXT physical_device_subgroup_size_control_features = {
+                VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_FEATURES_EXT,
+                NULL,
+                VK_FALSE,
+                VK_FALSE};
+
+            if (support_subgroup_size_control_extension)
+            {
+                PFN_vkGetPhysicalDeviceFeatures2KHR const pfn_get_physical_device_features_2 = reinterpret_cast<PFN_vkGetPhysicalDeviceFeatures2KHR>(this->m_pfn_get_instance_proc_addr(this->m_instance, "vkGetPhysicalDeviceFeatures2KHR"));
+                assert(NULL != pfn_get_physical_device_features_2);
+
+                VkPhysicalDeviceFeatures2KHR physical_device_features_2 = {
+                    VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2_KHR,
+                    &physical_device_subgroup_size_control_features,
+                    {}};
+
+                pfn_get_physical_device_features_2(this->m_physical_device, &physical_device_features_2);
+            }
+
+            bool const support_subgroup_size_control = support_subgroup_size_control_extension && (VK_FALSE != physical_device_subgroup_size_control_features.subgroupSizeControl) && (VK_FALSE != physical_device_subgroup_size_control_features.computeFullSubgroups) && (0U != (VK_SHADER_STAGE_COMPUTE_BIT & physical_device_subgroup_size_control_properties.requiredSubgroupSizeStages));
+
+            this->m_subgroup_properties.min_subgroup_size = support_subgroup_size_control ? physical_device_subgroup_size_control_properties.minSubgroupSize : physical_device_subgroup_properties.subgroupSize;
+            this->m_subgroup_properties.max_subgroup_size = support_subgroup_size_control ? physical_device_subgroup_size_control_properties.maxSubgroupSize : physical_device_subgroup_properties.subgroupSize;
+            this->m_subgroup_properties.supported_operations = (0U != (VK_SHADER_STAGE_COMPUTE_BIT & physical_device_subgroup_properties.supportedStages)) ? (physical_device_subgroup_properties.supportedOperations & 0XFFU) : 0U;
+            this->m_subgroup_properties.support_subgroup_size_control = support_subgroup_size_control;
+        }
+    }
+
+    // VK_EXT_descriptor_indexing => VK_KHR_maintenance3
+    assert(!this->m_support_bindless);
+    if (support_maintenance3_extension && support_descriptor_indexing_extension)
+    {
+        PFN_vkGetPhysicalDeviceFeatures2KHR const pfn_get_physical_device_features_2 = reinterpret_cast<PFN_vkGetPhysicalDeviceFeatures2KHR>(this->m_pfn_get_instance_proc_addr(this->m_instance, "vkGetPhysicalDeviceFeatures2KHR"));
+        assert(NULL != pfn_get_physical_device_features_2);
+
+        VkPhysicalDeviceDescriptorIndexingFeaturesEXT physical_device_descriptor_indexing_features = {};
+        physical_device_descriptor_indexing_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
+        physical_device_descriptor_indexing_features.pNext = NULL;
+
+        VkPhysicalDeviceFeatures2KHR physical_device_features_2 = {
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2_KHR,
+            &physical_device_descriptor_indexing_features,
+            {}};
+
+        pfn_get_physical_device_features_2(this->m_physical_device, &physical_device_features_2);
+
+        this->m_support_bindless = (VK_FALSE != physical_device_descriptor_indexing_features.shaderSampledImageArrayNonUniformIndexing) && (VK_FALSE != physical_device_descriptor_indexing_features.shaderStorageBufferArrayNonUniformIndexing) && (VK_FALSE != physical_device_descriptor_indexing_features.descriptorBindingSampledImageUpdateAfterBind) && (VK_FALSE != physical_device_descriptor_indexing_features.descriptorBindingStorageBufferUpdateAfterBind) && (VK_FALSE != physical_device_descriptor_indexing_features.descriptorBindingUpdateUnusedWhilePending) && (VK_FALSE != physical_device_descriptor_indexing_features.descriptorBindingPartiallyBound) && (VK_FALSE != physical_device_descriptor_indexing_features.runtimeDescriptorArray);
+    }
+
+    if (this->m_support_bindless)
+    {
+        PFN_vkGetPhysicalDeviceProperties2KHR const pfn_get_physical_device_properties_2 = reinterpret_cast<PFN_vkGetPhysicalDeviceProperties2KHR>(this->m_pfn_get_instance_proc_addr(this->m_instance, "vkGetPhysicalDeviceProperties2KHR"));
+        assert(NULL != pfn_get_physical_device_properties_2);
+
+        VkPhysicalDeviceDescriptorIndexingPropertiesEXT physical_device_descriptor_indexing_properties = {};
+        physical_device_descriptor_indexing_properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES_EXT;
+        physical_device_descriptor_indexing_properties.pNext = NULL;
+
+        VkPhysicalDeviceProperties2KHR physical_device_properties_2 = {
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2_KHR,
+            &physical_device_descriptor_indexing_properties};
+
+        pfn_get_physical_device_properties_2(this->m_physical_device, &physical_device_properties_2);
+
+        // the bindless descriptor set layout is visible to all shader stages, and both the per stage limits and the per descriptor set limits apply
+        this->m_bindless_descriptor_limits.max_read_only_storage_buffer_descriptor_count = (physical_device_descriptor_indexing_properties.maxPerStageDescriptorUpdateAfterBindStorageBuffers < physical_device_descriptor_indexing_properties.maxDescriptorSetUpdateAfterBindStorageBuffers) ? physical_device_descriptor_indexing_properties.maxPerStageDescriptorUpdateAfterBindStorageBuffers : physical_device_descriptor_indexing_properties.maxDescriptorSetUpdateAfterBindStorageBuffers;
+        this->m_bindless_descriptor_limits.max_sampled_image_descriptor_count = (physical_device_descriptor_indexing_properties.maxPerStageDescriptorUpdateAfterBindSampledImages < physical_device_descriptor_indexing_properties.maxDescriptorSetUpdateAfterBindSampledImages) ? physical_device_descriptor_indexing_properties.maxPerStageDescriptorUpdateAfterBindSampledImages : physical_device_descriptor_indexing_properties.maxDescriptorSetUpdateAfterBindSampledImages;
+        this->m_bindless_descriptor_limits.max_sampler_descriptor_count = (physical_device_descriptor_indexing_properties.maxPerStageDescriptorUpdateAfterBindSamplers < physical_device_descriptor_indexing_properties.maxDescriptorSetUpdateAfterBindSamplers) ? physical_device_descriptor_indexing_properties.maxPerStageDescriptorUpdateAfterBindSamplers : physical_device_descriptor_indexing_properties.maxDescriptorSetUpdateAfterBindSamplers;
+        this->m_bindless_descriptor_limits.max_resource_descriptor_count = physical_device_descriptor_indexing_properties.maxPerStageUpdateAfterBindResources;
+    }
+
+    std::chrono::steady_clock::time_point const physical_device_selection_end_time = std::chrono::steady_clock::now();
+
+    assert(false == this->m_physical_device_feature_texture_compression_BC);
+    assert(false == this->m_physical_device_feature_texture_compression_ASTC_LDR);
+    assert(VK_NULL_HANDLE == this->m_device);
+    {
+        // At most three queues (graphics, upload and compute) and the queues of the same family are created by the same create info
+        constexpr uint32_t const max_device_queue_count = 3U;
+        float const queue_priorities[max_device_queue_count] = {1.0F, 1.0F, 1.0F};
+        VkDeviceQueueCreateInfo device_queue_create_infos[max_device_queue_count];
+        uint32_t device_queue_create_info_count = 0U;
+        {
+            uint32_t const device_queue_family_indices[max_device_queue_count] = {
+                this->m_graphics_queue_family_index,
+                this->m_has_dedicated_upload_queue ? this->m_upload_queue_family_index : VK_QUEUE_FAMILY_IGNORED,
+                this->m_has_dedicated_compute_queue ? this->m_compute_queue_family_index : VK_QUEUE_FAMILY_IGNORED};
+
+            uint32_t const device_queue_queue_indices[max_device_queue_count] = {
+                new_graphics_queue_queue_index,
+                new_upload_queue_queue_index,
+                new_compute_queue_queue_index};
+
             assert(0U == new_graphics_queue_queue_index);
-            device_queue_create_infos[0].queueCount = 1U;
-            device_queue_create_infos[0].pQueuePriorities = &graphics_queue_priority;
-            device_queue_create_info_count = 1U;
+
+            for (uint32_t device_queue_index = 0U; device_queue_index < max_device_queue_count; ++device_queue_index)
+            {
+                if (VK_QUEUE_FAMILY_IGNORED != device_queue_family_indices[device_queue_index])
+                {
+                    uint32_t device_queue_create_info_index = 0U;
+                    while ((device_queue_create_info_index < device_queue_create_info_count) && (device_queue_family_indices[device_queue_index] != device_queue_create_infos[device_queue_create_info_index].queueFamilyIndex))
+                    {
+                        ++device_queue_create_info_index;
+                    }
+
+                    if (device_queue_create_info_index < device_queue_create_info_count)
+                    {
+                        // the queue indices of the same family are contiguous
+                        assert(device_queue_queue_indices[device_queue_index] == device_queue_create_infos[device_queue_create_info_index].queueCount);
+                        device_queue_create_infos[device_queue_create_info_index].queueCount = device_queue_queue_indices[device_queue_index] + 1U;
+                    }
+                    else
+                    {
+                        assert(0U == device_queue_queue_indices[device_queue_index]);
+                        device_queue_create_infos[device_queue_create_info_index].sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+                        device_queue_create_infos[device_queue_create_info_index].pNext = NULL;
+                        device_queue_create_infos[device_queue_create_info_index].flags = 0U;
+                        device_queue_create_infos[device_queue_create_info_index].queueFamilyIndex = device_queue_family_indices[device_queue_index];
+                        device_queue_create_infos[device_queue_create_info_index].queueCount = 1U;
+                        device_queue_create_infos[device_queue_create_info_index].pQueuePriorities = queue_priorities;
+                        ++device_queue_create_info_count;
+                    }
+                }
+            }
         }
 
         // TODO: VK_KHR_RAY_TRACING_PIPELINE_EXTENSION_NAME
 
-        char const *const enabled_extension_names[] = {
-            VK_KHR_SWAPCHAIN_EXTENSION_NAME,
-            VK_KHR_ACCELERATION_STRUCTURE_EXTENSION_NAME,
-            VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME,
-            VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME,
-            VK_KHR_DEFERRED_HOST_OPERATIONS_EXTENSION_NAME,
-            VK_KHR_RAY_QUERY_EXTENSION_NAME,
-            VK_KHR_SPIRV_1_4_EXTENSION_NAME,
-            VK_KHR_SHADER_FLOAT_CONTROLS_EXTENSION_NAME};
+        mcrt_vector<char const *> enabled_extension_names;
+        enabled_extension_names.push_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+
+        if (this->m_support_descriptor_update_template)
+        {
+            enabled_extension_names.push_back(VK_KHR_DESCRIPTOR_UPDATE_TEMPLATE_EXTENSION_NAME);
+        }
+
+        if (this->m_support_multiview)
+        {
+            enabled_extension_names.push_back(VK_KHR_MULTIVIEW_EXTENSION_NAME);
+        }
 
-        uint32_t const enabled_extension_count = !this->m_support_ray_tracing ? 1U : (sizeof(enabled_extension_names) / sizeof(enabled_extension_names[0]));
+        if (this->m_support_dynamic_rendering)
+        {
+            // VK_KHR_dynamic_rendering => VK_KHR_depth_stencil_resolve => VK_KHR_create_renderpass2 => VK_KHR_multiview + VK_KHR_maintenance2
+            enabled_extension_names.push_back(VK_KHR_MAINTENANCE2_EXTENSION_NAME);
+            enabled_extension_names.push_back(VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME);
+            enabled_extension_names.push_back(VK_KHR_DEPTH_STENCIL_RESOLVE_EXTENSION_NAME);
+            enabled_extension_names.push_back(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME);
+        }
+
+        if (this->m_support_graphics_pipeline_library)
+        {
+            enabled_extension_names.push_back(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME);
+            enabled_extension_names.push_back(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
+        }
+
+        if (this->m_support_extended_dynamic_state)
+        {
+            enabled_extension_names.push_back(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME);
+            enabled_extension_names.push_back(VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME);
+        }
+
+        if (this->m_support_ray_tracing)
+        {
+            enabled_extension_names.push_back(VK_KHR_ACCELERATION_STRUCTURE_EXTENSION_NAME);
+            enabled_extension_names.push_back(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME);
+            enabled_extension_names.push_back(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME);
+            enabled_extension_names.push_back(VK_KHR_DEFERRED_HOST_OPERATIONS_EXTENSION_NAME);
+            enabled_extension_names.push_back(VK_KHR_RAY_QUERY_EXTENSION_NAME);
+            enabled_extension_names.push_back(VK_KHR_SPIRV_1_4_EXTENSION_NAME);
+            enabled_extension_names.push_back(VK_KHR_SHADER_FLOAT_CONTROLS_EXTENSION_NAME);
+        }
+
+        if (this->m_support_bindless)
+        {
+            enabled_extension_names.push_back(VK_KHR_MAINTENANCE3_EXTENSION_NAME);
+
+            // the VK_EXT_descriptor_indexing has already been enabled by the ray tracing
+            if (!this->m_support_ray_tracing)
+            {
+                enabled_extension_names.push_back(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME);
+            }
+        }
+
+        if (this->m_support_mesh_shader)
+        {
+            enabled_extension_names.push_back(VK_EXT_MESH_SHADER_EXTENSION_NAME);
+            enabled_extension_names.push_back(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
+
+            // the VK_KHR_spirv_1_4 and VK_KHR_shader_float_controls have already been enabled by the ray tracing
+            if (!this->m_support_ray_tracing)
+            {
+                enabled_extension_names.push_back(VK_KHR_SPIRV_1_4_EXTENSION_NAME);
+                enabled_extension_names.push_back(VK_KHR_SHADER_FLOAT_CONTROLS_EXTENSION_NAME);
+            }
+        }
+
+        if (this->m_subgroup_properties.support_subgroup_size_control)
+        {
+            enabled_extension_names.push_back(VK_EXT_SUBGROUP_SIZE_CONTROL_EXTENSION_NAME);
+        }
 
         PFN_vkGetPhysicalDeviceFeatures const pfn_get_physical_device_features = reinterpret_cast<PFN_vkGetPhysicalDeviceFeatures>(this->m_pfn_get_instance_proc_addr(this->m_instance, "vkGetPhysicalDeviceFeatures"));
         assert(NULL != pfn_get_physical_device_features);
@@ -611,6 +1123,8 @@ void brx_pal_vk_device::init(void *wsi_connection, bool support_ray_tracing)
         // we do not need both at the same time
         assert(!(this->m_physical_device_feature_texture_compression_BC && this->m_physical_device_feature_texture_compression_ASTC_LDR));
 
+        this->m_physical_device_feature_sampler_anisotropy = (VK_FALSE != physical_device_supported_features.samplerAnisotropy) ? true : false;
+
         VkPhysicalDeviceFeatures const physical_device_enabled_features = {
             VK_FALSE,
             VK_FALSE,
@@ -631,7 +1145,8 @@ void brx_pal_vk_device::init(void *wsi_connection, bool support_ray_tracing)
             VK_FALSE,
             VK_FALSE,
             VK_FALSE,
-            VK_FALSE,
+            // samplerAnisotropy
+            ((this->m_physical_device_feature_sampler_anisotropy) ? static_cast<VkBool32>(VK_TRUE) : static_cast<VkBool32>(VK_FALSE)),
             VK_FALSE,
             ((this->m_physical_device_feature_texture_compression_ASTC_LDR) ? static_cast<VkBool32>(VK_TRUE) : static_cast<VkBool32>(VK_FALSE)),
             ((this->m_physical_device_feature_texture_compression_BC) ? static_cast<VkBool32>(VK_TRUE) : static_cast<VkBool32>(VK_FALSE)),
@@ -694,9 +1209,12 @@ void brx_pal_vk_device::init(void *wsi_connection, bool support_ray_tracing)
             VK_FALSE,
             VK_FALSE};
 
+        void const *const ray_tracing_device_create_info_next = (!this->m_support_ray_tracing) ? NULL : &physical_device_buffer_device_address_features;
+
+        // the update after bind features are only enabled when they have been queried to be supported (bindless)
         VkPhysicalDeviceDescriptorIndexingFeaturesEXT const physical_device_descriptor_indexing_features = {
             VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT,
-            const_cast<VkPhysicalDeviceBufferDeviceAddressFeaturesKHR *>(&physical_device_buffer_device_address_features),
+            const_cast<void *>(ray_tracing_device_create_info_next),
             VK_FALSE,
             VK_FALSE,
             VK_FALSE,
@@ -708,17 +1226,80 @@ void brx_pal_vk_device::init(void *wsi_connection, bool support_ray_tracing)
             VK_FALSE,
             VK_FALSE,
             VK_FALSE,
+            // descriptorBindingSampledImageUpdateAfterBind
+            (this->m_support_bindless ? static_cast<VkBool32>(VK_TRUE) : static_cast<VkBool32>(VK_FALSE)),
             VK_FALSE,
+            // descriptorBindingStorageBufferUpdateAfterBind
+            (this->m_support_bindless ? static_cast<VkBool32>(VK_TRUE) : static_cast<VkBool32>(VK_FALSE)),
             VK_FALSE,
             VK_FALSE,
+            // descriptorBindingUpdateUnusedWhilePending
+            (this->m_support_bindless ? static_cast<VkBool32>(VK_TRUE) : static_cast<VkBool32>(VK_FALSE)),
+            // descriptorBindingPartiallyBound
+            (this->m_support_bindless ? static_cast<VkBool32>(VK_TRUE) : static_cast<VkBool32>(VK_FALSE)),
+            // descriptorBindingVariableDescriptorCount (ray tracing)
+            (this->m_support_ray_tracing ? static_cast<VkBool32>(VK_TRUE) : static_cast<VkBool32>(VK_FALSE)),
+            VK_TRUE};
+
+        void const *const descriptor_indexing_device_create_info_next = ((!this->m_support_ray_tracing) && (!this->m_support_bindless)) ? ray_tracing_device_create_info_next : &physical_device_descriptor_indexing_features;
+
+        VkPhysicalDeviceDynamicRenderingFeaturesKHR const physical_device_dynamic_rendering_features = {
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR,
+            const_cast<void *>(descriptor_indexing_device_create_info_next),
+            VK_TRUE};
+
+        void const *const dynamic_rendering_device_create_info_next = (!this->m_support_dynamic_rendering) ? descriptor_indexing_device_create_info_next : &physical_device_dynamic_rendering_features;
+
+        VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT const physical_device_graphics_pipeline_library_features = {
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT,
+            const_cast<void *>(dynamic_rendering_device_create_info_next),
+            VK_TRUE};
+
+        void const *const graphics_pipeline_library_device_create_info_next = (!this->m_support_graphics_pipeline_library) ? dynamic_rendering_device_create_info_next : &physical_device_graphics_pipeline_library_features;
+
+        // only the color blend enable and the color blend equation of the VK_EXT_extended_dynamic_state3 are used
+        VkPhysicalDeviceExtendedDynamicState3FeaturesEXT physical_device_extended_dynamic_state_3_features = {};
+        physical_device_extended_dynamic_state_3_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_FEATURES_EXT;
+        physical_device_extended_dynamic_state_3_features.pNext = const_cast<void *>(graphics_pipeline_library_device_create_info_next);
+        physical_device_extended_dynamic_state_3_features.extendedDynamicState3ColorBlendEnable = VK_TRUE;
+        physical_device_extended_dynamic_state_3_features.extendedDynamicState3ColorBlendEquation = VK_TRUE;
+
+        VkPhysicalDeviceExtendedDynamicStateFeaturesEXT const physical_device_extended_dynamic_state_features = {
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT,
+            &physical_device_extended_dynamic_state_3_features,
+            VK_TRUE};
+
+        void const *const extended_dynamic_state_device_create_info_next = (!this->m_support_extended_dynamic_state) ? graphics_pipeline_library_device_create_info_next : &physical_device_extended_dynamic_state_features;
+
+        // the "multiviewMeshShader" is NOT required since the multiview is NOT supported by the mesh shader graphics pipeline
+        VkPhysicalDeviceMeshShaderFeaturesEXT const physical_device_mesh_shader_features = {
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_EXT,
+            const_cast<void *>(extended_dynamic_state_device_create_info_next),
+            VK_TRUE,
+            VK_TRUE,
             VK_FALSE,
             VK_FALSE,
-            VK_FALSE,
-            VK_FALSE,
+            VK_FALSE};
+
+        void const *const mesh_shader_device_create_info_next = (!this->m_support_mesh_shader) ? extended_dynamic_state_device_create_info_next : &physical_device_mesh_shader_features;
+
+        VkPhysicalDeviceSubgroupSizeControlFeaturesEXT const physical_device_subgroup_size_control_features = {
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_FEATURES_EXT,
+            const_cast<void *>(mesh_shader_device_create_info_next),
             VK_TRUE,
             VK_TRUE};
 
-        void const *const device_create_info_next = (!this->m_support_ray_tracing) ? NULL : &physical_device_descriptor_indexing_features;
+        void const *const subgroup_size_control_device_create_info_next = (!this->m_subgroup_properties.support_subgroup_size_control) ? mesh_shader_device_create_info_next : &physical_device_subgroup_size_control_features;
+
+        // the "multiview" feature is required when the VK_KHR_multiview is supported
+        VkPhysicalDeviceMultiviewFeaturesKHR const physical_device_multiview_features = {
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES_KHR,
+            const_cast<void *>(subgroup_size_control_device_create_info_next),
+            VK_TRUE,
+            VK_FALSE,
+            VK_FALSE};
+
+        void const *const device_create_info_next = (!this->m_support_multiview) ? subgroup_size_control_device_create_info_next : &physical_device_multiview_features;
 
         VkDeviceCreateInfo const device_create_info = {
             VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
@@ -728,8 +1309,8 @@ void brx_pal_vk_device::init(void *wsi_connection, bool support_ray_tracing)
             device_queue_create_infos,
             0U,
             NULL,
-            enabled_extension_count,
-            enabled_extension_names,
+            static_cast<uint32_t>(enabled_extension_names.size()),
+            &enabled_extension_names[0],
             &physical_device_enabled_features};
         VkResult const res_create_device = pfn_create_device(this->m_physical_device, &device_create_info, this->m_allocation_callbacks, &this->m_device);
         assert(VK_SUCCESS == res_create_device);
@@ -743,6 +1324,7 @@ void brx_pal_vk_device::init(void *wsi_connection, bool support_ray_tracing)
 
     this->m_graphics_queue = VK_NULL_HANDLE;
     this->m_upload_queue = VK_NULL_HANDLE;
+    this->m_compute_queue = VK_NULL_HANDLE;
     {
         PFN_vkGetDeviceQueue const pfn_get_device_queue = reinterpret_cast<PFN_vkGetDeviceQueue>(this->m_pfn_get_device_proc_addr(this->m_device, "vkGetDeviceQueue"));
         assert(NULL != pfn_get_device_queue);
@@ -755,6 +1337,13 @@ void brx_pal_vk_device::init(void *wsi_connection, bool support_ray_tracing)
             assert(static_cast<uint32_t>(-1) != new_upload_queue_queue_index);
             pfn_get_device_queue(this->m_device, this->m_upload_queue_family_index, new_upload_queue_queue_index, &this->m_upload_queue);
         }
+
+        if (this->m_has_dedicated_compute_queue)
+        {
+            assert(VK_QUEUE_FAMILY_IGNORED != this->m_compute_queue_family_index);
+            assert(static_cast<uint32_t>(-1) != new_compute_queue_queue_index);
+            pfn_get_device_queue(this->m_device, this->m_compute_queue_family_index, new_compute_queue_queue_index, &this->m_compute_queue);
+        }
     }
     assert(VK_NULL_HANDLE != this->m_graphics_queue);
     assert(!this->m_has_dedicated_upload_queue || VK_NULL_HANDLE != this->m_upload_queue);
@@ -814,6 +1403,8 @@ void brx_pal_vk_device::init(void *wsi_connection, bool support_ray_tracing)
         }
     }
 
+    std::chrono::steady_clock::time_point const device_creation_end_time = std::chrono::steady_clock::now();
+
     assert(VK_NULL_HANDLE == this->m_memory_allocator);
     {
         VmaVulkanFunctions vulkan_functions = {};
@@ -834,1230 +1425,1635 @@ void brx_pal_vk_device::init(void *wsi_connection, bool support_ray_tracing)
         vmaCreateAllocator(&allocator_create_info, &this->m_memory_allocator);
     }
 
-    assert(VK_NULL_HANDLE == this->m_uniform_upload_buffer_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_staging_upload_buffer_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_storage_intermediate_buffer_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_storage_asset_buffer_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_color_transient_attachment_image_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_color_attachment_sampled_image_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_depth_transient_attachment_image_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_depth_attachment_sampled_image_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_depth_stencil_transient_attachment_image_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_depth_stencil_attachment_sampled_image_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_storage_intermediate_image_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_sampled_asset_image_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_scratch_buffer_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_intermediate_bottom_level_acceleration_structure_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_non_compacted_bottom_level_acceleration_structure_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_compacted_bottom_level_acceleration_structure_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_top_level_acceleration_structure_instance_upload_buffer_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_top_level_acceleration_structure_memory_pool);
+    assert(VK_NULL_HANDLE == this->m_uniform_upload_buffer_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_staging_upload_buffer_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_storage_intermediate_buffer_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_storage_asset_buffer_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_color_transient_attachment_image_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_color_attachment_sampled_image_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_depth_transient_attachment_image_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_depth_attachment_sampled_image_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_depth_stencil_transient_attachment_image_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_depth_stencil_attachment_sampled_image_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_storage_intermediate_image_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_sampled_asset_image_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_scratch_buffer_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_intermediate_bottom_level_acceleration_structure_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_non_compacted_bottom_level_acceleration_structure_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_compacted_bottom_level_acceleration_structure_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_serialized_bottom_level_acceleration_structure_buffer_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_top_level_acceleration_structure_instance_upload_buffer_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_top_level_acceleration_structure_memory_pool.load());
+
+    // the memory pools are created when first used, and only the memory properties are queried here
     {
         PFN_vkGetPhysicalDeviceMemoryProperties const pfn_get_physical_device_memory_properties = reinterpret_cast<PFN_vkGetPhysicalDeviceMemoryProperties>(this->m_pfn_get_instance_proc_addr(this->m_instance, "vkGetPhysicalDeviceMemoryProperties"));
-        PFN_vkCreateBuffer const pfn_create_buffer = reinterpret_cast<PFN_vkCreateBuffer>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateBuffer"));
-        PFN_vkGetBufferMemoryRequirements const pfn_get_buffer_memory_requirements = reinterpret_cast<PFN_vkGetBufferMemoryRequirements>(this->m_pfn_get_device_proc_addr(this->m_device, "vkGetBufferMemoryRequirements"));
-        PFN_vkDestroyBuffer const pfn_destroy_buffer = reinterpret_cast<PFN_vkDestroyBuffer>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyBuffer"));
-        PFN_vkGetPhysicalDeviceFormatProperties const pfn_get_physical_device_format_properties = reinterpret_cast<PFN_vkGetPhysicalDeviceFormatProperties>(this->m_pfn_get_instance_proc_addr(this->m_instance, "vkGetPhysicalDeviceFormatProperties"));
-        PFN_vkCreateImage const pfn_create_image = reinterpret_cast<PFN_vkCreateImage>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateImage"));
-        PFN_vkGetImageMemoryRequirements const pfn_get_image_memory_requirements = reinterpret_cast<PFN_vkGetImageMemoryRequirements>(this->m_pfn_get_device_proc_addr(this->m_device, "vkGetImageMemoryRequirements"));
-        PFN_vkDestroyImage const pfn_destroy_image = reinterpret_cast<PFN_vkDestroyImage>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyImage"));
-
-        VkPhysicalDeviceMemoryProperties physical_device_memory_properties;
-        pfn_get_physical_device_memory_properties(this->m_physical_device, &physical_device_memory_properties);
-
-        // https://www.khronos.org/registry/vulkan/specs/1.0/html/chap13.html#VkMemoryRequirements
-        // If buffer is a VkBuffer not created with the VK_BUFFER_CREATE_SPARSE_BINDING_BIT bit set, or if image is linear image,
-        // then the memoryTypeBits member always contains at least one bit set corresponding to a VkMemoryType with a
-        // propertyFlags that has both the VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT bit and the
-        // VK_MEMORY_PROPERTY_HOST_COHERENT_BIT bit set. In other words, mappable coherent memory can always be attached to
-        // these objects.
-
-        // https://www.khronos.org/registry/vulkan/specs/1.0/html/chap13.html#VkMemoryRequirements
-        // The memoryTypeBits member is identical for all VkBuffer objects created with the same value for the flags and usage
-        // members in the VkBufferCreateInfo structure passed to vkCreateBuffer. Further, if usage1 and usage2 of type
-        // VkBufferUsageFlags are such that the bits set in usage2 are a subset of the bits set in usage1, and they have the same flags,
-        // then the bits set in memoryTypeBits returned for usage1 must be a subset of the bits set in memoryTypeBits returned for
-        // usage2, for all values of flags.
-
-        // uniform upload buffer
-        assert(VK_NULL_HANDLE == this->m_uniform_upload_buffer_memory_pool);
-        {
-            uint32_t uniform_upload_buffer_memory_index = VK_MAX_MEMORY_TYPES;
-
-            VkDeviceSize memory_requirements_size = static_cast<VkDeviceSize>(-1);
-            uint32_t memory_requirements_memory_type_bits = 0U;
-            {
-                VkBufferCreateInfo const buffer_create_info = {
-                    VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
-                    NULL,
-                    0U,
-                    // NVIDIA Driver 128 MB
-                    // \[Gruen 2015\] [Holger Gruen. "Constant Buffers without Constant Pain." NVIDIA GameWorks Blog 2015.](https://developer.nvidia.com/content/constant-buffers-without-constant-pain-0)
-                    // AMD Special Pool 256MB
-                    // \[Sawicki 2018\] [Adam Sawicki. "Memory Management in Vulkan and DX12." GDC 2018.](https://gpuopen.com/events/gdc-2018-presentations)
-                    1,
-                    VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
-                    VK_SHARING_MODE_EXCLUSIVE,
-                    0U,
-                    NULL};
-
-                VkBuffer dummy_buf;
-                VkResult const res_create_buffer = pfn_create_buffer(this->m_device, &buffer_create_info, this->m_allocation_callbacks, &dummy_buf);
-                assert(VK_SUCCESS == res_create_buffer);
-
-                VkMemoryRequirements memory_requirements;
-                pfn_get_buffer_memory_requirements(this->m_device, dummy_buf, &memory_requirements);
-                memory_requirements_size = memory_requirements.size;
-                memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
-
-                pfn_destroy_buffer(this->m_device, dummy_buf, this->m_allocation_callbacks);
-            }
+        assert(NULL != pfn_get_physical_device_memory_properties);
+        pfn_get_physical_device_memory_properties(this->m_physical_device, &this->m_physical_device_memory_properties);
+    }
 
-            // VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
-            // We use the "AMD Special Pool" for upload ring buffer
-            uniform_upload_buffer_memory_index = _internal_find_lowest_memory_type_index(&physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-            assert(VK_MAX_MEMORY_TYPES > uniform_upload_buffer_memory_index);
-            assert(physical_device_memory_properties.memoryTypeCount > uniform_upload_buffer_memory_index);
+    std::chrono::steady_clock::time_point const memory_allocator_creation_end_time = std::chrono::steady_clock::now();
 
-            VmaPoolCreateInfo const pool_create_info = {
-                uniform_upload_buffer_memory_index,
-                VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
-                0U,
+    assert(NULL == this->m_pfn_wait_for_fences);
+    this->m_pfn_wait_for_fences = reinterpret_cast<PFN_vkWaitForFences>(this->m_pfn_get_device_proc_addr(this->m_device, "vkWaitForFences"));
+    assert(NULL != this->m_pfn_wait_for_fences);
+
+    assert(NULL == this->m_pfn_reset_fences);
+    this->m_pfn_reset_fences = reinterpret_cast<PFN_vkResetFences>(this->m_pfn_get_device_proc_addr(this->m_device, "vkResetFences"));
+    assert(NULL != this->m_pfn_reset_fences);
+
+    assert(NULL == this->m_pfn_reset_command_pool);
+    this->m_pfn_reset_command_pool = reinterpret_cast<PFN_vkResetCommandPool>(this->m_pfn_get_device_proc_addr(this->m_device, "vkResetCommandPool"));
+    assert(NULL != this->m_pfn_reset_command_pool);
+
+    assert(NULL == this->m_pfn_acquire_next_image);
+    this->m_pfn_acquire_next_image = reinterpret_cast<PFN_vkAcquireNextImageKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkAcquireNextImageKHR"));
+    assert(NULL != this->m_pfn_acquire_next_image);
+
+    assert(NULL == this->m_pfn_create_image_view);
+    this->m_pfn_create_image_view = reinterpret_cast<PFN_vkCreateImageView>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateImageView"));
+    assert(NULL != this->m_pfn_create_image_view);
+
+    assert(NULL == this->m_pfn_destroy_image_view);
+    this->m_pfn_destroy_image_view = reinterpret_cast<PFN_vkDestroyImageView>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyImageView"));
+    assert(NULL != this->m_pfn_destroy_image_view);
+
+    assert(NULL == this->m_pfn_create_buffer);
+    this->m_pfn_create_buffer = reinterpret_cast<PFN_vkCreateBuffer>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateBuffer"));
+    assert(NULL != this->m_pfn_create_buffer);
+
+    assert(NULL == this->m_pfn_get_buffer_memory_requirements);
+    this->m_pfn_get_buffer_memory_requirements = reinterpret_cast<PFN_vkGetBufferMemoryRequirements>(this->m_pfn_get_device_proc_addr(this->m_device, "vkGetBufferMemoryRequirements"));
+    assert(NULL != this->m_pfn_get_buffer_memory_requirements);
+
+    assert(NULL == this->m_pfn_destroy_buffer);
+    this->m_pfn_destroy_buffer = reinterpret_cast<PFN_vkDestroyBuffer>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyBuffer"));
+    assert(NULL != this->m_pfn_destroy_buffer);
+
+    assert(NULL == this->m_pfn_create_image);
+    this->m_pfn_create_image = reinterpret_cast<PFN_vkCreateImage>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateImage"));
+    assert(NULL != this->m_pfn_create_image);
+
+    assert(NULL == this->m_pfn_get_image_memory_requirements);
+    this->m_pfn_get_image_memory_requirements = reinterpret_cast<PFN_vkGetImageMemoryRequirements>(this->m_pfn_get_device_proc_addr(this->m_device, "vkGetImageMemoryRequirements"));
+    assert(NULL != this->m_pfn_get_image_memory_requirements);
+
+    assert(NULL == this->m_pfn_destroy_image);
+    this->m_pfn_destroy_image = reinterpret_cast<PFN_vkDestroyImage>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyImage"));
+    assert(NULL != this->m_pfn_destroy_image);
+
+    if (this->m_support_ray_tracing)
+    {
+        assert(NULL == this->m_pfn_get_buffer_device_address);
+        this->m_pfn_get_buffer_device_address = reinterpret_cast<PFN_vkGetBufferDeviceAddress>(this->m_pfn_get_device_proc_addr(this->m_device, "vkGetBufferDeviceAddressKHR"));
+        assert(NULL != this->m_pfn_get_buffer_device_address);
+
+        assert(NULL == this->m_pfn_create_acceleration_structure);
+        this->m_pfn_create_acceleration_structure = reinterpret_cast<PFN_vkCreateAccelerationStructureKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateAccelerationStructureKHR"));
+        assert(NULL != this->m_pfn_create_acceleration_structure);
+
+        assert(NULL == this->m_pfn_destroy_acceleration_structure);
+        this->m_pfn_destroy_acceleration_structure = reinterpret_cast<PFN_vkDestroyAccelerationStructureKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyAccelerationStructureKHR"));
+        assert(NULL != this->m_pfn_destroy_acceleration_structure);
+
+        assert(NULL == this->m_pfn_get_acceleration_structure_device_address);
+        this->m_pfn_get_acceleration_structure_device_address = reinterpret_cast<PFN_vkGetAccelerationStructureDeviceAddressKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkGetAccelerationStructureDeviceAddressKHR"));
+        assert(NULL != this->m_pfn_get_acceleration_structure_device_address);
+
+        assert(NULL == this->m_pfn_get_query_pool_results);
+        this->m_pfn_get_query_pool_results = reinterpret_cast<PFN_vkGetQueryPoolResults>(this->m_pfn_get_device_proc_addr(this->m_device, "vkGetQueryPoolResults"));
+        assert(NULL != this->m_pfn_get_query_pool_results);
+    }
+
+    this->m_shader_module_cache.init(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks);
+
+    this->m_sampler_cache.init(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks, this->m_physical_device_feature_sampler_anisotropy);
+
+    assert(VK_NULL_HANDLE == this->m_graphics_pipeline_vertex_input_interface_library);
+    if (this->m_support_graphics_pipeline_library)
+    {
+        PFN_vkCreateGraphicsPipelines const pfn_create_graphics_pipelines = reinterpret_cast<PFN_vkCreateGraphicsPipelines>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateGraphicsPipelines"));
+        assert(NULL != pfn_create_graphics_pipelines);
+
+        VkPipelineVertexInputStateCreateInfo const vertex_input_state = {
+            VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO,
+            NULL,
+            0U,
+            0U,
+            NULL,
+            0U,
+            NULL};
+
+        VkPipelineInputAssemblyStateCreateInfo const input_assembly_state = {
+            VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO,
+            NULL,
+            0U,
+            VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST,
+            VK_FALSE};
+
+        VkGraphicsPipelineLibraryCreateInfoEXT const graphics_pipeline_library_create_info = {
+            VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT,
+            NULL,
+            VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT};
+
+        VkGraphicsPipelineCreateInfo const graphics_pipeline_create_info = {
+            VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+            &graphics_pipeline_library_create_info,
+            VK_PIPELINE_CREATE_LIBRARY_BIT_KHR | VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT,
+            0U,
+            NULL,
+            &vertex_input_state,
+            &input_assembly_state,
+            NULL,
+            NULL,
+            NULL,
+            NULL,
+            NULL,
+            NULL,
+            NULL,
+            VK_NULL_HANDLE,
+            VK_NULL_HANDLE,
+            0U,
+            VK_NULL_HANDLE,
+            0U};
+        VkResult const res_create_graphics_pipelines = pfn_create_graphics_pipelines(this->m_device, VK_NULL_HANDLE, 1U, &graphics_pipeline_create_info, this->m_allocation_callbacks, &this->m_graphics_pipeline_vertex_input_interface_library);
+        assert(VK_SUCCESS == res_create_graphics_pipelines);
+    }
+
+    std::chrono::steady_clock::time_point const init_end_time = std::chrono::steady_clock::now();
+
+    this->m_device_creation_timing.instance_creation_nanoseconds = _internal_get_elapsed_nanoseconds(init_begin_time, instance_creation_end_time);
+    this->m_device_creation_timing.physical_device_selection_nanoseconds = _internal_get_elapsed_nanoseconds(instance_creation_end_time, physical_device_selection_end_time);
+    this->m_device_creation_timing.device_creation_nanoseconds = _internal_get_elapsed_nanoseconds(physical_device_selection_end_time, device_creation_end_time);
+    this->m_device_creation_timing.memory_allocator_creation_nanoseconds = _internal_get_elapsed_nanoseconds(device_creation_end_time, memory_allocator_creation_end_time);
+    this->m_device_creation_timing.total_nanoseconds = _internal_get_elapsed_nanoseconds(init_begin_time, init_end_time);
+}
+
+extern void brx_pal_destroy_vk_device(brx_pal_device *wrapped_device)
+{
+    assert(NULL != wrapped_device);
+    brx_pal_vk_device *delete_unwrapped_device = static_cast<brx_pal_vk_device *>(wrapped_device);
+
+    delete_unwrapped_device->uninit();
+
+    delete_unwrapped_device->~brx_pal_vk_device();
+    mcrt_free(delete_unwrapped_device);
+}
+
+void brx_pal_vk_device::uninit()
+{
+    assert(NULL != this->m_pfn_get_instance_proc_addr);
+    assert(VK_NULL_HANDLE != this->m_instance);
+#ifndef NDEBUG
+    assert(VK_NULL_HANDLE != this->m_message);
+#endif
+    assert(NULL != this->m_pfn_get_device_proc_addr);
+    assert(VK_NULL_HANDLE != this->m_device);
+    assert(VK_NULL_HANDLE != this->m_memory_allocator);
+
+    if (VK_NULL_HANDLE != this->m_graphics_pipeline_vertex_input_interface_library)
+    {
+        PFN_vkDestroyPipeline const pfn_destroy_pipeline = reinterpret_cast<PFN_vkDestroyPipeline>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyPipeline"));
+        assert(NULL != pfn_destroy_pipeline);
+
+        pfn_destroy_pipeline(this->m_device, this->m_graphics_pipeline_vertex_input_interface_library, this->m_allocation_callbacks);
+
+        this->m_graphics_pipeline_vertex_input_interface_library = VK_NULL_HANDLE;
+    }
+
+    this->m_shader_module_cache.uninit();
+
+    this->m_sampler_cache.uninit();
+
+    // the memory pool is NOT created if it has never been used
+    if (VK_NULL_HANDLE != this->m_uniform_upload_buffer_memory_pool.load())
+    {
+        vmaDestroyPool(this->m_memory_allocator, this->m_uniform_upload_buffer_memory_pool.load());
+        this->m_uniform_upload_buffer_memory_pool.store(VK_NULL_HANDLE);
+    }
+
+    if (VK_NULL_HANDLE != this->m_staging_upload_buffer_memory_pool.load())
+    {
+        vmaDestroyPool(this->m_memory_allocator, this->m_staging_upload_buffer_memory_pool.load());
+        this->m_staging_upload_buffer_memory_pool.store(VK_NULL_HANDLE);
+    }
+
+    if (VK_NULL_HANDLE != this->m_storage_intermediate_buffer_memory_pool.load())
+    {
+        vmaDestroyPool(this->m_memory_allocator, this->m_storage_intermediate_buffer_memory_pool.load());
+        this->m_storage_intermediate_buffer_memory_pool.store(VK_NULL_HANDLE);
+    }
+
+    if (VK_NULL_HANDLE != this->m_storage_asset_buffer_memory_pool.load())
+    {
+        vmaDestroyPool(this->m_memory_allocator, this->m_storage_asset_buffer_memory_pool.load());
+        this->m_storage_asset_buffer_memory_pool.store(VK_NULL_HANDLE);
+    }
+
+    if (VK_NULL_HANDLE != this->m_color_transient_attachment_image_memory_pool.load())
+    {
+        vmaDestroyPool(this->m_memory_allocator, this->m_color_transient_attachment_image_memory_pool.load());
+        this->m_color_transient_attachment_image_memory_pool.store(VK_NULL_HANDLE);
+    }
+
+    if (VK_NULL_HANDLE != this->m_color_attachment_sampled_image_memory_pool.load())
+    {
+        vmaDestroyPool(this->m_memory_allocator, this->m_color_attachment_sampled_image_memory_pool.load());
+        this->m_color_attachment_sampled_image_memory_pool.store(VK_NULL_HANDLE);
+    }
+
+    if (VK_NULL_HANDLE != this->m_depth_transient_attachment_image_memory_pool.load())
+    {
+        vmaDestroyPool(this->m_memory_allocator, this->m_depth_transient_attachment_image_memory_pool.load());
+        this->m_depth_transient_attachment_image_memory_pool.store(VK_NULL_HANDLE);
+    }
+
+    if (VK_NULL_HANDLE != this->m_depth_attachment_sampled_image_memory_pool.load())
+    {
+        vmaDestroyPool(this->m_memory_allocator, this->m_depth_attachment_sampled_image_memory_pool.load());
+        this->m_depth_attachment_sampled_image_memory_pool.store(VK_NULL_HANDLE);
+    }
+
+    if (VK_NULL_HANDLE != this->m_depth_stencil_transient_attachment_image_memory_pool.load())
+    {
+        vmaDestroyPool(this->m_memory_allocator, this->m_depth_stencil_transient_attachment_image_memory_pool.load());
+        this->m_depth_stencil_transient_attachment_image_memory_pool.store(VK_NULL_HANDLE);
+    }
+
+    if (VK_NULL_HANDLE != this->m_depth_stencil_attachment_sampled_image_memory_pool.load())
+    {
+        vmaDestroyPool(this->m_memory_allocator, this->m_depth_stencil_attachment_sampled_image_memory_pool.load());
+        this->m_depth_stencil_attachment_sampled_image_memory_pool.store(VK_NULL_HANDLE);
+    }
+
+    if (VK_NULL_HANDLE != this->m_storage_intermediate_image_memory_pool.load())
+    {
+        vmaDestroyPool(this->m_memory_allocator, this->m_storage_intermediate_image_memory_pool.load());
+        this->m_storage_intermediate_image_memory_pool.store(VK_NULL_HANDLE);
+    }
+
+    if (VK_NULL_HANDLE != this->m_sampled_asset_image_memory_pool.load())
+    {
+        vmaDestroyPool(this->m_memory_allocator, this->m_sampled_asset_image_memory_pool.load());
+        this->m_sampled_asset_image_memory_pool.store(VK_NULL_HANDLE);
+    }
+
+    if (VK_NULL_HANDLE != this->m_scratch_buffer_memory_pool.load())
+    {
+        vmaDestroyPool(this->m_memory_allocator, this->m_scratch_buffer_memory_pool.load());
+        this->m_scratch_buffer_memory_pool.store(VK_NULL_HANDLE);
+    }
+
+    if (VK_NULL_HANDLE != this->m_intermediate_bottom_level_acceleration_structure_memory_pool.load())
+    {
+        vmaDestroyPool(this->m_memory_allocator, this->m_intermediate_bottom_level_acceleration_structure_memory_pool.load());
+        this->m_intermediate_bottom_level_acceleration_structure_memory_pool.store(VK_NULL_HANDLE);
+    }
+
+    if (VK_NULL_HANDLE != this->m_non_compacted_bottom_level_acceleration_structure_memory_pool.load())
+    {
+        vmaDestroyPool(this->m_memory_allocator, this->m_non_compacted_bottom_level_acceleration_structure_memory_pool.load());
+        this->m_non_compacted_bottom_level_acceleration_structure_memory_pool.store(VK_NULL_HANDLE);
+    }
+
+    if (VK_NULL_HANDLE != this->m_compacted_bottom_level_acceleration_structure_memory_pool.load())
+    {
+        vmaDestroyPool(this->m_memory_allocator, this->m_compacted_bottom_level_acceleration_structure_memory_pool.load());
+        this->m_compacted_bottom_level_acceleration_structure_memory_pool.store(VK_NULL_HANDLE);
+    }
+
+    if (VK_NULL_HANDLE != this->m_serialized_bottom_level_acceleration_structure_buffer_memory_pool.load())
+    {
+        vmaDestroyPool(this->m_memory_allocator, this->m_serialized_bottom_level_acceleration_structure_buffer_memory_pool.load());
+        this->m_serialized_bottom_level_acceleration_structure_buffer_memory_pool.store(VK_NULL_HANDLE);
+    }
+
+    if (VK_NULL_HANDLE != this->m_top_level_acceleration_structure_instance_upload_buffer_memory_pool.load())
+    {
+        vmaDestroyPool(this->m_memory_allocator, this->m_top_level_acceleration_structure_instance_upload_buffer_memory_pool.load());
+        this->m_top_level_acceleration_structure_instance_upload_buffer_memory_pool.store(VK_NULL_HANDLE);
+    }
+
+    if (VK_NULL_HANDLE != this->m_top_level_acceleration_structure_memory_pool.load())
+    {
+        vmaDestroyPool(this->m_memory_allocator, this->m_top_level_acceleration_structure_memory_pool.load());
+        this->m_top_level_acceleration_structure_memory_pool.store(VK_NULL_HANDLE);
+    }
+
+    vmaDestroyAllocator(this->m_memory_allocator);
+    this->m_memory_allocator = VK_NULL_HANDLE;
+
+    PFN_vkDestroyDevice const pfn_destroy_device = reinterpret_cast<PFN_vkDestroyDevice>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyDevice"));
+    assert(NULL != pfn_destroy_device);
+    pfn_destroy_device(this->m_device, this->m_allocation_callbacks);
+    this->m_device = VK_NULL_HANDLE;
+
+    this->m_pfn_get_device_proc_addr = NULL;
+
+#ifndef NDEBUG
+    PFN_vkDestroyDebugUtilsMessengerEXT const pfn_destroy_debug_utils_messenger = reinterpret_cast<PFN_vkDestroyDebugUtilsMessengerEXT>(this->m_pfn_get_instance_proc_addr(this->m_instance, "vkDestroyDebugUtilsMessengerEXT"));
+    assert(NULL != pfn_destroy_debug_utils_messenger);
+    pfn_destroy_debug_utils_messenger(this->m_instance, this->m_message, this->m_allocation_callbacks);
+    this->m_message = VK_NULL_HANDLE;
+#endif
+
+    PFN_vkDestroyInstance pfn_destroy_instance = reinterpret_cast<PFN_vkDestroyInstance>(this->m_pfn_get_instance_proc_addr(this->m_instance, "vkDestroyInstance"));
+    assert(NULL != pfn_destroy_instance);
+    pfn_destroy_instance(this->m_instance, this->m_allocation_callbacks);
+    this->m_instance = VK_NULL_HANDLE;
+
+    this->m_pfn_get_instance_proc_addr = NULL;
+
+    this->m_fence_object_pool.uninit();
+    this->m_descriptor_set_object_pool.uninit();
+    this->m_graphics_pipeline_object_pool.uninit();
+    this->m_compute_pipeline_object_pool.uninit();
+    this->m_uniform_upload_buffer_object_pool.uninit();
+    this->m_staging_upload_buffer_object_pool.uninit();
+    this->m_storage_intermediate_buffer_object_pool.uninit();
+    this->m_color_attachment_image_object_pool.uninit();
+    this->m_depth_stencil_attachment_image_object_pool.uninit();
+    this->m_storage_image_object_pool.uninit();
+    this->m_sampled_asset_image_object_pool.uninit();
+}
+
+brx_pal_vk_device::~brx_pal_vk_device()
+{
+    assert(NULL == this->m_pfn_get_instance_proc_addr);
+    assert(VK_NULL_HANDLE == this->m_instance);
+#ifndef NDEBUG
+    assert(VK_NULL_HANDLE == this->m_message);
+#endif
+    assert(NULL == this->m_pfn_get_device_proc_addr);
+    assert(VK_NULL_HANDLE == this->m_device);
+    assert(VK_NULL_HANDLE == this->m_memory_allocator);
+    assert(VK_NULL_HANDLE == this->m_uniform_upload_buffer_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_staging_upload_buffer_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_storage_intermediate_buffer_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_storage_asset_buffer_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_color_transient_attachment_image_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_color_attachment_sampled_image_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_depth_transient_attachment_image_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_depth_attachment_sampled_image_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_depth_stencil_transient_attachment_image_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_depth_stencil_attachment_sampled_image_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_storage_intermediate_image_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_sampled_asset_image_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_scratch_buffer_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_intermediate_bottom_level_acceleration_structure_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_non_compacted_bottom_level_acceleration_structure_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_compacted_bottom_level_acceleration_structure_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_serialized_bottom_level_acceleration_structure_buffer_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_top_level_acceleration_structure_instance_upload_buffer_memory_pool.load());
+    assert(VK_NULL_HANDLE == this->m_top_level_acceleration_structure_memory_pool.load());
+}
+
+VmaPool brx_pal_vk_device::get_uniform_upload_buffer_memory_pool() const
+{
+    // https://www.khronos.org/registry/vulkan/specs/1.0/html/chap13.html#VkMemoryRequirements
+    // If buffer is a VkBuffer not created with the VK_BUFFER_CREATE_SPARSE_BINDING_BIT bit set, or if image is linear image,
+    // then the memoryTypeBits member always contains at least one bit set corresponding to a VkMemoryType with a
+    // propertyFlags that has both the VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT bit and the
+    // VK_MEMORY_PROPERTY_HOST_COHERENT_BIT bit set. In other words, mappable coherent memory can always be attached to
+    // these objects.
+
+    // https://www.khronos.org/registry/vulkan/specs/1.0/html/chap13.html#VkMemoryRequirements
+    // The memoryTypeBits member is identical for all VkBuffer objects created with the same value for the flags and usage
+    // members in the VkBufferCreateInfo structure passed to vkCreateBuffer. Further, if usage1 and usage2 of type
+    // VkBufferUsageFlags are such that the bits set in usage2 are a subset of the bits set in usage1, and they have the same flags,
+    // then the bits set in memoryTypeBits returned for usage1 must be a subset of the bits set in memoryTypeBits returned for
+    // usage2, for all values of flags.
+
+    VmaPool memory_pool = this->m_uniform_upload_buffer_memory_pool.load();
+    if (VK_NULL_HANDLE == memory_pool)
+    {
+        uint32_t uniform_upload_buffer_memory_index = VK_MAX_MEMORY_TYPES;
+
+        VkDeviceSize memory_requirements_size = static_cast<VkDeviceSize>(-1);
+        uint32_t memory_requirements_memory_type_bits = 0U;
+        {
+            VkBufferCreateInfo const buffer_create_info = {
+                VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+                NULL,
                 0U,
+                // NVIDIA Driver 128 MB
+                // \[Gruen 2015\] [Holger Gruen. "Constant Buffers without Constant Pain." NVIDIA GameWorks Blog 2015.](https://developer.nvidia.com/content/constant-buffers-without-constant-pain-0)
+                // AMD Special Pool 256MB
+                // \[Sawicki 2018\] [Adam Sawicki. "Memory Management in Vulkan and DX12." GDC 2018.](https://gpuopen.com/events/gdc-2018-presentations)
+                1,
+                VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
+                VK_SHARING_MODE_EXCLUSIVE,
                 0U,
-                1.0F,
-                (1U == this->m_min_uniform_buffer_offset_alignment) ? 0U : this->m_min_uniform_buffer_offset_alignment,
                 NULL};
 
-            VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &this->m_uniform_upload_buffer_memory_pool);
-            assert(VK_SUCCESS == res_vma_create_pool);
+            VkBuffer dummy_buf;
+            VkResult const res_create_buffer = this->m_pfn_create_buffer(this->m_device, &buffer_create_info, this->m_allocation_callbacks, &dummy_buf);
+            assert(VK_SUCCESS == res_create_buffer);
+
+            VkMemoryRequirements memory_requirements;
+            this->m_pfn_get_buffer_memory_requirements(this->m_device, dummy_buf, &memory_requirements);
+            memory_requirements_size = memory_requirements.size;
+            memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
+
+            this->m_pfn_destroy_buffer(this->m_device, dummy_buf, this->m_allocation_callbacks);
         }
 
-        // staging upload buffer
-        assert(VK_NULL_HANDLE == this->m_staging_upload_buffer_memory_pool);
-        {
-            uint32_t staging_upload_buffer_memory_index = VK_MAX_MEMORY_TYPES;
+        // VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+        // We use the "AMD Special Pool" for upload ring buffer
+        uniform_upload_buffer_memory_index = _internal_find_lowest_memory_type_index(&this->m_physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        assert(VK_MAX_MEMORY_TYPES > uniform_upload_buffer_memory_index);
+        assert(this->m_physical_device_memory_properties.memoryTypeCount > uniform_upload_buffer_memory_index);
 
-            VkDeviceSize memory_requirements_size = VkDeviceSize(-1);
-            uint32_t memory_requirements_memory_type_bits = 0U;
-            {
-                VkBufferCreateInfo const buffer_create_info = {
-                    VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
-                    NULL,
-                    0U,
-                    320ULL * 1024ULL * 1024ULL, // NOTE: 320 MB which is greater than 256MB "AMD Special Pool"
-                    VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                    VK_SHARING_MODE_EXCLUSIVE,
-                    0U,
-                    NULL};
-
-                VkBuffer dummy_buf;
-                VkResult const res_create_buffer = pfn_create_buffer(this->m_device, &buffer_create_info, this->m_allocation_callbacks, &dummy_buf);
-                assert(VK_SUCCESS == res_create_buffer);
-
-                VkMemoryRequirements memory_requirements;
-                pfn_get_buffer_memory_requirements(this->m_device, dummy_buf, &memory_requirements);
-                memory_requirements_size = memory_requirements.size;
-                memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
-
-                pfn_destroy_buffer(this->m_device, dummy_buf, this->m_allocation_callbacks);
-            }
+        VmaPoolCreateInfo const pool_create_info = {
+            uniform_upload_buffer_memory_index,
+            VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
+            0U,
+            0U,
+            0U,
+            1.0F,
+            (1U == this->m_min_uniform_buffer_offset_alignment) ? 0U : this->m_min_uniform_buffer_offset_alignment,
+            NULL};
 
-            // Do NOT use "VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT"
-            // We leave the "AMD Special Pool" for upload ring buffer
-            staging_upload_buffer_memory_index = _internal_find_lowest_memory_type_index(&physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-            assert(VK_MAX_MEMORY_TYPES > staging_upload_buffer_memory_index);
-            assert(physical_device_memory_properties.memoryTypeCount > staging_upload_buffer_memory_index);
+        VmaPool new_memory_pool = VK_NULL_HANDLE;
+        VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &new_memory_pool);
+        assert(VK_SUCCESS == res_vma_create_pool);
 
-            VmaPoolCreateInfo const pool_create_info = {
-                staging_upload_buffer_memory_index,
-                VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
-                0U,
+        memory_pool = this->publish_memory_pool(&this->m_uniform_upload_buffer_memory_pool, new_memory_pool);
+    }
+
+    return memory_pool;
+}
+
+VmaPool brx_pal_vk_device::get_staging_upload_buffer_memory_pool() const
+{
+    VmaPool memory_pool = this->m_staging_upload_buffer_memory_pool.load();
+    if (VK_NULL_HANDLE == memory_pool)
+    {
+        uint32_t staging_upload_buffer_memory_index = VK_MAX_MEMORY_TYPES;
+
+        VkDeviceSize memory_requirements_size = VkDeviceSize(-1);
+        uint32_t memory_requirements_memory_type_bits = 0U;
+        {
+            VkBufferCreateInfo const buffer_create_info = {
+                VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+                NULL,
                 0U,
+                320ULL * 1024ULL * 1024ULL, // NOTE: 320 MB which is greater than 256MB "AMD Special Pool"
+                VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                VK_SHARING_MODE_EXCLUSIVE,
                 0U,
-                1.0F,
-                (1U == this->m_optimal_buffer_copy_offset_alignment) ? 0U : this->m_optimal_buffer_copy_offset_alignment,
                 NULL};
 
-            VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &this->m_staging_upload_buffer_memory_pool);
-            assert(VK_SUCCESS == res_vma_create_pool);
+            VkBuffer dummy_buf;
+            VkResult const res_create_buffer = this->m_pfn_create_buffer(this->m_device, &buffer_create_info, this->m_allocation_callbacks, &dummy_buf);
+            assert(VK_SUCCESS == res_create_buffer);
+
+            VkMemoryRequirements memory_requirements;
+            this->m_pfn_get_buffer_memory_requirements(this->m_device, dummy_buf, &memory_requirements);
+            memory_requirements_size = memory_requirements.size;
+            memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
+
+            this->m_pfn_destroy_buffer(this->m_device, dummy_buf, this->m_allocation_callbacks);
         }
 
-        // storage intermediate buffer
-        assert(VK_NULL_HANDLE == this->m_storage_intermediate_buffer_memory_pool);
-        {
-            uint32_t storage_intermediate_buffer_memory_index = VK_MAX_MEMORY_TYPES;
+        // Do NOT use "VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT"
+        // We leave the "AMD Special Pool" for upload ring buffer
+        staging_upload_buffer_memory_index = _internal_find_lowest_memory_type_index(&this->m_physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+        assert(VK_MAX_MEMORY_TYPES > staging_upload_buffer_memory_index);
+        assert(this->m_physical_device_memory_properties.memoryTypeCount > staging_upload_buffer_memory_index);
 
-            VkDeviceSize memory_requirements_size = VkDeviceSize(-1);
-            uint32_t memory_requirements_memory_type_bits = 0U;
-            {
-                VkBufferUsageFlags const usage = (!this->m_support_ray_tracing) ? (VK_BUFFER_USAGE_STORAGE_BUFFER_BIT) : (VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT_KHR);
-
-                VkBufferCreateInfo const buffer_create_info = {
-                    VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
-                    NULL,
-                    0U,
-                    1U,
-                    usage,
-                    VK_SHARING_MODE_EXCLUSIVE,
-                    0U,
-                    NULL};
-
-                VkBuffer dummy_buf;
-                VkResult const res_create_buffer = pfn_create_buffer(this->m_device, &buffer_create_info, this->m_allocation_callbacks, &dummy_buf);
-                assert(VK_SUCCESS == res_create_buffer);
-
-                VkMemoryRequirements memory_requirements;
-                pfn_get_buffer_memory_requirements(this->m_device, dummy_buf, &memory_requirements);
-                memory_requirements_size = memory_requirements.size;
-                memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
-
-                pfn_destroy_buffer(this->m_device, dummy_buf, this->m_allocation_callbacks);
-            }
+        VmaPoolCreateInfo const pool_create_info = {
+            staging_upload_buffer_memory_index,
+            VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
+            0U,
+            0U,
+            0U,
+            1.0F,
+            (1U == this->m_optimal_buffer_copy_offset_alignment) ? 0U : this->m_optimal_buffer_copy_offset_alignment,
+            NULL};
+
+        VmaPool new_memory_pool = VK_NULL_HANDLE;
+        VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &new_memory_pool);
+        assert(VK_SUCCESS == res_vma_create_pool);
 
-            storage_intermediate_buffer_memory_index = _internal_find_lowest_memory_type_index(&physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-            assert(VK_MAX_MEMORY_TYPES > storage_intermediate_buffer_memory_index);
-            assert(physical_device_memory_properties.memoryTypeCount > storage_intermediate_buffer_memory_index);
+        memory_pool = this->publish_memory_pool(&this->m_staging_upload_buffer_memory_pool, new_memory_pool);
+    }
 
-            VmaPoolCreateInfo const pool_create_info = {
-                storage_intermediate_buffer_memory_index,
-                VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
+    return memory_pool;
+}
+
+VmaPool brx_pal_vk_device::get_storage_intermediate_buffer_memory_pool() const
+{
+    VmaPool memory_pool = this->m_storage_intermediate_buffer_memory_pool.load();
+    if (VK_NULL_HANDLE == memory_pool)
+    {
+        uint32_t storage_intermediate_buffer_memory_index = VK_MAX_MEMORY_TYPES;
+
+        VkDeviceSize memory_requirements_size = VkDeviceSize(-1);
+        uint32_t memory_requirements_memory_type_bits = 0U;
+        {
+            VkBufferUsageFlags const usage = (!this->m_support_ray_tracing) ? (VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT) : (VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT_KHR);
+
+            VkBufferCreateInfo const buffer_create_info = {
+                VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+                NULL,
                 0U,
+                1U,
+                usage,
+                VK_SHARING_MODE_EXCLUSIVE,
                 0U,
+                NULL};
+
+            VkBuffer dummy_buf;
+            VkResult const res_create_buffer = this->m_pfn_create_buffer(this->m_device, &buffer_create_info, this->m_allocation_callbacks, &dummy_buf);
+            assert(VK_SUCCESS == res_create_buffer);
+
+            VkMemoryRequirements memory_requirements;
+            this->m_pfn_get_buffer_memory_requirements(this->m_device, dummy_buf, &memory_requirements);
+            memory_requirements_size = memory_requirements.size;
+            memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
+
+            this->m_pfn_destroy_buffer(this->m_device, dummy_buf, this->m_allocation_callbacks);
+        }
+
+        storage_intermediate_buffer_memory_index = _internal_find_lowest_memory_type_index(&this->m_physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        assert(VK_MAX_MEMORY_TYPES > storage_intermediate_buffer_memory_index);
+        assert(this->m_physical_device_memory_properties.memoryTypeCount > storage_intermediate_buffer_memory_index);
+
+        VmaPoolCreateInfo const pool_create_info = {
+            storage_intermediate_buffer_memory_index,
+            VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
+            0U,
+            0U,
+            0U,
+            1.0F,
+            (1U == this->m_min_storage_buffer_offset_alignment) ? 0U : this->m_min_storage_buffer_offset_alignment,
+            NULL};
+
+        VmaPool new_memory_pool = VK_NULL_HANDLE;
+        VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &new_memory_pool);
+        assert(VK_SUCCESS == res_vma_create_pool);
+
+        memory_pool = this->publish_memory_pool(&this->m_storage_intermediate_buffer_memory_pool, new_memory_pool);
+    }
+
+    return memory_pool;
+}
+
+VmaPool brx_pal_vk_device::get_storage_asset_buffer_memory_pool() const
+{
+    VmaPool memory_pool = this->m_storage_asset_buffer_memory_pool.load();
+    if (VK_NULL_HANDLE == memory_pool)
+    {
+        uint32_t storage_asset_buffer_memory_index = VK_MAX_MEMORY_TYPES;
+
+        VkDeviceSize memory_requirements_size = VkDeviceSize(-1);
+        uint32_t memory_requirements_memory_type_bits = 0U;
+        {
+            VkBufferUsageFlags const usage = (!this->m_support_ray_tracing) ? (VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT) : (VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT_KHR);
+
+            VkBufferCreateInfo const buffer_create_info = {
+                VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+                NULL,
+                0U,
+                1U,
+                usage,
+                VK_SHARING_MODE_EXCLUSIVE,
                 0U,
-                1.0F,
-                (1U == this->m_min_storage_buffer_offset_alignment) ? 0U : this->m_min_storage_buffer_offset_alignment,
                 NULL};
 
-            VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &this->m_storage_intermediate_buffer_memory_pool);
-            assert(VK_SUCCESS == res_vma_create_pool);
+            VkBuffer dummy_buf;
+            VkResult const res_create_buffer = this->m_pfn_create_buffer(this->m_device, &buffer_create_info, this->m_allocation_callbacks, &dummy_buf);
+            assert(VK_SUCCESS == res_create_buffer);
+
+            VkMemoryRequirements memory_requirements;
+            this->m_pfn_get_buffer_memory_requirements(this->m_device, dummy_buf, &memory_requirements);
+            memory_requirements_size = memory_requirements.size;
+            memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
+
+            this->m_pfn_destroy_buffer(this->m_device, dummy_buf, this->m_allocation_callbacks);
         }
 
-        // storage asset buffer
-        assert(VK_NULL_HANDLE == this->m_storage_asset_buffer_memory_pool);
+        storage_asset_buffer_memory_index = _internal_find_lowest_memory_type_index(&this->m_physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        assert(VK_MAX_MEMORY_TYPES > storage_asset_buffer_memory_index);
+        assert(this->m_physical_device_memory_properties.memoryTypeCount > storage_asset_buffer_memory_index);
+
+        VmaPoolCreateInfo const pool_create_info = {
+            storage_asset_buffer_memory_index,
+            VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
+            0U,
+            0U,
+            0U,
+            1.0F,
+            (1U == this->m_min_storage_buffer_offset_alignment) ? 0U : this->m_min_storage_buffer_offset_alignment,
+            NULL};
+
+        VmaPool new_memory_pool = VK_NULL_HANDLE;
+        VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &new_memory_pool);
+        assert(VK_SUCCESS == res_vma_create_pool);
+
+        memory_pool = this->publish_memory_pool(&this->m_storage_asset_buffer_memory_pool, new_memory_pool);
+    }
+
+    return memory_pool;
+}
+
+VmaPool brx_pal_vk_device::get_color_transient_attachment_image_memory_pool() const
+{
+    // https://www.khronos.org/registry/vulkan/specs/1.0/html/chap13.html#VkMemoryRequirements
+    // For images created with a color format, the memoryTypeBits member is identical for all VkImage objects created with the
+    // same combination of values for the tiling member, the VK_IMAGE_CREATE_SPARSE_BINDING_BIT bit of the flags member, and
+    // the VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT of the usage member in the VkImageCreateInfo structure passed to
+    // vkCreateImage.
+    // The samples member is NOT included, and the multisample color attachment images share the same pool.
+
+    VmaPool memory_pool = this->m_color_transient_attachment_image_memory_pool.load();
+    if (VK_NULL_HANDLE == memory_pool)
+    {
+        uint32_t color_transient_attachment_image_memory_index = VK_MAX_MEMORY_TYPES;
+
+        VkDeviceSize memory_requirements_size = VkDeviceSize(-1);
+        uint32_t memory_requirements_memory_type_bits = 0U;
         {
-            uint32_t storage_asset_buffer_memory_index = VK_MAX_MEMORY_TYPES;
+            VkImageCreateInfo const color_transient_attachment_image_create_info = {
+                VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+                NULL,
+                0U,
+                VK_IMAGE_TYPE_2D,
+                VK_FORMAT_R8G8B8A8_UNORM,
+                {1U, 1U, 1U},
+                1U,
+                1U,
+                VK_SAMPLE_COUNT_1_BIT,
+                VK_IMAGE_TILING_OPTIMAL,
+                VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT,
+                VK_SHARING_MODE_EXCLUSIVE,
+                0U,
+                NULL,
+                VK_IMAGE_LAYOUT_UNDEFINED};
 
-            VkDeviceSize memory_requirements_size = VkDeviceSize(-1);
-            uint32_t memory_requirements_memory_type_bits = 0U;
-            {
-                VkBufferUsageFlags const usage = (!this->m_support_ray_tracing) ? (VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT) : (VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT_KHR);
-
-                VkBufferCreateInfo const buffer_create_info = {
-                    VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
-                    NULL,
-                    0U,
-                    1U,
-                    usage,
-                    VK_SHARING_MODE_EXCLUSIVE,
-                    0U,
-                    NULL};
-
-                VkBuffer dummy_buf;
-                VkResult const res_create_buffer = pfn_create_buffer(this->m_device, &buffer_create_info, this->m_allocation_callbacks, &dummy_buf);
-                assert(VK_SUCCESS == res_create_buffer);
-
-                VkMemoryRequirements memory_requirements;
-                pfn_get_buffer_memory_requirements(this->m_device, dummy_buf, &memory_requirements);
-                memory_requirements_size = memory_requirements.size;
-                memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
-
-                pfn_destroy_buffer(this->m_device, dummy_buf, this->m_allocation_callbacks);
-            }
+            VkImage dummy_img;
+            VkResult const res_create_image = this->m_pfn_create_image(this->m_device, &color_transient_attachment_image_create_info, this->m_allocation_callbacks, &dummy_img);
+            assert(VK_SUCCESS == res_create_image);
 
-            storage_asset_buffer_memory_index = _internal_find_lowest_memory_type_index(&physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-            assert(VK_MAX_MEMORY_TYPES > storage_asset_buffer_memory_index);
-            assert(physical_device_memory_properties.memoryTypeCount > storage_asset_buffer_memory_index);
+            VkMemoryRequirements memory_requirements;
+            this->m_pfn_get_image_memory_requirements(this->m_device, dummy_img, &memory_requirements);
+            memory_requirements_size = memory_requirements.size;
+            memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
 
-            VmaPoolCreateInfo const pool_create_info = {
-                storage_asset_buffer_memory_index,
-                VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
+            this->m_pfn_destroy_image(this->m_device, dummy_img, this->m_allocation_callbacks);
+        }
+
+        // The lower index indicates the more performance
+        color_transient_attachment_image_memory_index = _internal_find_lowest_memory_type_index(&this->m_physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT);
+        assert(VK_MAX_MEMORY_TYPES > color_transient_attachment_image_memory_index);
+        assert(this->m_physical_device_memory_properties.memoryTypeCount > color_transient_attachment_image_memory_index);
+
+        VmaPoolCreateInfo const pool_create_info = {
+            color_transient_attachment_image_memory_index,
+            VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
+            0U,
+            0U,
+            0U,
+            1.0F,
+            0U,
+            NULL};
+
+        VmaPool new_memory_pool = VK_NULL_HANDLE;
+        VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &new_memory_pool);
+        assert(VK_SUCCESS == res_vma_create_pool);
+
+        memory_pool = this->publish_memory_pool(&this->m_color_transient_attachment_image_memory_pool, new_memory_pool);
+    }
+
+    return memory_pool;
+}
+
+VmaPool brx_pal_vk_device::get_color_attachment_sampled_image_memory_pool() const
+{
+    VmaPool memory_pool = this->m_color_attachment_sampled_image_memory_pool.load();
+    if (VK_NULL_HANDLE == memory_pool)
+    {
+        uint32_t color_attachment_sampled_image_memory_index = VK_MAX_MEMORY_TYPES;
+
+        VkDeviceSize memory_requirements_size = VkDeviceSize(-1);
+        uint32_t memory_requirements_memory_type_bits = 0U;
+        {
+            VkImageCreateInfo depth_attachment_sampled_image_create_info = {
+                VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+                NULL,
+                0U,
+                VK_IMAGE_TYPE_2D,
+                VK_FORMAT_R8G8B8A8_UNORM,
+                {1U, 1U, 1U},
+                1U,
+                1U,
+                VK_SAMPLE_COUNT_1_BIT,
+                VK_IMAGE_TILING_OPTIMAL,
+                VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+                VK_SHARING_MODE_EXCLUSIVE,
                 0U,
+                NULL,
+                VK_IMAGE_LAYOUT_UNDEFINED};
+
+            VkImage dummy_img;
+            VkResult const res_create_image = this->m_pfn_create_image(this->m_device, &depth_attachment_sampled_image_create_info, this->m_allocation_callbacks, &dummy_img);
+            assert(VK_SUCCESS == res_create_image);
+
+            VkMemoryRequirements memory_requirements;
+            this->m_pfn_get_image_memory_requirements(this->m_device, dummy_img, &memory_requirements);
+            memory_requirements_size = memory_requirements.size;
+            memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
+
+            this->m_pfn_destroy_image(this->m_device, dummy_img, this->m_allocation_callbacks);
+        }
+
+        // The lower index indicates the more performance
+        color_attachment_sampled_image_memory_index = _internal_find_lowest_memory_type_index(&this->m_physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        assert(VK_MAX_MEMORY_TYPES > color_attachment_sampled_image_memory_index);
+        assert(this->m_physical_device_memory_properties.memoryTypeCount > color_attachment_sampled_image_memory_index);
+
+        VmaPoolCreateInfo const pool_create_info = {
+            color_attachment_sampled_image_memory_index,
+            VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
+            0U,
+            0U,
+            0U,
+            1.0F,
+            0U,
+            NULL};
+
+        VmaPool new_memory_pool = VK_NULL_HANDLE;
+        VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &new_memory_pool);
+        assert(VK_SUCCESS == res_vma_create_pool);
+
+        memory_pool = this->publish_memory_pool(&this->m_color_attachment_sampled_image_memory_pool, new_memory_pool);
+    }
+
+    return memory_pool;
+}
+
+VmaPool brx_pal_vk_device::get_depth_transient_attachment_image_memory_pool() const
+{
+    // https://registry.khronos.org/vulkan/specs/1.0/html/chap12.html#VkMemoryRequirements
+    // For images created with a depth / stencil format, the memoryTypeBits member is identical for all VkImage objects created with the
+    // same combination of values for the format member, the tiling member, the VK_IMAGE_CREATE_SPARSE_BINDING_BIT bit of the flags member, and
+    // the VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT of the usage member in the VkImageCreateInfo structure passed to vkCreateImage.
+    // The samples member is NOT included, and the multisample depth stencil attachment images share the same pool.
+
+    VmaPool memory_pool = this->m_depth_transient_attachment_image_memory_pool.load();
+    if (VK_NULL_HANDLE == memory_pool)
+    {
+        uint32_t depth_transient_attachment_image_memory_index = VK_MAX_MEMORY_TYPES;
+
+        VkDeviceSize memory_requirements_size = VkDeviceSize(-1);
+        uint32_t memory_requirements_memory_type_bits = 0U;
+        {
+            VkImageCreateInfo const depth_transient_attachment_image_create_info = {
+                VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+                NULL,
                 0U,
+                VK_IMAGE_TYPE_2D,
+                this->m_depth_attachment_image_format,
+                {1U, 1U, 1U},
+
+                1U,
+                1U,
+                VK_SAMPLE_COUNT_1_BIT,
+                VK_IMAGE_TILING_OPTIMAL,
+                VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT,
+                VK_SHARING_MODE_EXCLUSIVE,
                 0U,
-                1.0F,
-                (1U == this->m_min_storage_buffer_offset_alignment) ? 0U : this->m_min_storage_buffer_offset_alignment,
-                NULL};
+                NULL,
+                VK_IMAGE_LAYOUT_UNDEFINED};
+
+            VkImage dummy_img;
+            VkResult const res_create_image = this->m_pfn_create_image(this->m_device, &depth_transient_attachment_image_create_info, this->m_allocation_callbacks, &dummy_img);
+            assert(VK_SUCCESS == res_create_image);
+
+            VkMemoryRequirements memory_requirements;
+            this->m_pfn_get_image_memory_requirements(this->m_device, dummy_img, &memory_requirements);
+            memory_requirements_size = memory_requirements.size;
+            memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
+
+            this->m_pfn_destroy_image(this->m_device, dummy_img, this->m_allocation_callbacks);
+        }
+
+        // The lower index indicates the more performance
+        depth_transient_attachment_image_memory_index = _internal_find_lowest_memory_type_index(&this->m_physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT);
+        assert(VK_MAX_MEMORY_TYPES > depth_transient_attachment_image_memory_index);
+        assert(this->m_physical_device_memory_properties.memoryTypeCount > depth_transient_attachment_image_memory_index);
+
+        VmaPoolCreateInfo const pool_create_info = {
+            depth_transient_attachment_image_memory_index,
+            VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
+            0U,
+            0U,
+            0U,
+            1.0F,
+            0U,
+            NULL};
+
+        VmaPool new_memory_pool = VK_NULL_HANDLE;
+        VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &new_memory_pool);
+        assert(VK_SUCCESS == res_vma_create_pool);
+
+        memory_pool = this->publish_memory_pool(&this->m_depth_transient_attachment_image_memory_pool, new_memory_pool);
+    }
+
+    return memory_pool;
+}
 
-            VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &this->m_storage_asset_buffer_memory_pool);
-            assert(VK_SUCCESS == res_vma_create_pool);
+VmaPool brx_pal_vk_device::get_depth_attachment_sampled_image_memory_pool() const
+{
+    assert(this->m_depth_attachment_image_format_support_sampled_image);
+
+    VmaPool memory_pool = this->m_depth_attachment_sampled_image_memory_pool.load();
+    if (VK_NULL_HANDLE == memory_pool)
+    {
+        uint32_t depth_attachment_sampled_image_memory_index = VK_MAX_MEMORY_TYPES;
+
+        VkDeviceSize memory_requirements_size = VkDeviceSize(-1);
+        uint32_t memory_requirements_memory_type_bits = 0U;
+        {
+            VkImageCreateInfo depth_attachment_sampled_image_create_info = {
+                VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+                NULL,
+                0U,
+                VK_IMAGE_TYPE_2D,
+                this->m_depth_attachment_image_format,
+                {1U, 1U, 1U},
+                1U,
+                1U,
+                VK_SAMPLE_COUNT_1_BIT,
+                VK_IMAGE_TILING_OPTIMAL,
+                VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+                VK_SHARING_MODE_EXCLUSIVE,
+                0U,
+                NULL,
+                VK_IMAGE_LAYOUT_UNDEFINED};
+
+            VkImage dummy_img;
+            VkResult const res_create_image = this->m_pfn_create_image(this->m_device, &depth_attachment_sampled_image_create_info, this->m_allocation_callbacks, &dummy_img);
+            assert(VK_SUCCESS == res_create_image);
+
+            VkMemoryRequirements memory_requirements;
+            this->m_pfn_get_image_memory_requirements(this->m_device, dummy_img, &memory_requirements);
+            memory_requirements_size = memory_requirements.size;
+            memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
+
+            this->m_pfn_destroy_image(this->m_device, dummy_img, this->m_allocation_callbacks);
         }
 
-        // https://www.khronos.org/registry/vulkan/specs/1.0/html/chap13.html#VkMemoryRequirements
-        // For images created with a color format, the memoryTypeBits member is identical for all VkImage objects created with the
-        // same combination of values for the tiling member, the VK_IMAGE_CREATE_SPARSE_BINDING_BIT bit of the flags member, and
-        // the VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT of the usage member in the VkImageCreateInfo structure passed to
-        // vkCreateImage.
-        assert(VK_NULL_HANDLE == this->m_color_transient_attachment_image_memory_pool);
+        // The lower index indicates the more performance
+        depth_attachment_sampled_image_memory_index = _internal_find_lowest_memory_type_index(&this->m_physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        assert(VK_MAX_MEMORY_TYPES > depth_attachment_sampled_image_memory_index);
+        assert(this->m_physical_device_memory_properties.memoryTypeCount > depth_attachment_sampled_image_memory_index);
+
+        VmaPoolCreateInfo const pool_create_info = {
+            depth_attachment_sampled_image_memory_index,
+            VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
+            0U,
+            0U,
+            0U,
+            1.0F,
+            0U,
+            NULL};
+
+        VmaPool new_memory_pool = VK_NULL_HANDLE;
+        VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &new_memory_pool);
+        assert(VK_SUCCESS == res_vma_create_pool);
+
+        memory_pool = this->publish_memory_pool(&this->m_depth_attachment_sampled_image_memory_pool, new_memory_pool);
+    }
+
+    return memory_pool;
+}
+
+VmaPool brx_pal_vk_device::get_depth_stencil_transient_attachment_image_memory_pool() const
+{
+    VmaPool memory_pool = this->m_depth_stencil_transient_attachment_image_memory_pool.load();
+    if (VK_NULL_HANDLE == memory_pool)
+    {
+        uint32_t depth_stencil_transient_attachment_image_memory_index = VK_MAX_MEMORY_TYPES;
+
+        VkDeviceSize memory_requirements_size = static_cast<VkDeviceSize>(-1);
+        uint32_t memory_requirements_memory_type_bits = 0U;
         {
-            uint32_t color_transient_attachment_image_memory_index = VK_MAX_MEMORY_TYPES;
+            VkImageCreateInfo const depth_transient_attachment_image_create_info = {
+                VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+                NULL,
+                0U,
+                VK_IMAGE_TYPE_2D,
+                this->m_depth_stencil_attachment_image_format,
+                {1U, 1U, 1U},
+                1U,
+                1U,
+                VK_SAMPLE_COUNT_1_BIT,
+                VK_IMAGE_TILING_OPTIMAL,
+                VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT,
+                VK_SHARING_MODE_EXCLUSIVE,
+                0U,
+                NULL,
+                VK_IMAGE_LAYOUT_UNDEFINED};
 
-            VkDeviceSize memory_requirements_size = VkDeviceSize(-1);
-            uint32_t memory_requirements_memory_type_bits = 0U;
-            {
-                VkImageCreateInfo const color_transient_attachment_image_create_info = {
-                    VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
-                    NULL,
-                    0U,
-                    VK_IMAGE_TYPE_2D,
-                    VK_FORMAT_R8G8B8A8_UNORM,
-                    {1U, 1U, 1U},
-                    1U,
-                    1U,
-                    VK_SAMPLE_COUNT_1_BIT,
-                    VK_IMAGE_TILING_OPTIMAL,
-                    VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT,
-                    VK_SHARING_MODE_EXCLUSIVE,
-                    0U,
-                    NULL,
-                    VK_IMAGE_LAYOUT_UNDEFINED};
-
-                VkImage dummy_img;
-                VkResult const res_create_image = pfn_create_image(this->m_device, &color_transient_attachment_image_create_info, this->m_allocation_callbacks, &dummy_img);
-                assert(VK_SUCCESS == res_create_image);
-
-                VkMemoryRequirements memory_requirements;
-                pfn_get_image_memory_requirements(this->m_device, dummy_img, &memory_requirements);
-                memory_requirements_size = memory_requirements.size;
-                memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
-
-                pfn_destroy_image(this->m_device, dummy_img, this->m_allocation_callbacks);
-            }
+            VkImage dummy_img;
+            VkResult const res_create_image = this->m_pfn_create_image(this->m_device, &depth_transient_attachment_image_create_info, this->m_allocation_callbacks, &dummy_img);
+            assert(VK_SUCCESS == res_create_image);
+
+            VkMemoryRequirements memory_requirements;
+            this->m_pfn_get_image_memory_requirements(this->m_device, dummy_img, &memory_requirements);
+            memory_requirements_size = memory_requirements.size;
+            memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
+
+            this->m_pfn_destroy_image(this->m_device, dummy_img, this->m_allocation_callbacks);
+        }
+
+        // The lower index indicates the more performance
+        depth_stencil_transient_attachment_image_memory_index = _internal_find_lowest_memory_type_index(&this->m_physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT);
+        assert(VK_MAX_MEMORY_TYPES > depth_stencil_transient_attachment_image_memory_index);
+        assert(this->m_physical_device_memory_properties.memoryTypeCount > depth_stencil_transient_attachment_image_memory_index);
 
-            // The lower index indicates the more performance
-            color_transient_attachment_image_memory_index = _internal_find_lowest_memory_type_index(&physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT);
-            assert(VK_MAX_MEMORY_TYPES > color_transient_attachment_image_memory_index);
-            assert(physical_device_memory_properties.memoryTypeCount > color_transient_attachment_image_memory_index);
+        VmaPoolCreateInfo const pool_create_info = {
+            depth_stencil_transient_attachment_image_memory_index,
+            VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
+            0U,
+            0U,
+            0U,
+            1.0F,
+            0U,
+            NULL};
+
+        VmaPool new_memory_pool = VK_NULL_HANDLE;
+        VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &new_memory_pool);
+        assert(VK_SUCCESS == res_vma_create_pool);
+
+        memory_pool = this->publish_memory_pool(&this->m_depth_stencil_transient_attachment_image_memory_pool, new_memory_pool);
+    }
+
+    return memory_pool;
+}
 
-            VmaPoolCreateInfo const pool_create_info = {
-                color_transient_attachment_image_memory_index,
-                VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
+VmaPool brx_pal_vk_device::get_depth_stencil_attachment_sampled_image_memory_pool() const
+{
+    assert(this->m_depth_stencil_attachment_image_format_support_sampled_image);
+
+    VmaPool memory_pool = this->m_depth_stencil_attachment_sampled_image_memory_pool.load();
+    if (VK_NULL_HANDLE == memory_pool)
+    {
+        uint32_t depth_stencil_attachment_sampled_image_memory_index = VK_MAX_MEMORY_TYPES;
+
+        VkDeviceSize memory_requirements_size = VkDeviceSize(-1);
+        uint32_t memory_requirements_memory_type_bits = 0U;
+        {
+            VkImageCreateInfo const depth_attachment_sampled_image_create_info = {
+                VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+                NULL,
                 0U,
+                VK_IMAGE_TYPE_2D,
+                this->m_depth_stencil_attachment_image_format,
+                {1U, 1U, 1U},
+                1U,
+                1U,
+                VK_SAMPLE_COUNT_1_BIT,
+                VK_IMAGE_TILING_OPTIMAL,
+                VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+                VK_SHARING_MODE_EXCLUSIVE,
                 0U,
+                NULL,
+                VK_IMAGE_LAYOUT_UNDEFINED};
+
+            VkImage dummy_img;
+            VkResult const res_create_image = this->m_pfn_create_image(this->m_device, &depth_attachment_sampled_image_create_info, this->m_allocation_callbacks, &dummy_img);
+            assert(VK_SUCCESS == res_create_image);
+
+            VkMemoryRequirements memory_requirements;
+            this->m_pfn_get_image_memory_requirements(this->m_device, dummy_img, &memory_requirements);
+            memory_requirements_size = memory_requirements.size;
+            memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
+
+            this->m_pfn_destroy_image(this->m_device, dummy_img, this->m_allocation_callbacks);
+        }
+
+        // The lower index indicates the more performance
+        depth_stencil_attachment_sampled_image_memory_index = _internal_find_lowest_memory_type_index(&this->m_physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        assert(VK_MAX_MEMORY_TYPES > depth_stencil_attachment_sampled_image_memory_index);
+        assert(this->m_physical_device_memory_properties.memoryTypeCount > depth_stencil_attachment_sampled_image_memory_index);
+
+        VmaPoolCreateInfo const pool_create_info = {
+            depth_stencil_attachment_sampled_image_memory_index,
+            VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
+            0U,
+            0U,
+            0U,
+            1.0F,
+            0U,
+            NULL};
+
+        VmaPool new_memory_pool = VK_NULL_HANDLE;
+        VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &new_memory_pool);
+        assert(VK_SUCCESS == res_vma_create_pool);
+
+        memory_pool = this->publish_memory_pool(&this->m_depth_stencil_attachment_sampled_image_memory_pool, new_memory_pool);
+    }
+
+    return memory_pool;
+}
+
+VmaPool brx_pal_vk_device::get_storage_intermediate_image_memory_pool() const
+{
+    // https://registry.khronos.org/vulkan/specs/1.0/html/chap12.html#VkMemoryRequirements
+    // For images created with a color format, the memoryTypeBits member is identical for all VkImage objects created with the
+    // same combination of values for the tiling member, the VK_IMAGE_CREATE_SPARSE_BINDING_BIT bit of the flags member, and
+    // the VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT of the usage member in the VkImageCreateInfo structure passed to
+    // vkCreateImage.
+
+    // vulkaninfo
+    // https://github.com/KhronosGroup/Vulkan-Tools/tree/master/vulkaninfo/vulkaninfo/vulkaninfo.h
+    // GetImageCreateInfo
+    // FillImageTypeSupport
+    // https://github.com/KhronosGroup/Vulkan-Tools/tree/master/vulkaninfo/vulkaninfo.cpp
+    // GpuDumpMemoryProps //"usable for"
+
+    VmaPool memory_pool = this->m_storage_intermediate_image_memory_pool.load();
+    if (VK_NULL_HANDLE == memory_pool)
+    {
+        uint32_t storage_image_memory_index = VK_MAX_MEMORY_TYPES;
+
+        VkDeviceSize memory_requirements_size = VkDeviceSize(-1);
+        uint32_t memory_requirements_memory_type_bits = 0U;
+        {
+            VkImageCreateInfo depth_attachment_sampled_image_create_info = {
+                VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+                NULL,
                 0U,
-                1.0F,
+                VK_IMAGE_TYPE_2D,
+                VK_FORMAT_R32_SFLOAT,
+                {8U, 8U, 1U},
+                1U,
+                1U,
+                VK_SAMPLE_COUNT_1_BIT,
+                VK_IMAGE_TILING_OPTIMAL,
+                VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+                VK_SHARING_MODE_EXCLUSIVE,
                 0U,
-                NULL};
+                NULL,
+                VK_IMAGE_LAYOUT_UNDEFINED};
+
+            VkImage dummy_img;
+            VkResult const res_create_image = this->m_pfn_create_image(this->m_device, &depth_attachment_sampled_image_create_info, this->m_allocation_callbacks, &dummy_img);
+            assert(VK_SUCCESS == res_create_image);
 
-            VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &this->m_color_transient_attachment_image_memory_pool);
-            assert(VK_SUCCESS == res_vma_create_pool);
+            VkMemoryRequirements memory_requirements;
+            this->m_pfn_get_image_memory_requirements(this->m_device, dummy_img, &memory_requirements);
+            memory_requirements_size = memory_requirements.size;
+            memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
+
+            this->m_pfn_destroy_image(this->m_device, dummy_img, this->m_allocation_callbacks);
         }
 
-        assert(VK_NULL_HANDLE == this->m_color_attachment_sampled_image_memory_pool);
+        // The lower index indicates the more performance
+        storage_image_memory_index = _internal_find_lowest_memory_type_index(&this->m_physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        assert(VK_MAX_MEMORY_TYPES > storage_image_memory_index);
+        assert(this->m_physical_device_memory_properties.memoryTypeCount > storage_image_memory_index);
+
+        VmaPoolCreateInfo const pool_create_info = {
+            storage_image_memory_index,
+            VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
+            0U,
+            0U,
+            0U,
+            1.0F,
+            0U,
+            NULL};
+
+        VmaPool new_memory_pool = VK_NULL_HANDLE;
+        VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &new_memory_pool);
+        assert(VK_SUCCESS == res_vma_create_pool);
+
+        memory_pool = this->publish_memory_pool(&this->m_storage_intermediate_image_memory_pool, new_memory_pool);
+    }
+
+    return memory_pool;
+}
+
+VmaPool brx_pal_vk_device::get_sampled_asset_image_memory_pool() const
+{
+    VmaPool memory_pool = this->m_sampled_asset_image_memory_pool.load();
+    if (VK_NULL_HANDLE == memory_pool)
+    {
+        uint32_t sampled_asset_image_memory_index = VK_MAX_MEMORY_TYPES;
+
+        VkDeviceSize memory_requirements_size = VkDeviceSize(-1);
+        uint32_t memory_requirements_memory_type_bits = 0U;
         {
-            uint32_t color_attachment_sampled_image_memory_index = VK_MAX_MEMORY_TYPES;
+            VkFormat color_format = VK_FORMAT_R8G8B8A8_UNORM;
 
-            VkDeviceSize memory_requirements_size = VkDeviceSize(-1);
-            uint32_t memory_requirements_memory_type_bits = 0U;
-            {
-                VkImageCreateInfo depth_attachment_sampled_image_create_info = {
-                    VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
-                    NULL,
-                    0U,
-                    VK_IMAGE_TYPE_2D,
-                    VK_FORMAT_R8G8B8A8_UNORM,
-                    {1U, 1U, 1U},
-                    1U,
-                    1U,
-                    VK_SAMPLE_COUNT_1_BIT,
-                    VK_IMAGE_TILING_OPTIMAL,
-                    VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
-                    VK_SHARING_MODE_EXCLUSIVE,
-                    0U,
-                    NULL,
-                    VK_IMAGE_LAYOUT_UNDEFINED};
-
-                VkImage dummy_img;
-                VkResult const res_create_image = pfn_create_image(this->m_device, &depth_attachment_sampled_image_create_info, this->m_allocation_callbacks, &dummy_img);
-                assert(VK_SUCCESS == res_create_image);
-
-                VkMemoryRequirements memory_requirements;
-                pfn_get_image_memory_requirements(this->m_device, dummy_img, &memory_requirements);
-                memory_requirements_size = memory_requirements.size;
-                memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
-
-                pfn_destroy_image(this->m_device, dummy_img, this->m_allocation_callbacks);
-            }
+            PFN_vkGetPhysicalDeviceFormatProperties const pfn_get_physical_device_format_properties = reinterpret_cast<PFN_vkGetPhysicalDeviceFormatProperties>(this->m_pfn_get_instance_proc_addr(this->m_instance, "vkGetPhysicalDeviceFormatProperties"));
+
+            VkFormatProperties format_properties;
+            pfn_get_physical_device_format_properties(this->m_physical_device, color_format, &format_properties);
+            assert(format_properties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT);
+            assert(format_properties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT);
+
+            VkImageCreateInfo const image_create_info_regular_tiling_optimal = {
+                VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+                NULL,
+                0U,
+                VK_IMAGE_TYPE_2D,
+                color_format,
+                {1U, 1U, 1U},
+                1U,
+                1U,
+                VK_SAMPLE_COUNT_1_BIT,
+                VK_IMAGE_TILING_OPTIMAL,
+                VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+                VK_SHARING_MODE_EXCLUSIVE,
+                0U,
+                NULL,
+                VK_IMAGE_LAYOUT_UNDEFINED};
+
+            VkImage dummy_img;
+            VkResult const res_create_image = this->m_pfn_create_image(this->m_device, &image_create_info_regular_tiling_optimal, this->m_allocation_callbacks, &dummy_img);
+            assert(VK_SUCCESS == res_create_image);
+
+            VkMemoryRequirements memory_requirements;
+            this->m_pfn_get_image_memory_requirements(this->m_device, dummy_img, &memory_requirements);
+            memory_requirements_size = memory_requirements.size;
+            memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
+
+            this->m_pfn_destroy_image(this->m_device, dummy_img, this->m_allocation_callbacks);
+        }
 
-            // The lower index indicates the more performance
-            color_attachment_sampled_image_memory_index = _internal_find_lowest_memory_type_index(&physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-            assert(VK_MAX_MEMORY_TYPES > color_attachment_sampled_image_memory_index);
-            assert(physical_device_memory_properties.memoryTypeCount > color_attachment_sampled_image_memory_index);
+        sampled_asset_image_memory_index = _internal_find_lowest_memory_type_index(&this->m_physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        assert(VK_MAX_MEMORY_TYPES > sampled_asset_image_memory_index);
+        assert(this->m_physical_device_memory_properties.memoryTypeCount > sampled_asset_image_memory_index);
+
+        VmaPoolCreateInfo const pool_create_info = {
+            sampled_asset_image_memory_index,
+            VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
+            0U,
+            0U,
+            0U,
+            1.0F,
+            0U,
+            NULL};
+
+        VmaPool new_memory_pool = VK_NULL_HANDLE;
+        VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &new_memory_pool);
+        assert(VK_SUCCESS == res_vma_create_pool);
+
+        memory_pool = this->publish_memory_pool(&this->m_sampled_asset_image_memory_pool, new_memory_pool);
+    }
+
+    return memory_pool;
+}
+
+VmaPool brx_pal_vk_device::get_scratch_buffer_memory_pool() const
+{
+    assert(this->m_support_ray_tracing);
+
+    VmaPool memory_pool = this->m_scratch_buffer_memory_pool.load();
+    if (VK_NULL_HANDLE == memory_pool)
+    {
+        uint32_t scratch_buffer_memory_index = VK_MAX_MEMORY_TYPES;
 
-            VmaPoolCreateInfo const pool_create_info = {
-                color_attachment_sampled_image_memory_index,
-                VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
-                0U,
-                0U,
+        VkDeviceSize memory_requirements_size = static_cast<VkDeviceSize>(-1);
+        uint32_t memory_requirements_memory_type_bits = 0U;
+        {
+            VkBufferCreateInfo const buffer_create_info = {
+                VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+                NULL,
                 0U,
-                1.0F,
+                1U,
+                VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT_KHR,
+                VK_SHARING_MODE_EXCLUSIVE,
                 0U,
                 NULL};
 
-            VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &this->m_color_attachment_sampled_image_memory_pool);
-            assert(VK_SUCCESS == res_vma_create_pool);
-        }
+            VkBuffer dummy_buf;
+            VkResult const res_create_buffer = this->m_pfn_create_buffer(this->m_device, &buffer_create_info, this->m_allocation_callbacks, &dummy_buf);
+            assert(VK_SUCCESS == res_create_buffer);
 
-        // https://registry.khronos.org/vulkan/specs/1.0/html/chap12.html#VkMemoryRequirements
-        // For images created with a depth / stencil format, the memoryTypeBits member is identical for all VkImage objects created with the
-        // same combination of values for the format member, the tiling member, the VK_IMAGE_CREATE_SPARSE_BINDING_BIT bit of the flags member, and
-        // the VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT of the usage member in the VkImageCreateInfo structure passed to vkCreateImage.
-        assert(VK_NULL_HANDLE == this->m_depth_transient_attachment_image_memory_pool);
-        {
-            uint32_t depth_transient_attachment_image_memory_index = VK_MAX_MEMORY_TYPES;
+            VkMemoryRequirements memory_requirements;
+            this->m_pfn_get_buffer_memory_requirements(this->m_device, dummy_buf, &memory_requirements);
+            memory_requirements_size = memory_requirements.size;
+            memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
 
-            VkDeviceSize memory_requirements_size = VkDeviceSize(-1);
-            uint32_t memory_requirements_memory_type_bits = 0U;
-            {
-                VkImageCreateInfo const depth_transient_attachment_image_create_info = {
-                    VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
-                    NULL,
-                    0U,
-                    VK_IMAGE_TYPE_2D,
-                    this->m_depth_attachment_image_format,
-                    {1U, 1U, 1U},
-
-                    1U,
-                    1U,
-                    VK_SAMPLE_COUNT_1_BIT,
-                    VK_IMAGE_TILING_OPTIMAL,
-                    VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT,
-                    VK_SHARING_MODE_EXCLUSIVE,
-                    0U,
-                    NULL,
-                    VK_IMAGE_LAYOUT_UNDEFINED};
-
-                VkImage dummy_img;
-                VkResult const res_create_image = pfn_create_image(this->m_device, &depth_transient_attachment_image_create_info, this->m_allocation_callbacks, &dummy_img);
-                assert(VK_SUCCESS == res_create_image);
-
-                VkMemoryRequirements memory_requirements;
-                pfn_get_image_memory_requirements(this->m_device, dummy_img, &memory_requirements);
-                memory_requirements_size = memory_requirements.size;
-                memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
-
-                pfn_destroy_image(this->m_device, dummy_img, this->m_allocation_callbacks);
-            }
+            this->m_pfn_destroy_buffer(this->m_device, dummy_buf, this->m_allocation_callbacks);
+        }
 
-            // The lower index indicates the more performance
-            depth_transient_attachment_image_memory_index = _internal_find_lowest_memory_type_index(&physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT);
-            assert(VK_MAX_MEMORY_TYPES > depth_transient_attachment_image_memory_index);
-            assert(physical_device_memory_properties.memoryTypeCount > depth_transient_attachment_image_memory_index);
+        scratch_buffer_memory_index = _internal_find_lowest_memory_type_index(&this->m_physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        assert(VK_MAX_MEMORY_TYPES > scratch_buffer_memory_index);
+        assert(this->m_physical_device_memory_properties.memoryTypeCount > scratch_buffer_memory_index);
 
-            VmaPoolCreateInfo const pool_create_info = {
-                depth_transient_attachment_image_memory_index,
-                VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
-                0U,
-                0U,
-                0U,
-                1.0F,
-                0U,
-                NULL};
+        VmaPoolCreateInfo const pool_create_info = {
+            scratch_buffer_memory_index,
+            VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
+            0U,
+            0U,
+            0U,
+            1.0F,
+            D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT,
+            NULL};
 
-            VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &this->m_depth_transient_attachment_image_memory_pool);
-            assert(VK_SUCCESS == res_vma_create_pool);
-        }
+        VmaPool new_memory_pool = VK_NULL_HANDLE;
+        VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &new_memory_pool);
+        assert(VK_SUCCESS == res_vma_create_pool);
 
-        assert(VK_NULL_HANDLE == this->m_depth_attachment_sampled_image_memory_pool);
-        if (this->m_depth_attachment_image_format_support_sampled_image)
-        {
-            uint32_t depth_attachment_sampled_image_memory_index = VK_MAX_MEMORY_TYPES;
+        memory_pool = this->publish_memory_pool(&this->m_scratch_buffer_memory_pool, new_memory_pool);
+    }
 
-            VkDeviceSize memory_requirements_size = VkDeviceSize(-1);
-            uint32_t memory_requirements_memory_type_bits = 0U;
-            {
-                VkImageCreateInfo depth_attachment_sampled_image_create_info = {
-                    VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
-                    NULL,
-                    0U,
-                    VK_IMAGE_TYPE_2D,
-                    this->m_depth_attachment_image_format,
-                    {1U, 1U, 1U},
-                    1U,
-                    1U,
-                    VK_SAMPLE_COUNT_1_BIT,
-                    VK_IMAGE_TILING_OPTIMAL,
-                    VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
-                    VK_SHARING_MODE_EXCLUSIVE,
-                    0U,
-                    NULL,
-                    VK_IMAGE_LAYOUT_UNDEFINED};
-
-                VkImage dummy_img;
-                VkResult const res_create_image = pfn_create_image(this->m_device, &depth_attachment_sampled_image_create_info, this->m_allocation_callbacks, &dummy_img);
-                assert(VK_SUCCESS == res_create_image);
-
-                VkMemoryRequirements memory_requirements;
-                pfn_get_image_memory_requirements(this->m_device, dummy_img, &memory_requirements);
-                memory_requirements_size = memory_requirements.size;
-                memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
-
-                pfn_destroy_image(this->m_device, dummy_img, this->m_allocation_callbacks);
-            }
+    return memory_pool;
+}
+
+VmaPool brx_pal_vk_device::get_intermediate_bottom_level_acceleration_structure_memory_pool() const
+{
+    assert(this->m_support_ray_tracing);
 
-            // The lower index indicates the more performance
-            depth_attachment_sampled_image_memory_index = _internal_find_lowest_memory_type_index(&physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-            assert(VK_MAX_MEMORY_TYPES > depth_attachment_sampled_image_memory_index);
-            assert(physical_device_memory_properties.memoryTypeCount > depth_attachment_sampled_image_memory_index);
+    VmaPool memory_pool = this->m_intermediate_bottom_level_acceleration_structure_memory_pool.load();
+    if (VK_NULL_HANDLE == memory_pool)
+    {
+        uint32_t intermediate_bottom_level_acceleration_structure_memory_index = VK_MAX_MEMORY_TYPES;
 
-            VmaPoolCreateInfo const pool_create_info = {
-                depth_attachment_sampled_image_memory_index,
-                VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
-                0U,
-                0U,
+        VkDeviceSize memory_requirements_size = static_cast<VkDeviceSize>(-1);
+        uint32_t memory_requirements_memory_type_bits = 0U;
+        {
+            VkBufferCreateInfo const buffer_create_info = {
+                VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+                NULL,
                 0U,
-                1.0F,
+                1U,
+                VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_STORAGE_BIT_KHR | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT_KHR,
+                VK_SHARING_MODE_EXCLUSIVE,
                 0U,
                 NULL};
 
-            VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &this->m_depth_attachment_sampled_image_memory_pool);
-            assert(VK_SUCCESS == res_vma_create_pool);
-        }
+            VkBuffer dummy_buf;
+            VkResult const res_create_buffer = this->m_pfn_create_buffer(this->m_device, &buffer_create_info, this->m_allocation_callbacks, &dummy_buf);
+            assert(VK_SUCCESS == res_create_buffer);
 
-        assert(VK_NULL_HANDLE == this->m_depth_stencil_transient_attachment_image_memory_pool);
-        {
-            uint32_t depth_stencil_transient_attachment_image_memory_index = VK_MAX_MEMORY_TYPES;
+            VkMemoryRequirements memory_requirements;
+            this->m_pfn_get_buffer_memory_requirements(this->m_device, dummy_buf, &memory_requirements);
+            memory_requirements_size = memory_requirements.size;
+            memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
 
-            VkDeviceSize memory_requirements_size = static_cast<VkDeviceSize>(-1);
-            uint32_t memory_requirements_memory_type_bits = 0U;
-            {
-                VkImageCreateInfo const depth_transient_attachment_image_create_info = {
-                    VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
-                    NULL,
-                    0U,
-                    VK_IMAGE_TYPE_2D,
-                    this->m_depth_stencil_attachment_image_format,
-                    {1U, 1U, 1U},
-                    1U,
-                    1U,
-                    VK_SAMPLE_COUNT_1_BIT,
-                    VK_IMAGE_TILING_OPTIMAL,
-                    VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT,
-                    VK_SHARING_MODE_EXCLUSIVE,
-                    0U,
-                    NULL,
-                    VK_IMAGE_LAYOUT_UNDEFINED};
-
-                VkImage dummy_img;
-                VkResult const res_create_image = pfn_create_image(this->m_device, &depth_transient_attachment_image_create_info, this->m_allocation_callbacks, &dummy_img);
-                assert(VK_SUCCESS == res_create_image);
-
-                VkMemoryRequirements memory_requirements;
-                pfn_get_image_memory_requirements(this->m_device, dummy_img, &memory_requirements);
-                memory_requirements_size = memory_requirements.size;
-                memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
-
-                pfn_destroy_image(this->m_device, dummy_img, this->m_allocation_callbacks);
-            }
+            this->m_pfn_destroy_buffer(this->m_device, dummy_buf, this->m_allocation_callbacks);
+        }
 
-            // The lower index indicates the more performance
-            depth_stencil_transient_attachment_image_memory_index = _internal_find_lowest_memory_type_index(&physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT);
-            assert(VK_MAX_MEMORY_TYPES > depth_stencil_transient_attachment_image_memory_index);
-            assert(physical_device_memory_properties.memoryTypeCount > depth_stencil_transient_attachment_image_memory_index);
+        intermediate_bottom_level_acceleration_structure_memory_index = _internal_find_lowest_memory_type_index(&this->m_physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        assert(VK_MAX_MEMORY_TYPES > intermediate_bottom_level_acceleration_structure_memory_index);
+        assert(this->m_physical_device_memory_properties.memoryTypeCount > intermediate_bottom_level_acceleration_structure_memory_index);
 
-            VmaPoolCreateInfo const pool_create_info = {
-                depth_stencil_transient_attachment_image_memory_index,
-                VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
-                0U,
-                0U,
-                0U,
-                1.0F,
-                0U,
-                NULL};
+        VmaPoolCreateInfo const pool_create_info = {
+            intermediate_bottom_level_acceleration_structure_memory_index,
+            VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
+            0U,
+            0U,
+            0U,
+            1.0F,
+            D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT,
+            NULL};
 
-            VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &this->m_depth_stencil_transient_attachment_image_memory_pool);
-            assert(VK_SUCCESS == res_vma_create_pool);
-        }
+        VmaPool new_memory_pool = VK_NULL_HANDLE;
+        VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &new_memory_pool);
+        assert(VK_SUCCESS == res_vma_create_pool);
 
-        assert(VK_NULL_HANDLE == this->m_depth_stencil_attachment_sampled_image_memory_pool);
-        if (this->m_depth_stencil_attachment_image_format_support_sampled_image)
-        {
-            uint32_t depth_stencil_attachment_sampled_image_memory_index = VK_MAX_MEMORY_TYPES;
+        memory_pool = this->publish_memory_pool(&this->m_intermediate_bottom_level_acceleration_structure_memory_pool, new_memory_pool);
+    }
 
-            VkDeviceSize memory_requirements_size = VkDeviceSize(-1);
-            uint32_t memory_requirements_memory_type_bits = 0U;
-            {
-                VkImageCreateInfo const depth_attachment_sampled_image_create_info = {
-                    VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
-                    NULL,
-                    0U,
-                    VK_IMAGE_TYPE_2D,
-                    this->m_depth_stencil_attachment_image_format,
-                    {1U, 1U, 1U},
-                    1U,
-                    1U,
-                    VK_SAMPLE_COUNT_1_BIT,
-                    VK_IMAGE_TILING_OPTIMAL,
-                    VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
-                    VK_SHARING_MODE_EXCLUSIVE,
-                    0U,
-                    NULL,
-                    VK_IMAGE_LAYOUT_UNDEFINED};
-
-                VkImage dummy_img;
-                VkResult const res_create_image = pfn_create_image(this->m_device, &depth_attachment_sampled_image_create_info, this->m_allocation_callbacks, &dummy_img);
-                assert(VK_SUCCESS == res_create_image);
-
-                VkMemoryRequirements memory_requirements;
-                pfn_get_image_memory_requirements(this->m_device, dummy_img, &memory_requirements);
-                memory_requirements_size = memory_requirements.size;
-                memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
-
-                pfn_destroy_image(this->m_device, dummy_img, this->m_allocation_callbacks);
-            }
+    return memory_pool;
+}
 
-            // The lower index indicates the more performance
-            depth_stencil_attachment_sampled_image_memory_index = _internal_find_lowest_memory_type_index(&physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-            assert(VK_MAX_MEMORY_TYPES > depth_stencil_attachment_sampled_image_memory_index);
-            assert(physical_device_memory_properties.memoryTypeCount > depth_stencil_attachment_sampled_image_memory_index);
+VmaPool brx_pal_vk_device::get_non_compacted_bottom_level_acceleration_structure_memory_pool() const
+{
+    assert(this->m_support_ray_tracing);
 
-            VmaPoolCreateInfo const pool_create_info = {
-                depth_stencil_attachment_sampled_image_memory_index,
-                VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
-                0U,
-                0U,
+    VmaPool memory_pool = this->m_non_compacted_bottom_level_acceleration_structure_memory_pool.load();
+    if (VK_NULL_HANDLE == memory_pool)
+    {
+        uint32_t non_compacted_bottom_level_acceleration_structure_buffer_memory_index = VK_MAX_MEMORY_TYPES;
+
+        VkDeviceSize memory_requirements_size = static_cast<VkDeviceSize>(-1);
+        uint32_t memory_requirements_memory_type_bits = 0U;
+        {
+            VkBufferCreateInfo const buffer_create_info = {
+                VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+                NULL,
                 0U,
-                1.0F,
+                1U,
+                VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_STORAGE_BIT_KHR,
+                VK_SHARING_MODE_EXCLUSIVE,
                 0U,
                 NULL};
 
-            VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &this->m_depth_stencil_attachment_sampled_image_memory_pool);
-            assert(VK_SUCCESS == res_vma_create_pool);
-        }
-
-        // https://registry.khronos.org/vulkan/specs/1.0/html/chap12.html#VkMemoryRequirements
-        // For images created with a color format, the memoryTypeBits member is identical for all VkImage objects created with the
-        // same combination of values for the tiling member, the VK_IMAGE_CREATE_SPARSE_BINDING_BIT bit of the flags member, and
-        // the VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT of the usage member in the VkImageCreateInfo structure passed to
-        // vkCreateImage.
+            VkBuffer dummy_buf;
+            VkResult const res_create_buffer = this->m_pfn_create_buffer(this->m_device, &buffer_create_info, this->m_allocation_callbacks, &dummy_buf);
+            assert(VK_SUCCESS == res_create_buffer);
 
-        // vulkaninfo
-        // https://github.com/KhronosGroup/Vulkan-Tools/tree/master/vulkaninfo/vulkaninfo/vulkaninfo.h
-        // GetImageCreateInfo
-        // FillImageTypeSupport
-        // https://github.com/KhronosGroup/Vulkan-Tools/tree/master/vulkaninfo/vulkaninfo.cpp
-        // GpuDumpMemoryProps //"usable for"
+            VkMemoryRequirements memory_requirements;
+            this->m_pfn_get_buffer_memory_requirements(this->m_device, dummy_buf, &memory_requirements);
+            memory_requirements_size = memory_requirements.size;
+            memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
 
-        assert(VK_NULL_HANDLE == this->m_storage_intermediate_image_memory_pool);
-        {
-            uint32_t storage_image_memory_index = VK_MAX_MEMORY_TYPES;
+            this->m_pfn_destroy_buffer(this->m_device, dummy_buf, this->m_allocation_callbacks);
+        }
 
-            VkDeviceSize memory_requirements_size = VkDeviceSize(-1);
-            uint32_t memory_requirements_memory_type_bits = 0U;
-            {
-                VkImageCreateInfo depth_attachment_sampled_image_create_info = {
-                    VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
-                    NULL,
-                    0U,
-                    VK_IMAGE_TYPE_2D,
-                    VK_FORMAT_R32_SFLOAT,
-                    {8U, 8U, 1U},
-                    1U,
-                    1U,
-                    VK_SAMPLE_COUNT_1_BIT,
-                    VK_IMAGE_TILING_OPTIMAL,
-                    VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
-                    VK_SHARING_MODE_EXCLUSIVE,
-                    0U,
-                    NULL,
-                    VK_IMAGE_LAYOUT_UNDEFINED};
-
-                VkImage dummy_img;
-                VkResult const res_create_image = pfn_create_image(this->m_device, &depth_attachment_sampled_image_create_info, this->m_allocation_callbacks, &dummy_img);
-                assert(VK_SUCCESS == res_create_image);
-
-                VkMemoryRequirements memory_requirements;
-                pfn_get_image_memory_requirements(this->m_device, dummy_img, &memory_requirements);
-                memory_requirements_size = memory_requirements.size;
-                memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
-
-                pfn_destroy_image(this->m_device, dummy_img, this->m_allocation_callbacks);
-            }
+        non_compacted_bottom_level_acceleration_structure_buffer_memory_index = _internal_find_lowest_memory_type_index(&this->m_physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        assert(VK_MAX_MEMORY_TYPES > non_compacted_bottom_level_acceleration_structure_buffer_memory_index);
+        assert(this->m_physical_device_memory_properties.memoryTypeCount > non_compacted_bottom_level_acceleration_structure_buffer_memory_index);
 
-            // The lower index indicates the more performance
-            storage_image_memory_index = _internal_find_lowest_memory_type_index(&physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-            assert(VK_MAX_MEMORY_TYPES > storage_image_memory_index);
-            assert(physical_device_memory_properties.memoryTypeCount > storage_image_memory_index);
+        VmaPoolCreateInfo const pool_create_info = {
+            non_compacted_bottom_level_acceleration_structure_buffer_memory_index,
+            VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
+            0U,
+            0U,
+            0U,
+            1.0F,
+            D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT,
+            NULL};
 
-            VmaPoolCreateInfo const pool_create_info = {
-                storage_image_memory_index,
-                VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
-                0U,
-                0U,
-                0U,
-                1.0F,
-                0U,
-                NULL};
+        VmaPool new_memory_pool = VK_NULL_HANDLE;
+        VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &new_memory_pool);
+        assert(VK_SUCCESS == res_vma_create_pool);
 
-            VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &this->m_storage_intermediate_image_memory_pool);
-            assert(VK_SUCCESS == res_vma_create_pool);
-        }
+        memory_pool = this->publish_memory_pool(&this->m_non_compacted_bottom_level_acceleration_structure_memory_pool, new_memory_pool);
+    }
 
-        assert(VK_NULL_HANDLE == this->m_sampled_asset_image_memory_pool);
-        {
-            uint32_t sampled_asset_image_memory_index = VK_MAX_MEMORY_TYPES;
+    return memory_pool;
+}
 
-            VkDeviceSize memory_requirements_size = VkDeviceSize(-1);
-            uint32_t memory_requirements_memory_type_bits = 0U;
-            {
-                VkFormat color_format = VK_FORMAT_R8G8B8A8_UNORM;
-
-                VkFormatProperties format_properties;
-                pfn_get_physical_device_format_properties(this->m_physical_device, color_format, &format_properties);
-                assert(format_properties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT);
-                assert(format_properties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT);
-
-                VkImageCreateInfo const image_create_info_regular_tiling_optimal = {
-                    VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
-                    NULL,
-                    0U,
-                    VK_IMAGE_TYPE_2D,
-                    color_format,
-                    {1U, 1U, 1U},
-                    1U,
-                    1U,
-                    VK_SAMPLE_COUNT_1_BIT,
-                    VK_IMAGE_TILING_OPTIMAL,
-                    VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
-                    VK_SHARING_MODE_EXCLUSIVE,
-                    0U,
-                    NULL,
-                    VK_IMAGE_LAYOUT_UNDEFINED};
-
-                VkImage dummy_img;
-                VkResult const res_create_image = pfn_create_image(this->m_device, &image_create_info_regular_tiling_optimal, this->m_allocation_callbacks, &dummy_img);
-                assert(VK_SUCCESS == res_create_image);
-
-                VkMemoryRequirements memory_requirements;
-                pfn_get_image_memory_requirements(this->m_device, dummy_img, &memory_requirements);
-                memory_requirements_size = memory_requirements.size;
-                memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
-
-                pfn_destroy_image(this->m_device, dummy_img, this->m_allocation_callbacks);
-            }
+VmaPool brx_pal_vk_device::get_compacted_bottom_level_acceleration_structure_memory_pool() const
+{
+    assert(this->m_support_ray_tracing);
 
-            sampled_asset_image_memory_index = _internal_find_lowest_memory_type_index(&physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-            assert(VK_MAX_MEMORY_TYPES > sampled_asset_image_memory_index);
-            assert(physical_device_memory_properties.memoryTypeCount > sampled_asset_image_memory_index);
+    VmaPool memory_pool = this->m_compacted_bottom_level_acceleration_structure_memory_pool.load();
+    if (VK_NULL_HANDLE == memory_pool)
+    {
+        uint32_t compacted_bottom_level_acceleration_structure_memory_index = VK_MAX_MEMORY_TYPES;
 
-            VmaPoolCreateInfo const pool_create_info = {
-                sampled_asset_image_memory_index,
-                VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
-                0U,
-                0U,
+        VkDeviceSize memory_requirements_size = static_cast<VkDeviceSize>(-1);
+        uint32_t memory_requirements_memory_type_bits = 0U;
+        {
+            VkBufferCreateInfo const buffer_create_info = {
+                VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+                NULL,
                 0U,
-                1.0F,
+                1U,
+                VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_STORAGE_BIT_KHR | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT_KHR,
+                VK_SHARING_MODE_EXCLUSIVE,
                 0U,
                 NULL};
 
-            VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &this->m_sampled_asset_image_memory_pool);
-            assert(VK_SUCCESS == res_vma_create_pool);
-        }
-
-        if (this->m_support_ray_tracing)
-        {
-            constexpr VkDeviceSize const D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT = 256U;
-            constexpr VkDeviceSize const D3D12_RAYTRACING_INSTANCE_DESCS_BYTE_ALIGNMENT = 16;
-
-            // scratch buffer
-            assert(VK_NULL_HANDLE == this->m_scratch_buffer_memory_pool);
-            {
-                uint32_t scratch_buffer_memory_index = VK_MAX_MEMORY_TYPES;
+            VkBuffer dummy_buf;
+            VkResult const res_create_buffer = this->m_pfn_create_buffer(this->m_device, &buffer_create_info, this->m_allocation_callbacks, &dummy_buf);
+            assert(VK_SUCCESS == res_create_buffer);
 
-                VkDeviceSize memory_requirements_size = static_cast<VkDeviceSize>(-1);
-                uint32_t memory_requirements_memory_type_bits = 0U;
-                {
-                    VkBufferCreateInfo const buffer_create_info = {
-                        VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
-                        NULL,
-                        0U,
-                        1U,
-                        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT_KHR,
-                        VK_SHARING_MODE_EXCLUSIVE,
-                        0U,
-                        NULL};
-
-                    VkBuffer dummy_buf;
-                    VkResult const res_create_buffer = pfn_create_buffer(this->m_device, &buffer_create_info, this->m_allocation_callbacks, &dummy_buf);
-                    assert(VK_SUCCESS == res_create_buffer);
-
-                    VkMemoryRequirements memory_requirements;
-                    pfn_get_buffer_memory_requirements(this->m_device, dummy_buf, &memory_requirements);
-                    memory_requirements_size = memory_requirements.size;
-                    memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
-
-                    pfn_destroy_buffer(this->m_device, dummy_buf, this->m_allocation_callbacks);
-                }
+            VkMemoryRequirements memory_requirements;
+            this->m_pfn_get_buffer_memory_requirements(this->m_device, dummy_buf, &memory_requirements);
+            memory_requirements_size = memory_requirements.size;
+            memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
 
-                scratch_buffer_memory_index = _internal_find_lowest_memory_type_index(&physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-                assert(VK_MAX_MEMORY_TYPES > scratch_buffer_memory_index);
-                assert(physical_device_memory_properties.memoryTypeCount > scratch_buffer_memory_index);
-
-                VmaPoolCreateInfo const pool_create_info = {
-                    scratch_buffer_memory_index,
-                    VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
-                    0U,
-                    0U,
-                    0U,
-                    1.0F,
-                    D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT,
-                    NULL};
-
-                VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &this->m_scratch_buffer_memory_pool);
-                assert(VK_SUCCESS == res_vma_create_pool);
-            }
+            this->m_pfn_destroy_buffer(this->m_device, dummy_buf, this->m_allocation_callbacks);
+        }
 
-            // intermediate bottom level acceleration structure
-            assert(VK_NULL_HANDLE == this->m_intermediate_bottom_level_acceleration_structure_memory_pool);
-            {
-                uint32_t intermediate_bottom_level_acceleration_structure_memory_index = VK_MAX_MEMORY_TYPES;
+        compacted_bottom_level_acceleration_structure_memory_index = _internal_find_lowest_memory_type_index(&this->m_physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        assert(VK_MAX_MEMORY_TYPES > compacted_bottom_level_acceleration_structure_memory_index);
+        assert(this->m_physical_device_memory_properties.memoryTypeCount > compacted_bottom_level_acceleration_structure_memory_index);
 
-                VkDeviceSize memory_requirements_size = static_cast<VkDeviceSize>(-1);
-                uint32_t memory_requirements_memory_type_bits = 0U;
-                {
-                    VkBufferCreateInfo const buffer_create_info = {
-                        VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
-                        NULL,
-                        0U,
-                        1U,
-                        VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_STORAGE_BIT_KHR | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT_KHR,
-                        VK_SHARING_MODE_EXCLUSIVE,
-                        0U,
-                        NULL};
-
-                    VkBuffer dummy_buf;
-                    VkResult const res_create_buffer = pfn_create_buffer(this->m_device, &buffer_create_info, this->m_allocation_callbacks, &dummy_buf);
-                    assert(VK_SUCCESS == res_create_buffer);
-
-                    VkMemoryRequirements memory_requirements;
-                    pfn_get_buffer_memory_requirements(this->m_device, dummy_buf, &memory_requirements);
-                    memory_requirements_size = memory_requirements.size;
-                    memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
-
-                    pfn_destroy_buffer(this->m_device, dummy_buf, this->m_allocation_callbacks);
-                }
+        VmaPoolCreateInfo const pool_create_info = {
+            compacted_bottom_level_acceleration_structure_memory_index,
+            VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
+            0U,
+            0U,
+            0U,
+            1.0F,
+            D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT,
+            NULL};
 
-                intermediate_bottom_level_acceleration_structure_memory_index = _internal_find_lowest_memory_type_index(&physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-                assert(VK_MAX_MEMORY_TYPES > intermediate_bottom_level_acceleration_structure_memory_index);
-                assert(physical_device_memory_properties.memoryTypeCount > intermediate_bottom_level_acceleration_structure_memory_index);
-
-                VmaPoolCreateInfo const pool_create_info = {
-                    intermediate_bottom_level_acceleration_structure_memory_index,
-                    VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
-                    0U,
-                    0U,
-                    0U,
-                    1.0F,
-                    D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT,
-                    NULL};
-
-                VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &this->m_intermediate_bottom_level_acceleration_structure_memory_pool);
-                assert(VK_SUCCESS == res_vma_create_pool);
-            }
+        VmaPool new_memory_pool = VK_NULL_HANDLE;
+        VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &new_memory_pool);
+        assert(VK_SUCCESS == res_vma_create_pool);
 
-            // non compacted bottom level acceleration structure buffer
-            assert(VK_NULL_HANDLE == this->m_non_compacted_bottom_level_acceleration_structure_memory_pool);
-            {
-                uint32_t non_compacted_bottom_level_acceleration_structure_buffer_memory_index = VK_MAX_MEMORY_TYPES;
+        memory_pool = this->publish_memory_pool(&this->m_compacted_bottom_level_acceleration_structure_memory_pool, new_memory_pool);
+    }
 
-                VkDeviceSize memory_requirements_size = static_cast<VkDeviceSize>(-1);
-                uint32_t memory_requirements_memory_type_bits = 0U;
-                {
-                    VkBufferCreateInfo const buffer_create_info = {
-                        VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
-                        NULL,
-                        0U,
-                        1U,
-                        VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_STORAGE_BIT_KHR,
-                        VK_SHARING_MODE_EXCLUSIVE,
-                        0U,
-                        NULL};
-
-                    VkBuffer dummy_buf;
-                    VkResult const res_create_buffer = pfn_create_buffer(this->m_device, &buffer_create_info, this->m_allocation_callbacks, &dummy_buf);
-                    assert(VK_SUCCESS == res_create_buffer);
-
-                    VkMemoryRequirements memory_requirements;
-                    pfn_get_buffer_memory_requirements(this->m_device, dummy_buf, &memory_requirements);
-                    memory_requirements_size = memory_requirements.size;
-                    memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
-
-                    pfn_destroy_buffer(this->m_device, dummy_buf, this->m_allocation_callbacks);
-                }
+    return memory_pool;
+}
 
-                non_compacted_bottom_level_acceleration_structure_buffer_memory_index = _internal_find_lowest_memory_type_index(&physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-                assert(VK_MAX_MEMORY_TYPES > non_compacted_bottom_level_acceleration_structure_buffer_memory_index);
-                assert(physical_device_memory_properties.memoryTypeCount > non_compacted_bottom_level_acceleration_structure_buffer_memory_index);
-
-                VmaPoolCreateInfo const pool_create_info = {
-                    non_compacted_bottom_level_acceleration_structure_buffer_memory_index,
-                    VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
-                    0U,
-                    0U,
-                    0U,
-                    1.0F,
-                    D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT,
-                    NULL};
-
-                VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &this->m_non_compacted_bottom_level_acceleration_structure_memory_pool);
-                assert(VK_SUCCESS == res_vma_create_pool);
-            }
+VmaPool brx_pal_vk_device::get_serialized_bottom_level_acceleration_structure_buffer_memory_pool() const
+{
+    assert(this->m_support_ray_tracing);
 
-            // compacted bottom level acceleration structure
-            assert(VK_NULL_HANDLE == this->m_compacted_bottom_level_acceleration_structure_memory_pool);
-            {
-                uint32_t compacted_bottom_level_acceleration_structure_memory_index = VK_MAX_MEMORY_TYPES;
+    VmaPool memory_pool = this->m_serialized_bottom_level_acceleration_structure_buffer_memory_pool.load();
+    if (VK_NULL_HANDLE == memory_pool)
+    {
+        uint32_t serialized_bottom_level_acceleration_structure_buffer_memory_index = VK_MAX_MEMORY_TYPES;
 
-                VkDeviceSize memory_requirements_size = static_cast<VkDeviceSize>(-1);
-                uint32_t memory_requirements_memory_type_bits = 0U;
-                {
-                    VkBufferCreateInfo const buffer_create_info = {
-                        VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
-                        NULL,
-                        0U,
-                        1U,
-                        VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_STORAGE_BIT_KHR | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT_KHR,
-                        VK_SHARING_MODE_EXCLUSIVE,
-                        0U,
-                        NULL};
-
-                    VkBuffer dummy_buf;
-                    VkResult const res_create_buffer = pfn_create_buffer(this->m_device, &buffer_create_info, this->m_allocation_callbacks, &dummy_buf);
-                    assert(VK_SUCCESS == res_create_buffer);
-
-                    VkMemoryRequirements memory_requirements;
-                    pfn_get_buffer_memory_requirements(this->m_device, dummy_buf, &memory_requirements);
-                    memory_requirements_size = memory_requirements.size;
-                    memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
-
-                    pfn_destroy_buffer(this->m_device, dummy_buf, this->m_allocation_callbacks);
-                }
+        VkDeviceSize memory_requirements_size = static_cast<VkDeviceSize>(-1);
+        uint32_t memory_requirements_memory_type_bits = 0U;
+        {
+            VkBufferCreateInfo const buffer_create_info = {
+                VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+                NULL,
+                0U,
+                1U,
+                VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT_KHR,
+                VK_SHARING_MODE_EXCLUSIVE,
+                0U,
+                NULL};
 
-                compacted_bottom_level_acceleration_structure_memory_index = _internal_find_lowest_memory_type_index(&physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-                assert(VK_MAX_MEMORY_TYPES > compacted_bottom_level_acceleration_structure_memory_index);
-                assert(physical_device_memory_properties.memoryTypeCount > compacted_bottom_level_acceleration_structure_memory_index);
-
-                VmaPoolCreateInfo const pool_create_info = {
-                    compacted_bottom_level_acceleration_structure_memory_index,
-                    VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
-                    0U,
-                    0U,
-                    0U,
-                    1.0F,
-                    D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT,
-                    NULL};
-
-                VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &this->m_compacted_bottom_level_acceleration_structure_memory_pool);
-                assert(VK_SUCCESS == res_vma_create_pool);
-            }
+            VkBuffer dummy_buf;
+            VkResult const res_create_buffer = this->m_pfn_create_buffer(this->m_device, &buffer_create_info, this->m_allocation_callbacks, &dummy_buf);
+            assert(VK_SUCCESS == res_create_buffer);
 
-            // top level acceleration structure instance buffer
-            assert(VK_NULL_HANDLE == this->m_top_level_acceleration_structure_instance_upload_buffer_memory_pool);
-            {
-                uint32_t top_level_acceleration_structure_instance_upload_buffer_memory_index = VK_MAX_MEMORY_TYPES;
+            VkMemoryRequirements memory_requirements;
+            this->m_pfn_get_buffer_memory_requirements(this->m_device, dummy_buf, &memory_requirements);
+            memory_requirements_size = memory_requirements.size;
+            memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
 
-                VkDeviceSize memory_requirements_size = static_cast<VkDeviceSize>(-1);
-                uint32_t memory_requirements_memory_type_bits = 0U;
-                {
-                    VkBufferCreateInfo const buffer_create_info = {
-                        VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
-                        NULL,
-                        0U,
-                        320ULL * 1024ULL * 1024ULL, // NOTE: 320 MB which is greater than 256MB "AMD Special Pool"
-                        VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT_KHR,
-                        VK_SHARING_MODE_EXCLUSIVE,
-                        0U,
-                        NULL};
-
-                    VkBuffer dummy_buf;
-                    VkResult const res_create_buffer = pfn_create_buffer(this->m_device, &buffer_create_info, this->m_allocation_callbacks, &dummy_buf);
-                    assert(VK_SUCCESS == res_create_buffer);
-
-                    VkMemoryRequirements memory_requirements;
-                    pfn_get_buffer_memory_requirements(this->m_device, dummy_buf, &memory_requirements);
-                    memory_requirements_size = memory_requirements.size;
-                    memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
-
-                    pfn_destroy_buffer(this->m_device, dummy_buf, this->m_allocation_callbacks);
-                }
+            this->m_pfn_destroy_buffer(this->m_device, dummy_buf, this->m_allocation_callbacks);
+        }
 
-                top_level_acceleration_structure_instance_upload_buffer_memory_index = _internal_find_lowest_memory_type_index(&physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-                assert(VK_MAX_MEMORY_TYPES > top_level_acceleration_structure_instance_upload_buffer_memory_index);
-                assert(physical_device_memory_properties.memoryTypeCount > top_level_acceleration_structure_instance_upload_buffer_memory_index);
-
-                VmaPoolCreateInfo const pool_create_info = {
-                    top_level_acceleration_structure_instance_upload_buffer_memory_index,
-                    VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
-                    0U,
-                    0U,
-                    0U,
-                    1.0F,
-                    D3D12_RAYTRACING_INSTANCE_DESCS_BYTE_ALIGNMENT,
-                    NULL};
-
-                VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &this->m_top_level_acceleration_structure_instance_upload_buffer_memory_pool);
-                assert(VK_SUCCESS == res_vma_create_pool);
-            }
+        // NOTE: the serialized data is both read and written by the host
+        serialized_bottom_level_acceleration_structure_buffer_memory_index = _internal_find_lowest_memory_type_index(&this->m_physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+        assert(VK_MAX_MEMORY_TYPES > serialized_bottom_level_acceleration_structure_buffer_memory_index);
+        assert(this->m_physical_device_memory_properties.memoryTypeCount > serialized_bottom_level_acceleration_structure_buffer_memory_index);
 
-            // top level acceleration structure
-            assert(VK_NULL_HANDLE == this->m_top_level_acceleration_structure_memory_pool);
-            {
-                uint32_t top_level_acceleration_structure_memory_index = VK_MAX_MEMORY_TYPES;
+        VmaPoolCreateInfo const pool_create_info = {
+            serialized_bottom_level_acceleration_structure_buffer_memory_index,
+            VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
+            0U,
+            0U,
+            0U,
+            1.0F,
+            D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT,
+            NULL};
 
-                VkDeviceSize memory_requirements_size = static_cast<VkDeviceSize>(-1);
-                uint32_t memory_requirements_memory_type_bits = 0U;
-                {
-                    VkBufferCreateInfo const buffer_create_info = {
-                        VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
-                        NULL,
-                        0U,
-                        1U,
-                        VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_STORAGE_BIT_KHR,
-                        VK_SHARING_MODE_EXCLUSIVE,
-                        0U,
-                        NULL};
-
-                    VkBuffer dummy_buf;
-                    VkResult const res_create_buffer = pfn_create_buffer(this->m_device, &buffer_create_info, this->m_allocation_callbacks, &dummy_buf);
-                    assert(VK_SUCCESS == res_create_buffer);
-
-                    VkMemoryRequirements memory_requirements;
-                    pfn_get_buffer_memory_requirements(this->m_device, dummy_buf, &memory_requirements);
-                    memory_requirements_size = memory_requirements.size;
-                    memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
-
-                    pfn_destroy_buffer(this->m_device, dummy_buf, this->m_allocation_callbacks);
-                }
+        VmaPool new_memory_pool = VK_NULL_HANDLE;
+        VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &new_memory_pool);
+        assert(VK_SUCCESS == res_vma_create_pool);
 
-                top_level_acceleration_structure_memory_index = _internal_find_lowest_memory_type_index(&physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-                assert(VK_MAX_MEMORY_TYPES > top_level_acceleration_structure_memory_index);
-                assert(physical_device_memory_properties.memoryTypeCount > top_level_acceleration_structure_memory_index);
-
-                VmaPoolCreateInfo const pool_create_info = {
-                    top_level_acceleration_structure_memory_index,
-                    VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
-                    0U,
-                    0U,
-                    0U,
-                    1.0F,
-                    D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT,
-                    NULL};
-
-                VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &this->m_top_level_acceleration_structure_memory_pool);
-                assert(VK_SUCCESS == res_vma_create_pool);
-            }
-        }
+        memory_pool = this->publish_memory_pool(&this->m_serialized_bottom_level_acceleration_structure_buffer_memory_pool, new_memory_pool);
     }
 
-    assert(NULL == this->m_pfn_wait_for_fences);
-    this->m_pfn_wait_for_fences = reinterpret_cast<PFN_vkWaitForFences>(this->m_pfn_get_device_proc_addr(this->m_device, "vkWaitForFences"));
-    assert(NULL != this->m_pfn_wait_for_fences);
+    return memory_pool;
+}
 
-    assert(NULL == this->m_pfn_reset_fences);
-    this->m_pfn_reset_fences = reinterpret_cast<PFN_vkResetFences>(this->m_pfn_get_device_proc_addr(this->m_device, "vkResetFences"));
-    assert(NULL != this->m_pfn_reset_fences);
+VmaPool brx_pal_vk_device::get_top_level_acceleration_structure_instance_upload_buffer_memory_pool() const
+{
+    assert(this->m_support_ray_tracing);
 
-    assert(NULL == this->m_pfn_reset_command_pool);
-    this->m_pfn_reset_command_pool = reinterpret_cast<PFN_vkResetCommandPool>(this->m_pfn_get_device_proc_addr(this->m_device, "vkResetCommandPool"));
-    assert(NULL != this->m_pfn_reset_command_pool);
+    VmaPool memory_pool = this->m_top_level_acceleration_structure_instance_upload_buffer_memory_pool.load();
+    if (VK_NULL_HANDLE == memory_pool)
+    {
+        uint32_t top_level_acceleration_structure_instance_upload_buffer_memory_index = VK_MAX_MEMORY_TYPES;
 
-    assert(NULL == this->m_pfn_acquire_next_image);
-    this->m_pfn_acquire_next_image = reinterpret_cast<PFN_vkAcquireNextImageKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkAcquireNextImageKHR"));
-    assert(NULL != this->m_pfn_acquire_next_image);
+        VkDeviceSize memory_requirements_size = static_cast<VkDeviceSize>(-1);
+        uint32_t memory_requirements_memory_type_bits = 0U;
+        {
+            VkBufferCreateInfo const buffer_create_info = {
+                VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+                NULL,
+                0U,
+                320ULL * 1024ULL * 1024ULL, // NOTE: 320 MB which is greater than 256MB "AMD Special Pool"
+                VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT_KHR,
+                VK_SHARING_MODE_EXCLUSIVE,
+                0U,
+                NULL};
 
-    assert(NULL == this->m_pfn_create_image_view);
-    this->m_pfn_create_image_view = reinterpret_cast<PFN_vkCreateImageView>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateImageView"));
-    assert(NULL != this->m_pfn_create_image_view);
+            VkBuffer dummy_buf;
+            VkResult const res_create_buffer = this->m_pfn_create_buffer(this->m_device, &buffer_create_info, this->m_allocation_callbacks, &dummy_buf);
+            assert(VK_SUCCESS == res_create_buffer);
 
-    assert(NULL == this->m_pfn_destroy_image_view);
-    this->m_pfn_destroy_image_view = reinterpret_cast<PFN_vkDestroyImageView>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyImageView"));
-    assert(NULL != this->m_pfn_destroy_image_view);
+            VkMemoryRequirements memory_requirements;
+            this->m_pfn_get_buffer_memory_requirements(this->m_device, dummy_buf, &memory_requirements);
+            memory_requirements_size = memory_requirements.size;
+            memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
 
-    if (this->m_support_ray_tracing)
-    {
-        assert(NULL == this->m_pfn_get_buffer_device_address);
-        this->m_pfn_get_buffer_device_address = reinterpret_cast<PFN_vkGetBufferDeviceAddress>(this->m_pfn_get_device_proc_addr(this->m_device, "vkGetBufferDeviceAddressKHR"));
-        assert(NULL != this->m_pfn_get_buffer_device_address);
+            this->m_pfn_destroy_buffer(this->m_device, dummy_buf, this->m_allocation_callbacks);
+        }
 
-        assert(NULL == this->m_pfn_create_acceleration_structure);
-        this->m_pfn_create_acceleration_structure = reinterpret_cast<PFN_vkCreateAccelerationStructureKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateAccelerationStructureKHR"));
-        assert(NULL != this->m_pfn_create_acceleration_structure);
+        top_level_acceleration_structure_instance_upload_buffer_memory_index = _internal_find_lowest_memory_type_index(&this->m_physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+        assert(VK_MAX_MEMORY_TYPES > top_level_acceleration_structure_instance_upload_buffer_memory_index);
+        assert(this->m_physical_device_memory_properties.memoryTypeCount > top_level_acceleration_structure_instance_upload_buffer_memory_index);
 
-        assert(NULL == this->m_pfn_destroy_acceleration_structure);
-        this->m_pfn_destroy_acceleration_structure = reinterpret_cast<PFN_vkDestroyAccelerationStructureKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyAccelerationStructureKHR"));
-        assert(NULL != this->m_pfn_destroy_acceleration_structure);
+        VmaPoolCreateInfo const pool_create_info = {
+            top_level_acceleration_structure_instance_upload_buffer_memory_index,
+            VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
+            0U,
+            0U,
+            0U,
+            1.0F,
+            D3D12_RAYTRACING_INSTANCE_DESCS_BYTE_ALIGNMENT,
+            NULL};
 
-        assert(NULL == this->m_pfn_get_acceleration_structure_device_address);
-        this->m_pfn_get_acceleration_structure_device_address = reinterpret_cast<PFN_vkGetAccelerationStructureDeviceAddressKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkGetAccelerationStructureDeviceAddressKHR"));
-        assert(NULL != this->m_pfn_get_acceleration_structure_device_address);
+        VmaPool new_memory_pool = VK_NULL_HANDLE;
+        VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &new_memory_pool);
+        assert(VK_SUCCESS == res_vma_create_pool);
 
-        assert(NULL == this->m_pfn_get_query_pool_results);
-        this->m_pfn_get_query_pool_results = reinterpret_cast<PFN_vkGetQueryPoolResults>(this->m_pfn_get_device_proc_addr(this->m_device, "vkGetQueryPoolResults"));
-        assert(NULL != this->m_pfn_get_query_pool_results);
+        memory_pool = this->publish_memory_pool(&this->m_top_level_acceleration_structure_instance_upload_buffer_memory_pool, new_memory_pool);
     }
-}
-
-extern void brx_pal_destroy_vk_device(brx_pal_device *wrapped_device)
-{
-    assert(NULL != wrapped_device);
-    brx_pal_vk_device *delete_unwrapped_device = static_cast<brx_pal_vk_device *>(wrapped_device);
-
-    delete_unwrapped_device->uninit();
 
-    delete_unwrapped_device->~brx_pal_vk_device();
-    mcrt_free(delete_unwrapped_device);
+    return memory_pool;
 }
 
-void brx_pal_vk_device::uninit()
+VmaPool brx_pal_vk_device::get_top_level_acceleration_structure_memory_pool() const
 {
-    assert(NULL != this->m_pfn_get_instance_proc_addr);
-    assert(VK_NULL_HANDLE != this->m_instance);
-#ifndef NDEBUG
-    assert(VK_NULL_HANDLE != this->m_message);
-#endif
-    assert(NULL != this->m_pfn_get_device_proc_addr);
-    assert(VK_NULL_HANDLE != this->m_device);
-    assert(VK_NULL_HANDLE != this->m_memory_allocator);
-    assert(VK_NULL_HANDLE != this->m_uniform_upload_buffer_memory_pool);
-    assert(VK_NULL_HANDLE != this->m_staging_upload_buffer_memory_pool);
-    assert(VK_NULL_HANDLE != this->m_storage_intermediate_buffer_memory_pool);
-    assert(VK_NULL_HANDLE != this->m_storage_asset_buffer_memory_pool);
-    assert(VK_NULL_HANDLE != this->m_color_transient_attachment_image_memory_pool);
-    assert(VK_NULL_HANDLE != this->m_color_attachment_sampled_image_memory_pool);
-    assert(VK_NULL_HANDLE != this->m_depth_transient_attachment_image_memory_pool);
-    assert((!this->m_depth_attachment_image_format_support_sampled_image) || (VK_NULL_HANDLE != this->m_depth_attachment_sampled_image_memory_pool));
-    assert(VK_NULL_HANDLE != this->m_depth_stencil_transient_attachment_image_memory_pool);
-    assert((!this->m_depth_stencil_attachment_image_format_support_sampled_image) || (VK_NULL_HANDLE != this->m_depth_stencil_attachment_sampled_image_memory_pool));
-    assert(VK_NULL_HANDLE != this->m_storage_intermediate_image_memory_pool);
-    assert(VK_NULL_HANDLE != this->m_sampled_asset_image_memory_pool);
-    assert((!this->m_support_ray_tracing) || (VK_NULL_HANDLE != this->m_scratch_buffer_memory_pool));
-    assert((!this->m_support_ray_tracing) || (VK_NULL_HANDLE != this->m_intermediate_bottom_level_acceleration_structure_memory_pool));
-    assert((!this->m_support_ray_tracing) || (VK_NULL_HANDLE != this->m_non_compacted_bottom_level_acceleration_structure_memory_pool));
-    assert((!this->m_support_ray_tracing) || (VK_NULL_HANDLE != this->m_compacted_bottom_level_acceleration_structure_memory_pool));
-    assert((!this->m_support_ray_tracing) || (VK_NULL_HANDLE != this->m_top_level_acceleration_structure_instance_upload_buffer_memory_pool));
-    assert((!this->m_support_ray_tracing) || (VK_NULL_HANDLE != this->m_top_level_acceleration_structure_memory_pool));
-
-    vmaDestroyPool(this->m_memory_allocator, this->m_uniform_upload_buffer_memory_pool);
-    this->m_uniform_upload_buffer_memory_pool = VK_NULL_HANDLE;
-
-    vmaDestroyPool(this->m_memory_allocator, this->m_staging_upload_buffer_memory_pool);
-    this->m_staging_upload_buffer_memory_pool = VK_NULL_HANDLE;
-
-    vmaDestroyPool(this->m_memory_allocator, this->m_storage_intermediate_buffer_memory_pool);
-    this->m_storage_intermediate_buffer_memory_pool = VK_NULL_HANDLE;
-
-    vmaDestroyPool(this->m_memory_allocator, this->m_storage_asset_buffer_memory_pool);
-    this->m_storage_asset_buffer_memory_pool = VK_NULL_HANDLE;
-
-    vmaDestroyPool(this->m_memory_allocator, this->m_color_transient_attachment_image_memory_pool);
-    this->m_color_transient_attachment_image_memory_pool = VK_NULL_HANDLE;
-
-    vmaDestroyPool(this->m_memory_allocator, this->m_color_attachment_sampled_image_memory_pool);
-    this->m_color_attachment_sampled_image_memory_pool = VK_NULL_HANDLE;
-
-    vmaDestroyPool(this->m_memory_allocator, this->m_depth_transient_attachment_image_memory_pool);
-    this->m_depth_transient_attachment_image_memory_pool = VK_NULL_HANDLE;
-
-    if (this->m_depth_attachment_image_format_support_sampled_image)
-    {
-        vmaDestroyPool(this->m_memory_allocator, this->m_depth_attachment_sampled_image_memory_pool);
-        this->m_depth_attachment_sampled_image_memory_pool = VK_NULL_HANDLE;
-    }
-    else
-    {
-        assert(VK_NULL_HANDLE == this->m_depth_attachment_sampled_image_memory_pool);
-    }
-
-    vmaDestroyPool(this->m_memory_allocator, this->m_depth_stencil_transient_attachment_image_memory_pool);
-    this->m_depth_stencil_transient_attachment_image_memory_pool = VK_NULL_HANDLE;
+    assert(this->m_support_ray_tracing);
 
-    if (this->m_depth_stencil_attachment_image_format_support_sampled_image)
+    VmaPool memory_pool = this->m_top_level_acceleration_structure_memory_pool.load();
+    if (VK_NULL_HANDLE == memory_pool)
     {
-        vmaDestroyPool(this->m_memory_allocator, this->m_depth_stencil_attachment_sampled_image_memory_pool);
-        this->m_depth_stencil_attachment_sampled_image_memory_pool = VK_NULL_HANDLE;
-    }
-    else
-    {
-        assert(VK_NULL_HANDLE == this->m_depth_stencil_attachment_sampled_image_memory_pool);
-    }
+        uint32_t top_level_acceleration_structure_memory_index = VK_MAX_MEMORY_TYPES;
 
-    vmaDestroyPool(this->m_memory_allocator, this->m_storage_intermediate_image_memory_pool);
-    this->m_storage_intermediate_image_memory_pool = VK_NULL_HANDLE;
-
-    vmaDestroyPool(this->m_memory_allocator, this->m_sampled_asset_image_memory_pool);
-    this->m_sampled_asset_image_memory_pool = VK_NULL_HANDLE;
-
-    vmaDestroyPool(this->m_memory_allocator, this->m_scratch_buffer_memory_pool);
-    this->m_scratch_buffer_memory_pool = VK_NULL_HANDLE;
-
-    vmaDestroyPool(this->m_memory_allocator, this->m_intermediate_bottom_level_acceleration_structure_memory_pool);
-    this->m_intermediate_bottom_level_acceleration_structure_memory_pool = VK_NULL_HANDLE;
+        VkDeviceSize memory_requirements_size = static_cast<VkDeviceSize>(-1);
+        uint32_t memory_requirements_memory_type_bits = 0U;
+        {
+            VkBufferCreateInfo const buffer_create_info = {
+                VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+                NULL,
+                0U,
+                1U,
+                VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_STORAGE_BIT_KHR,
+                VK_SHARING_MODE_EXCLUSIVE,
+                0U,
+                NULL};
 
-    vmaDestroyPool(this->m_memory_allocator, this->m_non_compacted_bottom_level_acceleration_structure_memory_pool);
-    this->m_non_compacted_bottom_level_acceleration_structure_memory_pool = VK_NULL_HANDLE;
+            VkBuffer dummy_buf;
+            VkResult const res_create_buffer = this->m_pfn_create_buffer(this->m_device, &buffer_create_info, this->m_allocation_callbacks, &dummy_buf);
+            assert(VK_SUCCESS == res_create_buffer);
 
-    vmaDestroyPool(this->m_memory_allocator, this->m_compacted_bottom_level_acceleration_structure_memory_pool);
-    this->m_compacted_bottom_level_acceleration_structure_memory_pool = VK_NULL_HANDLE;
+            VkMemoryRequirements memory_requirements;
+            this->m_pfn_get_buffer_memory_requirements(this->m_device, dummy_buf, &memory_requirements);
+            memory_requirements_size = memory_requirements.size;
+            memory_requirements_memory_type_bits = memory_requirements.memoryTypeBits;
 
-    vmaDestroyPool(this->m_memory_allocator, this->m_top_level_acceleration_structure_instance_upload_buffer_memory_pool);
-    this->m_top_level_acceleration_structure_instance_upload_buffer_memory_pool = VK_NULL_HANDLE;
+            this->m_pfn_destroy_buffer(this->m_device, dummy_buf, this->m_allocation_callbacks);
+        }
 
-    vmaDestroyPool(this->m_memory_allocator, this->m_top_level_acceleration_structure_memory_pool);
-    this->m_top_level_acceleration_structure_memory_pool = VK_NULL_HANDLE;
+        top_level_acceleration_structure_memory_index = _internal_find_lowest_memory_type_index(&this->m_physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        assert(VK_MAX_MEMORY_TYPES > top_level_acceleration_structure_memory_index);
+        assert(this->m_physical_device_memory_properties.memoryTypeCount > top_level_acceleration_structure_memory_index);
 
-    vmaDestroyAllocator(this->m_memory_allocator);
-    this->m_memory_allocator = VK_NULL_HANDLE;
+        VmaPoolCreateInfo const pool_create_info = {
+            top_level_acceleration_structure_memory_index,
+            VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT,
+            0U,
+            0U,
+            0U,
+            1.0F,
+            D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT,
+            NULL};
 
-    PFN_vkDestroyDevice const pfn_destroy_device = reinterpret_cast<PFN_vkDestroyDevice>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyDevice"));
-    assert(NULL != pfn_destroy_device);
-    pfn_destroy_device(this->m_device, this->m_allocation_callbacks);
-    this->m_device = VK_NULL_HANDLE;
+        VmaPool new_memory_pool = VK_NULL_HANDLE;
+        VkResult const res_vma_create_pool = vmaCreatePool(this->m_memory_allocator, &pool_create_info, &new_memory_pool);
+        assert(VK_SUCCESS == res_vma_create_pool);
 
-    this->m_pfn_get_device_proc_addr = NULL;
+        memory_pool = this->publish_memory_pool(&this->m_top_level_acceleration_structure_memory_pool, new_memory_pool);
+    }
 
-#ifndef NDEBUG
-    PFN_vkDestroyDebugUtilsMessengerEXT const pfn_destroy_debug_utils_messenger = reinterpret_cast<PFN_vkDestroyDebugUtilsMessengerEXT>(this->m_pfn_get_instance_proc_addr(this->m_instance, "vkDestroyDebugUtilsMessengerEXT"));
-    assert(NULL != pfn_destroy_debug_utils_messenger);
-    pfn_destroy_debug_utils_messenger(this->m_instance, this->m_message, this->m_allocation_callbacks);
-    this->m_message = VK_NULL_HANDLE;
-#endif
+    return memory_pool;
+}
 
-    PFN_vkDestroyInstance pfn_destroy_instance = reinterpret_cast<PFN_vkDestroyInstance>(this->m_pfn_get_instance_proc_addr(this->m_instance, "vkDestroyInstance"));
-    assert(NULL != pfn_destroy_instance);
-    pfn_destroy_instance(this->m_instance, this->m_allocation_callbacks);
-    this->m_instance = VK_NULL_HANDLE;
+VmaPool brx_pal_vk_device::get_color_attachment_image_memory_pool(bool allow_sampled_image) const
+{
+    return allow_sampled_image ? this->get_color_attachment_sampled_image_memory_pool() : this->get_color_transient_attachment_image_memory_pool();
+}
 
-    this->m_pfn_get_instance_proc_addr = NULL;
+VmaPool brx_pal_vk_device::get_depth_stencil_attachment_image_memory_pool(BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT wrapped_depth_stencil_attachment_image_format, bool allow_sampled_image) const
+{
+    VmaPool memory_pool;
+    switch (wrapped_depth_stencil_attachment_image_format)
+    {
+    case BRX_PAL_DEPTH_STENCIL_ATTACHMENT_FORMAT_D32_SFLOAT:
+    case BRX_PAL_DEPTH_STENCIL_ATTACHMENT_FORMAT_X8_D24_UNORM_PACK32:
+        memory_pool = allow_sampled_image ? this->get_depth_attachment_sampled_image_memory_pool() : this->get_depth_transient_attachment_image_memory_pool();
+        break;
+    case BRX_PAL_DEPTH_STENCIL_ATTACHMENT_FORMAT_D32_SFLOAT_S8_UINT:
+    case BRX_PAL_DEPTH_STENCIL_ATTACHMENT_FORMAT_D24_UNORM_S8_UINT:
+        memory_pool = allow_sampled_image ? this->get_depth_stencil_attachment_sampled_image_memory_pool() : this->get_depth_stencil_transient_attachment_image_memory_pool();
+        break;
+    default:
+        assert(false);
+        memory_pool = VK_NULL_HANDLE;
+    }
+    return memory_pool;
 }
 
-brx_pal_vk_device::~brx_pal_vk_device()
+VmaPool brx_pal_vk_device::publish_memory_pool(std::atomic<VmaPool> *memory_pool, VmaPool new_memory_pool) const
 {
-    assert(NULL == this->m_pfn_get_instance_proc_addr);
-    assert(VK_NULL_HANDLE == this->m_instance);
-#ifndef NDEBUG
-    assert(VK_NULL_HANDLE == this->m_message);
-#endif
-    assert(NULL == this->m_pfn_get_device_proc_addr);
-    assert(VK_NULL_HANDLE == this->m_device);
-    assert(VK_NULL_HANDLE == this->m_memory_allocator);
-    assert(VK_NULL_HANDLE == this->m_uniform_upload_buffer_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_staging_upload_buffer_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_storage_intermediate_buffer_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_storage_asset_buffer_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_color_transient_attachment_image_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_color_attachment_sampled_image_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_depth_transient_attachment_image_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_depth_attachment_sampled_image_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_depth_stencil_transient_attachment_image_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_depth_stencil_attachment_sampled_image_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_storage_intermediate_image_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_sampled_asset_image_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_scratch_buffer_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_intermediate_bottom_level_acceleration_structure_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_non_compacted_bottom_level_acceleration_structure_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_compacted_bottom_level_acceleration_structure_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_top_level_acceleration_structure_instance_upload_buffer_memory_pool);
-    assert(VK_NULL_HANDLE == this->m_top_level_acceleration_structure_memory_pool);
+    // multiple threads may race to create the same memory pool, and only one of them is kept
+    VmaPool expected_memory_pool = VK_NULL_HANDLE;
+    if (memory_pool->compare_exchange_strong(expected_memory_pool, new_memory_pool))
+    {
+        return new_memory_pool;
+    }
+    else
+    {
+        vmaDestroyPool(this->m_memory_allocator, new_memory_pool);
+        return expected_memory_pool;
+    }
 }
 
 BRX_PAL_BACKEND_NAME brx_pal_vk_device::get_backend_name() const
@@ -2070,6 +3066,11 @@ bool brx_pal_vk_device::is_ray_tracing_supported() const
     return this->m_support_ray_tracing;
 }
 
+bool brx_pal_vk_device::is_dynamic_rendering_supported() const
+{
+    return this->m_support_dynamic_rendering;
+}
+
 brx_pal_graphics_queue *brx_pal_vk_device::create_graphics_queue() const
 {
     PFN_vkQueueSubmit pfn_queue_submit = reinterpret_cast<PFN_vkQueueSubmit>(this->m_pfn_get_device_proc_addr(this->m_device, "vkQueueSubmit"));
@@ -2080,7 +3081,7 @@ brx_pal_graphics_queue *brx_pal_vk_device::create_graphics_queue() const
     void *new_brx_pal_graphics_queue_base = mcrt_malloc(sizeof(brx_pal_vk_graphics_queue), alignof(brx_pal_vk_graphics_queue));
     assert(NULL != new_brx_pal_graphics_queue_base);
 
-    brx_pal_vk_graphics_queue *new_brx_pal_graphics_queue = new (new_brx_pal_graphics_queue_base) brx_pal_vk_graphics_queue{this->m_has_dedicated_upload_queue, this->m_upload_queue_family_index, this->m_graphics_queue_family_index, this->m_graphics_queue, pfn_queue_submit, pfn_queue_present};
+    brx_pal_vk_graphics_queue *new_brx_pal_graphics_queue = new (new_brx_pal_graphics_queue_base) brx_pal_vk_graphics_queue{this->m_has_dedicated_upload_queue, this->m_upload_queue_family_index, this->m_graphics_queue_family_index, this->m_support_ray_tracing, this->m_has_dedicated_compute_queue, this->m_graphics_queue, pfn_queue_submit, pfn_queue_present};
     return new_brx_pal_graphics_queue;
 }
 
@@ -2124,13 +3125,39 @@ void brx_pal_vk_device::destroy_upload_queue(brx_pal_upload_queue *brx_pal_uploa
     assert(stealed_upload_queue == this->m_upload_queue);
 }
 
+brx_pal_compute_queue *brx_pal_vk_device::create_compute_queue() const
+{
+    PFN_vkQueueSubmit pfn_queue_submit = reinterpret_cast<PFN_vkQueueSubmit>(this->m_pfn_get_device_proc_addr(this->m_device, "vkQueueSubmit"));
+    assert(NULL != pfn_queue_submit);
+
+    void *new_brx_pal_compute_queue_base = mcrt_malloc(sizeof(brx_pal_vk_compute_queue), alignof(brx_pal_vk_compute_queue));
+    assert(NULL != new_brx_pal_compute_queue_base);
+
+    brx_pal_vk_compute_queue *new_brx_pal_compute_queue = new (new_brx_pal_compute_queue_base) brx_pal_vk_compute_queue{this->m_has_dedicated_compute_queue, this->m_compute_queue, pfn_queue_submit};
+    return new_brx_pal_compute_queue;
+}
+
+void brx_pal_vk_device::destroy_compute_queue(brx_pal_compute_queue *brx_pal_compute_queue) const
+{
+    assert(NULL != brx_pal_compute_queue);
+    brx_pal_vk_compute_queue *delete_compute_queue = static_cast<brx_pal_vk_compute_queue *>(brx_pal_compute_queue);
+
+    VkQueue stealed_compute_queue = VK_NULL_HANDLE;
+    delete_compute_queue->steal(&stealed_compute_queue);
+
+    delete_compute_queue->~brx_pal_vk_compute_queue();
+    mcrt_free(delete_compute_queue);
+
+    assert(stealed_compute_queue == this->m_compute_queue);
+}
+
 brx_pal_graphics_command_buffer *brx_pal_vk_device::create_graphics_command_buffer() const
 {
     void *new_unwrapped_graphics_command_buffer_base = mcrt_malloc(sizeof(brx_pal_vk_graphics_command_buffer), alignof(brx_pal_vk_graphics_command_buffer));
     assert(NULL != new_unwrapped_graphics_command_buffer_base);
 
     brx_pal_vk_graphics_command_buffer *new_unwrapped_graphics_command_buffer = new (new_unwrapped_graphics_command_buffer_base) brx_pal_vk_graphics_command_buffer{};
-    new_unwrapped_graphics_command_buffer->init(this->m_support_ray_tracing, this->m_has_dedicated_upload_queue, this->m_graphics_queue_family_index, this->m_upload_queue_family_index, this->m_pfn_get_instance_proc_addr, this->m_instance, this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks);
+    new_unwrapped_graphics_command_buffer->init(this->m_support_ray_tracing, this->m_support_dynamic_rendering, this->m_support_extended_dynamic_state, this->m_support_mesh_shader, this->m_has_dedicated_upload_queue, this->m_graphics_queue_family_index, this->m_upload_queue_family_index, this->m_has_dedicated_compute_queue, this->m_compute_queue_family_index, this->m_pfn_get_instance_proc_addr, this->m_instance, this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks);
     return new_unwrapped_graphics_command_buffer;
 }
 
@@ -2207,6 +3234,36 @@ void brx_pal_vk_device::destroy_upload_command_buffer(brx_pal_upload_command_buf
     mcrt_free(delete_unwrapped_upload_command_buffer);
 }
 
+brx_pal_compute_command_buffer *brx_pal_vk_device::create_compute_command_buffer() const
+{
+    void *new_unwrapped_compute_command_buffer_base = mcrt_malloc(sizeof(brx_pal_vk_compute_command_buffer), alignof(brx_pal_vk_compute_command_buffer));
+    assert(NULL != new_unwrapped_compute_command_buffer_base);
+
+    brx_pal_vk_compute_command_buffer *new_unwrapped_compute_command_buffer = new (new_unwrapped_compute_command_buffer_base) brx_pal_vk_compute_command_buffer{};
+    new_unwrapped_compute_command_buffer->init(this->m_support_ray_tracing, this->m_has_dedicated_compute_queue, this->m_graphics_queue_family_index, this->m_compute_queue_family_index, this->m_pfn_get_instance_proc_addr, this->m_instance, this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks);
+    return new_unwrapped_compute_command_buffer;
+}
+
+void brx_pal_vk_device::reset_compute_command_buffer(brx_pal_compute_command_buffer *brx_pal_compute_command_buffer) const
+{
+    assert(NULL != brx_pal_compute_command_buffer);
+    VkCommandPool command_pool = static_cast<brx_pal_vk_compute_command_buffer *>(brx_pal_compute_command_buffer)->get_command_pool();
+
+    VkResult res_reset_command_pool = this->m_pfn_reset_command_pool(this->m_device, command_pool, 0U);
+    assert(VK_SUCCESS == res_reset_command_pool);
+}
+
+void brx_pal_vk_device::destroy_compute_command_buffer(brx_pal_compute_command_buffer *wrapped_compute_command_buffer) const
+{
+    assert(NULL != wrapped_compute_command_buffer);
+    brx_pal_vk_compute_command_buffer *delete_unwrapped_compute_command_buffer = static_cast<brx_pal_vk_compute_command_buffer *>(wrapped_compute_command_buffer);
+
+    delete_unwrapped_compute_command_buffer->uninit(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks);
+
+    delete_unwrapped_compute_command_buffer->~brx_pal_vk_compute_command_buffer();
+    mcrt_free(delete_unwrapped_compute_command_buffer);
+}
+
 brx_pal_fence *brx_pal_vk_device::create_fence(bool signaled) const
 {
     VkFence new_fence = VK_NULL_HANDLE;
@@ -2222,7 +3279,7 @@ brx_pal_fence *brx_pal_vk_device::create_fence(bool signaled) const
         assert(VK_SUCCESS == res_create_fence);
     }
 
-    void *new_brx_pal_fence_base = mcrt_malloc(sizeof(brx_pal_vk_fence), alignof(brx_pal_vk_fence));
+    void *new_brx_pal_fence_base = this->m_fence_object_pool.allocate();
     assert(NULL != new_brx_pal_fence_base);
 
     brx_pal_vk_fence *new_brx_pal_fence = new (new_brx_pal_fence_base) brx_pal_vk_fence{new_fence};
@@ -2256,7 +3313,7 @@ void brx_pal_vk_device::destroy_fence(brx_pal_fence *brx_pal_fence) const
     delete_fence->steal(&stealed_fence);
 
     delete_fence->~brx_pal_vk_fence();
-    mcrt_free(delete_fence);
+    this->m_fence_object_pool.free(delete_fence);
 
     PFN_vkDestroyFence pfn_destroy_fence = reinterpret_cast<PFN_vkDestroyFence>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyFence"));
     assert(NULL != pfn_destroy_fence);
@@ -2285,7 +3342,7 @@ void brx_pal_vk_device::destroy_descriptor_set_layout(brx_pal_descriptor_set_lay
     mcrt_free(delete_unwrapped_descriptor_set_layout);
 }
 
-brx_pal_pipeline_layout *brx_pal_vk_device::create_pipeline_layout(uint32_t descriptor_set_layout_count, brx_pal_descriptor_set_layout const *const *brx_pal_descriptor_set_layouts) const
+brx_pal_pipeline_layout *brx_pal_vk_device::create_pipeline_layout(uint32_t descriptor_set_layout_count, brx_pal_descriptor_set_layout const *const *brx_pal_descriptor_set_layouts, uint32_t push_constant_size) const
 {
     VkPipelineLayout new_pipeline_layout = VK_NULL_HANDLE;
     {
@@ -2303,7 +3360,11 @@ brx_pal_pipeline_layout *brx_pal_vk_device::create_pipeline_layout(uint32_t desc
             descriptor_set_layouts[set_index] = static_cast<brx_pal_vk_descriptor_set_layout const *>(brx_pal_descriptor_set_layouts[set_index])->get_descriptor_set_layout();
         }
 
-        VkPipelineLayoutCreateInfo pipeline_layout_create_info = {VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO, NULL, 0U, descriptor_set_layout_count, descriptor_set_layouts, 0U, NULL};
+        assert(0U == (push_constant_size & 3U));
+        assert(push_constant_size <= BRX_PAL_MAX_PUSH_CONSTANT_SIZE);
+        VkPushConstantRange const push_constant_range = {VK_SHADER_STAGE_ALL, 0U, push_constant_size};
+
+        VkPipelineLayoutCreateInfo pipeline_layout_create_info = {VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO, NULL, 0U, descriptor_set_layout_count, descriptor_set_layouts, (push_constant_size > 0U) ? 1U : 0U, (push_constant_size > 0U) ? &push_constant_range : NULL};
 
         VkResult res_create_pipeline_layout = pfn_create_pipeline_layout(this->m_device, &pipeline_layout_create_info, this->m_allocation_callbacks, &new_pipeline_layout);
         assert(VK_SUCCESS == res_create_pipeline_layout);
@@ -2335,7 +3396,7 @@ void brx_pal_vk_device::destroy_pipeline_layout(brx_pal_pipeline_layout *brx_pal
 
 brx_pal_descriptor_set *brx_pal_vk_device::create_descriptor_set(brx_pal_descriptor_set_layout const *descriptor_set_layout, uint32_t unbounded_descriptor_count)
 {
-    void *new_unwrapped_descriptor_set_base = mcrt_malloc(sizeof(brx_pal_vk_descriptor_set), alignof(brx_pal_vk_descriptor_set));
+    void *new_unwrapped_descriptor_set_base = this->m_descriptor_set_object_pool.allocate();
     assert(NULL != new_unwrapped_descriptor_set_base);
 
     brx_pal_vk_descriptor_set *new_unwrapped_descriptor_set = new (new_unwrapped_descriptor_set_base) brx_pal_vk_descriptor_set{};
@@ -2359,15 +3420,217 @@ void brx_pal_vk_device::destroy_descriptor_set(brx_pal_descriptor_set *wrapped_d
     delete_unwrapped_descriptor_set->uninit(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks);
 
     delete_unwrapped_descriptor_set->~brx_pal_vk_descriptor_set();
-    mcrt_free(delete_unwrapped_descriptor_set);
+    this->m_descriptor_set_object_pool.free(delete_unwrapped_descriptor_set);
+}
+
+brx_pal_descriptor_update_template *brx_pal_vk_device::create_descriptor_update_template(brx_pal_descriptor_set_layout const *descriptor_set_layout, uint32_t entry_count, BRX_PAL_DESCRIPTOR_UPDATE_TEMPLATE_ENTRY const *entries) const
+{
+    void *new_unwrapped_descriptor_update_template_base = mcrt_malloc(sizeof(brx_pal_vk_descriptor_update_template), alignof(brx_pal_vk_descriptor_update_template));
+    assert(NULL != new_unwrapped_descriptor_update_template_base);
+
+    brx_pal_vk_descriptor_update_template *new_unwrapped_descriptor_update_template = new (new_unwrapped_descriptor_update_template_base) brx_pal_vk_descriptor_update_template{};
+    new_unwrapped_descriptor_update_template->init(descriptor_set_layout, entry_count, entries, this->m_support_descriptor_update_template, this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks);
+    return new_unwrapped_descriptor_update_template;
+}
+
+void brx_pal_vk_device::destroy_descriptor_update_template(brx_pal_descriptor_update_template *wrapped_descriptor_update_template) const
+{
+    assert(NULL != wrapped_descriptor_update_template);
+    brx_pal_vk_descriptor_update_template *delete_unwrapped_descriptor_update_template = static_cast<brx_pal_vk_descriptor_update_template *>(wrapped_descriptor_update_template);
+
+    delete_unwrapped_descriptor_update_template->uninit(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks);
+
+    delete_unwrapped_descriptor_update_template->~brx_pal_vk_descriptor_update_template();
+    mcrt_free(delete_unwrapped_descriptor_update_template);
+}
+
+void brx_pal_vk_device::write_descriptor_sets_with_template(uint32_t descriptor_set_count, brx_pal_descriptor_set *const *descriptor_sets, brx_pal_descriptor_update_template const *wrapped_descriptor_update_template, void const *const *src_descriptors, uint32_t const *src_dynamic_uniform_buffer_ranges)
+{
+    assert(NULL != wrapped_descriptor_update_template);
+    brx_pal_vk_descriptor_update_template const *const unwrapped_descriptor_update_template = static_cast<brx_pal_vk_descriptor_update_template const *>(wrapped_descriptor_update_template);
+
+    unwrapped_descriptor_update_template->write_descriptor_sets(descriptor_set_count, descriptor_sets, src_descriptors, src_dynamic_uniform_buffer_ranges, this->m_pfn_get_device_proc_addr, this->m_device);
+}
+
+bool brx_pal_vk_device::is_bindless_supported() const
+{
+    return this->m_support_bindless;
+}
+
+void brx_pal_vk_device::get_bindless_descriptor_limits(BRX_PAL_BINDLESS_DESCRIPTOR_LIMITS *bindless_descriptor_limits) const
+{
+    (*bindless_descriptor_limits) = this->m_bindless_descriptor_limits;
+}
+
+brx_pal_descriptor_set_layout *brx_pal_vk_device::create_bindless_descriptor_set_layout(uint32_t read_only_storage_buffer_descriptor_count, uint32_t sampled_image_descriptor_count, uint32_t sampler_descriptor_count) const
+{
+    assert(this->m_support_bindless);
+    assert(read_only_storage_buffer_descriptor_count <= this->m_bindless_descriptor_limits.max_read_only_storage_buffer_descriptor_count);
+    assert(sampled_image_descriptor_count <= this->m_bindless_descriptor_limits.max_sampled_image_descriptor_count);
+    assert(sampler_descriptor_count <= this->m_bindless_descriptor_limits.max_sampler_descriptor_count);
+    assert((static_cast<uint64_t>(read_only_storage_buffer_descriptor_count) + static_cast<uint64_t>(sampled_image_descriptor_count)) <= static_cast<uint64_t>(this->m_bindless_descriptor_limits.max_resource_descriptor_count));
+
+    void *new_unwrapped_descriptor_set_layout_base = mcrt_malloc(sizeof(brx_pal_vk_descriptor_set_layout), alignof(brx_pal_vk_descriptor_set_layout));
+    assert(NULL != new_unwrapped_descriptor_set_layout_base);
+
+    brx_pal_vk_descriptor_set_layout *new_unwrapped_descriptor_set_layout = new (new_unwrapped_descriptor_set_layout_base) brx_pal_vk_descriptor_set_layout{};
+    new_unwrapped_descriptor_set_layout->init_bindless(read_only_storage_buffer_descriptor_count, sampled_image_descriptor_count, sampler_descriptor_count, this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks);
+    return new_unwrapped_descriptor_set_layout;
+}
+
+brx_pal_bindless_descriptor_index_allocator *brx_pal_vk_device::create_bindless_descriptor_index_allocator(uint32_t read_only_storage_buffer_descriptor_count, uint32_t sampled_image_descriptor_count, uint32_t sampler_descriptor_count, uint32_t frame_throttling_count) const
+{
+    void *new_bindless_descriptor_index_allocator_base = mcrt_malloc(sizeof(brx_pal_lock_free_bindless_descriptor_index_allocator), alignof(brx_pal_lock_free_bindless_descriptor_index_allocator));
+    assert(NULL != new_bindless_descriptor_index_allocator_base);
+
+    brx_pal_lock_free_bindless_descriptor_index_allocator *new_bindless_descriptor_index_allocator = new (new_bindless_descriptor_index_allocator_base) brx_pal_lock_free_bindless_descriptor_index_allocator{};
+    new_bindless_descriptor_index_allocator->init(read_only_storage_buffer_descriptor_count, sampled_image_descriptor_count, sampler_descriptor_count, frame_throttling_count);
+    return new_bindless_descriptor_index_allocator;
+}
+
+void brx_pal_vk_device::destroy_bindless_descriptor_index_allocator(brx_pal_bindless_descriptor_index_allocator *wrapped_bindless_descriptor_index_allocator) const
+{
+    assert(NULL != wrapped_bindless_descriptor_index_allocator);
+    brx_pal_lock_free_bindless_descriptor_index_allocator *delete_bindless_descriptor_index_allocator = static_cast<brx_pal_lock_free_bindless_descriptor_index_allocator *>(wrapped_bindless_descriptor_index_allocator);
+
+    delete_bindless_descriptor_index_allocator->uninit();
+
+    delete_bindless_descriptor_index_allocator->~brx_pal_lock_free_bindless_descriptor_index_allocator();
+    mcrt_free(delete_bindless_descriptor_index_allocator);
+}
+
+brx_pal_render_graph *brx_pal_vk_device::create_render_graph(uint32_t frame_throttling_count) const
+{
+    void *new_render_graph_base = mcrt_malloc(sizeof(brx_pal_transient_render_graph), alignof(brx_pal_transient_render_graph));
+    assert(NULL != new_render_graph_base);
+
+    brx_pal_transient_render_graph *new_render_graph = new (new_render_graph_base) brx_pal_transient_render_graph{};
+    new_render_graph->init(this, frame_throttling_count);
+    return new_render_graph;
+}
+
+void brx_pal_vk_device::destroy_render_graph(brx_pal_render_graph *wrapped_render_graph) const
+{
+    assert(NULL != wrapped_render_graph);
+    brx_pal_transient_render_graph *delete_render_graph = static_cast<brx_pal_transient_render_graph *>(wrapped_render_graph);
+
+    delete_render_graph->uninit();
+
+    delete_render_graph->~brx_pal_transient_render_graph();
+    mcrt_free(delete_render_graph);
+}
+
+brx_pal_deferred_destruction_queue *brx_pal_vk_device::create_deferred_destruction_queue(uint32_t frame_throttling_count)
+{
+    void *new_deferred_destruction_queue_base = mcrt_malloc(sizeof(brx_pal_frame_deferred_destruction_queue), alignof(brx_pal_frame_deferred_destruction_queue));
+    assert(NULL != new_deferred_destruction_queue_base);
+
+    brx_pal_frame_deferred_destruction_queue *new_deferred_destruction_queue = new (new_deferred_destruction_queue_base) brx_pal_frame_deferred_destruction_queue{};
+    new_deferred_destruction_queue->init(this, frame_throttling_count);
+    return new_deferred_destruction_queue;
+}
+
+void brx_pal_vk_device::destroy_deferred_destruction_queue(brx_pal_deferred_destruction_queue *wrapped_deferred_destruction_queue)
+{
+    assert(NULL != wrapped_deferred_destruction_queue);
+    brx_pal_frame_deferred_destruction_queue *delete_deferred_destruction_queue = static_cast<brx_pal_frame_deferred_destruction_queue *>(wrapped_deferred_destruction_queue);
+
+    delete_deferred_destruction_queue->uninit();
+
+    delete_deferred_destruction_queue->~brx_pal_frame_deferred_destruction_queue();
+    mcrt_free(delete_deferred_destruction_queue);
+}
+
+brx_pal_acceleration_structure_update_manager *brx_pal_vk_device::create_acceleration_structure_update_manager(BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_POLICY const *policy) const
+{
+    void *new_acceleration_structure_update_manager_base = mcrt_malloc(sizeof(brx_pal_budgeted_acceleration_structure_update_manager), alignof(brx_pal_budgeted_acceleration_structure_update_manager));
+    assert(NULL != new_acceleration_structure_update_manager_base);
+
+    brx_pal_budgeted_acceleration_structure_update_manager *new_acceleration_structure_update_manager = new (new_acceleration_structure_update_manager_base) brx_pal_budgeted_acceleration_structure_update_manager{};
+    new_acceleration_structure_update_manager->init(policy);
+    return new_acceleration_structure_update_manager;
+}
+
+void brx_pal_vk_device::destroy_acceleration_structure_update_manager(brx_pal_acceleration_structure_update_manager *wrapped_acceleration_structure_update_manager) const
+{
+    assert(NULL != wrapped_acceleration_structure_update_manager);
+    brx_pal_budgeted_acceleration_structure_update_manager *delete_acceleration_structure_update_manager = static_cast<brx_pal_budgeted_acceleration_structure_update_manager *>(wrapped_acceleration_structure_update_manager);
+
+    delete_acceleration_structure_update_manager->uninit();
+
+    delete_acceleration_structure_update_manager->~brx_pal_budgeted_acceleration_structure_update_manager();
+    mcrt_free(delete_acceleration_structure_update_manager);
+}
+
+void brx_pal_vk_device::get_object_pool_statistics(BRX_PAL_OBJECT_POOL_TYPE object_pool_type, uint32_t *live_object_count, uint32_t *reserved_object_count) const
+{
+    brx_pal_lock_free_object_pool const *object_pool;
+    switch (object_pool_type)
+    {
+    case BRX_PAL_OBJECT_POOL_TYPE_FENCE:
+        object_pool = &this->m_fence_object_pool;
+        break;
+    case BRX_PAL_OBJECT_POOL_TYPE_DESCRIPTOR_SET:
+        object_pool = &this->m_descriptor_set_object_pool;
+        break;
+    case BRX_PAL_OBJECT_POOL_TYPE_GRAPHICS_PIPELINE:
+        object_pool = &this->m_graphics_pipeline_object_pool;
+        break;
+    case BRX_PAL_OBJECT_POOL_TYPE_COMPUTE_PIPELINE:
+        object_pool = &this->m_compute_pipeline_object_pool;
+        break;
+    case BRX_PAL_OBJECT_POOL_TYPE_UNIFORM_UPLOAD_BUFFER:
+        object_pool = &this->m_uniform_upload_buffer_object_pool;
+        break;
+    case BRX_PAL_OBJECT_POOL_TYPE_STAGING_UPLOAD_BUFFER:
+        object_pool = &this->m_staging_upload_buffer_object_pool;
+        break;
+    case BRX_PAL_OBJECT_POOL_TYPE_STORAGE_INTERMEDIATE_BUFFER:
+        object_pool = &this->m_storage_intermediate_buffer_object_pool;
+        break;
+    case BRX_PAL_OBJECT_POOL_TYPE_COLOR_ATTACHMENT_IMAGE:
+        object_pool = &this->m_color_attachment_image_object_pool;
+        break;
+    case BRX_PAL_OBJECT_POOL_TYPE_DEPTH_STENCIL_ATTACHMENT_IMAGE:
+        object_pool = &this->m_depth_stencil_attachment_image_object_pool;
+        break;
+    case BRX_PAL_OBJECT_POOL_TYPE_STORAGE_IMAGE:
+        object_pool = &this->m_storage_image_object_pool;
+        break;
+    case BRX_PAL_OBJECT_POOL_TYPE_SAMPLED_ASSET_IMAGE:
+        object_pool = &this->m_sampled_asset_image_object_pool;
+        break;
+    default:
+        assert(false);
+        object_pool = NULL;
+    }
+
+    assert(NULL != object_pool);
+    object_pool->get_statistics(live_object_count, reserved_object_count);
+}
+
+void brx_pal_vk_device::get_device_creation_timing(BRX_PAL_DEVICE_CREATION_TIMING *device_creation_timing) const
+{
+    (*device_creation_timing) = this->m_device_creation_timing;
+}
+
+void brx_pal_vk_device::get_subgroup_properties(BRX_PAL_SUBGROUP_PROPERTIES *subgroup_properties) const
+{
+    (*subgroup_properties) = this->m_subgroup_properties;
 }
 
-brx_pal_render_pass *brx_pal_vk_device::create_render_pass(uint32_t color_attachment_count, BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT const *color_attachments, BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT const *depth_stencil_attachment) const
+brx_pal_render_pass *brx_pal_vk_device::create_render_pass(uint32_t color_attachment_count, BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT const *color_attachments, BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT const *depth_stencil_attachment, uint32_t view_count) const
 {
     // NOTE: single subpass is enough
     // input attachment is NOT necessary
     // use VK_ARM_rasterization_order_attachment_access (VK_EXT_rasterization_order_attachment_access) instead
 
+    // all attachments of the same subpass should have the same sample count
+    uint32_t const sample_count = (color_attachment_count > 0U) ? color_attachments[0].sample_count : ((NULL != depth_stencil_attachment) ? depth_stencil_attachment->sample_count : 1U);
+    assert((1U <= sample_count) && (sample_count <= this->m_max_attachment_sample_count));
+
+    assert((1U <= view_count) && (view_count <= this->m_max_multiview_view_count));
+
     VkRenderPass new_render_pass = VK_NULL_HANDLE;
     {
         bool require_subpass_dependency = false;
@@ -2379,14 +3642,21 @@ brx_pal_render_pass *brx_pal_vk_device::create_render_pass(uint32_t color_attach
         assert(color_attachment_count < max_color_attachment_count);
         color_attachment_count = (color_attachment_count < max_color_attachment_count) ? color_attachment_count : max_color_attachment_count;
 
-        VkAttachmentDescription attachments_description[max_color_attachment_count + 1U];
+        // the resolve attachments are placed after the depth stencil attachment
+        uint32_t const resolve_attachment_base_index = color_attachment_count + ((NULL != depth_stencil_attachment) ? 1U : 0U);
+        uint32_t resolve_attachment_count = 0U;
+
+        VkAttachmentDescription attachments_description[max_color_attachment_count + 1U + max_color_attachment_count];
         VkAttachmentReference color_attachments_reference[max_color_attachment_count];
+        VkAttachmentReference resolve_attachments_reference[max_color_attachment_count];
         VkAttachmentReference depth_stencil_attachment_reference;
         assert(NULL != color_attachments || 0U == color_attachment_count);
         for (uint32_t color_attachment_index = 0U; color_attachment_index < color_attachment_count; ++color_attachment_index)
         {
+            assert(sample_count == color_attachments[color_attachment_index].sample_count);
+
             attachments_description[color_attachment_index].flags = 0U;
-            attachments_description[color_attachment_index].samples = VK_SAMPLE_COUNT_1_BIT;
+            attachments_description[color_attachment_index].samples = static_cast<VkSampleCountFlagBits>(sample_count);
             attachments_description[color_attachment_index].stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
             attachments_description[color_attachment_index].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
 
@@ -2455,14 +3725,44 @@ brx_pal_render_pass *brx_pal_vk_device::create_render_pass(uint32_t color_attach
                 attachments_description[color_attachment_index].finalLayout = static_cast<VkImageLayout>(-1);
             }
 
+            if (sample_count > 1U)
+            {
+                if (BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT_STORE_OPERATION_DONT_CARE != color_attachments[color_attachment_index].store_operation)
+                {
+                    // the store operation is applied to the resolve attachment
+                    uint32_t const resolve_attachment_index = resolve_attachment_base_index + resolve_attachment_count;
+                    attachments_description[resolve_attachment_index] = attachments_description[color_attachment_index];
+                    attachments_description[resolve_attachment_index].samples = VK_SAMPLE_COUNT_1_BIT;
+                    attachments_description[resolve_attachment_index].loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+                    attachments_description[resolve_attachment_index].initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+                    ++resolve_attachment_count;
+
+                    resolve_attachments_reference[color_attachment_index].attachment = resolve_attachment_index;
+                    resolve_attachments_reference[color_attachment_index].layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+                    // the multisample content is discarded after resolved
+                    attachments_description[color_attachment_index].storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+                    attachments_description[color_attachment_index].finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+                }
+                else
+                {
+                    resolve_attachments_reference[color_attachment_index].attachment = VK_ATTACHMENT_UNUSED;
+                    resolve_attachments_reference[color_attachment_index].layout = VK_IMAGE_LAYOUT_UNDEFINED;
+                }
+            }
+
             color_attachments_reference[color_attachment_index].attachment = color_attachment_index;
             color_attachments_reference[color_attachment_index].layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
         }
 
         if (NULL != depth_stencil_attachment)
         {
+            // the multisample depth stencil attachment is NOT resolved
+            assert(sample_count == depth_stencil_attachment->sample_count);
+            assert((1U == sample_count) || (BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT_STORE_OPERATION_DONT_CARE == depth_stencil_attachment->store_operation));
+
             attachments_description[color_attachment_count].flags = 0U;
-            attachments_description[color_attachment_count].samples = VK_SAMPLE_COUNT_1_BIT;
+            attachments_description[color_attachment_count].samples = static_cast<VkSampleCountFlagBits>(sample_count);
 
             switch (depth_stencil_attachment->load_operation)
             {
@@ -2537,7 +3837,7 @@ brx_pal_render_pass *brx_pal_vk_device::create_render_pass(uint32_t color_attach
              NULL,
              color_attachment_count,
              (color_attachment_count > 0U) ? color_attachments_reference : NULL,
-             NULL,
+             (resolve_attachment_count > 0U) ? resolve_attachments_reference : NULL,
              (NULL != depth_stencil_attachment) ? &depth_stencil_attachment_reference : NULL,
              0U,
              NULL};
@@ -2553,11 +3853,24 @@ brx_pal_render_pass *brx_pal_vk_device::create_render_pass(uint32_t color_attach
             VK_ACCESS_SHADER_READ_BIT,
             VK_DEPENDENCY_BY_REGION_BIT};
 
+        // the views [0, "view_count") are rendered to the layers with the same index, and the multiview is disabled by the zero view mask
+        uint32_t const view_mask = (1U == view_count) ? 0U : ((1U << view_count) - 1U);
+
+        VkRenderPassMultiviewCreateInfoKHR const render_pass_multiview_create_info = {
+            VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO_KHR,
+            NULL,
+            1U,
+            &view_mask,
+            0U,
+            NULL,
+            0U,
+            NULL};
+
         VkRenderPassCreateInfo render_pass_create_info = {
             VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO,
-            NULL,
+            (0U != view_mask) ? &render_pass_multiview_create_info : NULL,
             0U,
-            color_attachment_count + ((NULL != depth_stencil_attachment) ? 1U : 0U),
+            resolve_attachment_base_index + resolve_attachment_count,
             attachments_description,
             1U,
             &subpass_description,
@@ -2569,58 +3882,257 @@ brx_pal_render_pass *brx_pal_vk_device::create_render_pass(uint32_t color_attach
         assert(VK_SUCCESS == res_create_render_pass);
     }
 
-    void *new_brx_pal_render_pass_base = mcrt_malloc(sizeof(brx_pal_vk_render_pass), alignof(brx_pal_vk_render_pass));
-    assert(NULL != new_brx_pal_render_pass_base);
+    void *new_brx_pal_render_pass_base = mcrt_malloc(sizeof(brx_pal_vk_render_pass), alignof(brx_pal_vk_render_pass));
+    assert(NULL != new_brx_pal_render_pass_base);
+
+    brx_pal_vk_render_pass *new_brx_pal_render_pass = new (new_brx_pal_render_pass_base) brx_pal_vk_render_pass{new_render_pass, color_attachment_count, sample_count};
+    return new_brx_pal_render_pass;
+}
+
+void brx_pal_vk_device::destroy_render_pass(brx_pal_render_pass *brx_pal_render_pass) const
+{
+    assert(NULL != brx_pal_render_pass);
+    brx_pal_vk_render_pass *delete_render_pass = static_cast<brx_pal_vk_render_pass *>(brx_pal_render_pass);
+
+    VkRenderPass stealed_render_pass = VK_NULL_HANDLE;
+    delete_render_pass->steal(&stealed_render_pass);
+
+    delete_render_pass->~brx_pal_vk_render_pass();
+    mcrt_free(delete_render_pass);
+
+    PFN_vkDestroyRenderPass pfn_destroy_render_pass = reinterpret_cast<PFN_vkDestroyRenderPass>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyRenderPass"));
+    assert(NULL != pfn_destroy_render_pass);
+
+    pfn_destroy_render_pass(this->m_device, stealed_render_pass, this->m_allocation_callbacks);
+}
+
+brx_pal_graphics_pipeline *brx_pal_vk_device::create_graphics_pipeline(brx_pal_render_pass const *render_pass, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const
+{
+    return this->create_specialized_graphics_pipeline(render_pass, pipeline_layout, vertex_binding_count, vertex_binding_strides, vertex_attribute_count, vertex_attributes, vertex_shader_module_code_size, vertex_shader_module_code, NULL, fragment_shader_module_code_size, fragment_shader_module_code, NULL, enable_back_face_cull, front_ccw, depth_compare_operation, blend_operation);
+}
+
+brx_pal_graphics_pipeline *brx_pal_vk_device::create_specialized_graphics_pipeline(brx_pal_render_pass const *render_pass, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *vertex_shader_specialization, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *fragment_shader_specialization, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const
+{
+    void *new_unwrapped_graphics_pipeline_base = this->m_graphics_pipeline_object_pool.allocate();
+    assert(NULL != new_unwrapped_graphics_pipeline_base);
+
+    brx_pal_vk_graphics_pipeline *new_unwrapped_graphics_pipeline = new (new_unwrapped_graphics_pipeline_base) brx_pal_vk_graphics_pipeline{};
+    new_unwrapped_graphics_pipeline->init(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks, const_cast<brx_pal_vk_shader_module_cache *>(&this->m_shader_module_cache), render_pass, pipeline_layout, vertex_binding_count, vertex_binding_strides, vertex_attribute_count, vertex_attributes, vertex_shader_module_code_size, vertex_shader_module_code, vertex_shader_specialization, 0U, NULL, 0U, NULL, fragment_shader_module_code_size, fragment_shader_module_code, fragment_shader_specialization, enable_back_face_cull, front_ccw, depth_compare_operation, blend_operation, false);
+    return new_unwrapped_graphics_pipeline;
+}
+
+brx_pal_graphics_pipeline *brx_pal_vk_device::create_dynamic_rendering_graphics_pipeline(uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const
+{
+    return this->create_specialized_dynamic_rendering_graphics_pipeline(color_attachment_count, color_attachment_formats, depth_stencil_attachment_format, sample_count, view_count, pipeline_layout, vertex_binding_count, vertex_binding_strides, vertex_attribute_count, vertex_attributes, vertex_shader_module_code_size, vertex_shader_module_code, NULL, fragment_shader_module_code_size, fragment_shader_module_code, NULL, enable_back_face_cull, front_ccw, depth_compare_operation, blend_operation);
+}
+
+brx_pal_graphics_pipeline *brx_pal_vk_device::create_specialized_dynamic_rendering_graphics_pipeline(uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *vertex_shader_specialization, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *fragment_shader_specialization, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const
+{
+    assert(this->m_support_dynamic_rendering);
+    assert((1U <= sample_count) && (sample_count <= this->m_max_attachment_sample_count));
+    assert((1U <= view_count) && (view_count <= this->m_max_multiview_view_count));
+
+    void *new_unwrapped_graphics_pipeline_base = this->m_graphics_pipeline_object_pool.allocate();
+    assert(NULL != new_unwrapped_graphics_pipeline_base);
+
+    brx_pal_vk_graphics_pipeline *new_unwrapped_graphics_pipeline = new (new_unwrapped_graphics_pipeline_base) brx_pal_vk_graphics_pipeline{};
+    new_unwrapped_graphics_pipeline->init(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks, const_cast<brx_pal_vk_shader_module_cache *>(&this->m_shader_module_cache), color_attachment_count, color_attachment_formats, depth_stencil_attachment_format, sample_count, view_count, pipeline_layout, vertex_binding_count, vertex_binding_strides, vertex_attribute_count, vertex_attributes, vertex_shader_module_code_size, vertex_shader_module_code, vertex_shader_specialization, 0U, NULL, 0U, NULL, fragment_shader_module_code_size, fragment_shader_module_code, fragment_shader_specialization, enable_back_face_cull, front_ccw, depth_compare_operation, blend_operation, false);
+    return new_unwrapped_graphics_pipeline;
+}
+
+bool brx_pal_vk_device::is_extended_dynamic_state_supported() const
+{
+    return this->m_support_extended_dynamic_state;
+}
+
+brx_pal_graphics_pipeline *brx_pal_vk_device::create_extended_dynamic_state_graphics_pipeline(brx_pal_render_pass const *render_pass, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *vertex_shader_specialization, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *fragment_shader_specialization) const
+{
+    assert(this->m_support_extended_dynamic_state);
+
+    void *new_unwrapped_graphics_pipeline_base = this->m_graphics_pipeline_object_pool.allocate();
+    assert(NULL != new_unwrapped_graphics_pipeline_base);
+
+    brx_pal_vk_graphics_pipeline *new_unwrapped_graphics_pipeline = new (new_unwrapped_graphics_pipeline_base) brx_pal_vk_graphics_pipeline{};
+    new_unwrapped_graphics_pipeline->init(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks, const_cast<brx_pal_vk_shader_module_cache *>(&this->m_shader_module_cache), render_pass, pipeline_layout, vertex_binding_count, vertex_binding_strides, vertex_attribute_count, vertex_attributes, vertex_shader_module_code_size, vertex_shader_module_code, vertex_shader_specialization, 0U, NULL, 0U, NULL, fragment_shader_module_code_size, fragment_shader_module_code, fragment_shader_specialization, false, false, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION_DISABLE, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION_DISABLE, true);
+    return new_unwrapped_graphics_pipeline;
+}
+
+brx_pal_graphics_pipeline *brx_pal_vk_device::create_extended_dynamic_state_dynamic_rendering_graphics_pipeline(uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *vertex_shader_specialization, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *fragment_shader_specialization) const
+{
+    assert(this->m_support_dynamic_rendering);
+    assert(this->m_support_extended_dynamic_state);
+    assert((1U <= sample_count) && (sample_count <= this->m_max_attachment_sample_count));
+    assert((1U <= view_count) && (view_count <= this->m_max_multiview_view_count));
+
+    void *new_unwrapped_graphics_pipeline_base = this->m_graphics_pipeline_object_pool.allocate();
+    assert(NULL != new_unwrapped_graphics_pipeline_base);
+
+    brx_pal_vk_graphics_pipeline *new_unwrapped_graphics_pipeline = new (new_unwrapped_graphics_pipeline_base) brx_pal_vk_graphics_pipeline{};
+    new_unwrapped_graphics_pipeline->init(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks, const_cast<brx_pal_vk_shader_module_cache *>(&this->m_shader_module_cache), color_attachment_count, color_attachment_formats, depth_stencil_attachment_format, sample_count, view_count, pipeline_layout, vertex_binding_count, vertex_binding_strides, vertex_attribute_count, vertex_attributes, vertex_shader_module_code_size, vertex_shader_module_code, vertex_shader_specialization, 0U, NULL, 0U, NULL, fragment_shader_module_code_size, fragment_shader_module_code, fragment_shader_specialization, false, false, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION_DISABLE, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION_DISABLE, true);
+    return new_unwrapped_graphics_pipeline;
+}
+
+bool brx_pal_vk_device::is_mesh_shader_supported() const
+{
+    return this->m_support_mesh_shader;
+}
+
+brx_pal_graphics_pipeline *brx_pal_vk_device::create_mesh_shader_graphics_pipeline(brx_pal_render_pass const *render_pass, brx_pal_pipeline_layout const *pipeline_layout, size_t task_shader_module_code_size, void const *task_shader_module_code, size_t mesh_shader_module_code_size, void const *mesh_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const
+{
+    assert(this->m_support_mesh_shader);
+
+    void *new_unwrapped_graphics_pipeline_base = this->m_graphics_pipeline_object_pool.allocate();
+    assert(NULL != new_unwrapped_graphics_pipeline_base);
+
+    brx_pal_vk_graphics_pipeline *new_unwrapped_graphics_pipeline = new (new_unwrapped_graphics_pipeline_base) brx_pal_vk_graphics_pipeline{};
+    new_unwrapped_graphics_pipeline->init(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks, const_cast<brx_pal_vk_shader_module_cache *>(&this->m_shader_module_cache), render_pass, pipeline_layout, 0U, NULL, 0U, NULL, 0U, NULL, NULL, task_shader_module_code_size, task_shader_module_code, mesh_shader_module_code_size, mesh_shader_module_code, fragment_shader_module_code_size, fragment_shader_module_code, NULL, enable_back_face_cull, front_ccw, depth_compare_operation, blend_operation, false);
+    return new_unwrapped_graphics_pipeline;
+}
+
+brx_pal_graphics_pipeline *brx_pal_vk_device::create_mesh_shader_dynamic_rendering_graphics_pipeline(uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, size_t task_shader_module_code_size, void const *task_shader_module_code, size_t mesh_shader_module_code_size, void const *mesh_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const
+{
+    assert(this->m_support_dynamic_rendering);
+    assert(this->m_support_mesh_shader);
+    assert((1U <= sample_count) && (sample_count <= this->m_max_attachment_sample_count));
+    assert(1U == view_count);
+
+    void *new_unwrapped_graphics_pipeline_base = this->m_graphics_pipeline_object_pool.allocate();
+    assert(NULL != new_unwrapped_graphics_pipeline_base);
+
+    brx_pal_vk_graphics_pipeline *new_unwrapped_graphics_pipeline = new (new_unwrapped_graphics_pipeline_base) brx_pal_vk_graphics_pipeline{};
+    new_unwrapped_graphics_pipeline->init(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks, const_cast<brx_pal_vk_shader_module_cache *>(&this->m_shader_module_cache), color_attachment_count, color_attachment_formats, depth_stencil_attachment_format, sample_count, view_count, pipeline_layout, 0U, NULL, 0U, NULL, 0U, NULL, NULL, task_shader_module_code_size, task_shader_module_code, mesh_shader_module_code_size, mesh_shader_module_code, fragment_shader_module_code_size, fragment_shader_module_code, NULL, enable_back_face_cull, front_ccw, depth_compare_operation, blend_operation, false);
+    return new_unwrapped_graphics_pipeline;
+}
+
+void brx_pal_vk_device::destroy_graphics_pipeline(brx_pal_graphics_pipeline *wrapped_graphics_pipeline) const
+{
+    assert(NULL != wrapped_graphics_pipeline);
+    brx_pal_vk_graphics_pipeline *delete_unwrapped_graphics_pipeline = static_cast<brx_pal_vk_graphics_pipeline *>(wrapped_graphics_pipeline);
+
+    delete_unwrapped_graphics_pipeline->uninit(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks, const_cast<brx_pal_vk_shader_module_cache *>(&this->m_shader_module_cache));
+
+    delete_unwrapped_graphics_pipeline->~brx_pal_vk_graphics_pipeline();
+    this->m_graphics_pipeline_object_pool.free(delete_unwrapped_graphics_pipeline);
+}
+
+bool brx_pal_vk_device::is_graphics_pipeline_library_supported() const
+{
+    return this->m_support_graphics_pipeline_library;
+}
+
+brx_pal_graphics_pipeline_pre_rasterization_shader_library *brx_pal_vk_device::create_graphics_pipeline_pre_rasterization_shader_library(uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, bool enable_back_face_cull, bool front_ccw) const
+{
+    assert(this->m_support_dynamic_rendering);
+
+    assert((1U <= view_count) && (view_count <= this->m_max_multiview_view_count));
+
+    void *new_unwrapped_pre_rasterization_shader_library_base = mcrt_malloc(sizeof(brx_pal_vk_graphics_pipeline_pre_rasterization_shader_library), alignof(brx_pal_vk_graphics_pipeline_pre_rasterization_shader_library));
+    assert(NULL != new_unwrapped_pre_rasterization_shader_library_base);
+
+    brx_pal_vk_graphics_pipeline_pre_rasterization_shader_library *new_unwrapped_pre_rasterization_shader_library = new (new_unwrapped_pre_rasterization_shader_library_base) brx_pal_vk_graphics_pipeline_pre_rasterization_shader_library{};
+    new_unwrapped_pre_rasterization_shader_library->init(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks, const_cast<brx_pal_vk_shader_module_cache *>(&this->m_shader_module_cache), this->m_support_graphics_pipeline_library, view_count, pipeline_layout, vertex_shader_module_code_size, vertex_shader_module_code, enable_back_face_cull, front_ccw);
+    return new_unwrapped_pre_rasterization_shader_library;
+}
+
+void brx_pal_vk_device::destroy_graphics_pipeline_pre_rasterization_shader_library(brx_pal_graphics_pipeline_pre_rasterization_shader_library *wrapped_pre_rasterization_shader_library) const
+{
+    assert(NULL != wrapped_pre_rasterization_shader_library);
+    brx_pal_vk_graphics_pipeline_pre_rasterization_shader_library *delete_unwrapped_pre_rasterization_shader_library = static_cast<brx_pal_vk_graphics_pipeline_pre_rasterization_shader_library *>(wrapped_pre_rasterization_shader_library);
+
+    delete_unwrapped_pre_rasterization_shader_library->uninit(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks, const_cast<brx_pal_vk_shader_module_cache *>(&this->m_shader_module_cache));
+
+    delete_unwrapped_pre_rasterization_shader_library->~brx_pal_vk_graphics_pipeline_pre_rasterization_shader_library();
+    mcrt_free(delete_unwrapped_pre_rasterization_shader_library);
+}
+
+brx_pal_graphics_pipeline_fragment_shader_library *brx_pal_vk_device::create_graphics_pipeline_fragment_shader_library(uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation) const
+{
+    assert(this->m_support_dynamic_rendering);
+
+    assert((1U <= view_count) && (view_count <= this->m_max_multiview_view_count));
+
+    void *new_unwrapped_fragment_shader_library_base = mcrt_malloc(sizeof(brx_pal_vk_graphics_pipeline_fragment_shader_library), alignof(brx_pal_vk_graphics_pipeline_fragment_shader_library));
+    assert(NULL != new_unwrapped_fragment_shader_library_base);
+
+    brx_pal_vk_graphics_pipeline_fragment_shader_library *new_unwrapped_fragment_shader_library = new (new_unwrapped_fragment_shader_library_base) brx_pal_vk_graphics_pipeline_fragment_shader_library{};
+    new_unwrapped_fragment_shader_library->init(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks, const_cast<brx_pal_vk_shader_module_cache *>(&this->m_shader_module_cache), this->m_support_graphics_pipeline_library, view_count, pipeline_layout, fragment_shader_module_code_size, fragment_shader_module_code, depth_compare_operation);
+    return new_unwrapped_fragment_shader_library;
+}
+
+void brx_pal_vk_device::destroy_graphics_pipeline_fragment_shader_library(brx_pal_graphics_pipeline_fragment_shader_library *wrapped_fragment_shader_library) const
+{
+    assert(NULL != wrapped_fragment_shader_library);
+    brx_pal_vk_graphics_pipeline_fragment_shader_library *delete_unwrapped_fragment_shader_library = static_cast<brx_pal_vk_graphics_pipeline_fragment_shader_library *>(wrapped_fragment_shader_library);
 
-    brx_pal_vk_render_pass *new_brx_pal_render_pass = new (new_brx_pal_render_pass_base) brx_pal_vk_render_pass{new_render_pass, color_attachment_count};
-    return new_brx_pal_render_pass;
+    delete_unwrapped_fragment_shader_library->uninit(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks, const_cast<brx_pal_vk_shader_module_cache *>(&this->m_shader_module_cache));
+
+    delete_unwrapped_fragment_shader_library->~brx_pal_vk_graphics_pipeline_fragment_shader_library();
+    mcrt_free(delete_unwrapped_fragment_shader_library);
 }
 
-void brx_pal_vk_device::destroy_render_pass(brx_pal_render_pass *brx_pal_render_pass) const
+brx_pal_graphics_pipeline_fragment_output_interface_library *brx_pal_vk_device::create_graphics_pipeline_fragment_output_interface_library(uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const
 {
-    assert(NULL != brx_pal_render_pass);
-    brx_pal_vk_render_pass *delete_render_pass = static_cast<brx_pal_vk_render_pass *>(brx_pal_render_pass);
+    assert(this->m_support_dynamic_rendering);
 
-    VkRenderPass stealed_render_pass = VK_NULL_HANDLE;
-    delete_render_pass->steal(&stealed_render_pass);
+    assert((1U <= view_count) && (view_count <= this->m_max_multiview_view_count));
 
-    delete_render_pass->~brx_pal_vk_render_pass();
-    mcrt_free(delete_render_pass);
+    void *new_unwrapped_fragment_output_interface_library_base = mcrt_malloc(sizeof(brx_pal_vk_graphics_pipeline_fragment_output_interface_library), alignof(brx_pal_vk_graphics_pipeline_fragment_output_interface_library));
+    assert(NULL != new_unwrapped_fragment_output_interface_library_base);
 
-    PFN_vkDestroyRenderPass pfn_destroy_render_pass = reinterpret_cast<PFN_vkDestroyRenderPass>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyRenderPass"));
-    assert(NULL != pfn_destroy_render_pass);
+    brx_pal_vk_graphics_pipeline_fragment_output_interface_library *new_unwrapped_fragment_output_interface_library = new (new_unwrapped_fragment_output_interface_library_base) brx_pal_vk_graphics_pipeline_fragment_output_interface_library{};
+    new_unwrapped_fragment_output_interface_library->init(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks, this->m_support_graphics_pipeline_library, color_attachment_count, color_attachment_formats, depth_stencil_attachment_format, sample_count, view_count, blend_operation);
+    return new_unwrapped_fragment_output_interface_library;
+}
 
-    pfn_destroy_render_pass(this->m_device, stealed_render_pass, this->m_allocation_callbacks);
+void brx_pal_vk_device::destroy_graphics_pipeline_fragment_output_interface_library(brx_pal_graphics_pipeline_fragment_output_interface_library *wrapped_fragment_output_interface_library) const
+{
+    assert(NULL != wrapped_fragment_output_interface_library);
+    brx_pal_vk_graphics_pipeline_fragment_output_interface_library *delete_unwrapped_fragment_output_interface_library = static_cast<brx_pal_vk_graphics_pipeline_fragment_output_interface_library *>(wrapped_fragment_output_interface_library);
+
+    delete_unwrapped_fragment_output_interface_library->uninit(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks);
+
+    delete_unwrapped_fragment_output_interface_library->~brx_pal_vk_graphics_pipeline_fragment_output_interface_library();
+    mcrt_free(delete_unwrapped_fragment_output_interface_library);
 }
 
-brx_pal_graphics_pipeline *brx_pal_vk_device::create_graphics_pipeline(brx_pal_render_pass const *render_pass, brx_pal_pipeline_layout const *pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const
+brx_pal_graphics_pipeline *brx_pal_vk_device::create_linked_graphics_pipeline(brx_pal_pipeline_layout const *pipeline_layout, brx_pal_graphics_pipeline_pre_rasterization_shader_library const *pre_rasterization_shader_library, brx_pal_graphics_pipeline_fragment_shader_library const *fragment_shader_library, brx_pal_graphics_pipeline_fragment_output_interface_library const *fragment_output_interface_library, bool link_time_optimization) const
 {
-    void *new_unwrapped_graphics_pipeline_base = mcrt_malloc(sizeof(brx_pal_vk_graphics_pipeline), alignof(brx_pal_vk_graphics_pipeline));
+    assert(this->m_support_dynamic_rendering);
+
+    void *new_unwrapped_graphics_pipeline_base = this->m_graphics_pipeline_object_pool.allocate();
     assert(NULL != new_unwrapped_graphics_pipeline_base);
 
+    // the vertex input interface library is NULL when the VK_EXT_graphics_pipeline_library is NOT supported, and the monolithic graphics pipeline is created instead
     brx_pal_vk_graphics_pipeline *new_unwrapped_graphics_pipeline = new (new_unwrapped_graphics_pipeline_base) brx_pal_vk_graphics_pipeline{};
-    new_unwrapped_graphics_pipeline->init(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks, render_pass, pipeline_layout, vertex_shader_module_code_size, vertex_shader_module_code, fragment_shader_module_code_size, fragment_shader_module_code, enable_back_face_cull, front_ccw, depth_compare_operation, blend_operation);
+    new_unwrapped_graphics_pipeline->init(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks, const_cast<brx_pal_vk_shader_module_cache *>(&this->m_shader_module_cache), this->m_graphics_pipeline_vertex_input_interface_library, pipeline_layout, pre_rasterization_shader_library, fragment_shader_library, fragment_output_interface_library, link_time_optimization);
     return new_unwrapped_graphics_pipeline;
 }
 
-void brx_pal_vk_device::destroy_graphics_pipeline(brx_pal_graphics_pipeline *wrapped_graphics_pipeline) const
+brx_pal_compute_pipeline *brx_pal_vk_device::create_compute_pipeline(brx_pal_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code) const
 {
-    assert(NULL != wrapped_graphics_pipeline);
-    brx_pal_vk_graphics_pipeline *delete_unwrapped_graphics_pipeline = static_cast<brx_pal_vk_graphics_pipeline *>(wrapped_graphics_pipeline);
+    return this->create_specialized_compute_pipeline(pipeline_layout, compute_shader_module_code_size, compute_shader_module_code, NULL);
+}
 
-    delete_unwrapped_graphics_pipeline->uninit(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks);
+brx_pal_compute_pipeline *brx_pal_vk_device::create_specialized_compute_pipeline(brx_pal_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *compute_shader_specialization) const
+{
+    void *new_unwrapped_compute_pipeline_base = this->m_compute_pipeline_object_pool.allocate();
+    assert(NULL != new_unwrapped_compute_pipeline_base);
 
-    delete_unwrapped_graphics_pipeline->~brx_pal_vk_graphics_pipeline();
-    mcrt_free(delete_unwrapped_graphics_pipeline);
+    brx_pal_vk_compute_pipeline *new_unwrapped_compute_pipeline = new (new_unwrapped_compute_pipeline_base) brx_pal_vk_compute_pipeline{};
+    new_unwrapped_compute_pipeline->init(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks, const_cast<brx_pal_vk_shader_module_cache *>(&this->m_shader_module_cache), pipeline_layout, compute_shader_module_code_size, compute_shader_module_code, compute_shader_specialization, 0U, false);
+    return new_unwrapped_compute_pipeline;
 }
 
-brx_pal_compute_pipeline *brx_pal_vk_device::create_compute_pipeline(brx_pal_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code) const
+brx_pal_compute_pipeline *brx_pal_vk_device::create_subgroup_size_control_compute_pipeline(brx_pal_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *compute_shader_specialization, uint32_t required_subgroup_size, bool require_full_subgroups) const
 {
-    void *new_unwrapped_compute_pipeline_base = mcrt_malloc(sizeof(brx_pal_vk_compute_pipeline), alignof(brx_pal_vk_compute_pipeline));
+    assert(this->m_subgroup_properties.support_subgroup_size_control);
+    assert((0U == required_subgroup_size) || ((this->m_subgroup_properties.min_subgroup_size <= required_subgroup_size) && (required_subgroup_size <= this->m_subgroup_properties.max_subgroup_size) && (0U == (required_subgroup_size & (required_subgroup_size - 1U)))));
+
+    void *new_unwrapped_compute_pipeline_base = this->m_compute_pipeline_object_pool.allocate();
     assert(NULL != new_unwrapped_compute_pipeline_base);
 
     brx_pal_vk_compute_pipeline *new_unwrapped_compute_pipeline = new (new_unwrapped_compute_pipeline_base) brx_pal_vk_compute_pipeline{};
-    new_unwrapped_compute_pipeline->init(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks, pipeline_layout, compute_shader_module_code_size, compute_shader_module_code);
+    new_unwrapped_compute_pipeline->init(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks, const_cast<brx_pal_vk_shader_module_cache *>(&this->m_shader_module_cache), pipeline_layout, compute_shader_module_code_size, compute_shader_module_code, compute_shader_specialization, required_subgroup_size, require_full_subgroups);
     return new_unwrapped_compute_pipeline;
 }
 
@@ -2629,16 +4141,17 @@ void brx_pal_vk_device::destroy_compute_pipeline(brx_pal_compute_pipeline *wrapp
     assert(NULL != wrapped_compute_pipeline);
     brx_pal_vk_compute_pipeline *delete_unwrapped_compute_pipeline = static_cast<brx_pal_vk_compute_pipeline *>(wrapped_compute_pipeline);
 
-    delete_unwrapped_compute_pipeline->uninit(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks);
+    delete_unwrapped_compute_pipeline->uninit(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks, const_cast<brx_pal_vk_shader_module_cache *>(&this->m_shader_module_cache));
 
     delete_unwrapped_compute_pipeline->~brx_pal_vk_compute_pipeline();
-    mcrt_free(delete_unwrapped_compute_pipeline);
+    this->m_compute_pipeline_object_pool.free(delete_unwrapped_compute_pipeline);
 }
 
-brx_pal_frame_buffer *brx_pal_vk_device::create_frame_buffer(brx_pal_render_pass const *brx_pal_render_pass, uint32_t width, uint32_t height, uint32_t color_attachment_count, brx_pal_color_attachment_image const *const *color_attachments, brx_pal_depth_stencil_attachment_image const *depth_stencil_attachment) const
+brx_pal_frame_buffer *brx_pal_vk_device::create_frame_buffer(brx_pal_render_pass const *brx_pal_render_pass, uint32_t width, uint32_t height, uint32_t color_attachment_count, brx_pal_color_attachment_image const *const *color_attachments, brx_pal_color_attachment_image const *const *color_resolve_attachments, brx_pal_depth_stencil_attachment_image const *depth_stencil_attachment) const
 {
     assert(NULL != brx_pal_render_pass);
     VkRenderPass render_pass = static_cast<brx_pal_vk_render_pass const *>(brx_pal_render_pass)->get_render_pass();
+    assert((NULL == color_resolve_attachments) || (static_cast<brx_pal_vk_render_pass const *>(brx_pal_render_pass)->get_sample_count() > 1U));
 
     VkFramebuffer new_frame_buffer = VK_NULL_HANDLE;
     {
@@ -2648,7 +4161,7 @@ brx_pal_frame_buffer *brx_pal_vk_device::create_frame_buffer(brx_pal_render_pass
         assert(color_attachment_count < max_color_attachment_count);
         color_attachment_count = (color_attachment_count < max_color_attachment_count) ? color_attachment_count : max_color_attachment_count;
 
-        VkImageView attachments[max_color_attachment_count + 1U];
+        VkImageView attachments[max_color_attachment_count + 1U + max_color_attachment_count];
         for (uint32_t color_attachment_index = 0U; color_attachment_index < color_attachment_count; ++color_attachment_index)
         {
             assert(NULL != color_attachments[color_attachment_index]);
@@ -2662,6 +4175,19 @@ brx_pal_frame_buffer *brx_pal_vk_device::create_frame_buffer(brx_pal_render_pass
 
         uint32_t attachment_count = color_attachment_count + ((NULL != depth_stencil_attachment) ? 1U : 0U);
 
+        // the resolve attachments are placed after the depth stencil attachment (the same as the render pass)
+        if (NULL != color_resolve_attachments)
+        {
+            for (uint32_t color_attachment_index = 0U; color_attachment_index < color_attachment_count; ++color_attachment_index)
+            {
+                if (NULL != color_resolve_attachments[color_attachment_index])
+                {
+                    attachments[attachment_count] = static_cast<brx_pal_vk_color_attachment_image const *>(color_resolve_attachments[color_attachment_index])->get_image_view();
+                    ++attachment_count;
+                }
+            }
+        }
+
         VkFramebufferCreateInfo frame_buffer_create_info = {
             VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO,
             NULL,
@@ -2708,11 +4234,11 @@ uint32_t brx_pal_vk_device::get_uniform_upload_buffer_offset_alignment() const
 
 brx_pal_uniform_upload_buffer *brx_pal_vk_device::create_uniform_upload_buffer(uint32_t size) const
 {
-    void *new_unwrapped_uniform_upload_buffer_base = mcrt_malloc(sizeof(brx_pal_vk_uniform_upload_buffer), alignof(brx_pal_vk_uniform_upload_buffer));
+    void *new_unwrapped_uniform_upload_buffer_base = this->m_uniform_upload_buffer_object_pool.allocate();
     assert(NULL != new_unwrapped_uniform_upload_buffer_base);
 
     brx_pal_vk_uniform_upload_buffer *new_unwrapped_uniform_upload_buffer = new (new_unwrapped_uniform_upload_buffer_base) brx_pal_vk_uniform_upload_buffer{};
-    new_unwrapped_uniform_upload_buffer->init(this->m_memory_allocator, this->m_uniform_upload_buffer_memory_pool, size);
+    new_unwrapped_uniform_upload_buffer->init(this->m_memory_allocator, this->get_uniform_upload_buffer_memory_pool(), size);
     return new_unwrapped_uniform_upload_buffer;
 }
 
@@ -2724,7 +4250,7 @@ void brx_pal_vk_device::destroy_uniform_upload_buffer(brx_pal_uniform_upload_buf
     delete_unwrapped_uniform_upload_buffer->uninit(this->m_memory_allocator);
 
     delete_unwrapped_uniform_upload_buffer->~brx_pal_vk_uniform_upload_buffer();
-    mcrt_free(delete_unwrapped_uniform_upload_buffer);
+    this->m_uniform_upload_buffer_object_pool.free(delete_unwrapped_uniform_upload_buffer);
 }
 
 uint32_t brx_pal_vk_device::get_staging_upload_buffer_offset_alignment() const
@@ -2739,11 +4265,11 @@ uint32_t brx_pal_vk_device::get_staging_upload_buffer_row_pitch_alignment() cons
 
 brx_pal_staging_upload_buffer *brx_pal_vk_device::create_staging_upload_buffer(uint32_t size) const
 {
-    void *new_unwrapped_staging_upload_buffer_base = mcrt_malloc(sizeof(brx_pal_vk_staging_upload_buffer), alignof(brx_pal_vk_staging_upload_buffer));
+    void *new_unwrapped_staging_upload_buffer_base = this->m_staging_upload_buffer_object_pool.allocate();
     assert(NULL != new_unwrapped_staging_upload_buffer_base);
 
     brx_pal_vk_staging_upload_buffer *new_unwrapped_staging_upload_buffer = new (new_unwrapped_staging_upload_buffer_base) brx_pal_vk_staging_upload_buffer{};
-    new_unwrapped_staging_upload_buffer->init(this->m_memory_allocator, this->m_staging_upload_buffer_memory_pool, size);
+    new_unwrapped_staging_upload_buffer->init(this->m_memory_allocator, this->get_staging_upload_buffer_memory_pool(), size);
     return new_unwrapped_staging_upload_buffer;
 }
 
@@ -2755,16 +4281,16 @@ void brx_pal_vk_device::destroy_staging_upload_buffer(brx_pal_staging_upload_buf
     delete_unwrapped_staging_upload_buffer->uninit(this->m_memory_allocator);
 
     delete_unwrapped_staging_upload_buffer->~brx_pal_vk_staging_upload_buffer();
-    mcrt_free(delete_unwrapped_staging_upload_buffer);
+    this->m_staging_upload_buffer_object_pool.free(delete_unwrapped_staging_upload_buffer);
 }
 
 brx_pal_storage_intermediate_buffer *brx_pal_vk_device::create_storage_intermediate_buffer(uint32_t size) const
 {
-    void *new_unwrapped_storage_intermediate_buffer_base = mcrt_malloc(sizeof(brx_pal_vk_storage_intermediate_buffer), alignof(brx_pal_vk_storage_intermediate_buffer));
+    void *new_unwrapped_storage_intermediate_buffer_base = this->m_storage_intermediate_buffer_object_pool.allocate();
     assert(NULL != new_unwrapped_storage_intermediate_buffer_base);
 
     brx_pal_vk_storage_intermediate_buffer *new_unwrapped_storage_intermediate_buffer = new (new_unwrapped_storage_intermediate_buffer_base) brx_pal_vk_storage_intermediate_buffer{};
-    new_unwrapped_storage_intermediate_buffer->init(this->m_support_ray_tracing, this->m_device, this->m_pfn_get_buffer_device_address, this->m_memory_allocator, this->m_storage_intermediate_buffer_memory_pool, size);
+    new_unwrapped_storage_intermediate_buffer->init(this->m_support_ray_tracing, this->m_device, this->m_pfn_get_buffer_device_address, this->m_memory_allocator, this->get_storage_intermediate_buffer_memory_pool(), VK_NULL_HANDLE, 0U, size);
     return new_unwrapped_storage_intermediate_buffer;
 }
 
@@ -2776,7 +4302,7 @@ void brx_pal_vk_device::destroy_storage_intermediate_buffer(brx_pal_storage_inte
     delete_wrapped_storage_intermediate_buffer->uninit(this->m_memory_allocator);
 
     delete_wrapped_storage_intermediate_buffer->~brx_pal_vk_storage_intermediate_buffer();
-    mcrt_free(delete_wrapped_storage_intermediate_buffer);
+    this->m_storage_intermediate_buffer_object_pool.free(delete_wrapped_storage_intermediate_buffer);
 }
 
 brx_pal_storage_asset_buffer *brx_pal_vk_device::create_storage_asset_buffer(uint32_t size) const
@@ -2785,7 +4311,7 @@ brx_pal_storage_asset_buffer *brx_pal_vk_device::create_storage_asset_buffer(uin
     assert(NULL != new_unwrapped_storage_asset_buffer_base);
 
     brx_pal_vk_storage_asset_buffer *new_unwrapped_storage_asset_buffer = new (new_unwrapped_storage_asset_buffer_base) brx_pal_vk_storage_asset_buffer{};
-    new_unwrapped_storage_asset_buffer->init(this->m_support_ray_tracing, this->m_device, this->m_pfn_get_buffer_device_address, this->m_memory_allocator, this->m_storage_asset_buffer_memory_pool, size);
+    new_unwrapped_storage_asset_buffer->init(this->m_support_ray_tracing, this->m_device, this->m_pfn_get_buffer_device_address, this->m_memory_allocator, this->get_storage_asset_buffer_memory_pool(), size);
     return new_unwrapped_storage_asset_buffer;
 }
 
@@ -2802,11 +4328,11 @@ void brx_pal_vk_device::destroy_storage_asset_buffer(brx_pal_storage_asset_buffe
 
 brx_pal_color_attachment_image *brx_pal_vk_device::create_color_attachment_image(BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT wrapped_color_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image) const
 {
-    void *new_unwrapped_color_attachment_image_base = mcrt_malloc(sizeof(brx_pal_vk_color_attachment_intermediate_image), alignof(brx_pal_vk_color_attachment_intermediate_image));
+    void *new_unwrapped_color_attachment_image_base = this->m_color_attachment_image_object_pool.allocate();
     assert(NULL != new_unwrapped_color_attachment_image_base);
 
     brx_pal_vk_color_attachment_intermediate_image *new_unwrapped_color_attachment_image = new (new_unwrapped_color_attachment_image_base) brx_pal_vk_color_attachment_intermediate_image{};
-    new_unwrapped_color_attachment_image->init(this->m_device, this->m_pfn_create_image_view, this->m_allocation_callbacks, this->m_memory_allocator, this->m_color_transient_attachment_image_memory_pool, this->m_color_attachment_sampled_image_memory_pool, wrapped_color_attachment_image_format, width, height, allow_sampled_image);
+    new_unwrapped_color_attachment_image->init(this->m_device, this->m_pfn_create_image_view, this->m_allocation_callbacks, this->m_memory_allocator, this->get_color_attachment_image_memory_pool(allow_sampled_image), VK_NULL_HANDLE, 0U, wrapped_color_attachment_image_format, width, height, 1U, 1U, allow_sampled_image);
     return new_unwrapped_color_attachment_image;
 }
 
@@ -2818,7 +4344,7 @@ void brx_pal_vk_device::destroy_color_attachment_image(brx_pal_color_attachment_
     delete_unwrapped_color_attachment_image->uninit(this->m_device, this->m_pfn_destroy_image_view, this->m_allocation_callbacks, this->m_memory_allocator);
 
     delete_unwrapped_color_attachment_image->~brx_pal_vk_color_attachment_intermediate_image();
-    mcrt_free(delete_unwrapped_color_attachment_image);
+    this->m_color_attachment_image_object_pool.free(delete_unwrapped_color_attachment_image);
 }
 
 BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT brx_pal_vk_device::get_depth_attachment_image_format() const
@@ -2863,11 +4389,11 @@ BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT brx_pal_vk_device::get_depth_stenc
 
 brx_pal_depth_stencil_attachment_image *brx_pal_vk_device::create_depth_stencil_attachment_image(BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT wrapped_depth_stencil_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image) const
 {
-    void *new_unwrapped_depth_stencil_attachment_image_base = mcrt_malloc(sizeof(brx_pal_vk_depth_stencil_attachment_intermediate_image), alignof(brx_pal_vk_depth_stencil_attachment_intermediate_image));
+    void *new_unwrapped_depth_stencil_attachment_image_base = this->m_depth_stencil_attachment_image_object_pool.allocate();
     assert(NULL != new_unwrapped_depth_stencil_attachment_image_base);
 
     brx_pal_vk_depth_stencil_attachment_intermediate_image *new_unwrapped_depth_stencil_attachment_image = new (new_unwrapped_depth_stencil_attachment_image_base) brx_pal_vk_depth_stencil_attachment_intermediate_image{};
-    new_unwrapped_depth_stencil_attachment_image->init(this->m_device, this->m_pfn_create_image_view, this->m_allocation_callbacks, this->m_memory_allocator, this->m_depth_transient_attachment_image_memory_pool, this->m_depth_attachment_sampled_image_memory_pool, this->m_depth_stencil_transient_attachment_image_memory_pool, this->m_depth_stencil_attachment_sampled_image_memory_pool, wrapped_depth_stencil_attachment_image_format, width, height, allow_sampled_image);
+    new_unwrapped_depth_stencil_attachment_image->init(this->m_device, this->m_pfn_create_image_view, this->m_allocation_callbacks, this->m_memory_allocator, this->get_depth_stencil_attachment_image_memory_pool(wrapped_depth_stencil_attachment_image_format, allow_sampled_image), VK_NULL_HANDLE, 0U, wrapped_depth_stencil_attachment_image_format, width, height, 1U, 1U, allow_sampled_image);
     return new_unwrapped_depth_stencil_attachment_image;
 }
 
@@ -2879,45 +4405,227 @@ void brx_pal_vk_device::destroy_depth_stencil_attachment_image(brx_pal_depth_ste
     delete_unwrapped_depth_stencil_attachment_image->uninit(this->m_device, this->m_pfn_destroy_image_view, this->m_allocation_callbacks, this->m_memory_allocator);
 
     delete_unwrapped_depth_stencil_attachment_image->~brx_pal_vk_depth_stencil_attachment_intermediate_image();
-    mcrt_free(delete_unwrapped_depth_stencil_attachment_image);
+    this->m_depth_stencil_attachment_image_object_pool.free(delete_unwrapped_depth_stencil_attachment_image);
+}
+
+uint32_t brx_pal_vk_device::get_max_attachment_sample_count() const
+{
+    return this->m_max_attachment_sample_count;
+}
+
+brx_pal_color_attachment_image *brx_pal_vk_device::create_multisample_color_attachment_image(BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT wrapped_color_attachment_image_format, uint32_t width, uint32_t height, uint32_t sample_count) const
+{
+    assert((1U <= sample_count) && (sample_count <= this->m_max_attachment_sample_count));
+
+    void *new_unwrapped_color_attachment_image_base = this->m_color_attachment_image_object_pool.allocate();
+    assert(NULL != new_unwrapped_color_attachment_image_base);
+
+    // the multisample image is always transient (resolved in the render pass)
+    brx_pal_vk_color_attachment_intermediate_image *new_unwrapped_color_attachment_image = new (new_unwrapped_color_attachment_image_base) brx_pal_vk_color_attachment_intermediate_image{};
+    new_unwrapped_color_attachment_image->init(this->m_device, this->m_pfn_create_image_view, this->m_allocation_callbacks, this->m_memory_allocator, this->get_color_attachment_image_memory_pool(false), VK_NULL_HANDLE, 0U, wrapped_color_attachment_image_format, width, height, 1U, sample_count, false);
+    return new_unwrapped_color_attachment_image;
+}
+
+brx_pal_depth_stencil_attachment_image *brx_pal_vk_device::create_multisample_depth_stencil_attachment_image(BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT wrapped_depth_stencil_attachment_image_format, uint32_t width, uint32_t height, uint32_t sample_count) const
+{
+    assert((1U <= sample_count) && (sample_count <= this->m_max_attachment_sample_count));
+
+    void *new_unwrapped_depth_stencil_attachment_image_base = this->m_depth_stencil_attachment_image_object_pool.allocate();
+    assert(NULL != new_unwrapped_depth_stencil_attachment_image_base);
+
+    // the multisample image is always transient (NOT resolved)
+    brx_pal_vk_depth_stencil_attachment_intermediate_image *new_unwrapped_depth_stencil_attachment_image = new (new_unwrapped_depth_stencil_attachment_image_base) brx_pal_vk_depth_stencil_attachment_intermediate_image{};
+    new_unwrapped_depth_stencil_attachment_image->init(this->m_device, this->m_pfn_create_image_view, this->m_allocation_callbacks, this->m_memory_allocator, this->get_depth_stencil_attachment_image_memory_pool(wrapped_depth_stencil_attachment_image_format, false), VK_NULL_HANDLE, 0U, wrapped_depth_stencil_attachment_image_format, width, height, 1U, sample_count, false);
+    return new_unwrapped_depth_stencil_attachment_image;
+}
+
+uint32_t brx_pal_vk_device::get_max_multiview_view_count() const
+{
+    return this->m_max_multiview_view_count;
+}
+
+brx_pal_color_attachment_image *brx_pal_vk_device::create_layered_color_attachment_image(BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT wrapped_color_attachment_image_format, uint32_t width, uint32_t height, uint32_t layer_count, bool allow_sampled_image) const
+{
+    assert(1U <= layer_count);
+
+    void *new_unwrapped_color_attachment_image_base = this->m_color_attachment_image_object_pool.allocate();
+    assert(NULL != new_unwrapped_color_attachment_image_base);
+
+    brx_pal_vk_color_attachment_intermediate_image *new_unwrapped_color_attachment_image = new (new_unwrapped_color_attachment_image_base) brx_pal_vk_color_attachment_intermediate_image{};
+    new_unwrapped_color_attachment_image->init(this->m_device, this->m_pfn_create_image_view, this->m_allocation_callbacks, this->m_memory_allocator, this->get_color_attachment_image_memory_pool(allow_sampled_image), VK_NULL_HANDLE, 0U, wrapped_color_attachment_image_format, width, height, layer_count, 1U, allow_sampled_image);
+    return new_unwrapped_color_attachment_image;
+}
+
+brx_pal_depth_stencil_attachment_image *brx_pal_vk_device::create_layered_depth_stencil_attachment_image(BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT wrapped_depth_stencil_attachment_image_format, uint32_t width, uint32_t height, uint32_t layer_count, bool allow_sampled_image) const
+{
+    assert(1U <= layer_count);
+
+    void *new_unwrapped_depth_stencil_attachment_image_base = this->m_depth_stencil_attachment_image_object_pool.allocate();
+    assert(NULL != new_unwrapped_depth_stencil_attachment_image_base);
+
+    brx_pal_vk_depth_stencil_attachment_intermediate_image *new_unwrapped_depth_stencil_attachment_image = new (new_unwrapped_depth_stencil_attachment_image_base) brx_pal_vk_depth_stencil_attachment_intermediate_image{};
+    new_unwrapped_depth_stencil_attachment_image->init(this->m_device, this->m_pfn_create_image_view, this->m_allocation_callbacks, this->m_memory_allocator, this->get_depth_stencil_attachment_image_memory_pool(wrapped_depth_stencil_attachment_image_format, allow_sampled_image), VK_NULL_HANDLE, 0U, wrapped_depth_stencil_attachment_image_format, width, height, layer_count, 1U, allow_sampled_image);
+    return new_unwrapped_depth_stencil_attachment_image;
 }
 
 brx_pal_storage_image *brx_pal_vk_device::create_storage_image(BRX_PAL_STORAGE_IMAGE_FORMAT wrapped_storage_image_format, uint32_t width, uint32_t height, bool allow_sampled_image) const
 {
-    VkFormat unwrapped_storage_image_format;
-    switch (wrapped_storage_image_format)
+    void *new_unwrapped_storage_image_base = this->m_storage_image_object_pool.allocate();
+    assert(NULL != new_unwrapped_storage_image_base);
+
+    brx_pal_vk_storage_intermediate_image *new_unwrapped_storage_image = new (new_unwrapped_storage_image_base) brx_pal_vk_storage_intermediate_image{};
+    new_unwrapped_storage_image->init(this->m_device, this->m_pfn_create_image_view, this->m_allocation_callbacks, this->m_memory_allocator, this->get_storage_intermediate_image_memory_pool(), VK_NULL_HANDLE, 0U, _internal_unwrap_storage_image_format(wrapped_storage_image_format), width, height, allow_sampled_image);
+    return new_unwrapped_storage_image;
+}
+
+void brx_pal_vk_device::destroy_storage_image(brx_pal_storage_image *wrapped_storage_image) const
+{
+    assert(NULL != wrapped_storage_image);
+    brx_pal_vk_storage_intermediate_image *delete_unwrapped_storage_image = static_cast<brx_pal_vk_storage_intermediate_image *>(wrapped_storage_image);
+
+    delete_unwrapped_storage_image->uninit(this->m_device, this->m_pfn_destroy_image_view, this->m_allocation_callbacks, this->m_memory_allocator);
+
+    delete_unwrapped_storage_image->~brx_pal_vk_storage_intermediate_image();
+    this->m_storage_image_object_pool.free(delete_unwrapped_storage_image);
+}
+
+brx_pal_memory_heap *brx_pal_vk_device::create_memory_heap(BRX_PAL_MEMORY_HEAP_TYPE memory_heap_type, uint32_t size) const
+{
+    // the depth stencil attachment images are assumed to be compatible with the memory pool of the color attachment images (the "memoryTypeBits" of the render targets are the same on all known implementations)
+    VmaPool memory_pool;
+    switch (memory_heap_type)
     {
-    case BRX_PAL_STORAGE_IMAGE_FORMAT_R16_SFLOAT:
-        unwrapped_storage_image_format = VK_FORMAT_R16_SFLOAT;
+    case BRX_PAL_MEMORY_HEAP_TYPE_ATTACHMENT_IMAGE:
+        memory_pool = this->get_color_attachment_sampled_image_memory_pool();
         break;
-    case BRX_PAL_STORAGE_IMAGE_FORMAT_R16G16B16A16_SFLOAT:
-        unwrapped_storage_image_format = VK_FORMAT_R16G16B16A16_SFLOAT;
+    case BRX_PAL_MEMORY_HEAP_TYPE_STORAGE_IMAGE:
+        memory_pool = this->get_storage_intermediate_image_memory_pool();
         break;
-    case BRX_PAL_STORAGE_IMAGE_FORMAT_R32_UINT:
-        unwrapped_storage_image_format = VK_FORMAT_R32_UINT;
+    case BRX_PAL_MEMORY_HEAP_TYPE_STORAGE_BUFFER:
+        memory_pool = this->get_storage_intermediate_buffer_memory_pool();
         break;
     default:
         assert(false);
-        unwrapped_storage_image_format = VK_FORMAT_UNDEFINED;
+        memory_pool = VK_NULL_HANDLE;
     }
 
-    void *new_unwrapped_storage_image_base = mcrt_malloc(sizeof(brx_pal_vk_storage_intermediate_image), alignof(brx_pal_vk_storage_intermediate_image));
+    void *new_unwrapped_memory_heap_base = mcrt_malloc(sizeof(brx_pal_vk_memory_heap), alignof(brx_pal_vk_memory_heap));
+    assert(NULL != new_unwrapped_memory_heap_base);
+
+    brx_pal_vk_memory_heap *new_unwrapped_memory_heap = new (new_unwrapped_memory_heap_base) brx_pal_vk_memory_heap{};
+    new_unwrapped_memory_heap->init(this->m_memory_allocator, memory_pool, memory_heap_type, size);
+    return new_unwrapped_memory_heap;
+}
+
+void brx_pal_vk_device::destroy_memory_heap(brx_pal_memory_heap *wrapped_memory_heap) const
+{
+    assert(NULL != wrapped_memory_heap);
+    brx_pal_vk_memory_heap *delete_unwrapped_memory_heap = static_cast<brx_pal_vk_memory_heap *>(wrapped_memory_heap);
+
+    delete_unwrapped_memory_heap->uninit(this->m_memory_allocator);
+
+    delete_unwrapped_memory_heap->~brx_pal_vk_memory_heap();
+    mcrt_free(delete_unwrapped_memory_heap);
+}
+
+void brx_pal_vk_device::get_color_attachment_image_memory_requirements(BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT wrapped_color_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image, uint32_t *size, uint32_t *alignment) const
+{
+    VkMemoryRequirements memory_requirements;
+    brx_pal_vk_color_attachment_intermediate_image::get_memory_requirements(this->m_device, this->m_pfn_create_image, this->m_pfn_get_image_memory_requirements, this->m_pfn_destroy_image, this->m_allocation_callbacks, wrapped_color_attachment_image_format, width, height, allow_sampled_image, &memory_requirements);
+
+    assert(memory_requirements.size <= static_cast<VkDeviceSize>(UINT32_MAX));
+    (*size) = static_cast<uint32_t>(memory_requirements.size);
+    (*alignment) = static_cast<uint32_t>(memory_requirements.alignment);
+}
+
+void brx_pal_vk_device::get_depth_stencil_attachment_image_memory_requirements(BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT wrapped_depth_stencil_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image, uint32_t *size, uint32_t *alignment) const
+{
+    VkMemoryRequirements memory_requirements;
+    brx_pal_vk_depth_stencil_attachment_intermediate_image::get_memory_requirements(this->m_device, this->m_pfn_create_image, this->m_pfn_get_image_memory_requirements, this->m_pfn_destroy_image, this->m_allocation_callbacks, wrapped_depth_stencil_attachment_image_format, width, height, allow_sampled_image, &memory_requirements);
+
+    assert(memory_requirements.size <= static_cast<VkDeviceSize>(UINT32_MAX));
+    (*size) = static_cast<uint32_t>(memory_requirements.size);
+    (*alignment) = static_cast<uint32_t>(memory_requirements.alignment);
+}
+
+void brx_pal_vk_device::get_storage_image_memory_requirements(BRX_PAL_STORAGE_IMAGE_FORMAT wrapped_storage_image_format, uint32_t width, uint32_t height, bool allow_sampled_image, uint32_t *size, uint32_t *alignment) const
+{
+    VkMemoryRequirements memory_requirements;
+    brx_pal_vk_storage_intermediate_image::get_memory_requirements(this->m_device, this->m_pfn_create_image, this->m_pfn_get_image_memory_requirements, this->m_pfn_destroy_image, this->m_allocation_callbacks, _internal_unwrap_storage_image_format(wrapped_storage_image_format), width, height, allow_sampled_image, &memory_requirements);
+
+    assert(memory_requirements.size <= static_cast<VkDeviceSize>(UINT32_MAX));
+    (*size) = static_cast<uint32_t>(memory_requirements.size);
+    (*alignment) = static_cast<uint32_t>(memory_requirements.alignment);
+}
+
+void brx_pal_vk_device::get_storage_intermediate_buffer_memory_requirements(uint32_t storage_intermediate_buffer_size, uint32_t *size, uint32_t *alignment) const
+{
+    VkMemoryRequirements memory_requirements;
+    brx_pal_vk_storage_intermediate_buffer::get_memory_requirements(this->m_support_ray_tracing, this->m_device, this->m_pfn_create_buffer, this->m_pfn_get_buffer_memory_requirements, this->m_pfn_destroy_buffer, this->m_allocation_callbacks, storage_intermediate_buffer_size, &memory_requirements);
+
+    assert(memory_requirements.size <= static_cast<VkDeviceSize>(UINT32_MAX));
+    (*size) = static_cast<uint32_t>(memory_requirements.size);
+    (*alignment) = static_cast<uint32_t>(memory_requirements.alignment);
+}
+
+brx_pal_color_attachment_image *brx_pal_vk_device::create_placed_color_attachment_image(brx_pal_memory_heap const *wrapped_memory_heap, uint32_t memory_heap_offset, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT wrapped_color_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image) const
+{
+    assert(NULL != wrapped_memory_heap);
+    brx_pal_vk_memory_heap const *unwrapped_memory_heap = static_cast<brx_pal_vk_memory_heap const *>(wrapped_memory_heap);
+    assert(BRX_PAL_MEMORY_HEAP_TYPE_ATTACHMENT_IMAGE == unwrapped_memory_heap->get_type());
+    assert(static_cast<VkDeviceSize>(memory_heap_offset) < unwrapped_memory_heap->get_size());
+
+    void *new_unwrapped_color_attachment_image_base = this->m_color_attachment_image_object_pool.allocate();
+    assert(NULL != new_unwrapped_color_attachment_image_base);
+
+    brx_pal_vk_color_attachment_intermediate_image *new_unwrapped_color_attachment_image = new (new_unwrapped_color_attachment_image_base) brx_pal_vk_color_attachment_intermediate_image{};
+    new_unwrapped_color_attachment_image->init(this->m_device, this->m_pfn_create_image_view, this->m_allocation_callbacks, this->m_memory_allocator, VK_NULL_HANDLE, unwrapped_memory_heap->get_allocation(), memory_heap_offset, wrapped_color_attachment_image_format, width, height, 1U, 1U, allow_sampled_image);
+    return new_unwrapped_color_attachment_image;
+}
+
+brx_pal_depth_stencil_attachment_image *brx_pal_vk_device::create_placed_depth_stencil_attachment_image(brx_pal_memory_heap const *wrapped_memory_heap, uint32_t memory_heap_offset, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT wrapped_depth_stencil_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image) const
+{
+    assert(NULL != wrapped_memory_heap);
+    brx_pal_vk_memory_heap const *unwrapped_memory_heap = static_cast<brx_pal_vk_memory_heap const *>(wrapped_memory_heap);
+    assert(BRX_PAL_MEMORY_HEAP_TYPE_ATTACHMENT_IMAGE == unwrapped_memory_heap->get_type());
+    assert(static_cast<VkDeviceSize>(memory_heap_offset) < unwrapped_memory_heap->get_size());
+
+    void *new_unwrapped_depth_stencil_attachment_image_base = this->m_depth_stencil_attachment_image_object_pool.allocate();
+    assert(NULL != new_unwrapped_depth_stencil_attachment_image_base);
+
+    brx_pal_vk_depth_stencil_attachment_intermediate_image *new_unwrapped_depth_stencil_attachment_image = new (new_unwrapped_depth_stencil_attachment_image_base) brx_pal_vk_depth_stencil_attachment_intermediate_image{};
+    new_unwrapped_depth_stencil_attachment_image->init(this->m_device, this->m_pfn_create_image_view, this->m_allocation_callbacks, this->m_memory_allocator, VK_NULL_HANDLE, unwrapped_memory_heap->get_allocation(), memory_heap_offset, wrapped_depth_stencil_attachment_image_format, width, height, 1U, 1U, allow_sampled_image);
+    return new_unwrapped_depth_stencil_attachment_image;
+}
+
+brx_pal_storage_image *brx_pal_vk_device::create_placed_storage_image(brx_pal_memory_heap const *wrapped_memory_heap, uint32_t memory_heap_offset, BRX_PAL_STORAGE_IMAGE_FORMAT wrapped_storage_image_format, uint32_t width, uint32_t height, bool allow_sampled_image) const
+{
+    assert(NULL != wrapped_memory_heap);
+    brx_pal_vk_memory_heap const *unwrapped_memory_heap = static_cast<brx_pal_vk_memory_heap const *>(wrapped_memory_heap);
+    assert(BRX_PAL_MEMORY_HEAP_TYPE_STORAGE_IMAGE == unwrapped_memory_heap->get_type());
+    assert(static_cast<VkDeviceSize>(memory_heap_offset) < unwrapped_memory_heap->get_size());
+
+    void *new_unwrapped_storage_image_base = this->m_storage_image_object_pool.allocate();
     assert(NULL != new_unwrapped_storage_image_base);
 
     brx_pal_vk_storage_intermediate_image *new_unwrapped_storage_image = new (new_unwrapped_storage_image_base) brx_pal_vk_storage_intermediate_image{};
-    new_unwrapped_storage_image->init(this->m_device, this->m_pfn_create_image_view, this->m_allocation_callbacks, this->m_memory_allocator, this->m_storage_intermediate_image_memory_pool, unwrapped_storage_image_format, width, height, allow_sampled_image);
+    new_unwrapped_storage_image->init(this->m_device, this->m_pfn_create_image_view, this->m_allocation_callbacks, this->m_memory_allocator, VK_NULL_HANDLE, unwrapped_memory_heap->get_allocation(), memory_heap_offset, _internal_unwrap_storage_image_format(wrapped_storage_image_format), width, height, allow_sampled_image);
     return new_unwrapped_storage_image;
 }
 
-void brx_pal_vk_device::destroy_storage_image(brx_pal_storage_image *wrapped_storage_image) const
+brx_pal_storage_intermediate_buffer *brx_pal_vk_device::create_placed_storage_intermediate_buffer(brx_pal_memory_heap const *wrapped_memory_heap, uint32_t memory_heap_offset, uint32_t size) const
 {
-    assert(NULL != wrapped_storage_image);
-    brx_pal_vk_storage_intermediate_image *delete_unwrapped_storage_image = static_cast<brx_pal_vk_storage_intermediate_image *>(wrapped_storage_image);
+    assert(NULL != wrapped_memory_heap);
+    brx_pal_vk_memory_heap const *unwrapped_memory_heap = static_cast<brx_pal_vk_memory_heap const *>(wrapped_memory_heap);
+    assert(BRX_PAL_MEMORY_HEAP_TYPE_STORAGE_BUFFER == unwrapped_memory_heap->get_type());
+    assert((static_cast<VkDeviceSize>(memory_heap_offset) + static_cast<VkDeviceSize>(size)) <= unwrapped_memory_heap->get_size());
 
-    delete_unwrapped_storage_image->uninit(this->m_device, this->m_pfn_destroy_image_view, this->m_allocation_callbacks, this->m_memory_allocator);
+    void *new_unwrapped_storage_intermediate_buffer_base = this->m_storage_intermediate_buffer_object_pool.allocate();
+    assert(NULL != new_unwrapped_storage_intermediate_buffer_base);
 
-    delete_unwrapped_storage_image->~brx_pal_vk_storage_intermediate_image();
-    mcrt_free(delete_unwrapped_storage_image);
+    brx_pal_vk_storage_intermediate_buffer *new_unwrapped_storage_intermediate_buffer = new (new_unwrapped_storage_intermediate_buffer_base) brx_pal_vk_storage_intermediate_buffer{};
+    new_unwrapped_storage_intermediate_buffer->init(this->m_support_ray_tracing, this->m_device, this->m_pfn_get_buffer_device_address, this->m_memory_allocator, VK_NULL_HANDLE, unwrapped_memory_heap->get_allocation(), memory_heap_offset, size);
+    return new_unwrapped_storage_intermediate_buffer;
 }
 
 bool brx_pal_vk_device::is_sampled_asset_image_compression_bc_supported() const
@@ -2961,12 +4669,12 @@ brx_pal_sampled_asset_image *brx_pal_vk_device::create_sampled_asset_image(BRX_P
         unwrapped_sampled_asset_image_format = VK_FORMAT_UNDEFINED;
     }
 
-    void *new_brx_pal_sampled_asset_image_base = mcrt_malloc(sizeof(brx_pal_vk_sampled_asset_image), alignof(brx_pal_vk_sampled_asset_image));
+    void *new_brx_pal_sampled_asset_image_base = this->m_sampled_asset_image_object_pool.allocate();
     assert(NULL != new_brx_pal_sampled_asset_image_base);
 
     brx_pal_vk_sampled_asset_image *new_brx_pal_sampled_asset_image = new (new_brx_pal_sampled_asset_image_base) brx_pal_vk_sampled_asset_image{};
 
-    new_brx_pal_sampled_asset_image->init(this->m_device, this->m_pfn_create_image_view, this->m_allocation_callbacks, this->m_memory_allocator, this->m_sampled_asset_image_memory_pool, unwrapped_sampled_asset_image_format, width, height, mip_levels);
+    new_brx_pal_sampled_asset_image->init(this->m_device, this->m_pfn_create_image_view, this->m_allocation_callbacks, this->m_memory_allocator, this->get_sampled_asset_image_memory_pool(), unwrapped_sampled_asset_image_format, width, height, mip_levels);
 
     return new_brx_pal_sampled_asset_image;
 }
@@ -2979,93 +4687,35 @@ void brx_pal_vk_device::destroy_sampled_asset_image(brx_pal_sampled_asset_image
     delete_unwrapped_sampled_asset_image->uninit(this->m_device, this->m_pfn_destroy_image_view, this->m_allocation_callbacks, this->m_memory_allocator);
 
     delete_unwrapped_sampled_asset_image->~brx_pal_vk_sampled_asset_image();
-    mcrt_free(delete_unwrapped_sampled_asset_image);
+    this->m_sampled_asset_image_object_pool.free(delete_unwrapped_sampled_asset_image);
 }
 
-brx_pal_sampler *brx_pal_vk_device::create_sampler(BRX_PAL_SAMPLER_FILTER wrapped_filter, BRX_PAL_SAMPLER_ADDRESS_MODE wrapped_address_mode) const
+brx_pal_sampler *brx_pal_vk_device::create_sampler(BRX_PAL_SAMPLER_FILTER filter, BRX_PAL_SAMPLER_ADDRESS_MODE address_mode) const
 {
-    VkFilter unwrapped_filter;
-    VkSamplerMipmapMode unwrapped_mipmap_mode;
-    switch (wrapped_filter)
-    {
-    case BRX_PAL_SAMPLER_FILTER_NEAREST:
-        unwrapped_filter = VK_FILTER_NEAREST;
-        unwrapped_mipmap_mode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
-        break;
-    case BRX_PAL_SAMPLER_FILTER_LINEAR:
-        unwrapped_filter = VK_FILTER_LINEAR;
-        unwrapped_mipmap_mode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
-        break;
-    default:
-        assert(false);
-        unwrapped_filter = static_cast<VkFilter>(-1);
-        unwrapped_mipmap_mode = static_cast<VkSamplerMipmapMode>(-1);
-    }
-
-    VkSamplerAddressMode unwrapped_address_mode;
-    switch (wrapped_address_mode)
-    {
-    case BRX_PAL_SAMPLER_ADDRESS_MODE_WRAP:
-        unwrapped_address_mode = VK_SAMPLER_ADDRESS_MODE_REPEAT;
-        break;
-    case BRX_PAL_SAMPLER_ADDRESS_MODE_CLAMP:
-        unwrapped_address_mode = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
-        break;
-    default:
-        assert(false);
-        unwrapped_address_mode = static_cast<VkSamplerAddressMode>(-1);
-    }
-
-    VkSampler new_sampler = VK_NULL_HANDLE;
-    {
-        PFN_vkCreateSampler pfn_create_sampler = reinterpret_cast<PFN_vkCreateSampler>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateSampler"));
-        assert(NULL != pfn_create_sampler);
-
-        VkSamplerCreateInfo sampler_create_info;
-        sampler_create_info.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
-        sampler_create_info.pNext = NULL;
-        sampler_create_info.flags = 0U;
-        sampler_create_info.magFilter = unwrapped_filter;
-        sampler_create_info.minFilter = unwrapped_filter;
-        sampler_create_info.mipmapMode = unwrapped_mipmap_mode;
-        sampler_create_info.addressModeU = unwrapped_address_mode;
-        sampler_create_info.addressModeV = unwrapped_address_mode;
-        sampler_create_info.addressModeW = unwrapped_address_mode;
-        sampler_create_info.mipLodBias = 0.0F;
-        sampler_create_info.anisotropyEnable = VK_FALSE;
-        sampler_create_info.maxAnisotropy = 1U;
-        sampler_create_info.compareEnable = VK_FALSE;
-        sampler_create_info.compareOp = VK_COMPARE_OP_NEVER;
-        sampler_create_info.minLod = 0.0F;
-        sampler_create_info.maxLod = VK_LOD_CLAMP_NONE;
-        sampler_create_info.borderColor = VK_BORDER_COLOR_FLOAT_TRANSPARENT_BLACK;
-        sampler_create_info.unnormalizedCoordinates = VK_FALSE;
-        VkResult res_create_sampler = pfn_create_sampler(this->m_device, &sampler_create_info, this->m_allocation_callbacks, &new_sampler);
-        assert(VK_SUCCESS == res_create_sampler);
-    }
+    BRX_PAL_SAMPLER_DESC const sampler_desc = {
+        filter,
+        address_mode,
+        address_mode,
+        address_mode,
+        1U,
+        0.0F,
+        0.0F,
+        BRX_PAL_SAMPLER_LOD_CLAMP_NONE,
+        BRX_PAL_SAMPLER_COMPARE_OPERATION_DISABLE,
+        BRX_PAL_SAMPLER_BORDER_COLOR_TRANSPARENT_BLACK};
 
-    void *new_brx_pal_sampler_base = mcrt_malloc(sizeof(brx_pal_vk_sampler), alignof(brx_pal_vk_sampler));
-    assert(NULL != new_brx_pal_sampler_base);
+    return this->create_sampler_with_desc(&sampler_desc);
+}
 
-    brx_pal_vk_sampler *new_brx_pal_sampler = new (new_brx_pal_sampler_base) brx_pal_vk_sampler{new_sampler};
-    return new_brx_pal_sampler;
+brx_pal_sampler *brx_pal_vk_device::create_sampler_with_desc(BRX_PAL_SAMPLER_DESC const *sampler_desc) const
+{
+    return const_cast<brx_pal_vk_sampler_cache *>(&this->m_sampler_cache)->acquire(sampler_desc);
 }
 
 void brx_pal_vk_device::destroy_sampler(brx_pal_sampler *brx_pal_sampler) const
 {
     assert(NULL != brx_pal_sampler);
-    brx_pal_vk_sampler *delete_sampler = static_cast<brx_pal_vk_sampler *>(brx_pal_sampler);
-
-    VkSampler stealed_sampler = VK_NULL_HANDLE;
-    delete_sampler->steal(&stealed_sampler);
-
-    delete_sampler->~brx_pal_vk_sampler();
-    mcrt_free(delete_sampler);
-
-    PFN_vkDestroySampler pfn_destroy_sampler = reinterpret_cast<PFN_vkDestroySampler>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroySampler"));
-    assert(NULL != pfn_destroy_sampler);
-
-    pfn_destroy_sampler(this->m_device, stealed_sampler, this->m_allocation_callbacks);
+    const_cast<brx_pal_vk_sampler_cache *>(&this->m_sampler_cache)->release(static_cast<brx_pal_vk_sampler *>(brx_pal_sampler));
 }
 
 brx_pal_surface *brx_pal_vk_device::create_surface(void *wsi_window) const
@@ -3197,7 +4847,7 @@ brx_pal_scratch_buffer *brx_pal_vk_device::create_scratch_buffer(uint32_t size)
     assert(NULL != new_unwrapped_scratch_buffer_base);
 
     brx_pal_vk_scratch_buffer *new_unwrapped_scratch_buffer = new (new_unwrapped_scratch_buffer_base) brx_pal_vk_scratch_buffer{};
-    new_unwrapped_scratch_buffer->init(this->m_device, this->m_pfn_get_buffer_device_address, this->m_memory_allocator, this->m_scratch_buffer_memory_pool, size);
+    new_unwrapped_scratch_buffer->init(this->m_device, this->m_pfn_get_buffer_device_address, this->m_memory_allocator, this->get_scratch_buffer_memory_pool(), size);
     return new_unwrapped_scratch_buffer;
 }
 
@@ -3314,7 +4964,7 @@ brx_pal_intermediate_bottom_level_acceleration_structure *brx_pal_vk_device::cre
     assert(NULL != new_unwrapped_intermediate_bottom_level_acceleration_structure_base);
 
     brx_pal_vk_intermediate_bottom_level_acceleration_structure *new_unwrapped_intermediate_bottom_level_acceleration_structure = new (new_unwrapped_intermediate_bottom_level_acceleration_structure_base) brx_pal_vk_intermediate_bottom_level_acceleration_structure{};
-    new_unwrapped_intermediate_bottom_level_acceleration_structure->init(this->m_device, this->m_pfn_create_acceleration_structure, this->m_pfn_get_acceleration_structure_device_address, this->m_allocation_callbacks, this->m_memory_allocator, this->m_intermediate_bottom_level_acceleration_structure_memory_pool, size);
+    new_unwrapped_intermediate_bottom_level_acceleration_structure->init(this->m_device, this->m_pfn_create_acceleration_structure, this->m_pfn_get_acceleration_structure_device_address, this->m_allocation_callbacks, this->m_memory_allocator, this->get_intermediate_bottom_level_acceleration_structure_memory_pool(), size);
     return new_unwrapped_intermediate_bottom_level_acceleration_structure;
 }
 
@@ -3430,7 +5080,7 @@ brx_pal_non_compacted_bottom_level_acceleration_structure *brx_pal_vk_device::cr
     assert(NULL != new_unwrapped_non_compacted_bottom_level_acceleration_structure_base);
 
     brx_pal_vk_non_compacted_bottom_level_acceleration_structure *new_unwrapped_non_compacted_bottom_level_acceleration_structure = new (new_unwrapped_non_compacted_bottom_level_acceleration_structure_base) brx_pal_vk_non_compacted_bottom_level_acceleration_structure{};
-    new_unwrapped_non_compacted_bottom_level_acceleration_structure->init(this->m_device, this->m_pfn_create_acceleration_structure, this->m_allocation_callbacks, this->m_memory_allocator, this->m_non_compacted_bottom_level_acceleration_structure_memory_pool, size);
+    new_unwrapped_non_compacted_bottom_level_acceleration_structure->init(this->m_device, this->m_pfn_create_acceleration_structure, this->m_allocation_callbacks, this->m_memory_allocator, this->get_non_compacted_bottom_level_acceleration_structure_memory_pool(), size);
     return new_unwrapped_non_compacted_bottom_level_acceleration_structure;
 }
 
@@ -3496,7 +5146,7 @@ brx_pal_compacted_bottom_level_acceleration_structure *brx_pal_vk_device::create
     assert(NULL != new_unwrapped_compacted_bottom_level_acceleration_structure_base);
 
     brx_pal_vk_compacted_bottom_level_acceleration_structure *new_unwrapped_compacted_bottom_level_acceleration_structure = new (new_unwrapped_compacted_bottom_level_acceleration_structure_base) brx_pal_vk_compacted_bottom_level_acceleration_structure{};
-    new_unwrapped_compacted_bottom_level_acceleration_structure->init(this->m_device, this->m_pfn_create_acceleration_structure, this->m_pfn_get_acceleration_structure_device_address, this->m_allocation_callbacks, this->m_memory_allocator, this->m_compacted_bottom_level_acceleration_structure_memory_pool, size);
+    new_unwrapped_compacted_bottom_level_acceleration_structure->init(this->m_device, this->m_pfn_create_acceleration_structure, this->m_pfn_get_acceleration_structure_device_address, this->m_allocation_callbacks, this->m_memory_allocator, this->get_compacted_bottom_level_acceleration_structure_memory_pool(), size);
     return new_unwrapped_compacted_bottom_level_acceleration_structure;
 }
 
@@ -3511,13 +5161,100 @@ void brx_pal_vk_device::destroy_compacted_bottom_level_acceleration_structure(br
     mcrt_free(delete_unwrapped_compacted_bottom_level_acceleration_structure);
 }
 
+brx_pal_serialized_bottom_level_acceleration_structure_size_query_pool *brx_pal_vk_device::create_serialized_bottom_level_acceleration_structure_size_query_pool(uint32_t query_count) const
+{
+    PFN_vkCreateQueryPool const pfn_create_query_pool = reinterpret_cast<PFN_vkCreateQueryPool>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateQueryPool"));
+    assert(NULL != pfn_create_query_pool);
+
+    void *new_unwrapped_serialized_bottom_level_acceleration_structure_size_query_pool_base = mcrt_malloc(sizeof(brx_pal_vk_serialized_bottom_level_acceleration_structure_size_query_pool), alignof(brx_pal_vk_serialized_bottom_level_acceleration_structure_size_query_pool));
+    assert(NULL != new_unwrapped_serialized_bottom_level_acceleration_structure_size_query_pool_base);
+
+    brx_pal_vk_serialized_bottom_level_acceleration_structure_size_query_pool *new_unwrapped_serialized_bottom_level_acceleration_structure_size_query_pool = new (new_unwrapped_serialized_bottom_level_acceleration_structure_size_query_pool_base) brx_pal_vk_serialized_bottom_level_acceleration_structure_size_query_pool{};
+    new_unwrapped_serialized_bottom_level_acceleration_structure_size_query_pool->init(this->m_device, pfn_create_query_pool, this->m_allocation_callbacks, query_count);
+    return new_unwrapped_serialized_bottom_level_acceleration_structure_size_query_pool;
+}
+
+uint32_t brx_pal_vk_device::get_serialized_bottom_level_acceleration_structure_size_query_pool_result(brx_pal_serialized_bottom_level_acceleration_structure_size_query_pool const *wrapped_serialized_bottom_level_acceleration_structure_size_query_pool, uint32_t query_index) const
+{
+    assert(NULL != wrapped_serialized_bottom_level_acceleration_structure_size_query_pool);
+    brx_pal_vk_serialized_bottom_level_acceleration_structure_size_query_pool const *const unwrapped_serialized_bottom_level_acceleration_structure_size_query_pool = static_cast<brx_pal_vk_serialized_bottom_level_acceleration_structure_size_query_pool const *>(wrapped_serialized_bottom_level_acceleration_structure_size_query_pool);
+
+    VkQueryPool const query_pool = unwrapped_serialized_bottom_level_acceleration_structure_size_query_pool->get_query_pool();
+
+    VkDeviceSize serialized_bottom_level_acceleration_structure_size = static_cast<VkDeviceSize>(-1);
+    VkResult res_get_query_pool_results;
+    while (VK_NOT_READY == (res_get_query_pool_results = this->m_pfn_get_query_pool_results(this->m_device, query_pool, query_index, 1U, sizeof(VkDeviceSize), &serialized_bottom_level_acceleration_structure_size, sizeof(VkDeviceSize), 0U)))
+    {
+        _internal_pause();
+    }
+    assert(VK_SUCCESS == res_get_query_pool_results);
+
+    return static_cast<uint32_t>(serialized_bottom_level_acceleration_structure_size);
+}
+
+void brx_pal_vk_device::destroy_serialized_bottom_level_acceleration_structure_size_query_pool(brx_pal_serialized_bottom_level_acceleration_structure_size_query_pool *wrapped_serialized_bottom_level_acceleration_structure_size_query_pool) const
+{
+    PFN_vkDestroyQueryPool const pfn_destroy_query_pool = reinterpret_cast<PFN_vkDestroyQueryPool>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyQueryPool"));
+    assert(NULL != pfn_destroy_query_pool);
+
+    assert(NULL != wrapped_serialized_bottom_level_acceleration_structure_size_query_pool);
+    brx_pal_vk_serialized_bottom_level_acceleration_structure_size_query_pool *delete_unwrapped_serialized_bottom_level_acceleration_structure_size_query_pool = static_cast<brx_pal_vk_serialized_bottom_level_acceleration_structure_size_query_pool *>(wrapped_serialized_bottom_level_acceleration_structure_size_query_pool);
+
+    delete_unwrapped_serialized_bottom_level_acceleration_structure_size_query_pool->uninit(this->m_device, pfn_destroy_query_pool, this->m_allocation_callbacks);
+
+    delete_unwrapped_serialized_bottom_level_acceleration_structure_size_query_pool->~brx_pal_vk_serialized_bottom_level_acceleration_structure_size_query_pool();
+    mcrt_free(delete_unwrapped_serialized_bottom_level_acceleration_structure_size_query_pool);
+}
+
+brx_pal_serialized_bottom_level_acceleration_structure_buffer *brx_pal_vk_device::create_serialized_bottom_level_acceleration_structure_buffer(uint32_t size) const
+{
+    void *new_unwrapped_serialized_bottom_level_acceleration_structure_buffer_base = mcrt_malloc(sizeof(brx_pal_vk_serialized_bottom_level_acceleration_structure_buffer), alignof(brx_pal_vk_serialized_bottom_level_acceleration_structure_buffer));
+    assert(NULL != new_unwrapped_serialized_bottom_level_acceleration_structure_buffer_base);
+
+    brx_pal_vk_serialized_bottom_level_acceleration_structure_buffer *new_unwrapped_serialized_bottom_level_acceleration_structure_buffer = new (new_unwrapped_serialized_bottom_level_acceleration_structure_buffer_base) brx_pal_vk_serialized_bottom_level_acceleration_structure_buffer{};
+    new_unwrapped_serialized_bottom_level_acceleration_structure_buffer->init(this->m_device, this->m_pfn_get_buffer_device_address, this->m_memory_allocator, this->get_serialized_bottom_level_acceleration_structure_buffer_memory_pool(), size);
+    return new_unwrapped_serialized_bottom_level_acceleration_structure_buffer;
+}
+
+void brx_pal_vk_device::destroy_serialized_bottom_level_acceleration_structure_buffer(brx_pal_serialized_bottom_level_acceleration_structure_buffer *wrapped_serialized_bottom_level_acceleration_structure_buffer) const
+{
+    assert(NULL != wrapped_serialized_bottom_level_acceleration_structure_buffer);
+    brx_pal_vk_serialized_bottom_level_acceleration_structure_buffer *delete_unwrapped_serialized_bottom_level_acceleration_structure_buffer = static_cast<brx_pal_vk_serialized_bottom_level_acceleration_structure_buffer *>(wrapped_serialized_bottom_level_acceleration_structure_buffer);
+
+    delete_unwrapped_serialized_bottom_level_acceleration_structure_buffer->uninit(this->m_memory_allocator);
+
+    delete_unwrapped_serialized_bottom_level_acceleration_structure_buffer->~brx_pal_vk_serialized_bottom_level_acceleration_structure_buffer();
+    mcrt_free(delete_unwrapped_serialized_bottom_level_acceleration_structure_buffer);
+}
+
+bool brx_pal_vk_device::is_serialized_bottom_level_acceleration_structure_compatible(BRX_PAL_SERIALIZED_BOTTOM_LEVEL_ACCELERATION_STRUCTURE_HEADER const *serialized_bottom_level_acceleration_structure_header) const
+{
+    assert(this->m_support_ray_tracing);
+
+    PFN_vkGetDeviceAccelerationStructureCompatibilityKHR const pfn_get_device_acceleration_structure_compatibility = reinterpret_cast<PFN_vkGetDeviceAccelerationStructureCompatibilityKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkGetDeviceAccelerationStructureCompatibilityKHR"));
+    assert(NULL != pfn_get_device_acceleration_structure_compatibility);
+
+    static_assert(sizeof(serialized_bottom_level_acceleration_structure_header->driver_matching_identifier) == (2U * VK_UUID_SIZE), "");
+
+    assert(NULL != serialized_bottom_level_acceleration_structure_header);
+    VkAccelerationStructureVersionInfoKHR const acceleration_structure_version_info = {
+        VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_VERSION_INFO_KHR,
+        NULL,
+        serialized_bottom_level_acceleration_structure_header->driver_matching_identifier};
+
+    VkAccelerationStructureCompatibilityKHR acceleration_structure_compatibility = VK_ACCELERATION_STRUCTURE_COMPATIBILITY_INCOMPATIBLE_KHR;
+    pfn_get_device_acceleration_structure_compatibility(this->m_device, &acceleration_structure_version_info, &acceleration_structure_compatibility);
+
+    return (VK_ACCELERATION_STRUCTURE_COMPATIBILITY_COMPATIBLE_KHR == acceleration_structure_compatibility);
+}
+
 brx_pal_top_level_acceleration_structure_instance_upload_buffer *brx_pal_vk_device::create_top_level_acceleration_structure_instance_upload_buffer(uint32_t instance_count) const
 {
     void *new_unwrapped_top_level_acceleration_structure_instance_upload_buffer_base = mcrt_malloc(sizeof(brx_pal_vk_top_level_acceleration_structure_instance_upload_buffer), alignof(brx_pal_vk_top_level_acceleration_structure_instance_upload_buffer));
     assert(NULL != new_unwrapped_top_level_acceleration_structure_instance_upload_buffer_base);
 
     brx_pal_vk_top_level_acceleration_structure_instance_upload_buffer *new_unwrapped_top_level_acceleration_structure_instance_upload_buffer = new (new_unwrapped_top_level_acceleration_structure_instance_upload_buffer_base) brx_pal_vk_top_level_acceleration_structure_instance_upload_buffer{};
-    new_unwrapped_top_level_acceleration_structure_instance_upload_buffer->init(this->m_device, this->m_pfn_get_buffer_device_address, this->m_memory_allocator, this->m_top_level_acceleration_structure_instance_upload_buffer_memory_pool, instance_count);
+    new_unwrapped_top_level_acceleration_structure_instance_upload_buffer->init(this->m_device, this->m_pfn_get_buffer_device_address, this->m_memory_allocator, this->get_top_level_acceleration_structure_instance_upload_buffer_memory_pool(), instance_count);
     return new_unwrapped_top_level_acceleration_structure_instance_upload_buffer;
 }
 
@@ -3585,7 +5322,7 @@ brx_pal_top_level_acceleration_structure *brx_pal_vk_device::create_top_level_ac
     assert(NULL != new_unwrapped_top_level_acceleration_structure_base);
 
     brx_pal_vk_top_level_acceleration_structure *new_unwrapped_top_level_acceleration_structure = new (new_unwrapped_top_level_acceleration_structure_base) brx_pal_vk_top_level_acceleration_structure{};
-    new_unwrapped_top_level_acceleration_structure->init(this->m_device, this->m_pfn_create_acceleration_structure, this->m_pfn_get_acceleration_structure_device_address, this->m_allocation_callbacks, this->m_memory_allocator, this->m_top_level_acceleration_structure_memory_pool, size);
+    new_unwrapped_top_level_acceleration_structure->init(this->m_device, this->m_pfn_create_acceleration_structure, this->m_pfn_get_acceleration_structure_device_address, this->m_allocation_callbacks, this->m_memory_allocator, this->get_top_level_acceleration_structure_memory_pool(), size);
     return new_unwrapped_top_level_acceleration_structure;
 }
 
@@ -3695,6 +5432,51 @@ static inline uint32_t _internal_find_lowest_memory_type_index(struct VkPhysical
 #error Unknown Compiler
 #endif
 
+static inline uint32_t _internal_find_max_sample_count(VkSampleCountFlags sample_counts)
+{
+    // the higher sample count is rarely beneficial
+    uint32_t max_sample_count;
+    if (0U != (sample_counts & VK_SAMPLE_COUNT_8_BIT))
+    {
+        max_sample_count = 8U;
+    }
+    else if (0U != (sample_counts & VK_SAMPLE_COUNT_4_BIT))
+    {
+        max_sample_count = 4U;
+    }
+    else if (0U != (sample_counts & VK_SAMPLE_COUNT_2_BIT))
+    {
+        max_sample_count = 2U;
+    }
+    else
+    {
+        assert(0U != (sample_counts & VK_SAMPLE_COUNT_1_BIT));
+        max_sample_count = 1U;
+    }
+    return max_sample_count;
+}
+
+static inline VkFormat _internal_unwrap_storage_image_format(BRX_PAL_STORAGE_IMAGE_FORMAT wrapped_storage_image_format)
+{
+    VkFormat unwrapped_storage_image_format;
+    switch (wrapped_storage_image_format)
+    {
+    case BRX_PAL_STORAGE_IMAGE_FORMAT_R16_SFLOAT:
+        unwrapped_storage_image_format = VK_FORMAT_R16_SFLOAT;
+        break;
+    case BRX_PAL_STORAGE_IMAGE_FORMAT_R16G16B16A16_SFLOAT:
+        unwrapped_storage_image_format = VK_FORMAT_R16G16B16A16_SFLOAT;
+        break;
+    case BRX_PAL_STORAGE_IMAGE_FORMAT_R32_UINT:
+        unwrapped_storage_image_format = VK_FORMAT_R32_UINT;
+        break;
+    default:
+        assert(false);
+        unwrapped_storage_image_format = VK_FORMAT_UNDEFINED;
+    }
+    return unwrapped_storage_image_format;
+}
+
 static inline void _internal_pause()
 {
 #if defined(__GNUC__)
@@ -3717,3 +5499,8 @@ static inline void _internal_pause()
 #error Unknown Compiler
 #endif
 }
+
+static inline uint64_t _internal_get_elapsed_nanoseconds(std::chrono::steady_clock::time_point begin_time, std::chrono::steady_clock::time_point end_time)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - begin_time).count());
+}
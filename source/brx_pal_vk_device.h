@@ -20,6 +20,10 @@
 
 #include "../include/brx_pal_device.h"
 #include "../../McRT-Malloc/include/mcrt_vector.h"
+#include "../../McRT-Malloc/include/mcrt_unordered_map.h"
+#include "brx_pal_object_pool.h"
+#include <atomic>
+#include <mutex>
 #if defined(__GNUC__)
 #if defined(__linux__)
 #if defined(__ANDROID__)
@@ -55,6 +59,61 @@ extern VkPipelineStageFlags const g_graphics_queue_family_graphics_compute_pipel
 extern VkPipelineStageFlags const g_graphics_queue_family_ray_tracing_pipeline_shader_read_stages;
 extern VkPipelineStageFlags const g_graphics_queue_family_acceleration_structure_build_shader_read_stages;
 
+// the entries with the same hash are linked by the "next", and the size and the second hash (with the different seed) of the SPIR-V code are compared to resolve the hash collision
+struct brx_pal_vk_shader_module_cache_entry
+{
+    brx_pal_vk_shader_module_cache_entry *m_next;
+    uint64_t m_code_hash;
+    uint64_t m_code_check_hash;
+    size_t m_code_size;
+    VkShaderModule m_shader_module;
+    uint32_t m_reference_count;
+};
+
+// the shader module is shared by all pipelines created from the same SPIR-V code, and is destroyed when the last pipeline releases it
+class brx_pal_vk_shader_module_cache
+{
+    PFN_vkCreateShaderModule m_pfn_create_shader_module;
+    PFN_vkDestroyShaderModule m_pfn_destroy_shader_module;
+    VkDevice m_device;
+    VkAllocationCallbacks const *m_allocation_callbacks;
+    std::mutex m_mutex;
+    mcrt_unordered_map<uint64_t, brx_pal_vk_shader_module_cache_entry *> m_entries;
+
+public:
+    brx_pal_vk_shader_module_cache();
+    void init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
+    void uninit();
+    ~brx_pal_vk_shader_module_cache();
+    brx_pal_vk_shader_module_cache_entry *acquire(size_t code_size, void const *code);
+    void release(brx_pal_vk_shader_module_cache_entry *entry);
+
+private:
+    brx_pal_vk_shader_module_cache_entry *find(uint64_t code_hash, uint64_t code_check_hash, size_t code_size) const;
+};
+
+class brx_pal_vk_sampler;
+
+// the sampler is shared by all "create_sampler" with the same sampler state, and is destroyed when the last reference is released by the "destroy_sampler"
+class brx_pal_vk_sampler_cache
+{
+    PFN_vkCreateSampler m_pfn_create_sampler;
+    PFN_vkDestroySampler m_pfn_destroy_sampler;
+    VkDevice m_device;
+    VkAllocationCallbacks const *m_allocation_callbacks;
+    bool m_support_sampler_anisotropy;
+    std::mutex m_mutex;
+    mcrt_unordered_map<uint64_t, brx_pal_vk_sampler *> m_samplers;
+
+public:
+    brx_pal_vk_sampler_cache();
+    void init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, bool support_sampler_anisotropy);
+    void uninit();
+    ~brx_pal_vk_sampler_cache();
+    brx_pal_vk_sampler *acquire(BRX_PAL_SAMPLER_DESC const *sampler_desc);
+    void release(brx_pal_vk_sampler *sampler);
+};
+
 class brx_pal_vk_device final : public brx_pal_device
 {
     PFN_vkGetInstanceProcAddr m_pfn_get_instance_proc_addr;
@@ -78,18 +137,38 @@ class brx_pal_vk_device final : public brx_pal_device
     uint32_t m_max_per_stage_descriptor_sampled_images;
     uint32_t m_max_descriptor_set_storage_buffers;
     uint32_t m_max_descriptor_set_sampled_images;
+    uint32_t m_max_attachment_sample_count;
 
     bool m_has_dedicated_upload_queue;
     uint32_t m_graphics_queue_family_index;
     uint32_t m_upload_queue_family_index;
+    bool m_has_dedicated_compute_queue;
+    uint32_t m_compute_queue_family_index;
+
+    bool m_support_dynamic_rendering;
+
+    bool m_support_multiview;
+    uint32_t m_max_multiview_view_count;
+
+    bool m_support_graphics_pipeline_library;
+    bool m_support_extended_dynamic_state;
+    bool m_support_mesh_shader;
+    bool m_support_descriptor_update_template;
+
+    BRX_PAL_SUBGROUP_PROPERTIES m_subgroup_properties;
+
+    bool m_support_bindless;
+    BRX_PAL_BINDLESS_DESCRIPTOR_LIMITS m_bindless_descriptor_limits;
 
     PFN_vkGetDeviceProcAddr m_pfn_get_device_proc_addr;
     bool m_physical_device_feature_texture_compression_BC;
     bool m_physical_device_feature_texture_compression_ASTC_LDR;
+    bool m_physical_device_feature_sampler_anisotropy;
     VkDevice m_device;
 
     VkQueue m_graphics_queue;
     VkQueue m_upload_queue;
+    VkQueue m_compute_queue;
 
     VkFormat m_depth_attachment_image_format;
     VkFormat m_depth_stencil_attachment_image_format;
@@ -97,25 +176,40 @@ class brx_pal_vk_device final : public brx_pal_device
     bool m_depth_stencil_attachment_image_format_support_sampled_image;
 
     VmaAllocator m_memory_allocator;
-
-    VmaPool m_uniform_upload_buffer_memory_pool;
-    VmaPool m_staging_upload_buffer_memory_pool;
-    VmaPool m_storage_intermediate_buffer_memory_pool;
-    VmaPool m_storage_asset_buffer_memory_pool;
-    VmaPool m_color_transient_attachment_image_memory_pool;
-    VmaPool m_color_attachment_sampled_image_memory_pool;
-    VmaPool m_depth_transient_attachment_image_memory_pool;
-    VmaPool m_depth_attachment_sampled_image_memory_pool;
-    VmaPool m_depth_stencil_transient_attachment_image_memory_pool;
-    VmaPool m_depth_stencil_attachment_sampled_image_memory_pool;
-    VmaPool m_storage_intermediate_image_memory_pool;
-    VmaPool m_sampled_asset_image_memory_pool;
-    VmaPool m_scratch_buffer_memory_pool;
-    VmaPool m_intermediate_bottom_level_acceleration_structure_memory_pool;
-    VmaPool m_non_compacted_bottom_level_acceleration_structure_memory_pool;
-    VmaPool m_compacted_bottom_level_acceleration_structure_memory_pool;
-    VmaPool m_top_level_acceleration_structure_instance_upload_buffer_memory_pool;
-    VmaPool m_top_level_acceleration_structure_memory_pool;
+    VkPhysicalDeviceMemoryProperties m_physical_device_memory_properties;
+
+    // the memory pools are created when first used
+    mutable std::atomic<VmaPool> m_uniform_upload_buffer_memory_pool;
+    mutable std::atomic<VmaPool> m_staging_upload_buffer_memory_pool;
+    mutable std::atomic<VmaPool> m_storage_intermediate_buffer_memory_pool;
+    mutable std::atomic<VmaPool> m_storage_asset_buffer_memory_pool;
+    mutable std::atomic<VmaPool> m_color_transient_attachment_image_memory_pool;
+    mutable std::atomic<VmaPool> m_color_attachment_sampled_image_memory_pool;
+    mutable std::atomic<VmaPool> m_depth_transient_attachment_image_memory_pool;
+    mutable std::atomic<VmaPool> m_depth_attachment_sampled_image_memory_pool;
+    mutable std::atomic<VmaPool> m_depth_stencil_transient_attachment_image_memory_pool;
+    mutable std::atomic<VmaPool> m_depth_stencil_attachment_sampled_image_memory_pool;
+    mutable std::atomic<VmaPool> m_storage_intermediate_image_memory_pool;
+    mutable std::atomic<VmaPool> m_sampled_asset_image_memory_pool;
+    mutable std::atomic<VmaPool> m_scratch_buffer_memory_pool;
+    mutable std::atomic<VmaPool> m_intermediate_bottom_level_acceleration_structure_memory_pool;
+    mutable std::atomic<VmaPool> m_non_compacted_bottom_level_acceleration_structure_memory_pool;
+    mutable std::atomic<VmaPool> m_compacted_bottom_level_acceleration_structure_memory_pool;
+    mutable std::atomic<VmaPool> m_serialized_bottom_level_acceleration_structure_buffer_memory_pool;
+    mutable std::atomic<VmaPool> m_top_level_acceleration_structure_instance_upload_buffer_memory_pool;
+    mutable std::atomic<VmaPool> m_top_level_acceleration_structure_memory_pool;
+
+    mutable brx_pal_lock_free_object_pool m_fence_object_pool;
+    mutable brx_pal_lock_free_object_pool m_descriptor_set_object_pool;
+    mutable brx_pal_lock_free_object_pool m_graphics_pipeline_object_pool;
+    mutable brx_pal_lock_free_object_pool m_compute_pipeline_object_pool;
+    mutable brx_pal_lock_free_object_pool m_uniform_upload_buffer_object_pool;
+    mutable brx_pal_lock_free_object_pool m_staging_upload_buffer_object_pool;
+    mutable brx_pal_lock_free_object_pool m_storage_intermediate_buffer_object_pool;
+    mutable brx_pal_lock_free_object_pool m_color_attachment_image_object_pool;
+    mutable brx_pal_lock_free_object_pool m_depth_stencil_attachment_image_object_pool;
+    mutable brx_pal_lock_free_object_pool m_storage_image_object_pool;
+    mutable brx_pal_lock_free_object_pool m_sampled_asset_image_object_pool;
 
     PFN_vkWaitForFences m_pfn_wait_for_fences;
     PFN_vkResetFences m_pfn_reset_fences;
@@ -123,12 +217,27 @@ class brx_pal_vk_device final : public brx_pal_device
     PFN_vkAcquireNextImageKHR m_pfn_acquire_next_image;
     PFN_vkCreateImageView m_pfn_create_image_view;
     PFN_vkDestroyImageView m_pfn_destroy_image_view;
+    PFN_vkCreateBuffer m_pfn_create_buffer;
+    PFN_vkGetBufferMemoryRequirements m_pfn_get_buffer_memory_requirements;
+    PFN_vkDestroyBuffer m_pfn_destroy_buffer;
+    PFN_vkCreateImage m_pfn_create_image;
+    PFN_vkGetImageMemoryRequirements m_pfn_get_image_memory_requirements;
+    PFN_vkDestroyImage m_pfn_destroy_image;
     PFN_vkGetBufferDeviceAddressKHR m_pfn_get_buffer_device_address;
     PFN_vkCreateAccelerationStructureKHR m_pfn_create_acceleration_structure;
     PFN_vkDestroyAccelerationStructureKHR m_pfn_destroy_acceleration_structure;
     PFN_vkGetAccelerationStructureDeviceAddressKHR m_pfn_get_acceleration_structure_device_address;
     PFN_vkGetQueryPoolResults m_pfn_get_query_pool_results;
 
+    brx_pal_vk_shader_module_cache m_shader_module_cache;
+
+    brx_pal_vk_sampler_cache m_sampler_cache;
+
+    // the vertex input interface is the same for all graphics pipelines since no vertex attribute is used
+    VkPipeline m_graphics_pipeline_vertex_input_interface_library;
+
+    BRX_PAL_DEVICE_CREATION_TIMING m_device_creation_timing;
+
 public:
     brx_pal_vk_device();
     void init(void *wsi_connection, bool support_ray_tracing);
@@ -136,36 +245,101 @@ public:
     ~brx_pal_vk_device();
 
 private:
+    VmaPool get_uniform_upload_buffer_memory_pool() const;
+    VmaPool get_staging_upload_buffer_memory_pool() const;
+    VmaPool get_storage_intermediate_buffer_memory_pool() const;
+    VmaPool get_storage_asset_buffer_memory_pool() const;
+    VmaPool get_color_transient_attachment_image_memory_pool() const;
+    VmaPool get_color_attachment_sampled_image_memory_pool() const;
+    VmaPool get_depth_transient_attachment_image_memory_pool() const;
+    VmaPool get_depth_attachment_sampled_image_memory_pool() const;
+    VmaPool get_depth_stencil_transient_attachment_image_memory_pool() const;
+    VmaPool get_depth_stencil_attachment_sampled_image_memory_pool() const;
+    VmaPool get_storage_intermediate_image_memory_pool() const;
+    VmaPool get_sampled_asset_image_memory_pool() const;
+    VmaPool get_scratch_buffer_memory_pool() const;
+    VmaPool get_intermediate_bottom_level_acceleration_structure_memory_pool() const;
+    VmaPool get_non_compacted_bottom_level_acceleration_structure_memory_pool() const;
+    VmaPool get_compacted_bottom_level_acceleration_structure_memory_pool() const;
+    VmaPool get_serialized_bottom_level_acceleration_structure_buffer_memory_pool() const;
+    VmaPool get_top_level_acceleration_structure_instance_upload_buffer_memory_pool() const;
+    VmaPool get_top_level_acceleration_structure_memory_pool() const;
+    VmaPool get_color_attachment_image_memory_pool(bool allow_sampled_image) const;
+    VmaPool get_depth_stencil_attachment_image_memory_pool(BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT wrapped_depth_stencil_attachment_image_format, bool allow_sampled_image) const;
+    VmaPool publish_memory_pool(std::atomic<VmaPool> *memory_pool, VmaPool new_memory_pool) const;
+
     BRX_PAL_BACKEND_NAME get_backend_name() const override;
     bool is_ray_tracing_supported() const override;
+    bool is_dynamic_rendering_supported() const override;
     brx_pal_graphics_queue *create_graphics_queue() const override;
     void destroy_graphics_queue(brx_pal_graphics_queue *graphics_queue) const override;
     brx_pal_upload_queue *create_upload_queue() const override;
     void destroy_upload_queue(brx_pal_upload_queue *upload_queue) const override;
+    brx_pal_compute_queue *create_compute_queue() const override;
+    void destroy_compute_queue(brx_pal_compute_queue *compute_queue) const override;
     brx_pal_graphics_command_buffer *create_graphics_command_buffer() const override;
     void reset_graphics_command_buffer(brx_pal_graphics_command_buffer *graphics_command_buffer) const override;
     void destroy_graphics_command_buffer(brx_pal_graphics_command_buffer *graphics_command_buffer) const override;
     brx_pal_upload_command_buffer *create_upload_command_buffer() const override;
     void reset_upload_command_buffer(brx_pal_upload_command_buffer *upload_command_buffer) const override;
     void destroy_upload_command_buffer(brx_pal_upload_command_buffer *upload_command_buffer) const override;
+    brx_pal_compute_command_buffer *create_compute_command_buffer() const override;
+    void reset_compute_command_buffer(brx_pal_compute_command_buffer *compute_command_buffer) const override;
+    void destroy_compute_command_buffer(brx_pal_compute_command_buffer *compute_command_buffer) const override;
     brx_pal_fence *create_fence(bool signaled) const override;
     void wait_for_fence(brx_pal_fence *fence) const override;
     void reset_fence(brx_pal_fence *fence) const override;
     void destroy_fence(brx_pal_fence *fence) const override;
     brx_pal_descriptor_set_layout *create_descriptor_set_layout(uint32_t descriptor_set_binding_count, BRX_PAL_DESCRIPTOR_SET_LAYOUT_BINDING const *descriptor_set_bindings) const override;
     void destroy_descriptor_set_layout(brx_pal_descriptor_set_layout *descriptor_set_layout) const override;
-    brx_pal_pipeline_layout *create_pipeline_layout(uint32_t descriptor_set_layout_count, brx_pal_descriptor_set_layout const *const *descriptor_set_layouts) const override;
+    brx_pal_pipeline_layout *create_pipeline_layout(uint32_t descriptor_set_layout_count, brx_pal_descriptor_set_layout const *const *descriptor_set_layouts, uint32_t push_constant_size) const override;
     void destroy_pipeline_layout(brx_pal_pipeline_layout *pipeline_layout) const override;
     brx_pal_descriptor_set *create_descriptor_set(brx_pal_descriptor_set_layout const *descriptor_set_layout, uint32_t unbounded_descriptor_count) override;
     void write_descriptor_set(brx_pal_descriptor_set *descriptor_set, uint32_t dst_binding, BRX_PAL_DESCRIPTOR_TYPE descriptor_type, uint32_t dst_descriptor_start_index, uint32_t src_descriptor_count, brx_pal_uniform_upload_buffer const *const *src_dynamic_uniform_buffers, uint32_t const *src_dynamic_uniform_buffer_ranges, brx_pal_read_only_storage_buffer const *const *src_read_only_storage_buffers, brx_pal_storage_buffer const *const *src_storage_buffers, brx_pal_sampled_image const *const *src_sampled_images, brx_pal_storage_image const *const *src_storage_images, brx_pal_sampler const *const *src_samplers, brx_pal_top_level_acceleration_structure const *const *src_top_level_acceleration_structures) override;
     void destroy_descriptor_set(brx_pal_descriptor_set *descriptor_set) override;
-    brx_pal_render_pass *create_render_pass(uint32_t color_attachment_count, BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT const *color_attachments, BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT const *depth_stencil_attachment) const override;
+    brx_pal_descriptor_update_template *create_descriptor_update_template(brx_pal_descriptor_set_layout const *descriptor_set_layout, uint32_t entry_count, BRX_PAL_DESCRIPTOR_UPDATE_TEMPLATE_ENTRY const *entries) const override;
+    void destroy_descriptor_update_template(brx_pal_descriptor_update_template *descriptor_update_template) const override;
+    void write_descriptor_sets_with_template(uint32_t descriptor_set_count, brx_pal_descriptor_set *const *descriptor_sets, brx_pal_descriptor_update_template const *descriptor_update_template, void const *const *src_descriptors, uint32_t const *src_dynamic_uniform_buffer_ranges) override;
+    bool is_bindless_supported() const override;
+    void get_bindless_descriptor_limits(BRX_PAL_BINDLESS_DESCRIPTOR_LIMITS *bindless_descriptor_limits) const override;
+    brx_pal_descriptor_set_layout *create_bindless_descriptor_set_layout(uint32_t read_only_storage_buffer_descriptor_count, uint32_t sampled_image_descriptor_count, uint32_t sampler_descriptor_count) const override;
+    brx_pal_bindless_descriptor_index_allocator *create_bindless_descriptor_index_allocator(uint32_t read_only_storage_buffer_descriptor_count, uint32_t sampled_image_descriptor_count, uint32_t sampler_descriptor_count, uint32_t frame_throttling_count) const override;
+    void destroy_bindless_descriptor_index_allocator(brx_pal_bindless_descriptor_index_allocator *bindless_descriptor_index_allocator) const override;
+    brx_pal_render_graph *create_render_graph(uint32_t frame_throttling_count) const override;
+    void destroy_render_graph(brx_pal_render_graph *render_graph) const override;
+    brx_pal_deferred_destruction_queue *create_deferred_destruction_queue(uint32_t frame_throttling_count) override;
+    void destroy_deferred_destruction_queue(brx_pal_deferred_destruction_queue *deferred_destruction_queue) override;
+    brx_pal_acceleration_structure_update_manager *create_acceleration_structure_update_manager(BRX_PAL_ACCELERATION_STRUCTURE_UPDATE_POLICY const *policy) const override;
+    void destroy_acceleration_structure_update_manager(brx_pal_acceleration_structure_update_manager *acceleration_structure_update_manager) const override;
+    void get_object_pool_statistics(BRX_PAL_OBJECT_POOL_TYPE object_pool_type, uint32_t *live_object_count, uint32_t *reserved_object_count) const override;
+    void get_device_creation_timing(BRX_PAL_DEVICE_CREATION_TIMING *device_creation_timing) const override;
+    void get_subgroup_properties(BRX_PAL_SUBGROUP_PROPERTIES *subgroup_properties) const override;
+    brx_pal_render_pass *create_render_pass(uint32_t color_attachment_count, BRX_PAL_RENDER_PASS_COLOR_ATTACHMENT const *color_attachments, BRX_PAL_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT const *depth_stencil_attachment, uint32_t view_count) const override;
     void destroy_render_pass(brx_pal_render_pass *render_pass) const override;
-    brx_pal_graphics_pipeline *create_graphics_pipeline(brx_pal_render_pass const *render_pass, brx_pal_pipeline_layout const *pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const override;
+    brx_pal_graphics_pipeline *create_graphics_pipeline(brx_pal_render_pass const *render_pass, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const override;
+    brx_pal_graphics_pipeline *create_dynamic_rendering_graphics_pipeline(uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const override;
+    brx_pal_graphics_pipeline *create_specialized_graphics_pipeline(brx_pal_render_pass const *render_pass, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *vertex_shader_specialization, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *fragment_shader_specialization, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const override;
+    brx_pal_graphics_pipeline *create_specialized_dynamic_rendering_graphics_pipeline(uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *vertex_shader_specialization, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *fragment_shader_specialization, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const override;
     void destroy_graphics_pipeline(brx_pal_graphics_pipeline *graphics_pipeline) const override;
+    bool is_graphics_pipeline_library_supported() const override;
+    bool is_extended_dynamic_state_supported() const override;
+    brx_pal_graphics_pipeline *create_extended_dynamic_state_graphics_pipeline(brx_pal_render_pass const *render_pass, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *vertex_shader_specialization, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *fragment_shader_specialization) const override;
+    bool is_mesh_shader_supported() const override;
+    brx_pal_graphics_pipeline *create_mesh_shader_graphics_pipeline(brx_pal_render_pass const *render_pass, brx_pal_pipeline_layout const *pipeline_layout, size_t task_shader_module_code_size, void const *task_shader_module_code, size_t mesh_shader_module_code_size, void const *mesh_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const override;
+    brx_pal_graphics_pipeline *create_mesh_shader_dynamic_rendering_graphics_pipeline(uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, size_t task_shader_module_code_size, void const *task_shader_module_code, size_t mesh_shader_module_code_size, void const *mesh_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const override;
+    brx_pal_graphics_pipeline *create_extended_dynamic_state_dynamic_rendering_graphics_pipeline(uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *vertex_shader_specialization, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *fragment_shader_specialization) const override;
+    brx_pal_graphics_pipeline_pre_rasterization_shader_library *create_graphics_pipeline_pre_rasterization_shader_library(uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, bool enable_back_face_cull, bool front_ccw) const override;
+    void destroy_graphics_pipeline_pre_rasterization_shader_library(brx_pal_graphics_pipeline_pre_rasterization_shader_library *pre_rasterization_shader_library) const override;
+    brx_pal_graphics_pipeline_fragment_shader_library *create_graphics_pipeline_fragment_shader_library(uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation) const override;
+    void destroy_graphics_pipeline_fragment_shader_library(brx_pal_graphics_pipeline_fragment_shader_library *fragment_shader_library) const override;
+    brx_pal_graphics_pipeline_fragment_output_interface_library *create_graphics_pipeline_fragment_output_interface_library(uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) const override;
+    void destroy_graphics_pipeline_fragment_output_interface_library(brx_pal_graphics_pipeline_fragment_output_interface_library *fragment_output_interface_library) const override;
+    brx_pal_graphics_pipeline *create_linked_graphics_pipeline(brx_pal_pipeline_layout const *pipeline_layout, brx_pal_graphics_pipeline_pre_rasterization_shader_library const *pre_rasterization_shader_library, brx_pal_graphics_pipeline_fragment_shader_library const *fragment_shader_library, brx_pal_graphics_pipeline_fragment_output_interface_library const *fragment_output_interface_library, bool link_time_optimization) const override;
     brx_pal_compute_pipeline *create_compute_pipeline(brx_pal_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code) const override;
+    brx_pal_compute_pipeline *create_specialized_compute_pipeline(brx_pal_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *compute_shader_specialization) const override;
+    brx_pal_compute_pipeline *create_subgroup_size_control_compute_pipeline(brx_pal_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *compute_shader_specialization, uint32_t required_subgroup_size, bool require_full_subgroups) const override;
     void destroy_compute_pipeline(brx_pal_compute_pipeline *compute_pipeline) const override;
-    brx_pal_frame_buffer *create_frame_buffer(brx_pal_render_pass const *render_pass, uint32_t width, uint32_t height, uint32_t color_attachment_count, brx_pal_color_attachment_image const *const *color_attachments, brx_pal_depth_stencil_attachment_image const *depth_stencil_attachment) const override;
+    brx_pal_frame_buffer *create_frame_buffer(brx_pal_render_pass const *render_pass, uint32_t width, uint32_t height, uint32_t color_attachment_count, brx_pal_color_attachment_image const *const *color_attachments, brx_pal_color_attachment_image const *const *color_resolve_attachments, brx_pal_depth_stencil_attachment_image const *depth_stencil_attachment) const override;
     void destroy_frame_buffer(brx_pal_frame_buffer *frame_buffer) const override;
     uint32_t get_uniform_upload_buffer_offset_alignment() const override;
     brx_pal_uniform_upload_buffer *create_uniform_upload_buffer(uint32_t size) const override;
@@ -184,13 +358,30 @@ private:
     BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT get_depth_stencil_attachment_image_format() const override;
     brx_pal_depth_stencil_attachment_image *create_depth_stencil_attachment_image(BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT depth_stencil_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image) const override;
     void destroy_depth_stencil_attachment_image(brx_pal_depth_stencil_attachment_image *depth_stencil_attachment_image) const override;
+    uint32_t get_max_attachment_sample_count() const override;
+    brx_pal_color_attachment_image *create_multisample_color_attachment_image(BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT color_attachment_image_format, uint32_t width, uint32_t height, uint32_t sample_count) const override;
+    brx_pal_depth_stencil_attachment_image *create_multisample_depth_stencil_attachment_image(BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT depth_stencil_attachment_image_format, uint32_t width, uint32_t height, uint32_t sample_count) const override;
+    uint32_t get_max_multiview_view_count() const override;
+    brx_pal_color_attachment_image *create_layered_color_attachment_image(BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT color_attachment_image_format, uint32_t width, uint32_t height, uint32_t layer_count, bool allow_sampled_image) const override;
+    brx_pal_depth_stencil_attachment_image *create_layered_depth_stencil_attachment_image(BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT depth_stencil_attachment_image_format, uint32_t width, uint32_t height, uint32_t layer_count, bool allow_sampled_image) const override;
     brx_pal_storage_image *create_storage_image(BRX_PAL_STORAGE_IMAGE_FORMAT storage_image_format, uint32_t width, uint32_t height, bool allow_sampled_image) const override;
     void destroy_storage_image(brx_pal_storage_image *storage_image) const override;
+    brx_pal_memory_heap *create_memory_heap(BRX_PAL_MEMORY_HEAP_TYPE memory_heap_type, uint32_t size) const override;
+    void destroy_memory_heap(brx_pal_memory_heap *memory_heap) const override;
+    void get_color_attachment_image_memory_requirements(BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT color_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image, uint32_t *size, uint32_t *alignment) const override;
+    void get_depth_stencil_attachment_image_memory_requirements(BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT depth_stencil_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image, uint32_t *size, uint32_t *alignment) const override;
+    void get_storage_image_memory_requirements(BRX_PAL_STORAGE_IMAGE_FORMAT storage_image_format, uint32_t width, uint32_t height, bool allow_sampled_image, uint32_t *size, uint32_t *alignment) const override;
+    void get_storage_intermediate_buffer_memory_requirements(uint32_t storage_intermediate_buffer_size, uint32_t *size, uint32_t *alignment) const override;
+    brx_pal_color_attachment_image *create_placed_color_attachment_image(brx_pal_memory_heap const *memory_heap, uint32_t memory_heap_offset, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT color_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image) const override;
+    brx_pal_depth_stencil_attachment_image *create_placed_depth_stencil_attachment_image(brx_pal_memory_heap const *memory_heap, uint32_t memory_heap_offset, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT depth_stencil_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image) const override;
+    brx_pal_storage_image *create_placed_storage_image(brx_pal_memory_heap const *memory_heap, uint32_t memory_heap_offset, BRX_PAL_STORAGE_IMAGE_FORMAT storage_image_format, uint32_t width, uint32_t height, bool allow_sampled_image) const override;
+    brx_pal_storage_intermediate_buffer *create_placed_storage_intermediate_buffer(brx_pal_memory_heap const *memory_heap, uint32_t memory_heap_offset, uint32_t size) const override;
     bool is_sampled_asset_image_compression_bc_supported() const override;
     bool is_sampled_asset_image_compression_astc_supported() const override;
     brx_pal_sampled_asset_image *create_sampled_asset_image(BRX_PAL_SAMPLED_ASSET_IMAGE_FORMAT sampled_asset_image_format, uint32_t width, uint32_t height, uint32_t mip_levels) const override;
     void destroy_sampled_asset_image(brx_pal_sampled_asset_image *sampled_asset_image) const override;
     brx_pal_sampler *create_sampler(BRX_PAL_SAMPLER_FILTER filter, BRX_PAL_SAMPLER_ADDRESS_MODE address_mode) const override;
+    brx_pal_sampler *create_sampler_with_desc(BRX_PAL_SAMPLER_DESC const *sampler_desc) const override;
     void destroy_sampler(brx_pal_sampler *sampler) const override;
     brx_pal_surface *create_surface(void *wsi_window) const override;
     void destroy_surface(brx_pal_surface *surface) const override;
@@ -210,6 +401,12 @@ private:
     void destroy_compacted_bottom_level_acceleration_structure_size_query_pool(brx_pal_compacted_bottom_level_acceleration_structure_size_query_pool *compacted_bottom_level_acceleration_structure_size_query_pool) const override;
     brx_pal_compacted_bottom_level_acceleration_structure *create_compacted_bottom_level_acceleration_structure(uint32_t size) const override;
     void destroy_compacted_bottom_level_acceleration_structure(brx_pal_compacted_bottom_level_acceleration_structure *compacted_bottom_level_acceleration_structure) const override;
+    brx_pal_serialized_bottom_level_acceleration_structure_size_query_pool *create_serialized_bottom_level_acceleration_structure_size_query_pool(uint32_t query_count) const override;
+    uint32_t get_serialized_bottom_level_acceleration_structure_size_query_pool_result(brx_pal_serialized_bottom_level_acceleration_structure_size_query_pool const *serialized_bottom_level_acceleration_structure_size_query_pool, uint32_t query_index) const override;
+    void destroy_serialized_bottom_level_acceleration_structure_size_query_pool(brx_pal_serialized_bottom_level_acceleration_structure_size_query_pool *serialized_bottom_level_acceleration_structure_size_query_pool) const override;
+    brx_pal_serialized_bottom_level_acceleration_structure_buffer *create_serialized_bottom_level_acceleration_structure_buffer(uint32_t size) const override;
+    void destroy_serialized_bottom_level_acceleration_structure_buffer(brx_pal_serialized_bottom_level_acceleration_structure_buffer *serialized_bottom_level_acceleration_structure_buffer) const override;
+    bool is_serialized_bottom_level_acceleration_structure_compatible(BRX_PAL_SERIALIZED_BOTTOM_LEVEL_ACCELERATION_STRUCTURE_HEADER const *serialized_bottom_level_acceleration_structure_header) const override;
     brx_pal_top_level_acceleration_structure_instance_upload_buffer *create_top_level_acceleration_structure_instance_upload_buffer(uint32_t instance_count) const override;
     void destroy_top_level_acceleration_structure_instance_upload_buffer(brx_pal_top_level_acceleration_structure_instance_upload_buffer *top_level_acceleration_structure_instance_upload_buffer) const override;
     void get_top_level_acceleration_structure_size(uint32_t top_level_acceleration_structure_instance_count, uint32_t *top_level_acceleration_structure_size, uint32_t *build_scratch_size, uint32_t *update_scratch_size) const override;
@@ -225,15 +422,25 @@ class brx_pal_vk_graphics_queue final : public brx_pal_graphics_queue
     uint32_t m_upload_queue_family_index;
     uint32_t m_graphics_queue_family_index;
 
+    bool m_support_ray_tracing;
+    bool m_has_dedicated_compute_queue;
+
+    // waited by the next submission to the graphics queue
+    mutable VkSemaphore m_compute_queue_submit_semaphore_to_wait;
+
     PFN_vkQueueSubmit m_pfn_queue_submit;
     PFN_vkQueuePresentKHR m_pfn_queue_present;
 
 public:
-    brx_pal_vk_graphics_queue(bool has_dedicated_upload_queue, uint32_t upload_queue_family_index, uint32_t graphics_queue_family_index, VkQueue graphics_queue, PFN_vkQueueSubmit pfn_queue_submit, PFN_vkQueuePresentKHR pfn_queue_present);
+    brx_pal_vk_graphics_queue(bool has_dedicated_upload_queue, uint32_t upload_queue_family_index, uint32_t graphics_queue_family_index, bool support_ray_tracing, bool has_dedicated_compute_queue, VkQueue graphics_queue, PFN_vkQueueSubmit pfn_queue_submit, PFN_vkQueuePresentKHR pfn_queue_present);
     void wait_and_submit(brx_pal_upload_command_buffer const *upload_command_buffer, brx_pal_graphics_command_buffer const *graphics_command_buffer, brx_pal_fence *fence) const override;
     bool submit_and_present(brx_pal_graphics_command_buffer *graphics_command_buffer, brx_pal_swap_chain *swap_chain, uint32_t swap_chain_image_index, brx_pal_fence *fence) const override;
+    void wait(brx_pal_compute_command_buffer const *compute_command_buffer) const override;
     void steal(VkQueue *out_graphics_queue);
     ~brx_pal_vk_graphics_queue();
+
+private:
+    void pop_compute_queue_submit_semaphore_wait(uint32_t *wait_semaphore_count, VkSemaphore *wait_semaphores, VkPipelineStageFlags *wait_dst_stage_mask) const;
 };
 
 class brx_pal_vk_upload_queue final : public brx_pal_upload_queue
@@ -253,14 +460,35 @@ public:
     ~brx_pal_vk_upload_queue();
 };
 
+class brx_pal_vk_compute_queue final : public brx_pal_compute_queue
+{
+    VkQueue m_compute_queue;
+
+    bool m_has_dedicated_compute_queue;
+
+    PFN_vkQueueSubmit m_pfn_queue_submit;
+
+public:
+    brx_pal_vk_compute_queue(bool has_dedicated_compute_queue, VkQueue compute_queue, PFN_vkQueueSubmit pfn_queue_submit);
+    void submit_and_signal(brx_pal_compute_command_buffer const *compute_command_buffer) const override;
+    void steal(VkQueue *out_compute_queue);
+    ~brx_pal_vk_compute_queue();
+};
+
 class brx_pal_vk_graphics_command_buffer final : public brx_pal_graphics_command_buffer
 {
     bool m_support_ray_tracing;
+    bool m_support_dynamic_rendering;
+    bool m_support_extended_dynamic_state;
+    bool m_support_mesh_shader;
 
     bool m_has_dedicated_upload_queue;
     uint32_t m_graphics_queue_family_index;
     uint32_t m_upload_queue_family_index;
 
+    bool m_has_dedicated_compute_queue;
+    uint32_t m_compute_queue_family_index;
+
     VkCommandPool m_command_pool;
     VkCommandBuffer m_command_buffer;
 
@@ -277,19 +505,49 @@ class brx_pal_vk_graphics_command_buffer final : public brx_pal_graphics_command
     PFN_vkCmdBindPipeline m_pfn_cmd_bind_pipeline;
     PFN_vkCmdSetViewport m_pfn_cmd_set_view_port;
     PFN_vkCmdSetScissor m_pfn_cmd_set_scissor;
+    PFN_vkCmdSetCullModeEXT m_pfn_cmd_set_cull_mode;
+    PFN_vkCmdSetFrontFaceEXT m_pfn_cmd_set_front_face;
+    PFN_vkCmdSetDepthTestEnableEXT m_pfn_cmd_set_depth_test_enable;
+    PFN_vkCmdSetDepthCompareOpEXT m_pfn_cmd_set_depth_compare_op;
+    PFN_vkCmdSetColorBlendEnableEXT m_pfn_cmd_set_color_blend_enable;
+    PFN_vkCmdSetColorBlendEquationEXT m_pfn_cmd_set_color_blend_equation;
     PFN_vkCmdBindDescriptorSets m_pfn_cmd_bind_descriptor_sets;
+    PFN_vkCmdPushConstants m_pfn_cmd_push_constants;
     PFN_vkCmdBindVertexBuffers m_pfn_cmd_bind_vertex_buffers;
     PFN_vkCmdBindIndexBuffer m_pfn_cmd_bind_index_buffer;
     PFN_vkCmdDraw m_pfn_cmd_draw;
     PFN_vkCmdDrawIndexed m_pfn_cmd_draw_indexed;
+    PFN_vkCmdDrawMeshTasksEXT m_pfn_cmd_draw_mesh_tasks;
+    PFN_vkCmdDrawMeshTasksIndirectEXT m_pfn_cmd_draw_mesh_tasks_indirect;
+    PFN_vkCmdDrawMeshTasksIndirectCountEXT m_pfn_cmd_draw_mesh_tasks_indirect_count;
     PFN_vkCmdEndRenderPass m_pfn_cmd_end_render_pass;
+    PFN_vkCmdBeginRenderingKHR m_pfn_cmd_begin_rendering;
+    PFN_vkCmdEndRenderingKHR m_pfn_cmd_end_rendering;
     PFN_vkCmdDispatch m_pfn_cmd_dispatch;
+    PFN_vkCmdCopyBuffer m_pfn_cmd_copy_buffer;
+    PFN_vkCmdCopyImage m_pfn_cmd_copy_image;
+    PFN_vkCmdFillBuffer m_pfn_cmd_fill_buffer;
+    PFN_vkCmdClearColorImage m_pfn_cmd_clear_color_image;
     PFN_vkCmdBuildAccelerationStructuresKHR m_pfn_cmd_build_acceleration_structure;
     PFN_vkEndCommandBuffer m_pfn_end_command_buffer;
 
+    // the store barriers are recorded by the "begin_rendering" and used by the "end_rendering"
+    VkPipelineStageFlags m_end_rendering_destination_stage_mask;
+    mcrt_vector<VkImageMemoryBarrier> m_end_rendering_store_barriers;
+
+    // the color attachment count is recorded by the "begin_render_pass" or "begin_rendering" and used by the "set_blend_operation"
+    uint32_t m_color_attachment_count;
+
+    // the vertex binding count is recorded by the "bind_graphics_pipeline" and used by the "bind_vertex_buffers"
+    uint32_t m_current_vertex_binding_count;
+
+    // the source scope is recorded by the "aliasing_barrier" and used by the load barrier of the next "begin_rendering" or "compute_pass_load"
+    VkPipelineStageFlags m_aliasing_source_stage_mask;
+    VkAccessFlags m_aliasing_source_access_mask;
+
 public:
     brx_pal_vk_graphics_command_buffer();
-    void init(bool support_ray_tracing, bool has_dedicated_upload_queue, uint32_t graphics_queue_family_index, uint32_t upload_queue_family_index, PFN_vkGetInstanceProcAddr pfn_get_instance_proc_addr, VkInstance instance, PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
+    void init(bool support_ray_tracing, bool support_dynamic_rendering, bool support_extended_dynamic_state, bool support_mesh_shader, bool has_dedicated_upload_queue, uint32_t graphics_queue_family_index, uint32_t upload_queue_family_index, bool has_dedicated_compute_queue, uint32_t compute_queue_family_index, PFN_vkGetInstanceProcAddr pfn_get_instance_proc_addr, VkInstance instance, PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
     void uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
     ~brx_pal_vk_graphics_command_buffer();
     VkCommandPool get_command_pool() const;
@@ -304,15 +562,34 @@ public:
     void bind_graphics_pipeline(brx_pal_graphics_pipeline const *graphics_pipeline) override;
     void set_view_port(uint32_t width, uint32_t height) override;
     void set_scissor(int32_t offset_width, int32_t offset_height, uint32_t width, uint32_t height) override;
+    void set_cull_mode(bool enable_back_face_cull, bool front_ccw) override;
+    void set_depth_compare_operation(BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation) override;
+    void set_blend_operation(BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation) override;
     void bind_graphics_descriptor_sets(brx_pal_pipeline_layout const *pipeline_layout, uint32_t descriptor_set_count, brx_pal_descriptor_set const *const *descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets) override;
+    void push_graphics_constants(brx_pal_pipeline_layout const *pipeline_layout, uint32_t offset, uint32_t size, void const *constants) override;
     void draw(uint32_t vertex_count, uint32_t instance_count, uint32_t first_vertex, uint32_t first_instance) override;
+    void bind_vertex_buffers(uint32_t first_binding, uint32_t binding_count, brx_pal_storage_asset_buffer const *const *vertex_buffers, uint64_t const *offsets) override;
+    void bind_index_buffer(brx_pal_storage_asset_buffer const *index_buffer, uint64_t offset, BRX_PAL_GRAPHICS_PIPELINE_INDEX_TYPE index_type) override;
+    void draw_indexed(uint32_t index_count, uint32_t instance_count, uint32_t first_index, int32_t vertex_offset, uint32_t first_instance) override;
+    void draw_mesh_tasks(uint32_t group_count_x, uint32_t group_count_y, uint32_t group_count_z) override;
+    void draw_mesh_tasks_indirect(brx_pal_storage_buffer const *argument_buffer, uint64_t argument_offset, uint32_t draw_count) override;
+    void draw_mesh_tasks_indirect_count(brx_pal_storage_buffer const *argument_buffer, uint64_t argument_offset, brx_pal_storage_buffer const *count_buffer, uint64_t count_offset, uint32_t max_draw_count) override;
     void end_render_pass() override;
+    void begin_rendering(uint32_t width, uint32_t height, uint32_t view_count, uint32_t color_attachment_count, BRX_PAL_RENDERING_COLOR_ATTACHMENT const *color_attachments, BRX_PAL_RENDERING_DEPTH_STENCIL_ATTACHMENT const *depth_stencil_attachment) override;
+    void end_rendering() override;
+    void aliasing_barrier(uint32_t color_attachment_image_count, brx_pal_color_attachment_image const *const *color_attachment_images, uint32_t depth_stencil_attachment_image_count, brx_pal_depth_stencil_attachment_image const *const *depth_stencil_attachment_images, uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *storage_buffers, uint32_t storage_image_count, brx_pal_storage_image const *const *storage_images) override;
     void compute_pass_load(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *storage_buffers, BRX_PAL_COMPUTE_PASS_STORAGE_BUFFER_LOAD_OPERATION const *storage_buffer_load_operations, uint32_t storage_image_count, brx_pal_storage_image const *const *storage_images, BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_LOAD_OPERATION const *storage_image_load_operations) override;
     void bind_compute_pipeline(brx_pal_compute_pipeline const *compute_pipeline) override;
     void bind_compute_descriptor_sets(brx_pal_pipeline_layout const *pipeline_layout, uint32_t descriptor_set_count, brx_pal_descriptor_set const *const *descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets) override;
+    void push_compute_constants(brx_pal_pipeline_layout const *pipeline_layout, uint32_t offset, uint32_t size, void const *constants) override;
     void dispatch(uint32_t group_count_x, uint32_t group_count_y, uint32_t group_count_z) override;
     void compute_pass_barrier(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *storage_buffers, uint32_t storage_image_count, brx_pal_storage_image const *const *storage_images) override;
     void compute_pass_store(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *storage_buffers, BRX_PAL_COMPUTE_PASS_STORAGE_BUFFER_STORE_OPERATION const *storage_buffer_store_operations, uint32_t storage_image_count, brx_pal_storage_image const *const *storage_images, BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_STORE_OPERATION const *storage_image_store_operations) override;
+    void acquire(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *storage_buffers, uint32_t storage_image_count, brx_pal_storage_image const *const *storage_images) override;
+    void copy_buffer(brx_pal_storage_buffer const *dst_storage_buffer, uint64_t dst_offset, brx_pal_storage_buffer const *src_storage_buffer, uint64_t src_offset, uint32_t src_size) override;
+    void copy_image(brx_pal_storage_image const *dst_storage_image, brx_pal_storage_image const *src_storage_image, uint32_t width, uint32_t height) override;
+    void fill_buffer(brx_pal_storage_buffer const *dst_storage_buffer, uint64_t dst_offset, uint32_t dst_size, uint32_t data) override;
+    void clear_storage_image(brx_pal_storage_image const *storage_image, float const *color_clear_value) override;
     void build_intermediate_bottom_level_acceleration_structure(brx_pal_intermediate_bottom_level_acceleration_structure *intermediate_bottom_level_acceleration_structure, uint32_t bottom_level_acceleration_structure_geometry_count, BRX_PAL_BOTTOM_LEVEL_ACCELERATION_STRUCTURE_GEOMETRY const *bottom_level_acceleration_structure_geometries, brx_pal_scratch_buffer *scratch_buffer) override;
     void build_intermediate_bottom_level_acceleration_structure_store(uint32_t intermediate_bottom_level_acceleration_structure_count, brx_pal_intermediate_bottom_level_acceleration_structure const *const *intermediate_bottom_level_acceleration_structures) override;
     void update_intermediate_bottom_level_acceleration_structure(brx_pal_intermediate_bottom_level_acceleration_structure *intermediate_bottom_level_acceleration_structure, brx_pal_acceleration_structure_build_input_read_only_buffer const *const *bottom_level_acceleration_structure_geometry_vertex_position_buffers, brx_pal_scratch_buffer *scratch_buffer) override;
@@ -321,7 +598,13 @@ public:
     void build_top_level_acceleration_structure_store(brx_pal_top_level_acceleration_structure *top_level_acceleration_structure) override;
     void update_top_level_acceleration_structure(brx_pal_top_level_acceleration_structure *top_level_acceleration_structure, brx_pal_top_level_acceleration_structure_instance_upload_buffer *top_level_acceleration_structure_instance_upload_buffer, brx_pal_scratch_buffer *scratch_buffer) override;
     void update_top_level_acceleration_structure_store(brx_pal_top_level_acceleration_structure *top_level_acceleration_structure) override;
+    void build_top_level_acceleration_structure_from_device_instances(brx_pal_top_level_acceleration_structure *top_level_acceleration_structure, uint32_t top_level_acceleration_structure_instance_count, brx_pal_acceleration_structure_build_input_read_only_buffer const *top_level_acceleration_structure_device_instance_buffer, brx_pal_scratch_buffer *scratch_buffer) override;
+    void update_top_level_acceleration_structure_from_device_instances(brx_pal_top_level_acceleration_structure *top_level_acceleration_structure, brx_pal_acceleration_structure_build_input_read_only_buffer const *top_level_acceleration_structure_device_instance_buffer, brx_pal_scratch_buffer *scratch_buffer) override;
     void end() override;
+
+private:
+    void build_top_level_acceleration_structure(brx_pal_top_level_acceleration_structure *top_level_acceleration_structure, uint32_t top_level_acceleration_structure_instance_count, VkDeviceAddress top_level_acceleration_structure_instance_buffer_device_memory_range_base, brx_pal_scratch_buffer *scratch_buffer);
+    void update_top_level_acceleration_structure(brx_pal_top_level_acceleration_structure *top_level_acceleration_structure, VkDeviceAddress top_level_acceleration_structure_instance_buffer_device_memory_range_base, brx_pal_scratch_buffer *scratch_buffer);
 };
 
 class brx_pal_vk_upload_command_buffer final : public brx_pal_upload_command_buffer
@@ -347,6 +630,8 @@ class brx_pal_vk_upload_command_buffer final : public brx_pal_upload_command_buf
     PFN_vkCmdResetQueryPool m_pfn_cmd_reset_query_pool;
     PFN_vkCmdWriteAccelerationStructuresPropertiesKHR m_pfn_cmd_write_acceleration_structures_properties;
     PFN_vkCmdCopyAccelerationStructureKHR m_pfn_cmd_copy_acceleration_structure;
+    PFN_vkCmdCopyAccelerationStructureToMemoryKHR m_pfn_cmd_copy_acceleration_structure_to_memory;
+    PFN_vkCmdCopyMemoryToAccelerationStructureKHR m_pfn_cmd_copy_memory_to_acceleration_structure;
     PFN_vkEndCommandBuffer m_pfn_end_command_buffer;
 
 public:
@@ -366,10 +651,59 @@ public:
     void build_non_compacted_bottom_level_acceleration_structure(brx_pal_non_compacted_bottom_level_acceleration_structure *non_compacted_bottom_level_acceleration_structure, uint32_t bottom_level_acceleration_structure_geometry_count, BRX_PAL_BOTTOM_LEVEL_ACCELERATION_STRUCTURE_GEOMETRY const *bottom_level_acceleration_structure_geometries, brx_pal_scratch_buffer *scratch_buffer, brx_pal_compacted_bottom_level_acceleration_structure_size_query_pool *compacted_bottom_level_acceleration_structure_size_query_pool, uint32_t query_index) override;
     void build_non_compacted_bottom_level_acceleration_structure_pass_store(uint32_t acceleration_structure_build_input_read_only_buffer_count, brx_pal_acceleration_structure_build_input_read_only_buffer const *const *acceleration_structure_build_input_read_only_buffers) override;
     void compact_bottom_level_acceleration_structure(brx_pal_compacted_bottom_level_acceleration_structure *destination_compacted_bottom_level_acceleration_structure, brx_pal_non_compacted_bottom_level_acceleration_structure *source_non_compacted_bottom_level_acceleration_structure) override;
+    void write_serialized_bottom_level_acceleration_structure_size(brx_pal_compacted_bottom_level_acceleration_structure const *compacted_bottom_level_acceleration_structure, brx_pal_serialized_bottom_level_acceleration_structure_size_query_pool *serialized_bottom_level_acceleration_structure_size_query_pool, uint32_t query_index) override;
+    void serialize_compacted_bottom_level_acceleration_structure(brx_pal_serialized_bottom_level_acceleration_structure_buffer *destination_serialized_bottom_level_acceleration_structure_buffer, brx_pal_compacted_bottom_level_acceleration_structure const *source_compacted_bottom_level_acceleration_structure) override;
+    void deserialize_compacted_bottom_level_acceleration_structure(brx_pal_compacted_bottom_level_acceleration_structure *destination_compacted_bottom_level_acceleration_structure, brx_pal_serialized_bottom_level_acceleration_structure_buffer const *source_serialized_bottom_level_acceleration_structure_buffer) override;
     void release(uint32_t storage_asset_buffer_count, brx_pal_storage_asset_buffer const *const *storage_asset_buffers, uint32_t sampled_asset_image_subresource_count, BRX_PAL_SAMPLED_ASSET_IMAGE_SUBRESOURCE const *sampled_asset_image_subresources, uint32_t compacted_bottom_level_acceleration_structure_count, brx_pal_compacted_bottom_level_acceleration_structure const *const *compacted_bottom_level_acceleration_structures) override;
     void end() override;
 };
 
+class brx_pal_vk_compute_command_buffer final : public brx_pal_compute_command_buffer
+{
+    bool m_support_ray_tracing;
+
+    bool m_has_dedicated_compute_queue;
+    uint32_t m_graphics_queue_family_index;
+    uint32_t m_compute_queue_family_index;
+
+    VkCommandPool m_command_pool;
+    VkCommandBuffer m_command_buffer;
+
+    VkSemaphore m_compute_queue_submit_semaphore;
+
+    PFN_vkBeginCommandBuffer m_pfn_begin_command_buffer;
+    PFN_vkCmdPipelineBarrier m_pfn_cmd_pipeline_barrier;
+#ifndef NDEBUG
+    PFN_vkCmdBeginDebugUtilsLabelEXT m_pfn_cmd_begin_debug_utils_label;
+    PFN_vkCmdEndDebugUtilsLabelEXT m_pfn_cmd_end_debug_utils_label;
+#endif
+    PFN_vkCmdBindPipeline m_pfn_cmd_bind_pipeline;
+    PFN_vkCmdBindDescriptorSets m_pfn_cmd_bind_descriptor_sets;
+    PFN_vkCmdPushConstants m_pfn_cmd_push_constants;
+    PFN_vkCmdDispatch m_pfn_cmd_dispatch;
+    PFN_vkEndCommandBuffer m_pfn_end_command_buffer;
+
+public:
+    brx_pal_vk_compute_command_buffer();
+    void init(bool support_ray_tracing, bool has_dedicated_compute_queue, uint32_t graphics_queue_family_index, uint32_t compute_queue_family_index, PFN_vkGetInstanceProcAddr pfn_get_instance_proc_addr, VkInstance instance, PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
+    void uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
+    ~brx_pal_vk_compute_command_buffer();
+    VkCommandPool get_command_pool() const;
+    VkCommandBuffer get_command_buffer() const;
+    VkSemaphore get_compute_queue_submit_semaphore() const;
+    void begin() override;
+    void begin_debug_utils_label(char const *label_name) override;
+    void end_debug_utils_label() override;
+    void compute_pass_load(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *storage_buffers, BRX_PAL_COMPUTE_PASS_STORAGE_BUFFER_LOAD_OPERATION const *storage_buffer_load_operations, uint32_t storage_image_count, brx_pal_storage_image const *const *storage_images, BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_LOAD_OPERATION const *storage_image_load_operations) override;
+    void bind_compute_pipeline(brx_pal_compute_pipeline const *compute_pipeline) override;
+    void bind_compute_descriptor_sets(brx_pal_pipeline_layout const *pipeline_layout, uint32_t descriptor_set_count, brx_pal_descriptor_set const *const *descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets) override;
+    void push_compute_constants(brx_pal_pipeline_layout const *pipeline_layout, uint32_t offset, uint32_t size, void const *constants) override;
+    void dispatch(uint32_t group_count_x, uint32_t group_count_y, uint32_t group_count_z) override;
+    void compute_pass_barrier(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *storage_buffers, uint32_t storage_image_count, brx_pal_storage_image const *const *storage_images) override;
+    void compute_pass_store(uint32_t storage_buffer_count, brx_pal_storage_buffer const *const *storage_buffers, BRX_PAL_COMPUTE_PASS_STORAGE_BUFFER_STORE_OPERATION const *storage_buffer_store_operations, uint32_t storage_image_count, brx_pal_storage_image const *const *storage_images, BRX_PAL_COMPUTE_PASS_STORAGE_IMAGE_STORE_OPERATION const *storage_image_store_operations) override;
+    void end() override;
+};
+
 class brx_pal_vk_fence final : public brx_pal_fence
 {
     VkFence m_fence;
@@ -391,10 +725,12 @@ class brx_pal_vk_descriptor_set_layout final : public brx_pal_descriptor_set_lay
     uint32_t m_storage_image_descriptor_count;
     uint32_t m_top_level_acceleration_structure_descriptor_count;
     VkDescriptorType m_unbounded_descriptor_type;
+    bool m_update_after_bind;
 
 public:
     brx_pal_vk_descriptor_set_layout();
     void init(uint32_t support_ray_tracing, uint32_t descriptor_set_binding_count, BRX_PAL_DESCRIPTOR_SET_LAYOUT_BINDING const *descriptor_set_bindings, uint32_t max_per_stage_descriptor_storage_buffers, uint32_t max_per_stage_descriptor_sampled_images, uint32_t max_descriptor_set_storage_buffers, uint32_t max_descriptor_set_sampled_images, PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
+    void init_bindless(uint32_t read_only_storage_buffer_descriptor_count, uint32_t sampled_image_descriptor_count, uint32_t sampler_descriptor_count, PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
     void uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
     ~brx_pal_vk_descriptor_set_layout();
     VkDescriptorSetLayout get_descriptor_set_layout() const;
@@ -405,6 +741,7 @@ public:
     uint32_t get_storage_image_descriptor_count() const;
     uint32_t get_top_level_acceleration_structure_descriptor_count() const;
     VkDescriptorType get_unbounded_descriptor_type() const;
+    bool is_update_after_bind() const;
 };
 
 class brx_pal_vk_pipeline_layout final : public brx_pal_pipeline_layout
@@ -432,15 +769,43 @@ public:
     VkDescriptorSet get_descriptor_set() const;
 };
 
+union brx_pal_vk_descriptor_update_template_data
+{
+    VkDescriptorBufferInfo m_buffer_info;
+    VkDescriptorImageInfo m_image_info;
+    VkAccelerationStructureKHR m_acceleration_structure;
+};
+
+class brx_pal_vk_descriptor_update_template final : public brx_pal_descriptor_update_template
+{
+    // VK_NULL_HANDLE if the VK_KHR_descriptor_update_template is NOT supported
+    VkDescriptorUpdateTemplateKHR m_descriptor_update_template;
+    mcrt_vector<BRX_PAL_DESCRIPTOR_UPDATE_TEMPLATE_ENTRY> m_entries;
+    mcrt_vector<VkDescriptorUpdateTemplateEntryKHR> m_descriptor_update_template_entries;
+    uint32_t m_descriptor_count;
+
+public:
+    brx_pal_vk_descriptor_update_template();
+    void init(brx_pal_descriptor_set_layout const *descriptor_set_layout, uint32_t entry_count, BRX_PAL_DESCRIPTOR_UPDATE_TEMPLATE_ENTRY const *entries, bool support_descriptor_update_template, PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
+    void uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
+    ~brx_pal_vk_descriptor_update_template();
+    void write_descriptor_sets(uint32_t descriptor_set_count, brx_pal_descriptor_set *const *descriptor_sets, void const *const *src_descriptors, uint32_t const *src_dynamic_uniform_buffer_ranges, PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device) const;
+
+private:
+    void write_descriptor_set_without_template(VkDescriptorSet descriptor_set, brx_pal_vk_descriptor_update_template_data const *descriptor_update_template_data, PFN_vkUpdateDescriptorSets pfn_update_descriptor_sets, VkDevice device) const;
+};
+
 class brx_pal_vk_render_pass final : public brx_pal_render_pass
 {
     VkRenderPass m_render_pass;
     uint32_t m_color_attachment_count;
+    uint32_t m_sample_count;
 
 public:
-    brx_pal_vk_render_pass(VkRenderPass render_pass, uint32_t color_attachment_count);
+    brx_pal_vk_render_pass(VkRenderPass render_pass, uint32_t color_attachment_count, uint32_t sample_count);
     VkRenderPass get_render_pass() const;
     uint32_t get_color_attachment_count() const;
+    uint32_t get_sample_count() const;
     void steal(VkRenderPass *out_render_pass);
     ~brx_pal_vk_render_pass();
 };
@@ -448,23 +813,101 @@ public:
 class brx_pal_vk_graphics_pipeline final : public brx_pal_graphics_pipeline
 {
     VkPipeline m_pipeline;
+    brx_pal_vk_shader_module_cache_entry *m_vertex_shader_module;
+    brx_pal_vk_shader_module_cache_entry *m_task_shader_module;
+    brx_pal_vk_shader_module_cache_entry *m_mesh_shader_module;
+    brx_pal_vk_shader_module_cache_entry *m_fragment_shader_module;
+    uint32_t m_vertex_binding_count;
 
 public:
     brx_pal_vk_graphics_pipeline();
-    void init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, brx_pal_render_pass const *render_pass, brx_pal_pipeline_layout const *pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation);
-    void uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
+    void init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, brx_pal_vk_shader_module_cache *shader_module_cache, brx_pal_render_pass const *render_pass, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *vertex_shader_specialization, size_t task_shader_module_code_size, void const *task_shader_module_code, size_t mesh_shader_module_code_size, void const *mesh_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *fragment_shader_specialization, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation, bool extended_dynamic_state);
+    void init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, brx_pal_vk_shader_module_cache *shader_module_cache, uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *vertex_shader_specialization, size_t task_shader_module_code_size, void const *task_shader_module_code, size_t mesh_shader_module_code_size, void const *mesh_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *fragment_shader_specialization, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation, bool extended_dynamic_state);
+    void init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, brx_pal_vk_shader_module_cache *shader_module_cache, VkPipeline vertex_input_interface_library, brx_pal_pipeline_layout const *pipeline_layout, brx_pal_graphics_pipeline_pre_rasterization_shader_library const *pre_rasterization_shader_library, brx_pal_graphics_pipeline_fragment_shader_library const *fragment_shader_library, brx_pal_graphics_pipeline_fragment_output_interface_library const *fragment_output_interface_library, bool link_time_optimization);
+    void uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, brx_pal_vk_shader_module_cache *shader_module_cache);
     ~brx_pal_vk_graphics_pipeline();
     VkPipeline get_pipeline() const;
+    uint32_t get_vertex_binding_count() const;
+
+private:
+    void init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, brx_pal_vk_shader_module_cache *shader_module_cache, void const *graphics_pipeline_create_info_next, VkRenderPass render_pass, uint32_t color_attachment_count, uint32_t sample_count, brx_pal_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *vertex_shader_specialization, size_t task_shader_module_code_size, void const *task_shader_module_code, size_t mesh_shader_module_code_size, void const *mesh_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *fragment_shader_specialization, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation, bool extended_dynamic_state);
+};
+
+// the library is NOT created if the graphics pipeline library is NOT supported, and the linking falls back to the monolithic graphics pipeline by the recorded states
+class brx_pal_vk_graphics_pipeline_pre_rasterization_shader_library final : public brx_pal_graphics_pipeline_pre_rasterization_shader_library
+{
+    VkPipeline m_library;
+    brx_pal_vk_shader_module_cache_entry *m_vertex_shader_module;
+    mcrt_vector<uint32_t> m_vertex_shader_module_code;
+    uint32_t m_view_count;
+    bool m_enable_back_face_cull;
+    bool m_front_ccw;
+
+public:
+    brx_pal_vk_graphics_pipeline_pre_rasterization_shader_library();
+    void init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, brx_pal_vk_shader_module_cache *shader_module_cache, bool support_graphics_pipeline_library, uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, bool enable_back_face_cull, bool front_ccw);
+    void uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, brx_pal_vk_shader_module_cache *shader_module_cache);
+    ~brx_pal_vk_graphics_pipeline_pre_rasterization_shader_library();
+    VkPipeline get_library() const;
+    size_t get_vertex_shader_module_code_size() const;
+    void const *get_vertex_shader_module_code() const;
+    uint32_t get_view_count() const;
+    bool get_enable_back_face_cull() const;
+    bool get_front_ccw() const;
+};
+
+class brx_pal_vk_graphics_pipeline_fragment_shader_library final : public brx_pal_graphics_pipeline_fragment_shader_library
+{
+    VkPipeline m_library;
+    brx_pal_vk_shader_module_cache_entry *m_fragment_shader_module;
+    mcrt_vector<uint32_t> m_fragment_shader_module_code;
+    uint32_t m_view_count;
+    BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION m_depth_compare_operation;
+
+public:
+    brx_pal_vk_graphics_pipeline_fragment_shader_library();
+    void init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, brx_pal_vk_shader_module_cache *shader_module_cache, bool support_graphics_pipeline_library, uint32_t view_count, brx_pal_pipeline_layout const *pipeline_layout, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION depth_compare_operation);
+    void uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, brx_pal_vk_shader_module_cache *shader_module_cache);
+    ~brx_pal_vk_graphics_pipeline_fragment_shader_library();
+    VkPipeline get_library() const;
+    size_t get_fragment_shader_module_code_size() const;
+    void const *get_fragment_shader_module_code() const;
+    uint32_t get_view_count() const;
+    BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION get_depth_compare_operation() const;
+};
+
+class brx_pal_vk_graphics_pipeline_fragment_output_interface_library final : public brx_pal_graphics_pipeline_fragment_output_interface_library
+{
+    VkPipeline m_library;
+    mcrt_vector<BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT> m_color_attachment_formats;
+    mcrt_vector<BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT> m_depth_stencil_attachment_format;
+    uint32_t m_sample_count;
+    uint32_t m_view_count;
+    BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION m_blend_operation;
+
+public:
+    brx_pal_vk_graphics_pipeline_fragment_output_interface_library();
+    void init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, bool support_graphics_pipeline_library, uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION blend_operation);
+    void uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
+    ~brx_pal_vk_graphics_pipeline_fragment_output_interface_library();
+    VkPipeline get_library() const;
+    uint32_t get_color_attachment_count() const;
+    BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *get_color_attachment_formats() const;
+    BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *get_depth_stencil_attachment_format() const;
+    uint32_t get_sample_count() const;
+    uint32_t get_view_count() const;
+    BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION get_blend_operation() const;
 };
 
 class brx_pal_vk_compute_pipeline final : public brx_pal_compute_pipeline
 {
     VkPipeline m_pipeline;
+    brx_pal_vk_shader_module_cache_entry *m_compute_shader_module;
 
 public:
     brx_pal_vk_compute_pipeline();
-    void init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, brx_pal_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code);
-    void uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
+    void init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, brx_pal_vk_shader_module_cache *shader_module_cache, brx_pal_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *compute_shader_specialization, uint32_t required_subgroup_size, bool require_full_subgroups);
+    void uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, brx_pal_vk_shader_module_cache *shader_module_cache);
     ~brx_pal_vk_compute_pipeline();
     VkPipeline get_pipeline() const;
 };
@@ -480,6 +923,23 @@ public:
     ~brx_pal_vk_frame_buffer();
 };
 
+// the memory heap is sub-allocated from the memory pool of the same resource category, and the placed resources are bound to the memory heap by the "vmaCreateAliasing*2"
+class brx_pal_vk_memory_heap final : public brx_pal_memory_heap
+{
+    VmaAllocation m_allocation;
+    BRX_PAL_MEMORY_HEAP_TYPE m_type;
+    VkDeviceSize m_size;
+
+public:
+    brx_pal_vk_memory_heap();
+    void init(VmaAllocator memory_allocator, VmaPool memory_pool, BRX_PAL_MEMORY_HEAP_TYPE memory_heap_type, uint32_t size);
+    void uninit(VmaAllocator memory_allocator);
+    ~brx_pal_vk_memory_heap();
+    VmaAllocation get_allocation() const;
+    BRX_PAL_MEMORY_HEAP_TYPE get_type() const;
+    VkDeviceSize get_size() const;
+};
+
 class brx_pal_vk_uniform_upload_buffer final : public brx_pal_uniform_upload_buffer
 {
     VkBuffer m_buffer;
@@ -540,7 +1000,8 @@ class brx_pal_vk_storage_intermediate_buffer final : public brx_pal_storage_inte
 
 public:
     brx_pal_vk_storage_intermediate_buffer();
-    void init(bool support_ray_tracing, VkDevice device, PFN_vkGetBufferDeviceAddressKHR pfn_get_buffer_device_address, VmaAllocator memory_allocator, VmaPool storage_intermediate_buffer_memory_pool, uint32_t size);
+    void init(bool support_ray_tracing, VkDevice device, PFN_vkGetBufferDeviceAddressKHR pfn_get_buffer_device_address, VmaAllocator memory_allocator, VmaPool storage_intermediate_buffer_memory_pool, VmaAllocation memory_heap_allocation, VkDeviceSize memory_heap_offset, uint32_t size);
+    static void get_memory_requirements(bool support_ray_tracing, VkDevice device, PFN_vkCreateBuffer pfn_create_buffer, PFN_vkGetBufferMemoryRequirements pfn_get_buffer_memory_requirements, PFN_vkDestroyBuffer pfn_destroy_buffer, VkAllocationCallbacks const *allocation_callbacks, uint32_t size, VkMemoryRequirements *out_memory_requirements);
     void uninit(VmaAllocator memory_allocator);
     ~brx_pal_vk_storage_intermediate_buffer();
 
@@ -584,13 +1045,16 @@ public:
 class brx_pal_vk_color_attachment_image : public brx_pal_color_attachment_image
 {
 public:
+    virtual VkImage get_image() const = 0;
     virtual VkImageView get_image_view() const = 0;
 };
 
 class brx_pal_vk_depth_stencil_attachment_image : public brx_pal_depth_stencil_attachment_image
 {
 public:
+    virtual VkImage get_image() const = 0;
     virtual VkImageView get_image_view() const = 0;
+    virtual VkImageAspectFlags get_aspect_mask() const = 0;
 };
 
 class brx_pal_vk_storage_image : public brx_pal_storage_image
@@ -598,6 +1062,7 @@ class brx_pal_vk_storage_image : public brx_pal_storage_image
 public:
     virtual VkImage get_image() const = 0;
     virtual VkImageView get_image_view() const = 0;
+    virtual VkFormat get_format() const = 0;
 };
 
 class brx_pal_vk_color_attachment_intermediate_image final : public brx_pal_vk_color_attachment_image, brx_pal_vk_sampled_image
@@ -608,11 +1073,13 @@ class brx_pal_vk_color_attachment_intermediate_image final : public brx_pal_vk_c
 
 public:
     brx_pal_vk_color_attachment_intermediate_image();
-    void init(VkDevice device, PFN_vkCreateImageView pfn_create_image_view, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator, VmaPool color_transient_attachment_image_memory_pool, VmaPool color_attachment_sampled_image_memory_pool, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT color_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image);
+    void init(VkDevice device, PFN_vkCreateImageView pfn_create_image_view, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator, VmaPool color_attachment_image_memory_pool, VmaAllocation memory_heap_allocation, VkDeviceSize memory_heap_offset, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT color_attachment_image_format, uint32_t width, uint32_t height, uint32_t layer_count, uint32_t sample_count, bool allow_sampled_image);
+    static void get_memory_requirements(VkDevice device, PFN_vkCreateImage pfn_create_image, PFN_vkGetImageMemoryRequirements pfn_get_image_memory_requirements, PFN_vkDestroyImage pfn_destroy_image, VkAllocationCallbacks const *allocation_callbacks, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT color_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image, VkMemoryRequirements *out_memory_requirements);
     void uninit(VkDevice device, PFN_vkDestroyImageView pfn_destroy_image_view, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator);
     ~brx_pal_vk_color_attachment_intermediate_image();
 
 private:
+    VkImage get_image() const override;
     VkImageView get_image_view() const override;
     brx_pal_sampled_image const *get_sampled_image() const override;
 };
@@ -622,15 +1089,19 @@ class brx_pal_vk_depth_stencil_attachment_intermediate_image final : public brx_
     VkImage m_image;
     VmaAllocation m_allocation;
     VkImageView m_image_view;
+    VkImageAspectFlags m_aspect_mask;
 
 public:
     brx_pal_vk_depth_stencil_attachment_intermediate_image();
-    void init(VkDevice device, PFN_vkCreateImageView pfn_create_image_view, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator, VmaPool depth_transient_attachment_image_memory_pool, VmaPool depth_attachment_sampled_image_memory_pool, VmaPool depth_stencil_transient_attachment_image_memory_pool, VmaPool depth_stencil_attachment_sampled_image_memory_pool, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT depth_stencil_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image);
+    void init(VkDevice device, PFN_vkCreateImageView pfn_create_image_view, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator, VmaPool depth_stencil_attachment_image_memory_pool, VmaAllocation memory_heap_allocation, VkDeviceSize memory_heap_offset, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT depth_stencil_attachment_image_format, uint32_t width, uint32_t height, uint32_t layer_count, uint32_t sample_count, bool allow_sampled_image);
+    static void get_memory_requirements(VkDevice device, PFN_vkCreateImage pfn_create_image, PFN_vkGetImageMemoryRequirements pfn_get_image_memory_requirements, PFN_vkDestroyImage pfn_destroy_image, VkAllocationCallbacks const *allocation_callbacks, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT depth_stencil_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image, VkMemoryRequirements *out_memory_requirements);
     void uninit(VkDevice device, PFN_vkDestroyImageView pfn_destroy_image_view, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator);
     ~brx_pal_vk_depth_stencil_attachment_intermediate_image();
 
 private:
+    VkImage get_image() const override;
     VkImageView get_image_view() const override;
+    VkImageAspectFlags get_aspect_mask() const override;
     brx_pal_sampled_image const *get_sampled_image() const override;
 };
 
@@ -639,16 +1110,19 @@ class brx_pal_vk_storage_intermediate_image final : public brx_pal_vk_storage_im
     VkImage m_image;
     VmaAllocation m_allocation;
     VkImageView m_image_view;
+    VkFormat m_format;
 
 public:
     brx_pal_vk_storage_intermediate_image();
-    void init(VkDevice device, PFN_vkCreateImageView pfn_create_image_view, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator, VmaPool storage_intermediate_image_memory_pool, VkFormat storage_image_format, uint32_t width, uint32_t height, bool allow_sampled_image);
+    void init(VkDevice device, PFN_vkCreateImageView pfn_create_image_view, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator, VmaPool storage_intermediate_image_memory_pool, VmaAllocation memory_heap_allocation, VkDeviceSize memory_heap_offset, VkFormat storage_image_format, uint32_t width, uint32_t height, bool allow_sampled_image);
+    static void get_memory_requirements(VkDevice device, PFN_vkCreateImage pfn_create_image, PFN_vkGetImageMemoryRequirements pfn_get_image_memory_requirements, PFN_vkDestroyImage pfn_destroy_image, VkAllocationCallbacks const *allocation_callbacks, VkFormat storage_image_format, uint32_t width, uint32_t height, bool allow_sampled_image, VkMemoryRequirements *out_memory_requirements);
     void uninit(VkDevice device, PFN_vkDestroyImageView pfn_destroy_image_view, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator);
     ~brx_pal_vk_storage_intermediate_image();
 
 private:
     VkImage get_image() const override;
     VkImageView get_image_view() const override;
+    VkFormat get_format() const override;
     brx_pal_sampled_image const *get_sampled_image() const override;
 };
 
@@ -672,15 +1146,27 @@ private:
     uint32_t get_mip_levels() const override;
 };
 
+// the samplers with the same hash are linked by the "next", and the sampler state is compared to resolve the hash collision
 class brx_pal_vk_sampler final : public brx_pal_sampler
 {
+    brx_pal_vk_sampler *m_next;
+    uint64_t m_sampler_desc_hash;
+    BRX_PAL_SAMPLER_DESC m_sampler_desc;
     VkSampler m_sampler;
+    uint32_t m_reference_count;
 
 public:
-    brx_pal_vk_sampler(VkSampler sampler);
+    brx_pal_vk_sampler(uint64_t sampler_desc_hash, BRX_PAL_SAMPLER_DESC const *sampler_desc, VkSampler sampler);
     VkSampler get_sampler() const;
     void steal(VkSampler *out_sampler);
     ~brx_pal_vk_sampler();
+    brx_pal_vk_sampler *get_next() const;
+    void set_next(brx_pal_vk_sampler *next);
+    uint64_t get_sampler_desc_hash() const;
+    BRX_PAL_SAMPLER_DESC const *get_sampler_desc() const;
+    void add_reference();
+    // returns true when the last reference is released
+    bool release_reference();
 };
 
 class brx_pal_vk_surface final : public brx_pal_surface
@@ -712,6 +1198,7 @@ public:
 
 class brx_pal_vk_swap_chain_image_view final : public brx_pal_vk_color_attachment_image
 {
+    VkImage m_image;
     VkImageView m_image_view;
 
 public:
@@ -721,6 +1208,7 @@ public:
     ~brx_pal_vk_swap_chain_image_view();
 
 private:
+    VkImage get_image() const override;
     VkImageView get_image_view() const override;
     brx_pal_sampled_image const *get_sampled_image() const override;
 };
@@ -839,6 +1327,35 @@ private:
     brx_pal_bottom_level_acceleration_structure const *get_bottom_level_acceleration_structure() const override;
 };
 
+class brx_pal_vk_serialized_bottom_level_acceleration_structure_size_query_pool final : public brx_pal_serialized_bottom_level_acceleration_structure_size_query_pool
+{
+    VkQueryPool m_query_pool;
+
+public:
+    brx_pal_vk_serialized_bottom_level_acceleration_structure_size_query_pool();
+    void init(VkDevice device, PFN_vkCreateQueryPool pfn_create_query_pool, VkAllocationCallbacks const *allocation_callbacks, uint32_t query_count);
+    void uninit(VkDevice device, PFN_vkDestroyQueryPool pfn_destroy_query_pool, VkAllocationCallbacks const *allocation_callbacks);
+    ~brx_pal_vk_serialized_bottom_level_acceleration_structure_size_query_pool();
+    VkQueryPool get_query_pool() const;
+};
+
+class brx_pal_vk_serialized_bottom_level_acceleration_structure_buffer final : public brx_pal_serialized_bottom_level_acceleration_structure_buffer
+{
+    VkBuffer m_buffer;
+    VmaAllocation m_allocation;
+    VkDeviceAddress m_device_memory_range_base;
+    void *m_host_memory_range_base;
+
+public:
+    brx_pal_vk_serialized_bottom_level_acceleration_structure_buffer();
+    void init(VkDevice device, PFN_vkGetBufferDeviceAddressKHR pfn_get_buffer_device_address, VmaAllocator memory_allocator, VmaPool serialized_bottom_level_acceleration_structure_buffer_memory_pool, uint32_t size);
+    void uninit(VmaAllocator memory_allocator);
+    ~brx_pal_vk_serialized_bottom_level_acceleration_structure_buffer();
+    VkBuffer get_buffer() const;
+    VkDeviceAddress get_device_memory_range_base() const;
+    void *get_host_memory_range_base() const override;
+};
+
 class brx_pal_vk_top_level_acceleration_structure_instance_upload_buffer final : public brx_pal_top_level_acceleration_structure_instance_upload_buffer
 {
     VkBuffer m_buffer;
@@ -852,6 +1369,7 @@ public:
     void uninit(VmaAllocator memory_allocator);
     ~brx_pal_vk_top_level_acceleration_structure_instance_upload_buffer();
     void write_instance(uint32_t instance_index, BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE const *bottom_top_acceleration_structure_instance) override;
+    void write_instances(uint32_t first_instance_index, uint32_t instance_count, BRX_PAL_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE const *bottom_top_acceleration_structure_instances) override;
     VkBuffer get_buffer() const;
     VkDeviceAddress get_device_memory_range_base() const;
 };
@@ -18,95 +18,75 @@
 #include "brx_pal_vk_device.h"
 #include <assert.h>
 
+static inline VkFormat _internal_unwrap_color_attachment_image_format(BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT wrapped_color_attachment_image_format);
+
+static inline VkFormat _internal_unwrap_depth_stencil_attachment_image_format(BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT wrapped_depth_stencil_attachment_image_format);
+
+static inline VkImageUsageFlags _internal_get_attachment_image_usage(VkImageUsageFlags attachment_usage, bool allow_sampled_image, bool placed);
+
+static inline VkImageCreateInfo _internal_get_image_create_info(VkFormat format, uint32_t width, uint32_t height, uint32_t layer_count, uint32_t sample_count, VkImageUsageFlags usage);
+
+static inline void _internal_get_image_memory_requirements(VkDevice device, PFN_vkCreateImage pfn_create_image, PFN_vkGetImageMemoryRequirements pfn_get_image_memory_requirements, PFN_vkDestroyImage pfn_destroy_image, VkAllocationCallbacks const *allocation_callbacks, VkImageCreateInfo const *image_create_info, VkMemoryRequirements *out_memory_requirements);
+
 brx_pal_vk_color_attachment_intermediate_image::brx_pal_vk_color_attachment_intermediate_image() : m_image(VK_NULL_HANDLE), m_allocation(VK_NULL_HANDLE), m_image_view(VK_NULL_HANDLE)
 {
 }
 
-void brx_pal_vk_color_attachment_intermediate_image::init(VkDevice device, PFN_vkCreateImageView pfn_create_image_view, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator, VmaPool color_transient_attachment_image_memory_pool, VmaPool color_attachment_sampled_image_memory_pool, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT wrapped_color_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image)
+void brx_pal_vk_color_attachment_intermediate_image::init(VkDevice device, PFN_vkCreateImageView pfn_create_image_view, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator, VmaPool color_attachment_image_memory_pool, VmaAllocation memory_heap_allocation, VkDeviceSize memory_heap_offset, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT wrapped_color_attachment_image_format, uint32_t width, uint32_t height, uint32_t layer_count, uint32_t sample_count, bool allow_sampled_image)
 {
-	VkFormat format;
-	switch (wrapped_color_attachment_image_format)
-	{
-	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_B8G8R8A8_UNORM:
-		format = VK_FORMAT_B8G8R8A8_UNORM;
-		break;
-	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_R8G8B8A8_UNORM:
-		format = VK_FORMAT_R8G8B8A8_UNORM;
-		break;
-	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_A2B10G10R10_UNORM_PACK32:
-		format = VK_FORMAT_A2B10G10R10_UNORM_PACK32;
-		break;
-	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_A2R10G10B10_UNORM_PACK32:
-		format = VK_FORMAT_A2R10G10B10_UNORM_PACK32;
-		break;
-	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_R16G16_UNORM:
-		format = VK_FORMAT_R16G16_UNORM;
-		break;
-	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_R32G32_UINT:
-		format = VK_FORMAT_R32G32_UINT;
-		break;
-	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_R32G32B32A32_UINT:
-		format = VK_FORMAT_R32G32B32A32_UINT;
-		break;
-	default:
-		assert(false);
-		format = VK_FORMAT_UNDEFINED;
-	}
+	// the multisample image is only used as the transient attachment
+	assert((1U == sample_count) || (!allow_sampled_image));
+	// the layered image (used by the multiview) is always single sample
+	assert((1U == sample_count) || (1U == layer_count));
+	// the placed image is always single sample and NOT layered
+	assert((VK_NULL_HANDLE == memory_heap_allocation) || ((1U == sample_count) && (1U == layer_count)));
 
-	VmaPool const memory_pool = allow_sampled_image ? color_attachment_sampled_image_memory_pool : color_transient_attachment_image_memory_pool;
+	VkFormat const format = _internal_unwrap_color_attachment_image_format(wrapped_color_attachment_image_format);
 
 	VkImageAspectFlags const aspect_mask = VK_IMAGE_ASPECT_COLOR_BIT;
 
-	VkImageUsageFlags const usage = allow_sampled_image ? (VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT) : (VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT);
-
-	VkImageCreateInfo const image_create_info = {
-		VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
-		NULL,
-		0U,
-		VK_IMAGE_TYPE_2D,
-		format,
-		{width, height, 1U},
-		1U,
-		1U,
-		VK_SAMPLE_COUNT_1_BIT,
-		VK_IMAGE_TILING_OPTIMAL,
-		usage,
-		VK_SHARING_MODE_EXCLUSIVE,
-		0U,
-		NULL,
-		VK_IMAGE_LAYOUT_UNDEFINED};
+	VkImageUsageFlags const usage = _internal_get_attachment_image_usage(VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT, allow_sampled_image, VK_NULL_HANDLE != memory_heap_allocation);
 
-	VmaAllocationCreateInfo const allocation_create_info = {
-		0U,
-		VMA_MEMORY_USAGE_UNKNOWN,
-		0U,
-		0U,
-		0U,
-		memory_pool,
-		NULL,
-		1.0F};
+	VkImageCreateInfo const image_create_info = _internal_get_image_create_info(format, width, height, layer_count, sample_count, usage);
 
 	assert(VK_NULL_HANDLE == this->m_image);
 	assert(VK_NULL_HANDLE == this->m_allocation);
-	VkResult res_vma_create_buffer = vmaCreateImage(memory_allocator, &image_create_info, &allocation_create_info, &this->m_image, &this->m_allocation, NULL);
-	assert(VK_SUCCESS == res_vma_create_buffer);
-
-	if (allow_sampled_image)
+	if (VK_NULL_HANDLE == memory_heap_allocation)
 	{
-		VkImageViewCreateInfo const image_view_create_info = {
-			VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
-			NULL,
+		VmaAllocationCreateInfo const allocation_create_info = {
 			0U,
-			this->m_image,
-			VK_IMAGE_VIEW_TYPE_2D,
-			format,
-			{VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY},
-			{aspect_mask, 0U, 1U, 0U, 1U}};
+			VMA_MEMORY_USAGE_UNKNOWN,
+			0U,
+			0U,
+			0U,
+			color_attachment_image_memory_pool,
+			NULL,
+			1.0F};
 
-		assert(VK_NULL_HANDLE == this->m_image_view);
-		VkResult const res_create_image_view = pfn_create_image_view(device, &image_view_create_info, allocation_callbacks, &this->m_image_view);
-		assert(VK_SUCCESS == res_create_image_view);
+		VkResult res_vma_create_buffer = vmaCreateImage(memory_allocator, &image_create_info, &allocation_create_info, &this->m_image, &this->m_allocation, NULL);
+		assert(VK_SUCCESS == res_vma_create_buffer);
+	}
+	else
+	{
+		// the placed image does NOT own the allocation
+		VkResult const res_vma_create_aliasing_image = vmaCreateAliasingImage2(memory_allocator, memory_heap_allocation, memory_heap_offset, &image_create_info, &this->m_image);
+		assert(VK_SUCCESS == res_vma_create_aliasing_image);
 	}
+
+	// the image view is also used by the frame buffer and the dynamic rendering
+	VkImageViewCreateInfo const image_view_create_info = {
+		VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+		NULL,
+		0U,
+		this->m_image,
+		(1U == layer_count) ? VK_IMAGE_VIEW_TYPE_2D : VK_IMAGE_VIEW_TYPE_2D_ARRAY,
+		format,
+		{VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY},
+		{aspect_mask, 0U, 1U, 0U, layer_count}};
+
+	assert(VK_NULL_HANDLE == this->m_image_view);
+	VkResult const res_create_image_view = pfn_create_image_view(device, &image_view_create_info, allocation_callbacks, &this->m_image_view);
+	assert(VK_SUCCESS == res_create_image_view);
 }
 
 void brx_pal_vk_color_attachment_intermediate_image::uninit(VkDevice device, PFN_vkDestroyImageView pfn_destroy_image_view, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator)
@@ -118,8 +98,8 @@ void brx_pal_vk_color_attachment_intermediate_image::uninit(VkDevice device, PFN
 	}
 
 	assert(VK_NULL_HANDLE != this->m_image);
-	assert(VK_NULL_HANDLE != this->m_allocation);
 
+	// only the image is destroyed if the allocation is NULL (placed in the memory heap)
 	vmaDestroyImage(memory_allocator, this->m_image, this->m_allocation);
 
 	this->m_image = VK_NULL_HANDLE;
@@ -133,6 +113,18 @@ brx_pal_vk_color_attachment_intermediate_image::~brx_pal_vk_color_attachment_int
 	assert(VK_NULL_HANDLE == this->m_image_view);
 }
 
+void brx_pal_vk_color_attachment_intermediate_image::get_memory_requirements(VkDevice device, PFN_vkCreateImage pfn_create_image, PFN_vkGetImageMemoryRequirements pfn_get_image_memory_requirements, PFN_vkDestroyImage pfn_destroy_image, VkAllocationCallbacks const *allocation_callbacks, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT wrapped_color_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image, VkMemoryRequirements *out_memory_requirements)
+{
+	VkImageCreateInfo const image_create_info = _internal_get_image_create_info(_internal_unwrap_color_attachment_image_format(wrapped_color_attachment_image_format), width, height, 1U, 1U, _internal_get_attachment_image_usage(VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT, allow_sampled_image, true));
+
+	_internal_get_image_memory_requirements(device, pfn_create_image, pfn_get_image_memory_requirements, pfn_destroy_image, allocation_callbacks, &image_create_info, out_memory_requirements);
+}
+
+VkImage brx_pal_vk_color_attachment_intermediate_image::get_image() const
+{
+	return this->m_image;
+}
+
 VkImageView brx_pal_vk_color_attachment_intermediate_image::get_image_view() const
 {
 	return this->m_image_view;
@@ -144,93 +136,89 @@ brx_pal_sampled_image const *brx_pal_vk_color_attachment_intermediate_image::get
 	return static_cast<brx_pal_vk_sampled_image const *>(this);
 }
 
-brx_pal_vk_depth_stencil_attachment_intermediate_image::brx_pal_vk_depth_stencil_attachment_intermediate_image() : m_image(VK_NULL_HANDLE), m_allocation(VK_NULL_HANDLE), m_image_view(VK_NULL_HANDLE)
+brx_pal_vk_depth_stencil_attachment_intermediate_image::brx_pal_vk_depth_stencil_attachment_intermediate_image() : m_image(VK_NULL_HANDLE), m_allocation(VK_NULL_HANDLE), m_image_view(VK_NULL_HANDLE), m_aspect_mask(0U)
 {
 }
 
-void brx_pal_vk_depth_stencil_attachment_intermediate_image::init(VkDevice device, PFN_vkCreateImageView pfn_create_image_view, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator, VmaPool depth_transient_attachment_image_memory_pool, VmaPool depth_attachment_sampled_image_memory_pool, VmaPool depth_stencil_transient_attachment_image_memory_pool, VmaPool depth_stencil_attachment_sampled_image_memory_pool, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT wrapped_depth_stencil_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image)
+void brx_pal_vk_depth_stencil_attachment_intermediate_image::init(VkDevice device, PFN_vkCreateImageView pfn_create_image_view, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator, VmaPool depth_stencil_attachment_image_memory_pool, VmaAllocation memory_heap_allocation, VkDeviceSize memory_heap_offset, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT wrapped_depth_stencil_attachment_image_format, uint32_t width, uint32_t height, uint32_t layer_count, uint32_t sample_count, bool allow_sampled_image)
 {
+	// the multisample image is only used as the transient attachment
+	assert((1U == sample_count) || (!allow_sampled_image));
+	// the layered image (used by the multiview) is always single sample
+	assert((1U == sample_count) || (1U == layer_count));
+	// the placed image is always single sample and NOT layered
+	assert((VK_NULL_HANDLE == memory_heap_allocation) || ((1U == sample_count) && (1U == layer_count)));
+
 	VkFormat format;
-	VmaPool memory_pool;
 	VkImageAspectFlags aspect_mask;
 	switch (wrapped_depth_stencil_attachment_image_format)
 	{
 	case BRX_PAL_DEPTH_STENCIL_ATTACHMENT_FORMAT_D32_SFLOAT:
 		format = VK_FORMAT_D32_SFLOAT;
-		memory_pool = allow_sampled_image ? depth_attachment_sampled_image_memory_pool : depth_transient_attachment_image_memory_pool;
 		aspect_mask = VK_IMAGE_ASPECT_DEPTH_BIT;
 		break;
 	case BRX_PAL_DEPTH_STENCIL_ATTACHMENT_FORMAT_X8_D24_UNORM_PACK32:
 		format = VK_FORMAT_X8_D24_UNORM_PACK32;
-		memory_pool = allow_sampled_image ? depth_attachment_sampled_image_memory_pool : depth_transient_attachment_image_memory_pool;
 		aspect_mask = VK_IMAGE_ASPECT_DEPTH_BIT;
 		break;
 	case BRX_PAL_DEPTH_STENCIL_ATTACHMENT_FORMAT_D32_SFLOAT_S8_UINT:
 		format = VK_FORMAT_D32_SFLOAT_S8_UINT;
-		memory_pool = allow_sampled_image ? depth_stencil_attachment_sampled_image_memory_pool : depth_stencil_transient_attachment_image_memory_pool;
 		aspect_mask = VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
 		break;
 	case BRX_PAL_DEPTH_STENCIL_ATTACHMENT_FORMAT_D24_UNORM_S8_UINT:
 		format = VK_FORMAT_D24_UNORM_S8_UINT;
-		memory_pool = allow_sampled_image ? depth_stencil_attachment_sampled_image_memory_pool : depth_stencil_transient_attachment_image_memory_pool;
 		aspect_mask = VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
 		break;
 	default:
 		assert(false);
 		format = VK_FORMAT_UNDEFINED;
-		memory_pool = VK_NULL_HANDLE;
 		aspect_mask = VK_IMAGE_ASPECT_FLAG_BITS_MAX_ENUM;
 	}
 
-	VkImageUsageFlags const usage = allow_sampled_image ? (VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT) : (VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT);
+	assert(0U == this->m_aspect_mask);
+	this->m_aspect_mask = aspect_mask;
 
-	VkImageCreateInfo const image_create_info = {
-		VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
-		NULL,
-		0U,
-		VK_IMAGE_TYPE_2D,
-		format,
-		{width, height, 1U},
-		1U,
-		1U,
-		VK_SAMPLE_COUNT_1_BIT,
-		VK_IMAGE_TILING_OPTIMAL,
-		usage,
-		VK_SHARING_MODE_EXCLUSIVE,
-		0U,
-		NULL,
-		VK_IMAGE_LAYOUT_UNDEFINED};
+	VkImageUsageFlags const usage = _internal_get_attachment_image_usage(VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT, allow_sampled_image, VK_NULL_HANDLE != memory_heap_allocation);
 
-	VmaAllocationCreateInfo const allocation_create_info = {
-		0U,
-		VMA_MEMORY_USAGE_UNKNOWN,
-		0U,
-		0U,
-		0U,
-		memory_pool,
-		NULL,
-		1.0F};
+	VkImageCreateInfo const image_create_info = _internal_get_image_create_info(format, width, height, layer_count, sample_count, usage);
 
 	assert(VK_NULL_HANDLE == this->m_image);
 	assert(VK_NULL_HANDLE == this->m_allocation);
-	VkResult res_vma_create_buffer = vmaCreateImage(memory_allocator, &image_create_info, &allocation_create_info, &this->m_image, &this->m_allocation, NULL);
-	assert(VK_SUCCESS == res_vma_create_buffer);
-
-	if (allow_sampled_image)
+	if (VK_NULL_HANDLE == memory_heap_allocation)
 	{
-		VkImageViewCreateInfo const image_view_create_info = {
-			VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
-			NULL,
+		VmaAllocationCreateInfo const allocation_create_info = {
 			0U,
-			this->m_image,
-			VK_IMAGE_VIEW_TYPE_2D,
-			format,
-			{VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY},
-			{aspect_mask, 0U, 1U, 0U, 1U}};
-		assert(VK_NULL_HANDLE == this->m_image_view);
-		VkResult const res_create_image_view = pfn_create_image_view(device, &image_view_create_info, allocation_callbacks, &this->m_image_view);
-		assert(VK_SUCCESS == res_create_image_view);
+			VMA_MEMORY_USAGE_UNKNOWN,
+			0U,
+			0U,
+			0U,
+			depth_stencil_attachment_image_memory_pool,
+			NULL,
+			1.0F};
+
+		VkResult res_vma_create_buffer = vmaCreateImage(memory_allocator, &image_create_info, &allocation_create_info, &this->m_image, &this->m_allocation, NULL);
+		assert(VK_SUCCESS == res_vma_create_buffer);
 	}
+	else
+	{
+		// the placed image does NOT own the allocation
+		VkResult const res_vma_create_aliasing_image = vmaCreateAliasingImage2(memory_allocator, memory_heap_allocation, memory_heap_offset, &image_create_info, &this->m_image);
+		assert(VK_SUCCESS == res_vma_create_aliasing_image);
+	}
+
+	// the image view is also used by the frame buffer and the dynamic rendering
+	VkImageViewCreateInfo const image_view_create_info = {
+		VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+		NULL,
+		0U,
+		this->m_image,
+		(1U == layer_count) ? VK_IMAGE_VIEW_TYPE_2D : VK_IMAGE_VIEW_TYPE_2D_ARRAY,
+		format,
+		{VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY},
+		{aspect_mask, 0U, 1U, 0U, layer_count}};
+	assert(VK_NULL_HANDLE == this->m_image_view);
+	VkResult const res_create_image_view = pfn_create_image_view(device, &image_view_create_info, allocation_callbacks, &this->m_image_view);
+	assert(VK_SUCCESS == res_create_image_view);
 }
 
 void brx_pal_vk_depth_stencil_attachment_intermediate_image::uninit(VkDevice device, PFN_vkDestroyImageView pfn_destroy_image_view, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator)
@@ -240,12 +228,13 @@ void brx_pal_vk_depth_stencil_attachment_intermediate_image::uninit(VkDevice dev
 	this->m_image_view = VK_NULL_HANDLE;
 
 	assert(VK_NULL_HANDLE != this->m_image);
-	assert(VK_NULL_HANDLE != this->m_allocation);
 
+	// only the image is destroyed if the allocation is NULL (placed in the memory heap)
 	vmaDestroyImage(memory_allocator, this->m_image, this->m_allocation);
 
 	this->m_image = VK_NULL_HANDLE;
 	this->m_allocation = VK_NULL_HANDLE;
+	this->m_aspect_mask = 0U;
 }
 
 brx_pal_vk_depth_stencil_attachment_intermediate_image::~brx_pal_vk_depth_stencil_attachment_intermediate_image()
@@ -255,58 +244,73 @@ brx_pal_vk_depth_stencil_attachment_intermediate_image::~brx_pal_vk_depth_stenci
 	assert(VK_NULL_HANDLE == this->m_image_view);
 }
 
+void brx_pal_vk_depth_stencil_attachment_intermediate_image::get_memory_requirements(VkDevice device, PFN_vkCreateImage pfn_create_image, PFN_vkGetImageMemoryRequirements pfn_get_image_memory_requirements, PFN_vkDestroyImage pfn_destroy_image, VkAllocationCallbacks const *allocation_callbacks, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT wrapped_depth_stencil_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image, VkMemoryRequirements *out_memory_requirements)
+{
+	VkImageCreateInfo const image_create_info = _internal_get_image_create_info(_internal_unwrap_depth_stencil_attachment_image_format(wrapped_depth_stencil_attachment_image_format), width, height, 1U, 1U, _internal_get_attachment_image_usage(VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT, allow_sampled_image, true));
+
+	_internal_get_image_memory_requirements(device, pfn_create_image, pfn_get_image_memory_requirements, pfn_destroy_image, allocation_callbacks, &image_create_info, out_memory_requirements);
+}
+
+VkImage brx_pal_vk_depth_stencil_attachment_intermediate_image::get_image() const
+{
+	return this->m_image;
+}
+
 VkImageView brx_pal_vk_depth_stencil_attachment_intermediate_image::get_image_view() const
 {
 	return this->m_image_view;
 }
 
+VkImageAspectFlags brx_pal_vk_depth_stencil_attachment_intermediate_image::get_aspect_mask() const
+{
+	return this->m_aspect_mask;
+}
+
 brx_pal_sampled_image const *brx_pal_vk_depth_stencil_attachment_intermediate_image::get_sampled_image() const
 {
 	assert(VK_NULL_HANDLE != this->m_image_view);
 	return static_cast<brx_pal_vk_sampled_image const *>(this);
 }
 
-brx_pal_vk_storage_intermediate_image::brx_pal_vk_storage_intermediate_image() : m_image(VK_NULL_HANDLE), m_allocation(VK_NULL_HANDLE), m_image_view(VK_NULL_HANDLE)
+brx_pal_vk_storage_intermediate_image::brx_pal_vk_storage_intermediate_image() : m_image(VK_NULL_HANDLE), m_allocation(VK_NULL_HANDLE), m_image_view(VK_NULL_HANDLE), m_format(VK_FORMAT_UNDEFINED)
 {
 }
 
-void brx_pal_vk_storage_intermediate_image::init(VkDevice device, PFN_vkCreateImageView pfn_create_image_view, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator, VmaPool storage_intermediate_image_memory_pool, VkFormat unwrapped_storage_image_format, uint32_t width, uint32_t height, bool allow_sampled_image)
+void brx_pal_vk_storage_intermediate_image::init(VkDevice device, PFN_vkCreateImageView pfn_create_image_view, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator, VmaPool storage_intermediate_image_memory_pool, VmaAllocation memory_heap_allocation, VkDeviceSize memory_heap_offset, VkFormat unwrapped_storage_image_format, uint32_t width, uint32_t height, bool allow_sampled_image)
 {
 	VkImageAspectFlags const aspect_mask = VK_IMAGE_ASPECT_COLOR_BIT;
 
-	VkImageUsageFlags const usage = allow_sampled_image ? (VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT) : VK_IMAGE_USAGE_STORAGE_BIT;
-
-	VkImageCreateInfo const image_create_info = {
-		VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
-		NULL,
-		0U,
-		VK_IMAGE_TYPE_2D,
-		unwrapped_storage_image_format,
-		{width, height, 1U},
-		1U,
-		1U,
-		VK_SAMPLE_COUNT_1_BIT,
-		VK_IMAGE_TILING_OPTIMAL,
-		usage,
-		VK_SHARING_MODE_EXCLUSIVE,
-		0U,
-		NULL,
-		VK_IMAGE_LAYOUT_UNDEFINED};
+	// TRANSFER_SRC and TRANSFER_DST: "copy_image" and "clear_storage_image" of the graphics command buffer
+	VkImageUsageFlags const usage = allow_sampled_image ? (VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT) : (VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_STORAGE_BIT);
 
-	VmaAllocationCreateInfo const allocation_create_info = {
-		0U,
-		VMA_MEMORY_USAGE_UNKNOWN,
-		0U,
-		0U,
-		0U,
-		storage_intermediate_image_memory_pool,
-		NULL,
-		1.0F};
+	VkImageCreateInfo const image_create_info = _internal_get_image_create_info(unwrapped_storage_image_format, width, height, 1U, 1U, usage);
 
 	assert(VK_NULL_HANDLE == this->m_image);
 	assert(VK_NULL_HANDLE == this->m_allocation);
-	VkResult res_vma_create_buffer = vmaCreateImage(memory_allocator, &image_create_info, &allocation_create_info, &this->m_image, &this->m_allocation, NULL);
-	assert(VK_SUCCESS == res_vma_create_buffer);
+	if (VK_NULL_HANDLE == memory_heap_allocation)
+	{
+		VmaAllocationCreateInfo const allocation_create_info = {
+			0U,
+			VMA_MEMORY_USAGE_UNKNOWN,
+			0U,
+			0U,
+			0U,
+			storage_intermediate_image_memory_pool,
+			NULL,
+			1.0F};
+
+		VkResult res_vma_create_buffer = vmaCreateImage(memory_allocator, &image_create_info, &allocation_create_info, &this->m_image, &this->m_allocation, NULL);
+		assert(VK_SUCCESS == res_vma_create_buffer);
+	}
+	else
+	{
+		// the placed image does NOT own the allocation
+		VkResult const res_vma_create_aliasing_image = vmaCreateAliasingImage2(memory_allocator, memory_heap_allocation, memory_heap_offset, &image_create_info, &this->m_image);
+		assert(VK_SUCCESS == res_vma_create_aliasing_image);
+	}
+
+	assert(VK_FORMAT_UNDEFINED == this->m_format);
+	this->m_format = unwrapped_storage_image_format;
 
 	if (allow_sampled_image)
 	{
@@ -335,8 +339,8 @@ void brx_pal_vk_storage_intermediate_image::uninit(VkDevice device, PFN_vkDestro
 	}
 
 	assert(VK_NULL_HANDLE != this->m_image);
-	assert(VK_NULL_HANDLE != this->m_allocation);
 
+	// only the image is destroyed if the allocation is NULL (placed in the memory heap)
 	vmaDestroyImage(memory_allocator, this->m_image, this->m_allocation);
 
 	this->m_image = VK_NULL_HANDLE;
@@ -349,6 +353,16 @@ brx_pal_vk_storage_intermediate_image::~brx_pal_vk_storage_intermediate_image()
 	assert(VK_NULL_HANDLE == this->m_allocation);
 	assert(VK_NULL_HANDLE == this->m_image_view);
 }
+
+void brx_pal_vk_storage_intermediate_image::get_memory_requirements(VkDevice device, PFN_vkCreateImage pfn_create_image, PFN_vkGetImageMemoryRequirements pfn_get_image_memory_requirements, PFN_vkDestroyImage pfn_destroy_image, VkAllocationCallbacks const *allocation_callbacks, VkFormat unwrapped_storage_image_format, uint32_t width, uint32_t height, bool allow_sampled_image, VkMemoryRequirements *out_memory_requirements)
+{
+	VkImageUsageFlags const usage = allow_sampled_image ? (VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT) : (VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_STORAGE_BIT);
+
+	VkImageCreateInfo const image_create_info = _internal_get_image_create_info(unwrapped_storage_image_format, width, height, 1U, 1U, usage);
+
+	_internal_get_image_memory_requirements(device, pfn_create_image, pfn_get_image_memory_requirements, pfn_destroy_image, allocation_callbacks, &image_create_info, out_memory_requirements);
+}
+
 VkImage brx_pal_vk_storage_intermediate_image::get_image() const
 {
 	return this->m_image;
@@ -359,6 +373,11 @@ VkImageView brx_pal_vk_storage_intermediate_image::get_image_view() const
 	return this->m_image_view;
 }
 
+VkFormat brx_pal_vk_storage_intermediate_image::get_format() const
+{
+	return this->m_format;
+}
+
 brx_pal_sampled_image const *brx_pal_vk_storage_intermediate_image::get_sampled_image() const
 {
 	assert(VK_NULL_HANDLE != this->m_image_view);
@@ -461,4 +480,99 @@ brx_pal_sampled_image const *brx_pal_vk_sampled_asset_image::get_sampled_image()
 uint32_t brx_pal_vk_sampled_asset_image::get_mip_levels() const
 {
 	return this->m_mip_levels;
+}
+
+static inline VkFormat _internal_unwrap_color_attachment_image_format(BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT wrapped_color_attachment_image_format)
+{
+	VkFormat unwrapped_color_attachment_image_format;
+	switch (wrapped_color_attachment_image_format)
+	{
+	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_B8G8R8A8_UNORM:
+		unwrapped_color_attachment_image_format = VK_FORMAT_B8G8R8A8_UNORM;
+		break;
+	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_R8G8B8A8_UNORM:
+		unwrapped_color_attachment_image_format = VK_FORMAT_R8G8B8A8_UNORM;
+		break;
+	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_A2B10G10R10_UNORM_PACK32:
+		unwrapped_color_attachment_image_format = VK_FORMAT_A2B10G10R10_UNORM_PACK32;
+		break;
+	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_A2R10G10B10_UNORM_PACK32:
+		unwrapped_color_attachment_image_format = VK_FORMAT_A2R10G10B10_UNORM_PACK32;
+		break;
+	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_R16G16_UNORM:
+		unwrapped_color_attachment_image_format = VK_FORMAT_R16G16_UNORM;
+		break;
+	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_R32G32_UINT:
+		unwrapped_color_attachment_image_format = VK_FORMAT_R32G32_UINT;
+		break;
+	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_R32G32B32A32_UINT:
+		unwrapped_color_attachment_image_format = VK_FORMAT_R32G32B32A32_UINT;
+		break;
+	default:
+		assert(false);
+		unwrapped_color_attachment_image_format = VK_FORMAT_UNDEFINED;
+	}
+	return unwrapped_color_attachment_image_format;
+}
+
+static inline VkFormat _internal_unwrap_depth_stencil_attachment_image_format(BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT wrapped_depth_stencil_attachment_image_format)
+{
+	VkFormat unwrapped_depth_stencil_attachment_image_format;
+	switch (wrapped_depth_stencil_attachment_image_format)
+	{
+	case BRX_PAL_DEPTH_STENCIL_ATTACHMENT_FORMAT_D32_SFLOAT:
+		unwrapped_depth_stencil_attachment_image_format = VK_FORMAT_D32_SFLOAT;
+		break;
+	case BRX_PAL_DEPTH_STENCIL_ATTACHMENT_FORMAT_X8_D24_UNORM_PACK32:
+		unwrapped_depth_stencil_attachment_image_format = VK_FORMAT_X8_D24_UNORM_PACK32;
+		break;
+	case BRX_PAL_DEPTH_STENCIL_ATTACHMENT_FORMAT_D32_SFLOAT_S8_UINT:
+		unwrapped_depth_stencil_attachment_image_format = VK_FORMAT_D32_SFLOAT_S8_UINT;
+		break;
+	case BRX_PAL_DEPTH_STENCIL_ATTACHMENT_FORMAT_D24_UNORM_S8_UINT:
+		unwrapped_depth_stencil_attachment_image_format = VK_FORMAT_D24_UNORM_S8_UINT;
+		break;
+	default:
+		assert(false);
+		unwrapped_depth_stencil_attachment_image_format = VK_FORMAT_UNDEFINED;
+	}
+	return unwrapped_depth_stencil_attachment_image_format;
+}
+
+static inline VkImageUsageFlags _internal_get_attachment_image_usage(VkImageUsageFlags attachment_usage, bool allow_sampled_image, bool placed)
+{
+	// the placed image can NOT be transient, since the lazily allocated memory can NOT be aliased by the memory heap
+	return allow_sampled_image ? (attachment_usage | VK_IMAGE_USAGE_SAMPLED_BIT) : ((!placed) ? (attachment_usage | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT) : attachment_usage);
+}
+
+static inline VkImageCreateInfo _internal_get_image_create_info(VkFormat format, uint32_t width, uint32_t height, uint32_t layer_count, uint32_t sample_count, VkImageUsageFlags usage)
+{
+	return VkImageCreateInfo{
+		VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+		NULL,
+		0U,
+		VK_IMAGE_TYPE_2D,
+		format,
+		{width, height, 1U},
+		1U,
+		layer_count,
+		static_cast<VkSampleCountFlagBits>(sample_count),
+		VK_IMAGE_TILING_OPTIMAL,
+		usage,
+		VK_SHARING_MODE_EXCLUSIVE,
+		0U,
+		NULL,
+		VK_IMAGE_LAYOUT_UNDEFINED};
+}
+
+static inline void _internal_get_image_memory_requirements(VkDevice device, PFN_vkCreateImage pfn_create_image, PFN_vkGetImageMemoryRequirements pfn_get_image_memory_requirements, PFN_vkDestroyImage pfn_destroy_image, VkAllocationCallbacks const *allocation_callbacks, VkImageCreateInfo const *image_create_info, VkMemoryRequirements *out_memory_requirements)
+{
+	// the "vkGetDeviceImageMemoryRequirements" is NOT available before Vulkan 1.3
+	VkImage dummy_img = VK_NULL_HANDLE;
+	VkResult const res_create_image = pfn_create_image(device, image_create_info, allocation_callbacks, &dummy_img);
+	assert(VK_SUCCESS == res_create_image);
+
+	pfn_get_image_memory_requirements(device, dummy_img, out_memory_requirements);
+
+	pfn_destroy_image(device, dummy_img, allocation_callbacks);
 }
\ No newline at end of file
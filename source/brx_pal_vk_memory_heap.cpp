@@ -0,0 +1,86 @@
+//
+// Copyright (C) YuqiaoZhang(HanetakaChou)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#include "brx_pal_vk_device.h"
+#include <assert.h>
+
+// the same as the "D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT" (which is greater than or equal to the alignment of the placed resources on all known implementations)
+static constexpr VkDeviceSize const g_memory_heap_alignment = 65536U;
+
+brx_pal_vk_memory_heap::brx_pal_vk_memory_heap() : m_allocation(VK_NULL_HANDLE), m_type(static_cast<BRX_PAL_MEMORY_HEAP_TYPE>(-1)), m_size(0U)
+{
+}
+
+void brx_pal_vk_memory_heap::init(VmaAllocator memory_allocator, VmaPool memory_pool, BRX_PAL_MEMORY_HEAP_TYPE memory_heap_type, uint32_t size)
+{
+	assert(0U < size);
+
+	// the memory type is decided by the memory pool
+	VkMemoryRequirements const memory_requirements = {
+		size,
+		g_memory_heap_alignment,
+		~0U};
+
+	VmaAllocationCreateInfo const allocation_create_info = {
+		VMA_ALLOCATION_CREATE_CAN_ALIAS_BIT,
+		VMA_MEMORY_USAGE_UNKNOWN,
+		0U,
+		0U,
+		0U,
+		memory_pool,
+		NULL,
+		1.0F};
+
+	assert(VK_NULL_HANDLE == this->m_allocation);
+	VkResult const res_vma_allocate_memory = vmaAllocateMemory(memory_allocator, &memory_requirements, &allocation_create_info, &this->m_allocation, NULL);
+	assert(VK_SUCCESS == res_vma_allocate_memory);
+
+	assert(static_cast<BRX_PAL_MEMORY_HEAP_TYPE>(-1) == this->m_type);
+	this->m_type = memory_heap_type;
+
+	assert(0U == this->m_size);
+	this->m_size = size;
+}
+
+void brx_pal_vk_memory_heap::uninit(VmaAllocator memory_allocator)
+{
+	assert(VK_NULL_HANDLE != this->m_allocation);
+
+	vmaFreeMemory(memory_allocator, this->m_allocation);
+
+	this->m_allocation = VK_NULL_HANDLE;
+}
+
+brx_pal_vk_memory_heap::~brx_pal_vk_memory_heap()
+{
+	assert(VK_NULL_HANDLE == this->m_allocation);
+}
+
+VmaAllocation brx_pal_vk_memory_heap::get_allocation() const
+{
+	return this->m_allocation;
+}
+
+BRX_PAL_MEMORY_HEAP_TYPE brx_pal_vk_memory_heap::get_type() const
+{
+	return this->m_type;
+}
+
+VkDeviceSize brx_pal_vk_memory_heap::get_size() const
+{
+	return this->m_size;
+}
@@ -16,83 +16,208 @@
 //
 
 #include "brx_pal_vk_device.h"
+#include <stddef.h>
 #include <assert.h>
 
-brx_pal_vk_graphics_pipeline::brx_pal_vk_graphics_pipeline() : m_pipeline(VK_NULL_HANDLE)
+static inline VkFormat _internal_unwrap_color_attachment_image_format(BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT wrapped_color_attachment_image_format);
+
+static inline VkFormat _internal_unwrap_depth_stencil_attachment_image_format(BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT wrapped_depth_stencil_attachment_image_format);
+
+static inline void _internal_unwrap_depth_compare_operation(BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION wrapped_depth_compare_operation, VkBool32 *out_depth_test_enable, VkCompareOp *out_depth_compare_op);
+
+static inline void _internal_unwrap_blend_operation(BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION wrapped_blend_operation, uint32_t color_attachment_count, VkPipelineColorBlendAttachmentState *out_attachments);
+
+static inline VkSpecializationInfo const *_internal_unwrap_shader_stage_specialization(BRX_PAL_SHADER_STAGE_SPECIALIZATION const *wrapped_shader_stage_specialization, mcrt_vector<VkSpecializationMapEntry> *out_map_entries, VkSpecializationInfo *out_specialization_info, char const **out_entry_point_name);
+
+static inline VkFormat _internal_unwrap_vertex_attribute_format(BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE_FORMAT wrapped_vertex_attribute_format);
+
+brx_pal_vk_graphics_pipeline::brx_pal_vk_graphics_pipeline() : m_pipeline(VK_NULL_HANDLE), m_vertex_shader_module(NULL), m_task_shader_module(NULL), m_mesh_shader_module(NULL), m_fragment_shader_module(NULL), m_vertex_binding_count(0U)
+{
+}
+
+void brx_pal_vk_graphics_pipeline::init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, brx_pal_vk_shader_module_cache *shader_module_cache, brx_pal_render_pass const *wrapped_render_pass, brx_pal_pipeline_layout const *wrapped_pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *vertex_shader_specialization, size_t task_shader_module_code_size, void const *task_shader_module_code, size_t mesh_shader_module_code_size, void const *mesh_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *fragment_shader_specialization, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION wrapped_depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION wrapped_blend_operation, bool extended_dynamic_state)
+{
+	assert(NULL != wrapped_render_pass);
+	VkRenderPass const render_pass = static_cast<brx_pal_vk_render_pass const *>(wrapped_render_pass)->get_render_pass();
+	uint32_t const color_attachment_count = static_cast<brx_pal_vk_render_pass const *>(wrapped_render_pass)->get_color_attachment_count();
+	uint32_t const sample_count = static_cast<brx_pal_vk_render_pass const *>(wrapped_render_pass)->get_sample_count();
+
+	this->init(pfn_get_device_proc_addr, device, allocation_callbacks, shader_module_cache, NULL, render_pass, color_attachment_count, sample_count, wrapped_pipeline_layout, vertex_binding_count, vertex_binding_strides, vertex_attribute_count, vertex_attributes, vertex_shader_module_code_size, vertex_shader_module_code, vertex_shader_specialization, task_shader_module_code_size, task_shader_module_code, mesh_shader_module_code_size, mesh_shader_module_code, fragment_shader_module_code_size, fragment_shader_module_code, fragment_shader_specialization, enable_back_face_cull, front_ccw, wrapped_depth_compare_operation, wrapped_blend_operation, extended_dynamic_state);
+}
+
+void brx_pal_vk_graphics_pipeline::init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, brx_pal_vk_shader_module_cache *shader_module_cache, uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *wrapped_color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *wrapped_depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, brx_pal_pipeline_layout const *wrapped_pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *vertex_shader_specialization, size_t task_shader_module_code_size, void const *task_shader_module_code, size_t mesh_shader_module_code_size, void const *mesh_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *fragment_shader_specialization, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION wrapped_depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION wrapped_blend_operation, bool extended_dynamic_state)
 {
+	constexpr uint32_t const max_color_attachment_count = 8U;
+	assert(color_attachment_count <= max_color_attachment_count);
+	color_attachment_count = (color_attachment_count < max_color_attachment_count) ? color_attachment_count : max_color_attachment_count;
+
+	VkFormat color_attachment_formats[max_color_attachment_count];
+	assert(NULL != wrapped_color_attachment_formats || 0U == color_attachment_count);
+	for (uint32_t color_attachment_index = 0U; color_attachment_index < color_attachment_count; ++color_attachment_index)
+	{
+		color_attachment_formats[color_attachment_index] = _internal_unwrap_color_attachment_image_format(wrapped_color_attachment_formats[color_attachment_index]);
+	}
+
+	VkFormat depth_attachment_format;
+	VkFormat stencil_attachment_format;
+	if (NULL != wrapped_depth_stencil_attachment_format)
+	{
+		depth_attachment_format = _internal_unwrap_depth_stencil_attachment_image_format(*wrapped_depth_stencil_attachment_format);
+		// the stencil attachment format should match the "pStencilAttachment" of the "begin_rendering"
+		stencil_attachment_format = ((BRX_PAL_DEPTH_STENCIL_ATTACHMENT_FORMAT_D32_SFLOAT_S8_UINT == (*wrapped_depth_stencil_attachment_format)) || (BRX_PAL_DEPTH_STENCIL_ATTACHMENT_FORMAT_D24_UNORM_S8_UINT == (*wrapped_depth_stencil_attachment_format))) ? depth_attachment_format : VK_FORMAT_UNDEFINED;
+	}
+	else
+	{
+		depth_attachment_format = VK_FORMAT_UNDEFINED;
+		stencil_attachment_format = VK_FORMAT_UNDEFINED;
+	}
+
+	// the view mask should match the "begin_rendering"
+	uint32_t const view_mask = (1U == view_count) ? 0U : ((view_count >= 32U) ? 0xFFFFFFFFU : ((1U << view_count) - 1U));
+
+	VkPipelineRenderingCreateInfoKHR const pipeline_rendering_create_info = {
+		VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR,
+		NULL,
+		view_mask,
+		color_attachment_count,
+		(color_attachment_count > 0U) ? color_attachment_formats : NULL,
+		depth_attachment_format,
+		stencil_attachment_format};
+
+	this->init(pfn_get_device_proc_addr, device, allocation_callbacks, shader_module_cache, &pipeline_rendering_create_info, VK_NULL_HANDLE, color_attachment_count, sample_count, wrapped_pipeline_layout, vertex_binding_count, vertex_binding_strides, vertex_attribute_count, vertex_attributes, vertex_shader_module_code_size, vertex_shader_module_code, vertex_shader_specialization, task_shader_module_code_size, task_shader_module_code, mesh_shader_module_code_size, mesh_shader_module_code, fragment_shader_module_code_size, fragment_shader_module_code, fragment_shader_specialization, enable_back_face_cull, front_ccw, wrapped_depth_compare_operation, wrapped_blend_operation, extended_dynamic_state);
 }
 
-void brx_pal_vk_graphics_pipeline::init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, brx_pal_render_pass const *wrapped_render_pass, brx_pal_pipeline_layout const *wrapped_pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION wrapped_depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION wrapped_blend_operation)
+void brx_pal_vk_graphics_pipeline::init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, brx_pal_vk_shader_module_cache *shader_module_cache, void const *graphics_pipeline_create_info_next, VkRenderPass render_pass, uint32_t color_attachment_count, uint32_t sample_count, brx_pal_pipeline_layout const *wrapped_pipeline_layout, uint32_t vertex_binding_count, uint32_t const *vertex_binding_strides, uint32_t vertex_attribute_count, BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *vertex_shader_specialization, size_t task_shader_module_code_size, void const *task_shader_module_code, size_t mesh_shader_module_code_size, void const *mesh_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *fragment_shader_specialization, bool enable_back_face_cull, bool front_ccw, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION wrapped_depth_compare_operation, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION wrapped_blend_operation, bool extended_dynamic_state)
 {
-	PFN_vkCreateShaderModule const pfn_create_shader_module = reinterpret_cast<PFN_vkCreateShaderModule>(pfn_get_device_proc_addr(device, "vkCreateShaderModule"));
-	assert(pfn_create_shader_module);
-	PFN_vkDestroyShaderModule const pfn_destroy_shader_module = reinterpret_cast<PFN_vkDestroyShaderModule>(pfn_get_device_proc_addr(device, "vkDestroyShaderModule"));
-	assert(pfn_destroy_shader_module);
 	PFN_vkCreateGraphicsPipelines const pfn_create_graphics_pipelines = reinterpret_cast<PFN_vkCreateGraphicsPipelines>(pfn_get_device_proc_addr(device, "vkCreateGraphicsPipelines"));
 	assert(pfn_create_graphics_pipelines);
 
 	// NOTE: single subpass is enough
 	// input attachment is NOT necessary
 	// use VK_ARM_rasterization_order_attachment_access (VK_EXT_rasterization_order_attachment_access) instead
+	// the subpass index is ignored by the dynamic rendering
 	constexpr uint32_t const subpass_index = 0U;
 
-	assert(NULL != wrapped_render_pass);
-	VkRenderPass render_pass = static_cast<brx_pal_vk_render_pass const *>(wrapped_render_pass)->get_render_pass();
-
 	assert(NULL != wrapped_pipeline_layout);
 	VkPipelineLayout pipeline_layout = static_cast<brx_pal_vk_pipeline_layout const *>(wrapped_pipeline_layout)->get_pipeline_layout();
 
-	VkShaderModule vertex_shader_module = VK_NULL_HANDLE;
+	assert(NULL != shader_module_cache);
+
+	mcrt_vector<VkSpecializationMapEntry> vertex_shader_specialization_map_entries;
+	VkSpecializationInfo vertex_shader_specialization_info;
+	char const *vertex_shader_entry_point_name;
+	VkSpecializationInfo const *const vertex_shader_p_specialization_info = _internal_unwrap_shader_stage_specialization(vertex_shader_specialization, &vertex_shader_specialization_map_entries, &vertex_shader_specialization_info, &vertex_shader_entry_point_name);
+
+	mcrt_vector<VkSpecializationMapEntry> fragment_shader_specialization_map_entries;
+	VkSpecializationInfo fragment_shader_specialization_info;
+	char const *fragment_shader_entry_point_name;
+	VkSpecializationInfo const *const fragment_shader_p_specialization_info = _internal_unwrap_shader_stage_specialization(fragment_shader_specialization, &fragment_shader_specialization_map_entries, &fragment_shader_specialization_info, &fragment_shader_entry_point_name);
+
+	// the vertex shader is replaced by the (optional) task shader and the mesh shader in the mesh shader graphics pipeline
+	bool const mesh_shader = (NULL != mesh_shader_module_code);
+
+	constexpr uint32_t const max_stage_count = 3U;
+	VkPipelineShaderStageCreateInfo stages[max_stage_count];
+	uint32_t stage_count = 0U;
+
+	if (!mesh_shader)
 	{
-		VkShaderModuleCreateInfo const shader_module_create_info = {
-			VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
+		assert(NULL == task_shader_module_code);
+
+		assert(NULL == this->m_vertex_shader_module);
+		this->m_vertex_shader_module = shader_module_cache->acquire(vertex_shader_module_code_size, vertex_shader_module_code);
+
+		stages[stage_count] = VkPipelineShaderStageCreateInfo{
+			VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
 			NULL,
 			0U,
-			vertex_shader_module_code_size,
-			static_cast<uint32_t const *>(vertex_shader_module_code)};
-
-		VkResult const res_create_shader_module = pfn_create_shader_module(device, &shader_module_create_info, NULL, &vertex_shader_module);
-		assert(VK_SUCCESS == res_create_shader_module);
+			VK_SHADER_STAGE_VERTEX_BIT,
+			this->m_vertex_shader_module->m_shader_module,
+			vertex_shader_entry_point_name,
+			vertex_shader_p_specialization_info};
+		++stage_count;
 	}
-
-	VkShaderModule fragment_shader_module = VK_NULL_HANDLE;
+	else
 	{
-		VkShaderModuleCreateInfo const shader_module_create_info = {
-			VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
+		assert(NULL == vertex_shader_module_code);
+		assert((0U == vertex_binding_count) && (0U == vertex_attribute_count));
+
+		if (NULL != task_shader_module_code)
+		{
+			assert(NULL == this->m_task_shader_module);
+			this->m_task_shader_module = shader_module_cache->acquire(task_shader_module_code_size, task_shader_module_code);
+
+			stages[stage_count] = VkPipelineShaderStageCreateInfo{
+				VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+				NULL,
+				0U,
+				VK_SHADER_STAGE_TASK_BIT_EXT,
+				this->m_task_shader_module->m_shader_module,
+				"main",
+				NULL};
+			++stage_count;
+		}
+
+		assert(NULL == this->m_mesh_shader_module);
+		this->m_mesh_shader_module = shader_module_cache->acquire(mesh_shader_module_code_size, mesh_shader_module_code);
+
+		stages[stage_count] = VkPipelineShaderStageCreateInfo{
+			VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
 			NULL,
 			0U,
-			fragment_shader_module_code_size,
-			static_cast<uint32_t const *>(fragment_shader_module_code)};
+			VK_SHADER_STAGE_MESH_BIT_EXT,
+			this->m_mesh_shader_module->m_shader_module,
+			"main",
+			NULL};
+		++stage_count;
+	}
+
+	assert(NULL == this->m_fragment_shader_module);
+	this->m_fragment_shader_module = shader_module_cache->acquire(fragment_shader_module_code_size, fragment_shader_module_code);
+
+	stages[stage_count] = VkPipelineShaderStageCreateInfo{
+		VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+		NULL,
+		0U,
+		VK_SHADER_STAGE_FRAGMENT_BIT,
+		this->m_fragment_shader_module->m_shader_module,
+		fragment_shader_entry_point_name,
+		fragment_shader_p_specialization_info};
+	++stage_count;
 
-		VkResult const res_create_shader_module = pfn_create_shader_module(device, &shader_module_create_info, NULL, &fragment_shader_module);
-		assert(VK_SUCCESS == res_create_shader_module);
+	assert((0U == vertex_binding_count) || (NULL != vertex_binding_strides));
+	mcrt_vector<VkVertexInputBindingDescription> vertex_binding_descriptions(static_cast<size_t>(vertex_binding_count));
+	for (uint32_t vertex_binding_index = 0U; vertex_binding_index < vertex_binding_count; ++vertex_binding_index)
+	{
+		vertex_binding_descriptions[vertex_binding_index] = VkVertexInputBindingDescription{
+			vertex_binding_index,
+			vertex_binding_strides[vertex_binding_index],
+			VK_VERTEX_INPUT_RATE_VERTEX};
 	}
 
-	VkPipelineShaderStageCreateInfo const stages[2] =
-		{
-			{VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
-			 NULL,
-			 0U,
-			 VK_SHADER_STAGE_VERTEX_BIT,
-			 vertex_shader_module,
-			 "main",
-			 NULL},
-			{VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
-			 NULL,
-			 0U,
-			 VK_SHADER_STAGE_FRAGMENT_BIT,
-			 fragment_shader_module,
-			 "main",
-			 NULL}};
+	assert(0U == this->m_vertex_binding_count);
+	this->m_vertex_binding_count = vertex_binding_count;
+
+	assert((0U == vertex_attribute_count) || (NULL != vertex_attributes));
+	mcrt_vector<VkVertexInputAttributeDescription> vertex_attribute_descriptions(static_cast<size_t>(vertex_attribute_count));
+	for (uint32_t vertex_attribute_index = 0U; vertex_attribute_index < vertex_attribute_count; ++vertex_attribute_index)
+	{
+		assert(vertex_attributes[vertex_attribute_index].binding < vertex_binding_count);
+		vertex_attribute_descriptions[vertex_attribute_index] = VkVertexInputAttributeDescription{
+			vertex_attributes[vertex_attribute_index].location,
+			vertex_attributes[vertex_attribute_index].binding,
+			_internal_unwrap_vertex_attribute_format(vertex_attributes[vertex_attribute_index].format),
+			vertex_attributes[vertex_attribute_index].offset};
+	}
 
 	VkPipelineVertexInputStateCreateInfo const vertex_input_state = {
 		VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO,
 		NULL,
 		0U,
-		0U,
-		NULL,
-		0U,
-		NULL};
+		vertex_binding_count,
+		vertex_binding_descriptions.data(),
+		vertex_attribute_count,
+		vertex_attribute_descriptions.data()};
 
 	VkPipelineInputAssemblyStateCreateInfo const input_assembly_state = {
 		VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO,
@@ -129,7 +254,7 @@ void brx_pal_vk_graphics_pipeline::init(PFN_vkGetDeviceProcAddr pfn_get_device_p
 		VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO,
 		NULL,
 		0U,
-		VK_SAMPLE_COUNT_1_BIT,
+		static_cast<VkSampleCountFlagBits>(sample_count),
 		VK_FALSE,
 		0.0F,
 		NULL,
@@ -138,33 +263,7 @@ void brx_pal_vk_graphics_pipeline::init(PFN_vkGetDeviceProcAddr pfn_get_device_p
 
 	VkBool32 depth_test_enable;
 	VkCompareOp depth_compare_op;
-	switch (wrapped_depth_compare_operation)
-	{
-	case BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION_DISABLE:
-	{
-		depth_test_enable = VK_FALSE;
-		depth_compare_op = VK_COMPARE_OP_ALWAYS;
-	}
-	break;
-	case BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION_GREATER:
-	{
-		depth_test_enable = VK_TRUE;
-		depth_compare_op = VK_COMPARE_OP_GREATER;
-	}
-	break;
-	case BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION_LESS:
-	{
-		depth_test_enable = VK_TRUE;
-		depth_compare_op = VK_COMPARE_OP_LESS;
-	}
-	break;
-	default:
-	{
-		assert(false);
-		depth_test_enable = VK_FALSE;
-		depth_compare_op = VK_COMPARE_OP_ALWAYS;
-	}
-	}
+	_internal_unwrap_depth_compare_operation(wrapped_depth_compare_operation, &depth_test_enable, &depth_compare_op);
 
 	VkPipelineDepthStencilStateCreateInfo const depth_stencil_state = {
 		VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO,
@@ -180,69 +279,8 @@ void brx_pal_vk_graphics_pipeline::init(PFN_vkGetDeviceProcAddr pfn_get_device_p
 		0.0F,
 		1.0F};
 
-	uint32_t const color_attachment_count = static_cast<brx_pal_vk_render_pass const *>(wrapped_render_pass)->get_color_attachment_count();
 	mcrt_vector<VkPipelineColorBlendAttachmentState> attachments(color_attachment_count);
-	switch (wrapped_blend_operation)
-	{
-	case BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION_DISABLE:
-	{
-		for (uint32_t color_attachment_index = 0U; color_attachment_index < color_attachment_count; ++color_attachment_index)
-		{
-			attachments[color_attachment_index] = VkPipelineColorBlendAttachmentState{
-				VK_FALSE,
-				VK_BLEND_FACTOR_ONE,
-				VK_BLEND_FACTOR_ZERO,
-				VK_BLEND_OP_ADD,
-				VK_BLEND_FACTOR_ONE,
-				VK_BLEND_FACTOR_ZERO,
-				VK_BLEND_OP_ADD,
-				VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT};
-		}
-	}
-	break;
-	case BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION_OVER:
-	{
-		attachments[0] = VkPipelineColorBlendAttachmentState{
-			VK_TRUE,
-			VK_BLEND_FACTOR_SRC_ALPHA,
-			VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA,
-			VK_BLEND_OP_ADD,
-			VK_BLEND_FACTOR_ONE,
-			VK_BLEND_FACTOR_ONE,
-			VK_BLEND_OP_MAX,
-			VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT};
-
-		for (uint32_t color_attachment_index = 1U; color_attachment_index < color_attachment_count; ++color_attachment_index)
-		{
-			attachments[color_attachment_index] = VkPipelineColorBlendAttachmentState{
-				VK_FALSE,
-				VK_BLEND_FACTOR_ONE,
-				VK_BLEND_FACTOR_ZERO,
-				VK_BLEND_OP_ADD,
-				VK_BLEND_FACTOR_ONE,
-				VK_BLEND_FACTOR_ZERO,
-				VK_BLEND_OP_ADD,
-				VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT};
-		}
-	}
-	break;
-	default:
-	{
-		assert(false);
-		for (uint32_t color_attachment_index = 0U; color_attachment_index < color_attachment_count; ++color_attachment_index)
-		{
-			attachments[color_attachment_index] = VkPipelineColorBlendAttachmentState{
-				VK_FALSE,
-				VK_BLEND_FACTOR_ONE,
-				VK_BLEND_FACTOR_ZERO,
-				VK_BLEND_OP_ADD,
-				VK_BLEND_FACTOR_ONE,
-				VK_BLEND_FACTOR_ZERO,
-				VK_BLEND_OP_ADD,
-				VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT};
-		}
-	}
-	}
+	_internal_unwrap_blend_operation(wrapped_blend_operation, color_attachment_count, attachments.data());
 
 	VkPipelineColorBlendStateCreateInfo const color_blend_state = {
 		VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO,
@@ -254,25 +292,32 @@ void brx_pal_vk_graphics_pipeline::init(PFN_vkGetDeviceProcAddr pfn_get_device_p
 		attachments.data(),
 		{0.0F, 0.0F, 0.0F, 0.0F}};
 
-	VkDynamicState const dynamic_states[2] = {
+	// the static cull mode, depth compare operation and blend operation are ignored when the extended dynamic state is used
+	VkDynamicState const dynamic_states[8] = {
 		VK_DYNAMIC_STATE_VIEWPORT,
-		VK_DYNAMIC_STATE_SCISSOR};
+		VK_DYNAMIC_STATE_SCISSOR,
+		VK_DYNAMIC_STATE_CULL_MODE_EXT,
+		VK_DYNAMIC_STATE_FRONT_FACE_EXT,
+		VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE_EXT,
+		VK_DYNAMIC_STATE_DEPTH_COMPARE_OP_EXT,
+		VK_DYNAMIC_STATE_COLOR_BLEND_ENABLE_EXT,
+		VK_DYNAMIC_STATE_COLOR_BLEND_EQUATION_EXT};
 
 	VkPipelineDynamicStateCreateInfo const dynamic_state = {
 		VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO,
 		NULL,
 		0U,
-		sizeof(dynamic_states) / sizeof(dynamic_states[0]),
+		extended_dynamic_state ? static_cast<uint32_t>(sizeof(dynamic_states) / sizeof(dynamic_states[0])) : 2U,
 		dynamic_states};
 
 	VkGraphicsPipelineCreateInfo const graphics_pipeline_create_info = {
 		VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
-		NULL,
+		graphics_pipeline_create_info_next,
 		0U,
-		sizeof(stages) / sizeof(stages[0]),
+		stage_count,
 		stages,
-		&vertex_input_state,
-		&input_assembly_state,
+		(!mesh_shader) ? &vertex_input_state : NULL,
+		(!mesh_shader) ? &input_assembly_state : NULL,
 		NULL,
 		&viewport_state,
 		&rasterization_state,
@@ -288,12 +333,89 @@ void brx_pal_vk_graphics_pipeline::init(PFN_vkGetDeviceProcAddr pfn_get_device_p
 	assert(VK_NULL_HANDLE == this->m_pipeline);
 	VkResult const res_create_graphics_pipelines = pfn_create_graphics_pipelines(device, VK_NULL_HANDLE, 1U, &graphics_pipeline_create_info, allocation_callbacks, &this->m_pipeline);
 	assert(VK_SUCCESS == res_create_graphics_pipelines);
+}
+
+void brx_pal_vk_graphics_pipeline::init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, brx_pal_vk_shader_module_cache *shader_module_cache, VkPipeline vertex_input_interface_library, brx_pal_pipeline_layout const *wrapped_pipeline_layout, brx_pal_graphics_pipeline_pre_rasterization_shader_library const *wrapped_pre_rasterization_shader_library, brx_pal_graphics_pipeline_fragment_shader_library const *wrapped_fragment_shader_library, brx_pal_graphics_pipeline_fragment_output_interface_library const *wrapped_fragment_output_interface_library, bool link_time_optimization)
+{
+	assert(NULL != wrapped_pre_rasterization_shader_library);
+	brx_pal_vk_graphics_pipeline_pre_rasterization_shader_library const *const pre_rasterization_shader_library = static_cast<brx_pal_vk_graphics_pipeline_pre_rasterization_shader_library const *>(wrapped_pre_rasterization_shader_library);
+
+	assert(NULL != wrapped_fragment_shader_library);
+	brx_pal_vk_graphics_pipeline_fragment_shader_library const *const fragment_shader_library = static_cast<brx_pal_vk_graphics_pipeline_fragment_shader_library const *>(wrapped_fragment_shader_library);
+
+	assert(NULL != wrapped_fragment_output_interface_library);
+	brx_pal_vk_graphics_pipeline_fragment_output_interface_library const *const fragment_output_interface_library = static_cast<brx_pal_vk_graphics_pipeline_fragment_output_interface_library const *>(wrapped_fragment_output_interface_library);
+
+	// the view mask should be the same for all libraries
+	assert(pre_rasterization_shader_library->get_view_count() == fragment_output_interface_library->get_view_count());
+	assert(fragment_shader_library->get_view_count() == fragment_output_interface_library->get_view_count());
+
+	if (VK_NULL_HANDLE != vertex_input_interface_library)
+	{
+		PFN_vkCreateGraphicsPipelines const pfn_create_graphics_pipelines = reinterpret_cast<PFN_vkCreateGraphicsPipelines>(pfn_get_device_proc_addr(device, "vkCreateGraphicsPipelines"));
+		assert(pfn_create_graphics_pipelines);
+
+		assert(NULL != wrapped_pipeline_layout);
+		VkPipelineLayout pipeline_layout = static_cast<brx_pal_vk_pipeline_layout const *>(wrapped_pipeline_layout)->get_pipeline_layout();
+
+		VkPipeline const libraries[4] = {
+			vertex_input_interface_library,
+			pre_rasterization_shader_library->get_library(),
+			fragment_shader_library->get_library(),
+			fragment_output_interface_library->get_library()};
+		assert(VK_NULL_HANDLE != libraries[1]);
+		assert(VK_NULL_HANDLE != libraries[2]);
+		assert(VK_NULL_HANDLE != libraries[3]);
+
+		VkPipelineLibraryCreateInfoKHR const pipeline_library_create_info = {
+			VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR,
+			NULL,
+			sizeof(libraries) / sizeof(libraries[0]),
+			libraries};
+
+		// the states are provided by the libraries, and the link time optimization is allowed since the libraries are created with the "RETAIN_LINK_TIME_OPTIMIZATION_INFO"
+		VkGraphicsPipelineCreateInfo const graphics_pipeline_create_info = {
+			VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+			&pipeline_library_create_info,
+			link_time_optimization ? static_cast<VkPipelineCreateFlags>(VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT) : 0U,
+			0U,
+			NULL,
+			NULL,
+			NULL,
+			NULL,
+			NULL,
+			NULL,
+			NULL,
+			NULL,
+			NULL,
+			NULL,
+			pipeline_layout,
+			VK_NULL_HANDLE,
+			0U,
+			VK_NULL_HANDLE,
+			0U};
+		assert(VK_NULL_HANDLE == this->m_pipeline);
+		VkResult const res_create_graphics_pipelines = pfn_create_graphics_pipelines(device, VK_NULL_HANDLE, 1U, &graphics_pipeline_create_info, allocation_callbacks, &this->m_pipeline);
+		assert(VK_SUCCESS == res_create_graphics_pipelines);
 
-	pfn_destroy_shader_module(device, vertex_shader_module, allocation_callbacks);
-	pfn_destroy_shader_module(device, fragment_shader_module, allocation_callbacks);
+		// the vertex input interface library has no vertex binding
+		assert(0U == this->m_vertex_binding_count);
+
+		// the shader modules are owned by the libraries
+		assert(NULL == this->m_vertex_shader_module);
+		assert(NULL == this->m_task_shader_module);
+		assert(NULL == this->m_mesh_shader_module);
+		assert(NULL == this->m_fragment_shader_module);
+	}
+	else
+	{
+		// the shader modules are acquired from the cache by the SPIR-V code recorded in the libraries
+		this->init(pfn_get_device_proc_addr, device, allocation_callbacks, shader_module_cache, fragment_output_interface_library->get_color_attachment_count(), fragment_output_interface_library->get_color_attachment_formats(), fragment_output_interface_library->get_depth_stencil_attachment_format(), fragment_output_interface_library->get_sample_count(), fragment_output_interface_library->get_view_count(), wrapped_pipeline_layout, 0U, NULL, 0U, NULL, pre_rasterization_shader_library->get_vertex_shader_module_code_size(), pre_rasterization_shader_library->get_vertex_shader_module_code(), NULL, 0U, NULL, 0U, NULL, fragment_shader_library->get_fragment_shader_module_code_size(), fragment_shader_library->get_fragment_shader_module_code(), NULL, pre_rasterization_shader_library->get_enable_back_face_cull(), pre_rasterization_shader_library->get_front_ccw(), fragment_shader_library->get_depth_compare_operation(), fragment_output_interface_library->get_blend_operation(), false);
+	}
 }
 
-void brx_pal_vk_graphics_pipeline::uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+
+void brx_pal_vk_graphics_pipeline::uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, brx_pal_vk_shader_module_cache *shader_module_cache)
 {
 	PFN_vkDestroyPipeline const pfn_destroy_pipeline = reinterpret_cast<PFN_vkDestroyPipeline>(pfn_get_device_proc_addr(device, "vkDestroyPipeline"));
 	assert(NULL != pfn_destroy_pipeline);
@@ -303,11 +425,45 @@ void brx_pal_vk_graphics_pipeline::uninit(PFN_vkGetDeviceProcAddr pfn_get_device
 	pfn_destroy_pipeline(device, this->m_pipeline, allocation_callbacks);
 
 	this->m_pipeline = VK_NULL_HANDLE;
+
+	this->m_vertex_binding_count = 0U;
+
+	// the shader module is destroyed by the cache when the last pipeline created from the same SPIR-V code is destroyed
+	assert(NULL != shader_module_cache);
+
+	// the pipeline linked from the graphics pipeline libraries does NOT own the shader modules
+	if (NULL != this->m_vertex_shader_module)
+	{
+		shader_module_cache->release(this->m_vertex_shader_module);
+		this->m_vertex_shader_module = NULL;
+	}
+
+	if (NULL != this->m_task_shader_module)
+	{
+		shader_module_cache->release(this->m_task_shader_module);
+		this->m_task_shader_module = NULL;
+	}
+
+	if (NULL != this->m_mesh_shader_module)
+	{
+		shader_module_cache->release(this->m_mesh_shader_module);
+		this->m_mesh_shader_module = NULL;
+	}
+
+	if (NULL != this->m_fragment_shader_module)
+	{
+		shader_module_cache->release(this->m_fragment_shader_module);
+		this->m_fragment_shader_module = NULL;
+	}
 }
 
 brx_pal_vk_graphics_pipeline::~brx_pal_vk_graphics_pipeline()
 {
 	assert(VK_NULL_HANDLE == this->m_pipeline);
+	assert(NULL == this->m_vertex_shader_module);
+	assert(NULL == this->m_task_shader_module);
+	assert(NULL == this->m_mesh_shader_module);
+	assert(NULL == this->m_fragment_shader_module);
 }
 
 VkPipeline brx_pal_vk_graphics_pipeline::get_pipeline() const
@@ -315,68 +471,831 @@ VkPipeline brx_pal_vk_graphics_pipeline::get_pipeline() const
 	return this->m_pipeline;
 }
 
-brx_pal_vk_compute_pipeline::brx_pal_vk_compute_pipeline() : m_pipeline(VK_NULL_HANDLE)
+uint32_t brx_pal_vk_graphics_pipeline::get_vertex_binding_count() const
 {
+	return this->m_vertex_binding_count;
 }
 
-void brx_pal_vk_compute_pipeline::init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, brx_pal_pipeline_layout const *wrapped_pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code)
+brx_pal_vk_graphics_pipeline_pre_rasterization_shader_library::brx_pal_vk_graphics_pipeline_pre_rasterization_shader_library() : m_library(VK_NULL_HANDLE), m_vertex_shader_module(NULL), m_view_count(0U), m_enable_back_face_cull(false), m_front_ccw(false)
 {
-	PFN_vkCreateShaderModule const pfn_create_shader_module = reinterpret_cast<PFN_vkCreateShaderModule>(pfn_get_device_proc_addr(device, "vkCreateShaderModule"));
-	assert(pfn_create_shader_module);
-	PFN_vkDestroyShaderModule const pfn_destroy_shader_module = reinterpret_cast<PFN_vkDestroyShaderModule>(pfn_get_device_proc_addr(device, "vkDestroyShaderModule"));
-	assert(pfn_destroy_shader_module);
-	PFN_vkCreateComputePipelines const pfn_create_compute_pipelines = reinterpret_cast<PFN_vkCreateComputePipelines>(pfn_get_device_proc_addr(device, "vkCreateComputePipelines"));
-	assert(pfn_create_compute_pipelines);
+}
 
-	assert(NULL != wrapped_pipeline_layout);
-	VkPipelineLayout pipeline_layout = static_cast<brx_pal_vk_pipeline_layout const *>(wrapped_pipeline_layout)->get_pipeline_layout();
+void brx_pal_vk_graphics_pipeline_pre_rasterization_shader_library::init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, brx_pal_vk_shader_module_cache *shader_module_cache, bool support_graphics_pipeline_library, uint32_t view_count, brx_pal_pipeline_layout const *wrapped_pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, bool enable_back_face_cull, bool front_ccw)
+{
+	// the shader module is acquired if the library is created, otherwise the SPIR-V code is recorded for the monolithic graphics pipeline
+	assert(NULL != shader_module_cache);
+	assert(NULL == this->m_vertex_shader_module);
+	assert(this->m_vertex_shader_module_code.empty());
+	if (support_graphics_pipeline_library)
+	{
+		this->m_vertex_shader_module = shader_module_cache->acquire(vertex_shader_module_code_size, vertex_shader_module_code);
+	}
+	else
+	{
+		assert(0U == (vertex_shader_module_code_size % sizeof(uint32_t)));
+		this->m_vertex_shader_module_code.assign(static_cast<uint32_t const *>(vertex_shader_module_code), static_cast<uint32_t const *>(vertex_shader_module_code) + (vertex_shader_module_code_size / sizeof(uint32_t)));
+	}
+
+	assert(0U == this->m_view_count);
+	this->m_view_count = view_count;
 
-	VkShaderModule compute_shader_module = VK_NULL_HANDLE;
+	this->m_enable_back_face_cull = enable_back_face_cull;
+	this->m_front_ccw = front_ccw;
+
+	assert(VK_NULL_HANDLE == this->m_library);
+	if (support_graphics_pipeline_library)
 	{
-		VkShaderModuleCreateInfo const shader_module_create_info = {
-			VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
+		PFN_vkCreateGraphicsPipelines const pfn_create_graphics_pipelines = reinterpret_cast<PFN_vkCreateGraphicsPipelines>(pfn_get_device_proc_addr(device, "vkCreateGraphicsPipelines"));
+		assert(pfn_create_graphics_pipelines);
+
+		assert(NULL != wrapped_pipeline_layout);
+		VkPipelineLayout pipeline_layout = static_cast<brx_pal_vk_pipeline_layout const *>(wrapped_pipeline_layout)->get_pipeline_layout();
+
+		VkPipelineShaderStageCreateInfo const stage = {
+			VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+			NULL,
+			0U,
+			VK_SHADER_STAGE_VERTEX_BIT,
+			this->m_vertex_shader_module->m_shader_module,
+			"main",
+			NULL};
+
+		VkPipelineViewportStateCreateInfo const viewport_state = {
+			VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO,
+			NULL,
+			0U,
+			1U,
+			NULL,
+			1U,
+			NULL};
+
+		VkPipelineRasterizationStateCreateInfo const rasterization_state = {
+			VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO,
+			NULL,
+			0U,
+			VK_FALSE,
+			VK_FALSE,
+			VK_POLYGON_MODE_FILL,
+			enable_back_face_cull ? static_cast<VkCullModeFlags>(VK_CULL_MODE_BACK_BIT) : static_cast<VkCullModeFlags>(VK_CULL_MODE_NONE),
+			front_ccw ? VK_FRONT_FACE_COUNTER_CLOCKWISE : VK_FRONT_FACE_CLOCKWISE,
+			VK_FALSE,
+			0.0F,
+			0.0F,
+			0.0F,
+			1.0F};
+
+		VkDynamicState const dynamic_states[2] = {
+			VK_DYNAMIC_STATE_VIEWPORT,
+			VK_DYNAMIC_STATE_SCISSOR};
+
+		VkPipelineDynamicStateCreateInfo const dynamic_state = {
+			VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO,
+			NULL,
+			0U,
+			sizeof(dynamic_states) / sizeof(dynamic_states[0]),
+			dynamic_states};
+
+		VkGraphicsPipelineLibraryCreateInfoEXT const graphics_pipeline_library_create_info = {
+			VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT,
 			NULL,
+			VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT};
+
+		// only the view mask is used by the pre-rasterization shaders
+		VkPipelineRenderingCreateInfoKHR const pipeline_rendering_create_info = {
+			VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR,
+			&graphics_pipeline_library_create_info,
+			(1U == view_count) ? 0U : ((view_count >= 32U) ? 0xFFFFFFFFU : ((1U << view_count) - 1U)),
 			0U,
-			compute_shader_module_code_size,
-			static_cast<uint32_t const *>(compute_shader_module_code)};
+			NULL,
+			VK_FORMAT_UNDEFINED,
+			VK_FORMAT_UNDEFINED};
 
-		VkResult const res_create_shader_module = pfn_create_shader_module(device, &shader_module_create_info, NULL, &compute_shader_module);
-		assert(VK_SUCCESS == res_create_shader_module);
+		VkGraphicsPipelineCreateInfo const graphics_pipeline_create_info = {
+			VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+			&pipeline_rendering_create_info,
+			VK_PIPELINE_CREATE_LIBRARY_BIT_KHR | VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT,
+			1U,
+			&stage,
+			NULL,
+			NULL,
+			NULL,
+			&viewport_state,
+			&rasterization_state,
+			NULL,
+			NULL,
+			NULL,
+			&dynamic_state,
+			pipeline_layout,
+			VK_NULL_HANDLE,
+			0U,
+			VK_NULL_HANDLE,
+			0U};
+		VkResult const res_create_graphics_pipelines = pfn_create_graphics_pipelines(device, VK_NULL_HANDLE, 1U, &graphics_pipeline_create_info, allocation_callbacks, &this->m_library);
+		assert(VK_SUCCESS == res_create_graphics_pipelines);
 	}
+}
 
-	VkComputePipelineCreateInfo const compute_pipeline_create_info = {
-		VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
-		NULL,
-		0U,
-		{VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO, NULL, 0U, VK_SHADER_STAGE_COMPUTE_BIT, compute_shader_module, "main", NULL},
-		pipeline_layout,
-		VK_NULL_HANDLE,
-		0U};
-	assert(VK_NULL_HANDLE == this->m_pipeline);
-	VkResult const res_create_compute_pipelines = pfn_create_compute_pipelines(device, VK_NULL_HANDLE, 1U, &compute_pipeline_create_info, allocation_callbacks, &this->m_pipeline);
-	assert(VK_SUCCESS == res_create_compute_pipelines);
+void brx_pal_vk_graphics_pipeline_pre_rasterization_shader_library::uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, brx_pal_vk_shader_module_cache *shader_module_cache)
+{
+	if (VK_NULL_HANDLE != this->m_library)
+	{
+		PFN_vkDestroyPipeline const pfn_destroy_pipeline = reinterpret_cast<PFN_vkDestroyPipeline>(pfn_get_device_proc_addr(device, "vkDestroyPipeline"));
+		assert(NULL != pfn_destroy_pipeline);
+
+		pfn_destroy_pipeline(device, this->m_library, allocation_callbacks);
 
-	pfn_destroy_shader_module(device, compute_shader_module, allocation_callbacks);
+		this->m_library = VK_NULL_HANDLE;
+	}
+
+	assert(0U != this->m_view_count);
+	this->m_view_count = 0U;
+
+	assert(NULL != shader_module_cache);
+	if (NULL != this->m_vertex_shader_module)
+	{
+		shader_module_cache->release(this->m_vertex_shader_module);
+		this->m_vertex_shader_module = NULL;
+	}
+
+	this->m_vertex_shader_module_code.clear();
 }
 
-void brx_pal_vk_compute_pipeline::uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+brx_pal_vk_graphics_pipeline_pre_rasterization_shader_library::~brx_pal_vk_graphics_pipeline_pre_rasterization_shader_library()
 {
-	PFN_vkDestroyPipeline const pfn_destroy_pipeline = reinterpret_cast<PFN_vkDestroyPipeline>(pfn_get_device_proc_addr(device, "vkDestroyPipeline"));
-	assert(NULL != pfn_destroy_pipeline);
+	assert(VK_NULL_HANDLE == this->m_library);
+	assert(NULL == this->m_vertex_shader_module);
+	assert(this->m_vertex_shader_module_code.empty());
+	assert(0U == this->m_view_count);
+}
 
-	assert(VK_NULL_HANDLE != this->m_pipeline);
+VkPipeline brx_pal_vk_graphics_pipeline_pre_rasterization_shader_library::get_library() const
+{
+	return this->m_library;
+}
 
-	pfn_destroy_pipeline(device, this->m_pipeline, allocation_callbacks);
+size_t brx_pal_vk_graphics_pipeline_pre_rasterization_shader_library::get_vertex_shader_module_code_size() const
+{
+	return sizeof(uint32_t) * this->m_vertex_shader_module_code.size();
+}
 
-	this->m_pipeline = VK_NULL_HANDLE;
+void const *brx_pal_vk_graphics_pipeline_pre_rasterization_shader_library::get_vertex_shader_module_code() const
+{
+	return this->m_vertex_shader_module_code.data();
 }
 
-brx_pal_vk_compute_pipeline::~brx_pal_vk_compute_pipeline()
+uint32_t brx_pal_vk_graphics_pipeline_pre_rasterization_shader_library::get_view_count() const
 {
-	assert(VK_NULL_HANDLE == this->m_pipeline);
+	return this->m_view_count;
 }
 
-VkPipeline brx_pal_vk_compute_pipeline::get_pipeline() const
+bool brx_pal_vk_graphics_pipeline_pre_rasterization_shader_library::get_enable_back_face_cull() const
 {
-	return this->m_pipeline;
+	return this->m_enable_back_face_cull;
+}
+
+bool brx_pal_vk_graphics_pipeline_pre_rasterization_shader_library::get_front_ccw() const
+{
+	return this->m_front_ccw;
+}
+
+brx_pal_vk_graphics_pipeline_fragment_shader_library::brx_pal_vk_graphics_pipeline_fragment_shader_library() : m_library(VK_NULL_HANDLE), m_fragment_shader_module(NULL), m_view_count(0U), m_depth_compare_operation(BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION_DISABLE)
+{
+}
+
+void brx_pal_vk_graphics_pipeline_fragment_shader_library::init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, brx_pal_vk_shader_module_cache *shader_module_cache, bool support_graphics_pipeline_library, uint32_t view_count, brx_pal_pipeline_layout const *wrapped_pipeline_layout, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION wrapped_depth_compare_operation)
+{
+	assert(NULL != shader_module_cache);
+	assert(NULL == this->m_fragment_shader_module);
+	assert(this->m_fragment_shader_module_code.empty());
+	if (support_graphics_pipeline_library)
+	{
+		this->m_fragment_shader_module = shader_module_cache->acquire(fragment_shader_module_code_size, fragment_shader_module_code);
+	}
+	else
+	{
+		assert(0U == (fragment_shader_module_code_size % sizeof(uint32_t)));
+		this->m_fragment_shader_module_code.assign(static_cast<uint32_t const *>(fragment_shader_module_code), static_cast<uint32_t const *>(fragment_shader_module_code) + (fragment_shader_module_code_size / sizeof(uint32_t)));
+	}
+
+	assert(0U == this->m_view_count);
+	this->m_view_count = view_count;
+
+	this->m_depth_compare_operation = wrapped_depth_compare_operation;
+
+	assert(VK_NULL_HANDLE == this->m_library);
+	if (support_graphics_pipeline_library)
+	{
+		PFN_vkCreateGraphicsPipelines const pfn_create_graphics_pipelines = reinterpret_cast<PFN_vkCreateGraphicsPipelines>(pfn_get_device_proc_addr(device, "vkCreateGraphicsPipelines"));
+		assert(pfn_create_graphics_pipelines);
+
+		assert(NULL != wrapped_pipeline_layout);
+		VkPipelineLayout pipeline_layout = static_cast<brx_pal_vk_pipeline_layout const *>(wrapped_pipeline_layout)->get_pipeline_layout();
+
+		VkPipelineShaderStageCreateInfo const stage = {
+			VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+			NULL,
+			0U,
+			VK_SHADER_STAGE_FRAGMENT_BIT,
+			this->m_fragment_shader_module->m_shader_module,
+			"main",
+			NULL};
+
+		VkBool32 depth_test_enable;
+		VkCompareOp depth_compare_op;
+		_internal_unwrap_depth_compare_operation(wrapped_depth_compare_operation, &depth_test_enable, &depth_compare_op);
+
+		VkPipelineDepthStencilStateCreateInfo const depth_stencil_state = {
+			VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO,
+			NULL,
+			0U,
+			depth_test_enable,
+			VK_TRUE,
+			depth_compare_op,
+			VK_FALSE,
+			VK_FALSE,
+			{VK_STENCIL_OP_KEEP, VK_STENCIL_OP_KEEP, VK_STENCIL_OP_KEEP, VK_COMPARE_OP_ALWAYS, 255, 255, 255},
+			{VK_STENCIL_OP_KEEP, VK_STENCIL_OP_KEEP, VK_STENCIL_OP_KEEP, VK_COMPARE_OP_ALWAYS, 255, 255, 255},
+			0.0F,
+			1.0F};
+
+		VkGraphicsPipelineLibraryCreateInfoEXT const graphics_pipeline_library_create_info = {
+			VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT,
+			NULL,
+			VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT};
+
+		// only the view mask is used by the fragment shader
+		VkPipelineRenderingCreateInfoKHR const pipeline_rendering_create_info = {
+			VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR,
+			&graphics_pipeline_library_create_info,
+			(1U == view_count) ? 0U : ((view_count >= 32U) ? 0xFFFFFFFFU : ((1U << view_count) - 1U)),
+			0U,
+			NULL,
+			VK_FORMAT_UNDEFINED,
+			VK_FORMAT_UNDEFINED};
+
+		// the multisample state is NOT required since the sample shading is NOT used
+		VkGraphicsPipelineCreateInfo const graphics_pipeline_create_info = {
+			VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+			&pipeline_rendering_create_info,
+			VK_PIPELINE_CREATE_LIBRARY_BIT_KHR | VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT,
+			1U,
+			&stage,
+			NULL,
+			NULL,
+			NULL,
+			NULL,
+			NULL,
+			NULL,
+			&depth_stencil_state,
+			NULL,
+			NULL,
+			pipeline_layout,
+			VK_NULL_HANDLE,
+			0U,
+			VK_NULL_HANDLE,
+			0U};
+		VkResult const res_create_graphics_pipelines = pfn_create_graphics_pipelines(device, VK_NULL_HANDLE, 1U, &graphics_pipeline_create_info, allocation_callbacks, &this->m_library);
+		assert(VK_SUCCESS == res_create_graphics_pipelines);
+	}
+}
+
+void brx_pal_vk_graphics_pipeline_fragment_shader_library::uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, brx_pal_vk_shader_module_cache *shader_module_cache)
+{
+	if (VK_NULL_HANDLE != this->m_library)
+	{
+		PFN_vkDestroyPipeline const pfn_destroy_pipeline = reinterpret_cast<PFN_vkDestroyPipeline>(pfn_get_device_proc_addr(device, "vkDestroyPipeline"));
+		assert(NULL != pfn_destroy_pipeline);
+
+		pfn_destroy_pipeline(device, this->m_library, allocation_callbacks);
+
+		this->m_library = VK_NULL_HANDLE;
+	}
+
+	assert(0U != this->m_view_count);
+	this->m_view_count = 0U;
+
+	assert(NULL != shader_module_cache);
+	if (NULL != this->m_fragment_shader_module)
+	{
+		shader_module_cache->release(this->m_fragment_shader_module);
+		this->m_fragment_shader_module = NULL;
+	}
+
+	this->m_fragment_shader_module_code.clear();
+}
+
+brx_pal_vk_graphics_pipeline_fragment_shader_library::~brx_pal_vk_graphics_pipeline_fragment_shader_library()
+{
+	assert(VK_NULL_HANDLE == this->m_library);
+	assert(NULL == this->m_fragment_shader_module);
+	assert(this->m_fragment_shader_module_code.empty());
+	assert(0U == this->m_view_count);
+}
+
+VkPipeline brx_pal_vk_graphics_pipeline_fragment_shader_library::get_library() const
+{
+	return this->m_library;
+}
+
+size_t brx_pal_vk_graphics_pipeline_fragment_shader_library::get_fragment_shader_module_code_size() const
+{
+	return sizeof(uint32_t) * this->m_fragment_shader_module_code.size();
+}
+
+void const *brx_pal_vk_graphics_pipeline_fragment_shader_library::get_fragment_shader_module_code() const
+{
+	return this->m_fragment_shader_module_code.data();
+}
+
+uint32_t brx_pal_vk_graphics_pipeline_fragment_shader_library::get_view_count() const
+{
+	return this->m_view_count;
+}
+
+BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION brx_pal_vk_graphics_pipeline_fragment_shader_library::get_depth_compare_operation() const
+{
+	return this->m_depth_compare_operation;
+}
+
+brx_pal_vk_graphics_pipeline_fragment_output_interface_library::brx_pal_vk_graphics_pipeline_fragment_output_interface_library() : m_library(VK_NULL_HANDLE), m_sample_count(0U), m_view_count(0U), m_blend_operation(BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION_DISABLE)
+{
+}
+
+void brx_pal_vk_graphics_pipeline_fragment_output_interface_library::init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, bool support_graphics_pipeline_library, uint32_t color_attachment_count, BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *wrapped_color_attachment_formats, BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *wrapped_depth_stencil_attachment_format, uint32_t sample_count, uint32_t view_count, BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION wrapped_blend_operation)
+{
+	constexpr uint32_t const max_color_attachment_count = 8U;
+	assert(color_attachment_count <= max_color_attachment_count);
+	color_attachment_count = (color_attachment_count < max_color_attachment_count) ? color_attachment_count : max_color_attachment_count;
+
+	assert(NULL != wrapped_color_attachment_formats || 0U == color_attachment_count);
+	assert(this->m_color_attachment_formats.empty());
+	this->m_color_attachment_formats.assign(wrapped_color_attachment_formats, wrapped_color_attachment_formats + color_attachment_count);
+
+	assert(this->m_depth_stencil_attachment_format.empty());
+	if (NULL != wrapped_depth_stencil_attachment_format)
+	{
+		this->m_depth_stencil_attachment_format.push_back(*wrapped_depth_stencil_attachment_format);
+	}
+
+	assert(0U == this->m_sample_count);
+	this->m_sample_count = sample_count;
+
+	assert(0U == this->m_view_count);
+	this->m_view_count = view_count;
+
+	this->m_blend_operation = wrapped_blend_operation;
+
+	assert(VK_NULL_HANDLE == this->m_library);
+	if (support_graphics_pipeline_library)
+	{
+		PFN_vkCreateGraphicsPipelines const pfn_create_graphics_pipelines = reinterpret_cast<PFN_vkCreateGraphicsPipelines>(pfn_get_device_proc_addr(device, "vkCreateGraphicsPipelines"));
+		assert(pfn_create_graphics_pipelines);
+
+		VkFormat color_attachment_formats[max_color_attachment_count];
+		for (uint32_t color_attachment_index = 0U; color_attachment_index < color_attachment_count; ++color_attachment_index)
+		{
+			color_attachment_formats[color_attachment_index] = _internal_unwrap_color_attachment_image_format(wrapped_color_attachment_formats[color_attachment_index]);
+		}
+
+		VkFormat depth_attachment_format;
+		VkFormat stencil_attachment_format;
+		if (NULL != wrapped_depth_stencil_attachment_format)
+		{
+			depth_attachment_format = _internal_unwrap_depth_stencil_attachment_image_format(*wrapped_depth_stencil_attachment_format);
+			// the stencil attachment format should match the "pStencilAttachment" of the "begin_rendering"
+			stencil_attachment_format = ((BRX_PAL_DEPTH_STENCIL_ATTACHMENT_FORMAT_D32_SFLOAT_S8_UINT == (*wrapped_depth_stencil_attachment_format)) || (BRX_PAL_DEPTH_STENCIL_ATTACHMENT_FORMAT_D24_UNORM_S8_UINT == (*wrapped_depth_stencil_attachment_format))) ? depth_attachment_format : VK_FORMAT_UNDEFINED;
+		}
+		else
+		{
+			depth_attachment_format = VK_FORMAT_UNDEFINED;
+			stencil_attachment_format = VK_FORMAT_UNDEFINED;
+		}
+
+		VkPipelineMultisampleStateCreateInfo const multisample_state = {
+			VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO,
+			NULL,
+			0U,
+			static_cast<VkSampleCountFlagBits>(sample_count),
+			VK_FALSE,
+			0.0F,
+			NULL,
+			VK_FALSE,
+			VK_FALSE};
+
+		VkPipelineColorBlendAttachmentState attachments[max_color_attachment_count];
+		_internal_unwrap_blend_operation(wrapped_blend_operation, color_attachment_count, attachments);
+
+		VkPipelineColorBlendStateCreateInfo const color_blend_state = {
+			VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO,
+			NULL,
+			0U,
+			VK_FALSE,
+			VK_LOGIC_OP_CLEAR,
+			color_attachment_count,
+			attachments,
+			{0.0F, 0.0F, 0.0F, 0.0F}};
+
+		VkGraphicsPipelineLibraryCreateInfoEXT const graphics_pipeline_library_create_info = {
+			VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT,
+			NULL,
+			VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT};
+
+		VkPipelineRenderingCreateInfoKHR const pipeline_rendering_create_info = {
+			VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR,
+			&graphics_pipeline_library_create_info,
+			(1U == view_count) ? 0U : ((view_count >= 32U) ? 0xFFFFFFFFU : ((1U << view_count) - 1U)),
+			color_attachment_count,
+			(color_attachment_count > 0U) ? color_attachment_formats : NULL,
+			depth_attachment_format,
+			stencil_attachment_format};
+
+		// the pipeline layout is NOT used by the fragment output interface
+		VkGraphicsPipelineCreateInfo const graphics_pipeline_create_info = {
+			VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+			&pipeline_rendering_create_info,
+			VK_PIPELINE_CREATE_LIBRARY_BIT_KHR | VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT,
+			0U,
+			NULL,
+			NULL,
+			NULL,
+			NULL,
+			NULL,
+			NULL,
+			&multisample_state,
+			NULL,
+			&color_blend_state,
+			NULL,
+			VK_NULL_HANDLE,
+			VK_NULL_HANDLE,
+			0U,
+			VK_NULL_HANDLE,
+			0U};
+		VkResult const res_create_graphics_pipelines = pfn_create_graphics_pipelines(device, VK_NULL_HANDLE, 1U, &graphics_pipeline_create_info, allocation_callbacks, &this->m_library);
+		assert(VK_SUCCESS == res_create_graphics_pipelines);
+	}
+}
+
+void brx_pal_vk_graphics_pipeline_fragment_output_interface_library::uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+{
+	if (VK_NULL_HANDLE != this->m_library)
+	{
+		PFN_vkDestroyPipeline const pfn_destroy_pipeline = reinterpret_cast<PFN_vkDestroyPipeline>(pfn_get_device_proc_addr(device, "vkDestroyPipeline"));
+		assert(NULL != pfn_destroy_pipeline);
+
+		pfn_destroy_pipeline(device, this->m_library, allocation_callbacks);
+
+		this->m_library = VK_NULL_HANDLE;
+	}
+
+	this->m_color_attachment_formats.clear();
+
+	this->m_depth_stencil_attachment_format.clear();
+
+	assert(0U != this->m_sample_count);
+	this->m_sample_count = 0U;
+
+	assert(0U != this->m_view_count);
+	this->m_view_count = 0U;
+}
+
+brx_pal_vk_graphics_pipeline_fragment_output_interface_library::~brx_pal_vk_graphics_pipeline_fragment_output_interface_library()
+{
+	assert(VK_NULL_HANDLE == this->m_library);
+	assert(this->m_color_attachment_formats.empty());
+	assert(this->m_depth_stencil_attachment_format.empty());
+	assert(0U == this->m_sample_count);
+	assert(0U == this->m_view_count);
+}
+
+VkPipeline brx_pal_vk_graphics_pipeline_fragment_output_interface_library::get_library() const
+{
+	return this->m_library;
+}
+
+uint32_t brx_pal_vk_graphics_pipeline_fragment_output_interface_library::get_color_attachment_count() const
+{
+	return static_cast<uint32_t>(this->m_color_attachment_formats.size());
+}
+
+BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT const *brx_pal_vk_graphics_pipeline_fragment_output_interface_library::get_color_attachment_formats() const
+{
+	return this->m_color_attachment_formats.data();
+}
+
+BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT const *brx_pal_vk_graphics_pipeline_fragment_output_interface_library::get_depth_stencil_attachment_format() const
+{
+	return (!this->m_depth_stencil_attachment_format.empty()) ? &this->m_depth_stencil_attachment_format[0] : NULL;
+}
+
+uint32_t brx_pal_vk_graphics_pipeline_fragment_output_interface_library::get_sample_count() const
+{
+	return this->m_sample_count;
+}
+
+uint32_t brx_pal_vk_graphics_pipeline_fragment_output_interface_library::get_view_count() const
+{
+	return this->m_view_count;
+}
+
+BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION brx_pal_vk_graphics_pipeline_fragment_output_interface_library::get_blend_operation() const
+{
+	return this->m_blend_operation;
+}
+
+brx_pal_vk_compute_pipeline::brx_pal_vk_compute_pipeline() : m_pipeline(VK_NULL_HANDLE), m_compute_shader_module(NULL)
+{
+}
+
+void brx_pal_vk_compute_pipeline::init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, brx_pal_vk_shader_module_cache *shader_module_cache, brx_pal_pipeline_layout const *wrapped_pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code, BRX_PAL_SHADER_STAGE_SPECIALIZATION const *compute_shader_specialization, uint32_t required_subgroup_size, bool require_full_subgroups)
+{
+	PFN_vkCreateComputePipelines const pfn_create_compute_pipelines = reinterpret_cast<PFN_vkCreateComputePipelines>(pfn_get_device_proc_addr(device, "vkCreateComputePipelines"));
+	assert(pfn_create_compute_pipelines);
+
+	assert(NULL != wrapped_pipeline_layout);
+	VkPipelineLayout pipeline_layout = static_cast<brx_pal_vk_pipeline_layout const *>(wrapped_pipeline_layout)->get_pipeline_layout();
+
+	assert(NULL != shader_module_cache);
+
+	assert(NULL == this->m_compute_shader_module);
+	this->m_compute_shader_module = shader_module_cache->acquire(compute_shader_module_code_size, compute_shader_module_code);
+	VkShaderModule const compute_shader_module = this->m_compute_shader_module->m_shader_module;
+
+	mcrt_vector<VkSpecializationMapEntry> compute_shader_specialization_map_entries;
+	VkSpecializationInfo compute_shader_specialization_info;
+	char const *compute_shader_entry_point_name;
+	VkSpecializationInfo const *const compute_shader_p_specialization_info = _internal_unwrap_shader_stage_specialization(compute_shader_specialization, &compute_shader_specialization_map_entries, &compute_shader_specialization_info, &compute_shader_entry_point_name);
+
+	// the subgroup size is pinned only when the "required_subgroup_size" is NOT zero (VK_EXT_subgroup_size_control)
+	VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT const compute_shader_required_subgroup_size_create_info = {
+		VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO_EXT,
+		NULL,
+		required_subgroup_size};
+
+	VkPipelineShaderStageCreateFlags const compute_shader_stage_create_flags = (!require_full_subgroups) ? 0U : VK_PIPELINE_SHADER_STAGE_CREATE_REQUIRE_FULL_SUBGROUPS_BIT_EXT;
+
+	VkComputePipelineCreateInfo const compute_pipeline_create_info = {
+		VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
+		NULL,
+		0U,
+		{VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO, (0U == required_subgroup_size) ? NULL : &compute_shader_required_subgroup_size_create_info, compute_shader_stage_create_flags, VK_SHADER_STAGE_COMPUTE_BIT, compute_shader_module, compute_shader_entry_point_name, compute_shader_p_specialization_info},
+		pipeline_layout,
+		VK_NULL_HANDLE,
+		0U};
+	assert(VK_NULL_HANDLE == this->m_pipeline);
+	VkResult const res_create_compute_pipelines = pfn_create_compute_pipelines(device, VK_NULL_HANDLE, 1U, &compute_pipeline_create_info, allocation_callbacks, &this->m_pipeline);
+	assert(VK_SUCCESS == res_create_compute_pipelines);
+}
+
+void brx_pal_vk_compute_pipeline::uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, brx_pal_vk_shader_module_cache *shader_module_cache)
+{
+	PFN_vkDestroyPipeline const pfn_destroy_pipeline = reinterpret_cast<PFN_vkDestroyPipeline>(pfn_get_device_proc_addr(device, "vkDestroyPipeline"));
+	assert(NULL != pfn_destroy_pipeline);
+
+	assert(VK_NULL_HANDLE != this->m_pipeline);
+
+	pfn_destroy_pipeline(device, this->m_pipeline, allocation_callbacks);
+
+	this->m_pipeline = VK_NULL_HANDLE;
+
+	assert(NULL != shader_module_cache);
+
+	assert(NULL != this->m_compute_shader_module);
+	shader_module_cache->release(this->m_compute_shader_module);
+	this->m_compute_shader_module = NULL;
+}
+
+brx_pal_vk_compute_pipeline::~brx_pal_vk_compute_pipeline()
+{
+	assert(VK_NULL_HANDLE == this->m_pipeline);
+	assert(NULL == this->m_compute_shader_module);
+}
+
+VkPipeline brx_pal_vk_compute_pipeline::get_pipeline() const
+{
+	return this->m_pipeline;
+}
+
+static inline VkFormat _internal_unwrap_color_attachment_image_format(BRX_PAL_COLOR_ATTACHMENT_IMAGE_FORMAT wrapped_color_attachment_image_format)
+{
+	VkFormat color_attachment_image_format;
+	switch (wrapped_color_attachment_image_format)
+	{
+	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_B8G8R8A8_UNORM:
+		color_attachment_image_format = VK_FORMAT_B8G8R8A8_UNORM;
+		break;
+	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_R8G8B8A8_UNORM:
+		color_attachment_image_format = VK_FORMAT_R8G8B8A8_UNORM;
+		break;
+	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_A2B10G10R10_UNORM_PACK32:
+		color_attachment_image_format = VK_FORMAT_A2B10G10R10_UNORM_PACK32;
+		break;
+	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_A2R10G10B10_UNORM_PACK32:
+		color_attachment_image_format = VK_FORMAT_A2R10G10B10_UNORM_PACK32;
+		break;
+	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_R16G16_UNORM:
+		color_attachment_image_format = VK_FORMAT_R16G16_UNORM;
+		break;
+	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_R32G32_UINT:
+		color_attachment_image_format = VK_FORMAT_R32G32_UINT;
+		break;
+	case BRX_PAL_COLOR_ATTACHMENT_FORMAT_R32G32B32A32_UINT:
+		color_attachment_image_format = VK_FORMAT_R32G32B32A32_UINT;
+		break;
+	default:
+		assert(false);
+		color_attachment_image_format = VK_FORMAT_UNDEFINED;
+	}
+	return color_attachment_image_format;
+}
+
+static inline VkFormat _internal_unwrap_depth_stencil_attachment_image_format(BRX_PAL_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT wrapped_depth_stencil_attachment_image_format)
+{
+	VkFormat depth_stencil_attachment_image_format;
+	switch (wrapped_depth_stencil_attachment_image_format)
+	{
+	case BRX_PAL_DEPTH_STENCIL_ATTACHMENT_FORMAT_D32_SFLOAT:
+		depth_stencil_attachment_image_format = VK_FORMAT_D32_SFLOAT;
+		break;
+	case BRX_PAL_DEPTH_STENCIL_ATTACHMENT_FORMAT_X8_D24_UNORM_PACK32:
+		depth_stencil_attachment_image_format = VK_FORMAT_X8_D24_UNORM_PACK32;
+		break;
+	case BRX_PAL_DEPTH_STENCIL_ATTACHMENT_FORMAT_D32_SFLOAT_S8_UINT:
+		depth_stencil_attachment_image_format = VK_FORMAT_D32_SFLOAT_S8_UINT;
+		break;
+	case BRX_PAL_DEPTH_STENCIL_ATTACHMENT_FORMAT_D24_UNORM_S8_UINT:
+		depth_stencil_attachment_image_format = VK_FORMAT_D24_UNORM_S8_UINT;
+		break;
+	default:
+		assert(false);
+		depth_stencil_attachment_image_format = VK_FORMAT_UNDEFINED;
+	}
+	return depth_stencil_attachment_image_format;
+}
+
+static inline void _internal_unwrap_depth_compare_operation(BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION wrapped_depth_compare_operation, VkBool32 *out_depth_test_enable, VkCompareOp *out_depth_compare_op)
+{
+	switch (wrapped_depth_compare_operation)
+	{
+	case BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION_DISABLE:
+	{
+		(*out_depth_test_enable) = VK_FALSE;
+		(*out_depth_compare_op) = VK_COMPARE_OP_ALWAYS;
+	}
+	break;
+	case BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION_GREATER:
+	{
+		(*out_depth_test_enable) = VK_TRUE;
+		(*out_depth_compare_op) = VK_COMPARE_OP_GREATER;
+	}
+	break;
+	case BRX_PAL_GRAPHICS_PIPELINE_DEPTH_COMPARE_OPERATION_LESS:
+	{
+		(*out_depth_test_enable) = VK_TRUE;
+		(*out_depth_compare_op) = VK_COMPARE_OP_LESS;
+	}
+	break;
+	default:
+	{
+		assert(false);
+		(*out_depth_test_enable) = VK_FALSE;
+		(*out_depth_compare_op) = VK_COMPARE_OP_ALWAYS;
+	}
+	}
+}
+
+static inline void _internal_unwrap_blend_operation(BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION wrapped_blend_operation, uint32_t color_attachment_count, VkPipelineColorBlendAttachmentState *out_attachments)
+{
+	switch (wrapped_blend_operation)
+	{
+	case BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION_DISABLE:
+	{
+		for (uint32_t color_attachment_index = 0U; color_attachment_index < color_attachment_count; ++color_attachment_index)
+		{
+			out_attachments[color_attachment_index] = VkPipelineColorBlendAttachmentState{
+				VK_FALSE,
+				VK_BLEND_FACTOR_ONE,
+				VK_BLEND_FACTOR_ZERO,
+				VK_BLEND_OP_ADD,
+				VK_BLEND_FACTOR_ONE,
+				VK_BLEND_FACTOR_ZERO,
+				VK_BLEND_OP_ADD,
+				VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT};
+		}
+	}
+	break;
+	case BRX_PAL_GRAPHICS_PIPELINE_BLEND_OPERATION_OVER:
+	{
+		out_attachments[0] = VkPipelineColorBlendAttachmentState{
+			VK_TRUE,
+			VK_BLEND_FACTOR_SRC_ALPHA,
+			VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA,
+			VK_BLEND_OP_ADD,
+			VK_BLEND_FACTOR_ONE,
+			VK_BLEND_FACTOR_ONE,
+			VK_BLEND_OP_MAX,
+			VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT};
+
+		for (uint32_t color_attachment_index = 1U; color_attachment_index < color_attachment_count; ++color_attachment_index)
+		{
+			out_attachments[color_attachment_index] = VkPipelineColorBlendAttachmentState{
+				VK_FALSE,
+				VK_BLEND_FACTOR_ONE,
+				VK_BLEND_FACTOR_ZERO,
+				VK_BLEND_OP_ADD,
+				VK_BLEND_FACTOR_ONE,
+				VK_BLEND_FACTOR_ZERO,
+				VK_BLEND_OP_ADD,
+				VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT};
+		}
+	}
+	break;
+	default:
+	{
+		assert(false);
+		for (uint32_t color_attachment_index = 0U; color_attachment_index < color_attachment_count; ++color_attachment_index)
+		{
+			out_attachments[color_attachment_index] = VkPipelineColorBlendAttachmentState{
+				VK_FALSE,
+				VK_BLEND_FACTOR_ONE,
+				VK_BLEND_FACTOR_ZERO,
+				VK_BLEND_OP_ADD,
+				VK_BLEND_FACTOR_ONE,
+				VK_BLEND_FACTOR_ZERO,
+				VK_BLEND_OP_ADD,
+				VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT};
+		}
+	}
+	}
+}
+
+static inline VkSpecializationInfo const *_internal_unwrap_shader_stage_specialization(BRX_PAL_SHADER_STAGE_SPECIALIZATION const *wrapped_shader_stage_specialization, mcrt_vector<VkSpecializationMapEntry> *out_map_entries, VkSpecializationInfo *out_specialization_info, char const **out_entry_point_name)
+{
+	if ((NULL != wrapped_shader_stage_specialization) && (NULL != wrapped_shader_stage_specialization->entry_point_name))
+	{
+		(*out_entry_point_name) = wrapped_shader_stage_specialization->entry_point_name;
+	}
+	else
+	{
+		(*out_entry_point_name) = "main";
+	}
+
+	VkSpecializationInfo const *specialization_info;
+	if ((NULL != wrapped_shader_stage_specialization) && (wrapped_shader_stage_specialization->specialization_constant_count > 0U))
+	{
+		uint32_t const specialization_constant_count = wrapped_shader_stage_specialization->specialization_constant_count;
+		BRX_PAL_SPECIALIZATION_CONSTANT const *const specialization_constants = wrapped_shader_stage_specialization->specialization_constants;
+		assert(NULL != specialization_constants);
+
+		// the values are directly referenced by the "pData", and only the map entries are built
+		assert(0U == out_map_entries->size());
+		out_map_entries->resize(specialization_constant_count);
+		for (uint32_t specialization_constant_index = 0U; specialization_constant_index < specialization_constant_count; ++specialization_constant_index)
+		{
+			(*out_map_entries)[specialization_constant_index] = VkSpecializationMapEntry{
+				specialization_constants[specialization_constant_index].constant_id,
+				static_cast<uint32_t>(sizeof(BRX_PAL_SPECIALIZATION_CONSTANT) * specialization_constant_index + offsetof(BRX_PAL_SPECIALIZATION_CONSTANT, value)),
+				sizeof(uint32_t)};
+		}
+
+		(*out_specialization_info) = VkSpecializationInfo{
+			specialization_constant_count,
+			&(*out_map_entries)[0],
+			sizeof(BRX_PAL_SPECIALIZATION_CONSTANT) * specialization_constant_count,
+			specialization_constants};
+
+		specialization_info = out_specialization_info;
+	}
+	else
+	{
+		specialization_info = NULL;
+	}
+
+	return specialization_info;
+}
+
+static inline VkFormat _internal_unwrap_vertex_attribute_format(BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE_FORMAT wrapped_vertex_attribute_format)
+{
+	VkFormat vertex_attribute_format;
+	switch (wrapped_vertex_attribute_format)
+	{
+	case BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE_FORMAT_R32G32B32_SFLOAT:
+		vertex_attribute_format = VK_FORMAT_R32G32B32_SFLOAT;
+		break;
+	case BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE_FORMAT_R32G32_SFLOAT:
+		vertex_attribute_format = VK_FORMAT_R32G32_SFLOAT;
+		break;
+	case BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE_FORMAT_R32G32B32A32_SFLOAT:
+		vertex_attribute_format = VK_FORMAT_R32G32B32A32_SFLOAT;
+		break;
+	case BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE_FORMAT_R16G16B16A16_UINT:
+		vertex_attribute_format = VK_FORMAT_R16G16B16A16_UINT;
+		break;
+	case BRX_PAL_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE_FORMAT_R8G8B8A8_UNORM:
+		vertex_attribute_format = VK_FORMAT_R8G8B8A8_UNORM;
+		break;
+	default:
+		assert(false);
+		vertex_attribute_format = VK_FORMAT_UNDEFINED;
+	}
+	return vertex_attribute_format;
 }
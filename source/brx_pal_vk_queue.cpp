@@ -22,6 +22,8 @@ brx_pal_vk_graphics_queue::brx_pal_vk_graphics_queue(
 	bool has_dedicated_upload_queue,
 	uint32_t upload_queue_family_index,
 	uint32_t graphics_queue_family_index,
+	bool support_ray_tracing,
+	bool has_dedicated_compute_queue,
 	VkQueue graphics_queue,
 	PFN_vkQueueSubmit pfn_queue_submit,
 	PFN_vkQueuePresentKHR pfn_queue_present)
@@ -29,6 +31,9 @@ brx_pal_vk_graphics_queue::brx_pal_vk_graphics_queue(
 	  m_has_dedicated_upload_queue(has_dedicated_upload_queue),
 	  m_upload_queue_family_index(upload_queue_family_index),
 	  m_graphics_queue_family_index(graphics_queue_family_index),
+	  m_support_ray_tracing(support_ray_tracing),
+	  m_has_dedicated_compute_queue(has_dedicated_compute_queue),
+	  m_compute_queue_submit_semaphore_to_wait(VK_NULL_HANDLE),
 	  m_pfn_queue_submit(pfn_queue_submit),
 	  m_pfn_queue_present(pfn_queue_present)
 {
@@ -55,12 +60,15 @@ void brx_pal_vk_graphics_queue::wait_and_submit(brx_pal_upload_command_buffer co
 			// queue family ownership transfer
 			// acquire operation
 			//
-			VkPipelineStageFlags wait_dst_stage_mask[1] = {VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT};
+			uint32_t wait_semaphore_count = 1U;
+			VkSemaphore wait_semaphores[2] = {upload_queue_submit_semaphore, VK_NULL_HANDLE};
+			VkPipelineStageFlags wait_dst_stage_mask[2] = {VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, 0U};
+			this->pop_compute_queue_submit_semaphore_wait(&wait_semaphore_count, wait_semaphores, wait_dst_stage_mask);
 			VkSubmitInfo submit_info{
 				VK_STRUCTURE_TYPE_SUBMIT_INFO,
 				NULL,
-				1U,
-				&upload_queue_submit_semaphore,
+				wait_semaphore_count,
+				wait_semaphores,
 				wait_dst_stage_mask,
 				1U,
 				&graphics_command_buffer,
@@ -73,12 +81,15 @@ void brx_pal_vk_graphics_queue::wait_and_submit(brx_pal_upload_command_buffer co
 		{
 			assert(VK_NULL_HANDLE != upload_upload_command_buffer && VK_NULL_HANDLE == upload_graphics_command_buffer && VK_NULL_HANDLE != upload_queue_submit_semaphore);
 
-			VkPipelineStageFlags wait_dst_stage_mask[1] = {VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT};
+			uint32_t wait_semaphore_count = 1U;
+			VkSemaphore wait_semaphores[2] = {upload_queue_submit_semaphore, VK_NULL_HANDLE};
+			VkPipelineStageFlags wait_dst_stage_mask[2] = {VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, 0U};
+			this->pop_compute_queue_submit_semaphore_wait(&wait_semaphore_count, wait_semaphores, wait_dst_stage_mask);
 			VkSubmitInfo submit_info{
 				VK_STRUCTURE_TYPE_SUBMIT_INFO,
 				NULL,
-				1U,
-				&upload_queue_submit_semaphore,
+				wait_semaphore_count,
+				wait_semaphores,
 				wait_dst_stage_mask,
 				0U,
 				NULL,
@@ -92,12 +103,16 @@ void brx_pal_vk_graphics_queue::wait_and_submit(brx_pal_upload_command_buffer co
 	{
 		assert(VK_NULL_HANDLE == upload_upload_command_buffer && VK_NULL_HANDLE != upload_graphics_command_buffer && VK_NULL_HANDLE == upload_queue_submit_semaphore);
 
+		uint32_t wait_semaphore_count = 0U;
+		VkSemaphore wait_semaphores[1] = {VK_NULL_HANDLE};
+		VkPipelineStageFlags wait_dst_stage_mask[1] = {0U};
+		this->pop_compute_queue_submit_semaphore_wait(&wait_semaphore_count, wait_semaphores, wait_dst_stage_mask);
 		VkSubmitInfo submit_info{
 			VK_STRUCTURE_TYPE_SUBMIT_INFO,
 			NULL,
-			0U,
-			NULL,
-			NULL,
+			wait_semaphore_count,
+			(wait_semaphore_count > 0U) ? wait_semaphores : NULL,
+			(wait_semaphore_count > 0U) ? wait_dst_stage_mask : NULL,
 			1U,
 			&upload_graphics_command_buffer,
 			0U,
@@ -118,13 +133,16 @@ bool brx_pal_vk_graphics_queue::submit_and_present(brx_pal_graphics_command_buff
 	VkSwapchainKHR swap_chain = static_cast<brx_pal_vk_swap_chain const *>(brx_pal_swap_chain)->get_swap_chain();
 	VkFence fence = static_cast<brx_pal_vk_fence const *>(brx_pal_fence)->get_fence();
 
-	VkPipelineStageFlags wait_dst_stage_mask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+	uint32_t wait_semaphore_count = 1U;
+	VkSemaphore wait_semaphores[2] = {acquire_next_image_semaphore, VK_NULL_HANDLE};
+	VkPipelineStageFlags wait_dst_stage_mask[2] = {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, 0U};
+	this->pop_compute_queue_submit_semaphore_wait(&wait_semaphore_count, wait_semaphores, wait_dst_stage_mask);
 	VkSubmitInfo submit_info = {
 		VK_STRUCTURE_TYPE_SUBMIT_INFO,
 		NULL,
-		1U,
-		&acquire_next_image_semaphore,
-		&wait_dst_stage_mask,
+		wait_semaphore_count,
+		wait_semaphores,
+		wait_dst_stage_mask,
 		1U,
 		&command_buffer,
 		1U,
@@ -156,6 +174,56 @@ bool brx_pal_vk_graphics_queue::submit_and_present(brx_pal_graphics_command_buff
 	}
 }
 
+void brx_pal_vk_graphics_queue::wait(brx_pal_compute_command_buffer const *brx_pal_compute_command_buffer) const
+{
+	assert(NULL != brx_pal_compute_command_buffer);
+	VkCommandBuffer compute_command_buffer = static_cast<brx_pal_vk_compute_command_buffer const *>(brx_pal_compute_command_buffer)->get_command_buffer();
+	VkSemaphore compute_queue_submit_semaphore = static_cast<brx_pal_vk_compute_command_buffer const *>(brx_pal_compute_command_buffer)->get_compute_queue_submit_semaphore();
+
+	if (this->m_has_dedicated_compute_queue)
+	{
+		assert(VK_NULL_HANDLE != compute_command_buffer && VK_NULL_HANDLE != compute_queue_submit_semaphore);
+
+		// the second synchronization scope of the semaphore wait operation is the batch which contains it
+		// and thus the wait operation is deferred to the next submission of the graphics command buffer
+		assert(VK_NULL_HANDLE == this->m_compute_queue_submit_semaphore_to_wait);
+		this->m_compute_queue_submit_semaphore_to_wait = compute_queue_submit_semaphore;
+	}
+	else
+	{
+		assert(VK_NULL_HANDLE != compute_command_buffer && VK_NULL_HANDLE == compute_queue_submit_semaphore);
+
+		VkSubmitInfo submit_info{
+			VK_STRUCTURE_TYPE_SUBMIT_INFO,
+			NULL,
+			0U,
+			NULL,
+			NULL,
+			1U,
+			&compute_command_buffer,
+			0U,
+			NULL};
+		VkResult res_queue_submit = this->m_pfn_queue_submit(this->m_graphics_queue, 1U, &submit_info, VK_NULL_HANDLE);
+		assert(VK_SUCCESS == res_queue_submit);
+	}
+}
+
+void brx_pal_vk_graphics_queue::pop_compute_queue_submit_semaphore_wait(uint32_t *wait_semaphore_count, VkSemaphore *wait_semaphores, VkPipelineStageFlags *wait_dst_stage_mask) const
+{
+	if (VK_NULL_HANDLE != this->m_compute_queue_submit_semaphore_to_wait)
+	{
+		assert(this->m_has_dedicated_compute_queue);
+
+		// only the stages which read the compute pass results wait for the compute queue
+		// and the graphics work before these stages is allowed to overlap the compute work
+		wait_semaphores[(*wait_semaphore_count)] = this->m_compute_queue_submit_semaphore_to_wait;
+		wait_dst_stage_mask[(*wait_semaphore_count)] = (!this->m_support_ray_tracing) ? (g_graphics_queue_family_graphics_compute_pipeline_shader_read_stages) : (g_graphics_queue_family_graphics_compute_pipeline_shader_read_stages | g_graphics_queue_family_ray_tracing_pipeline_shader_read_stages | g_graphics_queue_family_acceleration_structure_build_shader_read_stages);
+		++(*wait_semaphore_count);
+
+		this->m_compute_queue_submit_semaphore_to_wait = VK_NULL_HANDLE;
+	}
+}
+
 void brx_pal_vk_graphics_queue::steal(VkQueue *out_graphics_queue)
 {
 	assert(NULL != out_graphics_queue);
@@ -246,4 +314,58 @@ void brx_pal_vk_upload_queue::steal(VkQueue *out_upload_queue)
 brx_pal_vk_upload_queue::~brx_pal_vk_upload_queue()
 {
 	assert(VK_NULL_HANDLE == this->m_upload_queue);
-}
\ No newline at end of file
+}
+
+brx_pal_vk_compute_queue::brx_pal_vk_compute_queue(
+	bool has_dedicated_compute_queue,
+	VkQueue compute_queue,
+	PFN_vkQueueSubmit pfn_queue_submit)
+	: m_compute_queue(compute_queue),
+	  m_has_dedicated_compute_queue(has_dedicated_compute_queue),
+	  m_pfn_queue_submit(pfn_queue_submit)
+{
+}
+
+void brx_pal_vk_compute_queue::submit_and_signal(brx_pal_compute_command_buffer const *brx_pal_compute_command_buffer) const
+{
+	assert(NULL != brx_pal_compute_command_buffer);
+	VkCommandBuffer compute_command_buffer = static_cast<brx_pal_vk_compute_command_buffer const *>(brx_pal_compute_command_buffer)->get_command_buffer();
+	VkSemaphore compute_queue_submit_semaphore = static_cast<brx_pal_vk_compute_command_buffer const *>(brx_pal_compute_command_buffer)->get_compute_queue_submit_semaphore();
+
+	if (this->m_has_dedicated_compute_queue)
+	{
+		assert(VK_NULL_HANDLE != compute_command_buffer && VK_NULL_HANDLE != compute_queue_submit_semaphore);
+
+		VkSubmitInfo submit_info{
+			VK_STRUCTURE_TYPE_SUBMIT_INFO,
+			NULL,
+			0U,
+			NULL,
+			NULL,
+			1U,
+			&compute_command_buffer,
+			1U,
+			&compute_queue_submit_semaphore};
+		VkResult res_queue_submit = this->m_pfn_queue_submit(this->m_compute_queue, 1U, &submit_info, VK_NULL_HANDLE);
+		assert(VK_SUCCESS == res_queue_submit);
+	}
+	else
+	{
+		// the compute command buffer will be submitted by the graphics queue "wait"
+		assert(VK_NULL_HANDLE != compute_command_buffer && VK_NULL_HANDLE == compute_queue_submit_semaphore);
+	}
+}
+
+void brx_pal_vk_compute_queue::steal(VkQueue *out_compute_queue)
+{
+	assert(NULL != out_compute_queue);
+
+	(*out_compute_queue) = this->m_compute_queue;
+
+	this->m_compute_queue = VK_NULL_HANDLE;
+}
+
+brx_pal_vk_compute_queue::~brx_pal_vk_compute_queue()
+{
+	assert(VK_NULL_HANDLE == this->m_compute_queue);
+}
@@ -18,7 +18,7 @@
 #include "brx_pal_vk_device.h"
 #include <assert.h>
 
-brx_pal_vk_render_pass::brx_pal_vk_render_pass(VkRenderPass render_pass, uint32_t color_attachment_count) : m_render_pass(render_pass), m_color_attachment_count(color_attachment_count)
+brx_pal_vk_render_pass::brx_pal_vk_render_pass(VkRenderPass render_pass, uint32_t color_attachment_count, uint32_t sample_count) : m_render_pass(render_pass), m_color_attachment_count(color_attachment_count), m_sample_count(sample_count)
 {
 }
 
@@ -32,6 +32,11 @@ uint32_t brx_pal_vk_render_pass::get_color_attachment_count() const
 	return this->m_color_attachment_count;
 }
 
+uint32_t brx_pal_vk_render_pass::get_sample_count() const
+{
+	return this->m_sample_count;
+}
+
 void brx_pal_vk_render_pass::steal(VkRenderPass *out_render_pass)
 {
 	assert(NULL != out_render_pass);
@@ -16,9 +16,16 @@
 //
 
 #include "brx_pal_vk_device.h"
+#include "../../McRT-Malloc/include/mcrt_malloc.h"
+#include <string.h>
 #include <assert.h>
+#include <new>
 
-brx_pal_vk_sampler::brx_pal_vk_sampler(VkSampler sampler) : m_sampler(sampler)
+static inline uint64_t _internal_hash_sampler_desc(BRX_PAL_SAMPLER_DESC const *sampler_desc);
+
+static inline bool _internal_equal_sampler_desc(BRX_PAL_SAMPLER_DESC const *sampler_desc_a, BRX_PAL_SAMPLER_DESC const *sampler_desc_b);
+
+brx_pal_vk_sampler::brx_pal_vk_sampler(uint64_t sampler_desc_hash, BRX_PAL_SAMPLER_DESC const *sampler_desc, VkSampler sampler) : m_next(NULL), m_sampler_desc_hash(sampler_desc_hash), m_sampler_desc(*sampler_desc), m_sampler(sampler), m_reference_count(1U)
 {
 }
 
@@ -39,4 +46,329 @@ void brx_pal_vk_sampler::steal(VkSampler *out_sampler)
 brx_pal_vk_sampler::~brx_pal_vk_sampler()
 {
 	assert(VK_NULL_HANDLE == this->m_sampler);
+	assert(0U == this->m_reference_count);
+}
+
+brx_pal_vk_sampler *brx_pal_vk_sampler::get_next() const
+{
+	return this->m_next;
+}
+
+void brx_pal_vk_sampler::set_next(brx_pal_vk_sampler *next)
+{
+	this->m_next = next;
+}
+
+uint64_t brx_pal_vk_sampler::get_sampler_desc_hash() const
+{
+	return this->m_sampler_desc_hash;
+}
+
+BRX_PAL_SAMPLER_DESC const *brx_pal_vk_sampler::get_sampler_desc() const
+{
+	return &this->m_sampler_desc;
+}
+
+void brx_pal_vk_sampler::add_reference()
+{
+	assert(this->m_reference_count > 0U);
+	++this->m_reference_count;
+}
+
+bool brx_pal_vk_sampler::release_reference()
+{
+	assert(this->m_reference_count > 0U);
+	--this->m_reference_count;
+	return (0U == this->m_reference_count);
+}
+
+brx_pal_vk_sampler_cache::brx_pal_vk_sampler_cache() : m_pfn_create_sampler(NULL), m_pfn_destroy_sampler(NULL), m_device(VK_NULL_HANDLE), m_allocation_callbacks(NULL), m_support_sampler_anisotropy(false)
+{
+}
+
+void brx_pal_vk_sampler_cache::init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, bool support_sampler_anisotropy)
+{
+	assert(NULL == this->m_pfn_create_sampler);
+	this->m_pfn_create_sampler = reinterpret_cast<PFN_vkCreateSampler>(pfn_get_device_proc_addr(device, "vkCreateSampler"));
+	assert(NULL != this->m_pfn_create_sampler);
+
+	assert(NULL == this->m_pfn_destroy_sampler);
+	this->m_pfn_destroy_sampler = reinterpret_cast<PFN_vkDestroySampler>(pfn_get_device_proc_addr(device, "vkDestroySampler"));
+	assert(NULL != this->m_pfn_destroy_sampler);
+
+	assert(VK_NULL_HANDLE == this->m_device);
+	this->m_device = device;
+
+	assert(NULL == this->m_allocation_callbacks);
+	this->m_allocation_callbacks = allocation_callbacks;
+
+	assert(!this->m_support_sampler_anisotropy);
+	this->m_support_sampler_anisotropy = support_sampler_anisotropy;
+
+	assert(this->m_samplers.empty());
+}
+
+void brx_pal_vk_sampler_cache::uninit()
+{
+	// all samplers should have been destroyed
+	assert(this->m_samplers.empty());
+
+	this->m_support_sampler_anisotropy = false;
+
+	this->m_allocation_callbacks = NULL;
+
+	assert(VK_NULL_HANDLE != this->m_device);
+	this->m_device = VK_NULL_HANDLE;
+
+	assert(NULL != this->m_pfn_destroy_sampler);
+	this->m_pfn_destroy_sampler = NULL;
+
+	assert(NULL != this->m_pfn_create_sampler);
+	this->m_pfn_create_sampler = NULL;
+}
+
+brx_pal_vk_sampler_cache::~brx_pal_vk_sampler_cache()
+{
+	assert(NULL == this->m_pfn_create_sampler);
+	assert(NULL == this->m_pfn_destroy_sampler);
+	assert(VK_NULL_HANDLE == this->m_device);
+	assert(this->m_samplers.empty());
+}
+
+brx_pal_vk_sampler *brx_pal_vk_sampler_cache::acquire(BRX_PAL_SAMPLER_DESC const *wrapped_sampler_desc)
+{
+	assert(NULL != wrapped_sampler_desc);
+
+	// the states which do NOT affect the sampler are normalized to improve the hit rate
+	BRX_PAL_SAMPLER_DESC sampler_desc = (*wrapped_sampler_desc);
+	if ((!this->m_support_sampler_anisotropy) || (BRX_PAL_SAMPLER_FILTER_LINEAR != sampler_desc.filter) || (sampler_desc.max_anisotropy < 1U))
+	{
+		sampler_desc.max_anisotropy = 1U;
+	}
+	else if (sampler_desc.max_anisotropy > BRX_PAL_SAMPLER_MAX_ANISOTROPY)
+	{
+		sampler_desc.max_anisotropy = BRX_PAL_SAMPLER_MAX_ANISOTROPY;
+	}
+	if ((BRX_PAL_SAMPLER_ADDRESS_MODE_BORDER != sampler_desc.address_mode_u) && (BRX_PAL_SAMPLER_ADDRESS_MODE_BORDER != sampler_desc.address_mode_v) && (BRX_PAL_SAMPLER_ADDRESS_MODE_BORDER != sampler_desc.address_mode_w))
+	{
+		sampler_desc.border_color = BRX_PAL_SAMPLER_BORDER_COLOR_TRANSPARENT_BLACK;
+	}
+
+	uint64_t const sampler_desc_hash = _internal_hash_sampler_desc(&sampler_desc);
+
+	std::lock_guard<std::mutex> lock_guard(this->m_mutex);
+
+	brx_pal_vk_sampler *head_sampler = NULL;
+	{
+		auto const found_sampler = this->m_samplers.find(sampler_desc_hash);
+		if (this->m_samplers.end() != found_sampler)
+		{
+			head_sampler = found_sampler->second;
+			assert(NULL != head_sampler);
+		}
+	}
+
+	for (brx_pal_vk_sampler *sampler = head_sampler; NULL != sampler; sampler = sampler->get_next())
+	{
+		assert(sampler_desc_hash == sampler->get_sampler_desc_hash());
+		if (_internal_equal_sampler_desc(&sampler_desc, sampler->get_sampler_desc()))
+		{
+			sampler->add_reference();
+			return sampler;
+		}
+	}
+
+	VkSampler new_sampler = VK_NULL_HANDLE;
+	{
+		VkFilter unwrapped_filter;
+		VkSamplerMipmapMode unwrapped_mipmap_mode;
+		switch (sampler_desc.filter)
+		{
+		case BRX_PAL_SAMPLER_FILTER_NEAREST:
+			unwrapped_filter = VK_FILTER_NEAREST;
+			unwrapped_mipmap_mode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+			break;
+		case BRX_PAL_SAMPLER_FILTER_LINEAR:
+			unwrapped_filter = VK_FILTER_LINEAR;
+			unwrapped_mipmap_mode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+			break;
+		default:
+			assert(false);
+			unwrapped_filter = static_cast<VkFilter>(-1);
+			unwrapped_mipmap_mode = static_cast<VkSamplerMipmapMode>(-1);
+		}
+
+		VkSamplerAddressMode unwrapped_address_modes[3];
+		BRX_PAL_SAMPLER_ADDRESS_MODE const wrapped_address_modes[3] = {sampler_desc.address_mode_u, sampler_desc.address_mode_v, sampler_desc.address_mode_w};
+		for (uint32_t address_mode_index = 0U; address_mode_index < 3U; ++address_mode_index)
+		{
+			switch (wrapped_address_modes[address_mode_index])
+			{
+			case BRX_PAL_SAMPLER_ADDRESS_MODE_WRAP:
+				unwrapped_address_modes[address_mode_index] = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+				break;
+			case BRX_PAL_SAMPLER_ADDRESS_MODE_CLAMP:
+				unwrapped_address_modes[address_mode_index] = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+				break;
+			case BRX_PAL_SAMPLER_ADDRESS_MODE_MIRROR:
+				unwrapped_address_modes[address_mode_index] = VK_SAMPLER_ADDRESS_MODE_MIRRORED_REPEAT;
+				break;
+			case BRX_PAL_SAMPLER_ADDRESS_MODE_BORDER:
+				unwrapped_address_modes[address_mode_index] = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_BORDER;
+				break;
+			default:
+				assert(false);
+				unwrapped_address_modes[address_mode_index] = static_cast<VkSamplerAddressMode>(-1);
+			}
+		}
+
+		VkCompareOp unwrapped_compare_operation;
+		switch (sampler_desc.compare_operation)
+		{
+		case BRX_PAL_SAMPLER_COMPARE_OPERATION_DISABLE:
+			unwrapped_compare_operation = VK_COMPARE_OP_NEVER;
+			break;
+		case BRX_PAL_SAMPLER_COMPARE_OPERATION_GREATER:
+			unwrapped_compare_operation = VK_COMPARE_OP_GREATER;
+			break;
+		case BRX_PAL_SAMPLER_COMPARE_OPERATION_GREATER_EQUAL:
+			unwrapped_compare_operation = VK_COMPARE_OP_GREATER_OR_EQUAL;
+			break;
+		case BRX_PAL_SAMPLER_COMPARE_OPERATION_LESS:
+			unwrapped_compare_operation = VK_COMPARE_OP_LESS;
+			break;
+		case BRX_PAL_SAMPLER_COMPARE_OPERATION_LESS_EQUAL:
+			unwrapped_compare_operation = VK_COMPARE_OP_LESS_OR_EQUAL;
+			break;
+		default:
+			assert(false);
+			unwrapped_compare_operation = static_cast<VkCompareOp>(-1);
+		}
+
+		VkBorderColor unwrapped_border_color;
+		switch (sampler_desc.border_color)
+		{
+		case BRX_PAL_SAMPLER_BORDER_COLOR_TRANSPARENT_BLACK:
+			unwrapped_border_color = VK_BORDER_COLOR_FLOAT_TRANSPARENT_BLACK;
+			break;
+		case BRX_PAL_SAMPLER_BORDER_COLOR_OPAQUE_BLACK:
+			unwrapped_border_color = VK_BORDER_COLOR_FLOAT_OPAQUE_BLACK;
+			break;
+		case BRX_PAL_SAMPLER_BORDER_COLOR_OPAQUE_WHITE:
+			unwrapped_border_color = VK_BORDER_COLOR_FLOAT_OPAQUE_WHITE;
+			break;
+		default:
+			assert(false);
+			unwrapped_border_color = static_cast<VkBorderColor>(-1);
+		}
+
+		assert(sampler_desc.min_lod <= sampler_desc.max_lod);
+
+		VkSamplerCreateInfo const sampler_create_info = {
+			VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO,
+			NULL,
+			0U,
+			unwrapped_filter,
+			unwrapped_filter,
+			unwrapped_mipmap_mode,
+			unwrapped_address_modes[0],
+			unwrapped_address_modes[1],
+			unwrapped_address_modes[2],
+			sampler_desc.mip_lod_bias,
+			(sampler_desc.max_anisotropy > 1U) ? static_cast<VkBool32>(VK_TRUE) : static_cast<VkBool32>(VK_FALSE),
+			static_cast<float>(sampler_desc.max_anisotropy),
+			(BRX_PAL_SAMPLER_COMPARE_OPERATION_DISABLE != sampler_desc.compare_operation) ? static_cast<VkBool32>(VK_TRUE) : static_cast<VkBool32>(VK_FALSE),
+			unwrapped_compare_operation,
+			sampler_desc.min_lod,
+			sampler_desc.max_lod,
+			unwrapped_border_color,
+			VK_FALSE};
+
+		VkResult const res_create_sampler = this->m_pfn_create_sampler(this->m_device, &sampler_create_info, this->m_allocation_callbacks, &new_sampler);
+		assert(VK_SUCCESS == res_create_sampler);
+	}
+
+	void *new_brx_pal_sampler_base = mcrt_malloc(sizeof(brx_pal_vk_sampler), alignof(brx_pal_vk_sampler));
+	assert(NULL != new_brx_pal_sampler_base);
+
+	brx_pal_vk_sampler *new_brx_pal_sampler = new (new_brx_pal_sampler_base) brx_pal_vk_sampler{sampler_desc_hash, &sampler_desc, new_sampler};
+	new_brx_pal_sampler->set_next(head_sampler);
+
+	this->m_samplers[sampler_desc_hash] = new_brx_pal_sampler;
+
+	return new_brx_pal_sampler;
+}
+
+void brx_pal_vk_sampler_cache::release(brx_pal_vk_sampler *sampler)
+{
+	assert(NULL != sampler);
+
+	std::lock_guard<std::mutex> lock_guard(this->m_mutex);
+
+	if (sampler->release_reference())
+	{
+		auto const found_sampler = this->m_samplers.find(sampler->get_sampler_desc_hash());
+		assert(this->m_samplers.end() != found_sampler);
+
+		// unlink the sampler from the samplers with the same hash
+		if (found_sampler->second == sampler)
+		{
+			if (NULL != sampler->get_next())
+			{
+				found_sampler->second = sampler->get_next();
+			}
+			else
+			{
+				this->m_samplers.erase(found_sampler);
+			}
+		}
+		else
+		{
+			brx_pal_vk_sampler *previous_sampler = found_sampler->second;
+			while (previous_sampler->get_next() != sampler)
+			{
+				previous_sampler = previous_sampler->get_next();
+				assert(NULL != previous_sampler);
+			}
+			previous_sampler->set_next(sampler->get_next());
+		}
+
+		VkSampler stealed_sampler = VK_NULL_HANDLE;
+		sampler->steal(&stealed_sampler);
+
+		sampler->~brx_pal_vk_sampler();
+		mcrt_free(sampler);
+
+		this->m_pfn_destroy_sampler(this->m_device, stealed_sampler, this->m_allocation_callbacks);
+	}
+}
+
+static inline uint64_t _internal_hash_sampler_desc(BRX_PAL_SAMPLER_DESC const *sampler_desc)
+{
+	// FNV-1a
+	uint32_t values[10];
+	values[0] = static_cast<uint32_t>(sampler_desc->filter);
+	values[1] = static_cast<uint32_t>(sampler_desc->address_mode_u);
+	values[2] = static_cast<uint32_t>(sampler_desc->address_mode_v);
+	values[3] = static_cast<uint32_t>(sampler_desc->address_mode_w);
+	values[4] = sampler_desc->max_anisotropy;
+	memcpy(&values[5], &sampler_desc->mip_lod_bias, sizeof(uint32_t));
+	memcpy(&values[6], &sampler_desc->min_lod, sizeof(uint32_t));
+	memcpy(&values[7], &sampler_desc->max_lod, sizeof(uint32_t));
+	values[8] = static_cast<uint32_t>(sampler_desc->compare_operation);
+	values[9] = static_cast<uint32_t>(sampler_desc->border_color);
+
+	uint64_t h = 0XCBF29CE484222325ULL;
+	for (uint32_t value_index = 0U; value_index < (sizeof(values) / sizeof(values[0])); ++value_index)
+	{
+		h ^= values[value_index];
+		h *= 0X100000001B3ULL;
+	}
+
+	return h;
+}
+
+static inline bool _internal_equal_sampler_desc(BRX_PAL_SAMPLER_DESC const *sampler_desc_a, BRX_PAL_SAMPLER_DESC const *sampler_desc_b)
+{
+	return (sampler_desc_a->filter == sampler_desc_b->filter) && (sampler_desc_a->address_mode_u == sampler_desc_b->address_mode_u) && (sampler_desc_a->address_mode_v == sampler_desc_b->address_mode_v) && (sampler_desc_a->address_mode_w == sampler_desc_b->address_mode_w) && (sampler_desc_a->max_anisotropy == sampler_desc_b->max_anisotropy) && (sampler_desc_a->mip_lod_bias == sampler_desc_b->mip_lod_bias) && (sampler_desc_a->min_lod == sampler_desc_b->min_lod) && (sampler_desc_a->max_lod == sampler_desc_b->max_lod) && (sampler_desc_a->compare_operation == sampler_desc_b->compare_operation) && (sampler_desc_a->border_color == sampler_desc_b->border_color);
 }
\ No newline at end of file
@@ -0,0 +1,259 @@
+//
+// Copyright (C) YuqiaoZhang(HanetakaChou)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#include "brx_pal_vk_device.h"
+#include "../../McRT-Malloc/include/mcrt_malloc.h"
+#include <string.h>
+#include <assert.h>
+
+static inline uint64_t _internal_hash_shader_module_code(uint64_t seed, size_t code_size, void const *code);
+
+brx_pal_vk_shader_module_cache::brx_pal_vk_shader_module_cache() : m_pfn_create_shader_module(NULL), m_pfn_destroy_shader_module(NULL), m_device(VK_NULL_HANDLE), m_allocation_callbacks(NULL)
+{
+}
+
+void brx_pal_vk_shader_module_cache::init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+{
+	assert(NULL == this->m_pfn_create_shader_module);
+	this->m_pfn_create_shader_module = reinterpret_cast<PFN_vkCreateShaderModule>(pfn_get_device_proc_addr(device, "vkCreateShaderModule"));
+	assert(NULL != this->m_pfn_create_shader_module);
+
+	assert(NULL == this->m_pfn_destroy_shader_module);
+	this->m_pfn_destroy_shader_module = reinterpret_cast<PFN_vkDestroyShaderModule>(pfn_get_device_proc_addr(device, "vkDestroyShaderModule"));
+	assert(NULL != this->m_pfn_destroy_shader_module);
+
+	assert(VK_NULL_HANDLE == this->m_device);
+	this->m_device = device;
+
+	assert(NULL == this->m_allocation_callbacks);
+	this->m_allocation_callbacks = allocation_callbacks;
+
+	assert(this->m_entries.empty());
+}
+
+void brx_pal_vk_shader_module_cache::uninit()
+{
+	// all pipelines should have been destroyed
+	assert(this->m_entries.empty());
+
+	this->m_allocation_callbacks = NULL;
+
+	assert(VK_NULL_HANDLE != this->m_device);
+	this->m_device = VK_NULL_HANDLE;
+
+	assert(NULL != this->m_pfn_destroy_shader_module);
+	this->m_pfn_destroy_shader_module = NULL;
+
+	assert(NULL != this->m_pfn_create_shader_module);
+	this->m_pfn_create_shader_module = NULL;
+}
+
+brx_pal_vk_shader_module_cache::~brx_pal_vk_shader_module_cache()
+{
+	assert(NULL == this->m_pfn_create_shader_module);
+	assert(NULL == this->m_pfn_destroy_shader_module);
+	assert(VK_NULL_HANDLE == this->m_device);
+	assert(this->m_entries.empty());
+}
+
+brx_pal_vk_shader_module_cache_entry *brx_pal_vk_shader_module_cache::acquire(size_t code_size, void const *code)
+{
+	assert(0U < code_size);
+	assert(0U == (code_size % sizeof(uint32_t)));
+	assert(NULL != code);
+
+	// the hashes are calculated outside the lock
+	uint64_t const code_hash = _internal_hash_shader_module_code(0X8445D61A4E774912ULL, code_size, code);
+	uint64_t const code_check_hash = _internal_hash_shader_module_code(0X2D358DCCAA6C78A5ULL, code_size, code);
+
+	{
+		std::lock_guard<std::mutex> lock_guard(this->m_mutex);
+
+		brx_pal_vk_shader_module_cache_entry *const found_entry = this->find(code_hash, code_check_hash, code_size);
+		if (NULL != found_entry)
+		{
+			assert(found_entry->m_reference_count > 0U);
+			++found_entry->m_reference_count;
+			return found_entry;
+		}
+	}
+
+	// the shader module is created outside the lock since the driver may compile the SPIR-V code
+	VkShaderModule new_shader_module = VK_NULL_HANDLE;
+	{
+		VkShaderModuleCreateInfo const shader_module_create_info = {
+			VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
+			NULL,
+			0U,
+			code_size,
+			static_cast<uint32_t const *>(code)};
+
+		VkResult const res_create_shader_module = this->m_pfn_create_shader_module(this->m_device, &shader_module_create_info, this->m_allocation_callbacks, &new_shader_module);
+		assert(VK_SUCCESS == res_create_shader_module);
+	}
+
+	brx_pal_vk_shader_module_cache_entry *const new_entry = static_cast<brx_pal_vk_shader_module_cache_entry *>(mcrt_malloc(sizeof(brx_pal_vk_shader_module_cache_entry), alignof(brx_pal_vk_shader_module_cache_entry)));
+	assert(NULL != new_entry);
+	new_entry->m_next = NULL;
+	new_entry->m_code_hash = code_hash;
+	new_entry->m_code_check_hash = code_check_hash;
+	new_entry->m_code_size = code_size;
+	new_entry->m_shader_module = new_shader_module;
+	new_entry->m_reference_count = 1U;
+
+	brx_pal_vk_shader_module_cache_entry *found_entry;
+	{
+		std::lock_guard<std::mutex> lock_guard(this->m_mutex);
+
+		// the same SPIR-V code may have been inserted by another thread while the lock is NOT held
+		found_entry = this->find(code_hash, code_check_hash, code_size);
+		if (NULL != found_entry)
+		{
+			assert(found_entry->m_reference_count > 0U);
+			++found_entry->m_reference_count;
+		}
+		else
+		{
+			auto const head_entry = this->m_entries.find(code_hash);
+			if (this->m_entries.end() != head_entry)
+			{
+				new_entry->m_next = head_entry->second;
+				head_entry->second = new_entry;
+			}
+			else
+			{
+				this->m_entries.emplace(code_hash, new_entry);
+			}
+		}
+	}
+
+	if (NULL != found_entry)
+	{
+		this->m_pfn_destroy_shader_module(this->m_device, new_shader_module, this->m_allocation_callbacks);
+
+		mcrt_free(new_entry);
+
+		return found_entry;
+	}
+	else
+	{
+		return new_entry;
+	}
+}
+
+brx_pal_vk_shader_module_cache_entry *brx_pal_vk_shader_module_cache::find(uint64_t code_hash, uint64_t code_check_hash, size_t code_size) const
+{
+	auto const found_entry = this->m_entries.find(code_hash);
+	if (this->m_entries.end() != found_entry)
+	{
+		for (brx_pal_vk_shader_module_cache_entry *entry = found_entry->second; NULL != entry; entry = entry->m_next)
+		{
+			assert(code_hash == entry->m_code_hash);
+			if ((code_size == entry->m_code_size) && (code_check_hash == entry->m_code_check_hash))
+			{
+				return entry;
+			}
+		}
+	}
+
+	return NULL;
+}
+
+void brx_pal_vk_shader_module_cache::release(brx_pal_vk_shader_module_cache_entry *entry)
+{
+	assert(NULL != entry);
+
+	std::lock_guard<std::mutex> lock_guard(this->m_mutex);
+
+	assert(entry->m_reference_count > 0U);
+	--entry->m_reference_count;
+
+	if (0U == entry->m_reference_count)
+	{
+		auto const found_entry = this->m_entries.find(entry->m_code_hash);
+		assert(this->m_entries.end() != found_entry);
+
+		// unlink the entry from the entries with the same hash
+		if (found_entry->second == entry)
+		{
+			if (NULL != entry->m_next)
+			{
+				found_entry->second = entry->m_next;
+			}
+			else
+			{
+				this->m_entries.erase(found_entry);
+			}
+		}
+		else
+		{
+			brx_pal_vk_shader_module_cache_entry *previous_entry = found_entry->second;
+			while (previous_entry->m_next != entry)
+			{
+				previous_entry = previous_entry->m_next;
+				assert(NULL != previous_entry);
+			}
+			previous_entry->m_next = entry->m_next;
+		}
+
+		this->m_pfn_destroy_shader_module(this->m_device, entry->m_shader_module, this->m_allocation_callbacks);
+
+		mcrt_free(entry);
+	}
+}
+
+static inline uint64_t _internal_hash_shader_module_code(uint64_t seed, size_t code_size, void const *code)
+{
+	// MurmurHash64A
+	constexpr uint64_t const m = 0XC6A4A7935BD1E995ULL;
+	constexpr int const r = 47;
+
+	uint64_t h = seed ^ (static_cast<uint64_t>(code_size) * m);
+
+	uint8_t const *const data = static_cast<uint8_t const *>(code);
+	size_t const block_count = code_size / sizeof(uint64_t);
+
+	for (size_t block_index = 0U; block_index < block_count; ++block_index)
+	{
+		uint64_t k;
+		memcpy(&k, data + sizeof(uint64_t) * block_index, sizeof(uint64_t));
+
+		k *= m;
+		k ^= k >> r;
+		k *= m;
+
+		h ^= k;
+		h *= m;
+	}
+
+	// the size of the SPIR-V code is the multiple of 4 bytes
+	size_t const tail_size = code_size - sizeof(uint64_t) * block_count;
+	if (0U != tail_size)
+	{
+		uint64_t k = 0U;
+		memcpy(&k, data + sizeof(uint64_t) * block_count, tail_size);
+
+		h ^= k;
+		h *= m;
+	}
+
+	h ^= h >> r;
+	h *= m;
+	h ^= h >> r;
+
+	return h;
+}
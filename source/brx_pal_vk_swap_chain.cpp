@@ -116,12 +116,15 @@ VkSurfaceKHR brx_pal_vk_surface::get_surface() const
     return this->m_surface;
 }
 
-brx_pal_vk_swap_chain_image_view::brx_pal_vk_swap_chain_image_view() : m_image_view(VK_NULL_HANDLE)
+brx_pal_vk_swap_chain_image_view::brx_pal_vk_swap_chain_image_view() : m_image(VK_NULL_HANDLE), m_image_view(VK_NULL_HANDLE)
 {
 }
 
 void brx_pal_vk_swap_chain_image_view::init(VkDevice device, PFN_vkCreateImageView pfn_create_image_view, VkAllocationCallbacks const *allocation_callbacks, VkImage image, VkFormat image_format)
 {
+    assert(VK_NULL_HANDLE == this->m_image);
+    this->m_image = image;
+
     assert(VK_NULL_HANDLE == this->m_image_view);
 
     VkImageViewCreateInfo const image_view_create_info = {
@@ -143,6 +146,9 @@ void brx_pal_vk_swap_chain_image_view::uninit(VkDevice device, PFN_vkDestroyImag
     pfn_destroy_image_view(device, this->m_image_view, allocation_callbacks);
 
     this->m_image_view = VK_NULL_HANDLE;
+
+    // the image is owned by the swap chain
+    this->m_image = VK_NULL_HANDLE;
 }
 
 brx_pal_vk_swap_chain_image_view::~brx_pal_vk_swap_chain_image_view()
@@ -150,6 +156,11 @@ brx_pal_vk_swap_chain_image_view::~brx_pal_vk_swap_chain_image_view()
     assert(VK_NULL_HANDLE == this->m_image_view);
 }
 
+VkImage brx_pal_vk_swap_chain_image_view::get_image() const
+{
+    return this->m_image;
+}
+
 VkImageView brx_pal_vk_swap_chain_image_view::get_image_view() const
 {
     return this->m_image_view;